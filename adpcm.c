@@ -0,0 +1,250 @@
+#include <stdio.h>
+#include <math.h>
+#include "adpcm.h"
+#include "cycle_counter.h"
+/*
+   IMA-ADPCM decoder for flash clips
+   The step size, difference and next step index for every index and code are
+   combined in one table, so each sample is a table load, an add and a clamp
+ */
+
+#define ADPCM_STEPS 89                      // Step indexes 0 to 88
+#define ADPCM_ROW_BITS 11                   // Bits of a table entry holding the next row
+#define ADPCM_ROW_MASK ((1u << ADPCM_ROW_BITS) - 1)
+#define ADPCM_BENCH_SAMPLES 4096            // Most samples encoded by the benchmark
+
+static const int16_t step_sizes[ADPCM_STEPS] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t index_steps[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+// Difference * 2^11 + next row, for each step index and code
+static int32_t decode_table[ADPCM_STEPS * 16];
+static bool decode_ready = false;
+
+void adpcmInit(void)
+{
+    if (decode_ready)
+    {
+        return;
+    }
+
+    for (int index=0; index<ADPCM_STEPS; ++index)
+    {
+        int32_t step = step_sizes[index];
+
+        for (int code=0; code<16; ++code)
+        {
+            int32_t diff = step >> 3;
+            int next = index + index_steps[code & 7];
+
+            diff += (code & 4) ? step : 0;
+            diff += (code & 2) ? (step >> 1) : 0;
+            diff += (code & 1) ? (step >> 2) : 0;
+            diff = (code & 8) ? -diff : diff;
+            next = (next < 0) ? 0 : ((next >= ADPCM_STEPS) ? (ADPCM_STEPS - 1) : next);
+
+            decode_table[(index * 16) + code] = (diff * (1 << ADPCM_ROW_BITS)) + (next * 16);
+        }
+    }
+    decode_ready = true;
+}
+
+// Apply one code to the predictor and step
+static inline __attribute__((always_inline)) int32_t adpcmCode(int32_t predictor, uint* row, uint code)
+{
+    int32_t entry = decode_table[*row + code];
+
+    predictor += entry >> ADPCM_ROW_BITS;
+    *row = entry & ADPCM_ROW_MASK;
+    return (predictor > INT16_MAX) ? INT16_MAX : ((predictor < INT16_MIN) ? INT16_MIN : predictor);
+}
+
+// Load the state at the start of a block
+static inline void adpcmHeader(adpcm_state* st, const uint8_t* block)
+{
+    uint index = block[2];
+
+    st->predictor = (int16_t)(block[0] | (block[1] << 8));
+    st->row = ((index < ADPCM_STEPS) ? index : (ADPCM_STEPS - 1)) * 16;
+}
+
+void adpcmStart(adpcm_state* st, const uint8_t* clip, uint pos)
+{
+    const uint8_t* block = clip + ((pos / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES);
+    const uint8_t* codes = block + ADPCM_BLOCK_HEADER;
+    uint offset = pos & (ADPCM_BLOCK_SAMPLES - 1);
+
+    adpcmInit();
+    adpcmHeader(st, block);
+
+    // Decode up to pos within the block
+    for (uint i=0; i<offset; ++i)
+    {
+        st->predictor = adpcmCode(st->predictor, &st->row, (codes[i >> 1] >> ((i & 1) << 2)) & 0xF);
+    }
+}
+
+// Decode a run of codes within one block, starting on the high nibble when odd is set
+static void adpcmRun(adpcm_state* st, const uint8_t* codes, bool odd, int16_t* dest, uint len)
+{
+    int32_t predictor = st->predictor;
+    uint row = st->row;
+
+    if (odd)
+    {
+        predictor = adpcmCode(predictor, &row, *codes++ >> 4);
+        *dest++ = predictor;
+        len--;
+    }
+
+    for (; len >= 2; len -= 2)
+    {
+        uint byte = *codes++;
+
+        predictor = adpcmCode(predictor, &row, byte & 0xF);
+        dest[0] = predictor;
+        predictor = adpcmCode(predictor, &row, byte >> 4);
+        dest[1] = predictor;
+        dest += 2;
+    }
+
+    if (len)
+    {
+        predictor = adpcmCode(predictor, &row, *codes & 0xF);
+        *dest = predictor;
+    }
+    st->predictor = predictor;
+    st->row = row;
+}
+
+void adpcmDecode(adpcm_state* st, const uint8_t* clip, uint pos, int16_t* dest, uint len)
+{
+    while (len)
+    {
+        const uint8_t* block = clip + ((pos / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES);
+        uint offset = pos & (ADPCM_BLOCK_SAMPLES - 1);
+        uint run = ADPCM_BLOCK_SAMPLES - offset;
+
+        // Each block restarts from its header, so errors do not build up
+        if (!offset)
+        {
+            adpcmHeader(st, block);
+        }
+
+        run = (run < len) ? run : len;
+        adpcmRun(st, block + ADPCM_BLOCK_HEADER + (offset >> 1), offset & 1, dest, run);
+        dest += run;
+        pos += run;
+        len -= run;
+    }
+}
+
+// Choose the code for the difference from the predictor, one bit of the step at a time
+static uint adpcmQuantise(int32_t diff, int32_t step)
+{
+    uint code = 0;
+
+    if (diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+
+    for (uint bit=4; bit; bit >>= 1)
+    {
+        if (diff >= step)
+        {
+            code |= bit;
+            diff -= step;
+        }
+        step >>= 1;
+    }
+    return code;
+}
+
+uint adpcmEncode(uint8_t* dest, const int16_t* src, uint len)
+{
+    uint8_t* out = dest;
+    int32_t predictor = len ? src[0] : 0;
+    uint row = 0;
+
+    adpcmInit();
+
+    for (uint i=0; i<len; ++i)
+    {
+        if (!(i & (ADPCM_BLOCK_SAMPLES - 1)))
+        {
+            *out++ = predictor & 0xFF;
+            *out++ = (predictor >> 8) & 0xFF;
+            *out++ = row >> 4;
+            *out++ = 0;
+        }
+
+        uint code = adpcmQuantise(src[i] - predictor, step_sizes[row >> 4]);
+
+        // Track the decoder, so the predictor matches what will be played
+        predictor = adpcmCode(predictor, &row, code);
+
+        if (i & 1)
+        {
+            *out++ |= code << 4;
+        }
+        else
+        {
+            *out = code;
+        }
+    }
+    return (uint)(out - dest) + (len & 1);
+}
+
+// Encode the start of src, then time decoding it and measure the error
+void adpcmBenchmark(int16_t* dest, const int16_t* src, uint len)
+{
+    static uint8_t clip[ADPCM_BYTES(ADPCM_BENCH_SAMPLES)];
+    adpcm_state st;
+
+    len = (len < ADPCM_BENCH_SAMPLES) ? len : ADPCM_BENCH_SAMPLES;
+
+    if (!len)
+    {
+        return;
+    }
+
+    uint bytes = adpcmEncode(clip, src, len);
+
+    cycleCounterInit();
+
+    uint32_t start = cycleCounterRead();
+    adpcmStart(&st, clip, 0);
+    adpcmDecode(&st, clip, 0, dest, len);
+    uint32_t cycles = cycleCounterElapsed(start);
+
+    int64_t sum = 0;
+    for (uint i=0; i<len; ++i)
+    {
+        sum += src[i];
+    }
+
+    int32_t mean = (int32_t)(sum / (int64_t)len);
+    uint64_t signal = 0;
+    uint64_t error = 0;
+
+    for (uint i=0; i<len; ++i)
+    {
+        int32_t s = src[i] - mean;
+        int32_t e = src[i] - dest[i];
+
+        signal += (uint64_t)((int64_t)s * s);
+        error += (uint64_t)((int64_t)e * e);
+    }
+
+    printf("adpcm: %.2f cycles/sample, %u bytes for %u samples, SNR %.1f dB\n",
+           (float)cycles / (float)len, bytes, len, 10.0f * log10f((float)signal / (float)(error ? error : 1)));
+}
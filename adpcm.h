@@ -0,0 +1,40 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * IMA-ADPCM clips, 4 bits per sample
+ * A clip is a run of blocks. Each block starts with a 4 byte header holding the
+ * predictor (int16, little endian) and step index before its first sample, then
+ * ADPCM_BLOCK_SAMPLES codes, two to a byte with the low nibble first.
+ * The last block is cut short after the last code
+ */
+
+#define ADPCM_BLOCK_SAMPLES 256                                     // Samples per block, a power of 2
+#define ADPCM_BLOCK_HEADER 4                                        // Predictor, step index and a spare byte
+#define ADPCM_BLOCK_BYTES (ADPCM_BLOCK_HEADER + (ADPCM_BLOCK_SAMPLES / 2))
+
+// Bytes needed to hold a clip of samples
+#define ADPCM_BYTES(samples) ((((samples) / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES) + \
+                              (((samples) % ADPCM_BLOCK_SAMPLES) ? (ADPCM_BLOCK_HEADER + ((((samples) % ADPCM_BLOCK_SAMPLES) + 1) / 2)) : 0))
+
+// Decoder state between reads
+typedef struct adpcm_state
+{
+    int32_t   predictor;                // Last decoded sample
+    uint      row;                      // Step index * 16, the row of the decode table
+} adpcm_state;
+
+// Build the decode table, called by adpcmStart so only needed before using adpcmEncode alone
+extern void adpcmInit(void);
+
+// Set the state to decode from sample pos of the clip
+extern void adpcmStart(adpcm_state* st, const uint8_t* clip, uint pos);
+
+// Decode len samples from sample pos, which must follow the last sample decoded
+extern void adpcmDecode(adpcm_state* st, const uint8_t* clip, uint pos, int16_t* dest, uint len);
+
+// Encode len samples into dest, which must hold ADPCM_BYTES(len). Returns the bytes written
+extern uint adpcmEncode(uint8_t* dest, const int16_t* src, uint len);
+
+// Encode len samples of src, then report decode cycles per sample and the SNR over the UART
+extern void adpcmBenchmark(int16_t* dest, const int16_t* src, uint len);
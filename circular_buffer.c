@@ -1,29 +1,305 @@
+#include <stdio.h>
 #include "circular_buffer.h"
+#include "cycle_counter.h"
 /*
    Manages a circular buffer
    This buffer can either be in RAM or Flash
+   Reads are split into contiguous runs at the wrap, so the copy loops
+   have no wrap test
+   ADPCM clips are decoded in the same runs, restarting from the loop block at the wrap
+   Packed 8 and 12 bit clips are unpacked a word at a time, halving the flash read
  */
 
+#define CIRCULAR_BUFFER_CHUNK 64    // Frames unpacked at a time when writing PWM levels
+#define CIRCULAR_BUFFER_BENCH 2048  // Samples of the clip in each format for the benchmark
+
+// Convert a stored sample to signed 16 bits
+#define CIRCULAR_BUFFER_SAMPLE(value, shift) ((int16_t)(((value) << (shift)) - 0x8000))
+
 // Create the buffers
 void circularBufferCreate(circular_buffer* cb, const int16_t* buff, uint buffer_len, uint shift)
 {
+    cb->format = circular_u16;
     cb->buffer = buff;
+    cb->bytes = 0;
     cb->buffer_len = buffer_len;
+    cb->loop_start = 0;
+    cb->channels = 1;
     cb->shift = shift;
     cb->pos = 0;
 }
 
+void circularBufferCreatePacked(circular_buffer* cb, enum circular_format format, const uint8_t* data, uint buffer_len)
+{
+    circularBufferCreate(cb, 0, buffer_len, (format == circular_u12) ? 4 : 8);
+    cb->format = format;
+    cb->bytes = data;
+}
+
+void circularBufferCreateAdpcm(circular_buffer* cb, const uint8_t* data, uint buffer_len)
+{
+    circularBufferCreate(cb, 0, buffer_len, 0);
+    cb->format = circular_adpcm;
+    cb->bytes = data;
+    adpcmStart(&cb->adpcm, data, 0);
+}
+
+void circularBufferSetLoop(circular_buffer* cb, uint loop_start, uint channels)
+{
+    cb->loop_start = (loop_start < cb->buffer_len) ? loop_start : 0;
+    cb->channels = channels;
+}
+
+// Move to the loop start once the end is reached
+static inline void circularBufferWrap(circular_buffer* cb)
+{
+    if (cb->pos == cb->buffer_len)
+    {
+        cb->pos = cb->loop_start;
+
+        // Loops that start mid block decode up to the loop start once
+        if (cb->format == circular_adpcm)
+        {
+            adpcmStart(&cb->adpcm, cb->bytes, cb->pos);
+        }
+    }
+}
+
+// Convert a contiguous run of samples, four at a time
+static inline __attribute__((always_inline)) void circularBufferCopy(int16_t* dest, const int16_t* src, uint len, uint shift)
+{
+    for (; len >= 4; len -= 4)
+    {
+        dest[0] = CIRCULAR_BUFFER_SAMPLE(src[0], shift);
+        dest[1] = CIRCULAR_BUFFER_SAMPLE(src[1], shift);
+        dest[2] = CIRCULAR_BUFFER_SAMPLE(src[2], shift);
+        dest[3] = CIRCULAR_BUFFER_SAMPLE(src[3], shift);
+        dest += 4;
+        src += 4;
+    }
+
+    while (len--)
+    {
+        *dest++ = CIRCULAR_BUFFER_SAMPLE(*src++, shift);
+    }
+}
+
+// Convert a run of 8 bit samples, four from each word once src is aligned
+static void circularBufferCopy8(int16_t* dest, const uint8_t* src, uint len)
+{
+    while (len && ((uintptr_t)src & 3))
+    {
+        *dest++ = CIRCULAR_BUFFER_SAMPLE(*src++, 8);
+        len--;
+    }
+
+    for (; len >= 4; len -= 4)
+    {
+        uint32_t w = *(const uint32_t*)src;
+
+        dest[0] = CIRCULAR_BUFFER_SAMPLE(w & 0xFF, 8);
+        dest[1] = CIRCULAR_BUFFER_SAMPLE((w >> 8) & 0xFF, 8);
+        dest[2] = CIRCULAR_BUFFER_SAMPLE((w >> 16) & 0xFF, 8);
+        dest[3] = CIRCULAR_BUFFER_SAMPLE(w >> 24, 8);
+        dest += 4;
+        src += 4;
+    }
+
+    while (len--)
+    {
+        *dest++ = CIRCULAR_BUFFER_SAMPLE(*src++, 8);
+    }
+}
+
+// 12 bit sample pos, packed two to 3 bytes with the first in the low 12 bits
+static inline uint circularBufferUnpack12(const uint8_t* data, uint pos)
+{
+    const uint8_t* p = data + pos + (pos >> 1);
+
+    return (pos & 1) ? ((p[0] >> 4) | (p[1] << 4)) : (p[0] | ((p[1] & 0xF) << 8));
+}
+
+// Convert a run of 12 bit samples, eight from each 3 words once pos is a multiple of 8
+static void circularBufferCopy12(int16_t* dest, const uint8_t* data, uint pos, uint len)
+{
+    // Word loads need the data aligned
+    if ((uintptr_t)data & 3)
+    {
+        while (len--)
+        {
+            *dest++ = CIRCULAR_BUFFER_SAMPLE(circularBufferUnpack12(data, pos++), 4);
+        }
+        return;
+    }
+
+    while (len && (pos & 7))
+    {
+        *dest++ = CIRCULAR_BUFFER_SAMPLE(circularBufferUnpack12(data, pos++), 4);
+        len--;
+    }
+
+    const uint32_t* src = (const uint32_t*)(data + ((pos >> 3) * 12));
+
+    for (; len >= 8; len -= 8)
+    {
+        uint32_t w0 = src[0];
+        uint32_t w1 = src[1];
+        uint32_t w2 = src[2];
+
+        dest[0] = CIRCULAR_BUFFER_SAMPLE(w0 & 0xFFF, 4);
+        dest[1] = CIRCULAR_BUFFER_SAMPLE((w0 >> 12) & 0xFFF, 4);
+        dest[2] = CIRCULAR_BUFFER_SAMPLE((w0 >> 24) | ((w1 & 0xF) << 8), 4);
+        dest[3] = CIRCULAR_BUFFER_SAMPLE((w1 >> 4) & 0xFFF, 4);
+        dest[4] = CIRCULAR_BUFFER_SAMPLE((w1 >> 16) & 0xFFF, 4);
+        dest[5] = CIRCULAR_BUFFER_SAMPLE((w1 >> 28) | ((w2 & 0xFF) << 4), 4);
+        dest[6] = CIRCULAR_BUFFER_SAMPLE((w2 >> 8) & 0xFFF, 4);
+        dest[7] = CIRCULAR_BUFFER_SAMPLE(w2 >> 20, 4);
+        dest += 8;
+        src += 3;
+        pos += 8;
+    }
+
+    while (len--)
+    {
+        *dest++ = CIRCULAR_BUFFER_SAMPLE(circularBufferUnpack12(data, pos++), 4);
+    }
+}
+
 // Populate destination from the circular buffer
 // len is the number of samples to copy
 void circularBufferRead(circular_buffer* cb, int16_t* dest, uint len)
 {
-    for (int i=0; i<len ; ++i)
+    // At most two runs, unless len is longer than the buffer
+    while (len)
     {
-        // Shift to full 16 bit unsigned, then convert to signed
-        dest[i] = (cb->buffer[cb->pos++] << cb->shift) - 0x8000;
+        uint run = cb->buffer_len - cb->pos;
+
+        run = (run < len) ? run : len;
+
+        switch (cb->format)
+        {
+            case circular_u8:
+                circularBufferCopy8(dest, cb->bytes + cb->pos, run);
+            break;
+
+            case circular_u12:
+                circularBufferCopy12(dest, cb->bytes, cb->pos, run);
+            break;
+
+            case circular_adpcm:
+                adpcmDecode(&cb->adpcm, cb->bytes, cb->pos, dest, run);
+            break;
+
+            default:
+                circularBufferCopy(dest, cb->buffer + cb->pos, run, cb->shift);
+            break;
+        }
+        dest += run;
+        len -= run;
+        cb->pos += run;
+        circularBufferWrap(cb);
+    }
+}
+
+// Populate destination with PWM levels, without an intermediate RAM buffer
+// Samples are unpacked a chunk at a time and converted by the fill kernel, so they are
+// noise shaped as the RAM buffers are
+void circularBufferReadDma(circular_buffer* cb, uint32_t* dest, uint frames, dma_fill* df)
+{
+    int16_t chunk[CIRCULAR_BUFFER_CHUNK * 2];
+
+    while (frames)
+    {
+        uint n = (frames < CIRCULAR_BUFFER_CHUNK) ? frames : CIRCULAR_BUFFER_CHUNK;
+
+        circularBufferRead(cb, chunk, n * cb->channels);
+        dmaFillRun(df, dest, chunk, n);
+        dest += n << df->shift;
+        frames -= n;
+    }
+}
+
+// Previous read, with a wrap test for every sample. Used as the benchmark reference
+static void circularBufferReadEach(circular_buffer* cb, int16_t* dest, uint len)
+{
+    for (uint i=0; i<len; ++i)
+    {
+        dest[i] = CIRCULAR_BUFFER_SAMPLE(cb->buffer[cb->pos++], cb->shift);
         if (cb->pos == cb->buffer_len)
         {
             cb->pos = 0;
         }
     }
-}
\ No newline at end of file
+}
+
+// Time a read of len samples that crosses the wrap
+static uint32_t circularBufferTime(circular_buffer* cb, int16_t* dest, uint len, bool each)
+{
+    cb->pos = cb->buffer_len - (len >> 1);
+
+    if (cb->format == circular_adpcm)
+    {
+        adpcmStart(&cb->adpcm, cb->bytes, cb->pos);
+    }
+
+    uint32_t start = cycleCounterRead();
+
+    if (each)
+    {
+        circularBufferReadEach(cb, dest, len);
+    }
+    else
+    {
+        circularBufferRead(cb, dest, len);
+    }
+    return cycleCounterElapsed(start);
+}
+
+// Store the start of the clip as 12 bit samples in each format, then time reads of each
+// across the wrap, per sample and in runs from 16 bit words, packed and ADPCM
+void circularBufferBenchmark(int16_t* dest, uint len, const circular_buffer* clip)
+{
+    static int16_t pcm[CIRCULAR_BUFFER_BENCH];
+    static int16_t words[CIRCULAR_BUFFER_BENCH];
+    static uint8_t bytes[CIRCULAR_BUFFER_BENCH] __attribute__((aligned(4)));
+    static uint8_t packed[(CIRCULAR_BUFFER_BENCH * 3) / 2] __attribute__((aligned(4)));
+    static uint8_t encoded[ADPCM_BYTES(CIRCULAR_BUFFER_BENCH)];
+    circular_buffer cb = *clip;
+
+    circularBufferRead(&cb, pcm, CIRCULAR_BUFFER_BENCH);
+    len = (len < CIRCULAR_BUFFER_BENCH) ? len : CIRCULAR_BUFFER_BENCH;
+
+    for (uint i=0; i<CIRCULAR_BUFFER_BENCH; i+=2)
+    {
+        uint a = (uint16_t)(pcm[i] + 0x8000) >> 4;
+        uint b = (uint16_t)(pcm[i + 1] + 0x8000) >> 4;
+
+        words[i] = a;
+        words[i + 1] = b;
+        bytes[i] = a >> 4;
+        bytes[i + 1] = b >> 4;
+        packed[(i * 3) / 2] = a & 0xFF;
+        packed[((i * 3) / 2) + 1] = (a >> 8) | ((b & 0xF) << 4);
+        packed[((i * 3) / 2) + 2] = b >> 4;
+    }
+    adpcmEncode(encoded, pcm, CIRCULAR_BUFFER_BENCH);
+
+    cycleCounterInit();
+
+    circularBufferCreate(&cb, words, CIRCULAR_BUFFER_BENCH, 4);
+    uint32_t each = circularBufferTime(&cb, dest, len, true);
+    uint32_t runs = circularBufferTime(&cb, dest, len, false);
+
+    circularBufferCreatePacked(&cb, circular_u8, bytes, CIRCULAR_BUFFER_BENCH);
+    uint32_t u8 = circularBufferTime(&cb, dest, len, false);
+
+    circularBufferCreatePacked(&cb, circular_u12, packed, CIRCULAR_BUFFER_BENCH);
+    uint32_t u12 = circularBufferTime(&cb, dest, len, false);
+
+    circularBufferCreateAdpcm(&cb, encoded, CIRCULAR_BUFFER_BENCH);
+    uint32_t adpcm = circularBufferTime(&cb, dest, len, false);
+
+    printf("circular read: per sample %.2f runs %.2f 8 bit %.2f 12 bit %.2f adpcm %.2f cycles/sample\n",
+           (float)each / (float)len, (float)runs / (float)len,
+           (float)u8 / (float)len, (float)u12 / (float)len, (float)adpcm / (float)len);
+}
@@ -1,18 +1,51 @@
 #pragma once
 #include "pico/stdlib.h"
+#include "dma_fill.h"
+#include "adpcm.h"
+
+// How samples are stored
+enum circular_format
+{
+    circular_u16 = 0,                       // One unsigned sample per 16 bit word, scaled by shift
+    circular_u8 = circular_u16 + 1,         // One unsigned 8 bit sample per byte
+    circular_u12 = circular_u8 + 1,         // Unsigned 12 bit samples, two packed in 3 bytes
+    circular_adpcm = circular_u12 + 1       // IMA-ADPCM blocks, 4 bits per sample
+};
 
 // Data for circular buffer
 typedef struct circular_buffer
 {
+    enum circular_format format;
     const int16_t* buffer;           // Address of buffer
-    uint      buffer_len;            // Length of buffer
+    const uint8_t* bytes;            // Address of encoded buffer, for byte formats
+    uint      buffer_len;            // Length of buffer, reads wrap from here to loop_start
+    uint      loop_start;            // Read position after the wrap
+    uint      channels;              // Interleaved channels, positions count samples of every channel
     uint      shift;                 // Shift to adjust range of data
     uint      pos;                   // Current read position in buffer
+    adpcm_state adpcm;               // Decoder state at pos
 } circular_buffer;
 
 // Create the buffers
 extern void circularBufferCreate(circular_buffer* cb, const int16_t* buff, uint buffer_len, uint shift);
 
+// Create the buffers from packed 8 or 12 bit samples
+// 12 bit data is only read a word at a time when it is aligned to 4 bytes
+extern void circularBufferCreatePacked(circular_buffer* cb, enum circular_format format, const uint8_t* data, uint buffer_len);
+
+// Create the buffers from an IMA-ADPCM clip of buffer_len samples
+extern void circularBufferCreateAdpcm(circular_buffer* cb, const uint8_t* data, uint buffer_len);
+
+// Loop from loop_start rather than the start. Set after creating the buffer
+extern void circularBufferSetLoop(circular_buffer* cb, uint loop_start, uint channels);
+
 // Populate destination from the circular buffer
 extern void circularBufferRead(circular_buffer* cb, int16_t* dest, uint len);
 
+// Populate a DMA buffer with PWM levels from the circular buffer
+// frames is the number of frames to read, each is repeated (1 << shift) times
+extern void circularBufferReadDma(circular_buffer* cb, uint32_t* dest, uint frames, dma_fill* df);
+
+// Report cycles per sample of reads across the wrap over the UART, for the start of
+// the clip stored in each format
+extern void circularBufferBenchmark(int16_t* dest, uint len, const circular_buffer* clip);
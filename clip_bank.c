@@ -0,0 +1,103 @@
+#include <string.h>
+#include "clip_bank.h"
+/*
+   Reads the directory of a clip bank image
+   Clips in a single bank use an entry outside any image, with offsets from the clip data
+ */
+
+// Bytes needed by a clip of this format and length
+static uint32_t clipBankBytes(const clip_bank_entry* entry)
+{
+    uint32_t samples = entry->frames * entry->channels;
+
+    switch (entry->format)
+    {
+        case circular_u8:
+            return samples;
+
+        case circular_u12:
+            return ((samples * 3) + 1) / 2;
+
+        case circular_adpcm:
+            return ADPCM_BYTES(samples);
+
+        default:
+            return samples * 2;
+    }
+}
+
+bool clipBankOpen(clip_bank* bank, const uint8_t* image)
+{
+    const clip_bank_header* header = (const clip_bank_header*)image;
+
+    bank->image = image;
+    bank->entries = (const clip_bank_entry*)(image + sizeof(clip_bank_header));
+    bank->count = 0;
+
+    if ((header->magic != CLIP_BANK_MAGIC) || (header->version != CLIP_BANK_VERSION) ||
+        (header->size < (sizeof(clip_bank_header) + (header->count * sizeof(clip_bank_entry)))))
+    {
+        return false;
+    }
+
+    for (uint i=0; i<header->count; ++i)
+    {
+        const clip_bank_entry* entry = &bank->entries[i];
+
+        if ((entry->format > circular_adpcm) || (entry->channels < 1) || (entry->channels > 2) ||
+            ((entry->format == circular_adpcm) && (entry->channels != 1)) ||
+            (entry->offset & (CLIP_BANK_ALIGN - 1)) || (entry->bytes < clipBankBytes(entry)) ||
+            (entry->offset > header->size) || (entry->bytes > (header->size - entry->offset)) ||
+            ((entry->format == circular_u16) && ((entry->bits < 1) || (entry->bits > 16))) ||
+            !entry->frames || (entry->loop_end > entry->frames) ||
+            (entry->loop_start >= (entry->loop_end ? entry->loop_end : entry->frames)))
+        {
+            return false;
+        }
+    }
+    bank->count = header->count;
+    return true;
+}
+
+void clipBankSingle(clip_bank* bank, clip_bank_entry* entry, const void* data, enum circular_format format,
+                    uint frames, uint sample_rate, uint bits)
+{
+    memset(entry, 0, sizeof(clip_bank_entry));
+    strncpy(entry->name, "built in", CLIP_BANK_NAME_LENGTH - 1);
+    entry->frames = frames;
+    entry->loop_end = frames;
+    entry->sample_rate = sample_rate;
+    entry->format = format;
+    entry->bits = bits;
+    entry->channels = 1;
+    entry->bytes = clipBankBytes(entry);
+
+    bank->image = (const uint8_t*)data;
+    bank->entries = entry;
+    bank->count = 1;
+}
+
+void clipBankCreateBuffer(const clip_bank* bank, uint index, circular_buffer* cb)
+{
+    const clip_bank_entry* entry = clipBankEntry(bank, index);
+    const uint8_t* data = bank->image + entry->offset;
+    uint channels = entry->channels;
+    uint end = (entry->loop_end ? entry->loop_end : entry->frames) * channels;
+
+    switch (entry->format)
+    {
+        case circular_u8:
+        case circular_u12:
+            circularBufferCreatePacked(cb, entry->format, data, end);
+        break;
+
+        case circular_adpcm:
+            circularBufferCreateAdpcm(cb, data, end);
+        break;
+
+        default:
+            circularBufferCreate(cb, (const int16_t*)data, end, 16 - entry->bits);
+        break;
+    }
+    circularBufferSetLoop(cb, entry->loop_start * channels, channels);
+}
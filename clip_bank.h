@@ -0,0 +1,66 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "circular_buffer.h"
+
+/*
+ * A bank of flash clips, with a directory giving the data and format of each
+ * The bank is a self contained image, so it can be linked into the firmware or
+ * written to its own area of flash and replaced without rebuilding the firmware
+ *
+ * Image layout, all fields little endian:
+ *   clip_bank_header
+ *   clip_bank_entry[count]
+ *   clip data, each clip aligned to 4 bytes
+ */
+
+#define CLIP_BANK_MAGIC 0x4B4E4243          // "CBNK"
+#define CLIP_BANK_VERSION 1
+#define CLIP_BANK_NAME_LENGTH 16
+#define CLIP_BANK_ALIGN 4                   // Alignment of each clip from the start of the image
+
+// Start of an image
+typedef struct clip_bank_header
+{
+    uint32_t  magic;                        // CLIP_BANK_MAGIC
+    uint16_t  version;                      // CLIP_BANK_VERSION
+    uint16_t  count;                        // Number of directory entries
+    uint32_t  size;                         // Bytes in the image, including the header
+    uint32_t  reserved;
+} clip_bank_header;
+
+// Directory entry for one clip. Lengths and loop points are in frames
+typedef struct clip_bank_entry
+{
+    char      name[CLIP_BANK_NAME_LENGTH];  // Zero terminated
+    uint32_t  offset;                       // Start of the data from the start of the image
+    uint32_t  bytes;                        // Size of the data
+    uint32_t  frames;                       // Length of the clip
+    uint32_t  loop_start;                   // Frame played after the loop end
+    uint32_t  loop_end;                     // Frame after the last one played, up to frames
+    uint32_t  sample_rate;
+    uint8_t   format;                       // enum circular_format
+    uint8_t   bits;                         // Resolution of the stored samples
+    uint8_t   channels;                     // 1 or 2, interleaved. ADPCM clips are mono
+    uint8_t   reserved;
+} clip_bank_entry;
+
+// A bank found in memory
+typedef struct clip_bank
+{
+    const uint8_t* image;                   // Start of the image
+    const clip_bank_entry* entries;         // Directory
+    uint      count;                        // Number of clips
+} clip_bank;
+
+// Check the image, returns false if it is not a bank or any entry is outside it
+extern bool clipBankOpen(clip_bank* bank, const uint8_t* image);
+
+// A bank holding a single clip that is not part of an image, such as a flash header
+extern void clipBankSingle(clip_bank* bank, clip_bank_entry* entry, const void* data, enum circular_format format,
+                           uint frames, uint sample_rate, uint bits);
+
+// Directory entry for clip index
+static inline const clip_bank_entry* clipBankEntry(const clip_bank* bank, uint index){return &bank->entries[index];}
+
+// Set up the circular buffer to play clip index, looping between its loop points
+extern void clipBankCreateBuffer(const clip_bank* bank, uint index, circular_buffer* cb);
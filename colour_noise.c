@@ -1,21 +1,263 @@
-#include "colour_noise.h"
-
-void colourNoiseCreate(colour_noise* cn, float m_white_scale)
-{
-    cn->m_seed = 0;
-    cn->m_white = 0;
-    cn->m_count = 1;
-    cn->m_white_scale = m_white_scale;
-    cn->m_brown = 0.0f;
-    cn->m_pink = 0.0f;
-
-    for (int i = 0; i < NumPinkBins; i++)
-    {
-        cn->m_pinkStore[i] = 0.0f;
-    }
-}
-
-extern void colourNoiseSeed(colour_noise* cn, unsigned long seed)
-{
-    cn->m_seed = seed;
-}
+#include <stdio.h>
+#include <math.h>
+#include "colour_noise.h"
+#include "cycle_counter.h"
+/*
+   Colour noise generators. The block functions follow the float functions,
+   with the sums held in Q15
+ */
+
+#define COLOUR_NOISE_WCET_FRAMES 16             // Frames per block when finding the worst case
+#define COLOUR_NOISE_BANDS 4                    // Bands measured for the spectral slope, 2 octaves apart
+#define COLOUR_NOISE_BAND_BINS 8                // DFT bins averaged in each band, every other bin is used
+
+enum colour
+{
+    colour_white = 0,
+    colour_pink = colour_white + 1,
+    colour_brown = colour_pink + 1,
+    colours = colour_brown + 1
+};
+
+void colourNoiseCreate(colour_noise* cn, float m_white_scale)
+{
+    cn->m_seed = 0;
+    cn->m_white = 0;
+    cn->m_count = 1;
+    cn->m_white_scale = m_white_scale;
+    cn->m_brown = 0.0f;
+    cn->m_pink = 0.0f;
+
+    for (int i = 0; i < NumPinkBins; i++)
+    {
+        cn->m_pinkStore[i] = 0.0f;
+        cn->m_ipinkStore[i] = 0;
+    }
+
+    cn->m_white_q15 = (int32_t)(m_white_scale * 32768.0f);
+    cn->m_ipink = 0;
+    cn->m_ibrown = 0;
+}
+
+extern void colourNoiseSeed(colour_noise* cn, unsigned long seed)
+{
+    cn->m_seed = seed;
+}
+
+// Next white sample in Q15, from the same top bits of the seed as colourNoiseWhite
+static inline __attribute__((always_inline)) int32_t colourNoiseWhiteQ15(colour_noise* cn)
+{
+    cn->m_seed = (cn->m_seed * 196314165) + 907633515;
+    return (((int32_t)cn->m_seed >> 16) * cn->m_white_q15) >> 15;
+}
+
+// Integer version of colourNoisePink, with a fixed cost per sample
+static inline __attribute__((always_inline)) int16_t colourNoisePinkSample(colour_noise* cn)
+{
+    uint k = CTZ(cn->m_count | (1u << NumPinkBins1));
+    int32_t r = colourNoiseWhiteQ15(cn);
+
+    cn->m_ipink += r - cn->m_ipinkStore[k];
+    cn->m_ipinkStore[k] = r;
+    cn->m_count++;
+
+    // Sum of all octaves and the white sample can just exceed 16 bits
+    int32_t sample = (colourNoiseWhiteQ15(cn) + cn->m_ipink) >> 3;
+    return (sample > INT16_MAX) ? INT16_MAX : ((sample < INT16_MIN) ? INT16_MIN : sample);
+}
+
+// Integer version of colourNoiseBrown, with a fixed cost per sample
+static inline __attribute__((always_inline)) int16_t colourNoiseBrownSample(colour_noise* cn)
+{
+    cn->m_ibrown += colourNoiseWhiteQ15(cn) - (cn->m_ibrown >> COLOUR_NOISE_LEAK_SHIFT);
+
+    // Rare peaks of the integrator exceed 16 bits
+    int32_t sample = cn->m_ibrown >> 4;
+    return (sample > INT16_MAX) ? INT16_MAX : ((sample < INT16_MIN) ? INT16_MIN : sample);
+}
+
+// Generic block loop. Always inlined with constant arguments, so each colour
+// and channel count has its own loop
+static inline __attribute__((always_inline)) void colourNoiseLoop(colour_noise* cn, int16_t* dest, uint32_t frames,
+                                                                  const uint channels, const enum colour colour)
+{
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        for (uint c=0; c<channels; ++c)
+        {
+            if (colour == colour_white)
+            {
+                *dest++ = (int16_t)(colourNoiseWhiteQ15(&cn[c]) >> 1);
+            }
+            else if (colour == colour_pink)
+            {
+                *dest++ = colourNoisePinkSample(&cn[c]);
+            }
+            else
+            {
+                *dest++ = colourNoiseBrownSample(&cn[c]);
+            }
+        }
+    }
+}
+
+void colourNoiseWhiteBlock(colour_noise* cn, int16_t* dest, uint32_t frames, uint channels)
+{
+    (channels == 2) ? colourNoiseLoop(cn, dest, frames, 2, colour_white) : colourNoiseLoop(cn, dest, frames, 1, colour_white);
+}
+
+void colourNoisePinkBlock(colour_noise* cn, int16_t* dest, uint32_t frames, uint channels)
+{
+    (channels == 2) ? colourNoiseLoop(cn, dest, frames, 2, colour_pink) : colourNoiseLoop(cn, dest, frames, 1, colour_pink);
+}
+
+void colourNoiseBrownBlock(colour_noise* cn, int16_t* dest, uint32_t frames, uint channels)
+{
+    (channels == 2) ? colourNoiseLoop(cn, dest, frames, 2, colour_brown) : colourNoiseLoop(cn, dest, frames, 1, colour_brown);
+}
+
+// Stereo frames from the float functions, scaled to 16 bits one sample at a time
+static void colourNoiseFloatStereo(colour_noise* cn, int16_t* dest, uint32_t frames, enum colour colour)
+{
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        for (uint c=0; c<2; ++c)
+        {
+            if (colour == colour_white)
+            {
+                *dest++ = (int16_t)(colourNoiseWhite(&cn[c]) * 0x4000);
+            }
+            else if (colour == colour_pink)
+            {
+                *dest++ = (int16_t)(colourNoisePink(&cn[c]) * 0x8000);
+            }
+            else
+            {
+                *dest++ = (int16_t)(colourNoiseBrown(&cn[c]) * 0x8000);
+            }
+        }
+    }
+}
+
+// Time the float and block generators producing the same stereo frames
+void colourNoiseBenchmark(int16_t* dest, uint32_t frames)
+{
+    static const char* names[colours] = {"white", "pink", "brown"};
+    static const colourNoiseBlock blocks[colours] = {colourNoiseWhiteBlock, colourNoisePinkBlock, colourNoiseBrownBlock};
+    colour_noise cn[2];
+
+    cycleCounterInit();
+
+    for (int n=0; n<colours; ++n)
+    {
+        colourNoiseCreate(&cn[0], 0.5f);
+        colourNoiseCreate(&cn[1], 0.5f);
+        colourNoiseSeed(&cn[1], 0x7FFF);
+
+        uint32_t start = cycleCounterRead();
+        colourNoiseFloatStereo(cn, dest, frames, n);
+        uint32_t float_cycles = cycleCounterElapsed(start);
+
+        start = cycleCounterRead();
+        blocks[n](cn, dest, frames, 2);
+        uint32_t block_cycles = cycleCounterElapsed(start);
+
+        // Worst case of short blocks, which includes any retries
+        uint32_t worst = 0;
+
+        for (uint32_t i=0; i<frames; i+=COLOUR_NOISE_WCET_FRAMES)
+        {
+            start = cycleCounterRead();
+            blocks[n](cn, dest, COLOUR_NOISE_WCET_FRAMES, 2);
+            uint32_t cycles = cycleCounterElapsed(start);
+
+            worst = (cycles > worst) ? cycles : worst;
+        }
+
+        printf("noise %s: float %.2f block %.2f cycles/sample, %.1fx, worst %.2f cycles/sample\n", names[n],
+               (float)float_cycles / (float)(frames << 1), (float)block_cycles / (float)(frames << 1),
+               (float)float_cycles / (float)(block_cycles ? block_cycles : 1),
+               (float)worst / (float)(COLOUR_NOISE_WCET_FRAMES << 1));
+    }
+}
+
+// Power of one DFT bin of x, by the Goertzel algorithm
+static float colourNoiseBinPower(const int16_t* x, uint32_t n, uint32_t bin)
+{
+    float coeff = 2.0f * cosf((2.0f * 3.14159265f * (float)bin) / (float)n);
+    float s1 = 0.0f;
+    float s2 = 0.0f;
+
+    for (uint32_t i=0; i<n; ++i)
+    {
+        float s0 = (float)x[i] + (coeff * s1) - s2;
+
+        s2 = s1;
+        s1 = s0;
+    }
+    return (s1 * s1) + (s2 * s2) - (coeff * s1 * s2);
+}
+
+// Measure the power in bands at frames/256, /64, /16 and /4 of the sample rate, which are
+// above the corner of the brown integrator, and fit a line through them
+float colourNoiseSlope(colour_noise* cn, colourNoiseBlock block, int16_t* dest, uint32_t frames)
+{
+    // Let the integrators settle, then take a block without its mean
+    block(cn, dest, frames, 1);
+    block(cn, dest, frames, 1);
+
+    int32_t sum = 0;
+
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        sum += dest[i];
+    }
+    int32_t mean = sum / (int32_t)frames;
+
+    // Hann window, so the steep brown spectrum does not leak into the higher bands
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        float w = 0.5f - (0.5f * cosf((2.0f * 3.14159265f * (float)i) / (float)frames));
+
+        dest[i] = (int16_t)((float)(dest[i] - mean) * w);
+    }
+
+    // Least squares slope of band power against octave
+    float sx = 0.0f, sy = 0.0f, sxx = 0.0f, sxy = 0.0f;
+
+    for (int b=0; b<COLOUR_NOISE_BANDS; ++b)
+    {
+        uint32_t first = frames >> (8 - (2 * b));
+        float power = 0.0f;
+
+        for (uint32_t k=0; k<COLOUR_NOISE_BAND_BINS; ++k)
+        {
+            power += colourNoiseBinPower(dest, frames, first + (k << 1));
+        }
+
+        float x = (float)(2 * b);
+        float y = 10.0f * log10f(power / COLOUR_NOISE_BAND_BINS);
+
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+
+    return ((COLOUR_NOISE_BANDS * sxy) - (sx * sy)) / ((COLOUR_NOISE_BANDS * sxx) - (sx * sx));
+}
+
+void colourNoiseSpectrumBenchmark(int16_t* dest, uint32_t frames)
+{
+    static const char* names[colours] = {"white", "pink", "brown"};
+    static const colourNoiseBlock blocks[colours] = {colourNoiseWhiteBlock, colourNoisePinkBlock, colourNoiseBrownBlock};
+    static const float expected[colours] = {COLOUR_NOISE_WHITE_SLOPE, COLOUR_NOISE_PINK_SLOPE, COLOUR_NOISE_BROWN_SLOPE};
+    colour_noise cn;
+
+    for (int n=0; n<colours; ++n)
+    {
+        colourNoiseCreate(&cn, 0.5f);
+
+        printf("noise %s spectrum: %.1f dB/octave, expected %.1f\n", names[n], colourNoiseSlope(&cn, blocks[n], dest, frames), expected[n]);
+    }
+}
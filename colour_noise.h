@@ -1,111 +1,116 @@
-#pragma once
-#include <stdint.h>
-#include <stdbool.h>
-
-enum
-{
-    NumPinkBins = 16,
-    NumPinkBins1 = NumPinkBins - 1
-};
-
-typedef struct colour_noise
-{
-    uint32_t  m_seed;
-    uint32_t  m_count;
-    union
-    {
-        uint32_t  m_white;
-        float     m_fwhite;
-    };
-
-    float     m_white_scale;
-    float     m_pink;
-    float     m_brown;
-    float     m_pinkStore[NumPinkBins];
-} colour_noise;
-
-extern void colourNoiseCreate(colour_noise* cn, float m_white_scale);
-extern void colourNoiseSeed(colour_noise* cn, unsigned long seed);
-
-inline float colourNoiseWhite(colour_noise* cn)
-{
-    cn->m_seed = (cn->m_seed * 196314165) + 907633515;
-    cn->m_white = cn->m_seed >> 9;
-    cn->m_white |= 0x40000000;
-    return (cn->m_fwhite - 3.0f) * cn->m_white_scale;
-};
-
-int inline CTZ(int num)
-{
-    int i = 0;
-    while (((num >> i) & 1) == 0 && i < (signed)sizeof(int)) i++;
-    return i;
-
-    
-    //if (num == 0) {
-    //    return 32U;
-    //}
-    //return __builtin_clz(num);
-    //}
-}
-
-// returns pink noise random number in the range -0.5 to 0.5
-//
-inline float colourNoisePink(colour_noise* cn)
-{
-    float prevr;
-    float r;
-    unsigned long k;
-    k = CTZ(cn->m_count);
-    k = k & NumPinkBins1;
-
-    // get previous value of this octave 
-    prevr = cn->m_pinkStore[k];
-
-    while (true)
-    {
-        r = colourNoiseWhite(cn);
-
-        // store new value 
-        cn->m_pinkStore[k] = r;
-
-        r -= prevr;
-
-        // update total 
-        cn->m_pink += r;
-
-        if (cn->m_pink < -4.0f || cn->m_pink > 4.0f)
-        {
-            cn->m_pink -= r;
-        }
-        else
-        {
-            break;
-        }
-    }
-
-    // update counter 
-    cn->m_count++;
-
-    return (colourNoiseWhite(cn) + cn->m_pink) * 0.125f;
-}
-
-// returns brown noise random number in the range -0.5 to 0.5
-//
-inline float colourNoiseBrown(colour_noise* cn)
-{
-    while (true)
-    {
-        float  r = colourNoiseWhite(cn);
-        cn->m_brown += r;
-        if (cn->m_brown < -8.0f || cn->m_brown>8.0f)
-        {
-            cn->m_brown -= r;
-        }
-        else
-        {
-            break;
-        }
-    }
-    return cn->m_brown * 0.0625f;
-}
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+/*
+ * White, pink and brown noise generators
+ * The float functions return one sample at a time. The block functions
+ * generate 16 bit samples in integer arithmetic, interleaving one generator
+ * per channel, with the same levels as the float functions * 0x8000
+ */
+
+enum
+{
+    NumPinkBins = 16,
+    NumPinkBins1 = NumPinkBins - 1
+};
+
+typedef struct colour_noise
+{
+    uint32_t  m_seed;
+    uint32_t  m_count;
+    union
+    {
+        uint32_t  m_white;
+        float     m_fwhite;
+    };
+
+    float     m_white_scale;
+    float     m_pink;
+    float     m_brown;
+    float     m_pinkStore[NumPinkBins];
+    int32_t   m_white_q15;              // m_white_scale in Q15, for the block functions
+    int32_t   m_ipink;                  // Integer state of the block functions, Q15
+    int32_t   m_ibrown;
+    int32_t   m_ipinkStore[NumPinkBins];
+} colour_noise;
+
+// Fill dest with frames of interleaved samples, cn holds one generator for each channel
+typedef void (*colourNoiseBlock)(colour_noise* cn, int16_t* dest, uint32_t frames, uint channels);
+
+extern void colourNoiseCreate(colour_noise* cn, float m_white_scale);
+extern void colourNoiseSeed(colour_noise* cn, unsigned long seed);
+
+// Block generators. White is halved, so that it sounds as loud as pink and brown
+extern void colourNoiseWhiteBlock(colour_noise* cn, int16_t* dest, uint32_t frames, uint channels);
+extern void colourNoisePinkBlock(colour_noise* cn, int16_t* dest, uint32_t frames, uint channels);
+extern void colourNoiseBrownBlock(colour_noise* cn, int16_t* dest, uint32_t frames, uint channels);
+
+// Report cycles per sample of the float and block generators, and the worst case
+// of the block generators, over the UART
+// dest must hold at least 2 * frames samples
+extern void colourNoiseBenchmark(int16_t* dest, uint32_t frames);
+
+// Expected spectral slopes in dB per octave. 1/f^2 is -6dB per octave, but the
+// brown integrator is discrete and leaks, so it fits -5.6
+#define COLOUR_NOISE_WHITE_SLOPE 0.0f
+#define COLOUR_NOISE_PINK_SLOPE -3.0f
+#define COLOUR_NOISE_BROWN_SLOPE -5.6f
+
+// Spectral slope in dB per octave of frames of mono from a block generator
+// dest must hold frames samples, at least 2048
+extern float colourNoiseSlope(colour_noise* cn, colourNoiseBlock block, int16_t* dest, uint32_t frames);
+
+// Report the spectral slope of each block generator over the UART
+// dest must hold frames samples, at least 2048
+extern void colourNoiseSpectrumBenchmark(int16_t* dest, uint32_t frames);
+
+static inline float colourNoiseWhite(colour_noise* cn)
+{
+    cn->m_seed = (cn->m_seed * 196314165) + 907633515;
+    cn->m_white = cn->m_seed >> 9;
+    cn->m_white |= 0x40000000;
+    return (cn->m_fwhite - 3.0f) * cn->m_white_scale;
+};
+
+// Count of trailing zeros by de Bruijn multiply, as the M0+ has no instruction for it
+// num must not be 0
+static inline uint CTZ(uint32_t num)
+{
+    static const uint8_t table[32] = {0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+                                      31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9};
+
+    return table[((num & -num) * 0x077CB531u) >> 27];
+}
+
+// returns pink noise random number, mostly in the range -0.5 to 0.5
+// Voss-McCartney: each sample replaces one octave, chosen by the trailing zeros of the
+// count. The total is always the sum of the octaves, so it is bounded without retries
+static inline float colourNoisePink(colour_noise* cn)
+{
+    // Top octave bit is always set, so every count selects an octave
+    uint k = CTZ(cn->m_count | (1u << NumPinkBins1));
+    float r = colourNoiseWhite(cn);
+
+    // update total with the change in this octave
+    cn->m_pink += r - cn->m_pinkStore[k];
+    cn->m_pinkStore[k] = r;
+
+    // update counter 
+    cn->m_count++;
+
+    return (colourNoiseWhite(cn) + cn->m_pink) * 0.125f;
+}
+
+// Leak of the brown integrator, which decays by 1/(1 << COLOUR_NOISE_LEAK_SHIFT) per sample
+// Below fs / (2 * pi * (1 << COLOUR_NOISE_LEAK_SHIFT)) the spectrum is flat rather than 1/f^2
+#define COLOUR_NOISE_LEAK_SHIFT 8
+
+// returns brown noise random number, mostly in the range -0.5 to 0.5
+// A leaky integrator of white noise, so the total is bounded without retries
+static inline float colourNoiseBrown(colour_noise* cn)
+{
+    cn->m_brown += colourNoiseWhite(cn) - (cn->m_brown * (1.0f / (1 << COLOUR_NOISE_LEAK_SHIFT)));
+    return cn->m_brown * 0.0625f;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "hardware/structs/systick.h"
+
+/*
+ * Cycle counting using the SysTick timer of the calling core
+ * The counter is 24 bits and counts down at the system clock rate,
+ * so intervals up to ~90ms at 180MHz can be measured
+ */
+#define CYCLE_COUNTER_MASK 0x00FFFFFF
+
+// Start SysTick free running from the processor clock
+static inline void cycleCounterInit(void){systick_hw->rvr = CYCLE_COUNTER_MASK; systick_hw->cvr = 0; systick_hw->csr = 0x5;}
+
+// Read the current counter value
+static inline uint32_t cycleCounterRead(void){return systick_hw->cvr;}
+
+// Return number of cycles since start was read
+static inline uint32_t cycleCounterElapsed(uint32_t start){return (start - systick_hw->cvr) & CYCLE_COUNTER_MASK;}
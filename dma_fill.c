@@ -0,0 +1,464 @@
+#include <stdio.h>
+#include <math.h>
+#include "dma_fill.h"
+#include "cycle_counter.h"
+/*
+   Converts 16 bit signed samples to packed PWM levels for DMA
+   Left channel is in the low 16 bits, right channel in the high 16 bits
+ */
+
+// Quantise a Q8 PWM level with error feedback, so that the quantisation noise
+// rises with frequency. e holds the previous errors of this channel
+static inline __attribute__((always_inline)) uint32_t shapeLevel(int32_t level, int32_t* e, const int32_t wrap, const uint order)
+{
+    int32_t u = (order == 1) ? (level - e[0]) : (level - (e[0] << 1) + e[1]);
+    int32_t q = (u + 0x80) >> 8;
+
+    // Error is taken before clipping, so the loop stays stable at full scale
+    if (order == 2)
+    {
+        e[1] = e[0];
+    }
+    e[0] = (q << 8) - u;
+
+    return (q < 0) ? 0 : ((q > wrap) ? wrap : q);
+}
+
+#define NOISE_TAPS 63        // Length of the in band filter used to measure noise
+
+// Generic fill loop. Always inlined with constant arguments, so that the
+// compiler removes all of the tests from each of the specialised kernels
+// When ramp is set the scale moves by ramp_step every frame
+static inline __attribute__((always_inline)) void fillFrames(uint32_t* dest, const int16_t* src, uint32_t frames, dma_fill* df,
+                                                             const bool src_stereo, const bool out_stereo, const bool unity, const uint shift,
+                                                             const uint order, const bool ramp)
+{
+    int32_t scale = df->scale;
+    int32_t ramp_scale = df->ramp_scale;
+    const int32_t ramp_step = df->ramp_step;
+    const int32_t offset = df->offset;
+    const int32_t wrap = df->wrap;
+    int32_t left_error[DMA_FILL_MAX_ORDER] = {df->error[0][0], df->error[0][1]};
+    int32_t right_error[DMA_FILL_MAX_ORDER] = {df->error[1][0], df->error[1][1]};
+
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        int32_t left = *src++;
+        int32_t right = src_stereo ? *src++ : left;
+        uint32_t word;
+
+        if (src_stereo && !out_stereo)
+        {
+            // Want mono, so average two channels
+            left = (left + right) >> 1;
+        }
+
+        if (ramp)
+        {
+            ramp_scale += ramp_step;
+            scale = ramp_scale >> DMA_FILL_RAMP_BITS;
+        }
+
+        if (order)
+        {
+            // Keep 8 bits below the PWM level, and quantise each repeat separately,
+            // so that repeats act as oversampling for the shaped noise
+            int32_t left_level = ((left * scale) >> 8) + (offset << 8);
+            int32_t right_level = ((right * scale) >> 8) + (offset << 8);
+
+            for (uint j=0; j<(1u<<shift); ++j)
+            {
+                uint32_t l = shapeLevel(left_level, left_error, wrap, order);
+                uint32_t r = (src_stereo && out_stereo) ? shapeLevel(right_level, right_error, wrap, order) : l;
+
+                *dest++ = (r << 16) | l;
+            }
+            continue;
+        }
+
+        if (unity)
+        {
+            // Shift to full 16 bit unsigned, then scale to the wrap
+            left = ((uint32_t)(left + 0x8000) * (uint32_t)scale) >> 16;
+        }
+        else
+        {
+            left = ((left * scale) >> 16) + offset;
+
+            // A ramp ends with scale at the wrap, where an odd wrap takes -32768 to -1
+            if (ramp && (left < 0))
+            {
+                left = 0;
+            }
+        }
+
+        if (src_stereo && out_stereo)
+        {
+            if (unity)
+            {
+                right = ((uint32_t)(right + 0x8000) * (uint32_t)scale) >> 16;
+            }
+            else
+            {
+                right = ((right * scale) >> 16) + offset;
+
+                if (ramp && (right < 0))
+                {
+                    right = 0;
+                }
+            }
+            word = ((uint32_t)right << 16) | (uint32_t)left;
+        }
+        else
+        {
+            word = ((uint32_t)left << 16) | (uint32_t)left;
+        }
+
+        // Repeat to convert from sample rate to PWM rate
+        for (uint j=0; j<(1u<<shift); ++j)
+        {
+            *dest++ = word;
+        }
+    }
+
+    if (order)
+    {
+        for (uint k=0; k<DMA_FILL_MAX_ORDER; ++k)
+        {
+            df->error[0][k] = left_error[k];
+            df->error[1][k] = right_error[k];
+        }
+    }
+
+    if (ramp)
+    {
+        df->ramp_scale = ramp_scale;
+        df->scale = scale;
+    }
+}
+
+// Generate the specialised kernels
+#define FILL_KERNEL(name, ss, os, un, sh, ord) \
+    static void name(uint32_t* dest, const int16_t* src, uint32_t frames, dma_fill* df) \
+    {fillFrames(dest, src, frames, df, ss, os, un, sh, ord, false);}
+
+#define FILL_KERNELS(ss, os, un) \
+    FILL_KERNEL(fill_##ss##_##os##_##un##_0, ss, os, un, 0, 0) \
+    FILL_KERNEL(fill_##ss##_##os##_##un##_1, ss, os, un, 1, 0) \
+    FILL_KERNEL(fill_##ss##_##os##_##un##_2, ss, os, un, 2, 0) \
+    FILL_KERNEL(fill_##ss##_##os##_##un##_3, ss, os, un, 3, 0) \
+    FILL_KERNEL(fill_##ss##_##os##_##un##_4, ss, os, un, 4, 0)
+
+// Shaped kernels always use the signed scaling, so have no unity variant
+#define SHAPE_KERNELS(ss, os, ord) \
+    FILL_KERNEL(shape_##ss##_##os##_##ord##_0, ss, os, 0, 0, ord) \
+    FILL_KERNEL(shape_##ss##_##os##_##ord##_1, ss, os, 0, 1, ord) \
+    FILL_KERNEL(shape_##ss##_##os##_##ord##_2, ss, os, 0, 2, ord) \
+    FILL_KERNEL(shape_##ss##_##os##_##ord##_3, ss, os, 0, 3, ord) \
+    FILL_KERNEL(shape_##ss##_##os##_##ord##_4, ss, os, 0, 4, ord)
+
+FILL_KERNELS(0, 0, 0)
+FILL_KERNELS(0, 0, 1)
+FILL_KERNELS(0, 1, 0)
+FILL_KERNELS(0, 1, 1)
+FILL_KERNELS(1, 0, 0)
+FILL_KERNELS(1, 0, 1)
+FILL_KERNELS(1, 1, 0)
+FILL_KERNELS(1, 1, 1)
+
+SHAPE_KERNELS(0, 0, 1)
+SHAPE_KERNELS(0, 0, 2)
+SHAPE_KERNELS(0, 1, 1)
+SHAPE_KERNELS(0, 1, 2)
+SHAPE_KERNELS(1, 0, 1)
+SHAPE_KERNELS(1, 0, 2)
+SHAPE_KERNELS(1, 1, 1)
+SHAPE_KERNELS(1, 1, 2)
+
+#define FILL_ENTRY(ss, os, un) \
+    {fill_##ss##_##os##_##un##_0, fill_##ss##_##os##_##un##_1, fill_##ss##_##os##_##un##_2, \
+     fill_##ss##_##os##_##un##_3, fill_##ss##_##os##_##un##_4}
+
+// Indexed by source stereo, output stereo, unity gain, shift
+static const dmaFillKernel kernels[2][2][2][DMA_FILL_MAX_SHIFT + 1] =
+{
+    {{FILL_ENTRY(0, 0, 0), FILL_ENTRY(0, 0, 1)}, {FILL_ENTRY(0, 1, 0), FILL_ENTRY(0, 1, 1)}},
+    {{FILL_ENTRY(1, 0, 0), FILL_ENTRY(1, 0, 1)}, {FILL_ENTRY(1, 1, 0), FILL_ENTRY(1, 1, 1)}}
+};
+
+#define SHAPE_ENTRY(ss, os, ord) \
+    {shape_##ss##_##os##_##ord##_0, shape_##ss##_##os##_##ord##_1, shape_##ss##_##os##_##ord##_2, \
+     shape_##ss##_##os##_##ord##_3, shape_##ss##_##os##_##ord##_4}
+
+// Indexed by source stereo, output stereo, order - 1, shift
+static const dmaFillKernel shaped_kernels[2][2][DMA_FILL_MAX_ORDER][DMA_FILL_MAX_SHIFT + 1] =
+{
+    {{SHAPE_ENTRY(0, 0, 1), SHAPE_ENTRY(0, 0, 2)}, {SHAPE_ENTRY(0, 1, 1), SHAPE_ENTRY(0, 1, 2)}},
+    {{SHAPE_ENTRY(1, 0, 1), SHAPE_ENTRY(1, 0, 2)}, {SHAPE_ENTRY(1, 1, 1), SHAPE_ENTRY(1, 1, 2)}}
+};
+
+// Used while the gain is ramped. Runs the generic loop with the ramp for the rest
+// of the ramp, then hands over to the kernel for the new gain. Only runs for one
+// buffer per gain change, so is not specialised
+static void rampKernel(uint32_t* dest, const int16_t* src, uint32_t frames, dma_fill* df)
+{
+    uint32_t ramp = (frames < df->ramp_frames) ? frames : df->ramp_frames;
+
+    fillFrames(dest, src, ramp, df, df->channels == 2, df->out_stereo, false, df->shift, df->order, true);
+    df->ramp_frames -= ramp;
+
+    if (!df->ramp_frames)
+    {
+        df->scale = df->target_scale;
+        df->kernel = df->target_kernel;
+        dmaFillRun(df, dest + (ramp << df->shift), src + (ramp * df->channels), frames - ramp);
+    }
+}
+
+// Kernel for the current format and the supplied gain
+static dmaFillKernel selectKernel(const dma_fill* df, uint32_t gain)
+{
+    bool src_stereo = (df->channels == 2);
+    bool unity = (gain >= DMA_FILL_UNITY);
+
+    return df->order ? shaped_kernels[src_stereo][df->out_stereo][df->order - 1][df->shift]
+                     : kernels[src_stereo][df->out_stereo][unity][df->shift];
+}
+
+void dmaFillConfigure(dma_fill* df, bool src_stereo, bool out_stereo, uint shift, uint wrap, uint32_t gain, uint order)
+{
+    bool unity = (gain >= DMA_FILL_UNITY);
+
+    if (shift > DMA_FILL_MAX_SHIFT)
+    {
+        shift = DMA_FILL_MAX_SHIFT;
+    }
+
+    if (order > DMA_FILL_MAX_ORDER)
+    {
+        order = DMA_FILL_MAX_ORDER;
+    }
+
+    df->shift = shift;
+    df->channels = src_stereo ? 2 : 1;
+    df->out_stereo = out_stereo;
+    df->order = order;
+    df->kernel = selectKernel(df, gain);
+    df->target_kernel = df->kernel;
+    df->ramp_frames = 0;
+
+    // Map the full 16 bit range onto 0 to wrap
+    df->scale = unity ? wrap : ((wrap * gain) >> 15);
+    df->target_scale = df->scale;
+    df->offset = wrap >> 1;
+    df->wrap = wrap;
+
+    for (uint k=0; k<DMA_FILL_MAX_ORDER; ++k)
+    {
+        df->error[0][k] = 0;
+        df->error[1][k] = 0;
+    }
+}
+
+void dmaFillSetOrder(dma_fill* df, uint order)
+{
+    // Only the unity test of the gain selects a kernel
+    uint32_t gain = (df->target_scale >= df->wrap) ? DMA_FILL_UNITY : 0;
+
+    df->order = (order > DMA_FILL_MAX_ORDER) ? DMA_FILL_MAX_ORDER : order;
+    df->target_kernel = selectKernel(df, gain);
+
+    // A ramp switches to the target kernel when it completes
+    if (!df->ramp_frames)
+    {
+        df->kernel = df->target_kernel;
+    }
+}
+
+void dmaFillSetGain(dma_fill* df, uint32_t gain, uint32_t samples)
+{
+    uint32_t frames = samples >> df->shift;
+
+    if (gain > DMA_FILL_UNITY)
+    {
+        gain = DMA_FILL_UNITY;
+    }
+
+    // Start from where any current ramp has reached
+    df->target_scale = (df->wrap * gain) >> 15;
+    df->target_kernel = selectKernel(df, gain);
+    df->ramp_scale = df->scale << DMA_FILL_RAMP_BITS;
+    df->ramp_step = ((df->target_scale - df->scale) << DMA_FILL_RAMP_BITS) / (int32_t)(frames ? frames : 1);
+    df->ramp_frames = frames ? frames : 1;
+    df->kernel = rampKernel;
+}
+
+void dmaFillFadeIn(dma_fill* df, uint32_t gain, uint32_t samples)
+{
+    // Zero scale leaves every sample at the mid level
+    df->scale = 0;
+    dmaFillSetGain(df, gain, samples);
+}
+
+void dmaFillRamp(uint32_t* dest, uint32_t words, uint32_t from, uint32_t to)
+{
+    int32_t level = from << 16;
+    int32_t step = (words) ? ((int32_t)(to - from) << 16) / (int32_t)words : 0;
+
+    for (uint32_t i=0; i<words; ++i)
+    {
+        uint32_t l = level >> 16;
+
+        dest[i] = (l << 16) | l;
+        level += step;
+    }
+}
+
+void dmaFillCrossfade(uint32_t* dest, const uint32_t* from, uint32_t words, int32_t* gain, int32_t step)
+{
+    int32_t g = *gain;
+
+    for (uint32_t i=0; i<words; ++i)
+    {
+        // Both words hold levels for the same wrap, so can be mixed directly
+        int32_t old_left = from[i] & 0xFFFF;
+        int32_t old_right = from[i] >> 16;
+        int32_t left = old_left + ((((int32_t)(dest[i] & 0xFFFF) - old_left) * g) >> 15);
+        int32_t right = old_right + ((((int32_t)(dest[i] >> 16) - old_right) * g) >> 15);
+
+        dest[i] = ((uint32_t)right << 16) | (uint32_t)left;
+        g += step;
+    }
+    *gain = g;
+}
+
+// Time each kernel converting dest_len output samples
+// src must hold at least 2 * dest_len samples
+void dmaFillBenchmark(uint32_t* dest, uint32_t dest_len, int16_t* src, uint wrap)
+{
+    dma_fill df;
+
+    // Use a ramp, so that all sample values are exercised
+    for (uint32_t i=0; i<(dest_len << 1); ++i)
+    {
+        src[i] = (int16_t)(i * 31);
+    }
+
+    cycleCounterInit();
+
+    for (uint ss=0; ss<2; ++ss)
+    {
+        for (uint os=0; os<2; ++os)
+        {
+            for (uint un=0; un<2; ++un)
+            {
+                for (uint sh=0; sh<=DMA_FILL_MAX_SHIFT; ++sh)
+                {
+                    dmaFillConfigure(&df, ss, os, sh, wrap, un ? DMA_FILL_UNITY : (DMA_FILL_UNITY >> 1), 0);
+
+                    uint32_t frames = dest_len >> sh;
+                    uint32_t start = cycleCounterRead();
+                    dmaFillRun(&df, dest, src, frames);
+                    uint32_t cycles = cycleCounterElapsed(start);
+
+                    printf("fill src %s out %s gain %s shift %u: %.2f cycles/sample\n",
+                           ss ? "stereo" : "mono", os ? "stereo" : "mono", un ? "unity" : "scaled", sh,
+                           (float)cycles / (float)(frames << sh));
+                }
+            }
+
+            for (uint ord=1; ord<=DMA_FILL_MAX_ORDER; ++ord)
+            {
+                for (uint sh=0; sh<=DMA_FILL_MAX_SHIFT; ++sh)
+                {
+                    dmaFillConfigure(&df, ss, os, sh, wrap, DMA_FILL_UNITY, ord);
+
+                    uint32_t frames = dest_len >> sh;
+                    uint32_t start = cycleCounterRead();
+                    dmaFillRun(&df, dest, src, frames);
+                    uint32_t cycles = cycleCounterElapsed(start);
+
+                    printf("fill src %s out %s shaping %u shift %u: %.2f cycles/sample\n",
+                           ss ? "stereo" : "mono", os ? "stereo" : "mono", ord, sh,
+                           (float)cycles / (float)(frames << sh));
+                }
+            }
+        }
+    }
+}
+
+// Play a tone at -40dBFS through a mono kernel and measure the noise that falls
+// below 0.9 of the sample rate Nyquist frequency, using a windowed sinc low pass
+float dmaFillNoiseSnr(uint32_t* dest, uint32_t dest_len, int16_t* src, uint wrap, uint shift, uint order)
+{
+    const float pi = 3.14159265f;
+    const float amplitude = 327.0f;
+    uint32_t frames = dest_len >> shift;
+    dma_fill df;
+
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        src[i] = (int16_t)lroundf(amplitude * sinf(2.0f * pi * (float)i / 37.0f));
+    }
+
+    // Low pass at 0.9 of the Nyquist frequency, relative to the PWM rate
+    float cutoff = 0.9f / (float)(1 << shift);
+    float h[NOISE_TAPS];
+
+    for (int k=0; k<NOISE_TAPS; ++k)
+    {
+        float t = (float)(k - (NOISE_TAPS / 2));
+        float x = cutoff * t;
+        float sinc = (x == 0.0f) ? 1.0f : sinf(pi * x) / (pi * x);
+
+        h[k] = cutoff * sinc * 0.5f * (1.0f + cosf(2.0f * pi * t / (float)(NOISE_TAPS + 1)));
+    }
+
+    float sum = 0.0f;
+    float noise = 0.0f;
+    uint32_t count = 0;
+
+    dmaFillConfigure(&df, false, false, shift, wrap, DMA_FILL_UNITY, order);
+    dmaFillRun(&df, dest, src, frames);
+
+    // Filter the difference between the PWM levels and the exact levels
+    for (uint32_t n=NOISE_TAPS; n<(frames << shift); ++n)
+    {
+        float acc = 0.0f;
+
+        for (int k=0; k<NOISE_TAPS; ++k)
+        {
+            uint32_t m = n - k;
+            float exact = ((float)src[m >> shift] * (float)df.scale / 65536.0f) + (float)df.offset;
+
+            if (!order)
+            {
+                // Unity kernel offsets before scaling
+                exact = ((float)src[m >> shift] + 32768.0f) * (float)df.scale / 65536.0f;
+            }
+
+            acc += h[k] * ((float)(dest[m] & 0xFFFF) - exact);
+        }
+        sum += acc;
+        noise += acc * acc;
+        count++;
+    }
+
+    // Remove the DC offset of the quantiser, which is inaudible
+    noise -= (sum * sum) / (float)count;
+
+    float signal = 0.5f * (amplitude * (float)df.scale / 65536.0f) * (amplitude * (float)df.scale / 65536.0f);
+
+    return 10.0f * log10f(signal * (float)count / noise);
+}
+
+void dmaFillNoiseBenchmark(uint32_t* dest, uint32_t dest_len, int16_t* src, uint wrap)
+{
+    for (uint sh=0; sh<=DMA_FILL_MAX_SHIFT; ++sh)
+    {
+        for (uint ord=0; ord<=DMA_FILL_MAX_ORDER; ++ord)
+        {
+            printf("fill shaping %u shift %u: in band SNR %.1f dB\n", ord, sh, dmaFillNoiseSnr(dest, dest_len, src, wrap, sh, ord));
+        }
+    }
+}
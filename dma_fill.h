@@ -0,0 +1,94 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * Kernels that convert 16 bit signed samples into packed 32 bit PWM levels
+ * One kernel exists for each combination of source channels, output channels,
+ * gain, repeat shift and noise shaping order, so no decisions are made inside
+ * the sample loop
+ */
+
+// Unity gain in Q15
+#define DMA_FILL_UNITY      0x8000
+
+// Largest supported repeat shift (sample rate is 1/16 of PWM rate)
+#define DMA_FILL_MAX_SHIFT  4
+
+// Highest order of error feedback noise shaping, 0 truncates
+#define DMA_FILL_MAX_ORDER  2
+
+// Fractional bits of the scale while a gain change is ramped
+#define DMA_FILL_RAMP_BITS  12
+
+struct dma_fill;
+
+// Convert frames from src, writing (frames << shift) 32 bit words to dest
+typedef void (*dmaFillKernel)(uint32_t* dest, const int16_t* src, uint32_t frames, struct dma_fill* df);
+
+// Data for the fill stage
+typedef struct dma_fill
+{
+    dmaFillKernel kernel;           // Selected kernel
+    int32_t   scale;                // Q16 multiplier from sample to PWM level, includes gain
+    int32_t   offset;               // Added to scaled sample to give PWM level
+    uint      shift;                // Each frame is repeated (1 << shift) times
+    uint      channels;             // Number of 16 bit samples per source frame
+    bool      out_stereo;           // false if both PWM channels play the average
+    uint      order;                // Order of noise shaping
+    int32_t   wrap;                 // Highest PWM level
+    int32_t   error[2][DMA_FILL_MAX_ORDER];    // Recent quantisation errors for each channel, Q8
+    dmaFillKernel target_kernel;    // Kernel to use once a ramp completes
+    int32_t   target_scale;         // Scale at the end of the ramp
+    int32_t   ramp_scale;           // Current scale with DMA_FILL_RAMP_BITS of fraction
+    int32_t   ramp_step;            // Added to ramp_scale for every frame
+    uint32_t  ramp_frames;          // Frames left in the ramp, 0 when not ramping
+} dma_fill;
+
+// Select the kernel and calculate the scale factors
+// wrap is the PWM wrap value, gain is Q15 with DMA_FILL_UNITY the maximum
+// order selects noise shaping of the quantisation to PWM levels, from 0 to DMA_FILL_MAX_ORDER
+extern void dmaFillConfigure(dma_fill* df, bool src_stereo, bool out_stereo, uint shift, uint wrap, uint32_t gain, uint order);
+
+// Change the order of noise shaping, keeping the gain, any ramp and the recent errors
+// so that changing order while playing does not step the output
+extern void dmaFillSetOrder(dma_fill* df, uint order);
+
+// Change the gain linearly over the next samples output samples, so the step does not click
+extern void dmaFillSetGain(dma_fill* df, uint32_t gain, uint32_t samples);
+
+// Set the scale to silence, then ramp the gain up over the next samples output samples
+extern void dmaFillFadeIn(dma_fill* df, uint32_t gain, uint32_t samples);
+
+// Write words PWM levels moving linearly from level from towards level to, on both channels.
+// Used to move the output between 0 and the mid level, so that starting and stopping do not click
+extern void dmaFillRamp(uint32_t* dest, uint32_t words, uint32_t from, uint32_t to);
+
+// Crossfade from the PWM levels in from to those in dest, writing the result to dest.
+// gain is the Q15 weight of dest, and is moved by step for every word
+extern void dmaFillCrossfade(uint32_t* dest, const uint32_t* from, uint32_t words, int32_t* gain, int32_t step);
+
+// Report cycles per output sample for every kernel over the UART
+extern void dmaFillBenchmark(uint32_t* dest, uint32_t dest_len, int16_t* src, uint wrap);
+
+// In band signal to noise ratio in dB of a quiet tone, quantised to wrap with shaping order
+// src must hold at least dest_len samples
+extern float dmaFillNoiseSnr(uint32_t* dest, uint32_t dest_len, int16_t* src, uint wrap, uint shift, uint order);
+
+// Report dmaFillNoiseSnr for each shaping order and shift over the UART
+extern void dmaFillNoiseBenchmark(uint32_t* dest, uint32_t dest_len, int16_t* src, uint wrap);
+
+// Convert frames from src into dest using the selected kernel
+static inline void dmaFillRun(dma_fill* df, uint32_t* dest, const int16_t* src, uint32_t frames){df->kernel(dest, src, frames, df);}
+
+// Move the scale one frame along a ramp
+static inline void dmaFillRampStep(dma_fill* df)
+{
+    df->ramp_scale += df->ramp_step;
+    df->scale = df->ramp_scale >> DMA_FILL_RAMP_BITS;
+
+    if (!--df->ramp_frames)
+    {
+        df->scale = df->target_scale;
+        df->kernel = df->target_kernel;
+    }
+}
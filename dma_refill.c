@@ -0,0 +1,113 @@
+#include "dma_refill.h"
+
+void dmaRefillCreate(dma_refill* rf, dma_fill* fill, resampler* rs, dmaRefillDirect direct_fn, dmaRefillNext next_fn)
+{
+    rf->fill = fill;
+    rf->rs = rs;
+    rf->direct_fn = direct_fn;
+    rf->next_fn = next_fn;
+    rf->direct = false;
+    rf->resampling = false;
+    rf->ram_buffer = 0;
+    rf->ram_length = 0;
+    rf->ram_frame = 0;
+}
+
+bool dmaRefillNextBuffer(dma_refill* rf)
+{
+    // reset read position of RAM buffer to start
+    rf->ram_frame = 0;
+
+    if (!rf->next_fn(&rf->ram_buffer, &rf->ram_length))
+    {
+        rf->ram_buffer = 0;
+        rf->ram_length = 0;
+        return false;
+    }
+    return true;
+}
+
+void dmaRefillWords(dma_refill* rf, uint32_t* dest, uint32_t remaining)
+{
+    dma_fill* fill = rf->fill;
+    bool retry = true;
+
+    if (rf->direct)
+    {
+        // Source generates the PWM levels itself
+        rf->direct_fn(dest, remaining >> fill->shift);
+        remaining = 0;
+    }
+
+    while (remaining)
+    {
+        // Determine how many frames can be converted from the current RAM buffer
+        uint32_t ram_frames = rf->ram_length / fill->channels;
+        uint32_t frames = ram_frames - rf->ram_frame;
+        const int16_t* src = rf->ram_buffer + (rf->ram_frame * fill->channels);
+
+        if (!ram_frames)
+        {
+            // Try once to obtain a populated buffer
+            if (retry && dmaRefillNextBuffer(rf))
+            {
+                retry = false;
+                continue;
+            }
+
+            // Nothing available, so output silence for the rest of this buffer
+            while (remaining--)
+            {
+                *dest++ = (fill->wrap >> 1) * 0x00010001;
+            }
+            break;
+        }
+
+        if (rf->resampling)
+        {
+            // Convert a chunk to the PWM rate, then to PWM levels
+            int16_t chunk[DMA_REFILL_CHUNK * 2];
+            uint32_t consumed;
+            uint32_t produced = resamplerRun(rf->rs, src, frames, &consumed,
+                                             chunk, (remaining < DMA_REFILL_CHUNK) ? remaining : DMA_REFILL_CHUNK);
+
+            dmaFillRun(fill, dest, chunk, produced);
+            dest += produced;
+            remaining -= produced;
+            rf->ram_frame += consumed;
+        }
+        else
+        {
+            if ((frames << fill->shift) > remaining)
+            {
+                frames = remaining >> fill->shift;
+            }
+
+            dmaFillRun(fill, dest, src, frames);
+            dest += frames << fill->shift;
+            remaining -= frames << fill->shift;
+            rf->ram_frame += frames;
+        }
+
+        if (rf->ram_frame == ram_frames)
+        {
+            // Need a new RAM buffer
+            dmaRefillNextBuffer(rf);
+        }
+    }
+}
+
+void dmaRefillGenerated(dma_fill* fill, uint32_t* dest, uint32_t frames, dmaRefillGenerate generate)
+{
+    int16_t chunk[DMA_REFILL_CHUNK * 2];
+
+    while (frames)
+    {
+        uint32_t n = (frames < DMA_REFILL_CHUNK) ? frames : DMA_REFILL_CHUNK;
+
+        generate(chunk, n);
+        dmaFillRun(fill, dest, chunk, n);
+        dest += n << fill->shift;
+        frames -= n;
+    }
+}
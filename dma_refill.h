@@ -0,0 +1,50 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "dma_fill.h"
+#include "resampler.h"
+
+/*
+ * Refills DMA buffers with PWM levels from the current source
+ * RAM buffers of 16 bit samples are converted by the fill kernel, either repeated
+ * or resampled to the PWM rate. Direct sources write the PWM levels themselves.
+ * Shared by the firmware and the host bench, which supply the source callbacks
+ */
+
+// Frames generated or resampled at a time
+#define DMA_REFILL_CHUNK 64
+
+// Write frames of PWM levels to dest, each repeated to match the PWM rate
+typedef void (*dmaRefillDirect)(uint32_t* dest, uint32_t frames);
+
+// Replace the RAM buffer in *buff, setting *num_samples. Returns false if no buffer was ready
+typedef bool (*dmaRefillNext)(const int16_t** buff, uint32_t* num_samples);
+
+// Generate frames of interleaved stereo samples
+typedef void (*dmaRefillGenerate)(int16_t* dest, uint32_t frames);
+
+// Data for the refill stage
+typedef struct dma_refill
+{
+    dma_fill* fill;                 // Kernel and scaling used to populate DMA buffers
+    resampler* rs;                  // Converts the RAM buffers to the PWM rate
+    dmaRefillDirect direct_fn;      // Used while direct is set
+    dmaRefillNext next_fn;          // Obtains the next RAM buffer
+    bool      direct;               // True if the source bypasses the RAM buffers
+    bool      resampling;           // True if the RAM buffers are converted by rs
+    const int16_t* ram_buffer;      // RAM buffer being read, 0 if none
+    uint32_t  ram_length;           // Number of samples in ram_buffer
+    uint32_t  ram_frame;            // Read position in ram_buffer, in frames
+} dma_refill;
+
+// Set up the stage for a fill and resampler, with the source callbacks
+extern void dmaRefillCreate(dma_refill* rf, dma_fill* fill, resampler* rs, dmaRefillDirect direct_fn, dmaRefillNext next_fn);
+
+// Move to the next RAM buffer, returns false if none was ready
+extern bool dmaRefillNextBuffer(dma_refill* rf);
+
+// Populate remaining words of PWM levels from the current source
+// remaining must be a multiple of DMA_RING_LENGTH_ALIGN
+extern void dmaRefillWords(dma_refill* rf, uint32_t* dest, uint32_t remaining);
+
+// Generate frames of stereo a chunk at a time, and convert each chunk with the fill kernel
+extern void dmaRefillGenerated(dma_fill* fill, uint32_t* dest, uint32_t frames, dmaRefillGenerate generate);
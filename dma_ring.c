@@ -0,0 +1,179 @@
+#include "dma_ring.h"
+#include "hardware/pwm.h"
+/*
+   Manages a ring of DMA buffers that feed a PWM slice
+ */
+
+// Claim the channels
+void dmaRingCreate(dma_ring* dr, uint32_t* memory, uint32_t memory_len, uint slice)
+{
+    dr->memory = memory;
+    dr->memory_len = memory_len;
+    dr->slice = slice;
+    dr->count = 0;
+    dr->length = 0;
+    dr->completed = 0;
+    dr->late_irqs = 0;
+
+    dr->data_channel = dma_claim_unused_channel(true);
+    dr->ctrl_channel = dma_claim_unused_channel(true);
+
+    // Only the data channel interrupts, once per buffer
+    dma_channel_set_irq1_enabled(dr->data_channel, true);
+}
+
+// Configure the DMA channels - including chaining
+bool dmaRingConfigure(dma_ring* dr, uint count, uint length)
+{
+    // count must be a power of 2
+    if ((count < 2) || (count > DMA_RING_MAX_BUFFERS) || (count & (count - 1)))
+    {
+        return false;
+    }
+
+    length -= length % DMA_RING_LENGTH_ALIGN;
+
+    if (!length || ((count * length) > dr->memory_len))
+    {
+        return false;
+    }
+
+    dr->count = count;
+    dr->length = length;
+    dr->completed = 0;
+
+    for (uint i=0; i<count; ++i)
+    {
+        dr->buffers[i] = dr->memory + (i * length);
+    }
+
+    // Data channel copies one buffer to the PWM compare register, paced by the PWM wrap
+    dma_channel_config config = dma_channel_get_default_config(dr->data_channel); 
+    channel_config_set_read_increment(&config, true); 
+    channel_config_set_write_increment(&config, false); 
+    channel_config_set_dreq(&config, DREQ_PWM_WRAP0 + dr->slice); 
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32); 
+    channel_config_set_chain_to(&config, dr->ctrl_channel);
+
+    dma_channel_configure(dr->data_channel, 
+                          &config, 
+                          &pwm_hw->slice[dr->slice].cc, 
+                          dr->buffers[0],
+                          length,
+                          false);
+
+    // Control channel writes the next buffer address, which retriggers the data channel.
+    // The read address wraps around the table
+    config = dma_channel_get_default_config(dr->ctrl_channel); 
+    channel_config_set_read_increment(&config, true); 
+    channel_config_set_write_increment(&config, false); 
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32); 
+    channel_config_set_ring(&config, false, __builtin_ctz(count * sizeof(uint32_t*)));
+
+    dma_channel_configure(dr->ctrl_channel, 
+                          &config, 
+                          &dma_hw->ch[dr->data_channel].al3_read_addr_trig, 
+                          dr->buffers,
+                          1,
+                          false);
+    return true;
+}
+
+// Start the control channel, which starts the data channel on buffer 0
+void dmaRingStart(dma_ring* dr)
+{
+    dr->completed = 0;
+    dma_channel_set_read_addr(dr->ctrl_channel, dr->buffers, true);
+}
+
+void dmaRingStop(dma_ring* dr)
+{
+    // Stop the control channel first, so the data channel cannot be retriggered
+    dma_channel_abort(dr->ctrl_channel);
+    dma_channel_abort(dr->data_channel);
+    dma_channel_abort(dr->ctrl_channel);
+
+    // Discard any completion that was pending
+    dma_channel_acknowledge_irq1(dr->data_channel);
+}
+
+// Clear the interrupt, and count it if it was late
+bool dmaRingAcknowledge(dma_ring* dr)
+{
+    if (!dma_channel_get_irq1_status(dr->data_channel))
+    {
+        return false;
+    }
+
+    dma_channel_acknowledge_irq1(dr->data_channel);
+
+    // More than one buffer finished since the last interrupt
+    if (((dmaRingPlaying(dr) - dr->completed) & (dr->count - 1)) > 1)
+    {
+        dr->late_irqs++;
+    }
+    return true;
+}
+
+// Words of buffer playing that the DMA has played
+static uint32_t dmaRingPosition(dma_ring* dr, uint* playing)
+{
+    uint32_t played;
+
+    // Read the position again if the DMA moved to the next buffer while it was read
+    do
+    {
+        *playing = dmaRingPlaying(dr);
+        played = (dma_hw->ch[dr->data_channel].read_addr - (uintptr_t)dr->buffers[*playing]) / sizeof(uint32_t);
+    } while (*playing != dmaRingPlaying(dr));
+
+    return played;
+}
+
+uint32_t dmaRingQueued(dma_ring* dr)
+{
+    uint playing;
+    uint32_t played = dmaRingPosition(dr, &playing);
+
+    // Buffers from completed up to the one being played have not been reported yet
+    uint filled = (dr->completed - playing - 1) & (dr->count - 1);
+
+    return ((filled + 1) * dr->length) - played;
+}
+
+uint32_t dmaRingReclaim(dma_ring* dr, uint guard, uint* index, uint* offset)
+{
+    uint playing;
+    uint32_t played = dmaRingPosition(dr, &playing);
+
+    // Buffers that were waiting for a refill will be rewritten, so only
+    // the buffer being played is reported as free when it completes
+    dr->completed = playing;
+
+    uint32_t start = (played + guard + DMA_RING_LENGTH_ALIGN - 1) & ~(DMA_RING_LENGTH_ALIGN - 1);
+
+    if (start >= dr->length)
+    {
+        // Too close to the end of the buffer, so leave all of it
+        *index = dmaRingNext(dr, playing);
+        *offset = 0;
+        return (dr->count - 1) * dr->length;
+    }
+
+    *index = playing;
+    *offset = start;
+    return (dr->count * dr->length) - start;
+}
+
+// Every buffer from completed up to the one being played is free
+bool dmaRingGetFree(dma_ring* dr, uint* index)
+{
+    if (dr->completed == dmaRingPlaying(dr))
+    {
+        return false;
+    }
+
+    *index = dr->completed;
+    dr->completed = dmaRingNext(dr, dr->completed);
+    return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+
+/*
+ * Ring of N DMA buffers streamed to a PWM slice
+ * A data channel copies one buffer to the PWM, then chains to a control
+ * channel which loads the next buffer address from a table and retriggers
+ * the data channel. The stream never needs the CPU to keep running, the CPU
+ * only has to refill buffers as they complete
+ *
+ * Completed buffers are found from the control channel read address rather
+ * than by counting interrupts, so a late interrupt, or several buffers
+ * completing while interrupts are disabled, can never lose a refill
+ */
+
+// Maximum number of buffers in the ring, must be a power of 2
+#define DMA_RING_MAX_BUFFERS 8
+
+// Buffer lengths are a multiple of this, so repeated frames never straddle buffers
+#define DMA_RING_LENGTH_ALIGN 16
+
+// Data for the ring
+typedef struct dma_ring
+{
+    // Table of buffer addresses, read by the control channel. Aligned for the DMA ring wrap
+    uint32_t* buffers[DMA_RING_MAX_BUFFERS] __attribute__((aligned(DMA_RING_MAX_BUFFERS * sizeof(uint32_t*))));
+    uint32_t* memory;               // Memory split into buffers
+    uint32_t  memory_len;           // Number of 32 bit words in memory
+    uint      count;                // Number of buffers in use
+    uint      length;               // Number of 32 bit words in each buffer
+    uint      slice;                // PWM slice fed by the ring
+    int       data_channel;         // Copies buffers to the PWM
+    int       ctrl_channel;         // Reloads the data channel read address
+    uint      completed;            // Index of the next buffer to report as free
+    uint32_t  late_irqs;            // Interrupts that found more than one buffer free
+} dma_ring;
+
+// Claim the DMA channels, and enable the completion interrupt on DMA_IRQ_1
+extern void dmaRingCreate(dma_ring* dr, uint32_t* memory, uint32_t memory_len, uint slice);
+
+// Split the memory into count buffers of length words. Ring must be stopped
+// Returns false if the memory is too small
+extern bool dmaRingConfigure(dma_ring* dr, uint count, uint length);
+
+// Start streaming from the first buffer
+extern void dmaRingStart(dma_ring* dr);
+
+// Stop streaming
+extern void dmaRingStop(dma_ring* dr);
+
+// Called from the DMA_IRQ_1 handler. Returns true if the ring raised the interrupt
+extern bool dmaRingAcknowledge(dma_ring* dr);
+
+// Obtain the index of the next buffer that has been played and can be refilled
+// Returns false when no more buffers are free
+extern bool dmaRingGetFree(dma_ring* dr, uint* index);
+
+// Number of words the DMA plays before it reaches a buffer that has not been reported free.
+// Buffers already reported by dmaRingGetFree count as queued, whether or not they were refilled
+extern uint32_t dmaRingQueued(dma_ring* dr);
+
+// Take back everything queued behind the DMA read position, so that it can be rewritten
+// without stopping the ring. Rewriting starts at least guard words ahead of the DMA, at offset
+// in buffer index, and continues through the following buffers in play order.
+// Returns the number of words that can be rewritten. Call with the ring interrupt disabled
+extern uint32_t dmaRingReclaim(dma_ring* dr, uint guard, uint* index, uint* offset);
+
+/*
+ * Inline helper functions
+ */
+// Return the address of buffer index
+static inline uint32_t* dmaRingGetBuffer(dma_ring* dr, uint index){return dr->buffers[index];}
+
+// Return the index of the buffer after index
+static inline uint dmaRingNext(dma_ring* dr, uint index){return (index + 1) & (dr->count - 1);}
+
+// Return the index of the buffer being played. The control channel has
+// already read the entry for the buffer after it
+static inline uint dmaRingPlaying(dma_ring* dr){return (((dma_hw->ch[dr->ctrl_channel].read_addr - (uintptr_t)dr->buffers) / sizeof(uint32_t*)) - 1) & (dr->count - 1);}
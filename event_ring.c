@@ -0,0 +1,108 @@
+#include "event_ring.h"
+/*
+   Manages a lock free ring of events
+ */
+
+// Return the coalescing key for an event, or -1 if it is not coalesced
+static inline int eventRingKey(event_ring* er, uint type, uint index)
+{
+    if ((type < EVENT_RING_MAX_TYPES) && (index < EVENT_RING_MAX_INDEX) && (er->coalesce_mask & (0x01 << type)))
+    {
+        return (type * EVENT_RING_MAX_INDEX) + index;
+    }
+    return -1;
+}
+
+void eventRingCreate(event_ring* er, uint32_t coalesce_mask)
+{
+    er->head = 0;
+    er->tail = 0;
+    er->coalesce_mask = coalesce_mask;
+
+    for (int i=0; i<(EVENT_RING_MAX_TYPES * EVENT_RING_MAX_INDEX); ++i)
+    {
+        er->posted[i] = 0;
+        er->taken[i] = 0;
+    }
+    eventRingResetStats(er);
+}
+
+bool eventRingAdd(event_ring* er, uint type, uint index)
+{
+    int key = eventRingKey(er, type, index);
+
+    // Identical event already waiting
+    if ((key >= 0) && (er->posted[key] != er->taken[key]))
+    {
+        er->coalesced++;
+        return true;
+    }
+
+    uint32_t head = er->head;
+    uint32_t used = head - er->tail;
+
+    if (used >= EVENT_RING_LENGTH)
+    {
+        er->drops++;
+        return false;
+    }
+
+    if (used + 1 > er->high_water)
+    {
+        er->high_water = used + 1;
+    }
+
+    event_entry* e = &er->entries[head & (EVENT_RING_LENGTH - 1)];
+    e->type = type;
+    e->index = index;
+    e->timestamp = time_us_32();
+
+    if (key >= 0)
+    {
+        er->posted[key]++;
+    }
+
+    // Ensure the entry is written before it is published
+    __dmb();
+    er->head = head + 1;
+    return true;
+}
+
+bool eventRingRemove(event_ring* er, event_entry* event)
+{
+    uint32_t tail = er->tail;
+
+    if (er->head == tail)
+    {
+        return false;
+    }
+
+    // Ensure the entry is read after the head
+    __dmb();
+    *event = er->entries[tail & (EVENT_RING_LENGTH - 1)];
+
+    int key = eventRingKey(er, event->type, event->index);
+
+    if (key >= 0)
+    {
+        er->taken[key]++;
+    }
+
+    __dmb();
+    er->tail = tail + 1;
+    return true;
+}
+
+void eventRingFlush(event_ring* er)
+{
+    event_entry skip;
+
+    while (eventRingRemove(er, &skip));
+}
+
+void eventRingResetStats(event_ring* er)
+{
+    er->drops = 0;
+    er->coalesced = 0;
+    er->high_water = 0;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+/*
+ * Single producer, single consumer ring of events with payloads
+ * The producer only writes head and posted, the consumer only writes tail
+ * and taken, so no locks are needed. Producers in interrupt handlers of the
+ * same priority cannot preempt each other, so count as a single producer
+ *
+ * Events of types in the coalesce mask are not added again while an
+ * identical event (same type and index) is still waiting. Events that do
+ * not fit are dropped and counted
+ */
+
+// Number of entries, must be a power of 2
+#define EVENT_RING_LENGTH 16
+
+// Coalescing supports types and indexes below these values
+#define EVENT_RING_MAX_TYPES 8
+#define EVENT_RING_MAX_INDEX 8
+
+// An event and its payload
+typedef struct event_entry
+{
+    uint16_t  type;                 // Application defined event
+    uint16_t  index;                // Payload, e.g. buffer index
+    uint32_t  timestamp;            // Time in us that the event was added
+} event_entry;
+
+// Data for the ring
+typedef struct event_ring
+{
+    event_entry entries[EVENT_RING_LENGTH];
+    volatile uint32_t head;                         // Count of events added, written by producer
+    volatile uint32_t tail;                         // Count of events removed, written by consumer
+    uint32_t  coalesce_mask;                        // Bit set for each type that is coalesced
+    volatile uint8_t posted[EVENT_RING_MAX_TYPES * EVENT_RING_MAX_INDEX];   // Written by producer
+    volatile uint8_t taken[EVENT_RING_MAX_TYPES * EVENT_RING_MAX_INDEX];    // Written by consumer
+    uint32_t  drops;                                // Events lost as ring was full
+    uint32_t  coalesced;                            // Events merged with one already waiting
+    uint32_t  high_water;                           // Most events waiting at once
+} event_ring;
+
+// Create an empty ring. Types with a bit set in coalesce_mask are coalesced
+extern void eventRingCreate(event_ring* er, uint32_t coalesce_mask);
+
+// Add an event, returns false if it was dropped
+extern bool eventRingAdd(event_ring* er, uint type, uint index);
+
+// Remove the oldest event, returns false if the ring is empty
+extern bool eventRingRemove(event_ring* er, event_entry* event);
+
+// Discard all waiting events. Only call when the producer is inactive
+extern void eventRingFlush(event_ring* er);
+
+// Clear the drop, coalesce and high water counters
+extern void eventRingResetStats(event_ring* er);
+
+/*
+ * Inline helper functions
+ */
+// Return true if no events are waiting
+static inline bool eventRingEmpty(event_ring* er){return er->head == er->tail;}
+
+// Return the number of events waiting
+static inline uint32_t eventRingCount(event_ring* er){return er->head - er->tail;}
@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <math.h>
+#include "pico/stdlib.h"
+#include "colour_noise.h"
+/*
+   Checks the spectral slope of each block generator over several seeds
+   A single block only has a few bins in each band, so the slope is averaged over TEST_BLOCKS
+   Exits non-zero if any slope is further than TEST_TOLERANCE from the expected slope
+ */
+
+#define TEST_FRAMES 8192
+#define TEST_BLOCKS 16
+#define TEST_TOLERANCE 0.5f                 // dB per octave
+#define TEST_SEEDS 4
+
+static int16_t dest[TEST_FRAMES];
+
+int main(void)
+{
+    static const char* names[] = {"white", "pink", "brown"};
+    static const colourNoiseBlock blocks[] = {colourNoiseWhiteBlock, colourNoisePinkBlock, colourNoiseBrownBlock};
+    static const float expected[] = {COLOUR_NOISE_WHITE_SLOPE, COLOUR_NOISE_PINK_SLOPE, COLOUR_NOISE_BROWN_SLOPE};
+    colour_noise cn;
+    uint failures = 0;
+
+    for (uint n=0; n<count_of(blocks); ++n)
+    {
+        for (uint seed=0; seed<TEST_SEEDS; ++seed)
+        {
+            colourNoiseCreate(&cn, 0.5f);
+            colourNoiseSeed(&cn, seed * 0x7FFF);
+
+            float slope = 0.0f;
+
+            for (uint b=0; b<TEST_BLOCKS; ++b)
+            {
+                slope += colourNoiseSlope(&cn, blocks[n], dest, TEST_FRAMES) / TEST_BLOCKS;
+            }
+
+            printf("%s seed %u: %.2f dB/octave, expected %.1f\n", names[n], seed * 0x7FFF, slope, expected[n]);
+
+            if (fabsf(slope - expected[n]) > TEST_TOLERANCE)
+            {
+                printf("FAIL %s seed %u: slope is more than %.1f dB/octave from expected\n", names[n], seed * 0x7FFF, TEST_TOLERANCE);
+                failures++;
+            }
+        }
+    }
+
+    printf("colour noise spectrum: %u failures\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "dma_fill.h"
+#include "pwm_solver.h"
+/*
+   Checks that noise shaping lowers the in band noise of the fill stage when the
+   PWM rate is a multiple of the sample rate, as it is when shaping is enabled
+   Each order must beat truncation by at least the gain in min_gain_db for the shift,
+   and second order must not be worse than first
+   Also checks that a gain ramp keeps every level between 0 and the wrap. Exits non-zero on failure
+ */
+
+#define TEST_LENGTH 2200                    // DMA_BUFFER_LENGTH in the firmware
+
+// Lowest gain over truncation in dB for order 1 and 2 at each oversampled shift
+static const float min_gain_db[DMA_FILL_MAX_SHIFT + 1][DMA_FILL_MAX_ORDER] = {
+    {0.0f, 0.0f},                           // Not oversampled, so shaping is not used
+    {3.0f, 3.0f},
+    {9.0f, 15.0f},
+    {18.0f, 27.0f},
+    {27.0f, 38.0f},
+};
+
+#define TEST_RAMP_WRAP 4091                 // Odd, so the signed scaling at full scale is below 0
+#define TEST_RAMP_FRAMES 512                // Ramp from half gain lands exactly on unity
+
+static uint32_t dest[TEST_LENGTH];
+static int16_t src[TEST_LENGTH];
+
+// Ramp from half to unity gain with the most negative input, so the last frame of the
+// ramp has scale equal to the wrap. Returns the number of levels outside 0 to the wrap
+static uint checkRamp(bool src_stereo, bool out_stereo)
+{
+    dma_fill df;
+    uint32_t frames = TEST_LENGTH >> 1;
+    uint failures = 0;
+
+    for (uint32_t i=0; i<(frames * 2); ++i)
+    {
+        src[i] = -32768;
+    }
+
+    dmaFillConfigure(&df, src_stereo, out_stereo, 0, TEST_RAMP_WRAP, DMA_FILL_UNITY >> 1, 0);
+    dmaFillSetGain(&df, DMA_FILL_UNITY, TEST_RAMP_FRAMES);
+    dmaFillRun(&df, dest, src, frames);
+
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        if (((dest[i] & 0xFFFF) > TEST_RAMP_WRAP) || ((dest[i] >> 16) > TEST_RAMP_WRAP))
+        {
+            printf("FAIL ramp src %s out %s: frame %u is 0x%08x\n", src_stereo ? "stereo" : "mono",
+                   out_stereo ? "stereo" : "mono", (uint)i, (uint)dest[i]);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int main(void)
+{
+    // Wrap at 44kHz with the default limits, and the largest wrap with the high carrier limits
+    const uint wraps[] = {4090, pwm_high_carrier_limits.max_wrap};
+    uint failures = 0;
+
+    for (uint w=0; w<count_of(wraps); ++w)
+    {
+        for (uint sh=1; sh<=DMA_FILL_MAX_SHIFT; ++sh)
+        {
+            float snr[DMA_FILL_MAX_ORDER + 1];
+
+            for (uint ord=0; ord<=DMA_FILL_MAX_ORDER; ++ord)
+            {
+                snr[ord] = dmaFillNoiseSnr(dest, TEST_LENGTH, src, wraps[w], sh, ord);
+            }
+
+            printf("wrap %u shift %u: SNR %.1f dB, shaping gains %.1f and %.1f dB\n",
+                   wraps[w], sh, snr[0], snr[1] - snr[0], snr[2] - snr[0]);
+
+            for (uint ord=1; ord<=DMA_FILL_MAX_ORDER; ++ord)
+            {
+                if ((snr[ord] - snr[0]) < min_gain_db[sh][ord - 1])
+                {
+                    printf("FAIL wrap %u shift %u: order %u gains %.1f dB, less than %.1f dB\n",
+                           wraps[w], sh, ord, snr[ord] - snr[0], min_gain_db[sh][ord - 1]);
+                    failures++;
+                }
+            }
+
+            if (snr[2] < (snr[1] - 1.0f))
+            {
+                printf("FAIL wrap %u shift %u: order 2 is worse than order 1\n", wraps[w], sh);
+                failures++;
+            }
+        }
+    }
+
+    for (uint ss=0; ss<2; ++ss)
+    {
+        for (uint os=0; os<2; ++os)
+        {
+            failures += checkRamp(ss, os);
+        }
+    }
+
+    printf("dma fill noise shaping and ramps: %u failures\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,243 @@
+#include <stdlib.h>
+#include <time.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pwm.h"
+#include "hardware/structs/systick.h"
+#include "host_sdk.h"
+/*
+   Host implementation of the shimmed pico-sdk calls
+   The DMA is simulated, and plays words when the bench driver advances the clock
+ */
+
+static dma_hw_t dma_regs;
+static pwm_hw_t pwm_regs;
+static systick_hw_t systick_regs;
+
+dma_hw_t* dma_hw = &dma_regs;
+pwm_hw_t* pwm_hw = &pwm_regs;
+
+static uint64_t sim_us = 0;                 // Simulated time
+static uint64_t sim_ps = 0;                 // Fraction of a us carried between advances, in ps
+
+// State of a channel that is not visible in its registers
+typedef struct host_dma_channel
+{
+    bool      claimed;
+    bool      busy;
+    dma_channel_config config;
+    uint32_t  count;                        // Transfers reloaded on each trigger
+} host_dma_channel;
+
+static host_dma_channel channels[NUM_DMA_CHANNELS];
+
+uint64_t time_us_64(void)
+{
+    return sim_us;
+}
+
+void hostAdvanceClock(uint64_t ps)
+{
+    sim_ps += ps;
+    sim_us += sim_ps / 1000000;
+    sim_ps %= 1000000;
+}
+
+uint64_t hostTimeNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000) + ts.tv_nsec;
+}
+
+// SysTick counts down at the system clock, so host time is scaled to RP2040 cycles
+systick_hw_t* hostSysTick(void)
+{
+    systick_regs.cvr = (uint32_t)(~((hostTimeNs() * (HOST_SYS_CLOCK_HZ / 1000000)) / 1000)) & systick_regs.rvr;
+    return &systick_regs;
+}
+
+// Same VCO search as the SDK, with the VCO between 750MHz and 1600MHz
+bool check_sys_clock_khz(uint32_t freq_khz, uint* vco_freq_out, uint* post_div1_out, uint* post_div2_out)
+{
+    const uint reference_khz = 12000;
+
+    for (uint fbdiv=320; fbdiv>=16; --fbdiv)
+    {
+        uint vco_khz = fbdiv * reference_khz;
+
+        if ((vco_khz < 750000) || (vco_khz > 1600000))
+        {
+            continue;
+        }
+
+        for (uint postdiv1=7; postdiv1>=1; --postdiv1)
+        {
+            for (uint postdiv2=postdiv1; postdiv2>=1; --postdiv2)
+            {
+                if ((vco_khz / (postdiv1 * postdiv2)) * (postdiv1 * postdiv2) != vco_khz)
+                {
+                    continue;
+                }
+
+                if ((vco_khz / (postdiv1 * postdiv2)) == freq_khz)
+                {
+                    *vco_freq_out = vco_khz * 1000;
+                    *post_div1_out = postdiv1;
+                    *post_div2_out = postdiv2;
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+int dma_claim_unused_channel(bool required)
+{
+    for (uint c=0; c<NUM_DMA_CHANNELS; ++c)
+    {
+        if (!channels[c].claimed)
+        {
+            channels[c].claimed = true;
+            return c;
+        }
+    }
+
+    if (required)
+    {
+        fprintf(stderr, "No free DMA channels\n");
+        exit(1);
+    }
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+    dma_channel_config config = {true, channel, 0};
+
+    return config;
+}
+
+// A channel writing to another channel's trigger register is unpaced, and copies a pointer
+static int hostDmaTriggerTarget(uint channel)
+{
+    for (uint c=0; c<NUM_DMA_CHANNELS; ++c)
+    {
+        if (dma_hw->ch[channel].write_addr == (uintptr_t)&dma_hw->ch[c].al3_read_addr_trig)
+        {
+            return c;
+        }
+    }
+    return -1;
+}
+
+static void hostDmaStart(uint channel);
+
+// Finish a channel, raise its interrupt and start the channel it chains to
+static void hostDmaComplete(uint channel)
+{
+    channels[channel].busy = false;
+
+    if (dma_hw->inte1 & (1u << channel))
+    {
+        dma_hw->ints1 |= (1u << channel);
+    }
+
+    if (channels[channel].config.chain_to != channel)
+    {
+        hostDmaStart(channels[channel].config.chain_to);
+    }
+}
+
+static void hostDmaStart(uint channel)
+{
+    dma_channel_hw_t* ch = &dma_hw->ch[channel];
+    int target = hostDmaTriggerTarget(channel);
+
+    ch->transfer_count = channels[channel].count;
+    channels[channel].busy = true;
+
+    if (target < 0)
+    {
+        // Paced by the PWM, so played by hostDmaAdvance
+        return;
+    }
+
+    // Unpaced, so every transfer happens now
+    while (ch->transfer_count)
+    {
+        uintptr_t value = *(const uintptr_t*)ch->read_addr;
+        uint ring = channels[channel].config.ring_bits;
+
+        if (channels[channel].config.read_increment)
+        {
+            uintptr_t next = ch->read_addr + sizeof(uintptr_t);
+
+            ch->read_addr = ring ? ((ch->read_addr & ~(((uintptr_t)1 << ring) - 1)) | (next & (((uintptr_t)1 << ring) - 1))) : next;
+        }
+        ch->transfer_count--;
+
+        // Writing the trigger alias loads the read address and starts the channel
+        dma_hw->ch[target].read_addr = value;
+        hostDmaStart(target);
+    }
+    hostDmaComplete(channel);
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr,
+                           const volatile void* read_addr, uint transfer_count, bool trigger)
+{
+    channels[channel].config = *config;
+    channels[channel].count = transfer_count;
+    dma_hw->ch[channel].write_addr = (uintptr_t)write_addr;
+    dma_hw->ch[channel].read_addr = (uintptr_t)read_addr;
+    dma_hw->ch[channel].transfer_count = transfer_count;
+
+    if (trigger)
+    {
+        hostDmaStart(channel);
+    }
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void* read_addr, bool trigger)
+{
+    dma_hw->ch[channel].read_addr = (uintptr_t)read_addr;
+
+    if (trigger)
+    {
+        hostDmaStart(channel);
+    }
+}
+
+void dma_channel_abort(uint channel)
+{
+    channels[channel].busy = false;
+}
+
+void hostDmaAdvance(uint32_t words)
+{
+    for (uint c=0; c<NUM_DMA_CHANNELS; ++c)
+    {
+        uint32_t left = words;
+
+        while (left && channels[c].busy && (hostDmaTriggerTarget(c) < 0))
+        {
+            dma_channel_hw_t* ch = &dma_hw->ch[c];
+            uint32_t n = (left < ch->transfer_count) ? left : ch->transfer_count;
+
+            // Only the last word written stays in the destination register
+            ch->read_addr += n * sizeof(uint32_t);
+            *(volatile uint32_t*)ch->write_addr = ((const uint32_t*)ch->read_addr)[-1];
+            ch->transfer_count -= n;
+            left -= n;
+
+            if (!ch->transfer_count)
+            {
+                hostDmaComplete(c);
+            }
+        }
+    }
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * Controls for the simulated RP2040, used by the bench driver
+ */
+
+// Move simulated time on by ps picoseconds
+extern void hostAdvanceClock(uint64_t ps);
+
+// Host monotonic clock in ns, used to time the pipeline
+extern uint64_t hostTimeNs(void);
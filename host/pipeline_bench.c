@@ -0,0 +1,479 @@
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "host_sdk.h"
+
+#include "double_buffer.h"
+#include "circular_buffer.h"
+#include "clip_bank.h"
+#include "colour_noise.h"
+#include "signal_generator.h"
+#include "dma_fill.h"
+#include "dma_ring.h"
+#include "dma_refill.h"
+#include "pwm_solver.h"
+#include "resampler.h"
+#include "event_ring.h"
+#include "perf_stats.h"
+#include "cycle_counter.h"
+#include "clip_assets.h"
+/*
+   Runs the refill pipeline on the host against the simulated DMA ring
+   Each source is played for BENCH_SECONDS of simulated time in every fill mode,
+   and the host time spent refilling is used to report samples per second.
+   Refills run through dma_refill, as in the firmware
+
+   Run with -k to also run the firmware's kernel, resampler and solver benchmarks
+ */
+
+#define BENCH_SECONDS 10
+#define BENCH_STEPS 4                       // DMA advances per buffer, so interrupts arrive part way through
+
+// Same memory and buffer sizes as the firmware, which has twice the memory when built for the high carrier
+#define DMA_BUFFER_LENGTH 2200
+#define DMA_MEMORY_LENGTH (2*DMA_BUFFER_LENGTH)
+#define HIGH_CARRIER_MEMORY_LENGTH (4*DMA_BUFFER_LENGTH)
+#define LOW_LATENCY_BUFFERS 4
+#define DEEP_BUFFERS 8
+#define RAM_BUFFER_LENGTH (2*DMA_BUFFER_LENGTH)
+#define RESAMPLE_CARRIER_RATE 44000
+
+// Decoded audio stands in for music files, as the decoder is not part of this tree
+#define PCM_FRAMES 4096
+
+enum bench_kind
+{
+    kind_white = 0,
+    kind_pink = kind_white + 1,
+    kind_brown = kind_pink + 1,
+    kind_flash = kind_brown + 1,            // Packed 8 bit, as the flash headers
+    kind_flash_16 = kind_flash + 1,         // 8 bit samples in 16 bit words
+    kind_flash_12 = kind_flash_16 + 1,      // Packed 12 bit
+    kind_adpcm = kind_flash_12 + 1,
+    kind_signal = kind_adpcm + 1,
+    kind_pcm = kind_signal + 1
+};
+
+// A source, and how it reaches the DMA buffers
+typedef struct bench_source
+{
+    const char* name;
+    enum bench_kind kind;
+    uint32_t  sample_rate;
+    bool      stereo;
+    bool      direct;                       // Writes PWM levels straight into the DMA buffers
+    enum resample_quality quality;          // Used when the source passes through the RAM buffers
+    enum signal_type signal;                // Used by kind_signal
+} bench_source;
+
+// A fill mode, selecting the dma_fill kernel
+typedef struct bench_mode
+{
+    const char* name;
+    const pwm_limits* limits;
+    uint32_t  memory_len;                   // DMA memory of the firmware built for limits
+    uint32_t  gain;
+    uint      order;
+    bool      ramp;                         // Change the gain on every refill, so the ramp kernel runs
+} bench_mode;
+
+static const bench_source sources[] = {
+    {"white",             kind_white, 11000, true,  true,  resample_nearest, signal_tone},
+    {"pink",              kind_pink,  11000, true,  true,  resample_nearest, signal_tone},
+    {"brown",             kind_brown, 11000, true,  true,  resample_nearest, signal_tone},
+    {"flash",             kind_flash, 11000, false, true,  resample_nearest, signal_tone},
+    {"flash linear",      kind_flash, 11000, false, false, resample_linear, signal_tone},
+    {"flash 16 bit",      kind_flash_16, 11000, false, true, resample_nearest, signal_tone},
+    {"flash 12 bit",      kind_flash_12, 11000, false, true, resample_nearest, signal_tone},
+    {"flash adpcm",       kind_adpcm, 11000, false, true,  resample_nearest, signal_tone},
+    {"tone",              kind_signal, 44100, true, true,  resample_nearest, signal_tone},
+    {"sweep",             kind_signal, 44100, true, true,  resample_nearest, signal_sweep},
+    {"two tone",          kind_signal, 44100, true, true,  resample_nearest, signal_two_tone},
+    {"pcm 22050 nearest", kind_pcm,   22050, true,  false, resample_nearest, signal_tone},
+    {"pcm 44100 fir",     kind_pcm,   44100, true,  false, resample_fir, signal_tone},
+    {"pcm 48000 fir",     kind_pcm,   48000, true,  false, resample_fir, signal_tone},
+};
+
+static const bench_mode modes[] = {
+    {"unity",        &pwm_default_limits,      DMA_MEMORY_LENGTH,          DMA_FILL_UNITY, 0, false},
+    {"gain",         &pwm_default_limits,      DMA_MEMORY_LENGTH,          0x4000,         0, false},
+    {"ramp",         &pwm_default_limits,      DMA_MEMORY_LENGTH,          DMA_FILL_UNITY, 0, true},
+    {"shaped 1",     &pwm_default_limits,      DMA_MEMORY_LENGTH,          DMA_FILL_UNITY, 1, false},
+    {"shaped 2",     &pwm_default_limits,      DMA_MEMORY_LENGTH,          DMA_FILL_UNITY, 2, false},
+    {"high carrier", &pwm_high_carrier_limits, HIGH_CARRIER_MEMORY_LENGTH, DMA_FILL_UNITY, 2, false},
+};
+
+enum Event
+{
+    empty = 0,
+    populate_dma = empty + 1,
+    populate_double = populate_dma + 1
+};
+
+static uint32_t dma_memory[HIGH_CARRIER_MEMORY_LENGTH];
+static dma_ring dma_buffers;
+static dma_fill fill;
+static dma_refill refill;
+static event_ring irq_events;
+static event_ring main_events;
+
+static int16_t ram_buffer[2][RAM_BUFFER_LENGTH];
+static double_buffer double_buffers;
+
+static resampler rs;
+static uint wrap;
+static uint repeat_shift;
+static uint32_t carrier_hz;
+
+static colour_noise cn[2];
+static signal_generator sg;
+static circular_buffer sb;
+static clip_bank assets;                    // Bank linked from assets, holding the 8 bit ring clip
+static const uint8_t* flash_u8;
+static int16_t flash_pcm[CLIP_ASSETS_RING_FRAMES];
+static uint16_t flash_words[CLIP_ASSETS_RING_FRAMES];
+static uint8_t flash_packed[((CLIP_ASSETS_RING_FRAMES * 3) + 1) / 2] __attribute__((aligned(4)));
+static uint8_t flash_adpcm[ADPCM_BYTES(CLIP_ASSETS_RING_FRAMES)];
+static int16_t pcm[PCM_FRAMES * 2];
+static uint32_t pcm_pos = 0;
+static const bench_source* source;
+
+static perf_stage dma_stage;
+static perf_stage ram_stage;
+
+// RAM buffer callback, as populateCallback in the firmware
+static uint32_t populateCallback(int16_t* buffer, uint32_t len)
+{
+    if ((source->kind >= kind_flash) && (source->kind <= kind_adpcm))
+    {
+        circularBufferRead(&sb, buffer, len);
+        return len;
+    }
+
+    for (uint32_t i=0; i<len; ++i)
+    {
+        buffer[i] = pcm[pcm_pos++];
+        pcm_pos = (pcm_pos == count_of(pcm)) ? 0 : pcm_pos;
+    }
+    return len;
+}
+
+// Store the flash clip in each format, as the converter would write it
+static bool flashConvert(void)
+{
+    if (!clipBankOpen(&assets, clip_assets))
+    {
+        return false;
+    }
+    flash_u8 = assets.image + clipBankEntry(&assets, CLIP_ASSETS_RING)->offset;
+
+    for (uint i=0; i<CLIP_ASSETS_RING_FRAMES; ++i)
+    {
+        uint v = flash_u8[i] << 4;
+
+        flash_pcm[i] = (int16_t)((flash_u8[i] << 8) - 0x8000);
+        flash_words[i] = flash_u8[i];
+
+        if (i & 1)
+        {
+            flash_packed[(i * 3) / 2] |= (v & 0xF) << 4;
+            flash_packed[((i * 3) / 2) + 1] = v >> 4;
+        }
+        else
+        {
+            flash_packed[(i * 3) / 2] = v & 0xFF;
+            flash_packed[((i * 3) / 2) + 1] = v >> 8;
+        }
+    }
+    adpcmEncode(flash_adpcm, flash_pcm, CLIP_ASSETS_RING_FRAMES);
+    return true;
+}
+
+// Set up the clip from the linked bank as the firmware does, or the other formats through a single clip bank
+static void flashCreate(circular_buffer* cb, enum bench_kind kind)
+{
+    static clip_bank bank;
+    static clip_bank_entry entry;
+
+    switch (kind)
+    {
+        case kind_flash_16:
+            clipBankSingle(&bank, &entry, flash_words, circular_u16, CLIP_ASSETS_RING_FRAMES, CLIP_ASSETS_RING_RATE, 8);
+        break;
+
+        case kind_flash_12:
+            clipBankSingle(&bank, &entry, flash_packed, circular_u12, CLIP_ASSETS_RING_FRAMES, CLIP_ASSETS_RING_RATE, 12);
+        break;
+
+        case kind_adpcm:
+            clipBankSingle(&bank, &entry, flash_adpcm, circular_adpcm, CLIP_ASSETS_RING_FRAMES, CLIP_ASSETS_RING_RATE, 4);
+        break;
+
+        default:
+            clipBankCreateBuffer(&assets, CLIP_ASSETS_RING, cb);
+            return;
+    }
+    clipBankCreateBuffer(&bank, 0, cb);
+}
+
+// RAM buffer after the last, as nextRamBuffer in the firmware
+static bool nextRamBuffer(const int16_t** buff, uint32_t* num_samples)
+{
+    doubleBufferGetLast(&double_buffers, buff, num_samples);
+    eventRingAdd(&main_events, populate_double, 0);
+    return true;
+}
+
+// Stereo from the noise or signal source
+static void generateSynthetic(int16_t* dest, uint32_t frames)
+{
+    switch (source->kind)
+    {
+        case kind_white:
+            colourNoiseWhiteBlock(cn, dest, frames, 2);
+        break;
+
+        case kind_pink:
+            colourNoisePinkBlock(cn, dest, frames, 2);
+        break;
+
+        case kind_brown:
+            colourNoiseBrownBlock(cn, dest, frames, 2);
+        break;
+
+        default:
+            signalGeneratorBlock(&sg, dest, frames, 2);
+        break;
+    }
+}
+
+// PWM levels for the sources that bypass the RAM buffers, as populateDirect in the firmware
+static void populateDirect(uint32_t* buffer, uint32_t frames)
+{
+    switch (source->kind)
+    {
+        case kind_white:
+        case kind_pink:
+        case kind_brown:
+        case kind_signal:
+            dmaRefillGenerated(&fill, buffer, frames, generateSynthetic);
+        break;
+
+        case kind_flash:
+        case kind_flash_16:
+        case kind_flash_12:
+        case kind_adpcm:
+            circularBufferReadDma(&sb, buffer, frames, &fill);
+        break;
+
+        default:
+        break;
+    }
+}
+
+static void dmaInterruptHandler(void)
+{
+    uint index;
+
+    if (dmaRingAcknowledge(&dma_buffers))
+    {
+        while (dmaRingGetFree(&dma_buffers, &index))
+        {
+            eventRingAdd(&irq_events, populate_dma, index);
+        }
+    }
+}
+
+// Set up the PWM rate, fill and RAM buffers as startMusic does. Returns false if the rate cannot be played
+static bool benchStart(const bench_mode* mode)
+{
+    pwm_solution sol;
+    bool exact = pwmSolverSolve(clock_get_hz(clk_sys), source->sample_rate, mode->limits, &sol);
+
+    if (!exact && (source->direct || !pwmSolverSolve(clock_get_hz(clk_sys), RESAMPLE_CARRIER_RATE, mode->limits, &sol)))
+    {
+        return false;
+    }
+
+    wrap = sol.wrap;
+    repeat_shift = sol.shift;
+    carrier_hz = sol.carrier_hz;
+
+    bool oversampled = (carrier_hz >= (source->sample_rate << 1));
+
+    refill.direct = source->direct;
+    refill.resampling = !source->direct && (!exact || (source->quality != resample_nearest));
+
+    if (refill.resampling)
+    {
+        resamplerCreate(&rs, source->quality, source->sample_rate, carrier_hz, source->stereo ? 2 : 1);
+    }
+    dmaFillConfigure(&fill, source->stereo, true, refill.resampling ? 0 : repeat_shift, wrap, mode->gain, oversampled ? mode->order : 0);
+
+    eventRingFlush(&irq_events);
+    eventRingFlush(&main_events);
+
+    if (!source->direct)
+    {
+        doubleBufferInitialise(&double_buffers, &populateCallback, &refill.ram_buffer, &refill.ram_length);
+        refill.ram_frame = 0;
+    }
+
+    dmaRingConfigure(&dma_buffers, source->direct ? LOW_LATENCY_BUFFERS : DEEP_BUFFERS, mode->memory_len / DEEP_BUFFERS);
+
+    for (uint i=0; i<dma_buffers.count; ++i)
+    {
+        dmaRefillWords(&refill, dmaRingGetBuffer(&dma_buffers, i), dma_buffers.length);
+    }
+    dmaRingStart(&dma_buffers);
+    return true;
+}
+
+// Play the source for BENCH_SECONDS of simulated time, and report the host time spent refilling
+static void benchRun(const bench_mode* mode)
+{
+    if (!benchStart(mode))
+    {
+        printf("%-18s %-13s no PWM solution\n", source->name, mode->name);
+        return;
+    }
+
+    perfStageReset(&dma_stage);
+    perfStageReset(&ram_stage);
+
+    uint64_t ps_per_word = 1000000000000ull / carrier_hz;
+    uint32_t step = dma_buffers.length / BENCH_STEPS;
+    uint64_t words = (uint64_t)carrier_hz * BENCH_SECONDS;
+    uint64_t busy_ns = 0;
+    uint64_t refilled = 0;
+    uint32_t missed = 0;
+    uint32_t gain = mode->gain;
+
+    for (uint64_t played=0; played<words; played+=step)
+    {
+        hostDmaAdvance(step);
+        hostAdvanceClock(step * ps_per_word);
+        dmaInterruptHandler();
+
+        event_entry event;
+
+        while (eventRingRemove(&main_events, &event) || eventRingRemove(&irq_events, &event))
+        {
+            uint64_t start_ns = hostTimeNs();
+            uint32_t start = cycleCounterRead();
+
+            if (event.type == populate_dma)
+            {
+                if (mode->ramp)
+                {
+                    gain = (gain == DMA_FILL_UNITY) ? (DMA_FILL_UNITY >> 1) : DMA_FILL_UNITY;
+                    dmaFillSetGain(&fill, gain, dma_buffers.length);
+                }
+
+                dmaRefillWords(&refill, dmaRingGetBuffer(&dma_buffers, event.index), dma_buffers.length);
+                perfStageAdd(&dma_stage, cycleCounterElapsed(start));
+                refilled += dma_buffers.length;
+
+                // Refills take no simulated time, so this only fails if the ring misbehaves
+                missed += (dmaRingPlaying(&dma_buffers) == event.index);
+            }
+            else if (event.type == populate_double)
+            {
+                doubleBufferPopulateNext(&double_buffers);
+                perfStageAdd(&ram_stage, cycleCounterElapsed(start));
+            }
+            busy_ns += hostTimeNs() - start_ns;
+        }
+    }
+    dmaRingStop(&dma_buffers);
+
+    if (!busy_ns || !dma_stage.count)
+    {
+        printf("%-18s %-13s no refills\n", source->name, mode->name);
+        return;
+    }
+
+    // Source frames are the PWM words scaled back to the source rate
+    double seconds = (double)busy_ns / 1e9;
+    double words_per_sec = (double)refilled / seconds;
+    double frames_per_sec = (words_per_sec * source->sample_rate) / carrier_hz;
+
+    printf("%-18s %-13s %7u Hz shift %u %-9s %8.2f Mword/s %8.2f Mframe/s %7.0fx real time %7u cycles/buffer%s\n",
+           source->name, mode->name, (uint)carrier_hz, refill.resampling ? 0 : repeat_shift,
+           refill.resampling ? resamplerQualityName(source->quality) : "repeat",
+           words_per_sec / 1e6, frames_per_sec / 1e6, words_per_sec / carrier_hz,
+           (uint)(dma_stage.total / dma_stage.count), missed ? " LATE" : "");
+}
+
+int main(int argc, char** argv)
+{
+    cycleCounterInit();
+
+    if (!flashConvert())
+    {
+        printf("Linked clip bank does not check\n");
+        return 1;
+    }
+    flashCreate(&sb, kind_flash);
+
+    if ((argc > 1) && !strcmp(argv[1], "-k"))
+    {
+        static int16_t src[2 * DMA_BUFFER_LENGTH];
+
+        for (uint i=0; i<count_of(src); ++i)
+        {
+            src[i] = (int16_t)(((i * 2654435761u) >> 16) - 0x8000);
+        }
+        dmaFillBenchmark(dma_memory, DMA_BUFFER_LENGTH, src, 4091);
+        dmaFillNoiseBenchmark(dma_memory, DMA_BUFFER_LENGTH, src, pwm_high_carrier_limits.max_wrap);
+        pwmSolverBenchmark(clock_get_hz(clk_sys), &pwm_default_limits);
+        resamplerBenchmark((int16_t*)dma_memory, DMA_BUFFER_LENGTH, src, DMA_BUFFER_LENGTH >> 2);
+        colourNoiseBenchmark(src, DMA_BUFFER_LENGTH);
+        colourNoiseSpectrumBenchmark((int16_t*)dma_memory, 8192);
+        signalGeneratorBenchmark(src, DMA_BUFFER_LENGTH);
+        circularBufferBenchmark(src, DMA_BUFFER_LENGTH, &sb);
+        adpcmBenchmark(src, flash_pcm, DMA_BUFFER_LENGTH);
+    }
+
+    dmaRingCreate(&dma_buffers, dma_memory, count_of(dma_memory), 1);
+    dmaRefillCreate(&refill, &fill, &rs, populateDirect, nextRamBuffer);
+    eventRingCreate(&irq_events, 0x01 << populate_dma);
+    eventRingCreate(&main_events, 0x01 << populate_double);
+    doubleBufferCreate(&double_buffers, ram_buffer[0], ram_buffer[1], RAM_BUFFER_LENGTH);
+    perfStageCreate(&dma_stage, "DMA populate");
+    perfStageCreate(&ram_stage, "RAM populate");
+
+    // Decoded audio is a noise table, so the cost of decoding is not included
+    colourNoiseCreate(&cn[0], 0.5);
+    colourNoiseSeed(&cn[0], 1);
+    colourNoiseCreate(&cn[1], 0.5);
+    colourNoiseSeed(&cn[1], 2);
+
+    colourNoisePinkBlock(cn, pcm, PCM_FRAMES, 2);
+
+    printf("Simulated %u MHz system clock, %u s of playback per run, cycles are at the simulated clock\n",
+           (uint)(clock_get_hz(clk_sys) / 1000000), BENCH_SECONDS);
+
+    for (uint s=0; s<count_of(sources); ++s)
+    {
+        source = &sources[s];
+
+        for (uint m=0; m<count_of(modes); ++m)
+        {
+            // Every run starts from the same source state
+            colourNoiseCreate(&cn[0], 0.5);
+            colourNoiseSeed(&cn[0], 0);
+            colourNoiseCreate(&cn[1], 0.5);
+            colourNoiseSeed(&cn[1], 0x7FFF);
+            flashCreate(&sb, source->kind);
+            signalGeneratorCreate(&sg, source->sample_rate);
+            signalGeneratorSelect(&sg, source->signal);
+            pcm_pos = 0;
+
+            benchRun(&modes[m]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "pwm_solver.h"
+/*
+   Checks the PWM solution for every common sample rate against the limits it was solved for
+   The error is also worked out again from the divider and wrap, rather than trusted
+   A rate that the clock cannot reach must be solved at a clock from pwmSolverPickClock
+   Exits with 1 if any check fails, so a failure fails the run
+ */
+
+static const uint32_t rates[] = {8000, 11000, 11025, 12000, 16000, 22000, 22050, 24000,
+                                 32000, 44000, 44100, 48000, 88200, 96000};
+
+// Firmware clock, and the pico-sdk default
+static const uint32_t clocks_hz[] = {180000000, 125000000};
+
+static uint failures = 0;
+
+static void check(bool ok, const char* what, uint32_t sys_hz, uint32_t rate, const char* limits)
+{
+    if (!ok)
+    {
+        printf("FAIL %s: %u Hz at %u MHz, %s limits\n", what, rate, sys_hz / 1000000, limits);
+        failures++;
+    }
+}
+
+static void checkRate(uint32_t sys_hz, uint32_t rate, const pwm_limits* limits, const char* name)
+{
+    pwm_solution sol;
+    uint32_t clock_khz;
+
+    if (!pwmSolverSolve(sys_hz, rate, limits, &sol))
+    {
+        if (!pwmSolverPickClock(sys_hz / 1000, rate, limits, &clock_khz, &sol))
+        {
+            check(false, "no solution at any clock", sys_hz, rate, name);
+            return;
+        }
+        sys_hz = clock_khz * 1000;
+        check(sol.sys_hz == sys_hz, "solution is for another clock", sys_hz, rate, name);
+    }
+
+    // Rate of the divided clock, and its error against the repeated sample rate
+    double pwm_hz = ((double)sys_hz * 16.0) / ((double)sol.div_16 * (double)(sol.wrap + 1));
+    double ppm = ((pwm_hz / (double)(rate << sol.shift)) - 1.0) * 1e6;
+
+    check((sol.wrap >= limits->min_wrap) && (sol.wrap <= limits->max_wrap), "wrap out of range", sys_hz, rate, name);
+    check((sol.div_16 >= 16) && (sol.div_16 <= 0xFFF), "divider out of range", sys_hz, rate, name);
+    check(sol.shift <= limits->max_shift, "shift out of range", sys_hz, rate, name);
+    check((sol.carrier_hz >= limits->min_carrier) || (sol.shift == limits->max_shift), "carrier too low", sys_hz, rate, name);
+    check(!sol.shift || ((rate << (sol.shift - 1)) < limits->min_carrier), "shift larger than needed", sys_hz, rate, name);
+    check((uint32_t)abs(sol.error_ppm) <= limits->max_ppm, "error above max_ppm", sys_hz, rate, name);
+    check(abs((int32_t)(ppm - (double)sol.error_ppm)) <= 1, "error does not match the divider and wrap", sys_hz, rate, name);
+    check(abs((int32_t)(pwm_hz - (double)sol.carrier_hz)) <= 1, "carrier does not match the divider and wrap", sys_hz, rate, name);
+}
+
+int main(void)
+{
+    for (uint c=0; c<count_of(clocks_hz); ++c)
+    {
+        for (uint i=0; i<count_of(rates); ++i)
+        {
+            checkRate(clocks_hz[c], rates[i], &pwm_default_limits, "default");
+            checkRate(clocks_hz[c], rates[i], &pwm_high_carrier_limits, "high carrier");
+        }
+    }
+
+    printf("pwm solver: %u rates, %u failures\n", (uint)(count_of(clocks_hz) * count_of(rates) * 2), failures);
+    return failures ? 1 : 0;
+}
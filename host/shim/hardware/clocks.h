@@ -0,0 +1,12 @@
+#pragma once
+#include "pico/stdlib.h"
+
+enum clock_index
+{
+    clk_sys = 5
+};
+
+// System clock of the simulated RP2040
+#define HOST_SYS_CLOCK_HZ 180000000
+
+static inline uint32_t clock_get_hz(enum clock_index clk_index){(void)clk_index; return HOST_SYS_CLOCK_HZ;}
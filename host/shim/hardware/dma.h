@@ -0,0 +1,66 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * Simulated DMA channels. Only the features used by the ring are modelled:
+ * read increment, chaining, the read address ring and the IRQ 1 flags.
+ * Addresses are held at host pointer width
+ */
+
+#define NUM_DMA_CHANNELS 12
+#define DREQ_PWM_WRAP0 24
+
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+typedef struct
+{
+    bool      read_increment;
+    uint      chain_to;
+    uint      ring_bits;            // Read address wraps at (1 << ring_bits) bytes, 0 for no wrap
+} dma_channel_config;
+
+typedef struct
+{
+    volatile uintptr_t read_addr;
+    volatile uintptr_t write_addr;
+    volatile uint32_t  transfer_count;
+    volatile uintptr_t al3_read_addr_trig;
+} dma_channel_hw_t;
+
+typedef struct
+{
+    dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+    volatile uint32_t inte1;
+    volatile uint32_t ints1;
+} dma_hw_t;
+
+extern dma_hw_t* dma_hw;
+
+extern int dma_claim_unused_channel(bool required);
+extern dma_channel_config dma_channel_get_default_config(uint channel);
+extern void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr,
+                                  const volatile void* read_addr, uint transfer_count, bool trigger);
+extern void dma_channel_set_read_addr(uint channel, const volatile void* read_addr, bool trigger);
+extern void dma_channel_abort(uint channel);
+
+// Play words transfers on every running channel, chaining and raising interrupts as the hardware would
+extern void hostDmaAdvance(uint32_t words);
+
+static inline void channel_config_set_read_increment(dma_channel_config* c, bool incr){c->read_increment = incr;}
+static inline void channel_config_set_write_increment(dma_channel_config* c, bool incr){(void)c; (void)incr;}
+static inline void channel_config_set_dreq(dma_channel_config* c, uint dreq){(void)c; (void)dreq;}
+static inline void channel_config_set_transfer_data_size(dma_channel_config* c, enum dma_channel_transfer_size size){(void)c; (void)size;}
+static inline void channel_config_set_chain_to(dma_channel_config* c, uint chain_to){c->chain_to = chain_to;}
+static inline void channel_config_set_ring(dma_channel_config* c, bool write, uint size_bits){(void)write; c->ring_bits = size_bits;}
+
+static inline void dma_channel_set_irq1_enabled(uint channel, bool enabled)
+{
+    dma_hw->inte1 = enabled ? (dma_hw->inte1 | (1u << channel)) : (dma_hw->inte1 & ~(1u << channel));
+}
+static inline bool dma_channel_get_irq1_status(uint channel){return (dma_hw->ints1 >> channel) & 1;}
+static inline void dma_channel_acknowledge_irq1(uint channel){dma_hw->ints1 &= ~(1u << channel);}
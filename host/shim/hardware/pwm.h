@@ -0,0 +1,15 @@
+#pragma once
+#include "pico/stdlib.h"
+
+// Only the compare registers are used, as the destination of the DMA
+typedef struct
+{
+    volatile uint32_t csr, div, ctr, cc, top;
+} pwm_slice_hw_t;
+
+typedef struct
+{
+    pwm_slice_hw_t slice[8];
+} pwm_hw_t;
+
+extern pwm_hw_t* pwm_hw;
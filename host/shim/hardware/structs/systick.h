@@ -0,0 +1,15 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * SysTick counting down at the simulated system clock, from the host's
+ * monotonic clock. Reading cvr through systick_hw returns the current count
+ */
+typedef struct
+{
+    volatile uint32_t csr, rvr, cvr, calib;
+} systick_hw_t;
+
+extern systick_hw_t* hostSysTick(void);
+
+#define systick_hw (hostSysTick())
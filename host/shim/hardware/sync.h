@@ -0,0 +1,10 @@
+#pragma once
+#include "pico/stdlib.h"
+
+// The host runs the pipeline on one thread, so interrupts are never taken
+static inline uint32_t save_and_disable_interrupts(void){return 0;}
+static inline void restore_interrupts(uint32_t status){(void)status;}
+static inline void __dmb(void){__atomic_thread_fence(__ATOMIC_SEQ_CST);}
+static inline void __sev(void){}
+static inline void __wfe(void){}
+static inline void __wfi(void){}
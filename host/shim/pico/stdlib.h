@@ -0,0 +1,23 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/*
+ * Host stand in for the parts of the pico-sdk used by the pipeline modules
+ * Time is simulated, and advanced by the bench driver as the DMA plays
+ */
+
+typedef unsigned int uint;
+
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+// Simulated time in us
+extern uint64_t time_us_64(void);
+static inline uint32_t time_us_32(void){return (uint32_t)time_us_64();}
+
+// Accepts any clock that the RP2040 PLL can make
+extern bool check_sys_clock_khz(uint32_t freq_khz, uint* vco_freq_out, uint* post_div1_out, uint* post_div2_out);
+
+static inline void tight_loop_contents(void){}
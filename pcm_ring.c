@@ -0,0 +1,51 @@
+#include "pcm_ring.h"
+/*
+   Manages a ring of PCM blocks in RAM.
+   The blocks are filled by calling a populate function
+ */
+
+// Create the ring
+void pcmRingCreate(pcm_ring* pr, int16_t* buff, uint32_t num_blocks, uint32_t block_len)
+{
+    if (num_blocks > PCM_RING_MAX_BLOCKS)
+    {
+        num_blocks = PCM_RING_MAX_BLOCKS;
+    }
+
+    for (uint32_t i=0; i<num_blocks; ++i)
+    {
+        pr->blocks[i] = buff + (i * block_len);
+        pr->len_used[i] = 0;
+    }
+
+    pr->mask = num_blocks - 1;
+    pr->block_len = block_len;
+    pr->head = 0;
+    pr->tail = 0;
+    pr->fn = NULL;
+}
+
+// Must only be called when neither producer nor consumer is active
+void pcmRingInitialise(pcm_ring* pr, populateBuffer fn)
+{
+    pr->fn = fn;
+    pr->head = 0;
+    pr->tail = 0;
+}
+
+// Populate the next free block
+bool pcmRingPopulateNext(pcm_ring* pr)
+{
+    if (pcmRingFull(pr) || !pr->fn)
+    {
+        return false;
+    }
+
+    uint32_t index = pr->head & pr->mask;
+    pr->len_used[index] = (*(pr->fn))(pr->blocks[index], pr->block_len);
+
+    // Ensure block contents are written before it is published
+    __dmb();
+    pr->head = pr->head + 1;
+    return true;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "double_buffer.h"
+
+/*
+ * Single producer, single consumer ring of PCM blocks
+ * Used to pass decoded audio from core1 to the DMA feeder on core0
+ * without locks. The producer only writes head, the consumer only writes tail
+ */
+
+// Maximum number of blocks, must be a power of 2
+#define PCM_RING_MAX_BLOCKS 8
+
+// Data for the ring
+typedef struct pcm_ring
+{
+    int16_t*  blocks[PCM_RING_MAX_BLOCKS];      // Address of blocks
+    uint32_t  len_used[PCM_RING_MAX_BLOCKS];    // Number of entries (16 bit words) populated in block
+    uint32_t  mask;                             // Number of blocks - 1
+    uint32_t  block_len;                        // Length of each block
+    volatile uint32_t head;                     // Count of blocks populated, written by producer
+    volatile uint32_t tail;                     // Count of blocks released, written by consumer
+    populateBuffer fn;                          // Population function
+} pcm_ring;
+
+// Create the ring, splitting buff into num_blocks blocks of block_len samples
+extern void pcmRingCreate(pcm_ring* pr, int16_t* buff, uint32_t num_blocks, uint32_t block_len);
+
+// Empty the ring and set the population function
+extern void pcmRingInitialise(pcm_ring* pr, populateBuffer fn);
+
+// Populate the next free block, returns false if the ring is full
+extern bool pcmRingPopulateNext(pcm_ring* pr);
+
+/*
+ * Inline helper functions, called by the consumer
+ */
+// Obtain the oldest populated block, returns false if none is ready
+static inline bool pcmRingAcquire(pcm_ring* pr, const int16_t** buff, uint32_t* num_samples)
+{
+    uint32_t tail = pr->tail;
+
+    if (pr->head == tail)
+    {
+        return false;
+    }
+
+    // Ensure block contents are read after the head
+    __dmb();
+    *buff = pr->blocks[tail & pr->mask];
+    *num_samples = pr->len_used[tail & pr->mask];
+    return true;
+}
+
+// Return the block obtained by pcmRingAcquire to the producer
+static inline void pcmRingRelease(pcm_ring* pr){__dmb(); pr->tail = pr->tail + 1;}
+
+// Return true if all blocks are populated
+static inline bool pcmRingFull(pcm_ring* pr){return (pr->head - pr->tail) > pr->mask;}
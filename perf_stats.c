@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include "perf_stats.h"
+/*
+   Counters used to measure how close the pipeline is to missing deadlines
+ */
+
+void perfStageCreate(perf_stage* ps, const char* name)
+{
+    ps->name = name;
+    perfStageReset(ps);
+}
+
+void perfStageReset(perf_stage* ps)
+{
+    ps->count = 0;
+    ps->min = UINT32_MAX;
+    ps->max = 0;
+    ps->total = 0;
+}
+
+void perfStagePrint(const perf_stage* ps)
+{
+    if (ps->count)
+    {
+        printf("%s: runs %u cycles min %u avg %u max %u\n", ps->name, (uint)ps->count,
+               (uint)ps->min, (uint)(ps->total / ps->count), (uint)ps->max);
+    }
+}
+
+void perfSlackCreate(perf_slack* ps, const char* name)
+{
+    ps->name = name;
+    perfSlackReset(ps);
+}
+
+void perfSlackReset(perf_slack* ps)
+{
+    for (int i=0; i<PERF_SLACK_BINS; ++i)
+    {
+        ps->bins[i] = 0;
+    }
+    ps->underruns = 0;
+}
+
+void perfSlackPrint(const perf_slack* ps)
+{
+    printf("%s slack (low to high):", ps->name);
+
+    for (int i=0; i<PERF_SLACK_BINS; ++i)
+    {
+        printf(" %u", (uint)ps->bins[i]);
+    }
+    printf(" underruns %u\n", (uint)ps->underruns);
+}
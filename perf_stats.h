@@ -0,0 +1,70 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * Low overhead counters for the refill pipeline
+ * Stage timings are in cycles. Slack is the time left before a refilled
+ * buffer is played, as a proportion of the time available for the refill
+ */
+
+// Number of histogram bins, each covers 1/PERF_SLACK_BINS of the available time
+#define PERF_SLACK_BINS 8
+
+// Timing of one pipeline stage
+typedef struct perf_stage
+{
+    const char* name;
+    uint32_t  count;                // Number of times the stage ran
+    uint32_t  min;                  // Fewest cycles
+    uint32_t  max;                  // Most cycles
+    uint64_t  total;                // Sum of cycles, for the average
+} perf_stage;
+
+// Deadline slack of the DMA refills for one source
+typedef struct perf_slack
+{
+    const char* name;
+    uint32_t  bins[PERF_SLACK_BINS];    // bins[0] is closest to the deadline
+    uint32_t  underruns;                // Refills that missed the deadline
+} perf_slack;
+
+extern void perfStageCreate(perf_stage* ps, const char* name);
+extern void perfStageReset(perf_stage* ps);
+extern void perfStagePrint(const perf_stage* ps);
+
+extern void perfSlackCreate(perf_slack* ps, const char* name);
+extern void perfSlackReset(perf_slack* ps);
+extern void perfSlackPrint(const perf_slack* ps);
+
+/*
+ * Inline helper functions, called on every refill
+ */
+// Record the cycles taken by one run of a stage
+static inline void perfStageAdd(perf_stage* ps, uint32_t cycles)
+{
+    ps->count++;
+    ps->total += cycles;
+
+    if (cycles < ps->min)
+    {
+        ps->min = cycles;
+    }
+    if (cycles > ps->max)
+    {
+        ps->max = cycles;
+    }
+}
+
+// Record a refill that finished slack us before its deadline, out of window us available
+static inline void perfSlackAdd(perf_slack* ps, int32_t slack, uint32_t window)
+{
+    if ((slack < 0) || !window)
+    {
+        ps->underruns++;
+    }
+    else
+    {
+        uint32_t bin = ((uint32_t)slack * PERF_SLACK_BINS) / window;
+        ps->bins[(bin < PERF_SLACK_BINS) ? bin : (PERF_SLACK_BINS - 1)]++;
+    }
+}
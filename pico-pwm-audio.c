@@ -1,31 +1,66 @@
 #include <stdio.h>
-#include <math.h>          // For fminf and fmaxf
 #include "pico/stdlib.h"   // stdlib 
 #include "hardware/irq.h"  // interrupts
 #include "hardware/dma.h"  // dma 
 #include "hardware/sync.h" // wait for interrupt 
-#include "pico/util/queue.h" 
+#include "hardware/clocks.h" // system clock rate
+#include "hardware/regs/addressmap.h" // flash address
+#include "pico/multicore.h"
 
 #include "fs_mount.h"
 #include "pwm_channel.h"
 #include "debounce_button.h"
 #include "double_buffer.h"
+#include "pcm_ring.h"
 #include "circular_buffer.h"
+#include "clip_bank.h"
 #include "colour_noise.h"
+#include "signal_generator.h"
+#include "dma_fill.h"
+#include "dma_ring.h"
+#include "dma_refill.h"
+#include "pwm_solver.h"
+#include "resampler.h"
+#include "event_ring.h"
+#include "perf_stats.h"
+#include "cycle_counter.h"
 #include "music_file.h"
 
  
 #define AUDIO_PIN 18  // Configured for the Maker board 18 left, 19 right
 #define STEREO        // When stereo not enabled, DMA same l and r data to both channels
 #define FLASH
+#define FLASH_BANK    // Play the clips of a bank image at CLIP_BANK_OFFSET, if one has been written
+//#define FLASH_HEADER "clip.h"  // Play a header from clipbank -c or the converter notebook, rather than the clips in assets
+//#define BENCHMARK   // Report timings of the fill kernels at start up
+//#define CORE1_DECODE  // Populate the RAM buffers from core1, rather than via the event queue
+//#define CLOCK_SEARCH  // Change the system clock when it gives a much better fit to the sample rate
+                        // Not while the SD card is mounted, as its SPI baud was set from the old clock
+//#define HIGH_CARRIER  // Run the PWM at about 176kHz with a wrap near 1023, oversampling the source
 
 #ifdef FLASH
+#ifdef FLASH_HEADER
 /* 
  * This include brings in static arrays which contain audio samples. 
  * if you want to know how to make these please see the python code
  * for converting audio samples into static arrays. 
+ * Headers that define PACKED hold 8 bit samples in bytes, or 12 bit samples two to 3 bytes
+ * Headers that define ADPCM hold IMA-ADPCM blocks rather than samples
  */
-#include "ring.h"
+#include FLASH_HEADER
+
+#ifdef SAMPLE_RATE
+#define FLASH_RATE SAMPLE_RATE      // Rate of the built in clip, from its header
+#else
+#define FLASH_RATE 11000
+#endif
+#else
+#include "clip_assets.h"            // Bank image of the clips in assets, converted and linked by the build
+#endif
+#endif
+
+#ifndef CLIP_BANK_OFFSET
+#define CLIP_BANK_OFFSET (1024 * 1024)  // Bank image in flash, above the firmware. The build checks the firmware ends below it
 #endif
 
 #ifdef STEREO
@@ -35,63 +70,138 @@ bool play_stereo = false;
 #endif
 
 static colour_noise cn[2];
+static signal_generator sg;
 static circular_buffer sb;
+#ifdef FLASH
+static clip_bank flash_bank;                // The bank image, or the built in clips
+#ifdef FLASH_HEADER
+static clip_bank_entry builtin_entry;       // Directory entry for the built in clip
+#endif
+static uint flash_clip = 0;                 // Clip of the bank being played
+#endif
 
 
-#ifndef SAMPLE_RATE
-#define SAMPLE_RATE 11000
+#define NOISE_RATE 11000            // Noise is generated at the rate of the flash clips
+#define SIGNAL_RATE 44100           // Test signals are generated at CD rate
+#define DMA_BUFFER_LENGTH 2200      // 2200 samples @ 44kHz gives= 0.05 seconds
+#ifdef HIGH_CARRIER
+#define DMA_MEMORY_LENGTH (4*DMA_BUFFER_LENGTH)     // PWM rate is 4 times higher, so half the latency
+#define PWM_LIMITS pwm_high_carrier_limits
+#else
+#define DMA_MEMORY_LENGTH (2*DMA_BUFFER_LENGTH)
+#define PWM_LIMITS pwm_default_limits
 #endif
-#define DMA_BUFFER_LENGTH 2200      // 2200 samples @ 44kHz gives= 0.05 seconds = interrupt rate
 
-#define RAM_BUFFER_LENGTH (4*DMA_BUFFER_LENGTH)
+// DMA ring shapes, both split the same memory into 12.5ms buffers @ 44kHz
+// Few buffers give low latency, many buffers give more slack against a late refill
+#define LOW_LATENCY_BUFFERS 4       // Used for noise and flash, 50ms latency
+#define DEEP_BUFFERS 8              // Used for files from SD card, 100ms latency
+
+// RAM buffers are only used by sources that cannot write PWM levels directly
+#define RAM_BUFFER_LENGTH (2*DMA_BUFFER_LENGTH)
 
 /*
  * Static variable definitions
  */
-#ifdef FLASH
-#ifdef TWELVE_BIT
-static const int flash_shift = 4;           // Only used for flash samples
-#else
-static const int flash_shift = 8;           // Only used for flash samples
-#endif
-#endif
-
 static uint wrap;                           // Largest value a sample can be + 1
 static int mid_point;                       // wrap divided by 2
 static float fraction = 1;                  // Divider used for PWM
-static int repeat_shift = 1;                // Defined by the sample rate
+static uint repeat_shift = 1;               // Defined by the sample rate
+static uint32_t carrier_hz;                 // PWM rate
 
 static pwm_data pwm_channel[2];             // Represents the PWM channels
-static int dma_channel[2];                  // The 2 DMA channels used for DMA ping pong
 
- // Have 2 buffers in RAM that are used to DMA the samples to the PWM engine
-static uint32_t dma_buffer[2][DMA_BUFFER_LENGTH];
-static int dma_buffer_index = 0;            // Index into active DMA buffer
-
-// Have 2 or 4 8k buffers in RAM, copy data from Flash to these buffers - in future
-// will be buffers where noise is created, or music delivered from SD Card
+// Memory in RAM that is split into a ring of buffers used to DMA the samples to the PWM engine
+static uint32_t dma_memory[DMA_MEMORY_LENGTH];
+static dma_ring dma_buffers;                // Ring of DMA buffers, and the channels that play them
+static uint dma_buffer_count = LOW_LATENCY_BUFFERS; // Number of DMA buffers for the current source
+static dma_fill fill;                       // Kernel and scaling used to populate DMA buffers
+
+// Sample rate conversion from the RAM buffers to the PWM rate
+#define RESAMPLE_QUALITY resample_fir       // Initial quality, nearest repeats samples when the rates allow
+#define RESAMPLE_CARRIER_RATE 44000         // PWM rate used for sample rates the PWM cannot reach
+static resampler rs;
+static enum resample_quality resample_quality = RESAMPLE_QUALITY;
+
+// Switching sources while playing. The new source is prebuffered while the DMA
+// plays what is queued, then crossfaded in a short time ahead of the DMA
+#define CROSSFADE_US 5000                   // Length of the crossfade
+#define CROSSFADE_MAX_WORDS 1024            // Limits the crossfade at high PWM rates
+#define CROSSFADE_GUARD 64                  // Words left for the DMA to play before rewriting starts
+#define SWITCH_CHUNK 128                    // Words rewritten between checks that the DMA is still behind
+static uint32_t crossfade_buffer[CROSSFADE_MAX_WORDS];   // Old levels being faded out
+
+// Starting and stopping move the PWM between 0 and mid_point in the DMA buffers,
+// so no work is needed while the ramp plays
+#define RAMP_PERIODS 256                    // PWM periods to ramp over, rounded up to DMA_RING_LENGTH_ALIGN
+static bool pwm_running = false;            // True between startMusic and stopMusic
+
+// Noise shaping of the quantisation to PWM levels. Only used when the PWM rate
+// is at least twice the sample rate, otherwise the noise stays in the audio band
+#define NOISE_SHAPING 2                     // Order of the error feedback, 0 to disable
+static uint noise_shaping = NOISE_SHAPING;
+static bool oversampled = false;            // True if PWM rate is at least twice the sample rate
+
+// Have 2 buffers in RAM, music delivered from SD Card is decoded into these buffers.
+// Noise and flash samples skip them, and are written straight to the DMA buffers
 
 // RAM buffers, controlled through double_buffer class
 static int16_t ram_buffer[2][RAM_BUFFER_LENGTH];
 static bool sampled_stereo = false;         // True if ram_buffer contains stereo, false for mono
 
-// Control data blocks for the RAM double buffers
+// Control data blocks for the RAM buffers
+#ifdef CORE1_DECODE
+// ram_buffer is split into a ring of blocks, populated by core1
+#define PCM_BLOCKS 4
+static pcm_ring pcm_blocks;
+static volatile bool decode_run = false;     // Set by core0 to allow core1 to populate
+static volatile uint32_t decode_stops = 0;  // Incremented by core0 for every stop
+static volatile uint32_t decode_idle = 0;   // Set by core1 to the stops it has seen while idle
+static uint32_t underruns = 0;              // Number of times core1 had no block ready
+#else
 static double_buffer double_buffers;
+#endif
 uint32_t populateCallback(int16_t* buffer, uint32_t len);   // Call back to generate next buffer of sound
 
+// Refills the DMA buffers from the RAM buffers, or straight from the noise and flash sources
+static dma_refill refill;
+static void populateDirect(uint32_t* buffer, uint32_t frames);
+static void generateSynthetic(int16_t* dest, uint32_t frames);
+
 // Working buffer for reading from file
 #define CACHE_BUFFER 16000
 unsigned char cache_buffer[CACHE_BUFFER];
 
-// Pointer to the currenly in use RAM buffer
-static const int16_t* current_RAM_Buffer = 0;
-static int ram_buffer_index = 0;            // Holds current position in ram_buffers for channels
-static uint32_t current_RAM_length = 0;     // number of active samples in current RAM buffer
+// Time each core spent working, used to report utilisation. Each count is only
+// written by its own core, so resetting records where the count was instead
+static volatile uint64_t busy_us[2];
+static uint64_t busy_reset_us[2];
+static uint64_t load_start_us = 0;
+
+// Types of source, slack is measured separately for each
+enum source_type
+{
+    source_noise = 0,
+    source_flash = source_noise + 1,
+    source_file = source_flash + 1,
+    source_signal = source_file + 1,
+    source_types = source_signal + 1
+};
+static enum source_type current_source = source_noise;
+
+// Pipeline timings and slack histograms
+static perf_stage dma_stage;                // Cycles to populate a DMA buffer
+static perf_stage ram_stage;                // Cycles to populate a RAM buffer
+static perf_slack slack_stats[source_types];
+static uint32_t buffer_us = 0;              // Time to play one DMA buffer
 
-static float volume = 0.8;                  // Initial volume adjust, controlled by button
+#define VOLUME_STEP 0x0CCD                  // 0.1 in Q15
+static uint32_t volume = DMA_FILL_UNITY;    // Volume (Q15), controlled by buttons and ramped over one DMA buffer
 
-// Event queue, used to leave ISR context
-static queue_t eventQueue;
+// Event rings. irq_events is added to by the DMA and button interrupts, which have the
+// same priority so cannot preempt each other. main_events is added to by the main loop
+static event_ring irq_events;
+static event_ring main_events;
 
 // Supported events
 enum Event 
@@ -121,12 +231,10 @@ enum sound_state
     white = file_3 + 1,
 #endif
     pink = white + 1,
-    end = pink + 1
+    test_signal = pink + 1,
+    end = test_signal + 1
 };
 
-// To convert from 16 bit signed to unsigned
-#define MID_VALUE 0x8000
-
 // Helper to determine if state is a colour state
 static inline bool isColour(enum sound_state state) {return (state == white || state == pink || state == brown);}
 static inline bool isFile(enum sound_state state) {return (state == file_1 || state == file_2 || state == file_3);}
@@ -140,19 +248,34 @@ static debounce_button_data button[4];
 /* 
  * Function declarations
  */
-static void populateDmaBuffer(void);
-static void claimDmaChannels(int num_channels);
-static void initDma(int buffer_index, int slice, int chain_index);
+static void populateDmaBuffer(uint index);
+static void refillDmaBuffer(const event_entry* event);
+static bool nextRamBuffer(const int16_t** buff, uint32_t* num_samples);
+static void configureFill(void);
 static void dmaInterruptHandler();
-
-static bool getSampleValues(uint sample_rate, uint* shift, uint* wrap, uint* mid_point, float* fraction);
-
-void startMusic(uint32_t sample_rate);
+static void resetStats(void);
+static void printStats(void);
+static void pollCommand(void);
+
+bool startMusic(uint32_t sample_rate);
+static bool switchMusic(uint32_t sample_rate, uint64_t deadline);
+static void fadeOut(void);
+static uint32_t crossfadeWords(void);
+static uint32_t rampWords(void);
+static void prepareSource(uint32_t sample_rate, bool exact, uint64_t deadline);
+static void printSource(void);
 void stopMusic();
 void exitMusic();
 
 void buttonCallback(uint gpio_number, enum debounce_event event);
 
+#ifdef CORE1_DECODE
+static void core1Entry(void);
+static void startDecode(void);
+static void stopDecode(void);
+static bool pauseDecode(void);
+#endif
+
 static bool loadFile(const char* filename);
 static fs_mount mount;
 static music_file mf;
@@ -165,205 +288,84 @@ static music_file mf;
  * Function definitions
  */
 
-// Handles interrupts for the DMA chain
-// Resets start address for DMA and requests buffer that is exhausted to be refilled
+// Handles interrupts for the DMA ring
+// The control channel has already started the next buffer, so just
+// request that every buffer that is exhausted is refilled
 static void dmaInterruptHandler() 
 {
-    // Determine which DMA caused the interrupt
-    for (int i = 0 ; i<2; ++i)
+    uint index;
+
+    if (dmaRingAcknowledge(&dma_buffers))
     {
-        if (dma_channel_get_irq1_status(dma_channel[i]))
+        while (dmaRingGetFree(&dma_buffers, &index))
         {
-            dma_channel_acknowledge_irq1(dma_channel[i]);
-            dma_channel_set_read_addr(dma_channel[i], dma_buffer[i], false);
-
             // Populate buffer outside of IRQ
-            enum Event e = populate_dma;
-            queue_try_add(&eventQueue, &e);
+            eventRingAdd(&irq_events, populate_dma, index);
         }
-    }    
+    }
 }
 
 // Populate the DMA buffer, referenced by index
-static void populateDmaBuffer(void)
+static void populateDmaBuffer(uint index)
 {
-    uint32_t left;
-    uint32_t right;
-
-    // Calculate the wrap point for the ram_buffer_index
-    uint32_t ram_buffer_wrap = (sampled_stereo) ? (current_RAM_length<<repeat_shift) : (current_RAM_length<<(repeat_shift+1));
-
-    // Populate two bytes from each active buffer
-    for (int i=0; i<DMA_BUFFER_LENGTH; ++i)
-    {
-        // build the 32 bit word from the two channels
-        if (sampled_stereo)
-        {
-#ifdef VOLUME        
-        // Write to buffer, adjusting for volume
-            left = ((int32_t)(current_RAM_Buffer[(ram_buffer_index>>repeat_shift)<<1] * volume) + MID_VALUE) >> 4;
-            right =((int32_t)(current_RAM_Buffer[((ram_buffer_index>>repeat_shift)<<1)+1] * volume) + MID_VALUE) >> 4;
-#else
-            left = (current_RAM_Buffer[(ram_buffer_index>>repeat_shift)<<1] + MID_VALUE) >> 4;
-            right =(current_RAM_Buffer[((ram_buffer_index>>repeat_shift)<<1)+1] + MID_VALUE) >> 4;
-#endif        
-        }
-        else
-        {
-#ifdef VOLUME        
-        // Write to buffer, adjusting for volume
-            left = ((int32_t)(current_RAM_Buffer[ram_buffer_index>>repeat_shift] * volume) + MID_VALUE) >> 4;
-#else            
-            left = (current_RAM_Buffer[ram_buffer_index>>repeat_shift] + MID_VALUE) >> 4;
-#endif            
-            right = left;
-        }
-        ram_buffer_index++;
-
-        if (!play_stereo)
-        {
-            // Want mono, so average two channels
-            left = (left + right) >> 1;
-            right = left;
-        }
-
-        // Combine the two channels
-        dma_buffer[dma_buffer_index][i] = (right << 16) + left;
+    dmaRefillWords(&refill, dmaRingGetBuffer(&dma_buffers, index), dma_buffers.length);
+}
 
-        if ((ram_buffer_index<<1) == ram_buffer_wrap) 
-        {
-            // Need a new RAM buffer
-            doubleBufferGetLast(&double_buffers, &current_RAM_Buffer, &current_RAM_length);
+// Populate a DMA buffer that has been played, and measure how close it came to its deadline
+static void refillDmaBuffer(const event_entry* event)
+{
+    uint32_t start = cycleCounterRead();
+    populateDmaBuffer(event->index);
+    perfStageAdd(&dma_stage, cycleCounterElapsed(start));
 
-            // reset read position of RAM buffer to start
-            ram_buffer_index = 0;
+    // The buffer is next played after all of the other buffers in the ring
+    uint32_t window = (dma_buffers.count - 1) * buffer_us;
+    int32_t slack = (int32_t)(event->timestamp + window - time_us_32());
 
-            // Signal to populate a new RAM buffer
-            enum Event e = populate_double;
-            queue_try_add(&eventQueue, &e);
-        }
+    if (dmaRingPlaying(&dma_buffers) == event->index)
+    {
+        // DMA reached the buffer before it was populated
+        slack = -1;
     }
-    dma_buffer_index = 1 - dma_buffer_index;
+    perfSlackAdd(&slack_stats[current_source], slack, window);
 }
 
-// Obtain the DMA channels - need 2 
-static void claimDmaChannels(int num_channels)
+// Replace the RAM buffer in *buff with the next one, returns false if none was ready
+// Called by the refill stage
+static bool nextRamBuffer(const int16_t** buff, uint32_t* num_samples)
 {
-    for (int i=0; i<num_channels; ++i)
+#ifdef CORE1_DECODE
+    // Return the finished block to core1
+    if (*buff)
     {
-        dma_channel[i] = dma_claim_unused_channel(true); 
+        pcmRingRelease(&pcm_blocks);
+        *buff = 0;
+        __sev();
     }
-}
-
-// Configure the DMA channels - including chaining
-static void initDma(int buffer_index, int slice, int chain_index)
-{
-    dma_channel_config config = dma_channel_get_default_config(dma_channel[buffer_index]); 
-    channel_config_set_read_increment(&config, true); 
-    channel_config_set_write_increment(&config, false); 
-    channel_config_set_dreq(&config, DREQ_PWM_WRAP0 + slice); 
-    channel_config_set_transfer_data_size(&config, DMA_SIZE_32); 
-    channel_config_set_chain_to(&config, dma_channel[chain_index]);
-
-    // Set up config
-    dma_channel_configure(dma_channel[buffer_index], 
-                          &config, 
-                          &pwm_hw->slice[slice].cc, 
-                          dma_buffer[buffer_index],
-                          DMA_BUFFER_LENGTH,
-                          false);
-}
 
-// Determin configuration data, based on sample rate
-static bool getSampleValues(uint sample_rate, uint* shift, uint* wrap, uint* mid_point, float* fraction)
-{
-    bool ret = true;
-
-    switch (sample_rate)
+    if (!pcmRingAcquire(&pcm_blocks, buff, num_samples))
     {
-        case 11000:
-            *shift = 2;
-            *wrap = 4091;
-            *fraction = 1.0f;
-        break;
-
-        case 22000:
-            *shift = 1;
-            *wrap = 4091;
-            *fraction = 1.0f;
-        break;
-
-        case 11025:
-            *shift = 2;
-            *wrap = 4082;
-            *fraction = 1.0f;
-        break;
-
-        case 22050:
-            *shift = 1;
-            *wrap = 4082;
-            *fraction = 1.0f;
-        break;
-
-        case 44000:
-            *shift = 0;
-            *wrap = 4091;
-            *fraction = 1.0f;
-        break;
-
-        case 44100:
-            *shift = 0;
-            *wrap = 4082;
-            *fraction = 1.0f;
-        break;
-
-        case 8000:
-            *shift = 2;
-            *wrap = 4091;
-            *fraction = 1.375f;
-        break;
-
-        case 16000:
-            *shift = 1;
-            *wrap = 4091;
-            *fraction = 1.375f;
-        break;
-
-        case 32000:
-            *shift = 0;
-            *wrap = 4091;
-            *fraction = 1.375f;
-        break;
-
-        case 12000:
-            *shift = 2;
-            *wrap = 3750;
-            *fraction = 1.0f;
-        break;
-
-        case 24000:
-            *shift = 1;
-            *wrap = 3750;
-            *fraction = 1.0f;
-        break;
-
-        case 48000:
-            *shift = 0;
-            *wrap = 3750;
-            *fraction = 1.0f;
-        break;
-
-        default:
-            // Not a supported rate
-            *wrap = 0;
-            ret = false;
-        break;
+        // Core1 has not kept up
+        underruns++;
+        return false;
     }
+#else
+    doubleBufferGetLast(&double_buffers, buff, num_samples);
 
-    // mid point is half of wrap value
-    *mid_point = *wrap >> 1;
+    // Signal to populate a new RAM buffer
+    eventRingAdd(&main_events, populate_double, 0);
+#endif
+    return true;
+}
+
+// Select the fill kernel for the current source, output and volume
+// The resampler produces samples at the PWM rate, so they are not repeated
+static void configureFill(void)
+{
+    uint shift = refill.resampling ? 0 : repeat_shift;
+    uint order = oversampled ? noise_shaping : 0;
 
-    return ret;
+    dmaFillConfigure(&fill, sampled_stereo, play_stereo, shift, wrap, volume, order);
 }
 
 int main(void) 
@@ -382,25 +384,12 @@ int main(void)
     pwmChannelInit(&pwm_channel[0], AUDIO_PIN);
     pwmChannelInit(&pwm_channel[1], AUDIO_PIN+1);
 
-    // Get the DMA channels for the chain
-    claimDmaChannels(2);
-
-    // Initialise and Chain the two DMAs together
-    initDma(0, pwmChannelGetSlice(&pwm_channel[0]), 1);
-    initDma(1, pwmChannelGetSlice(&pwm_channel[0]), 0);
+    // Get the DMA channels for the ring, and enable its interrupt
+    dmaRingCreate(&dma_buffers, dma_memory, DMA_MEMORY_LENGTH, pwmChannelGetSlice(&pwm_channel[0]));
+    dmaRefillCreate(&refill, &fill, &rs, populateDirect, nextRamBuffer);
 
     // Set the DMA interrupt handler
     irq_set_exclusive_handler(DMA_IRQ_1, dmaInterruptHandler); 
-
-    // Enable the interrupts for both of the chained dma channels
-    int mask = 0;
-
-    for (int i=0;i<2;++i)
-    {
-        mask |= 0x01 << dma_channel[i];
-    }
-
-    dma_set_irq1_channel_mask_enabled(mask, true);
     irq_set_enabled(DMA_IRQ_1, true);
 
     // Initialise the buttons
@@ -409,20 +398,86 @@ int main(void)
     debounceButtonCreate(&button[2], 22, 40, buttonCallback, true, false);
     debounceButtonCreate(&button[3], 14, 40, buttonCallback, false, true);
 
-    // Create the event queue
-    enum Event event = empty;
-    queue_init(&eventQueue, sizeof(event), 4);
+    // Create the pipeline counters
+    cycleCounterInit();
+    perfStageCreate(&dma_stage, "DMA populate");
+    perfStageCreate(&ram_stage, "RAM populate");
+    perfSlackCreate(&slack_stats[source_noise], "Noise");
+    perfSlackCreate(&slack_stats[source_flash], "Flash");
+    perfSlackCreate(&slack_stats[source_file], "File");
+    perfSlackCreate(&slack_stats[source_signal], "Signal");
+
+    // Create the event rings. Refills of the same buffer are coalesced
+    eventRingCreate(&irq_events, 0x01 << populate_dma);
+    eventRingCreate(&main_events, 0x01 << populate_double);
 
     // Set up noise and flash buffer
     colourNoiseCreate(&cn[0], 0.5);
     colourNoiseSeed(&cn[0], 0);
     colourNoiseCreate(&cn[1], 0.5);
-    colourNoiseSeed(&cn[1], 2^15-1);
+    colourNoiseSeed(&cn[1], 0x7FFF);
+    signalGeneratorCreate(&sg, SIGNAL_RATE);
 #ifdef FLASH    
-    circularBufferCreate(&sb, WAV_DATA, WAV_DATA_LENGTH, flash_shift);
+#ifndef FLASH_HEADER
+    if (!clipBankOpen(&flash_bank, clip_assets))
+    {
+        printf("Built in clip bank does not check\n");
+    }
+#elif defined(ADPCM)
+    clipBankSingle(&flash_bank, &builtin_entry, WAV_DATA, circular_adpcm, WAV_DATA_LENGTH, FLASH_RATE, 4);
+#elif defined(PACKED) && defined(TWELVE_BIT)
+    clipBankSingle(&flash_bank, &builtin_entry, WAV_DATA, circular_u12, WAV_DATA_LENGTH, FLASH_RATE, 12);
+#elif defined(PACKED)
+    clipBankSingle(&flash_bank, &builtin_entry, WAV_DATA, circular_u8, WAV_DATA_LENGTH, FLASH_RATE, 8);
+#elif defined(TWELVE_BIT)
+    clipBankSingle(&flash_bank, &builtin_entry, WAV_DATA, circular_u16, WAV_DATA_LENGTH, FLASH_RATE, 12);
+#else
+    clipBankSingle(&flash_bank, &builtin_entry, WAV_DATA, circular_u16, WAV_DATA_LENGTH, FLASH_RATE, 8);
+#endif
+#ifdef FLASH_BANK
+    // Erased flash, or an image that does not check out, leaves the built in clips
+    clip_bank found;
+
+    if (clipBankOpen(&found, (const uint8_t*)(XIP_BASE + CLIP_BANK_OFFSET)) && found.count)
+    {
+        flash_bank = found;
+    }
+#endif
+    printf("%u flash clips\n", flash_bank.count);
+    if (flash_bank.count)
+    {
+        clipBankCreateBuffer(&flash_bank, 0, &sb);
+    }
 #endif
+#ifdef CORE1_DECODE
+    // Create the block ring, and start core1 waiting for blocks to populate
+    pcmRingCreate(&pcm_blocks, ram_buffer[0], PCM_BLOCKS, (2 * RAM_BUFFER_LENGTH) / PCM_BLOCKS);
+    multicore_launch_core1(core1Entry);
+#else
     // Create the double buffers
     doubleBufferCreate(&double_buffers, ram_buffer[0], ram_buffer[1], RAM_BUFFER_LENGTH);
+#endif
+
+#ifdef BENCHMARK
+    // Time the fill kernels, before the buffers are in use
+    dmaFillBenchmark(dma_memory, DMA_BUFFER_LENGTH, ram_buffer[0], 4091);
+    dmaFillNoiseBenchmark(dma_memory, DMA_BUFFER_LENGTH, ram_buffer[0], PWM_LIMITS.max_wrap);
+    pwmSolverBenchmark(clock_get_hz(clk_sys), &PWM_LIMITS);
+    resamplerBenchmark((int16_t*)dma_memory, DMA_BUFFER_LENGTH, ram_buffer[0], DMA_BUFFER_LENGTH >> 2);
+    colourNoiseBenchmark(ram_buffer[0], RAM_BUFFER_LENGTH >> 1);
+    colourNoiseSpectrumBenchmark((int16_t*)dma_memory, 8192);
+    signalGeneratorBenchmark(ram_buffer[0], RAM_BUFFER_LENGTH >> 1);
+#ifdef FLASH
+    if (flash_bank.count)
+    {
+        circular_buffer clip = sb;
+
+        circularBufferBenchmark(ram_buffer[0], RAM_BUFFER_LENGTH, &sb);
+        circularBufferRead(&clip, ram_buffer[1], RAM_BUFFER_LENGTH);
+        adpcmBenchmark(ram_buffer[0], ram_buffer[1], RAM_BUFFER_LENGTH);
+    }
+#endif
+#endif
 
     // Initialise the file system
     fsInitialise(&mount);
@@ -437,25 +492,52 @@ int main(void)
     // Process events
     while (true)
     {
-        queue_remove_blocking(&eventQueue, &event);
+        event_entry event;
+
+        // Sleep until an interrupt adds an event. Interrupts are disabled
+        // while checking, but an interrupt that becomes pending still wakes the core
+        uint32_t status = save_and_disable_interrupts();
+
+        if (eventRingEmpty(&irq_events) && eventRingEmpty(&main_events))
+        {
+            __wfi();
+        }
+        restore_interrupts(status);
+
+        pollCommand();
+
+        // main_events holds RAM buffer populates, which were requested by earlier DMA populates
+        if (!eventRingRemove(&main_events, &event) && !eventRingRemove(&irq_events, &event))
+        {
+            continue;
+        }
+        uint64_t busy_start = time_us_64();
         
-        switch (event)
+        switch (event.type)
         {
             case increase:
-                volume = fminf(1.0, volume+0.1);
+                volume = (volume + VOLUME_STEP > DMA_FILL_UNITY) ? DMA_FILL_UNITY : volume + VOLUME_STEP;
+                dmaFillSetGain(&fill, volume, dma_buffers.length);
             break;
 
             case decrease:
-                volume = fmaxf(0.0, volume-0.1);
+                volume = (volume > VOLUME_STEP) ? volume - VOLUME_STEP : 0;
+                dmaFillSetGain(&fill, volume, dma_buffers.length);
             break;
 
             case populate_dma:
-                populateDmaBuffer();
+                refillDmaBuffer(&event);
             break;
 
+#ifndef CORE1_DECODE
             case populate_double:
+            {
+                uint32_t start = cycleCounterRead();
                 doubleBufferPopulateNext(&double_buffers);
+                perfStageAdd(&ram_stage, cycleCounterElapsed(start));
+            }
             break;
+#endif
 
             case change:
                 changeState(current_state + 1);
@@ -469,6 +551,7 @@ int main(void)
                 return -1;
             break;
         }
+        busy_us[0] += time_us_64() - busy_start;
     }
     return 0;
 }
@@ -481,10 +564,25 @@ static void changeState(enum sound_state new_state)
         new_state = start;
     }
 
-    // Stop playing if we are, and close the file if it is open
-    if (current_state != off)
+    bool playing = (current_state != off);
+    uint64_t deadline = 0;
+
+    // Stop populating the old source, and close the file if it is open.
+    // The DMA keeps playing what is queued while the new source is opened, so the
+    // switch must be made before deadline. Nothing slow, like printing, is done until then
+    if (playing)
     {
-        stopMusic();
+        // Buffers with a refill event waiting have been played already
+        uint32_t queued = dmaRingQueued(&dma_buffers);
+        uint32_t waiting = eventRingCount(&irq_events) * dma_buffers.length;
+
+        queued = (queued > waiting) ? (queued - waiting) : 0;
+        deadline = time_us_64() + (((uint64_t)queued * 1000000) / carrier_hz);
+
+#ifdef CORE1_DECODE
+        // Core1 must be idle before the source is changed
+        stopDecode();
+#endif
 
         // Close the file, if it was open
         if (isFile(current_state))
@@ -493,6 +591,25 @@ static void changeState(enum sound_state new_state)
         }
     }
 
+#ifdef FLASH
+    // The flash state steps through every clip of the bank before moving on
+    if ((current_state == flash) && (new_state == (flash + 1)) && ((flash_clip + 1) < flash_bank.count))
+    {
+        new_state = flash;
+        flash_clip += 1;
+    }
+    else
+    {
+        flash_clip = 0;
+    }
+
+    // Without any clips the flash state is skipped
+    if ((new_state == flash) && !flash_bank.count)
+    {
+        new_state += 1;
+    }
+#endif
+
     // If moving to file state try to open the file
     if (new_state == file_1)
     {
@@ -532,65 +649,427 @@ static void changeState(enum sound_state new_state)
 
     if (isColour(current_state))
     {
-        sample_rate = SAMPLE_RATE;
+        sample_rate = NOISE_RATE;
         sampled_stereo = true;
+        refill.direct = true;
+        current_source = source_noise;
+        dma_buffer_count = LOW_LATENCY_BUFFERS;
     }
     else if (isFile(current_state))
     {
-        printf("Sample rate is %u\n", mf.sample_rate);
         sample_rate = musicFileGetSampleRate(&mf);
         sampled_stereo = musicFileIsStereo(&mf);
+        refill.direct = false;
+        current_source = source_file;
+        dma_buffer_count = DEEP_BUFFERS;
     }
+    else if (current_state == test_signal)
+    {
+        sample_rate = SIGNAL_RATE;
+        sampled_stereo = true;
+        refill.direct = true;
+        current_source = source_signal;
+        dma_buffer_count = LOW_LATENCY_BUFFERS;
+    }
+#ifdef FLASH
     else // Loaded from flash
     {
-        sample_rate = SAMPLE_RATE;
-        sampled_stereo = false;
+        const clip_bank_entry* clip = clipBankEntry(&flash_bank, flash_clip);
+
+        clipBankCreateBuffer(&flash_bank, flash_clip, &sb);
+        sample_rate = clip->sample_rate;
+        sampled_stereo = (clip->channels == 2);
+        refill.direct = (resample_quality == resample_nearest);
+        current_source = source_flash;
+        dma_buffer_count = LOW_LATENCY_BUFFERS;
+    }
+#endif
+
+    // Switch without a gap if possible, otherwise restart the PWM and DMA. Files need
+    // the deeper ring, which cannot be set up while the DMA runs, so moving to a file
+    // from noise, flash or the test signal always restarts
+    bool direct = refill.direct;
+
+    if (playing && switchMusic(sample_rate, deadline))
+    {
+        // Statistics of the old source, which may include decoding the new one during the switch
+        printStats();
+        resetStats();
+        printSource();
+        return;
+    }
+
+    // A failed switch may have moved the source to the RAM buffers
+    refill.direct = direct;
+
+    if (playing)
+    {
+        stopMusic();
+        printStats();
+    }
+
+    printSource();
+
+    if (!startMusic(sample_rate))
+    {
+        printf("Cannot play at %u Hz\n", sample_rate);
     }
-    startMusic(sample_rate);
 }
 
-void startMusic(uint32_t sample_rate)
+bool startMusic(uint32_t sample_rate)
 {
-    // Empty the message queue, to avoid processing populate messages
-    enum Event skip = empty;
-    while(queue_try_remove(&eventQueue, &skip));
+    // Empty the event rings, to avoid processing populate messages
+    eventRingFlush(&irq_events);
+    eventRingFlush(&main_events);
+
+    pwm_solution sol;
+
+#ifdef CLOCK_SEARCH
+    uint32_t clock_khz;
+
+    // clk_peri follows the system clock, so the SD card SPI would run at a scaled baud
+    if (!fsMounted(&mount) &&
+        pwmSolverPickClock(clock_get_hz(clk_sys) / 1000, sample_rate, &PWM_LIMITS, &clock_khz, &sol) &&
+        ((clock_khz * 1000) != clock_get_hz(clk_sys)))
+    {
+        // UART is clocked from the system clock, so set it up again
+        set_sys_clock_khz(clock_khz, true);
+        stdio_init_all();
+    }
+#endif
+
+    // Solve the PWM settings for the rate. Rates that the PWM cannot
+    // reach are converted to the carrier rate, if the source allows it
+    bool supported = pwmSolverSolve(clock_get_hz(clk_sys), sample_rate, &PWM_LIMITS, &sol);
+
+    if (!supported && (refill.direct || !pwmSolverSolve(clock_get_hz(clk_sys), RESAMPLE_CARRIER_RATE, &PWM_LIMITS, &sol)))
+    {
+        return false;
+    }
+
+    repeat_shift = sol.shift;
+    wrap = sol.wrap;
+    mid_point = wrap >> 1;
+    fraction = pwmSolverDivider(&sol);
+    carrier_hz = sol.carrier_hz;
+    printf("PWM %u Hz, divider %.4f, wrap %u, error %d ppm\n", sol.carrier_hz, fraction, wrap, sol.error_ppm);
 
-    // Reconfigure the PWM for the new wrap and clock
-    getSampleValues(sample_rate, &repeat_shift, &wrap, &mid_point, &fraction);
     pwmChannelReconfigure(&pwm_channel[0], fraction, wrap);
     pwmChannelReconfigure(&pwm_channel[1], fraction, wrap);
 
-    // Reininitialise the double buffers
-    doubleBufferInitialise(&double_buffers, &populateCallback, &current_RAM_Buffer, &current_RAM_length);
+    prepareSource(sample_rate, supported, UINT64_MAX);
+
+    // Split the DMA memory for this source, then populate every DMA buffer
+    dmaRingConfigure(&dma_buffers, dma_buffer_count, DMA_MEMORY_LENGTH / DEEP_BUFFERS);
+    buffer_us = (uint32_t)(((float)dma_buffers.length * fraction * (float)(wrap + 1) * 1000000.0f) / (float)clock_get_hz(clk_sys));
 
-    // reset read position of RAM buffer to start
-    ram_buffer_index = 0;
+    // The first buffer ramps the output up from 0 to mid_point, then
+    // the source fades in from mid_point over one buffer
+    uint32_t ramp = rampWords();
 
-    // Populate the DMA buffers
-    populateDmaBuffer();
-    populateDmaBuffer();
+    dmaFillFadeIn(&fill, volume, dma_buffers.length);
+    dmaFillRamp(dmaRingGetBuffer(&dma_buffers, 0), ramp, 0, mid_point);
+    dmaRefillWords(&refill, dmaRingGetBuffer(&dma_buffers, 0) + ramp, dma_buffers.length - ramp);
+
+    for (uint i=1; i<dma_buffers.count; ++i)
+    {
+        populateDmaBuffer(i);
+    }
 
-    // Start the first DMA channel in the chain and both PWMs
+    // Start the DMA ring and both PWMs, from level 0
     uint32_t pwm_mask = 0;
 
+    pwmChannelSetFirstValue(&pwm_channel[0], 0);
+    pwmChannelSetFirstValue(&pwm_channel[1], 0);
     pwmChannelAddStartList(&pwm_channel[0], &pwm_mask);
     pwmChannelAddStartList(&pwm_channel[1], &pwm_mask);
 
-    // Build the DMA start mask
-    uint32_t chan_mask = 0x01 << dma_channel[0];
-
-    dma_start_channel_mask(chan_mask);
+    dmaRingStart(&dma_buffers);
     pwmChannelStartList(pwm_mask);
+    pwm_running = true;
+
+    resetStats();
+#ifdef CORE1_DECODE
+    if (!refill.direct)
+    {
+        startDecode();
+    }
+#endif
+    return true;
+}
+
+// Switch to a new source without stopping the PWM or DMA. The PWM keeps its rate, so the
+// new source is repeated or resampled to fit it. deadline is when the DMA runs out of queued
+// levels of the old source. Returns false if a restart is needed
+static bool switchMusic(uint32_t sample_rate, uint64_t deadline)
+{
+    pwm_solution sol;
+
+    // A deeper ring cannot be set up while the DMA runs
+    if (dma_buffers.count < dma_buffer_count)
+    {
+        return false;
+    }
+
+    bool exact = pwmSolverSolve(clock_get_hz(clk_sys), sample_rate, &PWM_LIMITS, &sol) &&
+                 (sol.wrap == wrap) && (pwmSolverDivider(&sol) == fraction);
+
+    if (exact)
+    {
+        repeat_shift = sol.shift;
+    }
+    else if (isColour(current_state))
+    {
+        // Noise has no fixed rate, so repeat by whichever shift is closest
+        uint32_t best = UINT32_MAX;
+
+        for (uint shift=0; shift<=DMA_FILL_MAX_SHIFT; ++shift)
+        {
+            uint32_t rate = carrier_hz >> shift;
+            uint32_t error = (rate > sample_rate) ? (rate - sample_rate) : (sample_rate - rate);
+
+            if (error < best)
+            {
+                best = error;
+                repeat_shift = shift;
+            }
+        }
+        exact = true;
+    }
+    else
+    {
+        // Resample to the PWM rate through the RAM buffers
+        refill.direct = false;
+    }
+
+    uint64_t switch_start = time_us_64();
+
+    // Rewriting starts CROSSFADE_GUARD words ahead of the DMA, so must start this long before deadline
+    uint64_t guard_us = ((uint64_t)CROSSFADE_GUARD * 1000000) / carrier_hz;
+
+    // Prebuffer the new source while the DMA plays the old one, for as long as the queue allows
+    eventRingFlush(&main_events);
+    prepareSource(sample_rate, exact, deadline - guard_us);
+
+    if (time_us_64() >= (deadline - guard_us))
+    {
+        printf("Switch ran out of queued levels, restarting\n");
+        return false;
+    }
+
+#ifdef CORE1_DECODE
+    // Core1 refills blocks while the queue is rewritten
+    if (!refill.direct)
+    {
+        startDecode();
+    }
+#endif
+
+    // Rewrite everything that is queued, without interrupts refilling buffers
+    irq_set_enabled(DMA_IRQ_1, false);
+    eventRingFlush(&irq_events);
+
+    uint index;
+    uint offset;
+    uint32_t remaining = dmaRingReclaim(&dma_buffers, CROSSFADE_GUARD, &index, &offset);
+    uint64_t reclaimed = time_us_64();
+    uint32_t fade = crossfadeWords();
+    int32_t gain = 0;
+    int32_t step = DMA_FILL_UNITY / fade;
+    uint32_t written = 0;
+    bool behind = false;
+
+    // Rewrite a chunk at a time from just ahead of the DMA, so the crossfade is in place first.
+    // Each chunk must be complete before the DMA, which starts at least CROSSFADE_GUARD words
+    // back, reaches it
+    while (remaining && !behind)
+    {
+        uint32_t* dest = dmaRingGetBuffer(&dma_buffers, index) + offset;
+        uint32_t words = dma_buffers.length - offset;
+
+        words = (words < SWITCH_CHUNK) ? words : SWITCH_CHUNK;
+
+        // Keep the old levels that are faded out, then crossfade to the new source
+        uint32_t mix = (fade < words) ? fade : words;
+
+        for (uint32_t i=0; i<mix; ++i)
+        {
+            crossfade_buffer[i] = dest[i];
+        }
+        dmaRefillWords(&refill, dest, words);
+        dmaFillCrossfade(dest, crossfade_buffer, mix, &gain, step);
+
+        // Most words the DMA can have played since the queue was reclaimed
+        uint64_t played = (((time_us_64() - reclaimed) + 1) * carrier_hz) / 1000000;
+
+        behind = (played >= (CROSSFADE_GUARD + written));
+        fade -= mix;
+        written += words;
+        remaining -= words;
+        offset += words;
+
+        if (offset == dma_buffers.length)
+        {
+            offset = 0;
+            index = dmaRingNext(&dma_buffers, index);
+        }
+    }
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    if (behind)
+    {
+        // The DMA has played part of a chunk before it was written
+        printf("Switch fell behind the DMA, restarting\n");
+        return false;
+    }
+
+    printf("Switched in %uus\n", (uint)(time_us_64() - switch_start));
+    return true;
+}
+
+// Number of words in a crossfade at the current PWM rate
+static uint32_t crossfadeWords(void)
+{
+    uint32_t fade = (uint32_t)(((uint64_t)carrier_hz * CROSSFADE_US) / 1000000);
+
+    return (fade > CROSSFADE_MAX_WORDS) ? CROSSFADE_MAX_WORDS : ((fade < 1) ? 1 : fade);
+}
+
+// Number of words in the start and stop ramps, which fit in one DMA buffer
+static uint32_t rampWords(void)
+{
+    uint32_t ramp = (RAMP_PERIODS + DMA_RING_LENGTH_ALIGN - 1) & ~(DMA_RING_LENGTH_ALIGN - 1);
+
+    return (ramp > (dma_buffers.length >> 1)) ? (dma_buffers.length >> 1) : ramp;
+}
+
+// Rewrite everything queued ahead of the DMA to fade the source out to mid_point, ramp
+// down to 0 and then hold 0. Returns once the DMA has played the ramp
+static void fadeOut(void)
+{
+    irq_set_enabled(DMA_IRQ_1, false);
+    eventRingFlush(&irq_events);
+
+    uint index;
+    uint offset;
+    uint32_t remaining = dmaRingReclaim(&dma_buffers, CROSSFADE_GUARD, &index, &offset);
+    uint32_t ramp = rampWords();
+    uint32_t fade = crossfadeWords();
+    int32_t gain = 0;
+
+    // Fade and ramp must not straddle buffers, so start at the next buffer if need be
+    fade = ((fade + ramp) > dma_buffers.length) ? (dma_buffers.length - ramp) : fade;
+
+    if ((dma_buffers.length - offset) < (fade + ramp))
+    {
+        remaining -= dma_buffers.length - offset;
+        index = dmaRingNext(&dma_buffers, index);
+        offset = 0;
+    }
+
+    uint32_t* dest = dmaRingGetBuffer(&dma_buffers, index) + offset;
+
+    for (uint32_t i=0; i<fade; ++i)
+    {
+        crossfade_buffer[i] = dest[i];
+    }
+    dmaFillRamp(dest, fade, mid_point, mid_point);
+    dmaFillCrossfade(dest, crossfade_buffer, fade, &gain, DMA_FILL_UNITY / fade);
+    dmaFillRamp(dest + fade, ramp, mid_point, 0);
+
+    // Hold 0 for everything after the ramp
+    dmaFillRamp(dest + fade + ramp, dma_buffers.length - offset - fade - ramp, 0, 0);
+    remaining -= dma_buffers.length - offset;
+
+    while (remaining)
+    {
+        index = dmaRingNext(&dma_buffers, index);
+        dmaFillRamp(dmaRingGetBuffer(&dma_buffers, index), dma_buffers.length, 0, 0);
+        remaining -= dma_buffers.length;
+    }
+
+    // Wait for the longest the DMA can take to reach the end of the ramp
+    uint32_t words = CROSSFADE_GUARD + DMA_RING_LENGTH_ALIGN + dma_buffers.length + fade + ramp;
+
+    sleep_us(((uint64_t)words * 1000000) / carrier_hz);
+}
+
+// Set up the fill, resampler and RAM buffers for the current source. exact is true
+// if the PWM rate is the sample rate repeated (1 << repeat_shift) times. Prebuffering
+// stops at deadline, after at least one block
+static void prepareSource(uint32_t sample_rate, bool exact, uint64_t deadline)
+{
+    oversampled = (carrier_hz >= (sample_rate << 1));
+
+    // Interpolate rather than repeat, unless repeating gives the selected quality
+    refill.resampling = !refill.direct && (!exact || (resample_quality != resample_nearest));
+
+    if (refill.resampling)
+    {
+        resamplerCreate(&rs, resample_quality, sample_rate, carrier_hz, sampled_stereo ? 2 : 1);
+    }
+
+    // Select the fill kernel once, for this source and rate
+    configureFill();
+
+    if (!refill.direct)
+    {
+#ifdef CORE1_DECODE
+        // Prebuffer blocks before core1 takes over
+        pcmRingInitialise(&pcm_blocks, &populateCallback);
+        while (pcmRingPopulateNext(&pcm_blocks) && (time_us_64() < deadline));
+
+        refill.ram_buffer = 0;
+        dmaRefillNextBuffer(&refill);
+#else
+        // Reininitialise the double buffers
+        doubleBufferInitialise(&double_buffers, &populateCallback, &refill.ram_buffer, &refill.ram_length);
+
+        // reset read position of RAM buffer to start
+        refill.ram_frame = 0;
+#endif
+    }
 }
 
 void stopMusic(void)
 {
+#ifdef CORE1_DECODE
+    // Core1 must be idle before the source is changed
+    stopDecode();
+#endif
+
+    // Ramp the output down to 0, so stopping does not click
+    if (pwm_running)
+    {
+        fadeOut();
+    }
+
     // Disable DMAs and PWMs
     pwmChannelStop(&pwm_channel[0]);
     pwmChannelStop(&pwm_channel[1]);
 
-    dma_channel_abort(dma_channel[0]);
-    dma_channel_abort(dma_channel[1]);
+    dmaRingStop(&dma_buffers);
+    irq_set_enabled(DMA_IRQ_1, true);
+    pwm_running = false;
+}
+
+// Report the source that is about to play
+static void printSource(void)
+{
+    if (isFile(current_state))
+    {
+        printf("Sample rate is %u\n", mf.sample_rate);
+    }
+    else if (current_state == test_signal)
+    {
+        printf("Test signal %s\n", signalGeneratorName(sg.type));
+    }
+#ifdef FLASH
+    else if (current_state == flash)
+    {
+        printf("Flash clip %u %s\n", flash_clip, clipBankEntry(&flash_bank, flash_clip)->name);
+    }
+#endif
 }
 
 void exitMusic(void)
@@ -603,55 +1082,280 @@ void exitMusic(void)
 
 
 // Write 16 bit stereo sound data to to the supplied buffer
-// callback function called from circular buffer class
+// callback function called from the double buffer class
 // len is max number of 16 bit samples to copy
 // Returns the number of 16 bit samples actually copied
 uint32_t populateCallback(int16_t* buffer, uint32_t len)
 {
-    uint32_t written = len;
+    uint32_t written = 0;
 
+    if (isFile(current_state))
+    {
+        musicFileRead(&mf, buffer, len, &written);
+    }
+#ifdef FLASH
+    else if (current_state == flash)
+    {
+        // Flash only uses the RAM buffers when it is resampled
+        circularBufferRead(&sb, buffer, len);
+        written = len;
+    }
+#endif
+    else if (current_state == test_signal)
+    {
+        // Test signals only use the RAM buffers when they are resampled
+        generateSynthetic(buffer, len >> 1);
+        written = len & ~1;
+    }
+    return written;
+}
+
+// Write PWM levels for the noise and flash sources straight to a DMA buffer
+// frames is the number of frames to generate, each is repeated to match the PWM rate
+static void populateDirect(uint32_t* buffer, uint32_t frames)
+{
     switch (current_state)
     {
         case white:
-            for (int i=0;i<len;i+=2)
-            {
-                // Divide the output by 2, to make similar volume to other colours
-                buffer[i] = (int16_t)(colourNoiseWhite(&cn[0]) * (MID_VALUE >> 1));
-                buffer[i+1] = (uint16_t)(colourNoiseWhite(&cn[1]) * (MID_VALUE >> 1));
-            }
+        case pink:
+        case brown:
+        case test_signal:
+            dmaRefillGenerated(&fill, buffer, frames, generateSynthetic);
+        break;
+
+#ifdef FLASH
+        case flash:
+            circularBufferReadDma(&sb, buffer, frames, &fill);
+        break;
+#endif    
+        default:
+        break;
+    }
+}
+
+// Generate frames of stereo from the current noise colour or test signal
+static void generateSynthetic(int16_t* dest, uint32_t frames)
+{
+    switch (current_state)
+    {
+        case white:
+            colourNoiseWhiteBlock(cn, dest, frames, 2);
         break;
 
         case pink:
-            for (int i=0;i<len;i+=2)
-            {
-                buffer[i] = (int16_t)(colourNoisePink(&cn[0]) * MID_VALUE);
-                buffer[i+1] = (int16_t)(colourNoisePink(&cn[1]) * MID_VALUE);
-            }
+            colourNoisePinkBlock(cn, dest, frames, 2);
         break;
 
         case brown:
-            for (int i=0;i<len;i+=2)
-            {
-                buffer[i] = (int16_t)(colourNoiseBrown(&cn[0]) * MID_VALUE);
-                buffer[i+1] = (int16_t)(colourNoiseBrown(&cn[1]) * MID_VALUE);
-            }
+            colourNoiseBrownBlock(cn, dest, frames, 2);
         break;
 
-#ifdef FLASH
-        case flash:
-            circularBufferRead(&sb, buffer, len);
+        case test_signal:
+            signalGeneratorBlock(&sg, dest, frames, 2);
         break;
-#endif    
+
         default:
-            if (isFile(current_state))
+        break;
+    }
+}
+
+// Read the time a core has spent working. Core1 can add to its count between the
+// two halves of a 64 bit read, so read until two reads agree
+static uint64_t busyRead(uint core)
+{
+    uint64_t busy;
+
+    do
+    {
+        busy = busy_us[core];
+    } while (busy != busy_us[core]);
+
+    return busy;
+}
+
+// Clear the underrun and utilisation counters
+static void resetStats(void)
+{
+    busy_reset_us[0] = busyRead(0);
+    busy_reset_us[1] = busyRead(1);
+#ifdef CORE1_DECODE
+    underruns = 0;
+#endif
+    eventRingResetStats(&irq_events);
+    eventRingResetStats(&main_events);
+    perfStageReset(&dma_stage);
+#ifdef CORE1_DECODE
+    // Core1 adds to ram_stage, so it is only reset while core1 is idle
+    bool decoding = pauseDecode();
+#endif
+    perfStageReset(&ram_stage);
+#ifdef CORE1_DECODE
+    if (decoding)
+    {
+        startDecode();
+    }
+#endif
+
+    for (int i=0; i<source_types; ++i)
+    {
+        perfSlackReset(&slack_stats[i]);
+    }
+    dma_buffers.late_irqs = 0;
+    load_start_us = time_us_64();
+}
+
+// Report the underrun and utilisation counters for the last source
+static void printStats(void)
+{
+    uint64_t elapsed = time_us_64() - load_start_us;
+
+    if (elapsed)
+    {
+        printf("Core0 load %u%% Core1 load %u%%\n", (uint)(((busyRead(0) - busy_reset_us[0]) * 100) / elapsed),
+               (uint)(((busyRead(1) - busy_reset_us[1]) * 100) / elapsed));
+    }
+#ifdef CORE1_DECODE
+    printf("Underruns %u\n", (uint)underruns);
+#endif
+    printf("IRQ events dropped %u coalesced %u high water %u\n", (uint)irq_events.drops, (uint)irq_events.coalesced, (uint)irq_events.high_water);
+    printf("Main events dropped %u coalesced %u high water %u\n", (uint)main_events.drops, (uint)main_events.coalesced, (uint)main_events.high_water);
+
+    printf("DMA buffers %u of %uus, late IRQs %u\n", dma_buffers.count, (uint)buffer_us, (uint)dma_buffers.late_irqs);
+    perfStagePrint(&dma_stage);
+#ifdef CORE1_DECODE
+    // Copy ram_stage while core1 is idle, so the UART is not waited for with core1 stopped
+    bool decoding = pauseDecode();
+#endif
+    perf_stage ram = ram_stage;
+#ifdef CORE1_DECODE
+    if (decoding)
+    {
+        startDecode();
+    }
+#endif
+    perfStagePrint(&ram);
+
+    for (int i=0; i<source_types; ++i)
+    {
+        perfSlackPrint(&slack_stats[i]);
+    }
+}
+
+// Handle commands from the UART, s reports the counters, r resets them
+// 0, 1 and 2 select the resampling quality used from the next source change
+// n steps through the noise shaping orders, t steps through the test signals
+static void pollCommand(void)
+{
+    int c = getchar_timeout_us(0);
+
+    if (c == 's')
+    {
+        printStats();
+    }
+    else if (c == 'r')
+    {
+        resetStats();
+    }
+    else if ((c >= '0') && (c < '0' + resample_qualities))
+    {
+        resample_quality = c - '0';
+        printf("Resample quality %s\n", resamplerQualityName(resample_quality));
+    }
+    else if (c == 'n')
+    {
+        noise_shaping = (noise_shaping + 1) % (DMA_FILL_MAX_ORDER + 1);
+        printf("Noise shaping order %u%s\n", noise_shaping, oversampled ? "" : ", unused until oversampled");
+        dmaFillSetOrder(&fill, oversampled ? noise_shaping : 0);
+    }
+    else if (c == 't')
+    {
+#ifdef CORE1_DECODE
+        // A resampled test signal is generated by core1, so it is changed between blocks
+        bool decoding = pauseDecode();
+#endif
+        signalGeneratorSelect(&sg, (sg.type + 1) % signal_types);
+#ifdef CORE1_DECODE
+        if (decoding)
+        {
+            startDecode();
+        }
+#endif
+        printf("Test signal %s\n", signalGeneratorName(sg.type));
+    }
+}
+
+#ifdef CORE1_DECODE
+// Core1 populates blocks whenever the ring has space
+static void core1Entry(void)
+{
+    // Each core has its own SysTick
+    cycleCounterInit();
+
+    while (true)
+    {
+        // Read before decode_run, which core0 clears before counting a stop
+        uint32_t stops = decode_stops;
+
+        if (decode_run)
+        {
+            uint64_t busy_start = time_us_64();
+            uint32_t start = cycleCounterRead();
+
+            if (pcmRingPopulateNext(&pcm_blocks))
             {
-                musicFileRead(&mf, buffer, len, &written);
+                perfStageAdd(&ram_stage, cycleCounterElapsed(start));
+                busy_us[1] += time_us_64() - busy_start;
             }
-        break;
+            else
+            {
+                // Ring full, wait for core0 to release a block
+                __wfe();
+            }
+        }
+        else
+        {
+            // Every stop up to stops has been seen
+            decode_idle = stops;
+            __wfe();
+        }
     }
-    return written;
 }
 
+// Allow core1 to populate blocks
+static void startDecode(void)
+{
+    decode_run = true;
+    __sev();
+}
+
+// Wait for core1 to finish the block it is populating. Core1 only reports this stop once
+// it has seen decode_run cleared, so an idle report from before the last start is ignored
+static void stopDecode(void)
+{
+    decode_run = false;
+    decode_stops = decode_stops + 1;
+    __sev();
+
+    while (decode_idle != decode_stops)
+    {
+        tight_loop_contents();
+    }
+}
+
+// Stop core1 if it is populating, so core0 can change what core1 uses
+// Returns true if core1 was populating, and should be started again afterwards
+static bool pauseDecode(void)
+{
+    bool running = decode_run;
+
+    if (running)
+    {
+        stopDecode();
+    }
+    return running;
+}
+#endif
+
 static bool loadFile(const char* filename)
 {
     bool success = false;
@@ -693,6 +1397,6 @@ void buttonCallback(uint gpio_number, enum debounce_event event)
             e = quit;
         break;
     }
-    queue_try_add(&eventQueue, &e);
+    eventRingAdd(&irq_events, e, 0);
 }
 
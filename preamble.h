@@ -1,6609 +0,0 @@
-/*    File sample.wav
- *    Sample rate 11000 Hz
- */
-#define TWELVE_BIT 
-#define SAMPLE_RATE 11000 
-#define WAV_DATA_LENGTH 105590 
-
-const uint16_t WAV_DATA[] = {
-    1792,1791,1789,1793,1794,1796,1798,1797,1793,1791,1793,1788,1779,1781,1780,1779,
-    1775,1775,1778,1777,1773,1772,1771,1770,1772,1774,1775,1775,1773,1771,1770,1773,
-    1776,1777,1780,1784,1785,1784,1781,1787,1788,1789,1789,1788,1789,1790,1790,1790,
-    1793,1794,1792,1796,1795,1792,1795,1799,1803,1802,1805,1803,1802,1799,1797,1794,
-    1792,1796,1796,1797,1800,1801,1797,1793,1791,1787,1787,1785,1781,1780,1778,1778,
-    1780,1780,1777,1775,1776,1782,1781,1783,1784,1779,1776,1780,1780,1774,1771,1771,
-    1774,1777,1776,1771,1772,1775,1774,1776,1782,1784,1787,1785,1784,1785,1785,1783,
-    1782,1784,1786,1786,1783,1782,1788,1792,1791,1794,1796,1799,1802,1804,1806,1803,
-    1804,1800,1791,1792,1792,1791,1786,1788,1789,1786,1783,1774,1776,1776,1777,1780,
-    1778,1776,1777,1777,1774,1772,1770,1769,1766,1766,1769,1772,1777,1782,1784,1783,
-    1783,1781,1780,1780,1785,1787,1794,1798,1797,1797,1798,1799,1798,1799,1796,1794,
-    1792,1791,1788,1787,1790,1792,1793,1791,1788,1786,1782,1781,1780,1783,1788,1789,
-    1791,1793,1798,1801,1802,1800,1794,1796,1797,1795,1792,1790,1789,1786,1784,1786,
-    1791,1785,1779,1775,1773,1775,1778,1777,1778,1786,1789,1788,1784,1783,1787,1789,
-    1794,1794,1799,1804,1808,1807,1806,1804,1801,1799,1796,1797,1802,1804,1803,1801,
-    1798,1796,1792,1795,1794,1795,1791,1784,1784,1783,1778,1772,1775,1773,1775,1777,
-    1776,1778,1777,1774,1774,1775,1778,1783,1785,1788,1791,1792,1789,1789,1794,1802,
-    1804,1801,1802,1803,1802,1797,1792,1787,1786,1788,1786,1783,1786,1794,1794,1791,
-    1788,1784,1781,1776,1776,1778,1779,1781,1780,1780,1779,1777,1777,1780,1783,1782,
-    1784,1780,1778,1783,1781,1775,1771,1772,1776,1778,1778,1776,1777,1777,1777,1778,
-    1780,1782,1782,1785,1784,1786,1788,1792,1790,1790,1793,1793,1791,1787,1788,1788,
-    1787,1785,1787,1793,1794,1797,1797,1792,1792,1788,1790,1793,1793,1792,1793,1794,
-    1791,1787,1787,1788,1780,1780,1782,1777,1776,1778,1779,1782,1785,1786,1787,1784,
-    1778,1774,1771,1766,1765,1762,1761,1766,1772,1775,1770,1772,1774,1775,1774,1783,
-    1787,1786,1787,1781,1782,1782,1785,1786,1783,1784,1789,1795,1797,1798,1797,1792,
-    1793,1796,1800,1797,1795,1793,1794,1795,1797,1803,1805,1807,1800,1798,1795,1794,
-    1792,1791,1792,1790,1792,1794,1793,1794,1797,1798,1792,1793,1793,1790,1791,1786,
-    1784,1781,1780,1777,1775,1772,1768,1769,1773,1771,1771,1771,1775,1771,1773,1776,
-    1775,1781,1779,1776,1779,1784,1778,1777,1781,1782,1780,1781,1784,1790,1792,1791,
-    1791,1794,1796,1797,1799,1798,1798,1796,1798,1801,1799,1802,1805,1802,1797,1795,
-    1791,1788,1786,1790,1791,1785,1788,1785,1785,1787,1787,1786,1785,1790,1791,1796,
-    1793,1786,1788,1784,1777,1774,1774,1772,1771,1774,1774,1776,1776,1776,1775,1777,
-    1777,1778,1781,1777,1776,1775,1775,1778,1783,1785,1789,1791,1792,1789,1788,1790,
-    1790,1791,1791,1793,1788,1783,1787,1791,1787,1787,1786,1788,1790,1788,1783,1779,
-    1776,1778,1774,1771,1773,1770,1772,1777,1781,1781,1782,1784,1779,1777,1777,1779,
-    1783,1784,1781,1782,1785,1785,1785,1784,1786,1787,1786,1784,1785,1783,1779,1781,
-    1784,1788,1792,1793,1796,1799,1798,1798,1789,1783,1785,1786,1787,1788,1787,1783,
-    1780,1779,1775,1778,1778,1781,1787,1786,1784,1786,1780,1774,1778,1783,1784,1788,
-    1788,1788,1789,1784,1782,1779,1785,1784,1785,1792,1793,1793,1791,1791,1787,1787,
-    1788,1789,1788,1787,1783,1780,1780,1785,1784,1787,1792,1792,1790,1787,1787,1785,
-    1782,1780,1778,1779,1779,1780,1782,1786,1788,1785,1784,1789,1793,1794,1794,1790,
-    1791,1792,1794,1789,1787,1791,1798,1800,1792,1792,1795,1803,1799,1795,1792,1790,
-    1787,1789,1792,1791,1798,1802,1805,1800,1795,1794,1792,1797,1796,1796,1795,1795,
-    1795,1788,1790,1792,1786,1782,1785,1784,1783,1783,1779,1776,1775,1773,1771,1772,
-    1774,1774,1774,1777,1777,1777,1774,1775,1780,1786,1786,1780,1781,1780,1778,1778,
-    1778,1779,1774,1774,1774,1775,1777,1774,1772,1776,1780,1777,1779,1784,1781,1781,
-    1784,1786,1786,1786,1789,1796,1795,1790,1793,1795,1797,1799,1798,1798,1792,1789,
-    1786,1781,1784,1779,1774,1775,1778,1775,1771,1768,1768,1773,1776,1773,1773,1776,
-    1778,1780,1778,1783,1787,1790,1790,1788,1794,1799,1798,1801,1807,1806,1803,1801,
-    1799,1797,1797,1793,1790,1791,1795,1797,1796,1796,1797,1795,1790,1786,1790,1790,
-    1789,1794,1793,1796,1793,1787,1787,1785,1779,1780,1783,1784,1780,1775,1770,1773,
-    1779,1781,1783,1783,1779,1776,1774,1768,1769,1772,1779,1780,1777,1776,1775,1780,
-    1779,1778,1782,1780,1780,1784,1788,1788,1783,1784,1781,1780,1781,1783,1786,1787,
-    1784,1781,1782,1784,1789,1794,1790,1792,1794,1796,1798,1799,1801,1801,1800,1801,
-    1801,1800,1799,1799,1798,1799,1798,1794,1792,1793,1794,1788,1785,1782,1780,1781,
-    1784,1785,1787,1787,1790,1788,1789,1792,1787,1785,1788,1791,1785,1785,1782,1779,
-    1776,1774,1778,1780,1777,1778,1781,1782,1783,1786,1785,1788,1793,1793,1790,1786,
-    1788,1789,1786,1786,1789,1791,1791,1791,1792,1792,1797,1794,1791,1793,1797,1798,
-    1795,1794,1797,1794,1797,1796,1789,1790,1793,1795,1796,1792,1787,1788,1786,1783,
-    1784,1782,1783,1786,1785,1790,1790,1780,1776,1778,1779,1778,1777,1787,1788,1784,
-    1784,1784,1787,1784,1782,1783,1787,1787,1788,1787,1792,1794,1793,1788,1785,1785,
-    1785,1787,1782,1780,1786,1787,1788,1789,1785,1778,1779,1780,1781,1787,1784,1784,
-    1783,1787,1786,1785,1787,1788,1786,1782,1783,1782,1782,1787,1788,1783,1780,1776,
-    1773,1779,1780,1776,1771,1768,1770,1770,1774,1775,1778,1781,1780,1779,1778,1776,
-    1774,1775,1780,1782,1789,1787,1785,1784,1779,1781,1778,1779,1782,1781,1778,1779,
-    1777,1775,1778,1775,1773,1780,1782,1780,1781,1786,1786,1787,1787,1782,1782,1778,
-    1775,1775,1779,1774,1777,1778,1777,1775,1774,1775,1776,1782,1786,1793,1794,1792,
-    1792,1793,1793,1794,1793,1791,1791,1792,1789,1785,1786,1788,1791,1788,1789,1790,
-    1791,1793,1792,1792,1788,1786,1784,1786,1788,1789,1790,1792,1795,1791,1795,1796,
-    1795,1793,1794,1796,1794,1795,1793,1791,1789,1785,1785,1781,1778,1780,1779,1781,
-    1780,1776,1778,1779,1778,1777,1782,1786,1788,1790,1789,1786,1781,1783,1787,1786,
-    1786,1789,1785,1783,1782,1777,1782,1783,1784,1786,1790,1789,1785,1787,1789,1790,
-    1791,1791,1787,1787,1788,1789,1793,1791,1790,1790,1788,1788,1785,1785,1786,1786,
-    1788,1790,1794,1794,1795,1793,1788,1782,1778,1779,1781,1783,1782,1780,1781,1781,
-    1782,1783,1783,1781,1777,1780,1785,1783,1781,1787,1794,1795,1791,1790,1788,1783,
-    1783,1784,1782,1784,1788,1788,1783,1781,1782,1779,1779,1774,1775,1781,1782,1781,
-    1781,1783,1788,1788,1789,1790,1793,1798,1797,1792,1789,1790,1786,1782,1778,1778,
-    1778,1778,1780,1778,1778,1783,1787,1787,1792,1793,1792,1794,1792,1794,1798,1794,
-    1793,1791,1796,1800,1796,1791,1781,1778,1779,1781,1782,1783,1784,1786,1787,1785,
-    1785,1792,1795,1797,1796,1799,1795,1788,1785,1783,1784,1786,1789,1790,1794,1794,
-    1790,1784,1785,1781,1777,1778,1781,1784,1787,1785,1785,1789,1787,1783,1782,1782,
-    1781,1782,1781,1782,1784,1784,1786,1791,1795,1794,1793,1791,1786,1789,1785,1778,
-    1781,1786,1787,1788,1791,1789,1786,1784,1786,1784,1783,1787,1785,1786,1790,1787,
-    1790,1789,1788,1791,1792,1789,1793,1799,1797,1799,1801,1800,1798,1794,1790,1793,
-    1788,1785,1788,1784,1783,1781,1781,1782,1782,1784,1781,1781,1779,1779,1779,1780,
-    1782,1778,1783,1786,1787,1790,1788,1788,1787,1781,1780,1781,1787,1789,1792,1792,
-    1792,1791,1788,1790,1793,1796,1794,1797,1798,1796,1790,1789,1784,1782,1782,1779,
-    1777,1779,1780,1781,1783,1785,1787,1788,1787,1788,1790,1789,1788,1783,1789,1787,
-    1788,1788,1788,1789,1787,1791,1791,1785,1782,1782,1781,1779,1777,1783,1782,1782,
-    1778,1780,1781,1780,1784,1783,1783,1783,1783,1783,1782,1780,1783,1784,1782,1785,
-    1786,1785,1784,1786,1788,1786,1788,1789,1790,1791,1793,1792,1789,1787,1786,1787,
-    1785,1784,1787,1793,1790,1786,1788,1790,1792,1793,1790,1786,1785,1787,1788,1790,
-    1791,1793,1790,1787,1784,1788,1793,1792,1789,1785,1788,1786,1792,1795,1793,1793,
-    1791,1785,1782,1783,1785,1788,1785,1787,1785,1784,1784,1780,1777,1778,1783,1781,
-    1781,1780,1783,1786,1786,1790,1790,1787,1792,1794,1790,1790,1796,1798,1794,1792,
-    1793,1790,1787,1782,1784,1785,1778,1778,1780,1782,1783,1783,1785,1788,1784,1778,
-    1777,1778,1777,1778,1778,1779,1780,1778,1776,1779,1783,1789,1789,1787,1784,1784,
-    1782,1783,1784,1782,1787,1788,1787,1783,1780,1781,1786,1784,1789,1790,1791,1790,
-    1788,1786,1784,1781,1783,1784,1783,1785,1783,1781,1779,1783,1784,1788,1789,1791,
-    1789,1789,1789,1791,1793,1790,1790,1784,1787,1787,1786,1784,1781,1777,1773,1774,
-    1774,1781,1787,1786,1788,1793,1792,1793,1793,1789,1786,1786,1786,1787,1786,1784,
-    1787,1784,1783,1781,1782,1782,1778,1780,1782,1782,1783,1789,1790,1791,1791,1792,
-    1790,1790,1790,1787,1786,1785,1788,1789,1788,1784,1784,1786,1784,1780,1782,1784,
-    1786,1789,1792,1792,1792,1788,1787,1786,1785,1783,1783,1788,1789,1792,1790,1787,
-    1790,1791,1788,1784,1787,1788,1788,1787,1786,1786,1781,1775,1776,1776,1778,1779,
-    1778,1781,1779,1780,1779,1778,1781,1782,1784,1778,1777,1776,1776,1774,1776,1776,
-    1779,1781,1775,1774,1772,1774,1777,1783,1788,1790,1788,1785,1783,1786,1788,1791,
-    1786,1785,1793,1796,1797,1798,1798,1794,1794,1789,1788,1792,1791,1794,1791,1786,
-    1788,1790,1786,1782,1776,1774,1775,1776,1776,1775,1779,1778,1781,1783,1782,1782,
-    1785,1786,1787,1788,1788,1792,1792,1790,1786,1782,1782,1785,1790,1787,1788,1793,
-    1791,1796,1798,1796,1793,1791,1793,1788,1788,1785,1781,1782,1785,1788,1788,1789,
-    1789,1789,1790,1788,1785,1785,1788,1791,1788,1782,1775,1774,1773,1772,1775,1777,
-    1778,1778,1778,1779,1776,1777,1775,1776,1780,1782,1784,1781,1777,1779,1778,1779,
-    1783,1786,1792,1792,1800,1803,1801,1800,1804,1804,1802,1802,1798,1795,1788,1783,
-    1781,1782,1781,1779,1781,1784,1784,1787,1786,1784,1783,1789,1789,1787,1785,1782,
-    1784,1783,1782,1781,1782,1784,1784,1785,1788,1787,1788,1786,1789,1790,1783,1780,
-    1780,1781,1780,1777,1782,1785,1785,1786,1782,1778,1774,1773,1769,1772,1773,1775,
-    1776,1780,1782,1788,1796,1801,1802,1799,1803,1800,1795,1788,1791,1789,1791,1787,
-    1786,1787,1781,1781,1789,1793,1791,1794,1795,1800,1800,1796,1792,1793,1795,1798,
-    1791,1788,1791,1792,1792,1786,1781,1787,1785,1782,1786,1783,1783,1784,1783,1782,
-    1788,1788,1789,1788,1787,1783,1783,1785,1783,1787,1787,1788,1790,1790,1790,1790,
-    1794,1793,1794,1800,1800,1800,1799,1797,1793,1792,1789,1787,1794,1794,1794,1791,
-    1791,1788,1781,1782,1780,1781,1784,1780,1779,1785,1786,1785,1782,1785,1783,1776,
-    1773,1777,1776,1768,1768,1768,1769,1770,1771,1772,1773,1775,1773,1777,1784,1788,
-    1791,1794,1799,1797,1796,1791,1793,1794,1791,1798,1803,1802,1804,1800,1797,1797,
-    1801,1804,1800,1799,1794,1793,1790,1785,1783,1785,1789,1789,1790,1787,1788,1784,
-    1777,1781,1783,1783,1781,1781,1776,1774,1772,1769,1769,1770,1772,1772,1776,1777,
-    1777,1775,1772,1770,1769,1769,1775,1777,1775,1777,1778,1778,1778,1781,1782,1786,
-    1787,1787,1787,1788,1786,1786,1785,1782,1783,1785,1785,1788,1787,1787,1789,1790,
-    1789,1786,1789,1790,1786,1787,1787,1786,1785,1782,1781,1779,1779,1778,1779,1779,
-    1779,1778,1775,1777,1780,1785,1789,1792,1796,1794,1793,1795,1800,1805,1804,1795,
-    1794,1794,1792,1795,1793,1792,1790,1788,1789,1796,1796,1795,1794,1794,1793,1790,
-    1788,1786,1785,1785,1782,1784,1785,1784,1783,1781,1779,1783,1786,1786,1787,1790,
-    1794,1791,1791,1789,1784,1781,1784,1785,1784,1784,1789,1791,1791,1794,1797,1797,
-    1795,1796,1790,1792,1793,1793,1793,1793,1799,1798,1802,1806,1804,1802,1800,1800,
-    1797,1795,1792,1786,1781,1782,1784,1781,1782,1783,1780,1778,1775,1774,1778,1779,
-    1778,1776,1776,1778,1777,1776,1776,1774,1776,1784,1786,1790,1791,1790,1786,1786,
-    1794,1794,1795,1793,1792,1790,1786,1782,1779,1781,1784,1783,1785,1783,1780,1782,
-    1777,1773,1778,1783,1783,1783,1786,1787,1786,1783,1778,1779,1783,1786,1786,1791,
-    1796,1804,1805,1799,1795,1793,1795,1796,1795,1795,1797,1797,1796,1796,1795,1792,
-    1788,1784,1782,1779,1782,1782,1784,1781,1774,1773,1770,1768,1771,1776,1779,1775,
-    1773,1773,1773,1770,1767,1772,1774,1783,1781,1776,1781,1784,1784,1784,1788,1786,
-    1787,1791,1790,1789,1788,1788,1786,1786,1785,1783,1784,1786,1787,1786,1787,1787,
-    1789,1790,1790,1784,1782,1785,1785,1785,1779,1784,1784,1779,1776,1779,1786,1785,
-    1785,1782,1784,1785,1781,1781,1787,1790,1787,1789,1794,1796,1795,1791,1794,1800,
-    1803,1799,1797,1796,1794,1790,1787,1793,1797,1794,1788,1787,1788,1787,1789,1785,
-    1786,1789,1786,1781,1778,1782,1781,1775,1774,1781,1777,1777,1779,1780,1783,1781,
-    1777,1776,1774,1769,1768,1771,1777,1780,1783,1778,1779,1781,1784,1787,1788,1790,
-    1793,1790,1787,1789,1789,1790,1788,1794,1802,1800,1800,1795,1798,1799,1794,1796,
-    1792,1792,1790,1790,1789,1787,1785,1783,1780,1774,1773,1774,1780,1782,1782,1778,
-    1777,1776,1776,1778,1781,1782,1776,1774,1773,1779,1779,1776,1776,1777,1779,1780,
-    1784,1784,1787,1789,1787,1784,1786,1786,1789,1787,1781,1782,1780,1781,1785,1785,
-    1787,1789,1785,1786,1788,1790,1788,1788,1790,1792,1789,1785,1784,1784,1781,1781,
-    1786,1784,1786,1788,1787,1783,1781,1782,1778,1777,1776,1778,1779,1778,1779,1781,
-    1778,1779,1778,1779,1782,1782,1783,1782,1782,1779,1780,1782,1786,1788,1786,1785,
-    1782,1785,1789,1788,1791,1796,1796,1801,1806,1805,1803,1798,1800,1797,1795,1792,
-    1792,1794,1792,1792,1790,1794,1794,1797,1799,1796,1795,1795,1797,1799,1795,1793,
-    1792,1791,1789,1789,1789,1789,1787,1785,1783,1782,1781,1779,1774,1774,1769,1767,
-    1772,1773,1778,1781,1781,1779,1781,1777,1774,1771,1776,1778,1780,1785,1784,1783,
-    1781,1782,1782,1780,1781,1781,1787,1792,1790,1790,1788,1789,1788,1787,1790,1795,
-    1797,1799,1797,1796,1802,1801,1798,1797,1795,1792,1793,1794,1790,1787,1789,1785,
-    1786,1783,1778,1782,1777,1775,1774,1775,1772,1774,1776,1776,1778,1780,1779,1774,
-    1767,1770,1778,1784,1790,1782,1783,1781,1784,1783,1783,1785,1786,1792,1789,1789,
-    1791,1789,1785,1790,1790,1789,1793,1799,1801,1802,1799,1798,1800,1800,1796,1795,
-    1796,1793,1791,1787,1787,1784,1784,1785,1780,1775,1770,1773,1772,1775,1778,1774,
-    1771,1769,1771,1769,1776,1780,1778,1777,1776,1782,1785,1786,1791,1796,1797,1800,
-    1801,1804,1802,1796,1792,1793,1791,1791,1794,1794,1794,1797,1796,1793,1795,1802,
-    1804,1801,1804,1803,1803,1799,1792,1792,1792,1793,1788,1787,1789,1791,1789,1783,
-    1784,1782,1778,1779,1781,1785,1780,1778,1778,1779,1784,1784,1785,1786,1783,1781,
-    1780,1781,1786,1787,1790,1789,1790,1789,1790,1787,1785,1785,1787,1789,1792,1799,
-    1798,1792,1792,1798,1795,1792,1793,1796,1795,1790,1788,1786,1786,1787,1781,1782,
-    1784,1784,1780,1782,1786,1782,1781,1780,1780,1778,1779,1780,1778,1777,1780,1781,
-    1776,1782,1785,1783,1785,1786,1787,1790,1788,1781,1780,1782,1778,1777,1779,1776,
-    1775,1776,1775,1776,1779,1782,1783,1782,1782,1779,1782,1784,1782,1782,1783,1784,
-    1786,1787,1789,1790,1789,1794,1797,1800,1797,1805,1803,1799,1799,1798,1798,1794,
-    1790,1787,1788,1785,1786,1788,1796,1798,1799,1797,1794,1796,1793,1787,1782,1784,
-    1785,1784,1782,1778,1777,1777,1776,1774,1773,1776,1777,1775,1774,1774,1773,1774,
-    1779,1779,1779,1784,1788,1789,1782,1774,1776,1780,1782,1782,1783,1784,1781,1775,
-    1774,1768,1768,1773,1779,1785,1783,1779,1774,1771,1771,1769,1771,1774,1777,1783,
-    1781,1782,1785,1785,1785,1791,1788,1786,1784,1785,1786,1787,1787,1785,1784,1783,
-    1785,1783,1783,1784,1783,1781,1782,1783,1781,1778,1776,1779,1784,1784,1784,1780,
-    1778,1777,1776,1778,1781,1783,1785,1785,1788,1790,1791,1789,1787,1789,1792,1794,
-    1796,1794,1794,1793,1792,1792,1793,1796,1793,1797,1796,1793,1789,1790,1792,1792,
-    1790,1784,1783,1786,1787,1788,1785,1785,1785,1785,1788,1788,1789,1792,1790,1786,
-    1791,1795,1798,1798,1797,1797,1799,1798,1802,1802,1800,1804,1806,1805,1802,1798,
-    1790,1784,1785,1782,1777,1775,1774,1776,1771,1769,1769,1773,1774,1776,1781,1782,
-    1780,1777,1780,1777,1781,1783,1785,1788,1789,1791,1792,1788,1785,1787,1791,1792,
-    1788,1788,1787,1789,1787,1787,1785,1786,1790,1786,1784,1781,1780,1784,1787,1786,
-    1790,1791,1788,1785,1786,1782,1776,1775,1775,1782,1785,1787,1784,1780,1778,1779,
-    1779,1779,1784,1787,1787,1786,1780,1778,1784,1783,1781,1784,1789,1784,1783,1783,
-    1784,1784,1782,1786,1787,1790,1789,1785,1785,1785,1784,1782,1784,1788,1788,1789,
-    1792,1790,1793,1792,1789,1797,1800,1799,1801,1802,1798,1795,1790,1788,1785,1788,
-    1789,1789,1790,1789,1789,1786,1787,1784,1788,1790,1790,1790,1792,1797,1799,1799,
-    1799,1800,1793,1794,1795,1798,1795,1795,1790,1782,1785,1786,1788,1790,1790,1788,
-    1786,1785,1784,1784,1785,1784,1785,1782,1782,1786,1789,1788,1787,1784,1784,1788,
-    1787,1781,1779,1783,1789,1787,1784,1787,1785,1786,1789,1791,1791,1791,1786,1785,
-    1780,1777,1773,1773,1779,1781,1780,1779,1780,1778,1775,1776,1779,1779,1779,1781,
-    1780,1778,1780,1780,1780,1785,1791,1790,1785,1785,1787,1793,1797,1794,1795,1795,
-    1796,1800,1802,1804,1802,1800,1801,1796,1796,1793,1789,1794,1790,1787,1785,1782,
-    1774,1774,1772,1772,1777,1775,1777,1775,1776,1778,1778,1778,1777,1778,1782,1784,
-    1789,1785,1784,1783,1779,1777,1777,1780,1781,1784,1787,1790,1789,1789,1789,1784,
-    1777,1774,1777,1778,1778,1777,1777,1776,1779,1779,1780,1784,1783,1785,1786,1786,
-    1788,1791,1791,1788,1788,1791,1790,1794,1800,1799,1797,1792,1791,1789,1790,1786,
-    1786,1782,1779,1779,1777,1780,1779,1774,1770,1772,1776,1779,1778,1778,1777,1772,
-    1771,1769,1774,1776,1772,1775,1775,1775,1777,1781,1785,1785,1786,1791,1794,1794,
-    1798,1799,1799,1795,1797,1797,1795,1793,1790,1794,1793,1787,1783,1783,1785,1786,
-    1785,1783,1786,1782,1784,1786,1786,1791,1789,1790,1792,1794,1793,1795,1794,1796,
-    1795,1793,1793,1791,1790,1790,1794,1795,1793,1793,1794,1794,1796,1793,1792,1787,
-    1788,1788,1787,1793,1792,1792,1793,1789,1788,1786,1785,1783,1785,1786,1788,1789,
-    1788,1790,1790,1786,1784,1788,1789,1791,1789,1791,1789,1788,1789,1786,1785,1784,
-    1782,1780,1776,1777,1779,1776,1777,1778,1777,1781,1778,1775,1778,1778,1779,1782,
-    1784,1784,1782,1779,1780,1776,1774,1774,1775,1778,1776,1777,1778,1778,1777,1775,
-    1771,1771,1774,1778,1780,1786,1791,1789,1786,1787,1789,1788,1788,1795,1800,1798,
-    1800,1800,1803,1801,1799,1796,1793,1798,1797,1792,1789,1788,1782,1786,1791,1794,
-    1793,1793,1792,1787,1786,1784,1779,1777,1778,1781,1779,1779,1777,1774,1773,1770,
-    1768,1773,1779,1782,1783,1782,1780,1780,1777,1773,1774,1777,1777,1779,1782,1782,
-    1783,1787,1787,1789,1797,1795,1795,1795,1795,1794,1792,1795,1796,1796,1801,1804,
-    1803,1798,1793,1789,1788,1786,1786,1781,1774,1773,1776,1776,1771,1770,1773,1777,
-    1779,1783,1785,1788,1791,1796,1791,1787,1791,1797,1798,1798,1799,1800,1798,1794,
-    1794,1799,1802,1799,1801,1797,1798,1798,1795,1789,1784,1784,1783,1788,1789,1787,
-    1785,1784,1785,1789,1794,1791,1788,1786,1788,1790,1793,1786,1776,1765,1763,1768,
-    1773,1778,1775,1772,1770,1771,1777,1783,1785,1784,1779,1781,1783,1788,1789,1785,
-    1781,1774,1774,1778,1784,1784,1782,1776,1773,1777,1781,1784,1786,1788,1785,1785,
-    1789,1793,1796,1792,1792,1792,1790,1794,1792,1786,1782,1776,1775,1778,1789,1798,
-    1796,1790,1788,1791,1797,1798,1791,1794,1792,1791,1793,1794,1795,1792,1792,1792,
-    1794,1793,1790,1788,1786,1782,1785,1786,1788,1793,1791,1789,1787,1788,1787,1786,
-    1780,1778,1774,1771,1777,1779,1780,1781,1781,1784,1788,1793,1794,1793,1796,1794,
-    1793,1789,1787,1790,1792,1789,1788,1787,1784,1786,1779,1774,1776,1781,1783,1785,
-    1785,1783,1785,1785,1785,1786,1786,1784,1783,1777,1780,1787,1785,1784,1781,1780,
-    1785,1788,1790,1788,1784,1779,1784,1787,1788,1793,1787,1784,1779,1784,1787,1788,
-    1785,1780,1778,1781,1794,1800,1804,1798,1785,1784,1784,1785,1786,1785,1779,1775,
-    1779,1782,1786,1785,1786,1785,1790,1796,1799,1802,1795,1786,1782,1781,1783,1788,
-    1790,1792,1792,1788,1788,1790,1790,1789,1784,1783,1783,1785,1793,1794,1788,1783,
-    1781,1777,1778,1784,1788,1784,1783,1784,1788,1795,1800,1799,1792,1792,1791,1788,
-    1784,1791,1792,1787,1781,1779,1783,1784,1785,1784,1786,1785,1780,1778,1777,1782,
-    1786,1786,1786,1785,1787,1793,1796,1798,1794,1791,1787,1788,1787,1788,1790,1784,
-    1779,1775,1773,1777,1778,1777,1776,1771,1770,1768,1769,1775,1780,1780,1781,1781,
-    1781,1782,1786,1787,1788,1786,1782,1784,1789,1790,1787,1778,1774,1775,1774,1776,
-    1784,1782,1772,1768,1763,1770,1775,1774,1769,1768,1765,1775,1785,1786,1787,1782,
-    1783,1786,1789,1796,1796,1793,1789,1789,1790,1791,1790,1782,1780,1777,1781,1790,
-    1796,1795,1794,1789,1789,1790,1794,1801,1797,1789,1784,1784,1786,1785,1786,1786,
-    1785,1781,1773,1778,1786,1787,1778,1769,1766,1772,1779,1782,1785,1786,1785,1783,
-    1785,1791,1788,1779,1773,1771,1770,1775,1780,1780,1781,1777,1774,1774,1783,1788,
-    1791,1788,1783,1788,1789,1790,1792,1788,1787,1787,1784,1787,1794,1802,1804,1800,
-    1799,1802,1802,1803,1801,1796,1792,1788,1786,1790,1796,1795,1793,1793,1791,1790,
-    1793,1793,1793,1792,1788,1785,1783,1781,1778,1778,1780,1777,1778,1783,1785,1787,
-    1781,1779,1784,1789,1796,1796,1789,1782,1780,1785,1789,1789,1786,1787,1786,1787,
-    1792,1796,1796,1790,1783,1783,1784,1788,1791,1789,1787,1786,1789,1790,1796,1794,
-    1791,1786,1787,1789,1793,1793,1786,1786,1782,1783,1789,1793,1792,1790,1790,1791,
-    1790,1790,1789,1788,1786,1781,1782,1784,1783,1782,1787,1785,1786,1785,1781,1780,
-    1775,1778,1779,1785,1784,1776,1773,1775,1781,1786,1792,1791,1787,1785,1788,1792,
-    1795,1796,1793,1789,1787,1786,1789,1789,1785,1781,1778,1776,1781,1787,1788,1789,
-    1787,1789,1793,1796,1796,1788,1784,1783,1783,1788,1787,1780,1783,1778,1777,1779,
-    1779,1783,1785,1789,1791,1791,1792,1794,1799,1798,1799,1799,1799,1797,1793,1790,
-    1785,1787,1787,1788,1787,1791,1796,1798,1795,1797,1794,1793,1792,1788,1791,1793,
-    1794,1792,1790,1785,1785,1783,1782,1780,1777,1776,1775,1775,1771,1774,1776,1775,
-    1776,1778,1775,1770,1771,1767,1771,1770,1770,1769,1768,1770,1768,1768,1768,1767,
-    1771,1778,1784,1786,1784,1783,1786,1786,1789,1793,1795,1797,1794,1793,1788,1786,
-    1786,1787,1787,1784,1788,1788,1786,1791,1792,1793,1792,1792,1794,1795,1795,1793,
-    1794,1792,1787,1789,1791,1793,1792,1786,1784,1786,1786,1787,1789,1790,1792,1789,
-    1790,1797,1800,1792,1787,1785,1781,1779,1781,1779,1777,1778,1779,1778,1785,1789,
-    1784,1782,1784,1786,1789,1789,1786,1788,1785,1786,1786,1786,1789,1789,1793,1794,
-    1796,1794,1795,1791,1793,1794,1796,1799,1791,1792,1788,1789,1792,1791,1788,1786,
-    1787,1789,1791,1788,1785,1786,1787,1789,1792,1797,1802,1799,1795,1792,1789,1787,
-    1792,1794,1789,1786,1789,1793,1791,1791,1791,1785,1782,1774,1776,1780,1784,1781,
-    1778,1777,1769,1766,1770,1777,1775,1773,1774,1776,1773,1770,1774,1775,1772,1773,
-    1770,1772,1774,1775,1776,1778,1781,1786,1786,1784,1786,1787,1787,1787,1786,1786,
-    1787,1786,1784,1785,1788,1791,1791,1788,1787,1789,1792,1795,1799,1797,1792,1788,
-    1789,1791,1792,1796,1798,1797,1794,1795,1795,1795,1794,1792,1792,1796,1794,1796,
-    1797,1794,1791,1791,1798,1802,1801,1801,1798,1793,1789,1790,1787,1782,1783,1781,
-    1777,1772,1773,1777,1776,1777,1777,1775,1772,1772,1776,1777,1778,1775,1769,1770,
-    1772,1773,1768,1768,1769,1772,1779,1779,1778,1774,1773,1767,1766,1767,1766,1769,
-    1768,1771,1768,1763,1760,1757,1754,1756,1752,1751,1754,1751,1755,1759,1760,1761,
-    1761,1763,1768,1765,1765,1768,1771,1776,1785,1796,1810,1832,1847,1871,1893,1912,
-    1938,1961,1975,1980,1977,1969,1961,1940,1920,1895,1863,1830,1801,1777,1753,1730,
-    1709,1692,1686,1682,1681,1685,1683,1686,1694,1704,1709,1716,1722,1728,1735,1742,
-    1749,1756,1766,1774,1784,1796,1809,1820,1827,1831,1831,1824,1814,1807,1798,1788,
-    1774,1765,1761,1755,1754,1751,1751,1749,1752,1759,1760,1762,1764,1768,1764,1757,
-    1754,1752,1747,1751,1753,1751,1758,1762,1765,1767,1771,1777,1777,1776,1772,1771,
-    1771,1760,1761,1758,1753,1750,1748,1748,1746,1749,1749,1746,1738,1732,1734,1738,
-    1745,1763,1786,1812,1842,1877,1912,1942,1971,1998,2020,2036,2044,2037,2023,1996,
-    1963,1935,1900,1865,1827,1794,1757,1726,1704,1686,1676,1668,1674,1679,1691,1705,
-    1713,1716,1714,1712,1711,1710,1714,1723,1737,1752,1770,1789,1811,1833,1850,1861,
-    1865,1861,1846,1828,1813,1791,1765,1749,1740,1734,1732,1730,1734,1733,1729,1726,
-    1724,1729,1728,1721,1716,1715,1713,1714,1716,1721,1730,1737,1738,1744,1759,1770,
-    1780,1777,1779,1782,1785,1788,1788,1787,1784,1778,1772,1772,1771,1770,1760,1750,
-    1740,1731,1729,1726,1724,1717,1709,1712,1726,1752,1778,1800,1830,1863,1903,1953,
-    1997,2027,2053,2073,2079,2069,2050,2018,1982,1938,1892,1849,1810,1773,1731,1695,
-    1675,1668,1667,1670,1681,1697,1705,1709,1710,1704,1696,1692,1688,1687,1701,1719,
-    1741,1770,1796,1822,1855,1882,1898,1906,1904,1888,1867,1841,1815,1791,1773,1762,
-    1758,1762,1765,1769,1766,1758,1752,1744,1732,1718,1705,1695,1681,1672,1674,1681,
-    1682,1683,1691,1698,1710,1720,1725,1732,1740,1750,1758,1766,1777,1785,1787,1791,
-    1793,1798,1801,1798,1790,1786,1784,1776,1766,1752,1736,1721,1709,1700,1692,1686,
-    1686,1701,1730,1768,1811,1859,1917,1976,2035,2078,2111,2139,2154,2142,2116,2082,
-    2037,1994,1944,1896,1850,1812,1772,1734,1711,1693,1684,1681,1676,1666,1659,1652,
-    1642,1630,1628,1623,1624,1637,1654,1681,1719,1760,1798,1838,1879,1915,1937,1947,
-    1950,1943,1926,1900,1871,1849,1828,1817,1802,1794,1795,1794,1792,1782,1762,1741,
-    1719,1691,1663,1637,1627,1625,1623,1637,1661,1685,1702,1714,1723,1732,1736,1733,
-    1736,1741,1749,1760,1770,1777,1783,1787,1785,1787,1785,1784,1781,1769,1763,1757,
-    1747,1742,1738,1728,1714,1696,1680,1666,1655,1644,1631,1629,1625,1622,1626,1641,
-    1684,1737,1793,1872,1963,2044,2124,2194,2233,2259,2272,2260,2225,2179,2133,2089,
-    2042,1994,1954,1919,1887,1849,1800,1754,1701,1630,1565,1511,1468,1448,1446,1458,
-    1486,1533,1590,1631,1665,1687,1708,1731,1752,1774,1807,1859,1910,1960,2006,2053,
-    2087,2091,2067,2024,1976,1917,1852,1796,1757,1726,1706,1693,1695,1701,1700,1686,
-    1655,1626,1602,1579,1561,1562,1590,1638,1689,1739,1787,1820,1828,1813,1789,1769,
-    1749,1741,1742,1758,1786,1803,1811,1804,1780,1743,1702,1665,1643,1642,1656,1666,
-    1677,1685,1670,1643,1593,1541,1510,1493,1493,1512,1538,1599,1697,1787,1861,1947,
-    2042,2129,2196,2247,2289,2327,2362,2366,2346,2317,2298,2263,2199,2132,2061,1986,
-    1909,1819,1730,1664,1609,1550,1489,1440,1405,1386,1377,1368,1384,1426,1475,1516,
-    1565,1630,1695,1751,1792,1837,1899,1973,2026,2067,2117,2160,2183,2175,2155,2126,
-    2085,2026,1956,1900,1850,1802,1743,1682,1635,1593,1547,1499,1466,1453,1452,1458,
-    1464,1491,1532,1573,1605,1631,1673,1715,1753,1786,1814,1844,1869,1876,1869,1859,
-    1854,1836,1802,1779,1758,1735,1705,1658,1621,1582,1545,1513,1471,1451,1453,1448,
-    1450,1459,1474,1503,1566,1651,1751,1893,2036,2153,2263,2359,2417,2458,2494,2522,
-    2542,2553,2537,2488,2411,2319,2198,2064,1950,1851,1757,1678,1596,1499,1416,1338,
-    1259,1213,1203,1209,1241,1284,1322,1362,1419,1478,1537,1615,1710,1798,1882,1961,
-    2031,2100,2153,2193,2240,2280,2301,2301,2261,2202,2144,2070,1988,1914,1836,1770,
-    1695,1607,1536,1477,1422,1378,1342,1327,1338,1347,1358,1386,1431,1484,1534,1575,
-    1624,1683,1731,1775,1815,1850,1876,1885,1886,1879,1871,1848,1823,1784,1736,1683,
-    1635,1603,1555,1529,1498,1480,1476,1466,1445,1442,1458,1539,1649,1745,1888,1998,
-    2059,2180,2330,2412,2489,2568,2588,2596,2589,2540,2489,2443,2384,2273,2139,2028,
-    1917,1802,1709,1606,1504,1429,1343,1256,1235,1254,1253,1263,1274,1277,1317,1398,
-    1457,1530,1654,1733,1768,1848,1950,2049,2164,2207,2236,2305,2325,2333,2333,2297,
-    2258,2192,2071,1986,1929,1858,1779,1671,1566,1515,1458,1392,1355,1325,1306,1301,
-    1288,1301,1356,1393,1411,1437,1481,1558,1639,1687,1741,1798,1829,1835,1847,1865,
-    1882,1867,1834,1783,1761,1738,1699,1652,1586,1567,1547,1537,1529,1528,1497,1482,
-    1602,1724,1835,1914,1910,2003,2257,2439,2427,2404,2462,2576,2655,2613,2511,2459,
-    2441,2373,2214,2090,2045,1923,1757,1620,1540,1526,1465,1289,1166,1216,1285,1263,
-    1200,1179,1252,1371,1414,1408,1479,1619,1713,1738,1789,1898,2020,2120,2145,2171,
-    2268,2343,2364,2327,2293,2305,2293,2203,2085,2002,1936,1855,1743,1628,1574,1499,
-    1408,1331,1286,1288,1277,1228,1205,1251,1307,1336,1343,1379,1468,1541,1566,1600,
-    1682,1763,1802,1798,1822,1880,1867,1841,1795,1798,1792,1748,1669,1607,1608,1602,
-    1562,1524,1524,1531,1512,1575,1699,1772,1857,1872,1938,2184,2448,2427,2299,2402,
-    2642,2733,2607,2421,2421,2565,2586,2323,2047,2051,2108,1983,1736,1552,1528,1560,
-    1434,1244,1207,1279,1255,1179,1163,1236,1318,1339,1326,1405,1581,1667,1644,1707,
-    1872,2004,2033,2003,2106,2288,2316,2269,2294,2387,2426,2325,2206,2221,2260,2136,
-    1942,1828,1811,1789,1616,1438,1412,1427,1364,1234,1189,1240,1283,1226,1187,1255,
-    1349,1388,1397,1437,1556,1649,1668,1679,1763,1851,1893,1855,1856,1884,1900,1827,
-    1746,1787,1747,1691,1602,1588,1619,1574,1458,1460,1505,1597,1671,1697,1741,1859,
-    2026,2232,2307,2172,2259,2562,2667,2546,2426,2455,2614,2601,2379,2158,2191,2268,
-    2141,1849,1700,1726,1724,1582,1366,1295,1387,1394,1261,1185,1215,1296,1335,1318,
-    1300,1393,1517,1576,1607,1682,1775,1875,1955,1989,2004,2116,2266,2254,2219,2286,
-    2383,2382,2246,2182,2236,2240,2073,1907,1855,1862,1782,1579,1466,1454,1430,1343,
-    1229,1200,1257,1252,1202,1199,1266,1338,1387,1394,1466,1555,1641,1689,1739,1775,
-    1857,1895,1910,1893,1899,1900,1871,1877,1773,1765,1684,1697,1653,1582,1499,1528,
-    1549,1541,1596,1634,1736,1767,1839,2100,2228,2078,2150,2462,2573,2424,2365,2467,
-    2614,2517,2354,2244,2286,2284,2106,1907,1865,1847,1759,1637,1473,1437,1483,1448,
-    1320,1284,1292,1351,1375,1349,1313,1394,1523,1559,1551,1608,1706,1801,1874,1888,
-    1928,2038,2091,2095,2187,2212,2201,2235,2291,2299,2214,2130,2150,2138,1991,1857,
-    1821,1795,1704,1530,1446,1459,1399,1324,1269,1255,1281,1299,1266,1273,1324,1397,
-    1457,1470,1493,1599,1699,1746,1747,1764,1836,1906,1887,1852,1848,1857,1842,1829,
-    1744,1641,1659,1670,1607,1519,1484,1463,1611,1663,1660,1617,1652,1981,2257,2054,
-    1859,2260,2631,2476,2239,2339,2588,2616,2462,2315,2251,2340,2321,2123,1913,1861,
-    1885,1889,1681,1437,1487,1616,1493,1299,1273,1358,1419,1378,1283,1301,1463,1534,
-    1496,1491,1570,1682,1800,1813,1777,1862,2013,2075,2058,2024,2068,2207,2241,2169,
-    2103,2112,2235,2209,2011,1902,1969,1992,1826,1616,1577,1675,1581,1417,1343,1356,
-    1412,1370,1278,1280,1370,1446,1450,1402,1414,1574,1658,1612,1596,1713,1866,1868,
-    1784,1784,1900,1938,1872,1770,1782,1800,1773,1687,1606,1581,1572,1578,1493,1427,
-    1512,1665,1719,1559,1632,2067,2202,1890,1933,2410,2491,2290,2301,2475,2490,2459,
-    2449,2330,2233,2290,2287,2112,1921,1867,1961,1917,1617,1500,1649,1637,1462,1377,
-    1376,1397,1442,1412,1320,1335,1465,1540,1509,1462,1522,1698,1800,1730,1733,1896,
-    2008,2018,1997,2002,2102,2190,2157,2117,2097,2124,2206,2145,1977,1926,1995,1978,
-    1798,1643,1657,1701,1596,1455,1399,1443,1470,1395,1317,1351,1434,1486,1451,1409,
-    1496,1627,1632,1591,1627,1731,1818,1807,1779,1800,1890,1887,1851,1768,1790,1805,
-    1752,1678,1571,1618,1611,1517,1428,1482,1548,1591,1677,1561,1635,2041,2142,1838,
-    1884,2408,2460,2198,2246,2466,2457,2426,2437,2283,2236,2316,2296,2093,1903,1886,
-    2018,1914,1589,1542,1721,1655,1447,1418,1428,1426,1467,1416,1295,1344,1493,1510,
-    1447,1434,1531,1694,1743,1665,1708,1878,1959,1958,1947,1971,2072,2152,2112,2061,
-    2099,2160,2141,2072,2015,1986,2000,1955,1835,1741,1739,1731,1652,1530,1470,1526,
-    1509,1432,1384,1406,1462,1467,1447,1460,1520,1595,1611,1610,1630,1712,1787,1782,
-    1771,1813,1874,1854,1825,1819,1840,1820,1812,1704,1643,1673,1645,1540,1481,1488,
-    1475,1494,1611,1670,1461,1637,2148,2054,1643,2006,2515,2329,2114,2352,2513,2408,
-    2435,2457,2261,2234,2398,2299,2020,1897,2032,2103,1801,1526,1683,1792,1576,1429,
-    1444,1418,1442,1491,1360,1256,1390,1547,1475,1369,1438,1617,1728,1647,1617,1786,
-    1948,1956,1934,1942,2023,2138,2164,2065,2059,2147,2200,2147,1957,1993,2097,2052,
-    1873,1762,1820,1819,1730,1578,1551,1558,1587,1513,1352,1413,1495,1524,1440,1391,
-    1500,1609,1600,1534,1583,1684,1774,1751,1689,1767,1858,1874,1798,1794,1841,1885,
-    1826,1744,1700,1697,1694,1616,1529,1484,1527,1485,1392,1441,1695,1622,1387,1708,
-    2159,1927,1681,2121,2439,2227,2202,2441,2429,2362,2512,2473,2233,2280,2411,2285,
-    2023,1961,2075,2071,1774,1606,1737,1741,1552,1462,1459,1408,1441,1451,1310,1263,
-    1421,1484,1411,1380,1467,1600,1673,1646,1653,1790,1905,1952,1965,1977,2047,2166,
-    2161,2064,2065,2138,2124,2062,1969,1938,1967,1949,1850,1719,1738,1766,1687,1564,
-    1534,1572,1565,1506,1436,1492,1532,1517,1524,1528,1574,1640,1676,1637,1641,1746,
-    1809,1769,1722,1804,1897,1865,1798,1809,1877,1876,1799,1715,1714,1750,1700,1561,
-    1536,1524,1499,1459,1380,1317,1388,1672,1617,1275,1547,2199,2043,1602,1986,2490,
-    2352,2198,2381,2468,2435,2594,2549,2252,2288,2533,2424,2084,1942,2087,2194,1855,
-    1546,1681,1763,1552,1420,1389,1330,1380,1443,1290,1162,1319,1489,1415,1325,1384,
-    1561,1683,1631,1618,1746,1896,1964,1950,1925,2020,2171,2155,2041,2044,2126,2145,
-    2077,1983,1940,1977,1979,1875,1754,1733,1781,1728,1600,1536,1588,1610,1545,1483,
-    1472,1538,1590,1553,1506,1586,1712,1705,1661,1686,1770,1830,1809,1770,1808,1888,
-    1869,1829,1826,1840,1836,1819,1733,1695,1731,1709,1583,1504,1554,1525,1456,1327,
-    1330,1381,1452,1606,1470,1313,1773,2230,1838,1587,2188,2558,2268,2155,2475,2548,
-    2472,2599,2472,2268,2407,2560,2320,2009,1980,2186,2136,1677,1531,1766,1745,1472,
-    1368,1362,1348,1417,1400,1210,1184,1421,1508,1348,1300,1465,1662,1689,1596,1649,
-    1847,1958,1969,1949,1958,2091,2196,2130,2017,2070,2166,2145,2033,1932,1978,2015,
-    1945,1809,1733,1800,1793,1670,1564,1579,1609,1590,1513,1454,1526,1587,1566,1515,
-    1546,1649,1701,1683,1667,1731,1821,1828,1790,1790,1874,1878,1836,1822,1833,1843,
-    1831,1787,1744,1727,1716,1660,1586,1516,1491,1483,1423,1332,1279,1336,1337,1533,
-    1541,1263,1526,2159,2017,1568,1982,2541,2401,2168,2405,2571,2506,2652,2624,2314,
-    2378,2603,2430,2032,1884,2037,2112,1723,1433,1641,1794,1637,1504,1498,1492,1535,
-    1523,1279,1121,1296,1470,1365,1269,1438,1685,1784,1700,1669,1815,1982,2018,1970,
-    1928,1998,2117,2092,1939,1948,2099,2184,2092,1956,2013,2082,2033,1872,1759,1787,
-    1792,1705,1535,1452,1464,1469,1359,1239,1362,1506,1522,1455,1480,1608,1691,1705,
-    1687,1746,1863,1948,1909,1849,1892,1949,1921,1865,1866,1925,1957,1871,1745,1674,
-    1686,1669,1529,1429,1479,1483,1368,1237,1214,1254,1344,1541,1416,1252,1747,2236,
-    1875,1599,2184,2610,2340,2208,2509,2604,2552,2639,2466,2277,2491,2626,2383,2072,
-    2020,2220,2175,1690,1494,1746,1756,1469,1337,1339,1366,1409,1355,1176,1158,1424,
-    1518,1332,1229,1394,1625,1651,1537,1593,1825,1956,1956,1926,1953,2092,2192,2101,
-    2041,2109,2224,2198,2024,1957,1994,2022,1931,1788,1779,1898,1869,1691,1579,1567,
-    1612,1568,1447,1434,1463,1548,1527,1426,1480,1614,1655,1623,1653,1723,1826,1789,
-    1708,1754,1893,1911,1874,1883,1913,1914,1896,1843,1776,1764,1767,1618,1447,1465,
-    1452,1390,1337,1301,1283,1556,1655,1303,1340,1997,2189,1664,1699,2317,2426,2151,
-    2203,2469,2497,2607,2612,2377,2410,2485,2475,2277,2023,1998,2220,2082,1679,1620,
-    1854,1826,1475,1364,1446,1445,1352,1273,1201,1304,1407,1368,1313,1298,1429,1635,
-    1600,1507,1669,1893,1896,1844,1882,1986,2133,2135,2099,2115,2178,2217,2130,2007,
-    1967,2025,2019,1856,1736,1750,1772,1662,1558,1519,1598,1600,1504,1438,1519,1560,
-    1564,1539,1488,1589,1692,1659,1591,1867,1818,1826,1899,1821,1956,1962,1915,1836,
-    1864,1918,1884,1686,1597,1724,1676,1552,1472,1436,1429,1410,1350,1286,1318,1591,
-    1647,1349,1516,2115,2189,1753,1859,2419,2547,2281,2283,2496,2578,2592,2466,2289,
-    2347,2434,2337,2139,1928,1936,2105,1908,1546,1540,1707,1638,1380,1254,1336,1481,
-    1431,1267,1269,1437,1525,1454,1411,1474,1633,1748,1729,1697,1820,2003,2039,1966,
-    1945,2085,2209,2184,2046,2048,2161,2160,2032,1915,1922,1977,1947,1782,1691,1709,
-    1718,1617,1461,1425,1498,1489,1371,1341,1409,1442,1447,1447,1492,1577,1645,1697,
-    1672,1702,1853,1929,1859,1853,1944,2032,1993,1904,1943,1950,1883,1762,1733,1675,
-    1654,1600,1481,1461,1455,1385,1322,1547,1624,1417,1462,1953,2044,1716,1778,2274,
-    2441,2132,2123,2402,2548,2455,2297,2258,2410,2381,2218,2126,2023,1959,2023,1901,
-    1603,1543,1679,1677,1441,1265,1359,1527,1447,1235,1213,1449,1558,1428,1356,1491,
-    1675,1752,1694,1698,1846,1999,2039,1965,1973,2072,2197,2206,2098,2074,2163,2240,
-    2123,1945,1907,1988,1981,1793,1655,1666,1734,1642,1439,1400,1490,1481,1380,1299,
-    1334,1464,1527,1436,1430,1572,1670,1664,1617,1643,1774,1888,1844,1784,1830,1944,
-    1935,1875,1824,1806,1818,1795,1698,1593,1615,1627,1542,1433,1369,1606,1799,1492,
-    1343,1900,2321,1933,1657,2116,2635,2433,2082,2213,2570,2665,2317,2058,2238,2406,
-    2215,2007,1909,1838,1888,1857,1590,1412,1473,1573,1493,1266,1170,1381,1550,1368,
-    1182,1332,1582,1615,1491,1471,1633,1841,1894,1792,1830,2030,2151,2130,2093,2107,
-    2219,2296,2250,2166,2118,2222,2280,2140,1942,1911,2013,1929,1700,1568,1609,1659,
-    1531,1324,1308,1456,1429,1308,1282,1386,1454,1465,1475,1479,1524,1660,1752,1663,
-    1666,1797,1882,1851,1790,1790,1870,1862,1761,1704,1683,1683,1634,1537,1481,1457,
-    1456,1454,1601,1692,1532,1589,1993,2217,1996,1886,2221,2607,2539,2217,2234,2596,
-    2751,2376,2052,2250,2453,2241,1899,1779,1880,1933,1686,1436,1427,1487,1460,1360,
-    1243,1231,1330,1394,1368,1312,1357,1476,1603,1621,1603,1661,1824,1933,1931,1930,
-    2029,2158,2213,2172,2133,2239,2306,2263,2184,2173,2200,2149,2023,1946,1931,1863,
-    1761,1695,1626,1551,1462,1403,1393,1382,1307,1295,1357,1359,1348,1365,1424,1495,
-    1553,1543,1586,1673,1719,1745,1758,1777,1808,1819,1816,1755,1720,1677,1666,1636,
-    1546,1466,1468,1547,1466,1486,1670,1749,1650,1801,2167,2264,2136,2136,2435,2663,
-    2611,2429,2415,2635,2677,2432,2212,2234,2245,2114,1884,1706,1705,1661,1488,1378,
-    1392,1302,1197,1224,1300,1241,1158,1232,1417,1506,1431,1444,1636,1832,1844,1824,
-    1919,2078,2141,2146,2161,2211,2253,2259,2285,2256,2216,2169,2198,2196,2073,1929,
-    1870,1877,1831,1711,1569,1563,1583,1521,1429,1349,1378,1408,1382,1376,1392,1400,
-    1462,1539,1530,1518,1596,1682,1677,1660,1702,1757,1742,1723,1712,1701,1661,1613,
-    1558,1555,1521,1456,1462,1450,1404,1478,1718,1780,1653,1732,2150,2402,2263,2144,
-    2367,2716,2781,2559,2417,2581,2704,2543,2301,2220,2200,2080,1900,1763,1707,1587,
-    1398,1305,1321,1286,1170,1079,1109,1221,1272,1235,1227,1362,1538,1600,1620,1716,
-    1855,1945,2025,2131,2194,2186,2192,2286,2347,2316,2228,2207,2236,2234,2152,2025,
-    1967,1946,1869,1759,1697,1630,1570,1519,1473,1440,1419,1400,1376,1371,1408,1432,
-    1406,1419,1471,1493,1504,1540,1562,1591,1628,1654,1692,1717,1697,1682,1721,1722,
-    1677,1615,1633,1645,1616,1567,1554,1559,1564,1712,1835,1809,1778,1984,2231,2299,
-    2243,2254,2403,2532,2531,2441,2435,2472,2399,2255,2217,2203,2092,1909,1734,1701,
-    1711,1593,1379,1288,1333,1365,1294,1224,1260,1316,1349,1382,1471,1553,1595,1614,
-    1700,1843,1907,1892,1935,2053,2118,2119,2113,2156,2191,2189,2159,2129,2143,2140,
-    2064,1956,1945,1949,1854,1741,1702,1719,1695,1628,1584,1588,1585,1557,1527,1526,
-    1536,1520,1498,1502,1513,1511,1522,1523,1532,1568,1606,1623,1639,1661,1693,1741,
-    1745,1743,1756,1799,1805,1790,1786,1775,1777,1770,1756,1717,1693,1682,1699,1744,
-    1788,1775,1798,1901,1980,2017,2052,2094,2128,2166,2185,2182,2168,2155,2132,2102,
-    2058,1975,1904,1890,1854,1777,1699,1639,1611,1612,1602,1558,1519,1524,1573,1610,
-    1610,1610,1642,1690,1718,1734,1762,1799,1825,1825,1844,1889,1918,1916,1920,1945,
-    1966,1953,1931,1929,1945,1948,1900,1859,1871,1885,1849,1799,1776,1780,1772,1736,
-    1687,1659,1655,1629,1609,1606,1605,1580,1558,1574,1592,1589,1577,1583,1603,1628,
-    1644,1661,1691,1720,1742,1772,1797,1799,1818,1844,1855,1851,1859,1872,1867,1859,
-    1858,1853,1829,1804,1787,1775,1743,1714,1702,1704,1728,1749,1752,1761,1780,1795,
-    1829,1874,1901,1901,1914,1941,1950,1947,1949,1947,1919,1897,1890,1873,1832,1806,
-    1813,1811,1793,1793,1809,1815,1825,1844,1857,1858,1843,1830,1843,1860,1842,1802,
-    1790,1809,1802,1766,1762,1785,1794,1773,1752,1762,1792,1787,1771,1781,1798,1792,
-    1772,1770,1774,1753,1731,1723,1712,1706,1684,1669,1673,1670,1650,1628,1627,1639,
-    1652,1662,1673,1688,1708,1733,1755,1781,1803,1826,1857,1879,1891,1904,1914,1904,
-    1893,1896,1889,1867,1852,1851,1843,1826,1786,1758,1758,1754,1712,1677,1659,1647,
-    1639,1621,1609,1603,1607,1608,1603,1619,1661,1693,1711,1737,1780,1813,1837,1852,
-    1884,1923,1950,1950,1955,1986,2001,1978,1959,1975,1974,1958,1941,1929,1913,1903,
-    1893,1885,1869,1843,1828,1826,1826,1808,1785,1764,1761,1754,1742,1734,1730,1730,
-    1726,1727,1719,1714,1726,1716,1698,1704,1712,1711,1703,1697,1706,1714,1713,1705,
-    1698,1704,1708,1708,1721,1733,1742,1754,1768,1785,1799,1813,1821,1846,1856,1844,
-    1834,1846,1852,1854,1841,1826,1827,1834,1833,1803,1787,1782,1786,1771,1759,1756,
-    1755,1748,1738,1734,1740,1743,1733,1735,1746,1765,1768,1751,1744,1756,1768,1759,
-    1737,1743,1756,1752,1744,1736,1745,1762,1764,1765,1769,1788,1808,1824,1835,1840,
-    1853,1872,1883,1890,1905,1911,1905,1906,1918,1919,1906,1893,1893,1900,1892,1874,
-    1863,1850,1837,1820,1815,1814,1807,1782,1761,1764,1763,1744,1733,1735,1727,1711,
-    1711,1714,1709,1704,1700,1709,1725,1733,1727,1730,1740,1749,1762,1780,1784,1790,
-    1798,1783,1782,1788,1776,1765,1778,1787,1783,1779,1767,1758,1756,1749,1730,1718,
-    1715,1716,1720,1716,1717,1723,1739,1745,1744,1744,1756,1764,1763,1769,1776,1783,
-    1792,1811,1823,1832,1843,1862,1867,1862,1871,1880,1886,1886,1881,1877,1883,1874,
-    1858,1846,1840,1830,1822,1819,1815,1803,1795,1804,1799,1799,1798,1791,1798,1795,
-    1792,1793,1789,1781,1780,1778,1774,1773,1765,1758,1745,1743,1745,1735,1731,1733,
-    1738,1738,1730,1724,1731,1738,1738,1744,1758,1779,1790,1797,1803,1807,1814,1820,
-    1834,1836,1834,1847,1858,1858,1845,1845,1841,1825,1813,1800,1780,1766,1761,1747,
-    1729,1712,1711,1707,1692,1690,1687,1697,1722,1721,1720,1736,1753,1746,1746,1757,
-    1769,1778,1780,1785,1791,1795,1790,1796,1794,1793,1804,1801,1802,1806,1804,1796,
-    1788,1788,1793,1799,1783,1782,1788,1794,1797,1797,1807,1819,1827,1830,1831,1838,
-    1837,1831,1832,1831,1831,1832,1832,1826,1835,1827,1818,1821,1818,1805,1794,1793,
-    1789,1791,1790,1783,1764,1757,1765,1770,1766,1771,1756,1755,1774,1770,1756,1757,
-    1765,1753,1743,1738,1737,1742,1743,1726,1723,1736,1733,1730,1737,1742,1742,1735,
-    1730,1734,1734,1722,1715,1716,1718,1713,1714,1723,1727,1726,1737,1749,1751,1766,
-    1789,1813,1821,1836,1861,1881,1898,1903,1918,1931,1938,1927,1923,1916,1906,1895,
-    1871,1862,1847,1825,1812,1810,1796,1786,1777,1776,1778,1781,1780,1773,1772,1778,
-    1784,1783,1779,1782,1798,1807,1797,1812,1847,1839,1820,1814,1827,1827,1806,1783,
-    1788,1783,1765,1758,1761,1768,1754,1748,1752,1763,1767,1753,1737,1741,1758,1752,
-    1743,1741,1753,1753,1747,1740,1738,1735,1703,1707,1700,1690,1670,1657,1632,1610,
-    1587,1556,1517,1489,1486,1557,1723,1780,1732,1780,1956,2060,2080,2076,2126,2184,
-    2151,2070,2066,2119,2076,1917,1825,1849,1848,1778,1686,1645,1672,1657,1576,1576,
-    1667,1701,1660,1645,1699,1796,1811,1789,1812,1895,1909,1868,1864,1909,1925,1885,
-    1835,1844,1907,1894,1832,1801,1855,1870,1820,1777,1814,1839,1804,1761,1755,1793,
-    1784,1742,1740,1777,1779,1744,1721,1726,1746,1695,1654,1652,1671,1654,1615,1600,
-    1628,1633,1601,1613,1635,1657,1624,1598,1596,1617,1562,1515,1480,1458,1432,1446,
-    1483,1661,1908,1941,1928,2096,2357,2439,2440,2405,2455,2478,2370,2241,2211,2191,
-    2012,1769,1625,1630,1573,1445,1332,1340,1405,1375,1336,1439,1606,1658,1664,1707,
-    1857,1988,2014,2005,2078,2157,2133,2084,2098,2143,2082,1971,1894,1881,1845,1741,
-    1631,1598,1594,1550,1507,1526,1583,1624,1630,1664,1761,1835,1852,1859,1890,1915,
-    1905,1866,1847,1836,1785,1696,1634,1606,1566,1485,1415,1375,1351,1306,1252,1226,
-    1208,1145,1112,1240,1564,1882,1939,1998,2275,2615,2759,2779,2777,2841,2835,2623,
-    2443,2390,2312,2039,1701,1481,1438,1342,1153,1033,1059,1140,1119,1092,1209,1449,
-    1598,1663,1748,1930,2118,2175,2188,2274,2389,2380,2279,2202,2236,2210,2076,1938,
-    1867,1816,1704,1562,1495,1515,1470,1418,1401,1466,1559,1599,1612,1710,1832,1879,
-    1891,1897,1975,2009,1969,1901,1881,1849,1779,1674,1592,1564,1509,1413,1341,1328,
-    1328,1318,1300,1310,1334,1329,1317,1369,1573,1899,2022,2013,2137,2383,2505,2527,
-    2504,2523,2594,2480,2296,2198,2186,2103,1923,1691,1583,1545,1428,1314,1283,1348,
-    1392,1350,1311,1415,1581,1675,1731,1800,1928,2020,2029,2029,2103,2203,2217,2178,
-    2107,2088,2077,2015,1932,1880,1841,1736,1614,1524,1524,1551,1551,1537,1545,1590,
-    1638,1693,1739,1792,1799,1771,1735,1740,1771,1773,1751,1719,1692,1669,1666,1669,
-    1696,1709,1692,1671,1672,1688,1705,1708,1702,1706,1701,1694,1703,1726,1760,1800,
-    1800,1789,1822,1869,1904,1937,1949,1956,1959,1941,1930,1928,1916,1885,1846,1801,
-    1770,1761,1757,1757,1752,1748,1735,1736,1765,1804,1844,1884,1897,1887,1884,1891,
-    1914,1949,1956,1931,1896,1862,1845,1825,1812,1801,1779,1738,1700,1677,1675,1698,
-    1710,1704,1692,1678,1670,1689,1727,1752,1747,1731,1732,1753,1769,1778,1798,1814,
-    1811,1784,1753,1757,1771,1758,1734,1722,1708,1690,1671,1664,1682,1707,1708,1709,
-    1731,1761,1788,1808,1822,1828,1826,1827,1837,1855,1881,1889,1879,1859,1836,1824,
-    1817,1805,1798,1783,1765,1763,1759,1756,1748,1735,1739,1758,1767,1770,1803,1837,
-    1855,1868,1870,1882,1906,1923,1929,1939,1937,1924,1900,1880,1867,1847,1822,1804,
-    1792,1772,1744,1716,1711,1718,1720,1700,1678,1667,1673,1690,1695,1698,1705,1714,
-    1703,1692,1711,1734,1740,1736,1730,1736,1740,1733,1736,1747,1754,1750,1743,1759,
-    1790,1807,1808,1813,1825,1839,1847,1852,1859,1865,1857,1841,1825,1827,1831,1820,
-    1809,1801,1788,1774,1761,1752,1766,1778,1768,1765,1767,1763,1771,1771,1771,1786,
-    1793,1785,1784,1797,1816,1826,1822,1833,1846,1848,1843,1850,1870,1887,1881,1865,
-    1866,1868,1861,1853,1852,1849,1836,1803,1775,1770,1766,1749,1728,1717,1716,1708,
-    1700,1707,1727,1731,1708,1693,1709,1730,1744,1750,1751,1758,1758,1747,1752,1777,
-    1798,1801,1788,1795,1815,1828,1827,1823,1826,1828,1818,1807,1800,1800,1799,1786,
-    1771,1775,1778,1767,1755,1748,1756,1758,1756,1761,1767,1765,1758,1758,1775,1795,
-    1799,1793,1789,1803,1809,1804,1803,1808,1813,1810,1803,1800,1811,1809,1789,1786,
-    1792,1798,1799,1782,1776,1786,1791,1798,1801,1799,1792,1781,1777,1786,1790,1783,
-    1770,1762,1767,1769,1770,1779,1786,1784,1778,1771,1771,1780,1781,1770,1768,1772,
-    1773,1769,1768,1781,1785,1787,1789,1789,1798,1809,1808,1809,1818,1826,1827,1817,
-    1815,1817,1818,1811,1801,1802,1805,1804,1784,1762,1757,1751,1747,1756,1758,1753,
-    1743,1736,1736,1745,1746,1747,1753,1755,1768,1782,1792,1801,1805,1805,1814,1825,
-    1837,1844,1841,1830,1818,1812,1806,1804,1803,1801,1789,1785,1787,1779,1773,1766,
-    1769,1772,1770,1765,1772,1774,1770,1763,1765,1779,1779,1777,1784,1788,1785,1790,
-    1784,1780,1776,1769,1774,1783,1786,1788,1789,1785,1789,1795,1801,1801,1792,1787,
-    1789,1790,1786,1796,1802,1796,1784,1776,1778,1785,1791,1792,1787,1782,1785,1786,
-    1801,1809,1810,1812,1808,1797,1795,1794,1789,1793,1797,1795,1793,1790,1788,1787,
-    1784,1779,1774,1777,1777,1777,1776,1773,1771,1760,1757,1756,1755,1758,1757,1764,
-    1774,1778,1772,1768,1771,1777,1785,1786,1786,1787,1783,1780,1781,1780,1780,1779,
-    1778,1779,1779,1776,1775,1775,1771,1768,1765,1765,1771,1777,1782,1782,1783,1785,
-    1797,1801,1800,1809,1815,1821,1828,1837,1835,1832,1820,1804,1799,1804,1806,1797,
-    1784,1776,1770,1758,1748,1749,1756,1758,1758,1760,1759,1759,1765,1777,1778,1772,
-    1768,1772,1774,1775,1784,1786,1793,1794,1795,1798,1800,1803,1800,1795,1788,1793,
-    1794,1786,1786,1785,1790,1796,1793,1793,1796,1797,1796,1796,1795,1795,1791,1785,
-    1783,1783,1782,1782,1779,1774,1770,1773,1778,1779,1769,1763,1765,1757,1760,1767,
-    1775,1781,1785,1792,1803,1811,1819,1830,1830,1830,1829,1824,1823,1817,1805,1797,
-    1789,1785,1777,1767,1765,1768,1768,1768,1763,1764,1765,1767,1773,1775,1786,1789,
-    1786,1786,1787,1799,1811,1819,1826,1827,1822,1813,1808,1805,1804,1802,1801,1800,
-    1802,1802,1799,1797,1795,1795,1793,1791,1791,1792,1788,1782,1775,1774,1778,1780,
-    1779,1777,1776,1772,1771,1774,1774,1778,1776,1772,1772,1772,1773,1775,1772,1772,
-    1776,1788,1796,1798,1799,1799,1800,1798,1794,1798,1802,1801,1802,1800,1797,1795,
-    1790,1785,1780,1778,1778,1770,1768,1764,1766,1771,1768,1770,1781,1789,1786,1785,
-    1788,1794,1800,1797,1795,1795,1793,1790,1786,1791,1791,1781,1769,1761,1762,1762,
-    1755,1754,1759,1762,1764,1765,1771,1779,1782,1785,1787,1794,1797,1803,1804,1805,
-    1809,1808,1805,1802,1808,1807,1805,1795,1783,1778,1774,1766,1759,1764,1771,1766,
-    1765,1771,1771,1773,1772,1777,1789,1796,1797,1793,1799,1798,1795,1791,1787,1788,
-    1788,1789,1790,1796,1791,1783,1778,1779,1783,1783,1782,1783,1780,1777,1777,1774,
-    1779,1785,1781,1779,1777,1786,1790,1786,1789,1792,1795,1795,1795,1793,1793,1785,
-    1779,1776,1774,1778,1780,1778,1775,1770,1767,1766,1772,1771,1774,1776,1772,1779,
-    1789,1795,1803,1808,1807,1805,1800,1801,1805,1810,1808,1807,1802,1804,1804,1794,
-    1791,1792,1795,1795,1795,1788,1785,1785,1785,1785,1790,1795,1792,1790,1785,1787,
-    1794,1788,1787,1785,1779,1780,1779,1775,1774,1771,1770,1769,1769,1767,1767,1768,
-    1765,1767,1769,1771,1771,1780,1784,1785,1784,1788,1798,1803,1797,1806,1807,1802,
-    1805,1799,1804,1808,1799,1790,1793,1789,1783,1775,1774,1778,1774,1764,1765,1766,
-    1768,1772,1773,1778,1788,1790,1787,1797,1801,1810,1811,1807,1808,1808,1812,1808,
-    1809,1806,1800,1796,1793,1795,1791,1790,1781,1773,1770,1770,1773,1775,1779,1779,
-    1775,1774,1782,1784,1786,1792,1797,1793,1797,1793,1786,1786,1782,1780,1782,1782,
-    1780,1783,1784,1785,1780,1782,1783,1788,1791,1790,1786,1784,1783,1784,1789,1790,
-    1790,1788,1785,1781,1783,1781,1782,1777,1782,1775,1790,1777,1769,1760,1786,1786,
-    1744,1755,1757,1770,1748,1758,1760,1766,1768,1769,1768,1797,1815,1788,1797,1812,
-    1820,1831,1816,1843,1858,1832,1841,1838,1862,1852,1835,1816,1840,1830,1799,1788,
-    1778,1785,1764,1749,1748,1738,1734,1742,1744,1756,1759,1763,1768,1768,1776,1797,
-    1797,1793,1805,1810,1800,1799,1799,1796,1793,1780,1766,1761,1753,1742,1742,1743,
-    1738,1740,1733,1722,1729,1745,1731,1720,1731,1744,1756,1752,1758,1770,1780,1786,
-    1786,1790,1793,1802,1809,1797,1790,1782,1791,1801,1803,1797,1789,1777,1770,1804,
-    1780,1733,1740,1809,1814,1753,1733,1754,1808,1814,1779,1766,1766,1781,1810,1830,
-    1802,1761,1805,1811,1807,1831,1822,1785,1786,1815,1826,1789,1787,1808,1800,1786,
-    1781,1826,1799,1784,1777,1810,1829,1772,1776,1824,1813,1810,1796,1803,1860,1843,
-    1789,1782,1827,1836,1780,1739,1765,1806,1775,1737,1814,1808,1767,1811,1820,1822,
-    1757,1793,1849,1807,1795,1787,1879,1832,1789,1830,1835,1755,1711,1839,1825,1701,
-    1691,1801,1801,1735,1722,1785,1811,1753,1777,1833,1812,1783,1776,1849,1819,1738,
-    1760,1794,1839,1754,1714,1817,1790,1784,1774,1776,1792,1749,1797,1775,1807,1758,
-    1753,1851,1777,1732,1799,1815,1823,1710,1763,1860,1778,1779,1778,1820,1793,1815,
-    1789,1778,1785,1754,1824,1783,1758,1766,1761,1822,1778,1764,1793,1784,1784,1746,
-    1783,1813,1799,1748,1768,1865,1736,1809,1801,1776,1804,1744,1821,1707,1719,1780,
-    1816,1759,1728,1788,1788,1821,1763,1754,1825,1789,1795,1785,1810,1835,1811,1821,
-    1766,1842,1854,1759,1734,1841,1866,1723,1732,1798,1816,1732,1676,1828,1799,1741,
-    1733,1814,1851,1738,1740,1869,1816,1719,1817,1834,1779,1779,1821,1762,1786,1717,
-    1835,1776,1726,1782,1783,1793,1750,1783,1776,1812,1752,1778,1825,1803,1797,1791,
-    1798,1854,1752,1802,1802,1771,1798,1788,1764,1767,1809,1769,1736,1793,1800,1802,
-    1736,1774,1850,1728,1788,1808,1822,1754,1797,1806,1790,1786,1775,1825,1805,1768,
-    1771,1794,1795,1768,1765,1805,1742,1739,1763,1800,1739,1740,1815,1811,1738,1769,
-    1795,1797,1760,1730,1820,1774,1769,1769,1806,1805,1785,1786,1832,1831,1769,1785,
-    1860,1802,1741,1796,1842,1816,1698,1785,1835,1774,1740,1791,1810,1754,1744,1833,
-    1841,1722,1841,1866,1778,1781,1848,1833,1699,1757,1837,1771,1692,1780,1788,1738,
-    1737,1816,1802,1724,1786,1841,1795,1704,1816,1859,1769,1745,1831,1834,1748,1742,
-    1830,1827,1734,1781,1821,1774,1744,1822,1773,1768,1807,1766,1789,1757,1781,1750,
-    1775,1806,1747,1764,1818,1797,1738,1818,1819,1751,1794,1751,1809,1813,1741,1807,
-    1792,1800,1771,1785,1799,1753,1759,1793,1805,1735,1808,1795,1781,1812,1783,1794,
-    1789,1841,1774,1794,1779,1827,1775,1733,1850,1781,1780,1773,1794,1804,1752,1779,
-    1788,1784,1767,1766,1785,1763,1774,1724,1824,1795,1736,1813,1822,1792,1737,1842,
-    1788,1761,1788,1796,1800,1736,1812,1804,1756,1780,1799,1769,1736,1772,1815,1763,
-    1767,1815,1793,1775,1804,1824,1774,1797,1825,1811,1762,1797,1820,1768,1763,1802,
-    1807,1730,1764,1842,1776,1734,1820,1832,1774,1743,1827,1812,1761,1759,1781,1802,
-    1746,1800,1798,1787,1778,1787,1810,1763,1799,1789,1800,1810,1775,1836,1804,1807,
-    1800,1840,1801,1772,1809,1784,1780,1747,1821,1776,1731,1786,1800,1748,1780,1759,
-    1795,1775,1753,1828,1758,1785,1786,1818,1754,1763,1811,1761,1771,1751,1785,1746,
-    1745,1763,1730,1758,1769,1730,1776,1785,1746,1765,1787,1803,1744,1798,1812,1812,
-    1782,1794,1835,1794,1808,1792,1811,1795,1802,1813,1801,1792,1806,1812,1811,1818,
-    1833,1806,1833,1823,1825,1815,1809,1864,1823,1813,1835,1847,1822,1845,1817,1829,
-    1830,1830,1822,1833,1828,1807,1816,1811,1812,1778,1793,1786,1782,1760,1787,1762,
-    1741,1762,1739,1752,1732,1750,1753,1734,1729,1742,1766,1713,1738,1744,1749,1702,
-    1725,1779,1702,1735,1730,1758,1693,1705,1771,1716,1677,1730,1762,1674,1693,1730,
-    1707,1686,1695,1719,1688,1643,1708,1711,1653,1661,1792,1800,1706,1816,1998,1948,
-    1853,1991,2074,2049,2039,2078,2116,2067,2103,2105,2007,2013,2033,2004,1892,1882,
-    1896,1854,1766,1725,1742,1701,1697,1649,1613,1647,1670,1638,1619,1652,1695,1710,
-    1693,1700,1757,1784,1796,1763,1793,1838,1833,1825,1811,1847,1850,1843,1821,1794,
-    1801,1798,1766,1734,1701,1744,1700,1663,1664,1672,1674,1648,1642,1630,1670,1647,
-    1658,1661,1659,1684,1695,1685,1662,1667,1720,1687,1646,1668,1691,1645,1612,1631,
-    1583,1579,1570,1675,1689,1613,1746,1906,1891,1865,1980,2087,2138,2117,2157,2208,
-    2192,2247,2202,2129,2144,2163,2100,1997,1951,1967,1935,1818,1778,1766,1743,1715,
-    1661,1608,1620,1633,1613,1575,1560,1613,1637,1595,1593,1626,1676,1705,1684,1725,
-    1769,1812,1854,1846,1862,1914,1950,1943,1920,1936,1969,1962,1920,1916,1908,1902,
-    1891,1826,1799,1787,1778,1737,1673,1661,1659,1638,1602,1578,1581,1596,1581,1560,
-    1583,1597,1599,1610,1607,1635,1672,1681,1685,1705,1718,1733,1725,1723,1708,1703,
-    1743,1691,1619,1629,1677,1612,1539,1528,1637,1722,1620,1593,1805,1954,1892,1872,
-    2010,2169,2178,2187,2205,2230,2300,2323,2232,2155,2210,2243,2146,2018,1999,2039,
-    1977,1873,1784,1758,1769,1734,1618,1549,1584,1596,1538,1439,1459,1518,1520,1486,
-    1487,1527,1571,1607,1621,1624,1679,1765,1800,1795,1825,1920,1960,1951,1973,2010,
-    2044,2040,2024,2016,2015,2017,1993,1932,1896,1905,1860,1810,1763,1737,1720,1679,
-    1628,1604,1602,1598,1587,1566,1572,1592,1594,1590,1602,1628,1662,1662,1663,1685,
-    1710,1726,1712,1714,1724,1724,1730,1698,1690,1702,1691,1660,1619,1597,1601,1592,
-    1550,1515,1542,1537,1639,1758,1602,1649,2050,2098,1819,1994,2341,2304,2187,2296,
-    2388,2345,2390,2386,2223,2206,2305,2234,2029,1930,2010,2017,1798,1657,1714,1720,
-    1636,1553,1474,1479,1529,1511,1416,1366,1462,1537,1476,1413,1496,1608,1631,1608,
-    1650,1729,1808,1861,1861,1865,1937,2023,2014,1968,1998,2063,2073,2030,1969,1988,
-    2035,1992,1898,1866,1890,1890,1811,1718,1707,1706,1669,1602,1552,1571,1587,1563,
-    1522,1523,1577,1604,1585,1577,1633,1704,1728,1705,1731,1819,1837,1817,1825,1860,
-    1891,1878,1845,1824,1837,1844,1790,1739,1733,1741,1687,1628,1596,1580,1560,1516,
-    1471,1476,1491,1459,1436,1525,1709,1590,1520,1888,2096,1832,1853,2246,2326,2175,
-    2228,2384,2367,2378,2405,2305,2247,2309,2301,2153,1988,1998,2099,1944,1696,1715,
-    1789,1708,1556,1483,1489,1528,1494,1401,1366,1416,1512,1501,1414,1432,1582,1654,
-    1595,1573,1680,1779,1792,1775,1785,1846,1919,1918,1870,1870,1927,1975,1918,1842,
-    1856,1927,1910,1818,1815,1844,1869,1840,1774,1776,1811,1815,1777,1745,1747,1791,
-    1791,1740,1723,1746,1792,1773,1729,1743,1797,1820,1793,1775,1802,1836,1813,1793,
-    1775,1781,1795,1756,1701,1696,1700,1683,1639,1606,1605,1607,1596,1560,1526,1558,
-    1594,1534,1488,1514,1551,1533,1509,1527,1556,1584,1595,1683,1835,1754,1734,2069,
-    2246,2011,2031,2387,2481,2304,2262,2440,2484,2384,2314,2277,2267,2226,2146,2063,
-    1928,1883,1937,1835,1616,1576,1682,1662,1483,1365,1461,1547,1446,1352,1365,1441,
-    1490,1452,1408,1447,1557,1613,1597,1574,1649,1765,1792,1761,1761,1846,1943,1928,
-    1871,1901,1963,1987,1952,1899,1897,1962,1975,1926,1869,1887,1963,1933,1860,1818,
-    1873,1923,1875,1787,1771,1856,1862,1783,1723,1774,1843,1800,1739,1729,1795,1820,
-    1752,1709,1732,1772,1751,1700,1657,1674,1691,1655,1590,1550,1589,1612,1558,1501,
-    1521,1583,1573,1529,1541,1606,1637,1631,1634,1637,1706,1721,1702,1678,1724,1778,
-    1754,1757,1763,1782,1833,1903,1951,1924,1936,2127,2251,2131,2059,2228,2383,2323,
-    2150,2126,2270,2315,2139,1972,1984,2070,2026,1843,1707,1756,1847,1743,1566,1538,
-    1622,1650,1550,1443,1469,1527,1531,1477,1445,1486,1527,1537,1547,1550,1574,1622,
-    1653,1687,1711,1733,1771,1802,1848,1888,1878,1878,1943,1982,1968,1950,1973,1999,
-    1982,1966,1971,1969,1951,1941,1933,1940,1918,1884,1868,1864,1873,1851,1812,1774,
-    1768,1786,1775,1710,1680,1703,1713,1684,1661,1671,1668,1650,1642,1644,1635,1626,
-    1621,1615,1604,1600,1599,1585,1582,1600,1610,1610,1639,1660,1663,1684,1721,1741,
-    1742,1759,1790,1811,1810,1826,1837,1836,1833,1843,1842,1837,1841,1840,1844,1840,
-    1834,1819,1821,1815,1830,1859,1858,1872,1909,1932,1938,1952,1965,1980,1986,1981,
-    1974,1971,1968,1957,1932,1887,1879,1878,1834,1799,1793,1802,1795,1772,1758,1755,
-    1754,1756,1728,1699,1701,1698,1688,1657,1630,1632,1645,1640,1622,1621,1643,1678,
-    1679,1679,1709,1750,1774,1786,1813,1842,1867,1890,1900,1896,1907,1925,1940,1933,
-    1921,1922,1923,1906,1884,1871,1850,1827,1812,1793,1760,1745,1739,1715,1689,1678,
-    1670,1667,1653,1638,1655,1677,1680,1683,1701,1718,1728,1745,1768,1778,1794,1816,
-    1829,1841,1845,1840,1853,1865,1846,1834,1834,1833,1814,1795,1799,1791,1771,1765,
-    1780,1773,1752,1764,1772,1751,1740,1740,1749,1758,1755,1749,1751,1763,1773,1761,
-    1758,1779,1788,1796,1799,1804,1809,1818,1822,1822,1828,1824,1829,1822,1816,1826,
-    1815,1797,1782,1774,1761,1740,1722,1716,1715,1706,1690,1688,1692,1682,1682,1683,
-    1682,1691,1699,1706,1722,1747,1770,1785,1799,1817,1845,1863,1870,1882,1903,1925,
-    1938,1937,1938,1948,1958,1953,1934,1915,1917,1915,1890,1857,1843,1836,1817,1793,
-    1776,1767,1743,1729,1723,1704,1689,1695,1693,1681,1686,1693,1693,1708,1724,1729,
-    1743,1760,1773,1779,1790,1810,1820,1828,1832,1833,1845,1848,1838,1832,1829,1816,
-    1810,1810,1799,1791,1784,1767,1759,1753,1741,1736,1733,1734,1735,1728,1721,1723,
-    1722,1718,1715,1719,1734,1743,1748,1755,1759,1767,1778,1777,1778,1795,1803,1798,
-    1808,1822,1829,1825,1829,1828,1829,1843,1845,1838,1831,1834,1828,1821,1811,1805,
-    1796,1792,1791,1788,1777,1769,1773,1776,1773,1764,1769,1781,1781,1773,1770,1773,
-    1777,1777,1782,1779,1782,1795,1793,1791,1793,1804,1812,1805,1806,1814,1822,1823,
-    1823,1812,1810,1816,1819,1808,1799,1809,1813,1802,1794,1797,1792,1790,1777,1772,
-    1775,1775,1764,1759,1759,1757,1762,1767,1762,1759,1775,1775,1770,1771,1770,1774,
-    1775,1767,1770,1780,1774,1774,1783,1782,1775,1772,1772,1778,1783,1774,1771,1777,
-    1779,1773,1774,1774,1777,1788,1787,1781,1779,1779,1786,1789,1780,1781,1788,1788,
-    1787,1776,1770,1776,1778,1771,1764,1775,1779,1776,1784,1784,1774,1785,1795,1789,
-    1792,1801,1815,1811,1803,1810,1814,1814,1815,1816,1813,1820,1832,1820,1807,1810,
-    1810,1800,1792,1798,1803,1801,1797,1789,1783,1785,1783,1775,1765,1761,1759,1759,
-    1754,1746,1745,1755,1758,1748,1743,1752,1761,1767,1768,1768,1778,1785,1788,1790,
-    1795,1804,1807,1808,1806,1810,1813,1806,1805,1804,1807,1808,1804,1800,1795,1791,
-    1784,1771,1768,1771,1771,1764,1757,1758,1755,1754,1752,1755,1761,1764,1756,1748,
-    1759,1762,1761,1766,1767,1775,1785,1789,1790,1795,1799,1799,1798,1798,1800,1803,
-    1798,1790,1788,1786,1785,1785,1788,1786,1786,1792,1789,1786,1782,1780,1778,1772,
-    1767,1772,1780,1774,1772,1772,1781,1789,1787,1785,1788,1794,1796,1799,1798,1797,
-    1793,1795,1802,1797,1794,1802,1802,1796,1794,1795,1798,1800,1797,1788,1786,1783,
-    1776,1776,1772,1777,1776,1770,1769,1767,1770,1774,1776,1772,1772,1773,1779,1778,
-    1778,1784,1795,1804,1804,1807,1818,1821,1814,1815,1815,1820,1821,1822,1821,1824,
-    1828,1825,1818,1812,1817,1815,1807,1797,1788,1788,1779,1764,1762,1761,1759,1758,
-    1762,1764,1763,1762,1758,1754,1757,1764,1766,1767,1772,1778,1787,1783,1779,1785,
-    1793,1800,1802,1810,1816,1821,1822,1807,1801,1803,1801,1793,1782,1788,1794,1789,
-    1778,1777,1780,1782,1780,1776,1775,1768,1766,1767,1757,1757,1766,1765,1764,1768,
-    1764,1767,1775,1783,1781,1777,1789,1796,1792,1792,1798,1809,1809,1803,1803,1801,
-    1808,1807,1800,1792,1797,1801,1793,1787,1787,1790,1789,1785,1783,1781,1782,1779,
-    1773,1781,1783,1786,1779,1778,1782,1781,1784,1786,1784,1785,1791,1789,1788,1791,
-    1800,1799,1798,1804,1804,1802,1806,1803,1804,1806,1807,1803,1798,1788,1786,1787,
-    1778,1772,1767,1767,1763,1760,1755,1755,1759,1749,1746,1746,1749,1756,1760,1759,
-    1761,1771,1769,1773,1781,1786,1795,1801,1803,1802,1808,1810,1814,1811,1804,1810,
-    1813,1812,1809,1811,1808,1805,1802,1797,1791,1789,1790,1788,1787,1784,1786,1783,
-    1776,1777,1780,1784,1781,1779,1783,1781,1783,1782,1779,1776,1778,1781,1777,1770,
-    1771,1769,1769,1770,1769,1774,1776,1787,1791,1793,1791,1794,1794,1791,1788,1794,
-    1798,1794,1791,1790,1795,1794,1793,1793,1789,1788,1793,1792,1788,1792,1794,1791,
-    1784,1788,1797,1795,1794,1795,1798,1799,1800,1799,1799,1798,1800,1798,1790,1782,
-    1781,1780,1776,1774,1779,1776,1777,1774,1772,1772,1766,1765,1759,1765,1762,1763,
-    1761,1765,1766,1768,1771,1769,1775,1781,1782,1781,1788,1794,1800,1798,1802,1804,
-    1805,1809,1810,1813,1810,1806,1806,1802,1799,1800,1796,1795,1789,1790,1789,1778,
-    1781,1785,1781,1780,1778,1775,1770,1773,1768,1770,1774,1777,1778,1778,1780,1780,
-    1782,1776,1778,1781,1778,1770,1776,1780,1774,1773,1777,1777,1782,1785,1786,1786,
-    1784,1787,1786,1788,1791,1801,1803,1802,1802,1800,1798,1795,1794,1795,1793,1787,
-    1788,1791,1795,1789,1792,1796,1796,1796,1796,1796,1798,1792,1788,1788,1782,1784,
-    1783,1778,1776,1780,1779,1776,1769,1773,1776,1774,1773,1770,1777,1779,1773,1768,
-    1773,1784,1795,1802,1810,1816,1809,1830,1831,1805,1789,1794,1789,1767,1760,1766,
-    1766,1759,1755,1771,1778,1769,1770,1780,1818,1814,1823,1828,1833,1819,1813,1808,
-    1784,1763,1747,1758,1749,1738,1741,1746,1741,1745,1758,1765,1764,1780,1790,1794,
-    1793,1788,1781,1783,1772,1772,1783,1790,1785,1791,1789,1778,1773,1766,1764,1767,
-    1774,1774,1786,1788,1787,1787,1793,1788,1799,1810,1811,1815,1821,1817,1819,1828,
-    1828,1832,1836,1833,1830,1839,1838,1834,1832,1826,1817,1817,1813,1809,1808,1804,
-    1802,1799,1793,1783,1785,1783,1774,1778,1778,1781,1786,1785,1781,1780,1782,1777,
-    1772,1764,1761,1766,1764,1753,1753,1755,1750,1751,1756,1749,1743,1748,1747,1746,
-    1740,1743,1751,1761,1763,1758,1753,1748,1744,1738,1737,1736,1747,1755,1757,1758,
-    1759,1755,1745,1732,1728,1733,1735,1741,1745,1751,1763,1762,1767,1764,1763,1774,
-    1781,1795,1808,1820,1826,1828,1833,1852,1884,1909,1935,1983,2023,2036,2026,2006,
-    1961,1902,1829,1758,1714,1684,1657,1661,1680,1698,1715,1728,1738,1751,1772,1786,
-    1810,1840,1866,1875,1881,1875,1865,1834,1809,1786,1777,1765,1761,1777,1801,1826,
-    1842,1859,1866,1877,1871,1852,1833,1808,1774,1747,1723,1715,1706,1704,1704,1723,
-    1739,1742,1743,1742,1737,1724,1705,1681,1669,1657,1640,1630,1631,1637,1641,1658,
-    1679,1698,1722,1745,1764,1773,1775,1764,1748,1718,1698,1681,1676,1676,1674,1688,
-    1705,1706,1703,1690,1675,1630,1599,1578,1679,1828,1929,2122,2371,2555,2646,2657,
-    2593,2456,2238,1955,1715,1582,1448,1372,1379,1462,1522,1570,1588,1613,1661,1681,
-    1708,1797,1907,2005,2090,2142,2163,2134,2041,1908,1799,1684,1574,1512,1512,1524,
-    1559,1606,1655,1696,1716,1716,1730,1764,1794,1836,1897,1956,2011,2038,2023,1991,
-    1938,1849,1762,1688,1637,1600,1591,1594,1626,1666,1704,1732,1767,1813,1835,1879,
-    1912,1949,1962,1962,1958,1936,1881,1822,1771,1734,1683,1662,1654,1670,1685,1693,
-    1706,1709,1714,1701,1698,1704,1708,1705,1708,1705,1700,1682,1662,1636,1618,1594,
-    1600,1622,1659,1699,1745,1787,1819,1844,1844,1834,1829,1813,1791,1760,1740,1712,
-    1686,1668,1628,1610,1563,1529,1470,1558,1773,1869,2026,2360,2635,2742,2798,2794,
-    2690,2463,2099,1775,1576,1344,1164,1143,1233,1320,1402,1493,1595,1695,1718,1738,
-    1853,1947,1993,2093,2197,2242,2232,2147,2036,1931,1741,1545,1439,1381,1339,1354,
-    1424,1525,1619,1670,1713,1768,1791,1784,1808,1859,1925,1987,2048,2102,2126,2088,
-    2006,1912,1801,1678,1574,1529,1532,1582,1623,1709,1815,1885,1904,1924,1942,1930,
-    1911,1895,1909,1923,1905,1876,1856,1804,1721,1641,1602,1570,1559,1562,1607,1656,
-    1679,1695,1712,1721,1702,1676,1660,1673,1675,1669,1691,1722,1730,1723,1716,1709,
-    1695,1679,1686,1702,1726,1736,1767,1791,1798,1785,1765,1746,1725,1698,1665,1620,
-    1586,1532,1521,1728,1827,1917,2220,2533,2661,2779,2844,2781,2608,2279,1919,1687,
-    1431,1157,1098,1140,1197,1289,1418,1520,1655,1691,1702,1782,1854,1871,1962,2075,
-    2134,2176,2177,2115,2043,1886,1660,1534,1418,1304,1280,1345,1431,1564,1676,1779,
-    1889,1933,1920,1937,1935,1918,1927,1953,1979,2027,2039,2027,2008,1931,1816,1715,
-    1609,1525,1480,1487,1560,1632,1745,1845,1951,1988,2005,2000,1959,1907,1855,1821,
-    1801,1792,1782,1788,1787,1773,1744,1726,1692,1678,1666,1664,1665,1679,1679,1682,
-    1681,1654,1645,1631,1622,1615,1629,1642,1659,1679,1698,1712,1729,1733,1743,1751,
-    1760,1770,1779,1779,1773,1773,1743,1710,1671,1646,1614,1565,1520,1519,1509,1677,
-    1847,1954,2220,2540,2719,2833,2940,2897,2751,2457,2102,1803,1523,1203,1061,1048,
-    1085,1162,1308,1463,1599,1691,1733,1812,1876,1875,1913,2026,2068,2110,2144,2137,
-    2083,1970,1790,1656,1520,1360,1288,1312,1360,1458,1595,1733,1881,1970,2010,2033,
-    2030,1979,1941,1923,1928,1951,1968,1995,2015,1980,1900,1813,1708,1597,1493,1450,
-    1458,1532,1631,1738,1877,1983,2047,2040,2017,1967,1909,1828,1775,1759,1739,1725,
-    1724,1727,1716,1705,1679,1669,1669,1664,1667,1694,1705,1713,1714,1705,1692,1668,
-    1643,1622,1612,1590,1600,1629,1653,1683,1715,1743,1769,1786,1786,1794,1802,1781,
-    1773,1771,1754,1728,1713,1692,1683,1644,1612,1600,1596,1576,1577,1752,1866,1970,
-    2207,2486,2639,2762,2840,2807,2684,2401,2082,1807,1505,1203,1091,1063,1085,1172,
-    1314,1475,1640,1729,1798,1890,1912,1897,1916,1958,1964,1985,1996,1998,1989,1916,
-    1811,1726,1614,1487,1415,1402,1410,1466,1552,1669,1790,1867,1927,1979,1998,1966,
-    1943,1935,1932,1931,1939,1963,1985,1959,1909,1872,1804,1713,1637,1593,1564,1562,
-    1594,1654,1729,1779,1821,1875,1906,1896,1881,1882,1870,1839,1805,1783,1762,1727,
-    1696,1679,1666,1644,1631,1625,1622,1632,1641,1657,1677,1690,1696,1704,1705,1697,
-    1690,1685,1688,1679,1688,1696,1726,1745,1770,1795,1816,1826,1820,1823,1796,1798,
-    1761,1738,1710,1695,1665,1644,1626,1622,1619,1692,1823,1917,2074,2294,2506,2605,
-    2704,2728,2669,2481,2219,1963,1725,1455,1248,1171,1152,1196,1272,1421,1565,1694,
-    1771,1847,1904,1894,1872,1883,1884,1874,1879,1891,1914,1912,1882,1844,1806,1721,
-    1635,1580,1549,1534,1549,1602,1678,1756,1819,1888,1928,1939,1937,1924,1912,1914,
-    1913,1929,1961,1972,1963,1964,1913,1844,1777,1692,1615,1560,1532,1516,1556,1592,
-    1651,1723,1781,1833,1883,1903,1898,1897,1875,1849,1828,1796,1764,1749,1717,1693,
-    1680,1653,1625,1609,1597,1600,1613,1630,1659,1692,1707,1710,1722,1710,1699,1689,
-    1683,1692,1706,1732,1762,1799,1823,1839,1856,1843,1815,1777,1748,1698,1676,1650,
-    1650,1660,1667,1678,1710,1749,1832,1988,2033,2173,2344,2456,2493,2548,2522,2406,
-    2234,1992,1802,1591,1386,1251,1240,1245,1313,1436,1575,1702,1799,1860,1917,1918,
-    1867,1835,1824,1791,1761,1777,1787,1804,1812,1799,1797,1776,1722,1688,1677,1658,
-    1652,1680,1715,1772,1816,1855,1900,1931,1933,1940,1939,1933,1933,1927,1931,1924,
-    1900,1863,1820,1764,1701,1637,1584,1559,1546,1551,1594,1650,1717,1776,1830,1870,
-    1889,1883,1863,1838,1813,1776,1754,1751,1740,1747,1742,1744,1748,1744,1727,1723,
-    1711,1689,1682,1681,1684,1688,1706,1711,1714,1721,1726,1725,1726,1722,1726,1738,
-    1757,1782,1807,1830,1835,1841,1821,1797,1773,1737,1717,1699,1688,1690,1711,1741,
-    1815,1877,1945,2031,2108,2161,2192,2207,2191,2157,2085,2018,1937,1851,1772,1707,
-    1660,1634,1618,1615,1632,1659,1687,1713,1737,1748,1754,1759,1761,1756,1761,1769,
-    1778,1793,1805,1817,1833,1824,1815,1807,1788,1771,1751,1740,1743,1751,1768,1794,
-    1818,1837,1852,1859,1865,1861,1845,1842,1834,1830,1831,1829,1826,1816,1795,1764,
-    1726,1679,1644,1611,1590,1585,1603,1629,1673,1719,1755,1781,1799,1809,1803,1799,
-    1785,1770,1757,1748,1748,1750,1747,1758,1764,1761,1758,1741,1734,1721,1700,1690,
-    1691,1693,1691,1711,1721,1725,1730,1741,1747,1744,1754,1764,1786,1793,1815,1845,
-    1892,1909,1944,1997,2026,2041,2034,2038,2010,1964,1901,1851,1795,1747,1717,1706,
-    1708,1722,1752,1789,1827,1849,1872,1888,1891,1876,1852,1829,1805,1769,1747,1747,
-    1744,1734,1729,1732,1731,1733,1733,1733,1737,1733,1730,1736,1738,1740,1752,1760,
-    1771,1785,1803,1820,1832,1838,1837,1842,1836,1833,1834,1831,1818,1810,1799,1785,
-    1764,1743,1736,1739,1743,1750,1768,1787,1809,1818,1824,1820,1803,1777,1748,1716,
-    1682,1657,1642,1643,1659,1680,1710,1739,1771,1790,1804,1807,1800,1792,1771,1761,
-    1751,1755,1761,1774,1783,1788,1797,1801,1797,1797,1796,1789,1785,1776,1768,1764,
-    1765,1755,1751,1755,1760,1768,1777,1793,1816,1845,1865,1891,1915,1927,1931,1926,
-    1913,1895,1860,1820,1788,1761,1734,1717,1727,1724,1738,1761,1793,1819,1845,1871,
-    1879,1884,1870,1859,1841,1826,1805,1793,1785,1779,1774,1764,1761,1755,1745,1744,
-    1743,1736,1736,1732,1723,1717,1724,1723,1724,1737,1749,1763,1780,1796,1803,1813,
-    1820,1822,1818,1810,1803,1791,1786,1785,1777,1771,1770,1764,1759,1755,1755,1754,
-    1751,1759,1757,1756,1767,1763,1766,1772,1768,1759,1752,1740,1727,1718,1715,1716,
-    1715,1727,1735,1746,1753,1761,1768,1777,1782,1777,1778,1773,1769,1778,1791,1809,
-    1830,1863,1893,1923,1945,1961,1964,1956,1936,1908,1880,1832,1802,1773,1750,1726,
-    1717,1719,1731,1748,1763,1775,1790,1802,1808,1809,1803,1801,1795,1794,1788,1786,
-    1784,1785,1782,1774,1762,1759,1756,1755,1768,1773,1783,1793,1798,1804,1804,1795,
-    1793,1792,1785,1785,1784,1785,1779,1781,1782,1787,1790,1788,1784,1773,1769,1765,
-    1756,1747,1744,1739,1745,1755,1766,1775,1790,1808,1820,1828,1836,1835,1824,1812,
-    1805,1796,1784,1779,1776,1781,1781,1778,1774,1773,1768,1763,1761,1759,1760,1766,
-    1774,1775,1782,1783,1789,1792,1790,1793,1792,1787,1785,1789,1790,1800,1813,1821,
-    1820,1828,1830,1834,1838,1831,1830,1830,1822,1813,1804,1797,1789,1786,1784,1786,
-    1793,1790,1787,1788,1786,1779,1778,1770,1763,1757,1748,1740,1734,1733,1738,1749,
-    1757,1772,1785,1790,1793,1794,1794,1789,1785,1783,1784,1787,1787,1785,1788,1788,
-    1781,1779,1775,1773,1772,1766,1766,1763,1764,1768,1770,1770,1776,1775,1767,1769,
-    1767,1767,1765,1772,1776,1780,1784,1784,1781,1781,1779,1769,1759,1754,1748,1745,
-    1752,1761,1774,1783,1795,1813,1825,1838,1849,1849,1850,1850,1845,1839,1833,1827,
-    1820,1818,1809,1802,1793,1780,1769,1762,1756,1762,1763,1770,1783,1795,1808,1812,
-    1816,1812,1811,1806,1802,1796,1790,1787,1776,1771,1766,1767,1774,1777,1777,1778,
-    1781,1778,1773,1769,1764,1763,1760,1759,1756,1754,1755,1755,1765,1774,1778,1783,
-    1787,1789,1786,1783,1774,1765,1757,1747,1739,1737,1737,1741,1755,1765,1771,1769,
-    1771,1773,1771,1766,1764,1763,1765,1763,1766,1772,1777,1784,1785,1786,1794,1796,
-    1794,1795,1797,1808,1818,1833,1841,1855,1862,1872,1875,1874,1876,1869,1860,1854,
-    1844,1835,1824,1816,1812,1805,1798,1792,1790,1784,1779,1774,1774,1768,1770,1774,
-    1778,1786,1786,1788,1795,1792,1785,1784,1776,1770,1763,1759,1759,1757,1757,1759,
-    1761,1767,1767,1769,1770,1772,1774,1776,1779,1783,1795,1803,1810,1811,1814,1817,
-    1810,1799,1788,1784,1782,1776,1767,1770,1765,1768,1767,1773,1784,1786,1785,1780,
-    1784,1780,1778,1771,1768,1762,1762,1760,1757,1760,1760,1767,1771,1773,1781,1782,
-    1784,1780,1772,1767,1762,1760,1761,1767,1776,1788,1795,1803,1808,1809,1801,1801,
-    1798,1790,1789,1789,1790,1796,1801,1806,1808,1805,1803,1799,1793,1784,1777,1776,
-    1775,1779,1786,1788,1798,1799,1796,1789,1782,1779,1769,1764,1765,1772,1773,1775,
-    1783,1788,1788,1787,1779,1769,1774,1771,1764,1763,1767,1777,1786,1788,1791,1802,
-    1806,1809,1808,1809,1808,1806,1804,1801,1798,1797,1795,1793,1793,1787,1787,1784,
-    1780,1782,1781,1781,1783,1780,1778,1778,1778,1774,1769,1769,1775,1780,1779,1780,
-    1785,1789,1787,1788,1792,1796,1801,1809,1813,1815,1815,1815,1813,1808,1807,1801,
-    1794,1795,1791,1793,1788,1782,1785,1783,1784,1785,1790,1795,1802,1802,1798,1790,
-    1782,1773,1771,1769,1764,1772,1778,1783,1791,1795,1793,1791,1786,1780,1775,1776,
-    1778,1786,1798,1803,1812,1817,1821,1821,1818,1805,1793,1784,1772,1767,1766,1773,
-    1782,1786,1780,1779,1779,1779,1778,1777,1773,1772,1774,1771,1771,1768,1775,1779,
-    1780,1779,1775,1769,1761,1759,1756,1760,1768,1778,1779,1777,1786,1788,1788,1791,
-    1797,1801,1801,1798,1794,1797,1794,1801,1806,1806,1808,1803,1791,1780,1779,1779,
-    1773,1777,1780,1787,1790,1786,1785,1782,1784,1785,1783,1784,1782,1779,1773,1771,
-    1776,1777,1777,1780,1785,1789,1794,1789,1785,1784,1785,1783,1779,1785,1784,1785,
-    1781,1776,1777,1782,1783,1782,1789,1801,1809,1809,1807,1810,1810,1806,1804,1798,
-    1802,1799,1791,1786,1788,1789,1789,1789,1786,1786,1783,1782,1775,1771,1774,1779,
-    1777,1774,1785,1796,1791,1789,1786,1783,1785,1783,1778,1774,1782,1787,1790,1790,
-    1794,1793,1789,1786,1781,1781,1775,1772,1773,1773,1777,1778,1778,1785,1787,1787,
-    1792,1794,1795,1791,1785,1785,1787,1791,1789,1790,1793,1789,1781,1777,1776,1778,
-    1783,1780,1785,1789,1789,1788,1781,1777,1776,1780,1776,1774,1772,1774,1777,1777,
-    1779,1784,1782,1783,1790,1788,1789,1792,1795,1793,1790,1788,1791,1793,1795,1794,
-    1794,1791,1792,1789,1788,1792,1791,1793,1791,1795,1798,1799,1796,1790,1781,1780,
-    1781,1777,1779,1784,1782,1783,1787,1791,1789,1790,1792,1784,1784,1790,1788,1786,
-    1787,1789,1796,1790,1786,1787,1781,1780,1776,1778,1781,1786,1795,1799,1801,1800,
-    1799,1791,1787,1781,1778,1778,1777,1779,1781,1780,1778,1783,1781,1778,1774,1772,
-    1770,1770,1763,1763,1771,1776,1782,1783,1784,1789,1787,1785,1782,1786,1787,1786,
-    1784,1782,1786,1793,1796,1794,1796,1796,1797,1790,1786,1776,1769,1771,1778,1779,
-    1782,1789,1789,1785,1784,1786,1787,1790,1789,1792,1793,1792,1790,1789,1789,1793,
-    1798,1802,1802,1802,1799,1800,1797,1795,1796,1789,1787,1785,1786,1787,1787,1783,
-    1777,1775,1773,1777,1773,1775,1781,1782,1778,1775,1775,1769,1769,1763,1765,1772,
-    1773,1776,1779,1779,1785,1785,1784,1784,1781,1780,1774,1777,1772,1770,1772,1776,
-    1781,1777,1778,1778,1773,1767,1765,1767,1769,1771,1782,1786,1784,1783,1783,1780,
-    1782,1784,1787,1789,1789,1790,1790,1795,1795,1790,1793,1797,1796,1796,1792,1792,
-    1790,1786,1786,1789,1791,1791,1791,1795,1797,1791,1785,1781,1781,1777,1779,1776,
-    1782,1788,1786,1785,1785,1784,1785,1787,1792,1796,1798,1800,1799,1801,1803,1801,
-    1800,1802,1800,1802,1800,1795,1791,1787,1788,1785,1784,1784,1784,1789,1785,1785,
-    1787,1788,1788,1783,1784,1786,1786,1781,1781,1790,1791,1789,1792,1795,1792,1786,
-    1784,1786,1792,1790,1782,1776,1771,1773,1775,1774,1779,1780,1780,1781,1778,1778,
-    1780,1779,1781,1781,1782,1786,1786,1785,1785,1787,1789,1785,1787,1788,1788,1791,
-    1785,1785,1784,1784,1788,1790,1796,1802,1802,1807,1808,1805,1804,1801,1796,1792,
-    1799,1801,1794,1786,1779,1774,1771,1772,1774,1776,1778,1775,1769,1765,1764,1764,
-    1770,1768,1772,1776,1776,1775,1772,1774,1772,1776,1773,1774,1778,1779,1785,1782,
-    1782,1780,1779,1780,1778,1780,1782,1787,1790,1792,1791,1791,1792,1787,1787,1788,
-    1788,1787,1786,1791,1789,1786,1784,1788,1792,1791,1793,1790,1790,1788,1788,1789,
-    1791,1793,1794,1793,1789,1790,1786,1782,1777,1778,1783,1784,1787,1792,1792,1786,
-    1792,1798,1800,1797,1792,1792,1789,1787,1780,1779,1780,1777,1778,1782,1785,1786,
-    1781,1777,1773,1779,1777,1778,1788,1789,1786,1786,1788,1792,1793,1786,1785,1785,
-    1786,1783,1781,1785,1789,1789,1786,1787,1788,1787,1788,1787,1788,1790,1783,1779,
-    1782,1781,1782,1784,1782,1790,1792,1790,1793,1794,1792,1792,1789,1790,1793,1793,
-    1790,1794,1799,1801,1794,1789,1794,1796,1805,1806,1807,1804,1795,1792,1789,1787,
-    1788,1789,1797,1796,1797,1796,1793,1790,1785,1785,1783,1787,1787,1787,1788,1788,
-    1789,1792,1796,1794,1796,1793,1795,1799,1790,1786,1788,1790,1788,1783,1781,1783,
-    1781,1780,1776,1769,1768,1772,1772,1768,1768,1774,1776,1774,1774,1782,1787,1782,
-    1781,1783,1787,1789,1790,1795,1799,1798,1798,1800,1807,1812,1814,1812,1808,1801,
-    1791,1791,1787,1780,1778,1781,1784,1784,1782,1787,1784,1782,1784,1783,1783,1783,
-    1787,1787,1785,1784,1787,1787,1791,1791,1786,1785,1782,1777,1772,1772,1774,1775,
-    1781,1785,1789,1794,1790,1792,1794,1791,1795,1794,1790,1789,1785,1781,1778,1778,
-    1778,1776,1780,1788,1783,1786,1785,1784,1786,1785,1786,1784,1789,1789,1786,1785,
-    1788,1795,1796,1787,1788,1790,1792,1794,1792,1791,1791,1792,1787,1789,1795,1794,
-    1791,1787,1786,1786,1777,1775,1778,1782,1783,1786,1788,1784,1781,1779,1778,1775,
-    1777,1778,1783,1787,1788,1790,1791,1792,1795,1803,1805,1804,1803,1800,1796,1794,
-    1790,1782,1782,1779,1780,1783,1786,1788,1788,1790,1786,1782,1782,1781,1781,1774,
-    1784,1784,1782,1784,1781,1784,1781,1782,1781,1785,1786,1788,1786,1781,1787,1789,
-    1790,1795,1790,1792,1794,1788,1785,1783,1784,1780,1781,1784,1789,1789,1785,1783,
-    1781,1777,1777,1783,1788,1788,1793,1795,1791,1788,1785,1786,1788,1789,1786,1790,
-    1797,1796,1793,1791,1796,1793,1789,1789,1792,1795,1792,1789,1787,1787,1787,1786,
-    1781,1786,1790,1783,1784,1784,1781,1780,1781,1781,1784,1786,1790,1790,1789,1788,
-    1781,1778,1778,1778,1781,1782,1779,1786,1789,1784,1775,1775,1778,1774,1773,1772,
-    1776,1785,1781,1778,1775,1780,1782,1782,1784,1788,1790,1789,1790,1784,1785,1784,
-    1781,1779,1783,1787,1791,1792,1793,1795,1793,1793,1797,1803,1796,1792,1788,1784,
-    1785,1788,1789,1787,1787,1789,1792,1785,1783,1785,1787,1789,1786,1786,1790,1786,
-    1781,1781,1783,1784,1780,1780,1782,1780,1774,1780,1781,1784,1786,1784,1792,1799,
-    1802,1803,1800,1802,1799,1795,1797,1806,1807,1803,1804,1796,1787,1779,1767,1751,
-    1747,1746,1743,1748,1760,1767,1770,1770,1779,1784,1782,1781,1773,1763,1757,1746,
-    1732,1730,1731,1738,1744,1756,1768,1774,1780,1779,1775,1772,1774,1763,1755,1753,
-    1749,1744,1741,1744,1743,1751,1754,1750,1739,1724,1707,1701,1718,1737,1773,1817,
-    1889,2004,2094,2098,2076,2076,2009,1887,1781,1682,1599,1584,1588,1574,1629,1733,
-    1802,1854,1929,1983,2011,2037,2020,1964,1914,1839,1720,1624,1569,1527,1523,1564,
-    1618,1700,1805,1891,1936,1980,2012,1999,1969,1926,1865,1797,1740,1670,1610,1584,
-    1577,1602,1655,1732,1811,1882,1934,1963,1968,1956,1921,1873,1818,1763,1713,1662,
-    1629,1607,1609,1629,1666,1718,1774,1839,1901,1930,1938,1926,1895,1848,1800,1756,
-    1718,1697,1685,1682,1687,1704,1735,1763,1793,1828,1856,1880,1884,1874,1852,1822,
-    1780,1735,1701,1677,1668,1671,1684,1708,1747,1787,1814,1835,1859,1868,1866,1859,
-    1840,1817,1791,1765,1747,1744,1749,1752,1783,1808,1817,1830,1848,1860,1842,1823,
-    1804,1786,1776,1760,1749,1745,1744,1747,1745,1753,1768,1790,1801,1802,1796,1788,
-    1779,1759,1738,1724,1737,1742,1751,1761,1771,1783,1787,1784,1775,1774,1765,1753,
-    1743,1741,1734,1714,1709,1706,1716,1733,1748,1764,1778,1779,1755,1731,1703,1675,
-    1639,1604,1577,1561,1566,1596,1662,1748,1836,1981,2212,2393,2423,2426,2463,2374,
-    2142,1941,1754,1555,1452,1404,1327,1340,1490,1598,1666,1810,1972,2087,2206,2282,
-    2265,2218,2151,1977,1752,1590,1462,1342,1290,1314,1357,1450,1582,1686,1788,1932,
-    2056,2123,2169,2195,2154,2065,1947,1799,1648,1555,1507,1478,1504,1578,1653,1721,
-    1811,1880,1927,1965,1988,1981,1962,1928,1864,1794,1727,1668,1621,1599,1594,1611,
-    1654,1697,1729,1752,1777,1798,1807,1812,1809,1812,1804,1774,1732,1693,1668,1648,
-    1631,1641,1646,1672,1684,1678,1668,1656,1655,1637,1620,1603,1609,1607,1605,1605,
-    1614,1635,1674,1687,1719,1789,1983,2295,2522,2543,2553,2677,2626,2345,2071,1875,
-    1677,1543,1444,1312,1282,1401,1445,1415,1475,1629,1791,1969,2117,2217,2325,2370,
-    2260,2075,1932,1795,1665,1559,1483,1434,1435,1433,1394,1396,1478,1604,1740,1870,
-    2001,2114,2173,2152,2077,2014,1984,1954,1909,1845,1800,1769,1705,1610,1534,1512,
-    1525,1563,1622,1690,1768,1841,1863,1853,1848,1850,1849,1843,1836,1831,1811,1772,
-    1708,1642,1604,1588,1591,1599,1621,1651,1685,1697,1707,1729,1772,1802,1814,1834,
-    1834,1823,1808,1781,1730,1697,1661,1623,1586,1562,1535,1535,1556,1567,1601,1650,
-    1696,1731,1783,1824,1842,1872,1900,1955,2081,2204,2234,2238,2303,2322,2253,2162,
-    2086,2015,1957,1889,1770,1684,1651,1603,1529,1486,1505,1544,1609,1670,1721,1795,
-    1875,1908,1904,1929,1972,2003,2016,1996,1968,1946,1902,1813,1723,1687,1673,1666,
-    1659,1662,1675,1707,1719,1704,1725,1773,1814,1838,1855,1858,1850,1838,1797,1756,
-    1732,1724,1694,1660,1642,1636,1647,1653,1662,1682,1730,1767,1781,1771,1765,1747,
-    1729,1720,1709,1717,1747,1768,1776,1778,1778,1777,1789,1807,1816,1834,1856,1855,
-    1836,1801,1746,1695,1668,1647,1628,1627,1625,1634,1625,1618,1605,1628,1656,1688,
-    1710,1727,1747,1750,1767,1789,1858,1905,1978,2095,2177,2177,2162,2198,2181,2120,
-    2076,2047,2025,2017,1996,1933,1889,1860,1812,1770,1744,1728,1731,1724,1695,1693,
-    1711,1714,1707,1715,1739,1770,1791,1782,1760,1761,1760,1746,1740,1751,1771,1791,
-    1791,1766,1755,1748,1729,1721,1728,1741,1754,1765,1754,1743,1736,1725,1719,1719,
-    1728,1738,1751,1764,1767,1761,1761,1760,1761,1770,1781,1781,1778,1773,1762,1740,
-    1726,1720,1720,1730,1738,1741,1746,1760,1764,1763,1769,1788,1794,1798,1810,1808,
-    1797,1786,1759,1737,1747,1744,1735,1741,1746,1737,1727,1726,1716,1708,1712,1717,
-    1736,1764,1787,1805,1808,1801,1789,1787,1788,1784,1784,1802,1827,1850,1870,1892,
-    1932,1968,1989,1996,2011,2025,2016,2010,2007,1992,1962,1936,1915,1875,1837,1802,
-    1777,1757,1752,1744,1736,1749,1759,1775,1787,1782,1775,1784,1780,1755,1735,1739,
-    1735,1719,1698,1677,1656,1647,1638,1628,1647,1681,1697,1717,1736,1749,1755,1756,
-    1758,1763,1773,1783,1795,1795,1792,1791,1790,1792,1800,1807,1822,1829,1831,1821,
-    1806,1787,1764,1742,1737,1737,1735,1738,1738,1744,1733,1730,1730,1731,1737,1749,
-    1762,1774,1777,1765,1757,1748,1734,1722,1722,1729,1730,1740,1754,1759,1760,1768,
-    1778,1786,1791,1795,1800,1799,1795,1787,1784,1778,1772,1764,1769,1774,1781,1790,
-    1794,1794,1793,1801,1817,1825,1821,1836,1863,1885,1894,1903,1921,1937,1934,1928,
-    1931,1940,1938,1934,1916,1918,1922,1912,1888,1879,1865,1843,1825,1801,1787,1767,
-    1791,1740,1721,1728,1725,1715,1693,1709,1702,1700,1690,1695,1698,1689,1663,1663,
-    1667,1674,1678,1676,1706,1719,1731,1736,1741,1763,1785,1796,1796,1815,1826,1835,
-    1824,1819,1815,1807,1803,1799,1812,1806,1806,1810,1820,1815,1799,1786,1778,1768,
-    1753,1740,1738,1736,1729,1728,1726,1723,1724,1725,1727,1736,1745,1754,1762,1768,
-    1777,1782,1783,1778,1781,1795,1786,1785,1780,1785,1782,1759,1750,1751,1757,1757,
-    1764,1767,1772,1774,1773,1768,1766,1772,1765,1750,1743,1745,1746,1774,1812,1839,
-    1891,1945,1971,1982,2014,2047,2060,2050,2040,2018,1986,1944,1913,1889,1865,1833,
-    1801,1776,1755,1736,1719,1718,1710,1744,1737,1715,1717,1734,1745,1731,1731,1741,
-    1738,1727,1728,1738,1735,1718,1709,1718,1706,1708,1731,1746,1756,1773,1797,1794,
-    1784,1791,1809,1800,1801,1798,1803,1803,1801,1804,1797,1800,1815,1803,1786,1772,
-    1768,1759,1747,1755,1747,1735,1734,1731,1724,1720,1718,1719,1708,1706,1701,1705,
-    1716,1734,1753,1763,1771,1778,1782,1784,1779,1782,1785,1790,1795,1796,1805,1806,
-    1802,1802,1807,1806,1804,1804,1801,1796,1794,1787,1790,1791,1792,1785,1785,1794,
-    1804,1806,1802,1804,1806,1800,1796,1801,1803,1803,1792,1791,1786,1798,1807,1803,
-    1806,1823,1844,1845,1855,1872,1894,1907,1915,1919,1919,1919,1910,1900,1888,1885,
-    1873,1856,1844,1830,1813,1797,1787,1779,1776,1767,1751,1746,1747,1744,1742,1738,
-    1731,1723,1716,1709,1703,1705,1713,1714,1709,1718,1721,1722,1728,1733,1746,1754,
-    1756,1758,1767,1781,1784,1784,1790,1795,1800,1798,1803,1806,1812,1805,1803,1795,
-    1792,1773,1767,1760,1763,1767,1748,1761,1748,1751,1746,1753,1756,1758,1762,1759,
-    1754,1760,1762,1757,1762,1755,1758,1754,1753,1751,1753,1755,1757,1762,1770,1778,
-    1777,1772,1771,1770,1775,1783,1789,1791,1799,1804,1809,1807,1802,1801,1798,1802,
-    1801,1800,1794,1788,1778,1769,1769,1774,1772,1774,1785,1791,1799,1809,1815,1820,
-    1825,1823,1822,1823,1817,1814,1814,1806,1806,1811,1811,1808,1802,1805,1807,1810,
-    1812,1814,1817,1819,1814,1811,1811,1805,1804,1802,1795,1797,1798,1792,1790,1787,
-    1782,1774,1768,1758,1757,1755,1760,1759,1770,1768,1769,1763,1758,1754,1755,1762,
-    1764,1772,1768,1782,1763,1795,1758,1743,1753,1749,1761,1751,1764,1759,1762,1756,
-    1766,1761,1762,1758,1768,1778,1778,1779,1774,1793,1787,1790,1794,1789,1801,1800,
-    1801,1798,1794,1792,1791,1798,1803,1805,1801,1799,1794,1786,1787,1785,1789,1784,
-    1779,1778,1777,1776,1778,1773,1775,1776,1779,1784,1776,1781,1782,1787,1784,1789,
-    1790,1794,1797,1797,1797,1796,1799,1807,1814,1815,1820,1818,1822,1824,1830,1830,
-    1834,1841,1837,1838,1839,1839,1837,1833,1823,1823,1827,1821,1805,1800,1790,1790,
-    1779,1775,1773,1776,1777,1761,1776,1769,1772,1756,1772,1775,1778,1772,1769,1760,
-    1768,1761,1758,1764,1777,1774,1775,1813,1756,1781,1789,1806,1793,1781,1795,1789,
-    1787,1779,1798,1780,1771,1789,1791,1799,1779,1787,1783,1785,1776,1781,1782,1772,
-    1773,1779,1826,1748,1725,1747,1779,1746,1719,1730,1743,1718,1733,1785,1773,1747,
-    1791,1894,1818,1759,1797,1839,1810,1728,1728,1753,1729,1745,1798,1785,1738,1753,
-    1799,1838,1816,1801,1811,1818,1811,1830,1830,1774,1766,1771,1770,1748,1739,1728,
-    1725,1711,1731,1754,1738,1741,1766,1803,1812,1827,1833,1844,1856,1865,1878,1888,
-    1874,1876,1882,1882,1877,1910,1897,1868,1871,1864,1867,1834,1820,1801,1789,1753,
-    1781,1776,1766,1732,1727,1736,1750,1735,1704,1730,1715,1742,1747,1760,1749,1779,
-    1782,1794,1801,1825,1816,1828,1828,1827,1845,1835,1832,1824,1840,1818,1811,1797,
-    1791,1776,1755,1742,1744,1720,1705,1700,1700,1691,1676,1675,1664,1670,1670,1680,
-    1683,1664,1686,1698,1715,1705,1724,1734,1737,1725,1721,1763,1739,1710,1686,1703,
-    1714,1689,1656,1671,1662,1648,1623,1622,1635,1657,1750,1857,1860,1827,1980,2211,
-    2261,2176,2202,2318,2370,2351,2338,2295,2217,2126,2078,2056,1966,1803,1678,1677,
-    1682,1597,1466,1421,1450,1462,1449,1443,1456,1477,1503,1555,1649,1677,1661,1699,
-    1814,1901,1909,1891,1921,1985,2013,2017,2029,2031,2023,1991,1976,2023,2007,1921,
-    1844,1848,1858,1799,1716,1681,1690,1673,1647,1645,1638,1615,1608,1648,1680,1660,
-    1631,1646,1696,1718,1683,1664,1673,1685,1688,1689,1679,1660,1658,1674,1689,1668,
-    1662,1641,1657,1666,1656,1636,1603,1605,1599,1595,1578,1535,1552,1548,1526,1537,
-    1568,1588,1552,1746,2007,1943,1807,2092,2477,2448,2267,2370,2585,2571,2490,2478,
-    2456,2339,2206,2197,2204,2030,1777,1715,1787,1726,1511,1360,1376,1423,1392,1324,
-    1279,1287,1340,1393,1453,1477,1463,1506,1657,1801,1818,1793,1842,1982,2081,2077,
-    2047,2073,2115,2125,2116,2085,2008,1962,2004,1987,1912,1850,1811,1814,1797,1733,
-    1679,1642,1629,1632,1627,1600,1568,1578,1612,1637,1636,1621,1637,1698,1735,1727,
-    1704,1710,1739,1742,1713,1696,1690,1686,1702,1710,1685,1657,1655,1682,1687,1650,
-    1628,1612,1615,1599,1553,1544,1555,1495,1476,1545,1587,1510,1436,1528,1810,2025,
-    1790,1638,2129,2621,2390,2070,2338,2687,2623,2473,2501,2504,2395,2317,2376,2330,
-    2026,1794,1878,1997,1799,1460,1367,1517,1561,1419,1276,1235,1312,1403,1413,1356,
-    1348,1403,1517,1641,1676,1628,1656,1825,1971,2001,1945,1946,2084,2210,2165,2059,
-    2043,2077,2091,2044,1968,1849,1839,1886,1810,1722,1642,1650,1671,1634,1567,1531,
-    1545,1570,1592,1581,1561,1556,1646,1698,1696,1678,1698,1786,1825,1818,1790,1800,
-    1838,1865,1848,1817,1796,1790,1806,1805,1750,1684,1705,1738,1702,1638,1596,1612,
-    1609,1584,1522,1498,1512,1485,1446,1453,1514,1493,1450,1474,1547,1668,1863,1827,
-    1659,1941,2437,2398,2071,2192,2574,2666,2516,2410,2424,2506,2490,2357,2263,2150,
-    2004,1987,2001,1859,1599,1470,1531,1604,1495,1265,1166,1301,1452,1395,1236,1225,
-    1395,1539,1562,1533,1545,1653,1806,1899,1907,1879,1903,2031,2157,2122,1994,1982,
-    2071,2108,2024,1884,1811,1836,1860,1796,1743,1634,1578,1690,1756,1665,1519,1537,
-    1678,1770,1688,1573,1631,1789,1840,1790,1747,1769,1878,1922,1887,1849,1827,1846,
-    1890,1889,1802,1728,1735,1795,1803,1693,1598,1638,1707,1678,1583,1532,1564,1601,
-    1600,1538,1500,1519,1535,1559,1549,1501,1488,1518,1600,1606,1545,1539,1609,1694,
-    1787,1987,2002,1817,1999,2501,2597,2264,2175,2508,2794,2706,2404,2260,2429,2559,
-    2390,2115,1957,1949,1964,1880,1691,1505,1433,1449,1469,1424,1308,1201,1235,1403,
-    1485,1369,1257,1360,1592,1710,1630,1552,1659,1869,1964,1908,1843,1882,2027,2116,
-    2041,1939,1942,1980,1991,1952,1849,1755,1728,1775,1767,1722,1674,1610,1678,1761,
-    1794,1742,1665,1705,1837,1907,1827,1742,1793,1926,1965,1909,1802,1837,1946,1966,
-    1899,1797,1795,1819,1820,1757,1676,1611,1593,1627,1620,1533,1482,1502,1536,1561,
-    1539,1482,1480,1554,1595,1574,1540,1510,1542,1630,1611,1576,1535,1576,1656,1677,
-    1653,1618,1647,1784,1982,2081,2051,2010,2247,2585,2639,2395,2304,2540,2721,2637,
-    2398,2225,2259,2367,2247,1962,1761,1728,1752,1690,1517,1335,1286,1336,1384,1375,
-    1312,1252,1307,1473,1602,1579,1497,1550,1747,1903,1908,1807,1787,1953,2102,2053,
-    1919,1880,1934,1981,1935,1817,1720,1695,1701,1700,1639,1545,1514,1567,1621,1641,
-    1621,1691,1740,1799,1918,1986,2036,2021,2058,2110,2176,2158,2065,2001,2045,2065,
-    1997,1876,1775,1805,1808,1746,1622,1566,1591,1598,1542,1463,1441,1460,1474,1475,
-    1486,1483,1500,1553,1605,1617,1598,1599,1624,1669,1681,1636,1600,1609,1647,1659,
-    1621,1547,1568,1645,1671,1652,1626,1644,1746,1916,2072,2141,2096,2179,2513,2762,
-    2616,2379,2415,2593,2668,2471,2106,1950,2056,2067,1830,1551,1434,1473,1528,1466,
-    1342,1297,1331,1419,1515,1553,1538,1547,1651,1802,1903,1892,1845,1862,1943,2006,
-    1997,1902,1812,1822,1863,1840,1735,1634,1609,1624,1593,1560,1543,1529,1516,1537,
-    1597,1660,1684,1677,1721,1838,1936,1971,1992,2039,2116,2181,2228,2202,2185,2183,
-    2148,2102,2042,1952,1863,1803,1741,1705,1648,1593,1542,1557,1589,1554,1514,1499,
-    1508,1515,1513,1491,1468,1481,1530,1555,1538,1531,1555,1586,1606,1610,1601,1593,
-    1606,1628,1640,1651,1638,1653,1693,1716,1732,1729,1703,1734,1808,1810,1785,1816,
-    1881,1931,2022,2106,2099,2205,2399,2381,2329,2465,2492,2346,2282,2259,2163,2094,
-    2019,1813,1699,1746,1683,1538,1489,1484,1508,1552,1533,1526,1620,1706,1696,1707,
-    1779,1821,1811,1804,1789,1783,1784,1753,1704,1664,1650,1643,1613,1589,1587,1585,
-    1598,1629,1643,1660,1692,1722,1774,1835,1870,1884,1903,1923,1964,2009,2015,1996,
-    1988,2042,2095,2091,2045,2011,2058,2090,2017,1930,1894,1858,1818,1756,1687,1638,
-    1599,1574,1565,1578,1563,1534,1546,1584,1598,1603,1596,1563,1570,1624,1630,1601,
-    1610,1639,1662,1674,1678,1665,1669,1683,1661,1648,1675,1697,1690,1685,1704,1728,
-    1747,1745,1708,1705,1739,1736,1714,1704,1690,1694,1746,1780,1835,1962,2060,2159,
-    2250,2251,2300,2505,2513,2277,2213,2294,2229,2094,2011,1856,1739,1762,1722,1595,
-    1607,1659,1589,1582,1660,1661,1648,1688,1679,1637,1679,1712,1651,1640,1670,1616,
-    1573,1622,1652,1627,1629,1652,1668,1717,1763,1753,1757,1811,1845,1852,1866,1889,
-    1904,1910,1896,1876,1892,1926,1912,1871,1875,1903,1900,1887,1885,1877,1899,1927,
-    1905,1884,1906,1908,1860,1804,1763,1742,1712,1667,1647,1638,1617,1598,1615,1651,
-    1678,1685,1674,1685,1737,1762,1733,1705,1688,1681,1691,1690,1643,1613,1629,1646,
-    1632,1626,1634,1628,1635,1659,1676,1685,1693,1697,1731,1772,1776,1758,1771,1812,
-    1817,1776,1743,1734,1739,1743,1711,1674,1674,1703,1757,1867,1954,1973,2074,2236,
-    2247,2248,2419,2449,2260,2208,2273,2183,2042,2016,1954,1782,1694,1708,1672,1607,
-    1603,1622,1586,1556,1594,1637,1609,1595,1637,1652,1618,1621,1690,1708,1681,1702,
-    1741,1737,1737,1793,1856,1859,1833,1834,1871,1911,1917,1909,1880,1847,1846,1848,
-    1836,1806,1791,1783,1755,1741,1748,1738,1718,1721,1725,1730,1744,1771,1788,1820,
-    1845,1833,1848,1885,1911,1911,1878,1852,1848,1825,1771,1738,1726,1702,1684,1684,
-    1677,1670,1679,1701,1736,1732,1734,1731,1715,1686,1656,1653,1621,1600,1610,1614,
-    1592,1589,1621,1638,1632,1657,1699,1720,1745,1781,1799,1785,1800,1836,1834,1795,
-    1786,1789,1751,1703,1695,1705,1675,1643,1662,1692,1677,1686,1766,1911,2014,2021,
-    2074,2191,2236,2269,2334,2321,2212,2140,2132,2071,1958,1906,1893,1821,1731,1693,
-    1703,1696,1708,1719,1707,1668,1655,1661,1676,1673,1656,1656,1662,1661,1648,1677,
-    1704,1710,1707,1733,1755,1761,1789,1836,1861,1859,1874,1850,1826,1862,1876,1848,
-    1826,1827,1806,1797,1782,1765,1779,1778,1753,1721,1732,1772,1805,1862,1871,1844,
-    1874,1923,1939,1925,1917,1893,1911,1854,1802,1818,1777,1777,1740,1697,1694,1674,
-    1647,1654,1670,1651,1630,1648,1663,1653,1645,1648,1618,1627,1652,1621,1641,1664,
-    1664,1657,1655,1661,1689,1712,1739,1750,1755,1785,1774,1758,1787,1824,1809,1803,
-    1801,1802,1822,1793,1759,1744,1727,1706,1687,1690,1682,1677,1680,1675,1728,1866,
-    1971,2003,2094,2230,2266,2245,2289,2342,2261,2112,2067,2055,1977,1888,1864,1837,
-    1742,1645,1643,1671,1646,1643,1667,1648,1595,1587,1611,1650,1660,1681,1706,1687,
-    1675,1697,1728,1743,1762,1783,1801,1811,1845,1879,1893,1874,1853,1836,1820,1814,
-    1796,1797,1802,1774,1760,1756,1724,1706,1739,1762,1744,1748,1776,1808,1830,1852,
-    1867,1892,1897,1902,1896,1874,1873,1865,1828,1775,1722,1709,1695,1650,1641,1648,
-    1638,1642,1650,1644,1649,1655,1673,1686,1696,1695,1694,1684,1691,1703,1691,1677,
-    1680,1692,1695,1704,1746,1758,1742,1740,1729,1707,1711,1753,1765,1751,1750,1788,
-    1810,1811,1810,1821,1837,1832,1794,1785,1791,1753,1707,1677,1702,1712,1685,1687,
-    1761,1883,2006,2064,2149,2316,2329,2217,2278,2387,2213,1971,1956,1940,1751,1648,
-    1712,1693,1581,1570,1623,1627,1657,1769,1830,1769,1733,1753,1737,1697,1711,1753,
-    1730,1665,1663,1705,1695,1709,1790,1841,1841,1849,1881,1880,1872,1897,1902,1856,
-    1832,1832,1790,1764,1771,1751,1706,1679,1664,1669,1669,1685,1716,1737,1755,1798,
-    1862,1928,1942,1926,1925,1912,1887,1857,1815,1780,1749,1705,1679,1660,1661,1675,
-    1700,1716,1711,1720,1735,1749,1770,1765,1745,1730,1706,1681,1662,1659,1659,1650,
-    1653,1647,1641,1656,1676,1677,1657,1694,1717,1704,1705,1728,1780,1807,1808,1815,
-    1815,1816,1809,1814,1806,1775,1777,1779,1741,1703,1708,1696,1664,1656,1700,1701,
-    1643,1669,1891,2143,2171,2128,2364,2592,2378,2186,2341,2329,1968,1789,1799,1658,
-    1518,1632,1695,1561,1628,1789,1757,1754,1943,1999,1872,1834,1825,1694,1597,1642,
-    1632,1582,1611,1624,1605,1700,1809,1818,1839,1931,1950,1887,1872,1872,1829,1788,
-    1754,1688,1640,1657,1676,1649,1675,1723,1727,1725,1751,1800,1846,1880,1894,1911,
-    1944,1954,1943,1937,1939,1911,1855,1813,1787,1755,1725,1723,1707,1668,1666,1683,
-    1699,1713,1726,1750,1761,1759,1762,1776,1765,1733,1716,1694,1635,1607,1623,1634,
-    1636,1657,1681,1678,1670,1685,1711,1721,1733,1741,1719,1692,1713,1737,1751,1754,
-    1761,1761,1748,1754,1755,1775,1775,1737,1718,1737,1725,1688,1704,1737,1747,1757,
-    1753,1735,1854,2085,2234,2295,2466,2546,2349,2243,2337,2232,1911,1770,1710,1533,
-    1479,1597,1620,1624,1759,1847,1792,1811,1937,1966,1903,1852,1752,1597,1512,1498,
-    1495,1512,1576,1641,1683,1750,1823,1874,1944,2003,1987,1929,1877,1822,1752,1717,
-    1707,1683,1670,1681,1686,1707,1777,1828,1850,1868,1854,1824,1828,1842,1836,1844,
-    1877,1901,1870,1864,1894,1883,1846,1809,1777,1751,1720,1680,1666,1691,1710,1695,
-    1715,1754,1773,1799,1830,1834,1803,1788,1766,1727,1681,1652,1628,1600,1599,1608,
-    1616,1625,1646,1672,1684,1671,1674,1702,1724,1725,1719,1725,1735,1726,1737,1761,
-    1776,1790,1785,1762,1750,1786,1813,1798,1784,1779,1757,1729,1716,1687,1650,1656,
-    1685,1683,1648,1688,1882,2207,2524,2645,2547,2400,2378,2370,2173,1859,1684,1605,
-    1457,1347,1398,1533,1685,1850,1934,1908,1905,1977,2022,1964,1849,1700,1519,1390,
-    1340,1364,1456,1588,1708,1801,1874,1937,1999,2057,2081,2056,1985,1879,1768,1668,
-    1609,1598,1623,1670,1707,1736,1774,1821,1877,1913,1911,1874,1828,1790,1748,1713,
-    1734,1786,1819,1839,1872,1917,1929,1929,1927,1889,1837,1779,1713,1666,1643,1637,
-    1641,1684,1736,1779,1812,1831,1839,1832,1819,1793,1737,1682,1643,1604,1578,1582,
-    1604,1641,1691,1714,1718,1727,1734,1735,1727,1722,1736,1760,1755,1719,1715,1742,
-    1774,1792,1811,1818,1825,1840,1827,1777,1750,1762,1768,1745,1710,1691,1678,1655,
-    1627,1618,1625,1641,1647,1618,1610,1815,2234,2616,2712,2567,2401,2364,2336,2108,
-    1770,1565,1477,1365,1288,1332,1506,1743,1973,2087,2051,2013,2061,2095,2020,1847,
-    1644,1447,1310,1267,1314,1432,1598,1776,1904,1973,2016,2074,2118,2111,2054,1948,
-    1820,1685,1561,1501,1518,1580,1659,1739,1798,1835,1866,1896,1894,1861,1817,1772,
-    1715,1654,1623,1638,1709,1803,1882,1933,1963,1983,1990,1969,1925,1869,1812,1749,
-    1662,1597,1596,1650,1716,1784,1833,1856,1877,1888,1874,1832,1794,1749,1686,1613,
-    1563,1550,1576,1621,1675,1713,1728,1733,1727,1705,1686,1678,1671,1659,1655,1667,
-    1682,1701,1749,1811,1852,1861,1829,1784,1763,1761,1736,1716,1735,1764,1754,1750,
-    1768,1784,1754,1713,1682,1651,1602,1561,1520,1504,1647,2027,2538,2834,2700,2417,
-    2392,2446,2204,1780,1523,1410,1317,1266,1307,1426,1681,2017,2205,2187,2130,2175,
-    2242,2175,1961,1694,1444,1265,1187,1219,1320,1491,1702,1891,1974,2017,2098,2178,
-    2195,2129,1987,1807,1637,1504,1404,1390,1479,1595,1702,1781,1854,1902,1953,1984,
-    1962,1900,1825,1739,1651,1587,1583,1639,1730,1830,1905,1949,1988,2037,2056,2033,
-    1970,1879,1763,1652,1558,1513,1535,1617,1691,1739,1790,1850,1892,1900,1878,1834,
-    1776,1715,1656,1579,1539,1552,1587,1629,1676,1716,1744,1770,1767,1721,1689,1674,
-    1659,1662,1691,1711,1720,1757,1813,1839,1844,1831,1780,1734,1748,1771,1775,1783,
-    1781,1759,1759,1801,1824,1834,1832,1796,1721,1653,1588,1533,1511,1488,1448,1553,
-    1930,2449,2775,2700,2435,2381,2493,2352,1921,1577,1438,1321,1194,1167,1298,1569,
-    1915,2130,2136,2099,2200,2329,2292,2078,1800,1542,1342,1216,1186,1257,1397,1548,
-    1690,1825,1954,2121,2268,2302,2216,2075,1904,1734,1598,1519,1488,1491,1535,1595,
-    1649,1716,1818,1932,2005,1996,1946,1887,1808,1730,1676,1655,1654,1656,1691,1750,
-    1820,1916,2021,2094,2085,1994,1882,1786,1710,1660,1635,1614,1583,1578,1635,1730,
-    1820,1881,1917,1919,1885,1838,1781,1715,1652,1592,1532,1501,1519,1582,1662,1727,
-    1752,1746,1743,1754,1767,1781,1796,1782,1744,1710,1713,1759,1824,1855,1813,1759,
-    1761,1806,1843,1850,1853,1862,1862,1836,1788,1761,1775,1789,1734,1619,1518,1472,
-    1470,1503,1545,1586,1700,1951,2280,2511,2557,2461,2387,2450,2445,2139,1711,1477,
-    1405,1307,1255,1350,1533,1716,1852,1926,2009,2184,2378,2420,2253,1991,1757,1580,
-    1445,1375,1365,1361,1326,1333,1445,1661,1920,2122,2191,2152,2092,2061,2032,1974,
-    1887,1765,1626,1510,1455,1482,1556,1628,1667,1680,1721,1807,1901,1970,1987,1954,
-    1897,1831,1783,1773,1806,1846,1841,1789,1739,1717,1738,1768,1785,1773,1731,1691,
-    1678,1701,1751,1807,1830,1802,1764,1757,1783,1818,1826,1802,1741,1675,1632,1629,
-    1640,1648,1651,1651,1647,1661,1703,1742,1774,1790,1790,1785,1789,1803,1799,1758,
-    1733,1728,1721,1713,1717,1738,1765,1773,1745,1703,1722,1799,1841,1797,1730,1698,
-    1666,1607,1535,1510,1510,1491,1518,1731,2089,2384,2507,2470,2383,2479,2681,2600,
-    2223,1928,1779,1559,1345,1320,1388,1396,1397,1427,1505,1725,2036,2235,2250,2192,
-    2120,2023,1945,1911,1851,1705,1505,1343,1305,1384,1494,1553,1587,1666,1772,1884,
-    2002,2091,2126,2092,2011,1927,1892,1903,1870,1760,1638,1562,1533,1528,1541,1573,
-    1611,1644,1676,1746,1857,1962,2003,2012,2034,2035,2010,1986,1966,1927,1843,1733,
-    1639,1598,1605,1608,1590,1579,1601,1650,1731,1817,1876,1893,1878,1858,1846,1838,
-    1816,1763,1691,1621,1559,1530,1536,1551,1572,1591,1608,1629,1683,1750,1797,1840,
-    1871,1889,1894,1898,1877,1843,1805,1758,1706,1674,1692,1698,1655,1577,1517,1527,
-    1594,1626,1620,1628,1621,1617,1750,2072,2365,2381,2233,2296,2618,2778,2584,2351,
-    2275,2160,1931,1757,1678,1607,1510,1352,1184,1188,1399,1563,1566,1572,1668,1762,
-    1819,1919,2042,2089,2007,1855,1773,1829,1914,1876,1732,1621,1587,1596,1625,1665,
-    1698,1699,1656,1612,1648,1771,1874,1867,1815,1797,1834,1896,1949,1974,1951,1887,
-    1811,1769,1794,1835,1827,1762,1691,1683,1740,1785,1786,1776,1779,1775,1755,1759,
-    1813,1863,1835,1764,1725,1743,1779,1781,1752,1725,1711,1709,1723,1738,1744,1720,
-    1681,1651,1660,1710,1745,1724,1678,1649,1625,1609,1637,1668,1695,1712,1695,1690,
-    1731,1816,1868,1881,1867,1868,1894,1903,1889,1868,1852,1826,1784,1748,1743,1748,
-    1753,1744,1726,1698,1695,1725,1751,1746,1732,1758,1859,1957,1941,1891,1963,2106,
-    2138,2085,2062,2078,2074,2063,2047,1988,1924,1885,1824,1739,1709,1741,1731,1668,
-    1621,1602,1604,1617,1643,1660,1669,1680,1681,1682,1694,1716,1731,1732,1733,1749,
-    1778,1808,1828,1834,1848,1863,1872,1873,1867,1868,1883,1893,1866,1822,1799,1794,
-    1784,1785,1788,1769,1728,1695,1691,1704,1722,1733,1732,1726,1733,1759,1801,1845,
-    1863,1854,1841,1833,1834,1830,1825,1806,1772,1748,1738,1725,1703,1693,1700,1730,
-    1751,1761,1757,1754,1762,1765,1769,1773,1789,1791,1769,1733,1703,1700,1721,1741,
-    1745,1738,1726,1726,1738,1761,1795,1819,1824,1808,1807,1824,1832,1822,1802,1794,
-    1799,1827,1862,1867,1860,1859,1854,1826,1811,1811,1810,1780,1728,1692,1680,1688,
-    1683,1665,1644,1639,1633,1635,1670,1723,1755,1765,1789,1829,1871,1899,1917,1936,
-    1948,1953,1956,1963,1962,1957,1945,1928,1914,1897,1878,1856,1829,1798,1769,1750,
-    1737,1718,1700,1694,1705,1712,1709,1703,1712,1732,1743,1741,1759,1785,1800,1794,
-    1786,1788,1791,1796,1789,1776,1773,1780,1771,1763,1764,1764,1763,1775,1783,1796,
-    1809,1827,1841,1847,1855,1852,1842,1834,1835,1819,1793,1776,1772,1765,1757,1733,
-    1712,1707,1718,1733,1745,1745,1749,1758,1763,1764,1778,1802,1805,1794,1777,1766,
-    1757,1743,1717,1712,1717,1734,1741,1748,1759,1780,1794,1791,1788,1806,1818,1817,
-    1797,1790,1786,1786,1783,1765,1785,1793,1791,1784,1781,1779,1787,1780,1776,1767,
-    1762,1754,1753,1738,1738,1738,1723,1708,1678,1666,1663,1722,1811,1818,1743,1770,
-    1893,1949,1938,1945,1973,2008,2027,2014,1997,2006,2015,1969,1872,1835,1870,1868,
-    1811,1751,1723,1717,1714,1688,1673,1699,1708,1671,1641,1657,1694,1709,1694,1679,
-    1691,1729,1761,1774,1789,1808,1812,1799,1807,1845,1866,1849,1812,1781,1781,1796,
-    1797,1784,1777,1780,1785,1780,1785,1810,1823,1806,1782,1771,1784,1791,1782,1783,
-    1793,1808,1804,1797,1805,1826,1826,1803,1791,1790,1789,1772,1747,1743,1751,1750,
-    1735,1732,1723,1718,1711,1694,1719,1721,1727,1714,1714,1731,1727,1755,1741,1756,
-    1756,1763,1770,1768,1790,1781,1785,1773,1780,1791,1785,1799,1786,1777,1776,1769,
-    1779,1772,1781,1768,1752,1749,1753,1767,1764,1758,1751,1744,1744,1743,1743,1755,
-    1760,1764,1781,1807,1828,1855,1879,1902,1931,1957,1958,1965,1977,1986,1983,1966,
-    1950,1934,1909,1880,1863,1838,1811,1789,1768,1741,1710,1692,1684,1684,1676,1662,
-    1661,1671,1689,1706,1727,1748,1773,1800,1820,1837,1859,1882,1886,1876,1875,1884,
-    1881,1864,1851,1846,1853,1857,1851,1843,1823,1809,1801,1792,1792,1795,1777,1754,
-    1732,1713,1711,1719,1722,1715,1711,1701,1693,1708,1720,1736,1738,1766,1798,1778,
-    1782,1792,1804,1783,1748,1745,1734,1697,1675,1689,1695,1675,1666,1684,1718,1711,
-    1692,1702,1724,1735,1740,1741,1736,1725,1688,1665,1670,1683,1669,1640,1608,1624,
-    1632,1710,1841,1882,1833,1913,2103,2174,2148,2161,2240,2240,2195,2176,2198,2159,
-    2078,1969,1915,1915,1884,1775,1685,1659,1629,1574,1535,1554,1566,1529,1475,1483,
-    1554,1613,1607,1612,1652,1696,1710,1745,1797,1849,1865,1857,1870,1907,1942,1928,
-    1913,1912,1911,1885,1862,1848,1828,1792,1762,1755,1762,1758,1732,1712,1716,1720,
-    1706,1703,1714,1724,1721,1723,1748,1794,1824,1825,1808,1813,1831,1837,1835,1843,
-    1844,1819,1786,1770,1768,1759,1736,1716,1713,1716,1717,1712,1718,1730,1735,1733,
-    1741,1752,1762,1753,1738,1739,1744,1754,1742,1740,1747,1753,1758,1755,1766,1773,
-    1777,1771,1767,1772,1784,1780,1776,1791,1802,1810,1798,1798,1790,1797,1792,1776,
-    1759,1745,1730,1711,1698,1689,1693,1701,1749,1798,1822,1823,1864,1913,1941,1949,
-    1969,1993,1994,1986,1976,1985,1991,1989,1964,1932,1912,1892,1865,1847,1822,1795,
-    1751,1723,1709,1707,1702,1688,1677,1671,1670,1664,1672,1683,1692,1684,1691,1706,
-    1725,1733,1736,1743,1767,1788,1796,1797,1804,1813,1814,1817,1824,1845,1851,1850,
-    1848,1848,1840,1828,1826,1827,1819,1816,1815,1809,1799,1795,1795,1796,1798,1789,
-    1779,1773,1771,1774,1778,1776,1757,1738,1730,1733,1741,1744,1743,1731,1712,1700,
-    1709,1721,1727,1725,1721,1720,1723,1730,1741,1753,1757,1754,1753,1765,1779,1782,
-    1784,1784,1785,1785,1788,1799,1797,1788,1784,1790,1800,1818,1822,1814,1813,1811,
-    1816,1818,1811,1799,1789,1786,1769,1758,1757,1757,1762,1758,1757,1764,1776,1788,
-    1789,1798,1807,1806,1813,1829,1835,1832,1831,1840,1850,1858,1850,1850,1858,1856,
-    1855,1857,1861,1860,1858,1851,1850,1852,1852,1849,1844,1836,1824,1813,1806,1806,
-    1797,1781,1772,1758,1747,1743,1734,1727,1727,1717,1714,1721,1725,1721,1715,1716,
-    1729,1749,1759,1766,1770,1779,1788,1800,1811,1820,1823,1821,1827,1832,1841,1837,
-    1837,1838,1836,1829,1815,1809,1806,1806,1801,1787,1777,1773,1768,1759,1751,1747,
-    1741,1729,1718,1711,1703,1696,1693,1697,1705,1710,1713,1715,1721,1722,1726,1735,
-    1744,1749,1745,1758,1772,1780,1778,1781,1789,1795,1805,1813,1821,1830,1832,1834,
-    1845,1844,1845,1843,1844,1833,1819,1808,1799,1791,1788,1791,1782,1777,1779,1782,
-    1783,1782,1790,1798,1804,1805,1803,1810,1821,1827,1827,1823,1820,1816,1813,1817,
-    1821,1819,1816,1816,1818,1825,1829,1831,1832,1830,1822,1822,1827,1821,1809,1796,
-    1788,1786,1781,1778,1778,1769,1767,1766,1765,1765,1767,1766,1755,1753,1759,1755,
-    1745,1742,1749,1755,1761,1768,1775,1782,1784,1780,1776,1785,1788,1783,1775,1774,
-    1773,1776,1774,1767,1765,1759,1759,1756,1755,1759,1762,1766,1768,1763,1756,1762,
-    1766,1776,1786,1795,1798,1789,1784,1780,1775,1772,1779,1781,1774,1768,1770,1769,
-    1777,1782,1780,1777,1777,1779,1775,1777,1776,1771,1763,1758,1750,1748,1746,1753,
-    1757,1763,1771,1778,1786,1796,1807,1809,1819,1826,1822,1821,1826,1826,1822,1813,
-    1815,1818,1816,1814,1821,1831,1838,1844,1846,1852,1856,1851,1849,1843,1831,1820,
-    1806,1792,1787,1775,1762,1760,1759,1762,1765,1766,1765,1762,1757,1754,1748,1747,
-    1755,1754,1748,1743,1740,1745,1751,1762,1765,1765,1770,1773,1774,1772,1777,1780,
-    1780,1784,1791,1790,1796,1794,1795,1795,1800,1807,1806,1801,1801,1801,1801,1794,
-    1782,1782,1781,1777,1765,1768,1773,1779,1776,1782,1773,1766,1761,1767,1769,1776,
-    1773,1778,1777,1788,1790,1796,1793,1790,1789,1785,1786,1775,1777,1770,1781,1777,
-    1854,1758,1780,1787,1808,1788,1765,1800,1784,1800,1789,1810,1793,1798,1789,1810,
-    1781,1795,1771,1797,1767,1849,1810,1782,1781,1805,1827,1776,1789,1768,1790,1781,
-    1802,1792,1800,1774,1800,1789,1804,1796,1801,1797,1814,1802,1810,1812,1822,1827,
-    1820,1819,1796,1799,1792,1801,1781,1772,1755,1759,1755,1766,1763,1767,1761,1767,
-    1760,1761,1767,1773,1773,1774,1774,1773,1769,1761,1772,1768,1777,1772,1776,1776,
-    1777,1790,1770,1802,1792,1799,1813,1824,1815,1809,1832,1806,1815,1798,1795,1783,
-    1788,1785,1771,1777,1768,1775,1776,1761,1773,1768,1776,1766,1782,1771,1773,1767,
-    1766,1784,1770,1798,1772,1785,1769,1774,1778,1781,1788,1790,1792,1794,1800,1803,
-    1793,1800,1797,1786,1795,1782,1790,1784,1793,1798,1785,1784,1792,1767,1797,1772,
-    1785,1781,1767,1778,1781,1779,1774,1766,1765,1772,1774,1770,1780,1781,1787,1778,
-    1780,1775,1772,1804,1768,1809,1764,1827,1747,1777,1800,1789,1765,1779,1888,1849,
-    1836,1769,1819,1807,1759,1761,1707,1725,1739,1745,1764,1758,1768,1736,1787,1765,
-    1794,1776,1821,1800,1819,1799,1815,1812,1802,1816,1796,1819,1771,1814,1768,1834,
-    1773,1801,1764,1775,1792,1769,1783,1786,1796,1773,1781,1794,1791,1795,1777,1800,
-    1794,1787,1796,1769,1810,1755,1804,1758,1800,1782,1779,1780,1765,1806,1776,1778,
-    1790,1785,1790,1762,1785,1778,1794,1799,1783,1822,1785,1810,1759,1819,1784,1797,
-    1778,1782,1808,1747,1794,1738,1807,1744,1783,1761,1770,1783,1768,1805,1778,1819,
-    1773,1817,1762,1822,1768,1811,1765,1798,1799,1779,1809,1770,1802,1780,1813,1794,
-    1799,1790,1801,1783,1798,1778,1785,1787,1800,1778,1793,1767,1799,1777,1780,1805,
-    1775,1797,1770,1801,1788,1793,1773,1781,1781,1780,1784,1765,1790,1782,1785,1775,
-    1771,1777,1797,1774,1823,1762,1825,1770,1806,1787,1780,1803,1763,1827,1766,1824,
-    1783,1800,1778,1815,1780,1819,1774,1802,1770,1778,1774,1772,1791,1766,1775,1758,
-    1806,1767,1798,1771,1784,1767,1756,1792,1755,1798,1754,1794,1778,1799,1806,1768,
-    1820,1748,1815,1763,1803,1795,1776,1775,1766,1770,1774,1779,1775,1780,1770,1757,
-    1791,1784,1774,1788,1780,1783,1788,1771,1772,1787,1783,1766,1774,1794,1779,1786,
-    1809,1791,1795,1795,1814,1801,1811,1801,1764,1832,1757,1814,1773,1815,1777,1809,
-    1759,1809,1796,1776,1839,1766,1825,1779,1839,1769,1816,1770,1800,1801,1781,1794,
-    1782,1788,1778,1794,1766,1807,1775,1797,1786,1790,1772,1806,1779,1769,1794,1787,
-    1786,1781,1789,1787,1794,1799,1795,1799,1802,1777,1803,1806,1792,1777,1790,1774,
-    1811,1765,1808,1772,1801,1764,1802,1817,1776,1826,1750,1803,1762,1774,1793,1766,
-    1796,1777,1807,1794,1780,1802,1772,1830,1749,1821,1769,1789,1790,1779,1775,1796,
-    1787,1795,1828,1785,1813,1786,1806,1780,1809,1765,1798,1763,1783,1782,1772,1781,
-    1775,1763,1773,1770,1802,1754,1815,1752,1805,1779,1778,1796,1750,1835,1739,1833,
-    1718,1851,1726,1828,1763,1809,1821,1744,1874,1733,1875,1729,1850,1740,1822,1777,
-    1770,1840,1731,1830,1729,1827,1777,1783,1799,1762,1829,1744,1787,1766,1785,1784,
-    1748,1810,1743,1810,1725,1810,1722,1792,1713,1778,1749,1775,1751,1817,1760,1785,
-    1775,1733,1840,1663,1873,1670,1871,1700,1872,1752,1817,1815,1780,1795,1821,1757,
-    1842,1749,1799,1791,1733,1819,1724,1843,1714,1863,1711,1882,1724,1865,1711,1857,
-    1730,1801,1738,1781,1759,1783,1748,1795,1779,1770,1853,1731,1892,1686,1896,1707,
-    1859,1767,1815,1796,1798,1825,1777,1819,1760,1803,1791,1755,1824,1714,1859,1725,
-    1838,1778,1805,1814,1756,1845,1760,1824,1760,1814,1786,1753,1775,1824,1719,1840,
-    1713,1824,1723,1861,1728,1838,1743,1790,1783,1766,1834,1753,1801,1770,1813,1766,
-    1771,1824,1762,1789,1802,1715,1867,1692,1904,1667,1864,1776,1770,1810,1779,1822,
-    1781,1792,1831,1729,1837,1756,1791,1837,1735,1861,1715,1858,1726,1853,1720,1826,
-    1773,1770,1835,1772,1836,1747,1818,1791,1769,1804,1768,1800,1727,1808,1740,1781,
-    1772,1748,1808,1709,1907,1675,1863,1703,1779,1853,1656,1897,1694,1844,1779,1742,
-    1876,1693,1856,1790,1692,1912,1626,1921,1693,1823,1848,1638,1933,1625,1888,1757,
-    1742,1849,1644,1899,1693,1819,1825,1696,1853,1685,1856,1771,1765,1846,1710,1803,
-    1796,1759,1879,1660,1968,1621,1908,1759,1767,1829,1732,1860,1674,1909,1724,1820,
-    1811,1778,1766,1826,1751,1832,1770,1856,1724,1839,1721,1827,1724,1862,1715,1791,
-    1776,1741,1880,1697,1889,1688,1805,1782,1779,1857,1738,1837,1743,1770,1890,1681,
-    1957,1676,1900,1748,1838,1848,1730,1845,1788,1732,1823,1774,1775,1802,1730,1852,
-    1659,1896,1690,1811,1807,1759,1805,1743,1838,1738,1771,1776,1736,1805,1735,1826,
-    1739,1831,1761,1794,1784,1779,1805,1775,1742,1824,1736,1809,1777,1760,1883,1644,
-    1913,1651,1868,1742,1796,1778,1763,1802,1809,1746,1887,1729,1822,1807,1767,1864,
-    1721,1874,1749,1827,1774,1809,1795,1831,1715,1896,1670,1926,1674,1865,1732,1814,
-    1768,1754,1837,1656,1921,1644,1902,1680,1844,1732,1804,1793,1789,1785,1771,1820,
-    1731,1865,1739,1831,1766,1783,1796,1812,1797,1796,1807,1789,1831,1736,1874,1712,
-    1837,1725,1767,1828,1734,1854,1702,1868,1736,1799,1770,1780,1797,1739,1791,1744,
-    1796,1709,1807,1733,1800,1760,1772,1793,1791,1810,1722,1851,1717,1858,1709,1835,
-    1786,1800,1822,1750,1859,1744,1843,1768,1834,1775,1815,1796,1796,1772,1793,1786,
-    1783,1752,1792,1782,1786,1772,1750,1833,1725,1812,1737,1816,1742,1788,1776,1803,
-    1773,1780,1817,1735,1853,1723,1854,1714,1854,1760,1778,1821,1746,1822,1728,1808,
-    1745,1784,1776,1799,1740,1811,1753,1835,1766,1791,1775,1781,1831,1754,1809,1756,
-    1816,1768,1808,1775,1784,1783,1786,1810,1758,1835,1741,1826,1783,1801,1805,1767,
-    1835,1743,1838,1705,1851,1725,1811,1764,1755,1819,1731,1848,1727,1791,1784,1745,
-    1839,1746,1819,1756,1781,1794,1753,1821,1728,1833,1731,1817,1767,1793,1795,1798,
-    1782,1795,1765,1813,1769,1812,1755,1809,1776,1796,1827,1740,1845,1732,1837,1755,
-    1797,1776,1772,1792,1768,1778,1792,1769,1803,1766,1792,1799,1764,1787,1811,1764,
-    1781,1771,1808,1799,1752,1829,1751,1813,1770,1793,1813,1763,1842,1742,1822,1761,
-    1768,1800,1730,1831,1729,1813,1779,1768,1800,1749,1819,1744,1783,1798,1764,1815,
-    1758,1819,1786,1805,1786,1803,1809,1780,1800,1770,1809,1793,1793,1798,1798,1797,
-    1804,1787,1805,1780,1793,1806,1785,1809,1775,1808,1784,1774,1783,1778,1784,1785,
-    1785,1780,1791,1773,1806,1778,1812,1791,1799,1794,1789,1787,1788,1792,1782,1793,
-    1768,1795,1769,1793,1782,1787,1791,1782,1793,1790,1791,1781,1782,1779,1791,1774,
-    1786,1778,1781,1785,1765,1792,1762,1792,1764,1794,1790,1778,1794,1776,1799,1782,
-    1795,1787,1800,1798,1794,1797,1796,1789,1795,1793,1797,1789,1809,1803,1800,1795,
-    1781,1784,1769,1778,1779,1767,1773,1766,1772,1774,1767,1787,1765,1783,1777,1780,
-    1780,1780,1787,1776,1785,1773,1776,1782,1794,1785,1784,1787,1778,1781,1780,1787,
-    1777,1786,1777,1774,1764,1770,1774,1773,1777,1772,1779,1775,1781,1774,1792,1774,
-    1786,1773,1787,1783,1780,1788,1778,1800,1779,1806,1789,1800,1792,1794,1791,1781,
-    1795,1786,1791,1782,1798,1786,1796,1784,1795,1775,1785,1790,1785,1802,1780,1795,
-    1774,1794,1775,1788,1781,1779,1779,1772,1787,1778,1790,1786,1796,1785,1787,1779,
-    1790,1779,1785,1781,1786,1787,1789,1800,1786,1802,1781,1794,1794,1794,1797,1786,
-    1797,1793,1788,1788,1783,1787,1776,1791,1782,1790,1784,1771,1781,1779,1794,1790,
-    1791,1794,1793,1791,1796,1790,1803,1793,1802,1791,1781,1790,1770,1788,1777,1790,
-    1786,1789,1795,1782,1793,1784,1791,1776,1787,1788,1780,1796,1785,1795,1783,1787,
-    1791,1792,1805,1793,1797,1794,1792,1798,1790,1790,1793,1784,1796,1784,1791,1780,
-    1780,1782,1773,1783,1777,1783,1763,1778,1770,1773,1784,1779,1791,1774,1786,1766,
-    1779,1782,1791,1868,1805,1743,1786,1793,1781,1763,1747,1776,1750,1787,1796,1777,
-    1797,1765,1776,1790,1774,1794,1778,1795,1812,1776,1784,1770,1771,1787,1796,1770,
-    1786,1769,1804,1786,1783,1785,1769,1783,1777,1816,1774,1797,1772,1769,1799,1780,
-    1788,1794,1789,1798,1768,1815,1795,1775,1816,1737,1793,1795,1722,1800,1762,1746,
-    1834,1730,1829,1779,1787,1815,1730,1849,1720,1802,1815,1745,1822,1791,1720,1827,
-    1767,1763,1867,1722,1769,1846,1732,1859,1892,1779,1869,1777,1813,1774,1762,1738,
-    1662,1751,1819,1722,1785,1760,1822,1791,1700,1817,1724,1769,1747,1785,1805,1792,
-    1767,1844,1846,1796,1796,1805,1828,1814,1784,1793,1746,1726,1785,1784,1756,1751,
-    1778,1777,1808,1806,1856,1819,1842,1837,1822,1850,1802,1783,1739,1714,1755,1730,
-    1716,1746,1739,1789,1773,1807,1864,1863,1867,1833,1860,1872,1843,1837,1841,1821,
-    1804,1777,1799,1805,1772,1776,1780,1806,1818,1787,1802,1824,1804,1787,1788,1816,
-    1796,1786,1775,1790,1799,1780,1780,1765,1783,1777,1746,1788,1782,1769,1759,1737,
-    1765,1761,1751,1725,1737,1747,1717,1724,1753,1747,1753,1740,1738,1787,1753,1744,
-    1764,1738,1740,1717,1694,1703,1665,1638,1615,1601,1624,1599,1615,1626,1621,1682,
-    1732,1982,2129,1920,1956,2281,2404,2296,2204,2267,2276,2117,2026,2018,2034,1884,
-    1599,1529,1642,1596,1453,1364,1456,1508,1418,1462,1590,1704,1711,1661,1751,1912,
-    1990,1958,1932,2034,2041,1967,1951,1993,1967,1886,1753,1733,1757,1698,1600,1540,
-    1574,1589,1557,1595,1691,1715,1744,1751,1857,1963,1960,1944,1973,1992,2005,1951,
-    1927,1909,1831,1759,1708,1706,1678,1610,1562,1580,1605,1620,1614,1644,1687,1714,
-    1737,1778,1822,1845,1822,1824,1849,1837,1805,1785,1743,1718,1682,1646,1647,1624,
-    1570,1517,1538,1545,1511,1499,1491,1518,1527,1471,1509,1529,1494,1542,1756,2142,
-    2309,2076,2151,2676,2955,2716,2514,2611,2589,2337,2145,2134,2042,1706,1295,1233,
-    1389,1365,1147,1048,1238,1398,1381,1450,1720,1931,1940,1925,2055,2281,2358,2238,
-    2141,2169,2174,2022,1877,1856,1791,1589,1419,1409,1451,1408,1322,1312,1425,1518,
-    1558,1630,1762,1892,1922,1966,2073,2177,2167,2083,2041,2049,2011,1905,1782,1712,
-    1668,1581,1551,1540,1529,1528,1552,1614,1675,1740,1803,1855,1923,1969,2012,2036,
-    2054,2039,2008,1999,1940,1852,1775,1734,1681,1624,1580,1548,1530,1535,1550,1588,
-    1627,1643,1656,1705,1780,1791,1782,1785,1799,1829,1829,1791,1765,1750,1732,1701,
-    1683,1681,1628,1569,1533,1555,1555,1539,1520,1502,1498,1542,1576,1564,1594,1749,
-    2320,2598,2052,1890,2785,3267,2601,2149,2500,2569,2080,1824,1960,1919,1454,1030,
-    1093,1456,1520,1183,1032,1456,1841,1738,1650,2002,2219,2097,2033,2168,2314,2223,
-    1926,1751,1857,1882,1614,1373,1409,1451,1334,1249,1339,1466,1488,1474,1610,1833,
-    1998,2012,2033,2178,2311,2284,2195,2180,2181,2069,1890,1804,1752,1665,1509,1388,
-    1406,1453,1401,1382,1466,1618,1720,1767,1874,2008,2136,2147,2139,2226,2253,2136,
-    1998,1965,1931,1832,1681,1548,1497,1458,1409,1372,1410,1453,1475,1560,1705,1798,
-    1811,1813,1867,1934,1973,1974,1904,1863,1817,1785,1772,1757,1638,1557,1585,1650,
-    1673,1617,1593,1596,1624,1691,1764,1760,1736,1736,1780,1811,1838,1804,1792,1811,
-    1776,1752,1797,1782,1698,1677,1666,1616,1688,2020,2252,1998,1709,2144,2737,2557,
-    2030,2011,2281,2154,1867,1834,1836,1609,1304,1274,1476,1596,1390,1172,1351,1732,
-    1840,1714,1750,1959,2049,2050,2137,2182,2124,1963,1854,1934,1999,1833,1580,1545,
-    1647,1627,1588,1599,1612,1590,1616,1697,1831,1909,1861,1816,1867,2005,2049,1985,
-    1883,1836,1854,1844,1770,1716,1690,1641,1578,1579,1643,1659,1593,1595,1707,1787,
-    1793,1781,1945,2090,1975,1891,2024,2155,2052,1831,1767,1843,1831,1698,1595,1622,
-    1606,1512,1520,1620,1664,1618,1612,1741,1859,1828,1758,1790,1842,1839,1828,1775,
-    1744,1719,1688,1690,1731,1682,1608,1657,1772,1814,1774,1751,1785,1841,1856,1863,
-    1856,1821,1789,1827,1844,1825,1763,1699,1680,1696,1667,1630,1579,1520,1520,1550,
-    1576,1563,1536,1534,1574,1783,2252,2327,1849,1895,2688,2935,2335,2010,2303,2389,
-    2111,1915,1887,1762,1456,1278,1415,1583,1438,1151,1198,1650,1879,1692,1602,1847,
-    2085,2137,2133,2129,2096,2051,1981,1961,2010,1887,1604,1498,1619,1693,1557,1387,
-    1360,1455,1566,1614,1622,1661,1719,1794,1925,2046,2071,2003,1981,2045,2092,2058,
-    1953,1841,1782,1762,1724,1630,1556,1500,1475,1494,1542,1562,1566,1618,1735,1864,
-    1985,2001,1970,2044,2137,2161,2072,1980,1915,1874,1822,1735,1644,1583,1516,1492,
-    1551,1589,1570,1555,1607,1700,1748,1786,1834,1868,1886,1917,1915,1889,1875,1849,
-    1841,1830,1804,1729,1715,1748,1725,1689,1660,1645,1640,1665,1726,1742,1708,1729,
-    1789,1848,1857,1819,1813,1836,1836,1823,1819,1790,1739,1707,1701,1685,1678,1619,
-    1533,1556,1615,1576,1548,1563,1793,2182,2090,1740,2082,2784,2675,2107,2114,2457,
-    2420,2117,1902,1861,1800,1585,1424,1483,1508,1292,1128,1341,1677,1643,1396,1469,
-    1812,2003,1988,1920,1929,2045,2143,2125,2103,2058,1918,1813,1877,1925,1771,1567,
-    1483,1544,1615,1573,1499,1479,1543,1631,1730,1775,1773,1818,1901,2014,2068,2043,
-    1983,1970,1986,1981,1911,1784,1690,1674,1683,1621,1495,1438,1485,1548,1582,1623,
-    1666,1689,1789,1885,1956,1990,1973,1972,2019,2077,2042,1936,1858,1845,1852,1800,
-    1720,1678,1625,1636,1690,1666,1612,1612,1623,1670,1732,1733,1699,1698,1773,1845,
-    1883,1881,1854,1843,1870,1921,1894,1813,1765,1756,1754,1723,1708,1658,1617,1609,
-    1625,1673,1675,1639,1640,1712,1762,1773,1780,1789,1778,1822,1893,1877,1818,1814,
-    1828,1817,1812,1782,1773,1766,1734,1721,1762,1785,1732,1696,1750,1799,1798,1754,
-    1712,1723,1980,2195,1876,1682,2151,2496,2186,1863,1964,2202,2219,1967,1748,1839,
-    1870,1663,1593,1658,1581,1444,1471,1654,1756,1628,1476,1638,1908,1939,1821,1744,
-    1840,1995,2019,1901,1855,1856,1838,1863,1888,1822,1706,1666,1722,1800,1771,1637,
-    1587,1685,1770,1773,1713,1676,1717,1781,1805,1804,1798,1769,1780,1846,1875,1883,
-    1831,1769,1835,1929,1870,1738,1744,1844,1874,1801,1720,1728,1788,1796,1771,1767,
-    1777,1788,1765,1769,1808,1797,1758,1744,1794,1816,1781,1722,1721,1745,1748,1739,
-    1709,1713,1745,1764,1746,1757,1766,1774,1766,1760,1759,1767,1786,1794,1756,1724,
-    1735,1758,1759,1736,1717,1730,1763,1771,1757,1721,1723,1741,1766,1745,1729,1741,
-    1765,1791,1783,1802,1832,1812,1796,1853,1891,1836,1790,1817,1847,1846,1802,1780,
-    1823,1846,1814,1821,1846,1826,1809,1839,1863,1857,1818,1781,1804,1834,1825,1815,
-    1795,1783,1818,1864,1852,1805,1796,1828,1854,1850,1816,1789,1797,1834,1841,1786,
-    1767,1786,1797,1797,1799,1770,1775,1812,1808,1786,1762,1754,1770,1782,1768,1728,
-    1721,1752,1740,1727,1752,1760,1736,1754,1808,1835,1812,1782,1795,1832,1848,1813,
-    1790,1808,1824,1801,1779,1795,1800,1764,1742,1765,1797,1790,1736,1739,1785,1800,
-    1761,1743,1750,1746,1761,1777,1751,1723,1726,1749,1768,1753,1728,1708,1717,1734,
-    1760,1756,1728,1728,1745,1766,1770,1752,1724,1738,1781,1794,1777,1759,1770,1780,
-    1782,1796,1818,1810,1811,1836,1824,1800,1795,1800,1800,1795,1767,1750,1751,1767,
-    1768,1763,1730,1704,1726,1744,1730,1690,1663,1683,1724,1700,1677,1676,1793,1909,
-    1849,1824,1943,2077,2087,2009,2011,2106,2122,2048,1980,1982,1970,1910,1849,1821,
-    1791,1714,1692,1737,1703,1626,1596,1616,1683,1679,1615,1620,1688,1718,1730,1718,
-    1729,1765,1782,1802,1839,1847,1824,1828,1859,1873,1840,1806,1801,1810,1809,1788,
-    1757,1754,1749,1733,1705,1723,1735,1724,1721,1723,1726,1735,1748,1748,1747,1753,
-    1761,1780,1803,1806,1809,1808,1824,1819,1821,1852,1871,1832,1819,1861,1873,1818,
-    1776,1788,1816,1802,1741,1733,1775,1778,1735,1727,1758,1772,1755,1768,1785,1781,
-    1768,1771,1782,1785,1765,1737,1743,1758,1750,1728,1725,1745,1755,1740,1746,1759,
-    1757,1773,1788,1785,1773,1774,1791,1801,1782,1758,1771,1794,1794,1772,1757,1772,
-    1776,1751,1739,1755,1771,1752,1738,1735,1730,1730,1696,1681,1721,1746,1738,1748,
-    1780,1802,1804,1823,1877,1937,1961,1922,1916,1948,1979,1985,1943,1920,1924,1938,
-    1917,1885,1860,1826,1808,1802,1790,1762,1742,1746,1757,1743,1703,1699,1720,1738,
-    1730,1714,1728,1759,1773,1774,1797,1801,1805,1814,1833,1834,1830,1833,1819,1816,
-    1814,1804,1774,1766,1764,1774,1778,1748,1744,1759,1766,1758,1750,1761,1778,1790,
-    1795,1805,1797,1788,1799,1819,1838,1829,1815,1816,1841,1852,1823,1790,1784,1804,
-    1809,1786,1749,1735,1740,1744,1737,1723,1712,1721,1723,1734,1744,1749,1745,1737,
-    1745,1753,1757,1743,1739,1756,1756,1742,1749,1748,1754,1747,1755,1767,1783,1772,
-    1765,1766,1771,1793,1796,1788,1791,1805,1797,1790,1784,1790,1783,1769,1753,1753,
-    1757,1753,1730,1751,1766,1757,1772,1788,1823,1852,1871,1892,1910,1931,1957,1942,
-    1938,1934,1936,1926,1907,1887,1864,1834,1801,1788,1791,1769,1727,1708,1713,1724,
-    1701,1677,1681,1697,1699,1701,1709,1730,1744,1748,1752,1758,1767,1784,1796,1808,
-    1813,1816,1811,1807,1812,1811,1806,1800,1809,1807,1806,1797,1786,1783,1786,1769,
-    1767,1769,1757,1763,1764,1761,1757,1760,1765,1769,1769,1758,1761,1770,1770,1772,
-    1776,1774,1767,1771,1779,1795,1802,1791,1784,1788,1791,1801,1787,1778,1780,1792,
-    1798,1795,1797,1789,1787,1784,1798,1808,1802,1799,1805,1811,1822,1828,1817,1806,
-    1800,1812,1818,1808,1808,1801,1798,1798,1802,1805,1804,1801,1793,1806,1810,1793,
-    1783,1781,1784,1784,1783,1772,1770,1778,1780,1772,1764,1767,1761,1756,1754,1761,
-    1758,1755,1746,1748,1743,1745,1746,1739,1745,1745,1755,1758,1764,1761,1764,1773,
-    1776,1769,1775,1785,1785,1781,1783,1792,1789,1793,1800,1811,1821,1828,1824,1825,
-    1834,1826,1811,1815,1816,1820,1818,1818,1815,1810,1809,1808,1803,1793,1797,1797,
-    1794,1790,1780,1768,1772,1782,1776,1769,1773,1782,1782,1774,1782,1788,1793,1795,
-    1793,1799,1802,1801,1793,1796,1800,1794,1787,1771,1781,1779,1771,1770,1782,1787,
-    1776,1766,1767,1781,1783,1785,1781,1783,1788,1792,1791,1790,1788,1789,1789,1786,
-    1784,1793,1788,1775,1775,1782,1781,1772,1774,1776,1779,1780,1776,1773,1778,1781,
-    1784,1790,1793,1788,1789,1781,1780,1783,1774,1777,1788,1778,1763,1768,1766,1765,
-    1769,1767,1760,1765,1772,1778,1777,1777,1779,1774,1778,1780,1779,1775,1782,1782,
-    1782,1776,1782,1793,1800,1796,1796,1803,1816,1821,1814,1817,1819,1821,1817,1826,
-    1813,1810,1808,1799,1807,1806,1798,1789,1791,1796,1784,1773,1767,1763,1760,1757,
-    1764,1770,1768,1771,1774,1779,1778,1782,1783,1791,1794,1786,1786,1788,1793,1789,
-    1791,1791,1796,1799,1795,1798,1802,1794,1797,1806,1808,1810,1810,1806,1800,1799,
-    1797,1795,1788,1785,1785,1785,1775,1764,1767,1775,1777,1773,1770,1777,1778,1774,
-    1773,1770,1776,1776,1765,1775,1794,1792,1786,1790,1784,1776,1768,1771,1781,1779,
-    1771,1767,1774,1781,1784,1783,1786,1792,1800,1798,1800,1802,1796,1789,1790,1793,
-    1793,1795,1794,1792,1790,1793,1790,1790,1789,1792,1798,1799,1797,1797,1786,1789,
-    1804,1807,1803,1797,1800,1806,1803,1794,1796,1800,1795,1786,1786,1792,1789,1786,
-    1775,1771,1766,1762,1764,1775,1777,1764,1763,1772,1784,1772,1765,1768,1769,1780,
-    1779,1771,1769,1776,1783,1785,1791,1793,1786,1780,1786,1787,1779,1778,1783,1789,
-    1788,1786,1785,1790,1795,1792,1797,1792,1787,1784,1772,1770,1764,1770,1769,1758,
-    1758,1773,1777,1775,1776,1784,1782,1779,1779,1786,1789,1783,1782,1784,1783,1776,
-    1776,1775,1783,1784,1779,1790,1794,1790,1790,1801,1809,1806,1802,1798,1807,1811,
-    1810,1808,1805,1803,1801,1792,1801,1796,1784,1786,1800,1798,1779,1780,1788,1795,
-    1790,1785,1782,1789,1780,1768,1767,1766,1764,1768,1774,1778,1776,1773,1780,1785,
-    1780,1779,1782,1793,1796,1790,1788,1788,1796,1786,1784,1787,1790,1788,1791,1799,
-    1789,1779,1781,1787,1792,1790,1792,1795,1790,1790,1792,1787,1783,1784,1777,1786,
-    1791,1781,1775,1778,1784,1789,1790,1781,1777,1775,1780,1787,1788,1783,1785,1793,
-    1797,1785,1785,1788,1784,1782,1788,1793,1784,1787,1791,1786,1778,1781,1779,1781,
-    1785,1788,1791,1795,1794,1795,1798,1786,1786,1784,1783,1785,1796,1802,1801,1796,
-    1794,1788,1780,1773,1787,1786,1781,1780,1782,1779,1771,1774,1769,1783,1787,1793,
-    1782,1780,1777,1780,1789,1787,1783,1774,1772,1784,1786,1781,1762,1774,1780,1788,
-    1779,1771,1770,1782,1782,1783,1791,1792,1782,1773,1782,1781,1783,1775,1776,1769,
-    1868,1810,1799,1782,1806,1806,1774,1795,1766,1788,1767,1799,1804,1812,1801,1811,
-    1805,1830,1789,1800,1794,1809,1817,1796,1823,1778,1799,1790,1797,1785,1766,1784,
-    1773,1782,1767,1772,1787,1773,1782,1757,1789,1772,1788,1774,1762,1777,1785,1800,
-    1786,1784,1784,1796,1798,1798,1796,1784,1778,1798,1783,1798,1782,1800,1791,1805,
-    1790,1773,1765,1781,1778,1792,1783,1786,1773,1773,1790,1779,1800,1763,1807,1779,
-    1814,1800,1806,1800,1812,1818,1802,1803,1799,1805,1787,1796,1788,1775,1800,1825,
-    1822,1804,1792,1788,1763,1753,1742,1717,1703,1711,1729,1747,1751,1770,1792,1792,
-    1788,1791,1791,1818,1817,1807,1783,1791,1768,1828,1771,1834,1765,1812,1781,1800,
-    1818,1787,1804,1755,1844,1747,1827,1730,1821,1761,1797,1763,1796,1776,1780,1788,
-    1780,1783,1748,1797,1770,1800,1756,1793,1761,1785,1745,1785,1750,1791,1767,1798,
-    1778,1816,1765,1794,1796,1774,1796,1772,1797,1751,1788,1765,1791,1762,1789,1782,
-    1787,1793,1778,1818,1782,1813,1789,1789,1810,1797,1827,1791,1815,1779,1829,1793,
-    1812,1786,1786,1790,1772,1787,1785,1767,1798,1779,1783,1770,1767,1792,1754,1778,
-    1766,1785,1748,1804,1771,1782,1749,1801,1765,1786,1775,1769,1789,1759,1815,1781,
-    1796,1776,1818,1804,1775,1795,1801,1794,1791,1795,1791,1785,1806,1771,1817,1776,
-    1784,1798,1778,1821,1762,1815,1765,1790,1778,1753,1814,1754,1804,1786,1783,1804,
-    1749,1836,1752,1825,1782,1774,1819,1770,1811,1744,1814,1764,1790,1765,1799,1781,
-    1788,1806,1744,1792,1767,1779,1802,1734,1799,1766,1789,1783,1764,1803,1733,1805,
-    1763,1759,1793,1716,1839,1749,1785,1808,1757,1830,1753,1822,1753,1831,1778,1816,
-    1838,1815,1776,1842,1767,1850,1779,1795,1837,1757,1860,1726,1862,1761,1790,1779,
-    1791,1785,1784,1794,1768,1802,1764,1813,1769,1813,1769,1777,1806,1733,1804,1735,
-    1787,1773,1779,1778,1795,1786,1781,1794,1784,1766,1770,1784,1745,1788,1763,1785,
-    1794,1750,1828,1741,1810,1769,1786,1832,1700,1877,1755,1950,1773,1804,1852,1757,
-    1910,1626,1853,1693,1740,1791,1719,1854,1716,1828,1746,1867,1716,1825,1734,1802,
-    1786,1772,1750,1793,1739,1750,1812,1725,1813,1731,1806,1704,1857,1692,1837,1713,
-    1847,1737,1822,1751,1769,1786,1783,1725,1817,1764,1750,1896,1625,1987,1604,1960,
-    1638,1873,1793,1722,1929,1607,1975,1623,1939,1668,1874,1718,1801,1757,1799,1799,
-    1738,1840,1680,1902,1601,1956,1591,1965,1589,1960,1653,1844,1794,1767,1865,1694,
-    1932,1608,2005,1544,2086,1540,2027,1597,1914,1812,1717,1969,1598,2039,1552,2033,
-    1646,1874,1785,1764,1815,1770,1813,1739,1814,1780,1775,1806,1764,1741,1872,1639,
-    1940,1677,1841,1761,1755,1863,1707,1913,1690,1875,1728,1839,1748,1796,1793,1762,
-    1806,1728,1868,1678,1861,1686,1892,1741,1787,1824,1698,1892,1679,1879,1704,1850,
-    1778,1747,1904,1671,1891,1674,1822,1715,1812,1747,1795,1808,1740,1846,1706,1916,
-    1612,1990,1568,1992,1636,1833,1839,1673,1939,1621,1896,1675,1887,1682,1900,1652,
-    1903,1667,1830,1787,1712,1905,1654,1932,1657,1895,1757,1735,1898,1660,1936,1681,
-    1808,1853,1686,1898,1713,1859,1746,1813,1815,1755,1808,1824,1771,1830,1753,1838,
-    1739,1804,1842,1714,1886,1709,1823,1759,1766,1864,1650,1921,1670,1867,1744,1773,
-    1883,1633,1969,1585,1994,1551,1986,1614,1891,1798,1642,1960,1589,1962,1651,1841,
-    1744,1794,1782,1784,1747,1845,1680,1895,1639,1945,1650,1872,1705,1806,1815,1682,
-    1908,1665,1891,1706,1875,1697,1884,1675,1924,1636,1909,1669,1846,1763,1757,1841,
-    1714,1848,1753,1817,1723,1874,1684,1950,1577,2025,1545,1968,1665,1792,1874,1607,
-    1937,1637,1918,1672,1862,1733,1847,1700,1961,1557,2043,1581,1951,1737,1732,1960,
-    1588,1987,1583,1972,1612,1923,1636,1940,1641,1894,1717,1786,1828,1689,1913,1637,
-    1946,1690,1860,1750,1827,1778,1815,1784,1823,1776,1824,1760,1839,1791,1791,1829,
-    1693,1922,1683,1877,1757,1797,1821,1748,1847,1724,1898,1690,1884,1708,1834,1784,
-    1772,1830,1762,1856,1694,1914,1643,1933,1656,1869,1792,1738,1861,1742,1845,1762,
-    1823,1778,1825,1737,1865,1727,1863,1711,1907,1699,1812,1842,1708,1917,1669,1892,
-    1754,1745,1865,1661,1905,1652,1854,1764,1723,1863,1641,1941,1623,1917,1712,1764,
-    1879,1652,1899,1689,1794,1809,1645,1910,1623,1891,1637,1796,1832,1594,2023,1500,
-    2013,1597,1852,1802,1656,1991,1543,1983,1598,1913,1708,1825,1760,1774,1807,1725,
-    1845,1714,1821,1762,1849,1671,1903,1664,1909,1682,1865,1751,1796,1819,1719,1890,
-    1672,1863,1775,1727,1899,1649,1907,1710,1817,1867,1636,1985,1569,1977,1624,1877,
-    1764,1715,1886,1705,1838,1770,1794,1768,1788,1805,1768,1824,1801,1727,1924,1612,
-    2013,1587,1938,1769,1749,1954,1536,2124,1479,2075,1604,1870,1891,1573,2102,1466,
-    2063,1651,1786,1898,1565,2012,1625,1812,1877,1615,1934,1615,1864,1745,1723,1894,
-    1642,1915,1685,1865,1775,1725,1877,1727,1792,1828,1676,1915,1649,1845,1794,1658,
-    1969,1485,2085,1519,1954,1709,1717,1934,1559,2082,1484,2075,1630,1851,1865,1679,
-    1951,1678,1875,1805,1746,1895,1680,1951,1732,1814,1901,1661,1941,1673,1895,1715,
-    1841,1778,1772,1788,1832,1661,1918,1649,1867,1723,1776,1859,1678,1875,1723,1831,
-    1696,1883,1647,1910,1617,1974,1599,1936,1693,1789,1837,1687,1941,1611,1921,1731,
-    1768,1827,1777,1753,1913,1561,2079,1530,1956,1761,1715,1928,1618,1951,1605,1878,
-    1769,1704,1860,1747,1685,1904,1640,1925,1680,1801,1842,1625,1895,1673,1807,1759,
-    1701,1840,1712,1753,1835,1683,1861,1688,1809,1784,1749,1800,1786,1748,1806,1798,
-    1751,1898,1630,1991,1629,1920,1726,1812,1876,1708,1903,1705,1892,1697,1940,1660,
-    1909,1664,1879,1724,1860,1773,1808,1827,1759,1871,1676,1952,1657,1919,1646,1944,
-    1677,1887,1713,1858,1724,1854,1742,1778,1857,1653,1984,1584,1973,1709,1806,1788,
-    1821,1721,1906,1596,2029,1632,1867,1821,1636,2060,1460,2103,1568,1854,1864,1626,
-    1929,1690,1815,1793,1683,1905,1658,1871,1791,1704,1914,1628,1938,1683,1819,1834,
-    1620,1945,1625,1834,1772,1719,1879,1715,1845,1738,1817,1784,1762,1819,1764,1784,
-    1828,1717,1856,1731,1802,1829,1712,1828,1761,1765,1786,1795,1751,1827,1692,1858,
-    1750,1788,1808,1754,1824,1715,1847,1691,1855,1759,1793,1790,1775,1796,1759,1833,
-    1715,1870,1703,1842,1760,1839,1771,1809,1829,1739,1870,1717,1871,1767,1824,1789,
-    1773,1823,1766,1826,1757,1850,1745,1824,1764,1796,1786,1762,1813,1717,1827,1728,
-    1828,1748,1829,1728,1814,1744,1795,1761,1787,1788,1742,1804,1732,1815,1723,1836,
-    1753,1761,1798,1738,1794,1780,1726,1828,1719,1819,1754,1800,1781,1797,1801,1758,
-    1818,1745,1825,1764,1790,1800,1774,1799,1806,1795,1778,1791,1783,1796,1787,1774,
-    1825,1746,1815,1770,1806,1806,1771,1824,1756,1831,1758,1801,1763,1768,1809,1720,
-    1833,1714,1832,1734,1799,1781,1775,1834,1709,1865,1719,1828,1774,1779,1818,1768,
-    1790,1789,1782,1821,1755,1826,1771,1816,1777,1801,1824,1736,1881,1720,1857,1768,
-    1827,1789,1798,1809,1760,1813,1758,1775,1790,1747,1773,1775,1750,1818,1712,1818,
-    1737,1776,1763,1756,1780,1757,1784,1751,1794,1767,1776,1770,1787,1773,1811,1773,
-    1792,1811,1763,1806,1788,1759,1818,1759,1786,1800,1746,1816,1765,1794,1779,1779,
-    1802,1773,1816,1780,1788,1818,1758,1842,1783,1798,1839,1754,1841,1751,1822,1772,
-    1804,1788,1774,1828,1750,1835,1756,1806,1790,1788,1794,1787,1787,1797,1790,1779,
-    1778,1776,1775,1798,1777,1775,1801,1754,1804,1760,1785,1768,1778,1777,1778,1779,
-    1770,1786,1775,1760,1801,1786,1788,1806,1784,1791,1790,1791,1782,1807,1772,1815,
-    1764,1804,1786,1789,1798,1774,1790,1771,1766,1772,1776,1770,1788,1749,1803,1763,
-    1798,1773,1782,1793,1762,1793,1772,1775,1780,1774,1763,1788,1764,1781,1762,1775,
-    1771,1785,1779,1798,1784,1797,1793,1775,1814,1774,1827,1766,1820,1782,1797,1800,
-    1771,1803,1771,1798,1785,1785,1781,1789,1777,1788,1773,1801,1775,1790,1788,1788,
-    1796,1787,1807,1778,1801,1789,1796,1779,1792,1780,1779,1794,1765,1792,1764,1796,
-    1772,1784,1783,1766,1797,1774,1794,1781,1770,1796,1777,1781,1794,1763,1807,1765,
-    1797,1778,1769,1804,1770,1807,1785,1788,1803,1781,1793,1779,1781,1786,1781,1793,
-    1783,1799,1792,1797,1785,1819,1780,1817,1790,1793,1805,1786,1814,1789,1801,1788,
-    1806,1797,1811,1785,1815,1782,1823,1789,1806,1802,1790,1810,1768,1802,1752,1822,
-    1767,1807,1781,1776,1805,1768,1808,1767,1788,1780,1767,1790,1772,1775,1784,1766,
-    1791,1756,1788,1768,1778,1786,1771,1799,1786,1801,1788,1794,1795,1795,1785,1787,
-    1787,1799,1789,1803,1784,1799,1786,1799,1795,1802,1807,1789,1815,1779,1819,1777,
-    1792,1794,1786,1788,1788,1779,1788,1780,1783,1780,1776,1786,1767,1802,1765,1808,
-    1778,1782,1792,1777,1790,1784,1782,1790,1781,1788,1792,1782,1795,1777,1785,1785,
-    1786,1781,1791,1781,1781,1777,1782,1782,1788,1795,1792,1804,1793,1801,1801,1802,
-    1803,1789,1797,1785,1777,1792,1775,1782,1779,1770,1768,1760,1774,1754,1779,1758,
-    1771,1779,1767,1780,1767,1780,1771,1775,1769,1775,1777,1782,1775,1789,1774,1794,
-    1786,1788,1793,1774,1799,1779,1793,1790,1791,1800,1799,1805,1806,1797,1811,1792,
-    1800,1785,1797,1798,1794,1798,1782,1803,1776,1794,1762,1782,1772,1775,1777,1779,
-    1784,1793,1788,1793,1800,1784,1808,1776,1817,1768,1801,1785,1782,1798,1776,1801,
-    1777,1801,1796,1788,1793,1793,1794,1800,1779,1797,1781,1789,1789,1775,1773,1769,
-    1782,1771,1788,1780,1783,1785,1777,1775,1777,1783,1779,1781,1777,1777,1780,1779,
-    1779,1786,1783,1789,1794,1797,1794,1791,1786,1790,1782,1791,1794,1790,1796,1785,
-    1792,1786,1793,1782,1789,1793,1798,1794,1799,1784,1789,1788,1779,1796,1777,1793,
-    1776,1786,1783,1772,1785,1777,1776,1778,1781,1781,1785,1782,1790,1786,1792,1789,
-    1783,1794,1782,1794,1785,1789,1796,1777,1789,1785,1782,1787,1789,1797,1794,1791,
-    1806,1789,1797,1789,1783,1799,1781,1801,1778,1787,1784,1780,1782,1773,1781,1782,
-    1783,1779,1787,1769,1784,1764,1779,1773,1777,1768,1766,1775,1767,1787,1776,1781,
-    1776,1785,1777,1780,1779,1782,1784,1787,1793,1794,1793,1790,1796,1796,1790,1789,
-    1792,1794,1794,1797,1787,1789,1800,1787,1798,1785,1795,1789,1783,1783,1779,1787,
-    1778,1786,1775,1778,1777,1779,1764,1772,1773,1768,1778,1768,1782,1779,1781,1775,
-    1779,1774,1786,1779,1784,1791,1787,1790,1781,1786,1774,1787,1777,1785,1776,1776,
-    1773,1773,1770,1774,1777,1774,1785,1771,1788,1779,1784,1782,1785,1794,1782,1791,
-    1778,1783,1783,1772,1782,1781,1780,1782,1778,1786,1783,1782,1788,1783,1794,1788,
-    1785,1780,1773,1780,1773,1773,1769,1767,1781,1770,1790,1791,1783,1790,1775,1785,
-    1777,1775,1780,1774,1783,1785,1778,1784,1782,1797,1786,1802,1800,1794,1800,1790,
-    1803,1795,1795,1789,1791,1789,1793,1790,1791,1789,1789,1791,1792,1796,1792,1791,
-    1784,1785,1788,1786,1786,1791,1787,1796,1792,1798,1798,1805,1808,1801,1799,1796,
-    1803,1801,1805,1790,1790,1781,1788,1772,1782,1785,1777,1782,1775,1783,1773,1776,
-    1769,1772,1769,1783,1781,1781,1784,1775,1780,1768,1770,1773,1781,1783,1784,1780,
-    1786,1787,1788,1795,1790,1801,1791,1798,1797,1803,1799,1795,1795,1791,1801,1790,
-    1799,1792,1793,1789,1792,1793,1796,1801,1803,1801,1802,1800,1802,1801,1793,1792,
-    1785,1789,1786,1785,1782,1782,1776,1778,1779,1784,1788,1785,1778,1786,1778,1780,
-    1773,1776,1777,1780,1789,1784,1784,1784,1790,1784,1789,1789,1793,1787,1791,1780,
-    1785,1779,1787,1790,1793,1803,1798,1798,1796,1798,1790,1793,1789,1789,1784,1788,
-    1777,1787,1775,1780,1784,1779,1779,1771,1779,1772,1777,1770,1773,1781,1777,1780,
-    1785,1782,1791,1778,1789,1780,1781,1788,1777,1786,1777,1782,1778,1788,1786,1790,
-    1794,1794,1795,1792,1794,1796,1795,1791,1798,1795,1797,1788,1790,1793,1791,1792,
-    1780,1786,1781,1784,1781,1777,1784,1777,1784,1780,1778,1786,1779,1782,1780,1783,
-    1786,1793,1785,1788,1793,1781,1794,1792,1800,1796,1791,1794,1791,1790,1794,1786,
-    1785,1782,1786,1785,1791,1785,1787,1786,1780,1781,1777,1785,1766,1786,1772,1784,
-    1781,1776,1787,1772,1776,1773,1775,1776,1768,1780,1779,1783,1793,1783,1799,1780,
-    1794,1782,1787,1789,1790,1803,1790,1799,1802,1811,1805,1809,1803,1805,1801,1805,
-    1801,1799,1797,1793,1792,1792,1796,1787,1788,1784,1787,1787,1789,1789,1785,1784,
-    1781,1785,1790,1787,1794,1784,1786,1785,1781,1786,1778,1779,1768,1778,1781,1789,
-    1789,1785,1790,1787,1792,1794,1794,1790,1778,1788,1785,1786,1783,1780,1789,1772,
-    1792,1784,1796,1785,1782,1787,1783,1789,1777,1781,1776,1786,1780,1778,1780,1780,
-    1780,1778,1777,1781,1784,1785,1773,1767,1774,1767,1765,1759,1767,1766,1764,1773,
-    1770,1782,1777,1784,1779,1786,1788,1786,1789,1784,1784,1788,1788,1787,1779,1779,
-    1788,1783,1791,1779,1788,1781,1787,1784,1777,1787,1784,1786,1781,1772,1778,1776,
-    1786,1775,1777,1777,1774,1787,1783,1788,1783,1792,1787,1786,1794,1793,1792,1790,
-    1782,1789,1786,1794,1785,1789,1789,1784,1788,1787,1799,1790,1788,1785,1780,1781,
-    1786,1782,1789,1792,1797,1795,1789,1789,1784,1792,1788,1799,1798,1797,1797,1790,
-    1792,1791,1799,1795,1801,1790,1800,1793,1796,1798,1798,1802,1802,1807,1809,1814,
-    1798,1798,1792,1793,1787,1786,1784,1790,1787,1781,1778,1780,1780,1775,1776,1784,
-    1780,1779,1782,1771,1776,1774,1781,1772,1778,1783,1786,1791,1789,1782,1785,1781,
-    1785,1788,1783,1790,1784,1784,1778,1782,1784,1788,1787,1790,1791,1796,1796,1798,
-    1803,1803,1801,1796,1793,1793,1797,1784,1791,1786,1795,1791,1788,1791,1786,1796,
-    1788,1792,1789,1789,1788,1791,1794,1800,1790,1787,1787,1787,1792,1783,1783,1782,
-    1784,1781,1777,1774,1775,1772,1772,1776,1783,1785,1783,1787,1786,1794,1800,1800,
-    1801,1793,1795,1790,1789,1789,1785,1786,1784,1789,1786,1788,1786,1780,1783,1779,
-    1783,1786,1786,1787,1784,1780,1780,1778,1782,1781,1784,1781,1779,1781,1775,1779,
-    1774,1782,1775,1777,1777,1781,1781,1779,1781,1777,1789,1790,1788,1792,1796,1795,
-    1798,1795,1800,1785,1790,1792,1789,1792,1790,1794,1792,1794,1787,1789,1784,1785,
-    1785,1788,1787,1789,1787,1785,1786,1785,1784,1785,1789,1788,1791,1780,1780,1778,
-    1788,1785,1781,1784,1786,1790,1787,1787,1786,1784,1773,1778,1780,1782,1782,1778,
-    1779,1780,1777,1784,1786,1789,1789,1786,1785,1783,1787,1785,1784,1788,1789,1802,
-    1800,1800,1800,1794,1799,1796,1803,1802,1804,1808,1802,1798,1794,1791,1792,1793,
-    1792,1787,1786,1783,1779,1775,1769,1770,1764,1764,1764,1763,1765,1769,1770,1769,
-    1771,1777,1786,1784,1784,1787,1787,1791,1793,1790,1793,1793,1794,1790,1796,1793,
-    1792,1790,1788,1789,1787,1789,1786,1785,1785,1784,1782,1787,1778,1779,1779,1776,
-    1771,1773,1775,1766,1770,1773,1777,1777,1774,1783,1773,1774,1776,1766,1774,1772,
-    1775,1774,1774,1766,1772,1768,1769,1776,1783,1781,1778,1776,1771,1776,1773,1773,
-    1768,1775,1778,1788,1785,1785,1784,1787,1788,1787,1792,1792,1796,1787,1788,1787,
-    1784,1791,1788,1788,1791,1795,1796,1788,1790,1787,1785,1782,1784,1783,1782,1783,
-    1789,1787,1791,1787,1786,1782,1782,1781,1778,1783,1779,1786,1782,1780,1780,1778,
-    1775,1779,1780,1777,1786,1787,1789,1787,1780,1780,1784,1780,1775,1778,1783,1782,
-    1779,1783,1780,1781,1779,1782,1779,1785,1783,1776,1779,1772,1775,1777,1776,1777,
-    1784,1784,1785,1792,1795,1793,1799,1791,1791,1791,1791,1791,1784,1799,1796,1795,
-    1791,1788,1793,1785,1790,1789,1794,1793,1787,1789,1785,1790,1786,1782,1784,1785,
-    1788,1785,1782,1778,1778,1771,1765,1768,1773,1781,1779,1781,1783,1781,1787,1784,
-    1787,1794,1798,1801,1797,1798,1798,1796,1794,1785,1780,1787,1784,1782,1783,1783,
-    1786,1785,1788,1789,1790,1787,1786,1790,1788,1785,1784,1781,1781,1778,1777,1782,
-    1781,1784,1786,1791,1794,1798,1795,1797,1801,1805,1801,1802,1801,1804,1806,1799,
-    1797,1793,1793,1783,1784,1784,1786,1786,1778,1783,1777,1778,1783,1781,1787,1781,
-    1790,1791,1794,1795,1790,1797,1797,1795,1790,1789,1789,1786,1783,1786,1784,1793,
-    1792,1792,1786,1781,1785,1780,1780,1779,1780,1780,1777,1783,1779,1777,1779,1783,
-    1782,1778,1785,1784,1786,1787,1785,1783,1790,1790,1790,1785,1784,1787,1789,1786,
-    1785,1787,1786,1791,1791,1793,1789,1791,1788,1793,1791,1796,1801,1797,1799,1796,
-    1793,1792,1793,1780,1779,1777,1779,1776,1773,1781,1780,1781,1783,1782,1783,1788,
-    1791,1787,1791,1796,1795,1794,1794,1795,1798,1806,1802,1804,1802,1805,1801,1797,
-    1796,1798,1791,1782,1784,1778,1780,1783,1784,1775,1776,1777,1780,1781,1781,1780,
-    1784,1787,1786,1788,1787,1794,1792,1794,1791,1793,1791,1786,1784,1780,1785,1783,
-    1784,1784,1782,1782,1783,1783,1783,1782,1783,1788,1787,1782,1781,1785,1784,1784,
-    1778,1781,1790,1787,1788,1785,1792,1796,1791,1796,1796,1795,1796,1800,1810,1801,
-    1797,1795,1795,1793,1788,1783,1778,1786,1782,1784,1785,1788,1787,1788,1787,1783,
-    1781,1779,1777,1775,1778,1780,1777,1774,1781,1780,1784,1779,1780,1785,1791,1793,
-    1787,1787,1785,1783,1784,1786,1789,1789,1788,1790,1787,1787,1781,1784,1783,1783,
-    1786,1782,1781,1779,1781,1787,1789,1790,1787,1790,1788,1785,1793,1792,1794,1788,
-    1787,1783,1786,1788,1789,1786,1784,1784,1789,1794,1788,1785,1784,1788,1791,1790,
-    1784,1781,1775,1776,1775,1776,1776,1778,1779,1780,1782,1779,1780,1783,1784,1783,
-    1786,1787,1793,1794,1791,1793,1793,1788,1787,1791,1795,1793,1796,1796,1797,1797,
-    1796,1798,1798,1801,1803,1807,1800,1805,1805,1807,1801,1802,1801,1802,1807,1799,
-    1802,1798,1798,1791,1789,1789,1790,1789,1789,1790,1788,1788,1791,1795,1795,1792,
-    1789,1787,1785,1786,1783,1784,1784,1788,1786,1786,1788,1791,1790,1793,1793,1790,
-    1791,1789,1789,1788,1790,1789,1787,1791,1794,1790,1792,1787,1787,1786,1789,1781,
-    1781,1781,1779,1778,1771,1771,1767,1771,1775,1771,1766,1765,1767,1764,1771,1777,
-    1773,1772,1770,1774,1774,1776,1771,1772,1776,1785,1784,1783,1783,1783,1783,1773,
-    1779,1781,1783,1778,1776,1776,1776,1775,1774,1778,1778,1776,1771,1769,1772,1766,
-    1763,1761,1762,1764,1763,1767,1770,1775,1778,1779,1779,1779,1778,1776,1776,1780,
-    1781,1780,1777,1775,1774,1780,1781,1784,1787,1788,1797,1792,1789,1789,1794,1789,
-    1788,1793,1793,1793,1787,1787,1786,1789,1783,1779,1776,1784,1787,1782,1782,1780,
-    1782,1781,1772,1774,1781,1779,1780,1779,1785,1781,1784,1788,1784,1786,1787,1791,
-    1791,1793,1793,1794,1796,1800,1795,1798,1795,1794,1799,1801,1805,1804,1801,1799,
-    1806,1799,1796,1794,1795,1794,1800,1803,1806,1807,1810,1807,1799,1802,1800,1802,
-    1801,1804,1799,1800,1794,1794,1799,1794,1790,1784,1781,1781,1777,1778,1782,1779,
-    1778,1779,1778,1777,1781,1779,1782,1787,1790,1791,1791,1785,1781,1780,1779,1779,
-    1782,1785,1783,1786,1786,1785,1788,1790,1791,1795,1795,1795,1792,1791,1792,1788,
-    1786,1784,1790,1796,1798,1795,1797,1795,1791,1790,1791,1793,1789,1787,1776,1777,
-    1779,1779,1779,1779,1784,1784,1782,1782,1790,1790,1790,1787,1796,1794,1787,1783,
-    1779,1779,1774,1770,1766,1765,1765,1765,1763,1768,1774,1775,1773,1775,1774,1776,
-    1775,1772,1770,1773,1778,1778,1776,1776,1777,1776,1778,1777,1778,1782,1786,1782,
-    1786,1788,1791,1791,1787,1790,1790,1791,1789,1788,1787,1787,1784,1781,1784,1787,
-    1787,1787,1782,1780,1783,1784,1782,1784,1787,1787,1793,1796,1796,1794,1794,1789,
-    1788,1788,1791,1793,1792,1793,1791,1791,1791,1785,1785,1786,1784,1782,1778,1779,
-    1779,1780,1779,1785,1785,1782,1787,1785,1782,1781,1781,1785,1783,1780,1781,1785,
-    1791,1788,1787,1792,1790,1794,1794,1794,1797,1797,1795,1790,1787,1785,1785,1783,
-    1782,1779,1783,1778,1778,1784,1789,1791,1787,1782,1784,1783,1783,1786,1783,1787,
-    1786,1784,1777,1771,1773,1780,1780,1781,1782,1781,1779,1776,1777,1774,1778,1777,
-    1775,1777,1776,1781,1781,1777,1773,1774,1776,1784,1782,1781,1783,1784,1785,1777,
-    1777,1779,1784,1787,1783,1781,1783,1784,1785,1786,1790,1792,1792,1787,1786,1789,
-    1786,1786,1783,1784,1783,1780,1782,1781,1780,1779,1775,1778,1781,1787,1783,1779,
-    1782,1783,1780,1779,1778,1778,1785,1785,1790,1795,1800,1800,1798,1795,1794,1794,
-    1795,1796,1802,1806,1807,1806,1801,1802,1803,1803,1792,1793,1796,1797,1797,1792,
-    1795,1795,1795,1790,1786,1788,1791,1791,1788,1789,1790,1789,1786,1785,1790,1790,
-    1789,1788,1786,1786,1783,1777,1775,1782,1782,1785,1787,1791,1792,1795,1797,1794,
-    1789,1791,1794,1792,1790,1790,1787,1786,1787,1780,1782,1782,1781,1782,1782,1782,
-    1785,1789,1784,1776,1781,1786,1789,1786,1784,1787,1786,1790,1786,1789,1794,1794,
-    1796,1800,1800,1798,1792,1791,1792,1796,1801,1800,1802,1797,1790,1782,1779,1783,
-    1783,1782,1783,1785,1785,1784,1781,1780,1782,1780,1779,1778,1787,1791,1790,1786,
-    1786,1784,1780,1784,1785,1786,1789,1789,1788,1786,1786,1790,1788,1786,1786,1788,
-    1787,1787,1791,1789,1788,1792,1789,1788,1789,1789,1787,1786,1784,1785,1785,1782,
-    1778,1776,1775,1777,1781,1779,1776,1772,1774,1773,1774,1775,1776,1778,1778,1780,
-    1777,1781,1783,1783,1784,1788,1795,1795,1792,1787,1788,1788,1784,1781,1779,1785,
-    1789,1793,1794,1791,1788,1787,1786,1788,1791,1786,1787,1788,1787,1787,1785,1784,
-    1785,1784,1790,1793,1796,1799,1800,1802,1794,1796,1792,1788,1789,1783,1779,1785,
-    1788,1783,1779,1777,1776,1777,1781,1781,1779,1781,1782,1778,1776,1775,1774,1774,
-    1776,1775,1776,1777,1783,1793,1794,1796,1807,1805,1804,1803,1795,1790,1790,1792,
-    1792,1795,1786,1776,1778,1779,1783,1784,1781,1782,1787,1790,1781,1782,1780,1772,
-    1775,1784,1787,1784,1786,1781,1786,1787,1785,1782,1783,1782,1785,1790,1788,1784,
-    1784,1788,1790,1791,1783,1778,1779,1780,1782,1779,1770,1766,1766,1769,1769,1772,
-    1765,1762,1766,1772,1771,1765,1760,1759,1765,1769,1773,1771,1766,1779,1788,1792,
-    1795,1786,1783,1785,1794,1791,1783,1776,1766,1767,1786,1792,1782,1770,1778,1795,
-    1815,1809,1790,1801,1807,1810,1801,1791,1790,1799,1790,1785,1797,1804,1802,1793,
-    1800,1805,1809,1804,1799,1799,1796,1806,1817,1801,1781,1782,1793,1797,1802,1802,
-    1803,1816,1830,1843,1844,1843,1836,1840,1841,1843,1835,1828,1821,1817,1819,1818,
-    1821,1811,1805,1800,1809,1810,1805,1791,1782,1785,1780,1772,1763,1751,1738,1724,
-    1717,1712,1713,1707,1681,1676,1683,1692,1700,1709,1713,1704,1710,1717,1744,1747,
-    1704,1676,1685,1718,1711,1671,1626,1636,1649,1649,1612,1583,1600,1615,1635,1655,
-    1703,1784,1917,2011,2054,2135,2308,2396,2298,2250,2305,2262,2104,2008,1936,1855,
-    1790,1709,1620,1626,1658,1607,1593,1676,1745,1733,1744,1793,1830,1831,1815,1796,
-    1800,1798,1754,1712,1705,1716,1700,1686,1691,1736,1770,1786,1801,1840,1884,1885,
-    1858,1862,1889,1877,1843,1807,1795,1782,1757,1733,1736,1747,1742,1737,1756,1786,
-    1793,1779,1772,1788,1798,1786,1757,1744,1731,1702,1670,1656,1651,1634,1614,1612,
-    1633,1653,1660,1669,1693,1718,1731,1735,1744,1743,1725,1733,1759,1765,1738,1708,
-    1702,1714,1715,1682,1645,1646,1664,1652,1626,1602,1605,1682,1725,1665,1660,1794,
-    1950,2014,1978,2018,2253,2432,2309,2160,2317,2460,2274,2090,2099,2058,1946,1872,
-    1780,1727,1761,1694,1546,1582,1716,1675,1575,1644,1745,1721,1699,1733,1754,1771,
-    1770,1727,1736,1803,1805,1741,1742,1806,1816,1778,1772,1799,1808,1809,1801,1785,
-    1795,1806,1766,1746,1778,1788,1749,1731,1755,1773,1760,1745,1753,1767,1765,1749,
-    1748,1766,1775,1753,1737,1745,1743,1721,1699,1685,1686,1683,1670,1664,1684,1698,
-    1697,1702,1731,1759,1765,1767,1775,1799,1804,1794,1795,1809,1796,1773,1758,1745,
-    1733,1714,1695,1683,1705,1714,1702,1696,1717,1743,1755,1748,1752,1784,1810,1815,
-    1805,1818,1830,1833,1837,1846,1843,1850,1877,1902,1915,1930,1960,1988,2017,2037,
-    2046,2056,2073,2078,2053,2027,2003,1981,1965,1927,1876,1844,1837,1814,1762,1738,
-    1744,1741,1713,1686,1678,1683,1675,1648,1632,1631,1622,1610,1609,1603,1602,1617,
-    1628,1627,1649,1678,1690,1713,1745,1769,1784,1801,1820,1832,1837,1847,1852,1857,
-    1858,1852,1852,1865,1865,1843,1841,1842,1810,1788,1779,1756,1729,1716,1701,1676,
-    1668,1674,1668,1664,1674,1682,1689,1701,1702,1698,1710,1716,1709,1708,1716,1711,
-    1706,1708,1704,1696,1695,1697,1700,1712,1725,1722,1717,1727,1744,1748,1755,1767,
-    1762,1767,1787,1806,1819,1838,1865,1894,1917,1958,2015,2043,2060,2098,2135,2140,
-    2126,2125,2130,2113,2077,2037,2004,1981,1942,1884,1843,1828,1806,1764,1729,1715,
-    1710,1695,1658,1632,1630,1624,1608,1592,1596,1613,1621,1616,1612,1622,1643,1652,
-    1652,1665,1681,1700,1711,1730,1754,1776,1802,1818,1837,1857,1871,1870,1881,1895,
-    1901,1906,1896,1891,1884,1874,1857,1833,1819,1810,1784,1763,1755,1743,1724,1711,
-    1707,1702,1692,1680,1684,1690,1688,1680,1674,1680,1690,1688,1686,1699,1703,1699,
-    1700,1699,1701,1706,1704,1707,1714,1722,1711,1706,1718,1721,1712,1708,1718,1737,
-    1750,1756,1766,1777,1803,1826,1842,1871,1915,1954,1982,2006,2043,2085,2105,2105,
-    2109,2118,2106,2082,2056,2032,1992,1947,1909,1874,1842,1809,1780,1748,1731,1716,
-    1684,1661,1649,1634,1622,1618,1614,1609,1618,1622,1618,1628,1643,1653,1656,1670,
-    1681,1690,1709,1725,1734,1741,1752,1764,1778,1791,1800,1808,1821,1829,1832,1839,
-    1848,1853,1855,1863,1871,1865,1857,1855,1858,1854,1833,1817,1813,1800,1783,1765,
-    1750,1743,1734,1721,1712,1711,1713,1709,1704,1706,1707,1700,1697,1705,1708,1710,
-    1708,1704,1704,1702,1695,1691,1686,1681,1674,1663,1659,1662,1664,1668,1669,1671,
-    1686,1695,1696,1705,1724,1743,1781,1829,1859,1903,1975,2022,2049,2090,2141,2175,
-    2182,2178,2176,2175,2161,2127,2078,2048,2019,1975,1924,1885,1852,1820,1789,1740,
-    1708,1696,1676,1643,1619,1620,1614,1598,1581,1581,1591,1593,1597,1601,1612,1627,
-    1639,1655,1680,1694,1706,1730,1751,1758,1772,1786,1789,1794,1800,1806,1814,1825,
-    1835,1843,1844,1858,1877,1893,1897,1902,1904,1911,1920,1911,1898,1899,1900,1881,
-    1864,1853,1846,1836,1819,1803,1798,1791,1776,1772,1778,1756,1705,1670,1675,1701,
-    1725,1693,1602,1556,1626,1707,1663,1551,1512,1556,1587,1580,1558,1551,1546,1531,
-    1532,1559,1590,1592,1580,1597,1636,1666,1701,1772,1872,2006,2148,2204,2175,2194,
-    2355,2529,2512,2337,2227,2241,2238,2140,2019,1975,1936,1802,1640,1576,1606,1636,
-    1612,1567,1524,1507,1547,1618,1679,1694,1699,1717,1719,1694,1709,1783,1830,1791,
-    1716,1692,1708,1731,1755,1761,1733,1692,1678,1694,1718,1737,1757,1763,1736,1695,
-    1694,1744,1801,1815,1804,1802,1824,1865,1883,1909,1977,2049,2039,1959,1922,1970,
-    2022,2006,1947,1883,1839,1827,1820,1800,1778,1773,1768,1715,1652,1647,1688,1700,
-    1655,1600,1566,1566,1585,1607,1617,1622,1622,1608,1589,1592,1629,1639,1610,1566,
-    1538,1520,1517,1526,1545,1551,1542,1527,1532,1605,1711,1762,1772,1883,2141,2378,
-    2416,2377,2447,2590,2660,2594,2432,2255,2148,2085,1959,1773,1660,1657,1626,1531,
-    1457,1452,1527,1655,1738,1734,1735,1805,1868,1866,1848,1868,1891,1865,1795,1700,
-    1637,1652,1697,1691,1630,1590,1615,1641,1643,1656,1705,1763,1788,1765,1721,1709,
-    1749,1789,1781,1744,1721,1716,1718,1718,1743,1800,1870,1913,1926,1944,1981,2044,
-    2077,2054,2019,2008,1978,1911,1839,1803,1794,1776,1740,1692,1665,1677,1708,1718,
-    1716,1718,1717,1700,1653,1612,1608,1646,1672,1645,1593,1575,1579,1589,1585,1574,
-    1563,1540,1512,1480,1470,1468,1478,1496,1506,1488,1486,1541,1628,1721,1800,1862,
-    1962,2178,2434,2549,2537,2548,2581,2566,2497,2356,2161,2023,1939,1788,1593,1502,
-    1522,1549,1556,1560,1544,1580,1722,1849,1895,1923,1986,2010,1972,1901,1827,1790,
-    1801,1791,1690,1589,1550,1558,1563,1554,1564,1610,1668,1715,1710,1695,1724,1783,
-    1810,1786,1760,1758,1769,1756,1712,1674,1685,1732,1757,1753,1768,1839,1932,1978,
-    1995,2042,2101,2140,2146,2078,1989,1938,1922,1880,1800,1741,1705,1678,1662,1662,
-    1668,1706,1760,1785,1778,1767,1763,1743,1705,1664,1633,1622,1622,1588,1549,1533,
-    1531,1525,1543,1560,1547,1551,1574,1574,1539,1515,1512,1530,1566,1601,1614,1628,
-    1680,1742,1780,1803,1841,1970,2227,2449,2499,2489,2527,2540,2486,2380,2188,1985,
-    1914,1880,1725,1561,1523,1531,1534,1561,1552,1544,1657,1837,1920,1934,1989,2026,
-    2002,1951,1868,1792,1798,1826,1768,1639,1554,1525,1500,1482,1484,1513,1594,1692,
-    1736,1731,1730,1763,1789,1798,1810,1820,1835,1852,1825,1752,1695,1687,1707,1737,
-    1783,1829,1872,1927,1979,1993,1994,2027,2066,2080,2082,2047,1974,1901,1848,1776,
-    1706,1662,1647,1639,1646,1669,1672,1699,1753,1770,1752,1730,1706,1675,1641,1612,
-    1574,1547,1541,1536,1519,1513,1528,1549,1575,1612,1644,1666,1678,1671,1655,1669,
-    1692,1691,1677,1675,1674,1679,1688,1685,1691,1707,1749,1791,1873,2070,2295,2426,
-    2506,2579,2609,2572,2487,2318,2068,1885,1797,1685,1572,1540,1548,1564,1597,1587,
-    1511,1519,1672,1815,1887,1959,2047,2097,2085,2006,1859,1720,1674,1641,1561,1488,
-    1472,1487,1494,1485,1457,1463,1536,1638,1695,1735,1808,1903,1971,1992,1972,1931,
-    1898,1881,1831,1770,1759,1786,1817,1823,1814,1787,1777,1798,1822,1859,1922,2011,
-    2094,2151,2149,2088,2002,1901,1795,1709,1649,1615,1620,1654,1673,1671,1665,1660,
-    1661,1665,1685,1698,1711,1720,1715,1697,1665,1628,1594,1571,1564,1582,1614,1646,
-    1671,1678,1671,1661,1662,1659,1651,1655,1681,1709,1723,1722,1698,1680,1670,1652,
-    1618,1606,1632,1676,1717,1758,1856,2061,2288,2426,2511,2595,2648,2627,2542,2377,
-    2141,1970,1859,1711,1566,1520,1517,1508,1520,1519,1495,1515,1614,1682,1726,1807,
-    1905,1969,1999,1995,1944,1885,1835,1737,1596,1488,1435,1416,1420,1449,1502,1585,
-    1677,1739,1755,1782,1822,1864,1903,1941,1985,2030,2059,2051,2001,1938,1884,1830,
-    1778,1729,1699,1693,1698,1720,1742,1790,1875,1932,1966,2000,2007,1987,1956,1900,
-    1827,1765,1735,1701,1668,1664,1652,1639,1648,1659,1665,1676,1695,1704,1704,1705,
-    1689,1664,1642,1620,1604,1612,1627,1650,1676,1702,1715,1703,1693,1678,1660,1668,
-    1683,1697,1722,1745,1766,1779,1771,1733,1682,1646,1632,1616,1626,1652,1684,1729,
-    1774,1807,1845,1939,2084,2216,2323,2452,2562,2640,2662,2588,2423,2229,2047,1844,
-    1632,1469,1374,1345,1374,1400,1417,1456,1526,1588,1614,1634,1677,1743,1822,1886,
-    1927,1974,2016,2020,1964,1866,1754,1657,1575,1511,1478,1483,1537,1599,1660,1709,
-    1758,1813,1864,1893,1905,1921,1939,1955,1963,1962,1968,1994,2001,1979,1921,1846,
-    1765,1676,1595,1538,1539,1599,1669,1759,1861,1931,1977,1996,1967,1916,1876,1839,
-    1787,1743,1740,1731,1730,1740,1730,1714,1706,1681,1640,1598,1590,1580,1578,1600,
-    1604,1617,1649,1679,1691,1705,1715,1715,1715,1733,1732,1735,1756,1773,1781,1781,
-    1784,1761,1738,1726,1702,1678,1677,1681,1687,1697,1696,1696,1692,1706,1730,1738,
-    1751,1804,1904,2049,2199,2340,2490,2641,2747,2759,2669,2501,2286,2048,1796,1540,
-    1344,1225,1171,1158,1181,1243,1337,1444,1558,1645,1716,1791,1841,1869,1886,1918,
-    1961,2000,2027,2033,2005,1957,1881,1774,1662,1564,1501,1477,1482,1523,1592,1685,
-    1778,1859,1931,1977,1997,1991,1978,1955,1934,1925,1930,1934,1927,1914,1887,1833,
-    1781,1727,1664,1650,1654,1651,1678,1724,1769,1824,1867,1889,1897,1893,1871,1813,
-    1762,1733,1690,1670,1680,1691,1710,1739,1739,1704,1664,1620,1551,1491,1474,1468,
-    1487,1533,1583,1637,1704,1761,1791,1808,1817,1809,1795,1791,1797,1804,1821,1824,
-    1807,1789,1768,1745,1709,1679,1655,1630,1615,1613,1611,1642,1684,1716,1752,1787,
-    1824,1862,1937,2047,2154,2255,2373,2476,2561,2616,2605,2521,2374,2187,1961,1717,
-    1492,1299,1161,1105,1113,1172,1274,1413,1549,1664,1755,1816,1845,1871,1890,1896,
-    1919,1947,1973,1999,2021,2028,2009,1970,1906,1805,1695,1593,1511,1460,1438,1460,
-    1525,1628,1737,1833,1917,1983,2020,2024,2002,1966,1924,1890,1871,1857,1860,1870,
-    1866,1862,1858,1822,1772,1735,1692,1650,1636,1628,1634,1656,1699,1738,1771,1814,
-    1836,1849,1858,1855,1832,1808,1781,1739,1690,1647,1600,1548,1510,1480,1459,1457,
-    1482,1518,1576,1650,1722,1787,1841,1880,1894,1897,1884,1849,1813,1794,1771,1751,
-    1740,1735,1732,1724,1713,1705,1688,1672,1664,1660,1677,1703,1746,1797,1850,1899,
-    1941,1993,2069,2151,2231,2318,2384,2445,2507,2514,2449,2346,2203,2001,1782,1581,
-    1390,1231,1158,1141,1161,1237,1343,1452,1569,1703,1794,1845,1907,1957,1966,1978,
-    1999,2004,2012,2029,2022,1986,1941,1881,1789,1688,1605,1526,1480,1482,1509,1553,
-    1626,1730,1823,1895,1955,1984,1989,1989,1982,1954,1939,1950,1951,1933,1924,1910,
-    1879,1850,1796,1720,1646,1600,1553,1504,1494,1525,1576,1641,1717,1780,1840,1901,
-    1927,1914,1895,1878,1839,1797,1754,1696,1632,1582,1538,1480,1451,1448,1468,1505,
-    1556,1613,1676,1748,1806,1835,1850,1863,1855,1832,1799,1767,1741,1724,1707,1686,
-    1676,1674,1672,1663,1661,1666,1687,1714,1737,1764,1790,1825,1849,1877,1928,2016,
-    2132,2243,2358,2458,2538,2576,2567,2475,2321,2137,1929,1714,1509,1354,1239,1203,
-    1228,1275,1334,1413,1506,1578,1636,1684,1731,1788,1864,1934,1990,2048,2095,2123,
-    2109,2055,1963,1848,1737,1632,1544,1490,1489,1527,1587,1654,1717,1767,1805,1830,
-    1835,1829,1831,1863,1907,1965,2039,2092,2126,2147,2133,2065,1969,1857,1729,1607,
-    1507,1445,1418,1435,1483,1547,1614,1683,1743,1787,1830,1869,1897,1909,1924,1918,
-    1899,1870,1826,1763,1688,1618,1543,1477,1434,1423,1437,1471,1523,1589,1652,1717,
-    1772,1802,1814,1828,1827,1820,1817,1814,1813,1809,1803,1791,1774,1756,1744,1720,
-    1703,1674,1667,1661,1673,1695,1719,1753,1788,1845,1924,2049,2179,2324,2442,2539,
-    2612,2648,2616,2489,2322,2116,1897,1691,1527,1384,1288,1266,1280,1304,1331,1365,
-    1401,1450,1527,1600,1676,1783,1913,2032,2116,2167,2174,2141,2066,1965,1846,1725,
-    1625,1570,1545,1535,1549,1576,1616,1649,1661,1665,1665,1678,1720,1783,1871,1963,
-    2058,2144,2208,2228,2203,2130,2028,1904,1769,1655,1563,1504,1470,1465,1476,1497,
-    1526,1564,1608,1658,1717,1782,1844,1891,1927,1944,1933,1891,1838,1783,1722,1671,
-    1631,1597,1577,1564,1553,1544,1540,1547,1552,1565,1578,1607,1643,1691,1739,1772,
-    1793,1793,1791,1789,1784,1785,1790,1801,1817,1818,1823,1822,1800,1753,1714,1679,
-    1674,1686,1733,1823,1970,2150,2331,2482,2556,2586,2583,2539,2411,2247,2089,1953,
-    1829,1739,1665,1587,1508,1446,1397,1338,1290,1267,1305,1398,1519,1646,1779,1894,
-    1979,2034,2043,1996,1918,1850,1807,1783,1763,1748,1745,1743,1722,1685,1629,1567,
-    1513,1514,1569,1636,1718,1819,1924,2009,2062,2087,2102,2103,2090,2061,2033,1996,
-    1944,1874,1795,1698,1599,1515,1454,1424,1418,1445,1501,1574,1639,1703,1740,1765,
-    1788,1806,1823,1829,1844,1857,1865,1856,1826,1781,1722,1654,1594,1557,1541,1532,
-    1535,1545,1559,1580,1594,1610,1617,1639,1676,1727,1773,1820,1849,1876,1895,1899,
-    1891,1867,1851,1833,1828,1811,1815,1814,1839,1886,1958,2049,2151,2253,2309,2336,
-    2341,2335,2279,2194,2080,1982,1916,1877,1839,1795,1743,1677,1605,1531,1467,1412,
-    1390,1406,1484,1581,1666,1725,1769,1804,1828,1842,1850,1857,1866,1880,1892,1893,
-    1868,1825,1760,1693,1643,1618,1609,1612,1634,1682,1739,1783,1819,1858,1893,1918,
-    1931,1943,1958,1957,1949,1923,1896,1868,1839,1798,1751,1709,1676,1640,1604,1576,
-    1561,1559,1560,1570,1595,1638,1669,1691,1714,1752,1778,1809,1831,1851,1856,1855,
-    1838,1799,1759,1708,1662,1616,1591,1570,1578,1600,1599,1615,1630,1660,1691,1740,
-    1773,1812,1829,1849,1888,1894,1917,1891,1915,1907,1916,1903,1901,1895,1894,1918,
-    1930,1983,2017,2079,2077,2082,2045,2015,1971,1939,1907,1874,1873,1870,1876,1853,
-    1846,1815,1809,1793,1791,1786,1792,1796,1790,1778,1741,1695,1648,1621,1601,1611,
-    1614,1623,1625,1631,1632,1628,1641,1667,1708,1750,1788,1814,1830,1826,1806,1786,
-    1786,1796,1820,1848,1874,1890,1883,1866,1839,1818,1808,1811,1819,1834,1848,1864,
-    1868,1849,1821,1795,1775,1757,1748,1741,1743,1738,1720,1698,1675,1651,1635,1634,
-    1649,1670,1696,1712,1720,1724,1724,1724,1729,1749,1771,1788,1801,1812,1804,1792,
-    1775,1755,1746,1753,1762,1775,1785,1786,1787,1780,1775,1769,1771,1775,1786,1791,
-    1803,1810,1809,1801,1794,1789,1781,1772,1771,1774,1777,1785,1789,1795,1794,1796,
-    1795,1805,1819,1841,1864,1882,1905,1930,1952,1969,1978,1980,1985,1975,1966,1957,
-    1946,1925,1889,1855,1819,1781,1746,1721,1702,1692,1679,1661,1650,1645,1647,1647,
-    1650,1654,1664,1679,1696,1710,1733,1759,1782,1800,1806,1807,1801,1800,1803,1813,
-    1827,1838,1842,1845,1841,1833,1821,1807,1803,1811,1828,1837,1844,1839,1828,1813,
-    1797,1780,1765,1758,1751,1744,1739,1729,1713,1697,1688,1676,1665,1663,1670,1680,
-    1698,1723,1742,1760,1768,1781,1792,1808,1818,1826,1834,1841,1836,1811,1786,1768,
-    1760,1756,1770,1782,1795,1798,1786,1766,1745,1730,1726,1730,1744,1767,1789,1798,
-    1796,1788,1775,1777,1784,1803,1823,1833,1835,1823,1806,1787,1773,1758,1749,1750,
-    1753,1757,1772,1792,1819,1841,1862,1879,1888,1891,1885,1881,1878,1876,1876,1874,
-    1870,1860,1840,1821,1802,1781,1763,1753,1750,1757,1763,1772,1784,1787,1785,1779,
-    1776,1779,1781,1780,1779,1779,1781,1779,1776,1774,1777,1774,1772,1773,1773,1771,
-    1774,1782,1786,1789,1781,1782,1788,1794,1796,1797,1797,1794,1786,1766,1753,1750,
-    1753,1760,1772,1783,1790,1788,1774,1756,1747,1743,1750,1761,1768,1773,1774,1771,
-    1769,1765,1766,1772,1780,1783,1782,1782,1778,1768,1763,1753,1745,1744,1749,1753,
-    1760,1769,1773,1780,1775,1782,1767,1790,1857,1907,1858,1757,1689,1686,1728,1767,
-    1781,1753,1725,1723,1762,1824,1878,1863,1806,1734,1718,1746,1805,1842,1855,1838,
-    1795,1762,1735,1762,1799,1840,1863,1859,1833,1813,1822,1845,1864,1873,1864,1852,
-    1838,1819,1812,1810,1810,1797,1791,1778,1771,1758,1752,1749,1744,1752,1763,1783,
-    1787,1777,1769,1761,1761,1749,1747,1763,1786,1781,1758,1759,1775,1784,1805,1817,
-    1796,1799,1806,1815,1812,1832,1848,1855,1832,1805,1805,1807,1803,1769,1758,1753,
-    1769,1759,1741,1752,1730,1748,1725,1744,1762,1747,1708,1712,1757,1766,1755,1701,
-    1734,1765,1803,1762,1699,1733,1745,1744,1757,1801,1769,1717,1721,1777,1837,1831,
-    1784,1716,1769,1784,1790,1785,1765,1729,1701,1715,1705,1711,1686,1676,1664,1671,
-    1703,1699,1668,1662,1679,1704,1716,1759,1828,1921,2019,2088,2103,2108,2149,2190,
-    2200,2179,2147,2096,2035,1980,1946,1910,1864,1778,1682,1623,1598,1593,1588,1597,
-    1596,1583,1584,1599,1633,1665,1720,1781,1816,1831,1810,1789,1786,1812,1851,1889,
-    1900,1874,1834,1808,1806,1820,1829,1829,1822,1806,1782,1759,1754,1772,1804,1833,
-    1839,1823,1799,1769,1779,1800,1836,1833,1792,1746,1700,1682,1707,1746,1756,1728,
-    1674,1662,1676,1693,1718,1752,1774,1745,1759,1793,1822,1818,1788,1796,1779,1764,
-    1719,1703,1700,1698,1697,1693,1671,1655,1637,1642,1623,1590,1577,1555,1565,1564,
-    1569,1559,1558,1545,1542,1615,1861,2182,2310,2213,2148,2270,2445,2574,2635,2543,
-    2281,2042,1999,2090,2104,1957,1746,1573,1465,1405,1398,1434,1432,1399,1424,1503,
-    1537,1509,1532,1656,1822,1937,1997,1992,1924,1877,1937,2070,2153,2116,2006,1894,
-    1810,1777,1786,1797,1758,1678,1621,1607,1587,1564,1569,1616,1682,1748,1801,1818,
-    1786,1764,1815,1902,1952,1932,1864,1784,1728,1723,1756,1770,1719,1646,1593,1578,
-    1588,1613,1641,1661,1678,1703,1730,1746,1759,1774,1807,1836,1830,1808,1781,1761,
-    1763,1776,1748,1678,1592,1542,1535,1538,1529,1471,1429,1413,1447,1488,1526,1566,
-    1670,1939,2273,2444,2390,2353,2453,2605,2736,2813,2713,2416,2131,2055,2098,2084,
-    1949,1734,1503,1319,1245,1264,1309,1310,1307,1341,1392,1417,1452,1553,1701,1844,
-    1966,2051,2050,2003,1995,2077,2169,2197,2154,2053,1924,1816,1784,1815,1814,1747,
-    1650,1561,1500,1477,1513,1576,1623,1648,1676,1701,1714,1728,1774,1845,1893,1893,
-    1855,1789,1720,1687,1718,1761,1761,1716,1646,1595,1584,1622,1693,1743,1744,1732,
-    1732,1749,1773,1814,1847,1854,1841,1823,1799,1760,1724,1702,1695,1672,1637,1565,
-    1469,1389,1371,1408,1453,1457,1432,1422,1442,1527,1700,1979,2277,2440,2425,2397,
-    2483,2631,2753,2801,2700,2442,2176,2065,2074,2058,1940,1739,1522,1344,1260,1257,
-    1292,1297,1293,1329,1385,1418,1457,1557,1694,1850,1983,2032,1992,1952,1971,2058,
-    2177,2238,2174,2040,1904,1832,1831,1846,1830,1753,1647,1559,1533,1552,1576,1603,
-    1630,1660,1685,1698,1713,1734,1771,1821,1870,1877,1825,1729,1662,1662,1693,1724,
-    1720,1662,1586,1555,1584,1652,1713,1743,1738,1727,1739,1796,1865,1906,1918,1907,
-    1882,1851,1824,1796,1769,1726,1675,1630,1589,1539,1494,1461,1425,1399,1423,1474,
-    1503,1498,1514,1599,1798,2102,2366,2416,2334,2329,2441,2592,2685,2647,2441,2178,
-    2022,2034,2081,2018,1838,1617,1440,1357,1370,1418,1416,1369,1350,1410,1494,1542,
-    1580,1655,1779,1907,2002,2017,1971,1924,1962,2089,2190,2176,2056,1913,1828,1823,
-    1859,1875,1804,1682,1578,1546,1588,1642,1675,1667,1638,1629,1646,1680,1711,1731,
-    1758,1779,1778,1737,1683,1645,1643,1670,1703,1703,1661,1600,1571,1604,1682,1751,
-    1770,1755,1738,1762,1809,1869,1906,1889,1850,1823,1824,1821,1806,1781,1745,1706,
-    1649,1618,1599,1567,1531,1512,1509,1503,1510,1528,1544,1588,1683,1813,1988,2192,
-    2289,2219,2176,2289,2462,2530,2465,2304,2114,1977,1970,2054,2068,1925,1703,1548,
-    1501,1518,1543,1567,1560,1522,1504,1526,1575,1622,1671,1760,1880,1941,1898,1827,
-    1820,1892,2004,2089,2085,1974,1832,1779,1848,1942,1947,1859,1739,1644,1621,1665,
-    1729,1744,1703,1650,1640,1660,1668,1667,1682,1725,1756,1748,1709,1647,1603,1605,
-    1652,1700,1684,1622,1577,1613,1689,1756,1785,1784,1751,1745,1789,1846,1891,1894,
-    1874,1839,1830,1830,1808,1775,1776,1783,1766,1741,1708,1671,1659,1683,1693,1653,
-    1589,1573,1589,1615,1625,1636,1668,1714,1821,1974,2112,2101,2040,2085,2246,2415,
-    2463,2353,2139,1993,2007,2131,2217,2119,1841,1580,1503,1610,1724,1713,1598,1480,
-    1436,1482,1589,1677,1710,1713,1756,1817,1841,1800,1764,1830,1966,2051,2014,1884,
-    1759,1741,1832,1949,1960,1839,1661,1551,1583,1705,1789,1758,1651,1587,1589,1652,
-    1703,1714,1700,1693,1713,1724,1708,1654,1611,1648,1737,1759,1717,1648,1643,1702,
-    1792,1826,1803,1765,1719,1761,1836,1904,1876,1806,1805,1804,1820,1832,1829,1812,
-    1798,1793,1803,1817,1841,1813,1762,1758,1780,1766,1722,1735,1753,1757,1730,1699,
-    1655,1662,1711,1759,1769,1731,1692,1686,1729,1807,1887,1916,1882,1830,1849,1962,
-    2082,2095,1995,1875,1856,1947,2030,2023,1940,1855,1836,1829,1829,1824,1820,1822,
-    1815,1808,1772,1744,1727,1745,1800,1829,1815,1752,1697,1708,1782,1848,1832,1755,
-    1688,1672,1731,1794,1806,1769,1715,1657,1665,1709,1702,1732,1729,1727,1726,1717,
-    1702,1712,1747,1741,1767,1765,1743,1720,1744,1795,1822,1839,1821,1789,1791,1802,
-    1824,1846,1831,1794,1768,1759,1749,1779,1796,1816,1817,1794,1776,1781,1810,1842,
-    1861,1841,1804,1775,1785,1800,1825,1827,1796,1738,1701,1697,1722,1748,1753,1743,
-    1731,1722,1730,1754,1759,1763,1752,1754,1768,1793,1803,1803,1802,1789,1791,1808,
-    1816,1820,1826,1820,1801,1798,1811,1827,1847,1835,1837,1859,1858,1843,1839,1840,
-    1834,1845,1850,1842,1838,1829,1824,1830,1833,1811,1785,1771,1771,1783,1788,1772,
-    1751,1728,1723,1726,1736,1747,1747,1739,1710,1691,1701,1722,1749,1762,1748,1722,
-    1711,1728,1759,1782,1788,1785,1780,1781,1797,1823,1843,1858,1848,1837,1818,1802,
-    1806,1825,1849,1860,1849,1821,1807,1808,1817,1823,1827,1808,1786,1761,1757,1776,
-    1789,1790,1770,1745,1728,1728,1744,1762,1772,1771,1757,1739,1735,1753,1778,1798,
-    1810,1801,1780,1776,1780,1794,1807,1810,1798,1778,1768,1771,1786,1800,1790,1766,
-    1761,1762,1769,1772,1776,1780,1784,1783,1785,1781,1772,1776,1782,1801,1810,1798,
-    1783,1779,1785,1790,1794,1796,1786,1790,1791,1790,1790,1783,1788,1797,1808,1809,
-    1816,1812,1804,1805,1806,1810,1809,1810,1797,1782,1771,1754,1758,1765,1764,1757,
-    1751,1749,1750,1754,1766,1772,1762,1757,1764,1771,1772,1779,1788,1798,1802,1804,
-    1815,1826,1830,1821,1816,1818,1824,1820,1816,1819,1812,1812,1809,1802,1797,1799,
-    1802,1803,1811,1813,1807,1791,1778,1778,1788,1792,1786,1778,1760,1751,1754,1762,
-    1771,1766,1760,1758,1756,1762,1774,1786,1790,1783,1779,1773,1773,1783,1795,1799,
-    1800,1795,1786,1781,1786,1795,1807,1811,1800,1785,1777,1774,1780,1795,1797,1791,
-    1778,1767,1765,1771,1772,1774,1782,1790,1790,1786,1782,1785,1790,1801,1805,1806,
-    1802,1796,1798,1804,1807,1803,1791,1779,1775,1768,1788,1797,1788,1774,1762,1762,
-    1771,1780,1787,1788,1784,1782,1779,1779,1780,1784,1781,1775,1775,1780,1775,1774,
-    1773,1782,1797,1804,1796,1789,1788,1785,1792,1803,1809,1814,1816,1814,1812,1821,
-    1827,1829,1833,1829,1826,1811,1794,1792,1796,1799,1792,1779,1766,1756,1754,1761,
-    1773,1773,1763,1750,1747,1755,1768,1770,1765,1763,1761,1763,1765,1780,1784,1785,
-    1791,1796,1801,1799,1799,1807,1815,1817,1816,1807,1800,1799,1799,1796,1789,1783,
-    1776,1775,1771,1769,1769,1775,1781,1787,1784,1775,1768,1764,1770,1779,1786,1780,
-    1772,1767,1761,1764,1781,1792,1792,1784,1778,1775,1777,1782,1791,1793,1784,1773,
-    1769,1769,1771,1777,1782,1785,1786,1778,1769,1774,1783,1798,1801,1798,1790,1781,
-    1775,1783,1795,1805,1804,1800,1802,1808,1812,1811,1819,1829,1832,1825,1812,1807,
-    1805,1805,1812,1810,1800,1786,1778,1777,1783,1791,1792,1786,1772,1764,1764,1766,
-    1776,1780,1778,1774,1775,1778,1784,1781,1783,1785,1785,1781,1783,1789,1795,1797,
-    1805,1805,1829,1948,1855,1663,1722,2002,2045,1642,1445,1774,2024,1776,1510,1681,
-    1925,1801,1606,1722,1923,1843,1656,1688,1833,1884,1874,1924,1895,1755,1804,1965,
-    1884,1652,1708,1861,1793,1635,1660,1838,1854,1720,1621,1651,1734,1711,1671,1715,
-    1777,1797,1800,1757,1751,1838,1862,1816,1772,1777,1761,1787,1830,1766,1729,1815,
-    1814,1717,1686,1774,1804,1764,1764,1769,1747,1748,1806,1812,1788,1777,1799,1776,
-    1763,1794,1833,1819,1829,1826,1762,1762,1841,1836,1773,1818,1804,1782,1765,1792,
-    1783,1766,1814,1784,1755,1746,1759,1821,1834,1796,1761,1779,1821,1800,1769,1781,
-    1904,1879,1711,1698,1874,1872,1681,1691,1778,1677,1611,1734,1798,1710,1681,1802,
-    1811,1732,1728,1834,1845,1739,1736,1778,1759,1755,1810,1782,1707,1726,1808,1757,
-    1694,1752,1788,1783,1768,1784,1773,1827,1886,1887,1858,1872,1907,1915,1924,1903,
-    1899,1913,1896,1857,1835,1825,1832,1830,1795,1753,1741,1735,1760,1745,1739,1733,
-    1729,1725,1729,1719,1720,1751,1768,1776,1706,1732,1791,1786,1734,1765,1808,1726,
-    1715,1759,1767,1706,1710,1749,1703,1683,1690,1736,1715,1673,1690,1703,1668,1614,
-    1627,1647,1631,1636,1712,1761,1794,1881,1947,1947,2002,2085,2101,2081,2047,2033,
-    2050,2036,1954,1893,1883,1864,1807,1733,1688,1696,1706,1671,1650,1665,1687,1686,
-    1678,1707,1734,1763,1818,1825,1786,1779,1811,1855,1877,1886,1886,1888,1874,1861,
-    1861,1854,1847,1820,1777,1744,1755,1763,1752,1756,1771,1761,1733,1740,1761,1761,
-    1781,1791,1776,1716,1681,1704,1701,1659,1617,1645,1629,1577,1562,1563,1582,1583,
-    1571,1549,1512,1495,1485,1479,1487,1519,1680,1941,2054,1991,2007,2226,2417,2409,
-    2313,2251,2210,2155,2088,1990,1898,1872,1869,1741,1544,1480,1545,1580,1544,1551,
-    1601,1631,1653,1681,1729,1803,1908,1978,1958,1918,1908,1930,1967,1989,1972,1943,
-    1911,1867,1834,1797,1782,1797,1795,1744,1679,1674,1707,1731,1753,1787,1814,1821,
-    1818,1810,1815,1842,1860,1835,1787,1745,1705,1672,1650,1645,1638,1595,1552,1549,
-    1566,1567,1578,1606,1619,1607,1608,1627,1621,1617,1636,1626,1564,1512,1445,1424,
-    1640,2020,2134,1979,2015,2260,2396,2405,2375,2271,2186,2174,2089,1879,1787,1901,
-    1949,1805,1653,1570,1540,1598,1686,1704,1690,1737,1794,1772,1717,1795,1954,2024,
-    2002,1935,1851,1824,1873,1905,1887,1850,1830,1800,1727,1672,1686,1734,1790,1803,
-    1743,1699,1713,1748,1778,1814,1845,1848,1848,1860,1846,1824,1833,1865,1854,1794,
-    1721,1665,1625,1605,1613,1609,1598,1596,1585,1558,1559,1583,1627,1657,1670,1663,
-    1644,1628,1629,1606,1572,1579,1595,1608,1653,1805,2010,2123,2142,2186,2233,2247,
-    2258,2227,2129,2050,2011,1936,1826,1744,1741,1757,1738,1698,1628,1611,1667,1727,
-    1755,1765,1783,1805,1824,1830,1853,1887,1939,1965,1921,1851,1830,1859,1866,1846,
-    1821,1814,1793,1757,1718,1685,1698,1747,1782,1768,1736,1736,1756,1785,1807,1811,
-    1804,1799,1792,1756,1721,1726,1750,1746,1691,1623,1581,1594,1628,1628,1621,1632,
-    1650,1652,1653,1665,1703,1755,1793,1788,1780,1783,1776,1768,1760,1745,1727,1724,
-    1704,1659,1647,1684,1729,1753,1787,1860,1917,1939,1954,1978,1976,1958,1937,1906,
-    1870,1867,1886,1876,1857,1869,1896,1905,1915,1918,1895,1862,1869,1877,1859,1838,
-    1829,1808,1801,1805,1784,1763,1772,1783,1773,1785,1800,1811,1808,1804,1795,1767,
-    1751,1760,1772,1770,1748,1733,1742,1756,1758,1752,1771,1777,1763,1761,1766,1761,
-    1764,1784,1779,1749,1740,1734,1741,1749,1754,1773,1762,1767,1767,1779,1793,1801,
-    1809,1798,1771,1740,1738,1744,1741,1746,1762,1750,1725,1706,1703,1708,1728,1744,
-    1724,1692,1683,1683,1684,1685,1686,1688,1699,1713,1733,1759,1807,1860,1883,1907,
-    1935,1951,1937,1945,1954,1939,1924,1907,1902,1891,1876,1869,1850,1838,1832,1816,
-    1801,1806,1815,1807,1795,1785,1782,1765,1739,1733,1744,1758,1756,1762,1772,1775,
-    1769,1758,1770,1784,1775,1754,1763,1763,1761,1765,1778,1790,1809,1817,1806,1796,
-    1788,1795,1821,1825,1817,1796,1791,1808,1791,1778,1770,1767,1752,1761,1745,1737,
-    1742,1752,1742,1709,1693,1707,1729,1744,1730,1731,1734,1709,1707,1700,1716,1710,
-    1737,1735,1727,1741,1749,1766,1781,1804,1809,1822,1828,1832,1838,1833,1835,1834,
-    1840,1822,1802,1813,1815,1824,1816,1796,1800,1811,1815,1819,1808,1808,1808,1805,
-    1788,1764,1755,1741,1749,1747,1744,1749,1761,1773,1763,1767,1766,1769,1778,1802,
-    1807,1802,1815,1817,1812,1830,1839,1837,1836,1843,1845,1851,1855,1837,1825,1808,
-    1803,1788,1791,1777,1774,1765,1765,1755,1745,1751,1750,1771,1758,1758,1775,1780,
-    1745,1755,1755,1746,1742,1732,1746,1724,1731,1757,1755,1724,1717,1744,1758,1756,
-    1763,1792,1808,1794,1809,1810,1793,1805,1809,1807,1800,1783,1788,1795,1793,1784,
-    1800,1813,1798,1792,1793,1805,1785,1796,1786,1788,1786,1757,1758,1767,1762,1768,
-    1771,1787,1783,1769,1783,1767,1795,1810,1794,1799,1816,1812,1812,1788,1789,1801,
-    1825,1817,1785,1803,1810,1821,1813,1803,1792,1781,1771,1762,1765,1760,1761,1758,
-    1760,1770,1780,1781,1776,1785,1792,1809,1802,1794,1798,1797,1809,1809,1800,1798,
-    1780,1783,1774,1763,1775,1774,1780,1779,1759,1750,1764,1779,1785,1772,1770,1772,
-    1771,1763,1761,1771,1773,1782,1778,1778,1786,1790,1799,1790,1791,1790,1793,1794,
-    1798,1800,1806,1806,1806,1804,1793,1799,1813,1824,1813,1811,1815,1815,1793,1797,
-    1809,1808,1796,1780,1778,1774,1784,1792,1787,1778,1777,1773,1791,1801,1798,1797,
-    1799,1800,1785,1773,1768,1777,1782,1779,1764,1760,1769,1773,1774,1779,1796,1809,
-    1818,1808,1801,1794,1794,1797,1797,1797,1785,1774,1778,1783,1785,1799,1796,1794,
-    1787,1783,1784,1784,1789,1782,1784,1768,1748,1739,1737,1738,1739,1739,1739,1741,
-    1736,1746,1754,1748,1749,1765,1773,1776,1783,1788,1798,1799,1799,1797,1801,1801,
-    1800,1796,1789,1797,1801,1798,1785,1790,1798,1794,1792,1783,1783,1787,1784,1793,
-    1795,1797,1802,1795,1797,1794,1789,1788,1789,1795,1792,1791,1793,1789,1788,1780,
-    1775,1775,1784,1797,1794,1803,1808,1813,1822,1816,1810,1818,1822,1819,1806,1796,
-    1789,1778,1776,1780,1779,1780,1785,1787,1786,1784,1780,1778,1780,1771,1777,1784,
-    1781,1780,1770,1771,1769,1769,1774,1771,1774,1772,1770,1775,1782,1791,1794,1797,
-    1788,1785,1795,1794,1793,1795,1801,1795,1785,1780,1779,1779,1779,1787,1786,1773,
-    1771,1770,1766,1769,1775,1783,1783,1780,1774,1771,1775,1789,1794,1787,1785,1788,
-    1791,1781,1784,1794,1790,1784,1780,1782,1785,1795,1798,1801,1808,1806,1801,1804,
-    1807,1811,1815,1810,1811,1803,1799,1801,1798,1786,1780,1782,1782,1783,1785,1786,
-    1788,1795,1800,1799,1801,1812,1808,1798,1794,1792,1796,1794,1790,1778,1775,1784,
-    1779,1769,1762,1765,1772,1777,1774,1772,1773,1783,1781,1780,1780,1782,1783,1777,
-    1773,1773,1778,1776,1776,1775,1781,1787,1786,1781,1775,1776,1782,1786,1790,1789,
-    1788,1788,1795,1798,1801,1795,1791,1796,1792,1789,1786,1791,1790,1788,1784,1787,
-    1784,1805,1817,1798,1797,1795,1799,1794,1789,1789,1783,1784,1786,1794,1798,1798,
-    1793,1785,1782,1779,1780,1780,1772,1780,1795,1805,1802,1797,1796,1791,1792,1788,
-    1786,1788,1791,1788,1784,1778,1772,1772,1774,1773,1775,1782,1785,1783,1789,1798,
-    1793,1795,1799,1791,1786,1785,1787,1788,1787,1790,1790,1786,1786,1789,1792,1798,
-    1797,1798,1794,1784,1785,1784,1781,1779,1781,1786,1789,1785,1781,1781,1777,1783,
-    1790,1785,1779,1778,1773,1771,1774,1772,1778,1785,1788,1788,1789,1792,1789,1799,
-    1804,1802,1799,1800,1812,1809,1803,1800,1796,1792,1790,1787,1785,1785,1781,1776,
-    1777,1776,1775,1773,1774,1780,1786,1787,1791,1797,1801,1800,1790,1788,1786,1786,
-    1782,1788,1790,1783,1777,1774,1772,1776,1784,1780,1784,1783,1780,1776,1767,1770,
-    1773,1777,1770,1767,1772,1765,1772,1768,1764,1770,1775,1779,1779,1783,1786,1784,
-    1780,1780,1777,1783,1783,1786,1789,1787,1783,1788,1786,1785,1786,1786,1794,1792,
-    1801,1797,1795,1792,1796,1799,1796,1806,1811,1814,1811,1806,1809,1805,1804,1804,
-    1801,1802,1797,1802,1795,1789,1784,1788,1785,1774,1786,1777,1782,1785,1782,1784,
-    1782,1782,1775,1775,1768,1772,1765,1763,1757,1756,1749,1746,1752,1764,1762,1760,
-    1772,1777,1780,1781,1785,1777,1783,1779,1785,1775,1785,1779,1790,1778,1793,1784,
-    1797,1778,1803,1779,1844,1916,1735,1736,1765,1828,1762,1717,1732,1732,1748,1758,
-    1772,1762,1791,1780,1777,1781,1789,1772,1789,1805,1821,1824,1808,1799,1803,1805,
-    1795,1795,1789,1798,1795,1796,1784,1793,1788,1800,1788,1811,1867,1813,1782,1788,
-    1809,1806,1808,1746,1729,1753,1757,1745,1734,1763,1768,1778,1783,1799,1783,1797,
-    1801,1805,1823,1818,1812,1804,1818,1806,1799,1796,1783,1782,1790,1773,1782,1774,
-    1778,1787,1783,1782,1805,1846,1811,1806,1806,1823,1791,1777,1776,1756,1768,1762,
-    1772,1769,1785,1789,1785,1797,1791,1782,1794,1793,1790,1788,1771,1765,1751,1729,
-    1726,1720,1721,1734,1735,1753,1754,1768,1783,1789,1793,1792,1805,1808,1802,1802,
-    1807,1813,1806,1794,1788,1799,1806,1801,1795,1795,1812,1831,1825,1828,1831,1825,
-    1848,1850,1853,1834,1845,1842,1825,1808,1796,1777,1776,1798,1769,1750,1761,1783,
-    1773,1766,1768,1772,1772,1774,1770,1768,1762,1762,1768,1776,1778,1770,1769,1781,
-    1789,1777,1790,1802,1795,1799,1798,1790,1781,1775,1772,1769,1763,1766,1769,1779,
-    1780,1782,1811,1816,1803,1799,1805,1788,1787,1799,1800,1788,1774,1771,1781,1774,
-    1775,1807,1807,1794,1775,1767,1769,1764,1762,1747,1749,1759,1754,1766,1762,1782,
-    1801,1793,1803,1798,1791,1789,1794,1793,1759,1739,1741,1756,1771,1760,1764,1782,
-    1807,1821,1816,1807,1811,1803,1794,1785,1770,1772,1773,1771,1773,1781,1785,1787,
-    1792,1796,1810,1824,1811,1803,1815,1814,1815,1805,1784,1776,1781,1791,1789,1797,
-    1808,1823,1825,1822,1811,1803,1798,1786,1774,1768,1783,1784,1767,1772,1783,1780,
-    1769,1760,1754,1764,1782,1782,1784,1798,1810,1806,1802,1801,1781,1753,1735,1721,
-    1718,1725,1750,1751,1753,1767,1775,1791,1795,1787,1777,1768,1751,1749,1741,1738,
-    1740,1737,1732,1731,1725,1725,1730,1731,1750,1762,1767,1779,1784,1793,1803,1820,
-    1829,1847,1867,1890,1922,1942,1974,1994,2005,1996,1972,1952,1917,1873,1828,1791,
-    1772,1752,1742,1751,1763,1773,1795,1801,1800,1797,1784,1769,1750,1743,1734,1718,
-    1712,1707,1707,1708,1717,1722,1724,1736,1739,1735,1725,1720,1727,1724,1713,1704,
-    1701,1703,1703,1699,1696,1699,1706,1711,1709,1705,1690,1680,1655,1638,1627,1613,
-    1595,1576,1560,1550,1545,1541,1566,1653,1789,1933,2078,2198,2324,2460,2540,2521,
-    2443,2329,2190,2015,1801,1600,1480,1433,1408,1429,1502,1632,1786,1916,2003,2081,
-    2135,2126,2062,1956,1837,1729,1618,1514,1450,1438,1463,1520,1601,1696,1809,1908,
-    1976,2015,2031,2006,1952,1885,1799,1729,1675,1633,1620,1640,1681,1729,1781,1842,
-    1893,1921,1920,1900,1871,1835,1795,1748,1713,1695,1683,1679,1697,1732,1762,1778,
-    1790,1789,1786,1774,1739,1704,1668,1642,1622,1611,1614,1625,1640,1656,1675,1703,
-    1725,1726,1719,1692,1649,1596,1519,1444,1374,1312,1276,1277,1335,1470,1667,1908,
-    2163,2410,2627,2803,2897,2875,2753,2562,2324,2032,1733,1482,1310,1227,1220,1283,
-    1424,1643,1876,2069,2232,2345,2384,2330,2190,2008,1817,1618,1424,1284,1214,1206,
-    1251,1347,1491,1679,1867,2014,2115,2179,2185,2122,2008,1868,1737,1619,1522,1464,
-    1455,1493,1559,1630,1717,1802,1871,1920,1944,1949,1934,1901,1857,1822,1795,1784,
-    1785,1790,1805,1821,1828,1831,1825,1814,1799,1776,1756,1746,1729,1714,1716,1720,
-    1725,1728,1737,1742,1743,1741,1739,1736,1723,1704,1680,1655,1625,1594,1560,1527,
-    1495,1455,1414,1375,1343,1321,1325,1372,1470,1626,1839,2074,2291,2493,2703,2873,
-    2921,2824,2654,2450,2172,1841,1514,1263,1124,1088,1108,1224,1454,1734,2007,2247,
-    2452,2577,2589,2487,2291,2045,1770,1476,1223,1061,981,978,1069,1250,1497,1767,
-    2018,2234,2405,2497,2483,2369,2199,1996,1760,1524,1338,1224,1186,1220,1312,1457,
-    1636,1813,1965,2083,2151,2160,2127,2050,1947,1825,1721,1644,1596,1581,1601,1656,
-    1726,1795,1856,1903,1931,1934,1910,1874,1838,1797,1753,1723,1700,1702,1703,1712,
-    1732,1761,1798,1825,1831,1832,1812,1784,1738,1682,1629,1577,1530,1489,1462,1443,
-    1437,1430,1433,1420,1400,1396,1446,1554,1725,1916,2109,2284,2465,2647,2756,2715,
-    2580,2441,2230,1944,1639,1397,1231,1179,1189,1256,1444,1719,1982,2204,2404,2549,
-    2573,2473,2277,2032,1771,1512,1270,1101,1041,1070,1175,1368,1630,1901,2165,2377,
-    2502,2527,2463,2294,2058,1796,1525,1275,1108,1029,1026,1106,1269,1473,1695,1912,
-    2078,2191,2230,2191,2090,1963,1820,1678,1567,1514,1519,1573,1653,1765,1887,1990,
-    2058,2084,2069,2023,1943,1833,1730,1654,1611,1586,1598,1635,1711,1793,1867,1935,
-    1977,1984,1956,1898,1806,1704,1604,1515,1444,1397,1377,1393,1433,1485,1547,1614,
-    1663,1670,1637,1557,1470,1407,1402,1466,1602,1798,2024,2253,2499,2746,2880,2837,
-    2720,2571,2307,1950,1609,1343,1175,1124,1150,1265,1507,1815,2078,2310,2510,2597,
-    2531,2360,2123,1849,1575,1322,1133,1060,1094,1186,1353,1603,1880,2117,2303,2421,
-    2442,2361,2188,1944,1693,1468,1272,1138,1106,1165,1275,1443,1647,1838,1988,2086,
-    2114,2088,2004,1868,1733,1628,1564,1542,1584,1681,1808,1939,2058,2134,2167,2142,
-    2069,1955,1825,1700,1586,1517,1506,1548,1622,1729,1850,1968,2059,2106,2109,2063,
-    1964,1843,1703,1569,1450,1368,1329,1336,1379,1454,1543,1633,1711,1758,1774,1747,
-    1670,1554,1415,1279,1182,1157,1254,1469,1763,2079,2369,2656,2937,3089,3025,2807,
-    2560,2242,1840,1434,1141,1005,1014,1126,1311,1606,1967,2265,2462,2600,2634,2504,
-    2238,1922,1605,1328,1105,982,989,1124,1321,1549,1824,2097,2294,2403,2441,2381,
-    2230,2014,1772,1543,1370,1252,1201,1237,1339,1465,1598,1738,1854,1920,1929,1899,
-    1846,1778,1712,1666,1669,1719,1782,1864,1966,2050,2083,2070,2017,1941,1841,1727,
-    1630,1571,1558,1577,1632,1734,1858,1966,2044,2085,2086,2038,1947,1827,1713,1609,
-    1526,1474,1459,1482,1532,1596,1670,1735,1772,1782,1763,1715,1636,1549,1460,1393,
-    1328,1282,1247,1230,1259,1340,1493,1732,2042,2323,2508,2674,2867,2966,2830,2560,
-    2320,2061,1730,1409,1201,1134,1221,1390,1568,1813,2118,2341,2444,2504,2473,2275,
-    1987,1706,1461,1264,1137,1098,1185,1381,1592,1793,2013,2216,2326,2320,2258,2154,
-    1981,1776,1572,1411,1332,1303,1312,1384,1517,1641,1729,1809,1865,1867,1831,1785,
-    1736,1702,1689,1700,1741,1817,1891,1954,2001,2028,2014,1972,1909,1833,1760,1703,
-    1673,1676,1707,1740,1793,1862,1922,1945,1939,1912,1880,1828,1764,1701,1672,1659,
-    1657,1669,1680,1694,1695,1689,1661,1627,1591,1560,1523,1492,1466,1467,1469,1475,
-    1475,1466,1430,1376,1341,1359,1471,1690,1998,2298,2506,2692,2935,3067,2910,2575,
-    2275,1952,1573,1226,1030,1008,1200,1491,1768,2078,2416,2617,2627,2556,2370,2032,
-    1626,1302,1089,1001,1028,1177,1445,1777,2058,2232,2334,2368,2289,2098,1878,1688,
-    1527,1411,1369,1398,1499,1629,1728,1784,1827,1810,1710,1599,1527,1474,1456,1505,
-    1608,1744,1897,2024,2100,2147,2145,2069,1956,1853,1756,1681,1656,1679,1741,1830,
-    1908,1963,2001,1999,1946,1885,1826,1765,1723,1709,1735,1787,1841,1878,1902,1903,
-    1872,1796,1696,1595,1519,1474,1451,1454,1504,1572,1627,1664,1678,1675,1634,1572,
-    1477,1380,1287,1209,1175,1211,1339,1601,1996,2408,2711,2874,2991,3073,2991,2608,
-    2114,1738,1457,1198,1050,1090,1309,1701,2095,2338,2474,2559,2490,2264,1984,1688,
-    1383,1179,1153,1253,1426,1642,1868,2057,2169,2158,2033,1873,1750,1645,1571,1562,
-    1634,1749,1857,1934,1944,1886,1776,1620,1435,1291,1232,1243,1342,1533,1739,1938,
-    2102,2176,2146,2060,1919,1746,1627,1578,1593,1679,1838,1997,2114,2185,2172,2074,
-    1927,1749,1566,1440,1408,1470,1611,1807,2005,2161,2258,2258,2157,1976,1754,1537,
-    1377,1289,1277,1346,1479,1641,1787,1865,1882,1853,1757,1609,1467,1376,1322,1316,
-    1356,1434,1503,1538,1517,1480,1448,1435,1518,1790,2164,2486,2729,2935,3104,3174,
-    2979,2466,1927,1555,1255,984,914,1076,1435,1921,2329,2512,2584,2599,2409,2065,
-    1733,1424,1169,1117,1242,1419,1653,1892,2030,2088,2086,1966,1772,1653,1614,1617,
-    1674,1791,1911,1992,2022,1958,1792,1592,1400,1226,1144,1194,1335,1537,1788,2028,
-    2172,2208,2152,2004,1809,1643,1536,1519,1620,1797,1989,2174,2299,2294,2187,2018,
-    1791,1559,1405,1349,1378,1520,1751,1982,2175,2291,2291,2204,2056,1843,1610,1437,
-    1355,1339,1393,1497,1615,1733,1816,1816,1756,1683,1596,1497,1413,1387,1406,1437,
-    1465,1497,1517,1490,1400,1296,1256,1288,1434,1776,2250,2661,2937,3112,3177,3103,
-    2854,2342,1707,1275,1088,991,1039,1333,1710,2088,2471,2633,2489,2283,2072,1760,
-    1504,1416,1332,1300,1515,1810,1943,1992,2003,1868,1696,1616,1537,1449,1561,1808,
-    1979,2122,2245,2174,1939,1728,1504,1222,1047,1048,1133,1335,1657,1921,2069,2192,
-    2209,2049,1851,1686,1505,1399,1478,1651,1844,2089,2311,2397,2390,2309,2093,1803,
-    1589,1444,1359,1409,1569,1729,1904,2103,2228,2234,2177,2072,1899,1743,1633,1522,
-    1449,1475,1524,1547,1591,1651,1656,1645,1654,1629,1586,1571,1544,1491,1485,1508,
-    1476,1433,1434,1420,1356,1300,1285,1309,1442,1748,2172,2555,2833,3019,3089,3047,
-    2899,2561,2002,1490,1240,1123,1082,1234,1538,1829,2138,2417,2447,2283,2141,1983,
-    1754,1628,1597,1504,1479,1667,1841,1863,1848,1799,1649,1557,1595,1614,1631,1808,
-    2022,2108,2163,2178,2015,1749,1551,1382,1217,1166,1234,1335,1518,1772,1949,2014,
-    2029,1975,1840,1718,1634,1564,1559,1675,1847,2020,2191,2297,2288,2210,2094,1917,
-    1704,1545,1463,1449,1530,1664,1788,1917,2060,2150,2150,2099,2007,1880,1754,1649,
-    1550,1483,1478,1484,1482,1515,1564,1586,1603,1624,1624,1625,1631,1610,1573,1562,
-    1555,1507,1443,1398,1343,1284,1262,1276,1350,1581,1985,2388,2689,2906,3023,3018,
-    2947,2752,2337,1837,1482,1276,1161,1215,1387,1550,1762,2046,2196,2176,2136,2065,
-    1917,1818,1791,1705,1625,1687,1781,1812,1842,1839,1713,1588,1577,1570,1566,1665,
-    1799,1868,1955,2052,2027,1906,1809,1681,1514,1422,1401,1376,1407,1525,1629,1704,
-    1796,1851,1815,1777,1760,1727,1714,1773,1853,1929,2043,2159,2192,2167,2114,2002,
-    1849,1724,1630,1560,1546,1595,1663,1742,1869,1985,2038,2039,2018,1964,1889,1813,
-    1724,1643,1602,1586,1567,1553,1553,1560,1564,1564,1563,1573,1594,1601,1589,1584,
-    1591,1592,1567,1537,1509,1473,1441,1432,1449,1519,1698,1964,2210,2386,2522,2603,
-    2648,2668,2589,2366,2100,1886,1727,1632,1611,1614,1630,1699,1783,1816,1825,1842,
-    1815,1773,1765,1757,1724,1745,1817,1873,1922,1955,1918,1828,1765,1713,1646,1616,
-    1639,1654,1673,1727,1761,1758,1773,1770,1717,1668,1645,1618,1598,1619,1640,1650,
-    1681,1713,1707,1706,1727,1730,1733,1768,1827,1888,1972,2055,2100,2110,2100,2057,
-    1969,1876,1783,1700,1659,1660,1678,1727,1794,1864,1920,1945,1933,1894,1845,1788,
-    1726,1682,1663,1649,1650,1661,1662,1658,1651,1620,1566,1522,1508,1503,1503,1520,
-    1557,1598,1647,1674,1675,1664,1628,1572,1519,1512,1558,1690,1883,2055,2171,2266,
-    2343,2398,2429,2392,2263,2116,2007,1934,1898,1915,1932,1922,1933,1928,1871,1828,
-    1814,1762,1702,1674,1656,1656,1716,1794,1847,1895,1919,1869,1785,1731,1673,1602,
-    1583,1599,1602,1626,1676,1698,1709,1737,1736,1696,1673,1660,1627,1615,1642,1661,
-    1672,1706,1730,1728,1746,1781,1782,1778,1813,1851,1882,1944,2011,2035,2035,2024,
-    1977,1918,1867,1808,1751,1733,1754,1769,1803,1869,1924,1948,1943,1905,1836,1774,
-    1706,1634,1593,1595,1618,1640,1673,1691,1692,1679,1637,1574,1524,1497,1479,1480,
-    1513,1570,1617,1653,1668,1659,1631,1590,1548,1517,1524,1620,1791,1960,2065,2134,
-    2214,2275,2311,2301,2239,2151,2082,2043,2027,2049,2085,2092,2073,2038,1966,1878,
-    1816,1758,1684,1632,1614,1606,1638,1725,1809,1865,1901,1883,1797,1720,1662,1605,
-    1578,1598,1614,1626,1675,1727,1740,1749,1753,1723,1685,1667,1648,1624,1637,1671,
-    1694,1724,1763,1775,1772,1785,1786,1772,1782,1813,1834,1875,1947,2001,2018,2017,
-    1995,1945,1889,1848,1800,1768,1775,1797,1813,1854,1909,1927,1917,1887,1822,1745,
-    1685,1636,1598,1588,1613,1638,1655,1681,1696,1681,1650,1606,1558,1525,1518,1518,
-    1526,1556,1590,1614,1623,1615,1579,1531,1493,1469,1471,1537,1686,1901,2100,2238,
-    2318,2351,2366,2366,2314,2204,2087,1996,1937,1930,1976,2016,2016,2004,1962,1879,
-    1806,1758,1713,1669,1641,1633,1645,1701,1783,1843,1875,1879,1829,1740,1667,1623,
-    1597,1602,1635,1654,1678,1733,1771,1779,1785,1778,1745,1704,1686,1660,1630,1647,
-    1668,1684,1704,1726,1738,1745,1763,1773,1769,1790,1825,1868,1931,1988,2011,1999,
-    1977,1938,1892,1856,1831,1805,1800,1815,1825,1833,1853,1868,1854,1827,1794,1754,
-    1717,1698,1685,1684,1696,1709,1713,1714,1714,1697,1659,1613,1567,1537,1527,1527,
-    1534,1534,1546,1554,1542,1516,1491,1462,1436,1444,1490,1591,1760,1986,2207,2383,
-    2492,2531,2518,2479,2400,2265,2108,1979,1878,1823,1839,1888,1909,1903,1874,1802,
-    1734,1704,1685,1665,1677,1705,1728,1785,1870,1922,1928,1907,1831,1714,1630,1585,
-    1569,1598,1660,1718,1768,1819,1833,1814,1783,1746,1685,1630,1608,1596,1605,1637,
-    1672,1692,1710,1714,1694,1678,1686,1697,1717,1760,1817,1883,1951,2006,2031,2022,
-    1991,1938,1877,1830,1802,1782,1774,1782,1790,1796,1798,1798,1801,1790,1767,1748,
-    1740,1735,1733,1729,1724,1727,1724,1710,1692,1682,1668,1641,1600,1563,1521,1480,
-    1454,1434,1413,1412,1425,1427,1434,1453,1481,1527,1634,1809,2051,2316,2535,2669,
-    2714,2682,2586,2441,2253,2038,1835,1688,1627,1661,1744,1815,1865,1870,1825,1775,
-    1744,1733,1740,1777,1821,1854,1887,1907,1887,1834,1762,1664,1567,1518,1514,1549,
-    1639,1755,1844,1901,1924,1892,1832,1787,1737,1693,1677,1678,1677,1672,1669,1630,
-    1593,1578,1573,1589,1637,1706,1773,1845,1924,1976,1998,2008,1999,1981,1976,1964,
-    1930,1893,1846,1788,1742,1717,1709,1720,1753,1796,1834,1876,1906,1893,1851,1800,
-    1736,1676,1647,1643,1658,1700,1735,1738,1718,1674,1614,1553,1503,1456,1421,1408,
-    1409,1408,1402,1394,1385,1384,1399,1444,1533,1696,1962,2295,2598,2796,2866,2807,
-    2667,2491,2279,2018,1776,1617,1530,1550,1660,1765,1815,1839,1834,1793,1791,1837,
-    1875,1920,1993,2024,1981,1911,1795,1639,1525,1478,1457,1484,1576,1664,1746,1839,
-    1890,1893,1889,1869,1825,1800,1812,1808,1786,1756,1682,1583,1506,1439,1396,1412,
-    1484,1582,1713,1844,1917,1934,1920,1900,1907,1954,1993,2006,2006,2000,1975,1932,
-    1858,1747,1631,1556,1548,1608,1717,1823,1899,1937,1951,1936,1897,1843,1778,1715,
-    1674,1664,1660,1654,1654,1647,1638,1623,1600,1577,1555,1538,1519,1493,1468,1435,
-    1398,1365,1347,1364,1394,1435,1498,1608,1795,2073,2400,2670,2817,2850,2779,2629,
-    2447,2225,1948,1691,1547,1496,1545,1680,1785,1822,1852,1886,1885,1913,1965,1971,
-    1980,2017,2011,1931,1814,1663,1497,1412,1422,1466,1553,1664,1749,1820,1907,1957,
-    1940,1914,1882,1842,1834,1841,1802,1733,1661,1565,1473,1432,1418,1414,1468,1573,
-    1696,1825,1938,1975,1950,1915,1882,1882,1930,2001,2027,2033,2021,1968,1895,1810,
-    1707,1616,1588,1612,1675,1765,1853,1901,1934,1954,1939,1904,1862,1807,1756,1740,
-    1726,1693,1654,1608,1566,1549,1557,1561,1565,1569,1567,1553,1522,1479,1417,1363,
-    1321,1298,1304,1346,1412,1508,1656,1870,2167,2494,2736,2842,2848,2760,2604,2411,
-    2152,1833,1587,1480,1463,1539,1658,1735,1774,1846,1919,1946,1987,2030,2026,2040,
-    2091,2052,1917,1755,1565,1399,1354,1385,1421,1515,1655,1775,1896,2018,2042,1996,
-    1955,1902,1844,1817,1783,1702,1624,1573,1504,1440,1412,1381,1378,1457,1580,1705,
-    1821,1906,1940,1949,1945,1908,1874,1890,1945,2002,2044,2045,1993,1915,1841,1752,
-    1657,1604,1606,1651,1741,1848,1916,1954,1975,1965,1939,1896,1829,1756,1719,1710,
-    1683,1643,1587,1522,1488,1501,1527,1546,1564,1570,1558,1544,1529,1489,1439,1387,
-    1346,1326,1338,1373,1431,1546,1746,2053,2398,2661,2800,2851,2811,2681,2498,2223,
-    1862,1588,1481,1468,1528,1642,1710,1746,1840,1917,1919,1927,1950,1956,2020,2127,
-    2127,2005,1870,1711,1553,1478,1433,1384,1422,1557,1699,1853,1995,2038,2012,1993,
-    1947,1850,1773,1707,1638,1617,1632,1616,1570,1532,1476,1441,1461,1498,1544,1639,
-    1761,1873,1959,2007,1995,1947,1920,1900,1886,1907,1946,1970,1990,1994,1949,1879,
-    1826,1758,1702,1695,1717,1744,1789,1863,1917,1951,1961,1922,1855,1807,1773,1734,
-    1702,1657,1592,1536,1512,1499,1490,1493,1499,1507,1536,1566,1576,1580,1577,1566,
-    1553,1532,1487,1428,1381,1366,1390,1478,1664,1929,2206,2442,2614,2721,2745,2703,
-    2573,2334,2078,1907,1789,1711,1698,1701,1710,1763,1811,1777,1715,1695,1693,1725,
-    1799,1844,1857,1901,1957,1973,1969,1916,1804,1713,1688,1667,1645,1652,1656,1659,
-    1697,1725,1699,1658,1632,1608,1607,1628,1636,1638,1661,1697,1718,1727,1714,1680,
-    1665,1677,1686,1686,1710,1747,1792,1854,1912,1953,1970,1982,1994,1994,1971,1941,
-    1909,1882,1873,1853,1819,1788,1776,1788,1815,1848,1864,1878,1910,1934,1923,1882,
-    1827,1763,1706,1663,1619,1581,1565,1562,1559,1557,1554,1533,1526,1544,1582,1625,
-    1672,1720,1757,1782,1780,1733,1673,1625,1583,1555,1549,1564,1584,1615,1668,1769,
-    1868,1913,1923,1954,2025,2095,2124,2112,2117,2169,2233,2252,2237,2206,2183,2174,
-    2132,2037,1947,1907,1899,1912,1914,1886,1842,1833,1829,1800,1756,1687,1619,1583,
-    1562,1507,1450,1409,1393,1422,1477,1521,1563,1621,1676,1709,1716,1699,1674,1672,
-    1692,1720,1758,1811,1860,1895,1917,1913,1895,1885,1883,1880,1880,1899,1919,1938,
-    1953,1951,1927,1891,1862,1843,1836,1845,1852,1858,1874,1892,1888,1876,1864,1848,
-    1844,1838,1812,1774,1745,1713,1670,1619,1565,1529,1523,1535,1556,1581,1608,1637,
-    1657,1662,1649,1624,1605,1597,1601,1605,1613,1619,1615,1616,1610,1609,1613,1626,
-    1664,1719,1764,1811,1895,1970,1978,1954,1947,1971,2013,2028,2003,2016,2083,2137,
-    2148,2141,2144,2171,2219,2214,2145,2083,2045,1987,1914,1834,1743,1688,1688,1692,
-    1673,1660,1642,1598,1557,1510,1443,1410,1431,1469,1511,1571,1619,1656,1687,1692,
-    1674,1663,1677,1690,1712,1743,1761,1783,1820,1847,1859,1882,1908,1923,1939,1942,
-    1922,1895,1880,1859,1847,1855,1874,1903,1943,1978,1989,1978,1955,1925,1893,1850,
-    1807,1780,1779,1790,1787,1773,1752,1732,1715,1702,1685,1676,1684,1697,1706,1710,
-    1711,1705,1689,1676,1662,1653,1640,1622,1605,1587,1581,1579,1586,1600,1623,1658,
-    1702,1736,1748,1735,1715,1693,1671,1653,1649,1650,1678,1770,1873,1904,1897,1928,
-    1992,2044,2032,1986,1996,2085,2164,2175,2158,2185,2229,2246,2173,2045,1971,1945,
-    1898,1825,1760,1723,1731,1749,1737,1731,1748,1757,1736,1693,1636,1576,1539,1511,
-    1478,1465,1489,1522,1556,1591,1604,1622,1659,1686,1696,1716,1740,1762,1786,1806,
-    1807,1811,1834,1852,1872,1894,1907,1919,1935,1944,1940,1941,1947,1940,1940,1938,
-    1923,1914,1919,1906,1886,1869,1847,1832,1822,1804,1778,1766,1755,1743,1732,1728,
-    1725,1723,1725,1717,1697,1669,1648,1629,1612,1607,1599,1598,1611,1626,1642,1658,
-    1662,1656,1652,1651,1652,1662,1668,1675,1684,1691,1692,1694,1693,1688,1677,1661,
-    1656,1667,1694,1738,1826,1910,1938,1949,2001,2057,2073,2036,1989,1996,2036,2031,
-    2000,2007,2056,2094,2085,2043,2022,2039,2024,1952,1882,1851,1826,1787,1730,1688,
-    1686,1702,1690,1653,1632,1629,1612,1584,1544,1515,1525,1542,1545,1550,1574,1605,
-    1642,1677,1698,1723,1762,1786,1801,1815,1826,1847,1871,1895,1910,1916,1921,1909,
-    1892,1879,1873,1877,1894,1912,1918,1926,1938,1939,1920,1883,1842,1820,1811,1796,
-    1777,1779,1792,1795,1784,1766,1745,1735,1726,1708,1690,1695,1705,1707,1704,1700,
-    1698,1691,1680,1658,1648,1646,1644,1641,1646,1657,1675,1699,1720,1726,1724,1720,
-    1719,1716,1700,1689,1682,1689,1694,1689,1681,1681,1694,1711,1724,1771,1851,1890,
-    1884,1907,1966,2011,2009,1969,1972,2026,2062,2033,2011,2046,2091,2089,2058,2038,
-    2048,2054,2001,1929,1894,1878,1835,1772,1719,1689,1676,1655,1619,1612,1627,1628,
-    1619,1617,1620,1630,1636,1622,1610,1616,1614,1607,1618,1643,1671,1696,1712,1731,
-    1761,1803,1835,1868,1908,1934,1952,1957,1949,1933,1916,1892,1871,1861,1857,1853,
-    1860,1877,1890,1888,1875,1862,1842,1828,1812,1800,1796,1797,1791,1782,1769,1749,
-    1724,1700,1677,1662,1656,1651,1658,1669,1676,1683,1690,1700,1705,1698,1687,1676,
-    1663,1649,1644,1642,1650,1668,1686,1701,1711,1716,1720,1722,1716,1703,1692,1682,
-    1673,1671,1671,1669,1678,1711,1738,1775,1860,1946,1963,1964,2019,2080,2088,2051,
-    2021,2033,2063,2044,1989,1986,2027,2043,2025,2010,2019,2034,2014,1965,1938,1919,
-    1873,1809,1758,1718,1678,1640,1606,1593,1591,1579,1574,1591,1610,1613,1610,1616,
-    1637,1647,1646,1638,1644,1665,1666,1663,1671,1690,1714,1740,1769,1807,1856,1894,
-    1922,1953,1968,1963,1948,1928,1908,1890,1871,1857,1845,1839,1835,1831,1831,1830,
-    1822,1818,1819,1814,1810,1806,1802,1800,1792,1777,1766,1753,1737,1718,1697,1677,
-    1670,1666,1674,1685,1696,1701,1695,1694,1697,1690,1679,1673,1665,1655,1654,1656,
-    1667,1683,1688,1697,1710,1727,1732,1730,1728,1733,1735,1724,1704,1696,1701,1706,
-    1706,1702,1719,1752,1805,1886,1951,1963,1984,2058,2126,2126,2092,2084,2104,2099,
-    2041,1976,1969,1992,1965,1903,1886,1910,1911,1873,1842,1842,1847,1818,1759,1722,
-    1713,1692,1657,1634,1630,1627,1610,1597,1600,1610,1611,1618,1640,1675,1691,1697,
-    1708,1724,1732,1723,1716,1727,1747,1766,1777,1798,1832,1850,1865,1871,1883,1886,
-    1886,1880,1885,1883,1870,1855,1857,1856,1855,1845,1858,1852,1809,1838,1866,1874,
-    1849,1832,1817,1817,1815,1794,1769,1749,1749,1747,1745,1733,1735,1744,1755,1736,
-    1708,1685,1675,1667,1658,1651,1653,1660,1653,1659,1676,1679,1680,1691,1707,1708,
-    1712,1721,1740,1760,1756,1759,1764,1767,1754,1746,1735,1734,1721,1716,1701,1691,
-    1692,1697,1708,1709,1736,1781,1825,1897,1996,2038,2035,2066,2140,2160,2125,2083,
-    2074,2052,2029,1942,1876,1883,1887,1850,1796,1799,1809,1811,1778,1764,1751,1747,
-    1718,1682,1672,1668,1653,1631,1631,1627,1632,1642,1657,1669,1685,1703,1721,1747,
-    1774,1791,1819,1859,1884,1885,1883,1886,1878,1854,1828,1805,1790,1786,1771,1768,
-    1783,1788,1784,1786,1788,1791,1795,1797,1799,1808,1810,1801,1793,1799,1808,1820,
-    1826,1819,1819,1819,1816,1806,1789,1770,1750,1732,1713,1698,1697,1699,1693,1692,
-    1707,1716,1725,1737,1746,1752,1754,1746,1730,1718,1704,1690,1682,1678,1673,1677,
-    1685,1698,1705,1716,1737,1760,1779,1801,1819,1828,1833,1832,1815,1794,1779,1767,
-    1753,1726,1702,1689,1688,1681,1680,1710,1755,1797,1836,1891,1953,2023,2103,2159,
-    2188,2208,2237,2247,2210,2135,2045,1966,1859,1733,1617,1538,1502,1479,1465,1477,
-    1533,1613,1692,1766,1845,1923,1965,1973,1959,1916,1859,1794,1722,1651,1596,1553,
-    1536,1547,1578,1626,1694,1775,1860,1940,1987,2025,2043,2026,1979,1918,1852,1775,
-    1707,1647,1606,1596,1604,1626,1673,1727,1768,1804,1835,1857,1865,1858,1852,1845,
-    1841,1822,1806,1823,1859,1871,1863,1857,1864,1867,1841,1787,1752,1734,1704,1665,
-    1638,1652,1686,1716,1719,1740,1766,1784,1782,1779,1767,1740,1710,1670,1638,1608,
-    1592,1580,1595,1614,1647,1682,1729,1780,1823,1857,1879,1898,1901,1888,1856,1820,
-    1780,1742,1699,1664,1643,1637,1645,1663,1687,1716,1745,1765,1784,1795,1809,1826,
-    1847,1869,1898,1955,2037,2108,2150,2173,2198,2223,2204,2117,1998,1895,1798,1677,
-    1556,1475,1457,1489,1544,1603,1695,1822,1936,2004,2052,2069,2045,1995,1908,1788,
-    1676,1594,1512,1458,1455,1495,1562,1667,1781,1881,1979,2061,2099,2095,2062,1993,
-    1907,1822,1722,1622,1557,1527,1508,1525,1579,1643,1709,1774,1832,1863,1883,1880,
-    1854,1835,1816,1787,1766,1763,1782,1800,1812,1820,1831,1855,1865,1858,1846,1832,
-    1808,1786,1771,1747,1728,1712,1707,1707,1717,1720,1728,1753,1779,1788,1769,1755,
-    1726,1695,1645,1599,1568,1554,1554,1565,1610,1670,1743,1806,1867,1907,1932,1935,
-    1921,1888,1843,1797,1744,1704,1679,1671,1672,1686,1709,1737,1771,1796,1805,1816,
-    1818,1797,1768,1741,1721,1726,1747,1770,1801,1862,1957,2061,2142,2189,2211,2220,
-    2199,2119,1988,1843,1715,1611,1536,1484,1479,1540,1650,1761,1859,1951,2028,2072,
-    2065,2015,1926,1815,1707,1607,1517,1466,1463,1498,1560,1646,1740,1827,1900,1946,
-    1963,1955,1925,1875,1824,1784,1756,1731,1718,1715,1718,1729,1729,1724,1722,1724,
-    1729,1731,1743,1768,1795,1827,1861,1892,1920,1937,1945,1929,1900,1852,1798,1762,
-    1744,1744,1743,1739,1753,1780,1790,1778,1749,1719,1707,1697,1684,1681,1696,1733,
-    1760,1777,1780,1762,1728,1689,1646,1602,1570,1552,1561,1595,1653,1719,1783,1849,
-    1901,1920,1917,1895,1863,1825,1786,1748,1721,1715,1715,1725,1741,1754,1758,1765,
-    1764,1758,1750,1740,1720,1701,1694,1690,1704,1737,1781,1829,1895,1972,2057,2156,
-    2239,2273,2265,2218,2136,2017,1889,1746,1602,1510,1476,1487,1534,1616,1724,1845,
-    1972,2055,2071,2042,1987,1898,1786,1679,1577,1500,1473,1491,1532,1593,1664,1731,
-    1798,1855,1887,1903,1909,1914,1913,1915,1908,1888,1867,1831,1794,1750,1702,1657,
-    1619,1603,1617,1654,1709,1773,1838,1893,1940,1965,1969,1940,1893,1850,1808,1773,
-    1739,1727,1749,1785,1820,1842,1836,1825,1802,1770,1715,1661,1623,1609,1631,1687,
-    1756,1818,1857,1871,1861,1819,1755,1666,1580,1521,1498,1499,1530,1583,1653,1730,
-    1798,1847,1880,1886,1868,1849,1838,1822,1807,1791,1769,1759,1754,1743,1727,1707,
-    1695,1692,1696,1702,1713,1732,1736,1739,1753,1774,1799,1832,1863,1896,1937,2000,
-    2077,2149,2201,2214,2187,2137,2063,1967,1847,1715,1596,1525,1507,1532,1602,1696,
-    1803,1900,1969,2004,2009,1979,1920,1844,1770,1705,1656,1624,1603,1607,1614,1623,
-    1642,1678,1715,1757,1803,1852,1908,1955,1979,1982,1964,1927,1872,1799,1729,1668,
-    1632,1619,1627,1660,1707,1750,1787,1818,1837,1855,1869,1875,1874,1863,1862,1849,
-    1833,1815,1795,1780,1779,1793,1799,1805,1804,1796,1770,1738,1704,1679,1650,1655,
-    1692,1745,1798,1851,1874,1861,1831,1772,1705,1632,1580,1550,1537,1541,1576,1621,
-    1686,1744,1786,1804,1805,1812,1824,1828,1830,1825,1812,1805,1794,1790,1774,1754,
-    1736,1722,1715,1729,1740,1754,1755,1751,1744,1748,1766,1794,1819,1856,1895,1916,
-    1929,1940,1957,1985,2022,2053,2076,2079,2078,2045,1987,1904,1813,1718,1648,1610,
-    1604,1635,1693,1764,1821,1867,1888,1882,1860,1834,1803,1780,1757,1752,1741,1738,
-    1731,1713,1689,1674,1665,1672,1705,1746,1797,1843,1880,1903,1913,1908,1883,1846,
-    1807,1774,1752,1743,1738,1736,1735,1731,1740,1746,1755,1771,1792,1815,1844,1872,
-    1902,1929,1942,1930,1899,1854,1805,1750,1696,1652,1617,1603,1613,1647,1681,1727,
-    1761,1782,1787,1786,1774,1756,1739,1718,1699,1678,1657,1637,1621,1610,1614,1626,
-    1645,1671,1704,1741,1766,1781,1797,1805,1810,1808,1803,1799,1800,1801,1810,1812,
-    1802,1791,1793,1803,1810,1821,1822,1822,1809,1794,1781,1776,1782,1793,1806,1821,
-    1843,1867,1887,1919,1961,2003,2041,2062,2070,2065,2050,2008,1950,1878,1798,1731,
-    1682,1663,1667,1689,1714,1731,1740,1748,1760,1769,1781,1796,1812,1820,1825,1827,
-    1820,1802,1772,1737,1705,1689,1682,1686,1706,1734,1763,1786,1804,1822,1837,1845,
-    1842,1841,1841,1848,1857,1860,1864,1859,1848,1829,1811,1798,1791,1779,1763,1754,
-    1750,1750,1748,1749,1748,1745,1744,1738,1737,1735,1737,1742,1742,1735,1716,1693,
-    1673,1669,1663,1656,1660,1669,1688,1710,1731,1747,1749,1749,1744,1742,1748,1760,
-    1772,1778,1780,1776,1769,1766,1763,1762,1763,1763,1771,1782,1800,1822,1839,1851,
-    1854,1854,1851,1848,1840,1823,1814,1803,1785,1769,1770,1782,1794,1807,1822,1837,
-    1850,1858,1865,1875,1888,1900,1912,1930,1942,1945,1940,1929,1907,1867,1824,1782,
-    1745,1723,1712,1706,1704,1710,1723,1733,1739,1743,1755,1768,1769,1773,1782,1797,
-    1814,1824,1832,1836,1838,1828,1817,1805,1787,1768,1747,1739,1735,1735,1735,1737,
-    1740,1746,1759,1774,1790,1805,1821,1826,1824,1818,1806,1789,1771,1754,1742,1730,
-    1718,1710,1707,1709,1717,1726,1734,1741,1746,1750,1752,1765,1764,1757,1750,1740,
-    1733,1728,1728,1725,1726,1725,1732,1738,1736,1749,1765,1778,1787,1794,1804,1817,
-    1826,1824,1813,1802,1791,1782,1775,1776,1771,1771,1782,1792,1805,1815,1825,1830,
-    1828,1826,1828,1823,1818,1812,1811,1807,1805,1811,1813,1816,1822,1826,1824,1819,
-    1816,1816,1812,1806,1801,1797,1789,1780,1770,1766,1766,1770,1768,1763,1756,1753,
-    1756,1756,1759,1765,1761,1758,1761,1769,1780,1787,1788,1786,1786,1785,1791,1799,
-    1804,1807,1805,1810,1815,1817,1820,1816,1814,1808,1799,1795,1794,1790,1788,1787,
-    1785,1782,1781,1788,1791,1792,1796,1795,1796,1796,1798,1793,1783,1774,1769,1767,
-    1760,1753,1751,1751,1754,1756,1759,1766,1768,1773,1769,1768,1772,1776,1776,1771,
-    1777,1784,1780,1771,1768,1767,1766,1765,1761,1766,1771,1769,1768,1770,1780,1791,
-    1798,1803,1802,1801,1800,1796,1791,1785,1783,1776,1773,1773,1769,1767,1764,1764,
-    1767,1772,1774,1780,1788,1802,1814,1819,1824,1826,1827,1822,1820,1820,1817,1811,
-    1806,1800,1792,1792,1790,1786,1782,1781,1784,1786,1789,1788,1786,1782,1774,1765,
-    1758,1758,1761,1762,1765,1774,1780,1785,1789,1789,1796,1796,1789,1784,1781,1779,
-    1781,1781,1786,1789,1786,1785,1781,1785,1788,1791,1791,1794,1798,1798,1794,1794,
-    1791,1785,1780,1776,1777,1773,1774,1770,1774,1780,1789,1799,1805,1815,1818,1819,
-    1813,1805,1800,1799,1794,1789,1784,1778,1774,1770,1765,1766,1775,1781,1784,1784,
-    1792,1800,1804,1806,1805,1801,1793,1787,1779,1768,1765,1761,1757,1755,1753,1754,
-    1762,1769,1775,1781,1786,1789,1794,1793,1788,1788,1782,1775,1769,1768,1770,1768,
-    1766,1765,1764,1762,1770,1778,1784,1790,1795,1801,1807,1805,1803,1802,1801,1804,
-    1807,1813,1816,1816,1806,1799,1791,1788,1783,1780,1783,1789,1795,1797,1798,1790,
-    1794,1793,1795,1800,1805,1808,1804,1802,1799,1794,1790,1787,1785,1785,1787,1786,
-    1785,1787,1788,1789,1791,1795,1799,1802,1805,1803,1801,1799,1794,1787,1779,1772,
-    1764,1758,1752,1746,1741,1740,1743,1750,1754,1756,1761,1769,1778,1782,1788,1794,
-    1796,1799,1799,1796,1797,1795,1795,1795,1796,1799,1798,1796,1792,1785,1785,1780,
-    1775,1777,1778,1782,1782,1781,1778,1781,1783,1784,1783,1785,1789,1786,1785,1782,
-    1780,1781,1781,1787,1791,1801,1806,1806,1806,1801,1803,1799,1798,1795,1798,1794,
-    1787,1784,1782,1784,1775,1769,1763,1765,1768,1766,1766,1767,1777,1785,1790,1795,
-    1800,1803,1797,1801,1803,1800,1801,1792,1785,1778,1777,1774,1772,1771,1770,1772,
-    1774,1775,1774,1780,1787,1791,1793,1794,1794,1796,1794,1789,1786,1784,1782,1788,
-    1789,1789,1793,1792,1786,1786,1791,1794,1796,1800,1800,1802,1806,1808,1804,1801,
-    1798,1794,1786,1781,1775,1773,1776,1777,1784,1785,1787,1784,1782,1779,1785,1786,
-    1784,1788,1791,1787,1784,1784,1788,1796,1796,1793,1791,1793,1793,1791,1789,1790,
-    1787,1779,1776,1775,1775,1781,1781,1779,1779,1780,1783,1786,1789,1789,1790,1792,
-    1792,1792,1791,1785,1775,1769,1775,1780,1787,1791,1790,1789,1788,1788,1791,1793,
-    1793,1798,1805,1804,1799,1799,1799,1802,1805,1801,1796,1798,1797,1793,1788,1786,
-    1789,1786,1787,1786,1790,1790,1785,1787,1786,1780,1778,1782,1788,1787,1786,1785,
-    1780,1772,1765,1764,1772,1774,1774,1782,1790,1794,1798,1804,1806,1809,1808,1808,
-    1804,1797,1793,1781,1772,1770,1769,1771,1780,1791,1794,1799,1805,1804,1810,1808,
-    1802,1796,1784,1778,1773,1768,1763,1765,1764,1769,1775,1777,1778,1781,1779,1776,
-    1781,1781,1787,1783,1786,1788,1785,1787,1783,1784,1784,1790,1791,1797,1801,1798,
-    1795,1796,1793,1792,1791,1789,1786,1776,1775,1773,1774,1775,1781,1787,1790,1790,
-    1793,1794,1788,1785,1785,1779,1772,1770,1769,1776,1782,1787,1787,1791,1801,1802,
-    1799,1803,1803,1798,1791,1785,1786,1783,1781,1781,1777,1774,1776,1776,1773,1774,
-    1778,1771,1763,1769,1774,1771,1767,1769,1772,1778,1774,1771,1781,1786,1785,1788,
-    1789,1782,1783,1780,1778,1779,1777,1783,1785,1787,1788,1792,1805,1795,1783,1780,
-    1786,1791,1785,1783,1778,1769,1765,1760,1755,1758,1763,1769,1778,1787,1796,1802,
-    1805,1805,1800,1799,1803,1804,1806,1819,1821,1808,1796,1794,1781,1770,1771,1780,
-    1774,1760,1759,1761,1767,1768,1768,1769,1773,1780,1784,1783,1784,1791,1802,1803,
-    1798,1796,1798,1809,1823,1821,1810,1798,1786,1772,1765,1769,1770,1777,1784,1793,
-    1811,1816,1809,1806,1798,1792,1787,1785,1783,1781,1777,1772,1774,1785,1785,1787,
-    1793,1791,1794,1799,1803,1800,1792,1785,1783,1780,1780,1776,1776,1780,1774,1773,
-    1773,1776,1774,1775,1772,1769,1776,1780,1784,1778,1769,1764,1770,1780,1794,1808,
-    1810,1797,1781,1777,1770,1769,1778,1784,1794,1809,1808,1799,1800,1803,1804,1807,
-    1812,1821,1832,1839,1839,1823,1791,1775,1766,1753,1738,1735,1754,1773,1775,1768,
-    1757,1754,1765,1777,1788,1795,1814,1829,1826,1804,1781,1768,1763,1775,1782,1775,
-    1763,1765,1771,1757,1745,1746,1755,1771,1792,1814,1825,1810,1796,1798,1801,1800,
-    1799,1807,1816,1825,1824,1811,1794,1789,1774,1766,1777,1781,1773,1759,1755,1769,
-    1779,1774,1768,1780,1803,1828,1845,1834,1812,1799,1785,1772,1776,1772,1771,1778,
-    1784,1786,1778,1781,1787,1771,1764,1773,1776,1779,1778,1785,1797,1808,1808,1803,
-    1806,1811,1814,1816,1817,1809,1800,1797,1805,1792,1766,1749,1751,1772,1778,1770,
-    1774,1777,1773,1775,1771,1761,1740,1733,1747,1773,1795,1811,1816,1811,1813,1808,
-    1815,1833,1840,1834,1823,1809,1778,1750,1733,1734,1752,1771,1773,1770,1775,1786,
-    1781,1768,1760,1773,1794,1812,1838,1837,1814,1797,1786,1773,1752,1739,1748,1760,
-    1756,1737,1737,1742,1749,1751,1755,1770,1785,1803,1817,1830,1823,1797,1771,1771,
-    1771,1781,1797,1808,1810,1793,1785,1790,1798,1789,1787,1794,1795,1790,1788,1793,
-    1796,1793,1795,1796,1798,1806,1812,1816,1811,1796,1777,1772,1760,1745,1735,1733,
-    1742,1760,1770,1769,1767,1770,1776,1791,1806,1811,1807,1791,1781,1775,1778,1778,
-    1785,1800,1821,1832,1823,1796,1780,1772,1772,1769,1761,1753,1750,1763,1771,1774,
-    1779,1784,1792,1806,1821,1828,1829,1815,1793,1790,1790,1788,1779,1771,1761,1752,
-    1743,1735,1742,1769,1795,1814,1822,1820,1816,1814,1815,1816,1816,1810,1805,1792,
-    1779,1764,1755,1748,1745,1739,1740,1747,1762,1780,1801,1812,1814,1808,1796,1786,
-    1778,1793,1810,1819,1814,1810,1812,1811,1808,1805,1804,1797,1780,1763,1754,1755,
-    1766,1781,1790,1786,1770,1761,1756,1756,1766,1779,1793,1809,1810,1805,1806,1802,
-    1801,1790,1779,1775,1780,1788,1801,1815,1815,1794,1770,1751,1742,1746,1760,1774,
-    1789,1799,1797,1798,1801,1810,1807,1805,1810,1818,1821,1815,1803,1792,1781,1775,
-    1772,1765,1752,1741,1744,1751,1752,1750,1756,1769,1787,1797,1803,1807,1816,1817,
-    1817,1811,1804,1804,1814,1818,1816,1813,1805,1805,1803,1800,1794,1794,1791,1788,
-    1791,1802,1812,1823,1831,1827,1822,1815,1806,1804,1797,1789,1774,1757,1754,1756,
-    1760,1762,1765,1757,1742,1735,1736,1745,1757,1769,1787,1796,1800,1804,1809,1812,
-    1810,1807,1798,1793,1789,1780,1771,1771,1769,1764,1767,1768,1763,1759,1755,1748,
-    1744,1741,1735,1733,1742,1755,1759,1755,1755,1758,1750,1743,1732,1724,1717,1712,
-    1706,1701,1710,1717,1720,1726,1736,1739,1736,1727,1723,1720,1713,1704,1694,1695,
-    1733,1817,1931,2065,2173,2231,2241,2215,2175,2129,2078,2034,1986,1922,1851,1796,
-    1757,1728,1698,1662,1619,1584,1576,1601,1659,1713,1757,1781,1778,1771,1784,1819,
-    1865,1908,1921,1908,1869,1833,1814,1804,1801,1796,1785,1757,1715,1677,1657,1658,
-    1669,1684,1708,1731,1753,1771,1786,1800,1815,1823,1828,1822,1813,1799,1770,1733,
-    1694,1669,1650,1643,1640,1638,1629,1620,1615,1621,1640,1673,1707,1735,1754,1766,
-    1776,1779,1777,1766,1747,1717,1680,1644,1608,1568,1534,1505,1489,1486,1504,1554,
-    1661,1834,2042,2258,2434,2534,2555,2517,2436,2351,2268,2183,2089,1975,1849,1738,
-    1654,1587,1527,1462,1409,1382,1395,1464,1564,1673,1757,1805,1820,1835,1873,1936,
-    2016,2077,2086,2035,1959,1875,1817,1792,1782,1769,1727,1663,1590,1538,1528,1555,
-    1604,1656,1692,1722,1759,1815,1887,1964,2024,2052,2047,2009,1960,1902,1850,1803,
-    1753,1695,1634,1588,1559,1548,1550,1561,1579,1608,1648,1698,1749,1794,1829,1857,
-    1881,1903,1919,1928,1914,1877,1823,1764,1705,1656,1633,1623,1609,1591,1563,1525,
-    1501,1489,1497,1522,1551,1573,1588,1594,1601,1624,1677,1775,1931,2132,2343,2516,
-    2618,2630,2568,2465,2352,2247,2140,2023,1896,1768,1644,1548,1481,1429,1386,1353,
-    1335,1358,1443,1578,1723,1840,1910,1931,1932,1943,1980,2034,2070,2067,2014,1913,
-    1802,1721,1683,1676,1676,1660,1627,1581,1543,1536,1558,1597,1649,1704,1756,1804,
-    1856,1910,1954,1980,1990,1986,1986,1996,1993,1967,1911,1819,1716,1628,1565,1544,
-    1558,1583,1604,1617,1626,1646,1679,1721,1766,1821,1870,1913,1940,1949,1933,1894,
-    1848,1795,1755,1736,1725,1716,1703,1673,1640,1611,1592,1586,1595,1619,1638,1657,
-    1669,1667,1661,1659,1656,1649,1644,1633,1615,1593,1580,1599,1674,1816,2009,2201,
-    2351,2427,2421,2362,2295,2240,2188,2135,2064,1974,1872,1779,1703,1643,1590,1535,
-    1486,1454,1467,1529,1623,1716,1782,1804,1798,1799,1834,1913,2005,2074,2086,2035,
-    1951,1872,1826,1822,1831,1812,1759,1680,1587,1519,1492,1500,1527,1553,1575,1594,
-    1618,1662,1727,1799,1863,1911,1940,1948,1954,1965,1969,1961,1937,1902,1855,1807,
-    1769,1732,1711,1692,1668,1649,1652,1670,1697,1728,1761,1791,1817,1841,1860,1879,
-    1890,1889,1877,1856,1830,1802,1769,1730,1691,1653,1616,1585,1564,1547,1530,1513,
-    1500,1501,1516,1547,1587,1633,1666,1686,1688,1673,1665,1671,1698,1754,1846,1983,
-    2131,2261,2358,2395,2384,2333,2269,2207,2149,2091,2019,1935,1840,1756,1695,1648,
-    1621,1591,1554,1534,1540,1581,1647,1722,1785,1822,1827,1824,1834,1863,1897,1921,
-    1930,1918,1884,1848,1823,1798,1767,1720,1668,1616,1582,1575,1591,1610,1616,1606,
-    1593,1594,1628,1691,1764,1839,1887,1903,1899,1890,1898,1914,1931,1948,1945,1922,
-    1881,1830,1782,1739,1712,1707,1707,1712,1724,1733,1738,1738,1739,1754,1782,1824,
-    1865,1887,1889,1877,1851,1815,1784,1770,1757,1742,1720,1682,1639,1599,1567,1545,
-    1540,1548,1563,1583,1615,1647,1678,1708,1735,1755,1773,1790,1803,1813,1813,1806,
-    1792,1777,1773,1781,1830,1915,2013,2104,2168,2199,2188,2158,2120,2076,2028,1985,
-    1942,1899,1865,1836,1803,1766,1711,1660,1623,1608,1618,1652,1692,1722,1730,1715,
-    1703,1704,1738,1795,1852,1889,1895,1867,1819,1777,1741,1726,1731,1738,1739,1731,
-    1713,1692,1671,1652,1652,1669,1698,1730,1760,1784,1806,1820,1829,1845,1867,1893,
-    1908,1913,1908,1886,1847,1799,1765,1746,1736,1741,1748,1749,1747,1737,1721,1713,
-    1716,1732,1760,1789,1817,1837,1832,1810,1791,1775,1752,1734,1721,1715,1718,1717,
-    1710,1691,1671,1659,1657,1666,1690,1729,1762,1784,1786,1770,1761,1771,1790,1808,
-    1831,1848,1852,1844,1828,1823,1817,1812,1812,1807,1793,1781,1775,1767,1759,1742,
-    1737,1733,1742,1770,1812,1857,1893,1918,1934,1949,1954,1966,1977,1973,1950,1914,
-    1878,1856,1843,1835,1820,1797,1769,1738,1712,1691,1684,1681,1685,1686,1688,1689,
-    1693,1691,1681,1668,1662,1666,1690,1725,1757,1782,1789,1786,1780,1775,1786,1803,
-    1823,1847,1863,1859,1846,1839,1831,1826,1822,1824,1824,1824,1821,1815,1815,1819,
-    1821,1817,1812,1805,1788,1773,1761,1753,1755,1760,1755,1746,1737,1716,1696,1684,
-    1683,1693,1719,1740,1760,1765,1762,1764,1760,1764,1779,1796,1819,1827,1827,1815,
-    1798,1782,1765,1767,1768,1772,1777,1790,1788,1784,1778,1773,1770,1772,1790,1808,
-    1815,1806,1801,1793,1791,1794,1803,1814,1819,1817,1814,1808,1807,1814,1825,1840,
-    1845,1837,1829,1822,1811,1808,1805,1804,1807,1807,1799,1793,1794,1789,1772,1758,
-    1745,1740,1748,1754,1756,1758,1760,1749,1744,1744,1755,1769,1775,1783,1785,1784,
-    1784,1796,1810,1818,1818,1816,1816,1812,1814,1819,1824,1827,1825,1825,1820,1820,
-    1820,1823,1823,1818,1813,1805,1799,1790,1785,1776,1761,1749,1741,1729,1721,1723,
-    1729,1728,1730,1732,1740,1755,1769,1778,1793,1801,1805,1807,1802,1800,1802,1807,
-    1810,1814,1814,1819,1815,1810,1807,1808,1801,1792,1788,1784,1782,1780,1784,1782,
-    1780,1778,1770,1760,1758,1758,1766,1774,1774,1773,1766,1762,1762,1769,1781,1789,
-    1797,1797,1796,1798,1796,1790,1783,1778,1773,1769,1759,1763,1773,1782,1788,1793,
-    1796,1802,1807,1804,1802,1798,1798,1792,1787,1793,1811,1818,1813,1804,1793,1781,
-    1768,1768,1782,1788,1792,1791,1781,1775,1766,1764,1778,1800,1820,1828,1825,1814,
-    1809,1807,1811,1812,1815,1819,1810,1794,1784,1785,1788,1798,1795,1794,1791,1783,
-    1779,1782,1780,1782,1790,1795,1800,1797,1795,1793,1790,1790,1791,1792,1796,1795,
-    1793,1789,1784,1775,1767,1762,1770,1783,1788,1788,1785,1780,1773,1767,1763,1762,
-    1767,1778,1784,1782,1772,1760,1751,1739,1735,1743,1753,1765,1768,1773,1766,1768,
-    1772,1779,1792,1802,1811,1812,1810,1802,1794,1786,1781,1779,1781,1781,1783,1783,
-    1779,1767,1764,1769,1774,1781,1788,1794,1791,1788,1785,1784,1783,1788,1800,1809,
-    1809,1802,1790,1778,1773,1777,1786,1805,1817,1824,1821,1814,1813,1809,1808,1805,
-    1814,1816,1811,1803,1791,1784,1769,1761,1763,1765,1773,1783,1777,1772,1766,1764,
-    1764,1776,1785,1799,1807,1800,1791,1786,1785,1788,1797,1802,1805,1796,1791,1783,
-    1774,1764,1769,1774,1777,1776,1774,1779,1772,1772,1778,1781,1788,1795,1797,1798,
-    1796,1795,1791,1793,1785,1779,1782,1785,1785,1781,1782,1785,1785,1782,1786,1794,
-    1796,1788,1787,1784,1784,1789,1788,1780,1775,1771,1774,1772,1774,1776,1775,1780,
-    1783,1789,1790,1793,1799,1799,1799,1794,1785,1784,1788,1788,1782,1789,1788,1783,
-    1777,1781,1785,1788,1788,1790,1800,1803,1808,1805,1812,1811,1818,1817,1818,1818,
-    1808,1804,1807,1806,1788,1774,1776,1772,1770,1767,1761,1762,1769,1767,1761,1769,
-    1765,1762,1761,1778,1778,1774,1783,1781,1780,1774,1772,1773,1773,1766,1773,1782,
-    1789,1784,1780,1776,1768,1784,1786,1787,1781,1787,1788,1788,1793,1794,1801,1795,
-    1795,1791,1791,1785,1774,1771,1770,1769,1767,1763,1763,1764,1764,1766,1766,1763,
-    1762,1772,1782,1780,1770,1778,1779,1770,1776,1777,1781,1781,1785,1800,1805,1798,
-    1791,1788,1794,1794,1785,1789,1784,1784,1782,1785,1782,1775,1781,1802,1799,1791,
-    1792,1794,1796,1794,1794,1784,1789,1784,1799,1797,1796,1788,1798,1794,1788,1794,
-    1790,1783,1777,1787,1778,1790,1777,1794,1802,1797,1787,1784,1792,1793,1784,1773,
-    1784,1785,1795,1783,1782,1784,1791,1790,1784,1781,1768,1769,1772,1777,1785,1775,
-    1772,1781,1785,1788,1786,1791,1793,1794,1785,1781,1781,1792,1801,1812,1809,1797,
-    1802,1817,1821,1804,1802,1797,1791,1785,1782,1783,1786,1786,1783,1784,1770,1757,
-    1762,1764,1766,1766,1760,1753,1763,1767,1772,1774,1776,1783,1800,1807,1805,1804,
-    1813,1815,1795,1795,1793,1811,1809,1792,1781,1793,1785,1776,1770,1767,1777,1782,
-    1780,1767,1773,1769,1787,1783,1774,1764,1762,1778,1789,1787,1759,1761,1775,1788,
-    1784,1779,1774,1766,1782,1792,1781,1776,1790,1789,1795,1806,1796,1778,1780,1788,
-    1797,1802,1786,1785,1793,1807,1801,1784,1781,1780,1784,1794,1798,1784,1782,1786,
-    1787,1794,1800,1795,1795,1800,1791,1789,1798,1796,1780,1790,1802,1804,1792,1781,
-    1782,1786,1795,1798,1795,1785,1790,1806,1816,1806,1789,1787,1799,1796,1788,1781,
-    1777,1776,1771,1764,1763,1759,1735,1741,1762,1779,1776,1766,1764,1773,1791,1784,
-    1771,1777,1783,1792,1796,1792,1794,1806,1820,1812,1806,1804,1793,1792,1801,1805,
-    1798,1788,1788,1791,1792,1787,1785,1788,1789,1788,1777,1782,1784,1795,1795,1787,
-    1790,1783,1785,1791,1793,1786,1789,1788,1785,1784,1779,1769,1771,1777,1765,1755,
-    1754,1757,1765,1783,1785,1779,1777,1783,1782,1775,1778,1777,1780,1785,1780,1774,
-    1776,1787,1783,1775,1765,1769,1786,1796,1802,1792,1783,1787,1792,1791,1793,1800,
-    1814,1815,1816,1814,1811,1816,1816,1820,1825,1821,1817,1819,1815,1809,1806,1801,
-    1791,1786,1793,1806,1815,1809,1805,1804,1812,1813,1806,1799,1800,1804,1793,1783,
-    1773,1768,1764,1764,1770,1766,1772,1775,1771,1775,1778,1782,1780,1779,1783,1787,
-    1786,1780,1779,1781,1782,1776,1773,1774,1773,1764,1758,1750,1745,1739,1735,1735,
-    1728,1721,1715,1712,1707,1701,1695,1690,1690,1684,1678,1682,1688,1687,1685,1682,
-    1687,1691,1692,1693,1710,1728,1815,2004,2136,2118,2078,2107,2167,2237,2238,2107,
-    1944,1885,1870,1823,1765,1704,1637,1617,1618,1563,1512,1556,1651,1730,1769,1743,
-    1705,1754,1869,1946,1959,1937,1912,1897,1909,1912,1888,1866,1864,1839,1775,1716,
-    1679,1684,1722,1743,1717,1678,1678,1710,1749,1785,1801,1806,1816,1831,1823,1809,
-    1804,1794,1778,1753,1714,1673,1661,1657,1651,1633,1616,1614,1628,1666,1693,1710,
-    1733,1754,1764,1767,1772,1781,1791,1783,1755,1713,1676,1649,1616,1587,1562,1531,
-    1486,1445,1456,1552,1727,1921,2064,2142,2206,2312,2451,2536,2505,2377,2230,2128,
-    2071,2015,1923,1815,1710,1609,1511,1442,1423,1468,1544,1583,1573,1562,1599,1702,
-    1837,1931,1961,1946,1928,1931,1952,1974,1981,1957,1897,1813,1735,1700,1701,1715,
-    1703,1655,1596,1584,1630,1697,1763,1802,1818,1832,1873,1914,1947,1981,1985,1943,
-    1880,1817,1765,1749,1738,1696,1629,1571,1536,1539,1577,1611,1632,1654,1673,1683,
-    1710,1759,1817,1864,1883,1868,1842,1838,1855,1860,1835,1781,1719,1676,1663,1655,
-    1637,1606,1569,1535,1511,1504,1502,1509,1519,1515,1501,1526,1581,1701,1925,2130,
-    2217,2238,2272,2382,2535,2606,2517,2317,2160,2072,2020,1965,1868,1749,1655,1564,
-    1477,1433,1461,1521,1561,1560,1524,1524,1621,1761,1869,1921,1909,1886,1893,1935,
-    1978,2000,1987,1940,1867,1814,1799,1810,1813,1796,1749,1681,1647,1656,1693,1734,
-    1751,1742,1747,1778,1825,1858,1876,1879,1869,1860,1845,1828,1809,1783,1740,1677,
-    1631,1605,1599,1607,1612,1612,1619,1635,1656,1677,1705,1735,1758,1785,1811,1824,
-    1823,1810,1799,1795,1788,1786,1770,1744,1720,1697,1676,1665,1645,1611,1584,1568,
-    1564,1567,1570,1572,1580,1589,1606,1669,1761,1871,2009,2089,2085,2135,2236,2310,
-    2362,2312,2198,2136,2118,2106,2071,1988,1890,1805,1754,1714,1664,1644,1627,1611,
-    1600,1572,1569,1606,1653,1706,1730,1723,1730,1761,1808,1848,1869,1891,1903,1917,
-    1937,1944,1944,1947,1937,1910,1874,1828,1791,1771,1767,1752,1722,1677,1636,1624,
-    1636,1649,1656,1656,1650,1649,1649,1658,1674,1691,1699,1693,1691,1711,1746,1779,
-    1792,1791,1782,1772,1774,1784,1791,1786,1778,1768,1762,1757,1756,1756,1766,1776,
-    1771,1764,1762,1781,1806,1817,1808,1797,1774,1755,1758,1759,1753,1736,1718,1707,
-    1700,1697,1712,1728,1736,1729,1734,1751,1782,1828,1858,1865,1879,1906,1935,1976,
-    1995,2004,2010,2007,2000,1996,1973,1947,1929,1904,1882,1850,1813,1793,1782,1773,
-    1762,1735,1714,1709,1716,1731,1743,1743,1739,1749,1766,1790,1806,1806,1798,1794,
-    1792,1797,1798,1787,1776,1759,1740,1723,1711,1704,1697,1696,1697,1693,1690,1691,
-    1697,1702,1705,1711,1714,1720,1730,1738,1747,1755,1769,1778,1780,1787,1799,1806,
-    1811,1813,1809,1803,1793,1795,1800,1812,1820,1827,1830,1824,1823,1829,1842,1849,
-    1853,1842,1828,1821,1808,1799,1793,1786,1776,1770,1760,1751,1748,1738,1732,1728,
-    1726,1722,1719,1715,1712,1713,1719,1730,1745,1760,1772,1787,1798,1810,1824,1831,
-    1837,1844,1844,1847,1852,1850,1850,1835,1815,1810,1816,1827,1832,1832,1816,1802,
-    1795,1797,1808,1820,1820,1818,1816,1806,1804,1806,1810,1804,1791,1779,1776,1777,
-    1782,1784,1768,1755,1750,1754,1756,1752,1744,1729,1715,1708,1714,1723,1721,1716,
-    1710,1707,1714,1731,1752,1767,1776,1782,1786,1794,1809,1826,1842,1846,1846,1837,
-    1832,1841,1847,1850,1847,1840,1833,1827,1823,1814,1804,1797,1795,1789,1777,1764,
-    1753,1752,1754,1755,1751,1755,1759,1760,1763,1761,1760,1761,1759,1759,1757,1757,
-    1760,1761,1769,1769,1773,1781,1795,1808,1820,1820,1819,1821,1826,1823,1820,1820,
-    1818,1810,1796,1784,1774,1770,1768,1771,1767,1762,1756,1762,1770,1766,1761,1764,
-    1772,1780,1782,1785,1785,1786,1796,1797,1800,1806,1812,1824,1839,1837,1831,1825,
-    1825,1824,1820,1815,1808,1803,1792,1780,1766,1752,1741,1745,1748,1751,1750,1751,
-    1756,1762,1768,1767,1766,1767,1771,1776,1785,1794,1798,1794,1791,1790,1787,1798,
-    1812,1822,1825,1820,1812,1810,1817,1822,1820,1815,1811,1805,1800,1801,1802,1806,
-    1808,1811,1806,1798,1802,1804,1805,1797,1788,1782,1777,1771,1761,1754,1751,1748,
-    1747,1745,1748,1753,1762,1768,1769,1776,1784,1789,1793,1802,1800,1793,1788,1784,
-    1790,1788,1789,1788,1786,1789,1784,1780,1773,1769,1774,1776,1776,1775,1768,1766,
-    1768,1770,1770,1767,1770,1774,1777,1781,1784,1787,1795,1801,1804,1806,1808,1806,
-    1804,1800,1797,1797,1804,1806,1805,1801,1797,1799,1796,1798,1796,1789,1786,1781,
-    1779,1780,1778,1779,1776,1775,1771,1770,1778,1782,1785,1785,1779,1779,1776,1775,
-    1780,1783,1786,1782,1779,1778,1778,1779,1785,1795,1806,1810,1811,1812,1810,1813,
-    1822,1827,1823,1813,1806,1799,1795,1794,1790,1786,1776,1765,1758,1756,1753,1752,
-    1753,1748,1747,1744,1745,1753,1757,1761,1765,1768,1772,1780,1795,1802,1796,1793,
-    1789,1782,1782,1782,1778,1776,1772,1767,1767,1773,1778,1777,1770,1770,1774,1773,
-    1776,1781,1783,1781,1781,1780,1785,1791,1792,1787,1784,1778,1770,1771,1771,1775,
-    1778,1777,1775,1774,1780,1792,1802,1804,1806,1803,1800,1798,1793,1791,1784,1775,
-    1773,1775,1776,1778,1779,1783,1787,1787,1789,1791,1797,1791,1785,1779,1777,1778,
-    1780,1787,1788,1787,1787,1785,1785,1785,1783,1789,1792,1796,1799,1796,1795,1795,
-    1791,1788,1788,1788,1786,1782,1776,1772,1776,1779,1776,1773,1769,1769,1774,1779,
-    1781,1788,1793,1794,1800,1806,1809,1810,1813,1809,1805,1802,1800,1802,1801,1804,
-    1803,1799,1800,1799,1798,1792,1791,1787,1784,1791,1795,1798,1802,1805,1804,1801,
-    1799,1802,1804,1806,1801,1794,1787,1784,1782,1778,1775,1769,1772,1777,1776,1771,
-    1771,1768,1769,1769,1773,1776,1777,1782,1784,1787,1787,1787,1790,1793,1793,1791,
-    1788,1787,1792,1794,1793,1790,1784,1787,1787,1787,1787,1785,1777,1773,1774,1776,
-    1779,1777,1775,1770,1768,1772,1778,1779,1778,1780,1782,1784,1792,1793,1791,1791,
-    1789,1789,1787,1796,1800,1792,1785,1778,1771,1770,1771,1770,1773,1774,1777,1777,
-    1779,1785,1787,1791,1792,1793,1795,1799,1797,1796,1790,1791,1796,1793,1790,1790,
-    1790,1788,1786,1783,1782,1785,1785,1783,1782,1785,1782,1781,1781,1781,1782,1780,
-    1778,1777,1777,1775,1778,1779,1778,1779,1778,1779,1784,1786,1787,1787,1790,1791,
-    1789,1789,1791,1789,1787,1786,1790,1794,1796,1799,1801,1799,1794,1794,1792,1791,
-    1788,1785,1782,1783,1790,1791,1788,1786,1788,1790,1784,1779,1778,1778,1776,1771,
-    1773,1779,1781,1783,1787,1790,1794,1797,1796,1797,1804,1804,1808,1812,1818,1814,
-    1811,1807,1802,1803,1800,1800,1798,1794,1788,1783,1781,1782,1779,1778,1776,1773,
-    1775,1777,1779,1776,1782,1789,1791,1792,1793,1796,1796,1792,1791,1792,1792,1788,
-    1789,1790,1795,1792,1786,1787,1785,1786,1787,1788,1790,1791,1794,1797,1797,1796,
-    1796,1795,1796,1797,1800,1798,1798,1799,1794,1788,1782,1779,1775,1772,1767,1763,
-    1763,1762,1759,1753,1756,1759,1763,1766,1768,1773,1772,1771,1774,1780,1784,1782,
-    1787,1792,1798,1797,1790,1789,1784,1784,1785,1785,1788,1788,1785,1785,1786,1787,
-    1787,1787,1784,1783,1782,1782,1787,1789,1789,1790,1789,1790,1792,1792,1791,1787,
-    1780,1777,1775,1770,1769,1773,1775,1777,1776,1782,1785,1790,1789,1784,1790,1789,
-    1788,1786,1792,1794,1790,1784,1777,1779,1781,1787,1787,1784,1782,1782,1782,1782,
-    1781,1778,1777,1775,1778,1783,1786,1793,1798,1801,1795,1786,1787,1788,1789,1790,
-    1790,1788,1786,1786,1786,1791,1795,1794,1791,1788,1793,1793,1790,1791,1788,1788,
-    1784,1783,1784,1784,1783,1781,1780,1781,1780,1788,1790,1787,1784,1785,1783,1786,
-    1790,1795,1799,1802,1803,1802,1796,1803,1853,1772,1770,1846,1780,1761,1800,1779,
-    1763,1776,1793,1793,1767,1798,1804,1781,1794,1795,1779,1795,1793,1781,1801,1794,
-    1782,1794,1793,1786,1800,1805,1787,1795,1798,1788,1798,1797,1792,1795,1788,1784,
-    1788,1780,1783,1786,1776,1776,1782,1775,1779,1782,1766,1778,1787,1775,1780,1786,
-    1782,1789,1788,1789,1792,1791,1802,1798,1794,1803,1803,1795,1794,1793,1790,1798,
-    1791,1787,1795,1793,1785,1780,1775,1775,1785,1789,1789,1797,1799,1795,1798,1801,
-    1800,1802,1796,1788,1784,1775,1776,1773,1776,1782,1768,1772,1782,1768,1770,1772,
-    1773,1786,1780,1782,1788,1785,1791,1795,1792,1789,1792,1793,1791,1787,1787,1789,
-    1788,1788,1787,1787,1781,1783,1788,1780,1778,1781,1778,1777,1777,1772,1775,1773,
-    1769,1779,1787,1785,1777,1789,1789,1777,1788,1782,1761,1790,1787,1762,1775,1776,
-    1774,1765,1772,1776,1759,1770,1787,1768,1780,1786,1762,1780,1787,1770,1781,1785,
-    1790,1780,1767,1797,1770,1757,1806,1777,1757,1791,1777,1776,1786,1788,1803,1790,
-    1802,1808,1781,1814,1809,1782,1818,1801,1782,1805,1800,1795,1790,1800,1803,1780,
-    1804,1795,1777,1803,1796,1769,1792,1787,1767,1795,1801,1795,1795,1795,1800,1793,
-    1795,1806,1788,1796,1799,1795,1793,1790,1799,1816,1791,1778,1804,1794,1782,1791,
-    1802,1790,1784,1780,1794,1792,1780,1775,1773,1779,1748,1755,1788,1774,1761,1780,
-    1778,1754,1768,1792,1779,1758,1777,1789,1763,1770,1804,1796,1765,1781,1805,1790,
-    1786,1809,1806,1786,1802,1804,1775,1779,1800,1800,1777,1777,1804,1795,1765,1781,
-    1811,1797,1781,1794,1794,1790,1784,1790,1790,1755,1785,1813,1772,1776,1787,1781,
-    1783,1772,1783,1761,1760,1801,1770,1754,1785,1776,1762,1768,1770,1753,1751,1792,
-    1761,1749,1784,1769,1767,1777,1781,1774,1765,1782,1789,1783,1786,1770,1778,1794,
-    1760,1766,1784,1767,1765,1778,1781,1772,1776,1793,1792,1787,1794,1782,1793,1800,
-    1778,1778,1781,1783,1787,1771,1785,1795,1783,1784,1779,1793,1780,1769,1792,1785,
-    1773,1780,1780,1779,1771,1762,1785,1778,1761,1777,1787,1788,1772,1779,1797,1784,
-    1783,1798,1784,1765,1783,1793,1781,1764,1775,1784,1766,1769,1768,1771,1779,1766,
-    1767,1772,1768,1776,1776,1783,1782,1765,1782,1788,1784,1771,1758,1789,1784,1766,
-    1773,1773,1772,1769,1778,1784,1773,1780,1787,1765,1773,1775,1768,1775,1765,1779,
-    1792,1779,1772,1778,1780,1777,1770,1779,1785,1781,1792,1800,1792,1791,1789,1801,
-    1800,1785,1797,1796,1800,1791,1777,1796,1795,1786,1798,1793,1793,1804,1802,1804,
-    1795,1799,1797,1801,1818,1812,1805,1809,1814,1816,1814,1811,1817,1805,1800,1809,
-    1814,1811,1802,1812,1818,1806,1796,1801,1808,1805,1798,1788,1790,1798,1790,1777,
-    1773,1780,1770,1768,1766,1762,1760,1754,1761,1757,1750,1751,1753,1760,1759,1748,
-    1753,1752,1744,1740,1736,1735,1733,1734,1732,1727,1731,1726,1719,1725,1721,1701,
-    1698,1696,1687,1693,1698,1690,1681,1691,1700,1696,1694,1720,1780,1853,1830,1800,
-    1964,2121,2030,1949,2085,2181,2122,2083,2083,2045,2050,2045,1936,1873,1876,1799,
-    1734,1765,1737,1617,1593,1658,1658,1627,1598,1574,1615,1680,1677,1653,1683,1716,
-    1739,1766,1777,1773,1783,1821,1849,1860,1851,1831,1843,1874,1875,1843,1806,1799,
-    1824,1822,1782,1757,1754,1765,1766,1776,1791,1756,1754,1815,1844,1803,1764,1791,
-    1845,1851,1821,1784,1794,1845,1833,1793,1784,1786,1793,1804,1791,1764,1749,1755,
-    1754,1753,1748,1708,1696,1728,1739,1713,1694,1697,1707,1723,1725,1696,1691,1712,
-    1716,1709,1701,1695,1694,1702,1712,1695,1674,1679,1696,1714,1716,1714,1729,1767,
-    1810,1859,1911,1922,1924,2020,2124,2109,2070,2094,2136,2152,2139,2074,2003,2010,
-    2022,1954,1882,1852,1801,1759,1757,1731,1678,1655,1656,1672,1688,1668,1635,1645,
-    1694,1720,1723,1715,1717,1746,1787,1790,1765,1759,1783,1809,1817,1806,1782,1770,
-    1782,1801,1796,1767,1747,1757,1774,1783,1768,1742,1745,1772,1787,1790,1786,1787,
-    1809,1841,1858,1837,1827,1861,1876,1868,1855,1845,1852,1852,1839,1807,1788,1789,
-    1778,1774,1774,1759,1743,1739,1742,1734,1727,1718,1694,1689,1701,1692,1668,1659,
-    1666,1670,1660,1647,1640,1643,1653,1640,1631,1625,1622,1617,1600,1593,1578,1581,
-    1588,1602,1642,1710,1829,1913,1885,1939,2193,2338,2221,2136,2251,2355,2353,2267,
-    2090,2013,2131,2137,1917,1779,1792,1776,1747,1742,1656,1586,1639,1669,1637,1657,
-    1680,1620,1617,1712,1746,1705,1682,1671,1685,1744,1765,1710,1677,1715,1761,1776,
-    1755,1714,1706,1741,1765,1748,1714,1703,1711,1719,1738,1747,1732,1718,1743,1783,
-    1808,1813,1801,1802,1839,1873,1873,1857,1854,1870,1891,1903,1904,1886,1885,1881,
-    1872,1905,1910,1862,1821,1836,1862,1843,1794,1751,1737,1765,1774,1740,1705,1703,
-    1724,1734,1732,1714,1689,1697,1716,1714,1708,1697,1679,1676,1694,1717,1709,1683,
-    1690,1707,1737,1748,1717,1698,1718,1757,1764,1733,1704,1711,1741,1756,1731,1700,
-    1716,1738,1744,1753,1770,1789,1824,1874,1906,1931,1974,2011,2031,2058,2075,2088,
-    2095,2079,2056,2045,2029,1997,1947,1903,1877,1847,1813,1767,1724,1702,1691,1674,
-    1646,1623,1621,1629,1633,1626,1623,1631,1647,1661,1671,1677,1697,1717,1748,1769,
-    1772,1782,1814,1846,1846,1850,1866,1879,1875,1874,1876,1872,1871,1867,1857,1860,
-    1860,1842,1832,1846,1848,1834,1820,1815,1823,1839,1831,1801,1792,1801,1802,1779,
-    1753,1734,1729,1733,1719,1690,1681,1677,1672,1669,1661,1652,1644,1644,1649,1647,
-    1643,1634,1623,1626,1638,1647,1640,1631,1631,1642,1645,1634,1619,1612,1620,1628,
-    1633,1635,1629,1637,1715,1816,1878,1887,1899,2020,2219,2294,2179,2113,2209,2301,
-    2280,2177,2049,2002,2058,2055,1921,1811,1787,1755,1725,1725,1689,1626,1611,1621,
-    1621,1647,1662,1603,1564,1614,1680,1685,1651,1618,1621,1683,1744,1743,1708,1715,
-    1762,1805,1821,1803,1783,1781,1803,1828,1827,1806,1780,1770,1781,1811,1809,1771,
-    1753,1773,1805,1817,1809,1789,1783,1811,1839,1841,1828,1812,1816,1845,1854,1826,
-    1820,1839,1825,1806,1821,1833,1813,1793,1788,1777,1786,1787,1752,1720,1742,1767,
-    1762,1746,1737,1740,1754,1766,1747,1730,1729,1731,1723,1718,1713,1697,1689,1704,
-    1713,1699,1688,1689,1710,1729,1726,1715,1722,1745,1745,1729,1723,1727,1730,1721,
-    1714,1715,1724,1730,1726,1736,1765,1787,1786,1793,1832,1896,1947,1936,1923,1979,
-    2062,2078,2054,2045,2050,2077,2091,2049,1988,1970,1964,1935,1900,1856,1797,1763,
-    1753,1731,1695,1661,1637,1624,1636,1642,1622,1605,1620,1647,1662,1661,1657,1667,
-    1684,1715,1736,1741,1753,1774,1797,1820,1842,1848,1843,1848,1860,1863,1858,1842,
-    1825,1825,1835,1831,1805,1793,1803,1808,1808,1817,1829,1830,1836,1849,1842,1823,
-    1821,1828,1817,1796,1779,1762,1752,1747,1723,1694,1686,1682,1673,1674,1672,1658,
-    1648,1651,1649,1642,1630,1623,1631,1649,1655,1650,1654,1671,1687,1690,1690,1698,
-    1707,1713,1716,1717,1720,1715,1722,1748,1757,1750,1760,1777,1787,1811,1850,1890,
-    1933,1952,1992,2105,2170,2091,2056,2168,2205,2104,2049,2062,2032,1979,1954,1911,
-    1845,1811,1783,1747,1740,1712,1656,1627,1649,1660,1622,1584,1598,1639,1642,1632,
-    1648,1676,1673,1678,1712,1732,1735,1745,1772,1797,1809,1811,1816,1828,1837,1837,
-    1833,1828,1828,1827,1819,1816,1825,1822,1807,1806,1817,1812,1793,1792,1802,1796,
-    1785,1780,1777,1771,1770,1765,1756,1771,1788,1792,1794,1809,1830,1844,1854,1866,
-    1877,1885,1887,1879,1870,1865,1860,1846,1826,1807,1797,1791,1775,1755,1739,1733,
-    1723,1706,1701,1700,1683,1677,1683,1686,1685,1685,1688,1692,1700,1708,1710,1711,
-    1720,1734,1742,1751,1756,1750,1752,1764,1766,1758,1757,1756,1756,1761,1772,1764,
-    1754,1766,1785,1784,1788,1793,1791,1799,1812,1826,1830,1836,1851,1869,1896,1910,
-    1908,1925,1944,1949,1955,1963,1957,1940,1932,1933,1915,1886,1860,1847,1835,1809,
-    1779,1759,1743,1733,1723,1706,1696,1692,1692,1695,1697,1699,1705,1708,1725,1741,
-    1747,1762,1775,1777,1784,1801,1803,1804,1809,1816,1812,1811,1819,1816,1822,1828,
-    1829,1825,1823,1834,1837,1834,1833,1828,1821,1818,1813,1801,1794,1783,1770,1763,
-    1751,1735,1726,1720,1707,1706,1702,1694,1687,1686,1690,1686,1675,1668,1673,1679,
-    1681,1681,1679,1685,1701,1710,1709,1710,1725,1741,1750,1750,1758,1762,1754,1749,
-    1748,1745,1740,1742,1745,1756,1763,1762,1764,1781,1796,1800,1806,1820,1835,1858,
-    1878,1885,1894,1905,1926,1944,1962,1976,1983,1998,2008,2010,2008,1998,1974,1954,
-    1943,1927,1897,1860,1831,1816,1802,1774,1745,1728,1724,1724,1713,1698,1692,1692,
-    1696,1695,1693,1702,1709,1707,1713,1715,1719,1729,1741,1752,1761,1772,1784,1799,
-    1808,1810,1804,1801,1803,1803,1803,1798,1790,1782,1780,1775,1774,1769,1772,1781,
-    1792,1801,1804,1814,1832,1841,1842,1844,1850,1853,1849,1847,1840,1835,1829,1814,
-    1806,1806,1803,1796,1782,1777,1775,1762,1747,1733,1728,1726,1710,1693,1681,1679,
-    1673,1661,1652,1655,1661,1663,1669,1670,1680,1689,1692,1700,1717,1728,1734,1743,
-    1757,1761,1766,1779,1790,1798,1808,1818,1821,1823,1829,1834,1828,1829,1832,1836,
-    1846,1852,1850,1847,1846,1850,1860,1862,1862,1865,1866,1866,1872,1880,1883,1891,
-    1904,1913,1918,1920,1909,1905,1910,1895,1879,1858,1842,1829,1808,1782,1767,1755,
-    1731,1718,1705,1696,1690,1686,1677,1676,1683,1691,1700,1704,1713,1721,1732,1736,
-    1738,1747,1756,1761,1766,1777,1785,1789,1796,1807,1813,1824,1833,1841,1851,1851,
-    1857,1862,1857,1855,1851,1847,1842,1837,1831,1819,1808,1801,1790,1779,1762,1746,
-    1744,1736,1721,1708,1697,1693,1688,1677,1670,1672,1675,1673,1675,1679,1684,1690,
-    1693,1695,1701,1710,1722,1731,1730,1733,1743,1746,1750,1748,1753,1763,1762,1765,
-    1769,1772,1774,1777,1781,1784,1785,1795,1803,1809,1816,1821,1828,1832,1840,1860,
-    1870,1866,1866,1870,1874,1876,1877,1884,1907,1925,1933,1938,1946,1949,1952,1939,
-    1920,1912,1904,1893,1869,1845,1825,1810,1787,1768,1751,1729,1717,1708,1696,1690,
-    1686,1678,1683,1690,1696,1704,1717,1726,1731,1733,1734,1740,1747,1751,1758,1763,
-    1777,1787,1791,1804,1806,1805,1798,1798,1799,1801,1803,1807,1814,1820,1825,1829,
-    1833,1838,1838,1840,1837,1833,1832,1825,1824,1816,1814,1811,1802,1790,1779,1778,
-    1769,1762,1756,1741,1731,1729,1725,1714,1705,1695,1686,1681,1670,1663,1660,1669,
-    1675,1676,1681,1690,1701,1707,1711,1719,1729,1737,1740,1742,1750,1755,1758,1769,
-    1783,1790,1801,1810,1814,1817,1821,1828,1830,1830,1832,1834,1837,1839,1838,1837,
-    1841,1844,1841,1837,1831,1830,1836,1849,1862,1878,1891,1904,1916,1923,1933,1938,
-    1927,1914,1909,1905,1893,1864,1840,1824,1811,1788,1764,1742,1729,1720,1703,1691,
-    1689,1682,1678,1684,1682,1681,1681,1685,1693,1698,1698,1705,1717,1730,1745,1752,
-    1759,1776,1790,1803,1811,1812,1818,1823,1832,1832,1824,1821,1823,1822,1816,1811,
-    1816,1816,1823,1826,1831,1839,1838,1839,1838,1834,1829,1824,1816,1815,1809,1796,
-    1786,1786,1783,1776,1766,1762,1754,1750,1744,1735,1730,1723,1722,1714,1712,1707,
-    1703,1709,1713,1712,1717,1726,1735,1737,1735,1739,1752,1758,1756,1757,1760,1763,
-    1765,1765,1771,1774,1778,1785,1786,1793,1801,1808,1811,1807,1802,1804,1803,1800,
-    1795,1804,1811,1806,1808,1811,1812,1819,1826,1826,1829,1829,1840,1848,1852,1857,
-    1872,1880,1878,1894,1910,1895,1883,1883,1870,1854,1843,1829,1810,1795,1778,1758,
-    1738,1730,1713,1699,1702,1703,1693,1697,1700,1704,1711,1714,1729,1742,1752,1762,
-    1775,1782,1782,1786,1796,1803,1804,1814,1819,1819,1820,1821,1816,1813,1809,1801,
-    1798,1798,1793,1780,1784,1790,1783,1779,1789,1798,1794,1789,1799,1805,1800,1794,
-    1794,1800,1800,1792,1781,1780,1776,1771,1764,1758,1755,1746,1739,1729,1720,1715,
-    1705,1695,1692,1689,1688,1687,1689,1689,1691,1701,1711,1717,1726,1739,1746,1753,
-    1759,1769,1775,1775,1775,1780,1785,1790,1790,1778,1775,1782,1784,1775,1774,1786,
-    1797,1789,1794,1818,1825,1823,1832,1831,1848,1878,1866,1871,1935,1973,1963,1964,
-    1976,2000,1998,1968,1934,1913,1907,1882,1839,1820,1804,1769,1754,1747,1721,1694,
-    1687,1685,1694,1686,1664,1671,1694,1705,1702,1702,1719,1739,1745,1752,1754,1758,
-    1771,1785,1795,1808,1812,1814,1826,1827,1826,1816,1810,1809,1802,1796,1784,1778,
-    1778,1783,1777,1768,1764,1765,1767,1761,1757,1755,1761,1767,1763,1762,1768,1770,
-    1777,1782,1792,1809,1801,1798,1832,1858,1836,1819,1844,1859,1839,1806,1793,1800,
-    1807,1782,1754,1758,1769,1760,1755,1757,1747,1740,1751,1762,1751,1743,1733,1731,
-    1736,1735,1731,1737,1752,1756,1757,1763,1764,1765,1775,1784,1785,1778,1779,1787,
-    1798,1790,1771,1769,1783,1787,1775,1775,1785,1792,1784,1780,1789,1798,1792,1788,
-    1801,1803,1792,1790,1797,1805,1802,1786,1789,1802,1797,1787,1797,1814,1817,1818,
-    1839,1859,1863,1864,1871,1890,1889,1871,1857,1857,1859,1840,1822,1826,1822,1811,
-    1800,1792,1789,1780,1767,1762,1760,1756,1742,1742,1756,1763,1763,1761,1764,1768,
-    1781,1779,1778,1788,1789,1794,1802,1804,1801,1800,1799,1796,1795,1794,1791,1787,
-    1787,1788,1779,1779,1786,1787,1779,1774,1777,1779,1780,1769,1758,1763,1762,1751,
-    1746,1745,1747,1746,1750,1752,1751,1750,1743,1737,1738,1732,1723,1716,1717,1715,
-    1715,1718,1717,1722,1727,1730,1735,1750,1764,1765,1759,1771,1782,1785,1786,1784,
-    1791,1795,1796,1798,1807,1820,1818,1809,1821,1839,1822,1797,1804,1820,1811,1792,
-    1790,1814,1903,1925,1826,1859,2009,2028,1958,1939,1955,1981,1977,1918,1857,1864,
-    1855,1793,1788,1809,1740,1674,1719,1762,1749,1726,1692,1698,1765,1771,1729,1729,
-    1761,1758,1760,1790,1783,1761,1761,1770,1791,1814,1792,1764,1786,1830,1821,1786,
-    1778,1774,1773,1777,1768,1751,1737,1730,1731,1750,1762,1744,1739,1757,1780,1787,
-    1778,1780,1783,1806,1818,1808,1815,1817,1814,1837,1862,1846,1826,1835,1845,1835,
-    1829,1809,1783,1791,1795,1770,1756,1750,1739,1740,1753,1749,1732,1736,1738,1741,
-    1751,1744,1723,1727,1737,1728,1717,1712,1702,1698,1714,1725,1725,1721,1731,1746,
-    1766,1778,1778,1786,1803,1804,1802,1808,1812,1797,1782,1782,1786,1797,1783,1759,
-    1760,1778,1777,1760,1740,1740,1753,1767,1773,1761,1762,1767,1776,1778,1856,1964,
-    1888,1825,1979,2075,2040,1983,1944,1958,1982,1963,1874,1828,1827,1762,1730,1785,
-    1769,1675,1643,1690,1720,1731,1701,1649,1683,1736,1728,1717,1745,1739,1712,1751,
-    1803,1807,1805,1786,1792,1846,1879,1861,1825,1831,1849,1837,1835,1829,1807,1785,
-    1771,1773,1779,1772,1732,1712,1743,1762,1760,1754,1751,1759,1765,1776,1790,1795,
-    1789,1781,1788,1799,1798,1784,1765,1773,1798,1811,1807,1803,1814,1820,1823,1818,
-    1806,1799,1796,1791,1792,1785,1774,1761,1763,1773,1769,1771,1769,1766,1765,1765,
-    1753,1743,1734,1725,1722,1720,1712,1717,1734,1738,1739,1752,1759,1762,1780,1790,
-    1784,1776,1776,1776,1779,1772,1750,1736,1743,1752,1739,1724,1726,1734,1734,1731,
-    1727,1731,1733,1728,1734,1759,1775,1765,1795,1865,1888,1888,1910,1956,1987,1985,
-    1957,1945,1948,1931,1895,1883,1881,1843,1813,1804,1805,1794,1772,1746,1746,1760,
-    1758,1736,1736,1745,1739,1737,1746,1744,1739,1745,1746,1753,1772,1777,1758,1769,
-    1799,1800,1791,1803,1801,1792,1787,1773,1768,1775,1763,1732,1736,1751,1746,1744,
-    1738,1739,1750,1760,1772,1781,1782,1778,1776,1786,1808,1809,1794,1796,1815,1820,
-    1817,1807,1797,1806,1804,1796,1792,1793,1791,1781,1784,1789,1773,1767,1765,1768,
-    1778,1779,1768,1762,1770,1774,1768,1765,1756,1751,1752,1754,1751,1746,1746,1737,
-    1743,1750,1751,1749,1760,1762,1761,1767,1771,1767,1763,1762,1758,1759,1757,1755,
-    1740,1730,1726,1723,1719,1724,1703,1686,1692,1715,1779,1854,1908,1894,1893,2012,
-    2130,2110,2055,2009,1977,1983,1955,1904,1863,1809,1744,1724,1766,1773,1724,1700,
-    1713,1738,1764,1763,1747,1749,1744,1722,1728,1754,1736,1709,1710,1718,1746,1770,
-    1753,1744,1771,1786,1788,1807,1826,1819,1803,1798,1804,1809,1803,1776,1752,1756,
-    1750,1749,1756,1760,1753,1744,1750,1769,1788,1793,1791,1791,1808,1820,1830,1833,
-    1823,1816,1804,1799,1806,1805,1777,1755,1744,1741,1750,1757,1755,1750,1752,1755,
-    1764,1775,1780,1776,1778,1777,1781,1793,1785,1785,1788,1775,1783,1796,1789,1797,
-    1805,1804,1822,1838,1847,1856,1859,1851,1844,1849,1855,1845,1827,1817,1811,1807,
-    1801,1791,1784,1779,1763,1759,1766,1768,1761,1740,1729,1732,1742,1741,1733,1726,
-    1725,1732,1736,1726,1718,1717,1711,1713,1725,1729,1727,1723,1723,1732,1745,1754,
-    1754,1759,1765,1763,1764,1772,1781,1777,1774,1780,1790,1795,1791,1782,1780,1785,
-    1791,1801,1807,1819,1832,1838,1853,1866,1868,1875,1887,1894,1903,1908,1900,1892,
-    1884,1874,1866,1860,1858,1848,1833,1819,1807,1801,1798,1788,1776,1772,1769,1772,
-    1783,1782,1772,1766,1765,1763,1768,1770,1765,1754,1750,1752,1761,1771,1772,1767,
-    1762,1768,1777,1784,1786,1783,1773,1767,1769,1767,1762,1759,1756,1761,1774,1778,
-    1780,1786,1787,1788,1790,1792,1794,1794,1789,1785,1781,1776,1773,1762,1764,1762,
-    1758,1759,1759,1754,1750,1753,1752,1753,1759,1759,1757,1759,1757,1754,1754,1756,
-    1760,1759,1757,1755,1755,1757,1756,1758,1754,1753,1752,1753,1750,1743,1743,1744,
-    1741,1742,1748,1751,1751,1760,1786,1806,1825,1844,1874,1912,1930,1932,1953,1975,
-    1980,1974,1955,1957,1963,1939,1910,1891,1881,1868,1840,1821,1813,1801,1782,1760,
-    1751,1747,1735,1717,1707,1701,1696,1687,1679,1681,1685,1686,1688,1701,1712,1715,
-    1718,1731,1741,1745,1752,1756,1767,1771,1768,1773,1782,1788,1793,1790,1793,1799,
-    1799,1797,1794,1805,1809,1803,1804,1815,1823,1816,1804,1805,1807,1798,1796,1791,
-    1786,1784,1774,1776,1779,1781,1780,1774,1786,1789,1786,1788,1788,1789,1792,1789,
-    1794,1807,1812,1813,1808,1810,1809,1795,1784,1786,1787,1783,1778,1776,1784,1791,
-    1781,1775,1784,1791,1794,1791,1796,1800,1803,1799,1791,1789,1789,1787,1786,1787,
-    1788,1787,1790,1786,1783,1787,1790,1790,1787,1784,1780,1781,1783,1786,1783,1783,
-    1786,1781,1775,1767,1771,1778,1770,1765,1762,1762,1768,1769,1769,1767,1770,1772,
-    1776,1779,1778,1778,1780,1784,1783,1782,1781,1783,1782,1774,1770,1778,1783,1780,
-    1784,1788,1799,1802,1806,1819,1828,1838,1844,1851,1855,1855,1853,1852,1855,1856,
-    1853,1853,1853,1852,1851,1847,1835,1834,1829,1826,1826,1824,1822,1817,1809,1802,
-    1794,1785,1777,1764,1758,1751,1745,1737,1734,1726,1722,1724,1726,1727,1724,1719,
-    1722,1725,1725,1723,1720,1718,1716,1722,1726,1720,1721,1726,1729,1738,1744,1744,
-    1748,1755,1760,1765,1767,1771,1773,1775,1780,1784,1791,1798,1801,1806,1810,1814,
-    1823,1826,1824,1822,1822,1823,1824,1821,1810,1803,1803,1797,1788,1786,1788,1788,
-    1780,1774,1772,1770,1767,1766,1764,1771,1780,1779,1773,1779,1790,1791,1792,1796,
-    1804,1810,1813,1812,1813,1815,1816,1814,1820,1829,1829,1831,1837,1841,1840,1844,
-    1847,1848,1848,1846,1845,1841,1836,1833,1831,1832,1826,1818,1811,1805,1805,1800,
-    1790,1785,1778,1769,1760,1750,1744,1741,1736,1733,1732,1732,1730,1725,1725,1728,
-    1734,1738,1743,1749,1755,1758,1756,1761,1766,1771,1771,1778,1782,1783,1784,1777,
-    1774,1780,1787,1782,1779,1781,1779,1776,1770,1765,1766,1764,1760,1756,1757,1759,
-    1758,1755,1757,1756,1756,1755,1754,1760,1762,1765,1765,1770,1774,1776,1776,1776,
-    1780,1783,1784,1782,1786,1796,1797,1795,1795,1800,1807,1806,1804,1808,1814,1815,
-    1812,1804,1804,1807,1803,1797,1797,1795,1794,1790,1783,1781,1781,1783,1783,1780,
-    1774,1776,1781,1781,1785,1792,1800,1806,1810,1811,1812,1816,1813,1812,1814,1819,
-    1819,1816,1816,1814,1810,1806,1803,1804,1801,1799,1793,1790,1789,1781,1778,1775,
-    1773,1775,1776,1773,1775,1772,1774,1774,1775,1780,1783,1785,1783,1786,1786,1789,
-    1789,1788,1785,1782,1778,1776,1774,1774,1773,1772,1777,1779,1779,1784,1788,1786,
-    1785,1786,1788,1789,1787,1784,1784,1788,1791,1794,1795,1795,1794,1793,1796,1794,
-    1792,1792,1791,1791,1789,1788,1783,1776,1774,1775,1773,1772,1770,1772,1777,1776,
-    1771,1774,1774,1773,1770,1767,1773,1775,1775,1777,1774,1772,1770,1770,1776,1773,
-    1774,1779,1781,1781,1779,1776,1777,1783,1782,1779,1787,1790,1786,1785,1787,1793,
-    1791,1788,1786,1785,1784,1780,1778,1778,1778,1778,1781,1785,1781,1782,1786,1785,
-    1784,1788,1783,1781,1782,1782,1781,1775,1776,1779,1782,1780,1774,1772,1777,1777,
-    1779,1781,1790,1792,1794,1797,1799,1808,1810,1804,1801,1800,1801,1800,1798,1803,
-    1810,1813,1811,1809,1810,1810,1806,1804,1803,1805,1803,1800,1793,1789,1785,1786,
-    1782,1778,1781,1777,1777,1774,1772,1770,1771,1777,1777,1773,1770,1770,1769,1766,
-    1766,1770,1775,1781,1786,1786,1787,1788,1793,1789,1788,1795,1795,1797,1796,1791,
-    1789,1793,1791,1788,1785,1790,1790,1793,1798,1798,1799,1800,1803,1802,1803,1800,
-    1801,1801,1797,1796,1793,1790,1790,1789,1784,1781,1776,1772,1773,1775,1774,1779,
-    1778,1776,1773,1774,1776,1775,1779,1785,1788,1791,1796,1795,1799,1800,1798,1798,
-    1794,1796,1798,1795,1791,1792,1793,1789,1791,1789,1785,1783,1778,1779,1780,1781,
-    1781,1780,1780,1780,1780,1784,1789,1791,1791,1791,1793,1798,1792,1787,1785,1786,
-    1792,1792,1793,1792,1790,1787,1786,1788,1787,1785,1784,1786,1785,1781,1777,1776,
-    1775,1776,1777,1774,1772,1775,1772,1767,1765,1767,1765,1761,1766,1775,1779,1782,
-    1786,1787,1791,1793,1793,1796,1798,1797,1791,1788,1786,1784,1783,1778,1778,1778,
-    1778,1782,1785,1787,1785,1787,1784,1782,1784,1783,1785,1782,1785,1780,1781,1782,
-    1781,1784,1786,1789,1788,1787,1782,1786,1793,1790,1785,1788,1797,1794,1785,1783,
-    1782,1780,1773,1774,1779,1777,1777,1775,1774,1773,1776,1778,1777,1778,1779,1784,
-    1789,1792,1792,1791,1792,1793,1794,1798,1802,1798,1800,1801,1800,1803,1801,1804,
-    1802,1801,1802,1801,1798,1796,1799,1796,1792,1792,1794,1792,1789,1789,1786,1785,
-    1786,1781,1780,1781,1780,1785,1783,1776,1778,1778,1779,1784,1788,1788,1787,1781,
-    1780,1784,1780,1779,1779,1781,1783,1785,1786,1785,1789,1784,1778,1788,1793,1785,
-    1786,1791,1794,1790,1786,1791,1789,1792,1798,1796,1792,1799,1799,1795,1795,1796,
-    1797,1791,1791,1792,1793,1791,1790,1791,1795,1795,1790,1791,1794,1790,1784,1782,
-    1781,1780,1777,1778,1780,1776,1778,1776,1774,1778,1781,1776,1778,1780,1783,1782,
-    1780,1782,1781,1782,1783,1781,1780,1780,1775,1772,1772,1777,1777,1775,1776,1774,
-    1775,1776,1774,1771,1767,1771,1773,1776,1778,1778,1782,1785,1785,1787,1792,1794,
-    1794,1795,1800,1801,1804,1801,1800,1798,1793,1788,1787,1787,1790,1788,1790,1795,
-    1796,1792,1790,1791,1785,1785,1785,1783,1785,1787,1785,1785,1783,1781,1781,1784,
-    1787,1788,1788,1790,1789,1789,1788,1782,1782,1785,1784,1781,1782,1778,1774,1773,
-    1773,1774,1776,1777,1776,1780,1788,1790,1789,1788,1790,1792,1792,1794,1795,1792,
-    1792,1792,1787,1787,1788,1788,1792,1794,1799,1803,1800,1796,1792,1790,1787,1787,
-    1787,1786,1783,1783,1784,1780,1778,1775,1779,1780,1779,1779,1776,1777,1781,1780,
-    1776,1775,1777,1777,1780,1780,1782,1783,1781,1786,1783,1782,1782,1784,1788,1797,
-    1798,1798,1797,1795,1792,1786,1788,1790,1787,1783,1782,1787,1786,1779,1784,1787,
-    1786,1789,1791,1793,1795,1794,1792,1790,1789,1791,1782,1782,1783,1785,1785,1782,
-    1782,1779,1781,1779,1779,1783,1782,1779,1779,1776,1779,1783,1782,1785,1786,1787,
-    1790,1791,1783,1785,1788,1790,1794,1791,1791,1791,1787,1789,1785,1787,1790,1790,
-    1789,1792,1795,1792,1787,1783,1785,1785,1786,1785,1784,1785,1785,1786,1786,1784,
-    1785,1783,1783,1782,1780,1784,1783,1784,1785,1785,1784,1784,1784,1786,1792,1801,
-    1798,1797,1798,1796,1792,1791,1789,1784,1785,1783,1787,1788,1786,1783,1784,1786,
-    1784,1786,1788,1789,1788,1788,1790,1787,1783,1784,1785,1789,1790,1791,1790,1786,
-    1783,1779,1779,1777,1781,1780,1775,1778,1779,1781,1785,1784,1786,1791,1792,1793,
-    1798,1801,1803,1800,1797,1797,1800,1797,1792,1792,1792,1795,1792,1793,1791,1789,
-    1787,1785,1787,1787,1786,1786,1786,1784,1784,1780,1782,1779,1775,1777,1780,1782,
-    1780,1784,1781,1782,1783,1784,1782,1780,1781,1778,1776,1776,1779,1781,1777,1778,
-    1781,1786,1788,1793,1801,1802,1804,1799,1802,1803,1801,1800,1799,1798,1796,1794,
-    1790,1784,1781,1779,1778,1774,1775,1778,1779,1780,1775,1775,1772,1767,1764,1761,
-    1763,1766,1769,1776,1779,1782,1786,1789,1790,1792,1793,1792,1794,1791,1789,1787,
-    1786,1784,1783,1783,1784,1786,1790,1789,1786,1782,1786,1787,1787,1788,1787,1789,
-    1790,1790,1784,1784,1788,1787,1790,1792,1787,1786,1787,1788,1784,1786,1784,1781,
-    1780,1781,1783,1782,1778,1775,1778,1776,1777,1775,1775,1776,1778,1776,1777,1778,
-    1778,1780,1781,1778,1780,1784,1786,1788,1786,1787,1791,1792,1795,1797,1797,1805,
-    1807,1803,1800,1799,1793,1791,1789,1789,1786,1787,1788,1788,1786,1783,1783,1784,
-    1787,1784,1781,1778,1781,1778,1775,1773,1772,1775,1777,1778,1780,1782,1783,1784,
-    1784,1789,1789,1792,1794,1792,1792,1786,1783,1784,1783,1781,1781,1787,1788,1787,
-    1784,1782,1781,1780,1778,1779,1779,1781,1782,1780,1781,1781,1784,1785,1784,1789,
-    1790,1791,1791,1787,1789,1788,1792,1797,1796,1790,1784,1786,1790,1794,1795,1794,
-    1795,1797,1797,1793,1796,1799,1803,1803,1797,1802,1801,1794,1790,1787,1789,1788,
-    1780,1776,1777,1774,1770,1776,1776,1774,1777,1777,1777,1774,1776,1778,1774,1776,
-    1780,1786,1787,1786,1787,1785,1788,1788,1788,1787,1787,1787,1791,1790,1790,1794,
-    1795,1802,1802,1796,1796,1800,1804,1802,1797,1795,1797,1798,1794,1793,1791,1792,
-    1790,1789,1789,1791,1790,1784,1788,1792,1792,1787,1789,1792,1792,1790,1792,1791,
-    1792,1789,1782,1779,1780,1787,1786,1785,1782,1780,1784,1784,1785,1786,1781,1772,
-    1771,1774,1773,1775,1772,1771,1776,1783,1783,1783,1785,1790,1791,1792,1794,1791,
-    1794,1791,1788,1783,1782,1784,1787,1788,1784,1783,1784,1781,1772,1773,1772,1770,
-    1766,1766,1765,1764,1773,1776,1778,1777,1782,1787,1787,1787,1789,1789,1785,1787,
-    1788,1794,1799,1803,1806,1804,1797,1788,1786,1786,1784,1782,1781,1777,1777,1776,
-    1778,1779,1775,1773,1775,1772,1771,1780,1783,1785,1784,1784,1788,1789,1787,1789,
-    1787,1789,1789,1789,1791,1792,1798,1798,1795,1793,1793,1791,1786,1784,1782,1786,
-    1785,1782,1789,1788,1785,1786,1787,1790,1789,1791,1790,1787,1786,1782,1784,1782,
-    1784,1786,1786,1781,1777,1784,1785,1779,1780,1780,1780,1784,1787,1784,1786,1783,
-    1777,1776,1774,1778,1779,1774,1777,1784,1780,1780,1783,1784,1786,1790,1787,1789,
-    1793,1791,1790,1791,1793,1788,1790,1792,1791,1793,1791,1792,1792,1792,1790,1791,
-    1798,1798,1798,1798,1793,1792,1793,1787,1786,1786,1776,1771,1777,1778,1776,1776,
-    1774,1772,1781,1783,1780,1780,1781,1780,1778,1776,1778,1780,1784,1791,1795,1792,
-    1794,1795,1792,1795,1796,1794,1787,1788,1784,1779,1782,1780,1775,1774,1779,1781,
-    1781,1785,1783,1777,1775,1779,1782,1784,1781,1781,1785,1784,1784,1782,1784,1787,
-    1789,1790,1792,1789,1788,1788,1783,1777,1777,1777,1776,1777,1782,1787,1790,1794,
-    1794,1795,1794,1797,1797,1792,1795,1800,1797,1791,1787,1786,1789,1788,1785,1782,
-    1778,1779,1782,1787,1792,1793,1790,1790,1788,1791,1798,1794,1790,1789,1790,1792,
-    1794,1798,1797,1796,1792,1789,1790,1789,1788,1785,1784,1785,1781,1779,1780,1784,
-    1786,1785,1789,1792,1789,1787,1789,1785,1781,1782,1785,1783,1777,1777,1780,1783,
-    1785,1781,1779,1779,1775,1777,1775,1771,1775,1778,1783,1784,1789,1790,1789,1789,
-    1789,1790,1784,1786,1787,1789,1793,1784,1782,1789,1787,1780,1779,1784,1791,1790,
-    1789,1794,1798,1798,1789,1792,1796,1796,1792,1791,1794,1792,1790,1785,1788,1790,
-    1790,1787,1785,1786,1791,1789,1786,1792,1794,1799,1793,1789,1793,1790,1786,1784,
-    1786,1791,1788,1789,1791,1791,1796,1796,1799,1802,1798,1797,1791,1794,1797,1794,
-    1793,1793,1793,1794,1797,1797,1799,1795,1790,1786,1786,1788,1789,1791,1793,1790,
-    1782,1777,1782,1782,1774,1769,1773,1772,1768,1772,1771,1771,1770,1772,1772,1772,
-    1777,1782,1780,1778,1779,1783,1784,1784,1789,1785,1788,1788,1783,1783,1786,1785,
-    1782,1782,1787,1792,1794,1793,1795,1793,1790,1787,1786,1782,1776,1777,1776,1779,
-    1782,1787,1790,1790,1788,1788,1787,1787,1790,1790,1793,1790,1782,1779,1780,1778,
-    1778,1781,1777,1779,1779,1779,1782,1781,1777,1774,1777,1781,1788,1785,1783,1779,
-    1778,1779,1781,1783,1786,1787,1787,1792,1790,1795,1796,1790,1783,1784,1781,1778,
-    1774,1771,1770,1770,1772,1772,1773,1769,1768,1768,1769,1776,1783,1784,1786,1788,
-    1791,1793,1793,1794,1795,1796,1790,1788,1787,1787,1780,1775,1779,1786,1787,1785,
-    1785,1785,1788,1788,1785,1786,1790,1790,1791,1786,1784,1786,1783,1786,1783,1784,
-    1787,1789,1792,1793,1792,1788,1781,1781,1780,1783,1783,1781,1786,1789,1790,1785,
-    1786,1789,1787,1787,1789,1786,1789,1791,1793,1793,1787,1790,1786,1782,1785,1786,
-    1787,1786,1785,1785,1790,1788,1785,1784,1779,1783,1784,1782,1783,1786,1791,1789,
-    1787,1785,1788,1791,1794,1790,1784,1786,1784,1783,1785,1788,1787,1786,1789,1794,
-    1791,1794,1792,1791,1793,1791,1786,1787,1788,1786,1783,1786,1790,1787,1790,1792,
-    1788,1788,1792,1787,1786,1783,1782,1784,1782,1782,1782,1781,1777,1772,1775,1778,
-    1780,1781,1790,1797,1794,1792,1788,1790,1785,1783,1786,1791,1797,1797,1798,1799,
-    1797,1794,1797,1797,1801,1807,1811,1812,1805,1802,1799,1794,1791,1788,1786,1784,
-    1784,1786,1791,1786,1780,1783,1781,1780,1780,1785,1789,1786,1783,1790,1791,1783,
-    1776,1773,1782,1780,1776,1775,1779,1775,1771,1771,1772,1771,1771,1778,1774,1775,
-    1778,1780,1780,1783,1787,1790,1791,1787,1787,1783,1781,1782,1780,1781,1784,1784,
-    1781,1779,1776,1771,1767,1769,1768,1768,1774,1777,1779,1777,1777,1775,1772,1773,
-    1770,1771,1776,1779,1779,1781,1780,1785,1783,1784,1787,1786,1789,1786,1785,1784,
-    1790,1795,1797,1797,1800,1797,1796,1793,1795,1799,1800,1800,1796,1795,1793,1796,
-    1790,1792,1791,1788,1786,1781,1782,1782,1784,1783,1780,1782,1783,1777,1773,1776,
-    1778,1775,1776,1780,1781,1780,1778,1778,1781,1785,1786,1791,1793,1794,1792,1790,
-    1797,1799,1803,1801,1798,1797,1800,1795,1790,1784,1778,1783,1793,1797,1798,1799,
-    1792,1791,1795,1796,1798,1802,1799,1797,1795,1788,1781,1776,1768,1765,1769,1775,
-    1782,1781,1783,1788,1784,1783,1783,1786,1784,1781,1781,1785,1789,1791,1789,1787,
-    1791,1792,1789,1787,1790,1791,1786,1784,1789,1792,1791,1790,1790,1791,1786,1782,
-    1780,1786,1794,1792,1790,1793,1796,1796,1796,1795,1793,1790,1788,1790,1793,1793,
-    1791,1788,1789,1791,1792,1790,1788,1792,1794,1790,1791,1791,1787,1785,1783,1783,
-    1783,1779,1777,1780,1781,1781,1779,1783,1787,1789,1787,1785,1787,1790,1791,1785,
-    1784,1786,1787,1784,1780,1781,1784,1786,1782,1781,1780,1780,1780,1778,1781,1786,
-    1785,1780,1780,1781,1780,1773,1770,1773,1780,1782,1783,1786,1786,1783,1781,1779,
-    1782,1785,1787,1786,1784,1788,1786,1789,1793,1797,1795,1793,1790,1788,1790,1788,
-    1790,1790,1794,1795,1797,1795,1795,1795,1787,1785,1782,1784,1788,1788,1785,1787,
-    1791,1796,1798,1797,1793,1790,1794,1793,1800,1799,1791,1790,1786,1779,1780,1782,
-    1783,1784,1783,1778,1778,1786,1784,1782,1782,1781,1779,1777,1784,1786,1782,1782,
-    1786,1786,1788,1790,1792,1789,1786,1784,1778,1776,1774,1773,1776,1778,1782,1790,
-    1789,1788,1787,1786,1784,1784,1786,1787,1785,1785,1786,1785,1785,1786,1783,1784,
-    1789,1793,1795,1790,1786,1783,1789,1787,1784,1789,1789,1789,1792,1790,1786,1783,
-    1784,1787,1785,1788,1796,1804,1804,1804,1798,1795,1797,1795,1789,1792,1798,1794,
-    1793,1795,1797,1792,1787,1784,1781,1783,1778,1774,1771,1769,1768,1765,1772,1778,
-    1776,1772,1773,1782,1787,1787,1791,1796,1798,1795,1791,1788,1786,1781,1780,1780,
-    1782,1789,1793,1793,1789,1786,1789,1791,1788,1790,1792,1792,1792,1789,1786,1785,
-    1785,1783,1780,1779,1779,1779,1780,1781,1781,1778,1775,1774,1776,1778,1775,1774,
-    1774,1779,1782,1778,1775,1781,1784,1780,1777,1775,1778,1783,1786,1784,1789,1789,
-    1786,1788,1790,1790,1785,1783,1785,1783,1786,1788,1790,1795,1796,1793,1791,1794,
-    1795,1794,1794,1788,1781,1782,1783,1783,1783,1783,1779,1778,1779,1775,1780,1783,
-    1778,1781,1790,1793,1786,1781,1780,1786,1789,1788,1784,1781,1785,1784,1779,1777,
-    1778,1781,1781,1786,1788,1788,1785,1779,1779,1780,1782,1783,1779,1778,1788,1794,
-    1792,1793,1792,1792,1795,1792,1788,1784,1792,1791,1786,1785,1784,1784,1779,1777,
-    1779,1779,1774,1776,1779,1782,1782,1783,1786,1787,1785,1784,1784,1789,1792,1789,
-    1790,1792,1792,1792,1789,1787,1793,1794,1791,1788,1790,1792,1792,1789,1788,1793,
-    1795,1793,1786,1786,1787,1791,1793,1791,1792,1790,1790,1782,1776,1777,1779,1776,
-    1776,1783,1781,1780,1780,1784,1786,1783,1783,1788,1788,1786,1789,1786,1781,1780,
-    1780,1781,1789,1793,1793,1790,1788,1789,1786,1785,1787,1790,1789,1785,1783,1778,
-    1778,1781,1783,1786,1789,1788,1790,1792,1792,1790,1789,1787,1788,1789,1792,1792,
-    1789,1794,1795,1797,1795,1786,1786,1786,1787,1785,1778,1777,1774,1775,1773,1773,
-    1779,1780,1781,1780,1784,1788,1791,1791,1787,1785,1780,1780,1781,1779,1780,1783,
-    1788,1794,1793,1787,1783,1786,1789,1789,1790,1792,1789,1787,1787,1787,1787,1786,
-    1786,1794,1794,1792,1794,1794,1790,1789,1786,1782,1782,1785,1788,1787,1787,1779,
-    1781,1789,1789,1785,1783,1779,1775,1779,1779,1779,1775,1775,1777,1774,1776,1777,
-    1777,1778,1779,1778,1781,1784,1786,1789,1790,1786,1788,1792,1793,1794,1796,1799,
-    1798,1796,1795,1794,1789,1790,1788,1785,1784,1775,1770,1777,1783,1788,1788,1784,
-    1787,1792,1795,1789,1785,1786,1785,1778,1779,1785,1785,1785,1782,1774,1776,1781,
-    1782,1780,1776,1779,1786,1785,1781,1783,1788,1791,1790,1787,1782,1783,1782,1785,
-    1791,1795,1795,1794,1800,1802,1804,1805,1801,1803,1804,1806,1803,1794,1788,1786,
-    1785,1780,1777,1778,1783,1780,1773,1771,1775,1778,1779,1777,1779,1783,1784,1780,
-    1775,1774,1773,1774,1772,1774,1772,1776,1779,1775,1772,1771,1774,1775,1775,1778,
-    1779,1781,1780,1783,1787,1787,1789,1789,1787,1785,1786,1783,1782,1786,1788,1789,
-    1796,1796,1794,1800,1801,1801,1802,1804,1801,1797,1795,1796,1797,1801,1799,1802,
-    1803,1803,1802,1800,1800,1795,1795,1796,1795,1793,1795,1793,1787,1784,1785,1786,
-    1786,1787,1785,1784,1781,1784,1786,1782,1785,1788,1788,1786,1789,1791,1792,1792,
-    1791,1794,1799,1802,1797,1795,1797,1796,1800,1799,1793,1792,1793,1791,1784,1779,
-    1776,1774,1770,1769,1768,1764,1764,1764,1765,1768,1769,1771,1774,1782,1784,1785,
-    1787,1789,1792,1789,1788,1784,1783,1785,1782,1779,1777,1781,1783,1784,1786,1791,
-    1792,1788,1785,1788,1789,1788,1785,1781,1784,1780,1773,1776,1779,1779,1778,1773,
-    1768,1768,1773,1773,1775,1782,1786,1788,1788,1795,1799,1797,1795,1792,1791,1797,
-    1797,1796,1798,1797,1797,1795,1790,1783,1785,1783,1781,1779,1778,1778,1784,1785,
-    1785,1789,1788,1789,1787,1787,1787,1785,1784,1786,1789,1789,1791,1791,1785,1780,
-    1778,1776,1776,1778,1776,1778,1782,1778,1780,1785,1786,1785,1784,1782,1784,1786,
-    1783,1787,1788,1789,1790,1795,1797,1794,1787,1787,1793,1792,1800,1802,1800,1800,
-    1797,1793,1790,1794,1795,1796,1795,1791,1797,1793,1784,1781,1784,1782,1778,1778,
-    1782,1783,1784,1782,1780,1784,1785,1787,1781,1784,1785,1783,1784,1786,1790,1793,
-    1790,1787,1791,1792,1793,1791,1791,1793,1789,1788,1789,1792,1797,1799,1796,1785,
-    1780,1781,1780,1777,1778,1786,1786,1787,1793,1795,1796,1786,1779,1782,1788,1789,
-    1788,1789,1785,1782,1778,1783,1783,1783,1781,1779,1780,1783,1788,1785,1784,1789,
-    1794,1795,1790,1788,1790,1786,1782,1785,1789,1790,1791,1790,1788,1783,1780,1779,
-    1778,1778,1784,1786,1784,1780,1770,1768,1770,1769,1776,1783,1785,1784,1783,1786,
-    1787,1791,1787,1787,1790,1793,1795,1792,1792,1792,1786,1786,1784,1784,1784,1781,
-    1778,1774,1775,1771,1771,1770,1771,1778,1776,1772,1774,1775,1774,1773,1772,1772,
-    1773,1778,1777,1777,1780,1781,1785,1787,1790,1789,1790,1793,1792,1796,1790,1789,
-    1792,1791,1793,1792,1795,1795,1790,1788,1790,1793,1793,1789,1787,1789,1789,1786,
-    1786,1787,1789,1783,1778,1773,1769,1772,1769,1775,1778,1779,1779,1778,1781,1780,
-    1779,1780,1784,1786,1791,1792,1791,1794,1792,1791,1788,1787,1790,1792,1794,1793,
-    1795,1794,1793,1797,1798,1797,1796,1794,1790,1786,1785,1788,1791,1791,1787,1788,
-    1792,1796,1799,1792,1791,1790,1791,1791,1788,1789,1791,1791,1789,1786,1789,1793,
-    1790,1785,1788,1789,1782,1774,1767,1767,1767,1769,1768,1775,1774,1771,1768,1772,
-    1775,1776,1775,1775,1777,1771,1776,1775,1775,1776,1781,1785,1788,1790,1786,1789,
-    1786,1789,1790,1786,1784,1779,1777,1774,1776,1778,1782,1788,1787,1787,1789,1792,
-    1790,1785,1786,1786,1788,1785,1787,1788,1788,1791,1794,1796,1797,1793,1788,1783,
-    1783,1789,1800,1804,1803,1810,1809,1809,1807,1802,1794,1791,1789,1785,1785,1784,
-    1786,1781,1776,1778,1777,1779,1784,1789,1792,1790,1788,1786,1787,1789,1789,1788,
-    1790,1793,1792,1793,1790,1788,1783,1787,1789,1791,1796,1797,1796,1794,1793,1793,
-    1791,1786,1783,1775,1771,1769,1768,1768,1774,1776,1777,1778,1777,1779,1779,1781,
-    1785,1784,1782,1783,1779,1778,1780,1781,1782,1786,1789,1794,1789,1789,1795,1796,
-    1796,1791,1791,1791,1788,1785,1786,1787,1781,1781,1782,1780,1781,1782,1782,1780,
-    1778,1773,1779,1783,1785,1791,1791,1791,1783,1778,1781,1783,1787,1791,1796,1792,
-    1786,1785,1787,1787,1787,1785,1786,1789,1789,1790,1788,1788,1784,1783,1785,1786,
-    1788,1788,1788,1780,1773,1773,1777,1777,1779,1783,1780,1778,1784,1788,1787,1785,
-    1785,1792,1792,1790,1788,1788,1793,1795,1796,1797,1799,1799,1797,1797,1796,1792,
-    1789,1786,1784,1780,1781,1779,1780,1777,1771,1769,1769,1771,1773,1774,1781,1783,
-    1784,1788,1790,1793,1791,1791,1787,1785,1780,1780,1783,1788,1787,1786,1786,1788,
-    1788,1787,1791,1788,1788,1786,1786,1783,1782,1786,1786,1786,1786,1791,1795,1798,
-    1794,1792,1792,1794,1794,1794,1796,1789,1792,1792,1795,1797,1796,1794,1791,1790,
-    1785,1783,1784,1786,1782,1779,1781,1785,1782,1783,1782,1777,1769,1765,1767,1769,
-    1769,1772,1770,1768,1765,1769,1774,1774,1778,1783,1785,1787,1792,1790,1791,1791,
-    1790,1794,1801,1801,1799,1796,1795,1796,1796,1799,1802,1803,1800,1802,1804,1799,
-    1800,1802,1795,1795,1788,1785,1781,1781,1781,1784,1783,1782,1786,1790,1797,1797,
-    1795,1793,1792,1791,1788,1782,1779,1777,1773,1771,1770,1771,1778,1781,1778,1774,
-    1778,1780,1777,1778,1784,1787,1782,1776,1776,1777,1777,1778,1781,1785,1788,1792,
-    1792,1795,1797,1798,1791,1789,1792,1795,1798,1802,1800,1792,1789,1787,1788,1791,
-    1793,1791,1785,1777,1774,1777,1778,1775,1775,1779,1787,1791,1789,1788,1786,1786,
-    1785,1784,1781,1786,1790,1794,1791,1789,1797,1796,1794,1795,1797,1793,1792,1787,
-    1783,1791,1791,1788,1790,1795,1801,1800,1800,1797,1795,1792,1785,1773,1771,1775,
-    1775,1776,1778,1777,1775,1772,1773,1775,1775,1777,1773,1769,1765,1767,1770,1774,
-    1778,1780,1777,1776,1778,1777,1775,1771,1770,1774,1779,1780,1783,1787,1790,1788,
-    1784,1782,1784,1787,1787,1789,1794,1802,1809,1809,1809,1806,1804,1805,1806,1803,
-    1805,1807,1804,1802,1801,1802,1795,1790,1793,1799,1800,1799,1798,1796,1797,1793,
-    1792,1793,1789,1788,1786,1778,1773,1774,1772,1770,1772,1770,1768,1767,1773,1773,
-    1776,1776,1778,1776,1769,1766,1769,1776,1776,1779,1777,1777,1774,1771,1773,1774,
-    1780,1774,1778,1784,1786,1791,1795,1795,1794,1798,1805,1818,1820,1819,1818,1809,
-    1803,1801,1804,1805,1804,1805,1799,1794,1793,1789,1791,1793,1789,1785,1781,1779,
-    1774,1775,1773,1770,1768,1766,1768,1770,1770,1770,1764,1760,1764,1765,1774,1775,
-    1778,1777,1772,1773,1775,1775,1775,1781,1784,1784,1786,1786,1786,1791,1792,1796,
-    1799,1799,1794,1797,1803,1803,1799,1801,1799,1797,1798,1794,1790,1790,1792,1791,
-    1794,1790,1784,1785,1785,1780,1774,1771,1773,1772,1776,1777,1777,1782,1777,1768,
-    1768,1767,1770,1770,1769,1769,1772,1776,1775,1776,1777,1779,1783,1786,1786,1784,
-    1781,1781,1781,1784,1783,1783,1783,1782,1788,1790,1790,1789,1788,1790,1790,1791,
-    1797,1799,1799,1794,1792,1792,1791,1790,1792,1796,1795,1797,1796,1791,1789,1786,
-    1786,1785,1794,1800,1796,1795,1790,1791,1789,1788,1787,1791,1795,1795,1794,1793,
-    1788,1784,1781,1780,1787,1789,1789,1788,1785,1788,1786,1787,1785,1784,1785,1781,
-    1780,1782,1785,1784,1789,1790,1786,1783,1784,1785,1785,1786,1787,1789,1787,1789,
-    1791,1794,1799,1795,1787,1786,1785,1780,1781,1782,1783,1782,1782,1785,1785,1783,
-    1780,1776,1779,1781,1782,1786,1786,1788,1788,1785,1784,1783,1779,1779,1774,1775,
-    1778,1781,1784,1780,1781,1777,1778,1786,1790,1796,1803,1799,1796,1796,1795,1794,
-    1792,1790,1792,1791,1788,1791,1789,1788,1791,1793,1798,1799,1805,1805,1805,1811,
-    1807,1805,1803,1802,1798,1794,1792,1791,1791,1785,1784,1782,1781,1778,1780,1784,
-    1781,1783,1780,1780,1777,1778,1781,1783,1782,1782,1784,1782,1781,1780,1779,1778,
-    1778,1780,1783,1788,1790,1788,1792,1788,1786,1790,1791,1786,1780,1778,1780,1783,
-    1781,1786,1788,1789,1788,1787,1787,1784,1779,1781,1780,1782,1785,1788,1783,1778,
-    1780,1781,1781,1778,1783,1779,1777,1776,1778,1778,1777,1776,1777,1781,1783,1789,
-    1786,1784,1786,1790,1783,1781,1784,1782,1781,1782,1785,1786,1792,1797,1798,1799,
-    1797,1797,1795,1793,1795,1794,1790,1790,1799,1802,1798,1791,1787,1780,1779,1780,
-    1777,1776,1774,1769,1771,1774,1777,1775,1777,1779,1775,1776,1778,1779,1779,1780,
-    1784,1788,1791,1796,1797,1799,1796,1800,1799,1798,1792,1789,1791,1791,1789,1790,
-    1794,1792,1789,1789,1788,1784,1784,1783,1785,1780,1777,1779,1780,1780,1784,1785,
-    1785,1787,1784,1783,1781,1781,1781,1780,1782,1783,1781,1777,1780,1784,1785,1784,
-    1783,1783,1779,1777,1784,1786,1786,1789,1791,1793,1792,1794,1800,1803,1799,1797,
-    1794,1790,1794,1797,1796,1795,1794,1793,1792,1791,1795,1795,1794,1793,1788,1790,
-    1790,1783,1780,1777,1776,1776,1782,1780,1783,1787,1775,1775,1771,1769,1766,1764,
-    1769,1774,1773,1770,1772,1778,1783,1785,1784,1782,1783,1784,1785,1783,1784,1784,
-    1784,1783,1784,1786,1785,1786,1786,1786,1786,1783,1785,1788,1791,1793,1792,1787,
-    1790,1794,1791,1790,1788,1788,1786,1786,1787,1787,1785,1787,1788,1792,1792,1787,
-    1786,1786,1784,1780,1782,1780,1784,1787,1784,1778,1777,1783,1784,1785,1790,1792,
-    1791,1791,1791,1791,1789,1785,1786,1786,1786,1785,1780,1779,1775,1772,1774,1774,
-    1780,1781,1777,1780,1782,1784,1783,1779,1778,1782,1781,1778,1776,1781,1785,1789,
-    1793,1788,1788,1789,1790,1788,1787,1789,1791,1791,1792,1792,1791,1789,1788,1787,
-    1786,1786,1792,1791,1784,1785,1784,1787,1785,1787,1790,1794,1794,1786,1778,1780,
-    1778,1775,1777,1777,1778,1778,1778,1777,1777,1778,1778,1775,1782,1786,1786,1789,
-    1789,1793,1791,1789,1793,1797,1800,1807,1809,1802,1799,1797,1802,1801,1795,1798,
-    1799,1801,1797,1800,1797,1791,1786,1786,1789,1788,1790,1789,1792,1788,1783,1777,
-    1773,1778,1784,1785,1783,1784,1784,1780,1777,1774,1768,1769,1769,1768,1772,1781,
-    1779,1776,1779,1783,1785,1788,1794,1794,1795,1793,1793,1796,1794,1793,1791,1793,
-    1793,1793,1798,1796,1791,1790,1790,1786,1784,1784,1782,1777,1774,1774,1775,1775,
-    1777,1780,1781,1775,1773,1776,1777,1777,1779,1779,1775,1775,1775,1774,1767,1771,
-    1776,1778,1775,1776,1780,1777,1774,1774,1772,1774,1780,1781,1784,1779,1777,1777,
-    1775,1778,1781,1784,1786,1788,1791,1787,1785,1788,1789,1793,1789,1786,1789,1789,
-    1786,1783,1785,1789,1793,1789,1791,1796,1793,1786,1787,1792,1792,1791,1793,1796,
-    1799,1799,1795,1792,1790,1791,1794,1791,1792,1793,1790,1782,1780,1781,1781,1781,
-    1784,1790,1794,1796,1790,1788,1788,1790,1789,1788,1796,1797,1791,1790,1794,1791,
-    1785,1787,1788,1792,1793,1790,1789,1788,1789,1788,1792,1794,1796,1794,1798,1797,
-    1799,1801,1798,1798,1798,1798,1799,1801,1803,1798,1794,1794,1787,1784,1782,1781,
-    1777,1778,1778,1776,1775,1778,1780,1779,1777,1773,1774,1773,1777,1774,1768,1773,
-    1771,1772,1774,1777,1785,1782,1782,1781,1781,1783,1784,1779,1780,1778,1778,1779,
-    1780,1787,1788,1788,1786,1790,1793,1799,1799,1802,1805,1810,1818,1818,1817,1814,
-    1811,1807,1807,1803,1797,1790,1786,1782,1779,1781,1781,1775,1773,1773,1773,1772,
-    1772,1773,1767,1761,1755,1746,1742,1741,1741,1739,1742,1745,1744,1751,1751,1750,
-    1748,1744,1740,1742,1744,1743,1742,1742,1741,1745,1746,1763,1810,1873,1926,1941,
-    1943,1953,1959,1939,1899,1854,1813,1773,1728,1693,1684,1703,1733,1751,1769,1791,
-    1819,1844,1864,1884,1894,1886,1854,1807,1766,1743,1722,1706,1688,1677,1687,1700,
-    1718,1752,1795,1834,1857,1865,1865,1860,1853,1838,1815,1792,1767,1738,1712,1698,
-    1689,1698,1721,1746,1775,1799,1818,1828,1842,1850,1856,1856,1847,1825,1798,1774,
-    1753,1745,1737,1737,1736,1744,1752,1766,1789,1816,1841,1855,1861,1858,1851,1844,
-    1836,1821,1804,1789,1775,1762,1753,1747,1746,1753,1766,1778,1791,1799,1803,1806,
-    1809,1812,1810,1806,1797,1792,1781,1771,1765,1756,1748,1745,1747,1751,1767,1780,
-    1793,1800,1807,1807,1809,1811,1812,1810,1805,1797,1786,1780,1775,1771,1768,1774,
-    1779,1782,1787,1789,1794,1803,1805,1806,1800,1798,1798,1797,1795,1797,1797,1794,
-    1798,1802,1812,1811,1802,1799,1796,1785,1773,1762,1759,1764,1768,1763,1762,1776,
-    1781,1777,1780,1784,1793,1799,1795,1785,1786,1785,1771,1758,1754,1749,1750,1748,
-    1746,1749,1756,1759,1762,1770,1773,1778,1777,1775,1776,1775,1766,1753,1741,1732,
-    1730,1733,1730,1739,1751,1748,1735,1724,1701,1673,1657,1638,1606,1582,1560,1536,
-    1503,1581,1846,2101,2143,2142,2279,2398,2393,2310,2200,2096,2013,1829,1583,1488,
-    1521,1493,1410,1372,1385,1460,1568,1689,1880,2056,2107,2101,2108,2076,2052,2031,
-    1942,1846,1769,1643,1521,1478,1468,1494,1544,1584,1623,1697,1764,1830,1919,1991,
-    2030,2050,2038,2010,2002,1987,1920,1856,1816,1766,1708,1650,1600,1590,1614,1625,
-    1640,1685,1725,1755,1778,1794,1822,1859,1861,1840,1825,1808,1782,1750,1726,1717,
-    1726,1720,1706,1701,1703,1700,1702,1700,1705,1721,1733,1736,1744,1758,1755,1741,
-    1740,1749,1763,1755,1738,1721,1743,1749,1721,1692,1683,1698,1693,1675,1663,1690,
-    1688,1705,1688,1691,1666,1699,1884,2078,2152,2161,2238,2375,2459,2359,2228,2175,
-    2096,1916,1730,1627,1651,1663,1579,1494,1522,1573,1589,1585,1644,1771,1857,1832,
-    1800,1836,1895,1926,1886,1866,1887,1889,1841,1792,1777,1794,1797,1762,1736,1751,
-    1758,1772,1771,1778,1802,1826,1822,1821,1833,1841,1833,1806,1796,1795,1786,1755,
-    1733,1714,1701,1674,1650,1631,1624,1611,1599,1591,1629,1677,1707,1729,1744,1762,
-    1763,1762,1758,1774,1785,1791,1791,1806,1828,1836,1825,1799,1763,1750,1731,1709,
-    1699,1697,1704,1703,1718,1740,1772,1800,1830,1857,1858,1845,1798,1765,1756,1754,
-    1767,1754,1760,1774,1812,1821,1823,1820,1834,1823,1816,1833,1820,1859,1879,1889,
-    1910,1924,1928,1946,1958,1949,1931,1923,1903,1890,1847,1834,1861,1877,1873,1850,
-    1838,1852,1850,1824,1793,1786,1791,1762,1762,1733,1759,1747,1748,1734,1716,1715,
-    1704,1733,1696,1717,1721,1712,1719,1686,1696,1723,1718,1730,1736,1768,1763,1781,
-    1764,1759,1777,1765,1760,1773,1784,1778,1799,1787,1808,1766,1800,1768,1769,1744,
-    1748,1759,1720,1775,1744,1770,1773,1772,1781,1767,1771,1771,1758,1767,1731,1784,
-    1734,1776,1786,1778,1816,1778,1794,1766,1784,1728,1783,1691,1773,1746,1798,1831,
-    1744,1908,1765,1838,1837,1782,1844,1810,1807,1814,1805,1861,1816,1807,1857,1787,
-    1802,1782,1716,1815,1774,1769,1788,1710,1882,1774,1796,1829,1758,1852,1754,1796,
-    1782,1827,1826,1777,1871,1789,1851,1809,1795,1826,1832,1810,1852,1788,1785,1779,
-    1744,1736,1715,1707,1721,1725,1679,1795,1705,1731,1735,1758,1759,1805,1764,1796,
-    1788,1842,1779,1835,1818,1779,1846,1753,1834,1823,1795,1839,1753,1836,1789,1798,
-    1820,1759,1890,1740,1883,1764,1816,1854,1776,1823,1832,1734,1836,1709,1813,1723,
-    1776,1743,1751,1742,1739,1742,1735,1776,1715,1831,1696,1850,1676,1910,1717,1913,
-    1721,1892,1693,1865,1801,1769,1866,1669,1890,1666,1896,1711,1846,1778,1759,1783,
-    1786,1739,1841,1673,1890,1696,1827,1762,1706,1860,1676,1856,1690,1770,1782,1684,
-    1833,1750,1794,1779,1765,1832,1759,1846,1768,1824,1785,1827,1735,1811,1759,1831,
-    1732,1870,1735,1899,1709,1870,1784,1788,1863,1677,1870,1667,1906,1645,1874,1632,
-    1845,1688,1788,1727,1821,1780,1798,1796,1773,1849,1725,1863,1732,1892,1738,1837,
-    1758,1810,1783,1843,1770,1853,1763,1862,1785,1823,1862,1818,1841,1851,1817,1868,
-    1799,1824,1778,1833,1738,1811,1763,1688,1813,1619,1889,1585,1887,1668,1842,1761,
-    1814,1787,1766,1821,1756,1824,1736,1795,1763,1809,1729,1817,1698,1845,1716,1805,
-    1774,1780,1824,1756,1803,1825,1736,1848,1702,1865,1729,1784,1746,1766,1785,1753,
-    1796,1723,1864,1679,1886,1707,1898,1670,1885,1659,1910,1713,1855,1778,1719,1868,
-    1676,1932,1686,1819,1709,1823,1648,1930,1620,1953,1669,1942,1687,1923,1735,1822,
-    1860,1695,1957,1592,1999,1542,1981,1605,1968,1629,1896,1740,1828,1798,1763,1852,
-    1732,1890,1655,1930,1674,1907,1696,1894,1730,1879,1728,1808,1786,1784,1758,1789,
-    1759,1764,1837,1761,1859,1747,1838,1726,1832,1742,1860,1741,1885,1703,1914,1702,
-    1870,1775,1763,1855,1633,1898,1667,1875,1705,1812,1740,1811,1750,1796,1803,1747,
-    1811,1795,1768,1819,1744,1790,1779,1784,1775,1771,1751,1773,1802,1730,1875,1710,
-    1881,1720,1805,1819,1722,1914,1672,1912,1708,1791,1854,1660,1911,1630,1948,1657,
-    1907,1678,1818,1841,1699,1889,1702,1839,1837,1734,1805,1896,1720,2002,1530,2066,
-    1599,1875,1783,1681,1937,1649,1898,1728,1850,1688,1891,1674,1874,1739,1781,1846,
-    1719,1839,1802,1795,1807,1815,1804,1859,1675,1887,1744,1703,1938,1554,1962,1655,
-    1824,1774,1675,1886,1599,1913,1610,1917,1622,1883,1754,1733,1885,1653,1888,1711,
-    1811,1766,1708,1874,1714,1774,1879,1640,1914,1725,1752,1860,1700,1857,1741,1777,
-    1853,1664,1850,1779,1658,1971,1562,1849,1785,1678,1959,1578,1932,1643,1845,1794,
-    1711,1824,1826,1677,1836,1755,1837,1766,1778,1830,1655,2052,1473,2019,1598,1912,
-    1772,1633,2145,1393,2200,1510,1932,1877,1516,2123,1468,2043,1692,1867,1721,1863,
-    1680,1865,1801,1609,2013,1568,1937,1653,1847,1876,1635,2004,1627,1839,1940,1486,
-    2098,1618,1763,2008,1532,1924,1762,1688,1990,1534,1975,1675,1751,1938,1665,1843,
-    1876,1608,2031,1495,1998,1702,1678,2066,1306,2303,1156,2358,1249,2155,1605,1739,
-    2040,1396,2267,1375,2146,1569,1967,1738,1790,1796,1933,1659,2012,1618,1932,1735,
-    1797,1823,1758,1918,1605,2158,1368,2095,1740,1618,2067,1387,2090,1591,1789,1917,
-    1580,1922,1722,1771,1737,1931,1662,1835,1784,1736,1844,1714,1856,1688,1769,1905,
-    1504,2113,1430,2068,1631,1793,1923,1534,2052,1620,1845,1825,1722,1791,1841,1659,
-    1922,1565,2050,1495,2057,1632,1823,1898,1641,1960,1673,1840,1719,1897,1713,1754,
-    1911,1665,1822,1900,1584,2049,1536,1931,1784,1618,1979,1561,1957,1613,1863,1826,
-    1605,2060,1480,2018,1657,1784,1879,1599,2036,1540,1951,1707,1750,1942,1416,2196,
-    1319,2101,1660,1599,2203,1206,2377,1289,2081,1755,1558,2160,1371,2129,1512,1884,
-    1863,1552,2030,1559,1930,1689,1824,1796,1771,1804,1843,1654,1938,1693,1802,1807,
-    1678,1963,1556,2071,1516,2009,1672,1851,1754,1816,1826,1710,1850,1775,1776,1780,
-    1777,1729,1852,1665,2014,1475,2085,1617,1829,1852,1683,2001,1626,1899,1753,1751,
-    1901,1661,1858,1838,1580,2106,1446,2091,1589,1935,1798,1606,2073,1445,2165,1454,
-    2014,1676,1815,1863,1623,1961,1681,1821,1832,1644,1957,1653,1835,1881,1586,2108,
-    1470,1985,1704,1757,1919,1596,1893,1777,1742,1886,1607,1931,1666,1818,1891,1549,
-    2113,1421,2149,1536,1936,1918,1386,2458,1005,2528,1379,1825,2157,1136,2615,1041,
-    2232,1732,1516,2210,1308,2112,1774,1581,2245,1284,2266,1582,1698,2154,1193,2382,
-    1349,1966,1840,1490,2216,1414,1986,1855,1484,2201,1401,1976,1870,1408,2325,1258,
-    1989,1868,1394,2234,1312,2048,1791,1475,2193,1379,1984,1758,1592,2091,1433,1994,
-    1830,1570,2062,1535,1919,1821,1521,2138,1487,1902,1846,1573,2077,1495,1989,1729,
-    1693,1956,1650,1796,1859,1698,1893,1708,1840,1851,1714,1937,1559,2004,1613,1911,
-    1672,1812,1810,1684,1890,1687,1854,1756,1796,1765,1852,1679,1912,1738,1828,1784,
-    1833,1757,1857,1705,1844,1830,1756,1818,1744,1833,1794,1757,1817,1763,1738,1888,
-    1661,1862,1730,1823,1762,1715,1845,1730,1820,1796,1727,1912,1663,1877,1707,1830,
-    1815,1711,1849,1694,1877,1667,1871,1730,1798,1799,1705,1883,1682,1899,1728,1776,
-    1868,1650,1938,1672,1842,1863,1637,1928,1695,1738,1865,1658,1869,1729,1770,1805,
-    1764,1804,1811,1773,1826,1804,1794,1770,1825,1787,1783,1813,1704,1911,1665,1893,
-    1717,1818,1810,1741,1878,1713,1879,1774,1794,1852,1763,1824,1804,1782,1808,1795,
-    1773,1777,1809,1760,1795,1805,1728,1815,1776,1737,1863,1688,1883,1745,1793,1822,
-    1731,1854,1707,1845,1758,1781,1818,1729,1831,1749,1800,1797,1766,1797,1770,1803,
-    1752,1832,1737,1810,1772,1768,1806,1759,1804,1742,1837,1728,1812,1785,1735,1840,
-    1748,1792,1820,1759,1810,1780,1773,1809,1738,1837,1734,1792,1809,1722,1843,1747,
-    1796,1808,1745,1830,1741,1810,1781,1773,1811,1726,1857,1721,1819,1787,1749,1844,
-    1718,1847,1729,1817,1789,1730,1866,1678,1867,1732,1780,1833,1704,1877,1697,1820,
-    1779,1737,1845,1696,1832,1785,1732,1870,1701,1865,1753,1777,1841,1680,1886,1679,
-    1821,1799,1705,1893,1671,1842,1776,1734,1875,1685,1886,1732,1787,1829,1712,1878,
-    1729,1811,1813,1748,1816,1774,1769,1813,1762,1806,1796,1783,1839,1769,1831,1782,
-    1782,1824,1749,1827,1780,1785,1823,1758,1817,1776,1798,1794,1779,1791,1793,1764,
-    1788,1768,1745,1795,1716,1821,1730,1801,1769,1744,1797,1735,1807,1744,1775,1774,
-    1770,1785,1786,1762,1827,1761,1820,1761,1804,1803,1772,1833,1757,1838,1757,1817,
-    1778,1789,1814,1782,1806,1795,1792,1819,1775,1819,1789,1796,1823,1755,1839,1750,
-    1821,1779,1778,1823,1756,1846,1758,1819,1805,1763,1840,1745,1816,1792,1756,1831,
-    1736,1811,1779,1750,1835,1707,1850,1754,1771,1819,1728,1846,1738,1805,1797,1753,
-    1835,1731,1831,1769,1774,1816,1734,1826,1758,1800,1787,1777,1809,1774,1797,1788,
-    1774,1821,1762,1817,1765,1816,1783,1776,1826,1746,1838,1744,1813,1777,1773,1814,
-    1740,1816,1767,1781,1797,1758,1821,1759,1795,1797,1758,1826,1744,1823,1777,1781,
-    1831,1738,1858,1732,1832,1765,1773,1814,1738,1841,1751,1818,1779,1779,1800,1766,
-    1803,1778,1789,1816,1767,1824,1772,1813,1795,1769,1829,1742,1827,1776,1776,1835,
-    1735,1841,1745,1776,1821,1720,1849,1722,1813,1787,1737,1824,1714,1817,1760,1766,
-    1821,1742,1831,1761,1773,1804,1741,1812,1747,1781,1780,1758,1801,1753,1784,1781,
-    1775,1794,1772,1786,1791,1769,1800,1766,1801,1769,1787,1790,1766,1797,1761,1786,
-    1767,1783,1771,1771,1782,1778,1784,1786,1786,1792,1784,1797,1779,1791,1782,1779,
-    1780,1775,1787,1778,1798,1772,1798,1780,1797,1780,1782,1797,1769,1806,1772,1790,
-    1803,1762,1816,1774,1784,1816,1754,1818,1771,1788,1826,1743,1827,1757,1775,1811,
-    1707,1838,1733,1805,1799,1743,1856,1734,1821,1774,1771,1830,1749,1911,1847,1686,
-    1829,1877,1795,1740,1830,1783,1827,1861,1720,1757,1842,1790,1704,1759,1781,1741,
-    1742,1824,1798,1781,1803,1772,1786,1840,1788,1775,1808,1821,1790,1799,1815,1756,
-    1839,1793,1763,1798,1798,1795,1790,1782,1816,1779,1801,1813,1764,1802,1815,1778,
-    1765,1773,1789,1794,1759,1812,1747,1790,1766,1791,1792,1747,1840,1771,1727,1859,
-    1742,1759,1800,1717,1851,1733,1789,1817,1744,1779,1866,1700,1795,1817,1747,1787,
-    1781,1798,1733,1826,1796,1804,1743,1832,1766,1799,1772,1761,1763,1776,1788,1729,
-    1808,1776,1777,1751,1830,1756,1836,1801,1787,1971,1781,1760,1904,1797,1835,1755,
-    1717,1754,1621,1756,1716,1686,1777,1677,1787,1876,1798,1801,1838,1838,1781,1784,
-    1748,1734,1750,1679,1718,1752,1737,1781,1716,1846,1854,1760,1848,1768,1841,1858,
-    1779,1808,1813,1824,1805,1747,1803,1820,1781,1769,1771,1805,1831,1812,1752,1819,
-    1824,1816,1794,1795,1828,1801,1797,1761,1777,1801,1773,1755,1746,1772,1763,1748,
-    1733,1756,1778,1752,1740,1744,1783,1769,1732,1718,1736,1750,1727,1700,1726,1738,
-    1741,1694,1646,1672,1662,1626,1596,1575,1587,1620,1592,1581,1687,1738,1841,1912,
-    1985,2146,2196,2219,2289,2361,2306,2207,2136,2068,2004,1933,1777,1734,1602,1535,
-    1465,1393,1490,1469,1506,1510,1569,1675,1744,1829,1905,1952,2008,1999,2005,2030,
-    2029,1984,1910,1853,1792,1758,1690,1665,1602,1593,1571,1527,1581,1606,1711,1782,
-    1786,1850,1937,2026,2085,2080,2097,2100,2035,1975,1933,1899,1818,1725,1603,1579,
-    1557,1517,1515,1517,1566,1594,1639,1667,1753,1805,1811,1814,1815,1850,1827,1807,
-    1766,1720,1709,1638,1615,1610,1590,1581,1506,1532,1546,1482,1432,1383,1429,1379,
-    1307,1347,1438,1817,2320,2454,2145,2183,2951,3333,2932,2475,2466,2556,2190,1792,
-    1739,1798,1561,993,729,959,1270,1352,1181,1277,1664,1881,1898,2021,2400,2672,
-    2439,2163,2123,2247,2279,1939,1655,1497,1451,1272,1131,1245,1380,1424,1233,1296,
-    1611,1886,2040,1996,2075,2211,2226,2203,2187,2218,2133,1912,1699,1594,1629,1589,
-    1461,1386,1367,1433,1498,1593,1750,1851,1886,1915,1976,2106,2151,2113,2035,1979,
-    1946,1878,1815,1730,1703,1627,1567,1525,1556,1612,1624,1605,1641,1716,1738,1767,
-    1762,1757,1769,1767,1744,1764,1719,1689,1642,1652,1672,1638,1643,1600,1587,1546,
-    1524,1551,1521,1525,1469,1408,1412,1613,2303,2771,2324,1810,2467,3454,3252,2334,
-    2065,2356,2137,1482,1319,1659,1639,1085,630,867,1506,1801,1672,1555,1913,2364,
-    2380,2231,2428,2738,2492,1921,1652,1826,1883,1584,1187,1045,1140,1172,1187,1312,
-    1645,1844,1749,1759,2057,2437,2480,2259,2126,2109,2057,1862,1684,1573,1464,1295,
-    1092,1107,1331,1476,1476,1514,1722,1965,2085,2153,2304,2495,2435,2208,2126,2144,
-    2064,1786,1477,1375,1404,1395,1324,1376,1594,1755,1856,1913,2058,2202,2172,2062,
-    2024,2040,1903,1661,1476,1402,1381,1335,1270,1289,1366,1455,1493,1581,1738,1832,
-    1860,1847,1887,1913,1898,1841,1802,1741,1618,1494,1382,1371,1334,1221,1149,1565,
-    2530,2910,2167,1799,2956,3983,3285,2027,1968,2487,2067,1149,1074,1581,1530,841,
-    507,1036,1736,2017,1859,1848,2257,2666,2587,2297,2458,2693,2293,1535,1206,1398,
-    1409,1035,712,740,1016,1145,1292,1596,2002,2244,2148,2137,2396,2671,2587,2181,
-    1893,1749,1616,1455,1289,1240,1246,1236,1245,1393,1758,2075,2124,2093,2172,2376,
-    2470,2394,2287,2231,2089,1779,1573,1558,1566,1485,1255,1191,1432,1695,1860,1889,
-    2010,2152,2111,2003,1992,2053,1922,1622,1397,1379,1405,1366,1305,1302,1397,1528,
-    1638,1718,1849,1942,1945,1871,1844,1870,1892,1874,1840,1740,1604,1510,1531,1630,
-    1621,1529,1409,1382,1418,1423,1449,1543,1754,2261,2863,2927,2384,2427,3271,3544,
-    2620,1626,1617,1748,1233,755,979,1434,1232,789,999,1756,2423,2571,2508,2508,
-    2600,2632,2410,2173,2058,1814,1293,728,549,726,947,998,998,1183,1541,1948,
-    2293,2588,2783,2739,2462,2251,2187,2110,1805,1393,1117,943,897,990,1253,1506,
-    1679,1890,2139,2379,2534,2650,2656,2487,2221,2002,1809,1595,1408,1327,1252,1192,
-    1249,1434,1645,1764,1930,2094,2229,2222,2174,2152,2083,1971,1797,1594,1429,1338,
-    1336,1361,1422,1543,1587,1615,1668,1820,1941,1936,1876,1801,1734,1647,1604,1628,
-    1647,1618,1603,1635,1674,1707,1724,1734,1690,1668,1667,1619,1617,1586,1527,1397,
-    1324,1433,1630,1986,2587,3100,2806,2246,2649,3519,3334,2115,1350,1441,1382,906,
-    793,1215,1485,1251,1168,1603,2251,2704,2822,2652,2384,2317,2252,1920,1550,1393,
-    1218,832,459,546,972,1385,1605,1768,2007,2294,2571,2696,2687,2554,2321,1961,
-    1585,1313,1167,1100,1033,1005,1077,1328,1716,2016,2256,2546,2788,2769,2493,2301,
-    2207,2025,1706,1375,1168,1021,959,1035,1331,1739,2043,2083,2048,2162,2411,2524,
-    2327,2028,1768,1581,1398,1363,1514,1597,1490,1358,1424,1675,1887,1961,1882,1801,
-    1747,1694,1668,1709,1796,1768,1594,1494,1528,1638,1708,1707,1772,1756,1658,1590,
-    1719,1870,1906,1824,1738,1739,1762,1704,1597,1533,1396,1168,1073,1311,1827,2591,
-    3160,2993,2473,2664,3401,3359,2297,1439,1381,1276,720,448,914,1525,1622,1512,
-    1679,2098,2553,2887,2957,2681,2333,2008,1575,1182,1100,1190,1064,702,553,836,
-    1363,1879,2290,2547,2629,2615,2538,2420,2254,2110,1879,1451,953,702,804,1069,
-    1299,1480,1755,2074,2308,2438,2621,2810,2749,2380,1903,1597,1426,1263,1133,1052,
-    1074,1199,1431,1692,1969,2354,2659,2622,2357,2164,2116,1997,1723,1443,1304,1294,
-    1345,1433,1527,1659,1807,1902,1877,1813,1788,1787,1733,1666,1664,1664,1642,1623,
-    1663,1716,1690,1628,1525,1491,1521,1564,1654,1737,1850,1891,1908,1969,2073,2117,
-    1970,1757,1602,1507,1378,1205,1103,1090,1092,1193,1652,2659,3586,3426,2656,2708,
-    3559,3560,2250,1121,1020,1090,530,84,523,1363,1831,1868,1927,2195,2650,3068,
-    3078,2696,2329,2079,1557,870,585,777,969,857,751,991,1541,2083,2451,2660,
-    2793,2870,2684,2223,1787,1582,1455,1183,907,823,916,1147,1459,1831,2197,2545,
-    2768,2789,2650,2446,2223,1945,1633,1347,1128,974,913,1000,1263,1635,1947,2182,
-    2390,2520,2546,2451,2281,2097,1913,1642,1336,1120,1107,1280,1547,1714,1750,1796,
-    1891,1897,1816,1830,1894,1872,1744,1622,1604,1643,1698,1737,1690,1568,1404,1352,
-    1386,1478,1591,1737,1877,1980,2062,2113,2123,2121,2115,1964,1663,1422,1326,1291,
-    1222,1108,1104,1142,1204,1283,1637,2542,3641,3880,3080,2685,3293,3524,2351,975,
-    713,989,669,105,244,1111,1893,2222,2333,2466,2769,3110,3129,2706,2267,2071,
-    1704,976,377,288,557,730,894,1197,1682,2174,2544,2724,2764,2851,2858,2579,
-    2019,1519,1203,990,792,760,939,1232,1517,1746,2002,2333,2701,2934,2898,2653,
-    2314,1926,1541,1251,1108,1086,1121,1167,1198,1337,1660,2046,2374,2567,2612,2494,
-    2281,2059,1883,1673,1476,1321,1248,1269,1382,1543,1692,1867,1970,2016,1989,1956,
-    1872,1774,1718,1687,1683,1646,1614,1584,1491,1387,1349,1432,1563,1644,1704,1758,
-    1870,2046,2186,2200,2150,2082,1933,1700,1484,1352,1304,1239,1165,1138,1152,1168,
-    1268,1465,1812,2530,3519,3874,3286,2901,3297,3362,2202,990,718,839,540,147,
-    305,936,1662,2155,2390,2514,2812,3183,3199,2748,2344,2181,1774,1019,431,299,
-    340,482,737,1066,1501,2075,2614,2809,2837,2921,2972,2730,2233,1782,1406,1044,
-    696,502,589,920,1322,1618,1906,2303,2690,2927,3006,2949,2716,2329,1861,1388,
-    977,794,784,846,1009,1235,1493,1808,2187,2500,2688,2775,2760,2549,2191,1722,
-    1350,1132,998,1013,1181,1504,1677,1776,1878,1984,2076,2115,2121,1971,1797,1670,
-    1551,1434,1401,1485,1535,1480,1415,1426,1504,1601,1684,1805,1942,2074,2157,2124,
-    2044,1943,1843,1674,1465,1280,1159,1082,1008,939,977,1165,1635,2549,3485,3717,
-    3405,3478,3713,3176,2059,1378,1174,842,393,260,467,899,1442,1830,2034,2306,
-    2794,3103,3030,2836,2739,2526,1970,1313,790,501,471,529,559,684,1159,1737,
-    2055,2282,2667,3041,3117,2950,2623,2190,1787,1474,1077,660,535,702,913,1103,
-    1404,1839,2276,2613,2810,2941,3039,2929,2564,2073,1640,1272,977,781,697,808,
-    1058,1390,1743,2083,2393,2631,2674,2536,2342,2180,1982,1696,1453,1261,1180,1172,
-    1270,1413,1569,1780,1889,1933,1920,1938,1945,1863,1776,1718,1668,1579,1519,1508,
-    1490,1460,1429,1436,1476,1546,1708,1850,1923,1967,1968,1906,1754,1613,1487,1294,
-    1075,934,963,1181,1732,2451,2888,3121,3499,3887,3669,2941,2313,1802,1250,787,
-    584,574,754,1154,1477,1576,1670,1918,2202,2369,2513,2689,2816,2799,2582,2202,
-    1782,1404,1046,683,439,436,645,945,1268,1596,1926,2300,2593,2656,2619,2644,
-    2586,2345,2077,1876,1706,1484,1235,1009,841,781,863,1156,1587,2022,2405,2682,
-    2794,2722,2554,2372,2160,1956,1791,1637,1480,1345,1263,1203,1182,1256,1401,1569,
-    1748,1972,2206,2343,2363,2297,2145,1926,1684,1520,1375,1233,1224,1328,1479,1637,
-    1807,1929,1996,2045,2053,1996,1925,1883,1837,1736,1635,1546,1470,1428,1466,1573,
-    1685,1766,1828,1912,1967,1982,1948,1910,1866,1794,1675,1504,1381,1376,1424,1503,
-    1623,1775,1875,1918,2003,2100,2153,2192,2248,2254,2211,2180,2104,1962,1821,1724,
-    1700,1697,1728,1790,1873,1961,1994,1998,2000,2002,1968,1910,1851,1774,1675,1548,
-    1418,1306,1235,1259,1346,1475,1637,1772,1861,1921,1985,2016,1976,1916,1860,1803,
-    1685,1561,1514,1527,1579,1632,1715,1826,1956,2068,2104,2073,2026,1987,1941,1884,
-    1831,1806,1761,1689,1587,1532,1559,1605,1679,1787,1927,2029,2075,2078,2048,2005,
-    1911,1794,1666,1575,1558,1551,1538,1542,1604,1711,1787,1823,1860,1923,1960,1940,
-    1878,1801,1719,1626,1541,1491,1485,1498,1523,1595,1700,1762,1803,1867,1931,1953,
-    1942,1918,1906,1890,1850,1808,1765,1715,1635,1563,1551,1569,1603,1686,1801,1902,
-    1957,2003,2017,2008,2013,2011,1950,1815,1714,1652,1607,1594,1648,1736,1817,1873,
-    1891,1905,1948,2010,2081,2137,2138,2086,1991,1879,1739,1621,1571,1557,1558,1582,
-    1680,1771,1803,1835,1888,1937,1931,1899,1865,1813,1742,1700,1667,1614,1568,1563,
-    1584,1597,1630,1698,1799,1912,1992,2006,1966,1904,1825,1734,1668,1653,1658,1681,
-    1692,1684,1703,1735,1769,1795,1823,1881,1920,1938,1941,1935,1892,1805,1739,1710,
-    1722,1724,1739,1781,1829,1857,1838,1809,1806,1836,1855,1842,1813,1779,1752,1734,
-    1712,1678,1653,1675,1681,1660,1676,1715,1754,1782,1817,1836,1817,1803,1775,1736,
-    1711,1709,1720,1721,1713,1703,1693,1706,1733,1768,1819,1871,1922,1967,1997,1995,
-    1962,1903,1832,1757,1671,1612,1617,1640,1674,1715,1763,1813,1831,1843,1884,1942,
-    1992,2003,1980,1941,1869,1767,1658,1589,1579,1611,1668,1751,1822,1872,1917,1958,
-    1980,1982,2014,2031,1988,1901,1801,1722,1678,1661,1665,1684,1721,1756,1761,1751,
-    1780,1857,1911,1913,1885,1851,1823,1767,1685,1654,1686,1730,1758,1761,1755,1744,
-    1733,1734,1759,1802,1853,1891,1875,1836,1795,1765,1750,1761,1768,1760,1762,1784,
-    1799,1788,1785,1761,1737,1743,1757,1761,1755,1757,1745,1719,1691,1692,1714,1737,
-    1755,1763,1765,1754,1763,1769,1783,1796,1803,1797,1771,1743,1718,1694,1680,1667,
-    1662,1674,1707,1748,1770,1803,1826,1839,1848,1849,1855,1875,1877,1840,1797,1761,
-    1745,1749,1758,1776,1798,1859,1908,1955,2023,2075,2125,2125,2074,2007,1935,1849,
-    1764,1714,1671,1634,1623,1646,1716,1762,1797,1819,1839,1841,1814,1802,1795,1787,
-    1765,1711,1647,1596,1560,1552,1560,1600,1656,1722,1767,1792,1817,1820,1821,1827,
-    1830,1833,1832,1788,1740,1727,1729,1755,1793,1817,1826,1823,1818,1807,1796,1806,
-    1838,1864,1862,1856,1833,1814,1809,1807,1803,1803,1790,1770,1756,1733,1717,1719,
-    1740,1765,1789,1808,1838,1847,1828,1806,1790,1776,1760,1752,1742,1736,1735,1729,
-    1736,1759,1791,1811,1825,1817,1819,1817,1795,1776,1754,1753,1750,1744,1734,1746,
-    1761,1770,1784,1794,1811,1836,1828,1827,1818,1802,1768,1740,1741,1736,1744,1749,
-    1775,1785,1811,1838,1851,1864,1858,1861,1850,1814,1769,1751,1746,1724,1704,1684,
-    1697,1734,1750,1775,1808,1838,1837,1831,1839,1823,1797,1785,1777,1756,1738,1725,
-    1713,1719,1733,1746,1745,1760,1771,1780,1789,1804,1811,1789,1770,1779,1803,1806,
-    1812,1804,1795,1782,1775,1778,1780,1780,1782,1783,1775,1774,1801,1841,1862,1874,
-    1867,1871,1859,1845,1824,1796,1780,1753,1730,1710,1705,1730,1764,1783,1792,1797,
-    1797,1775,1756,1750,1776,1787,1773,1767,1763,1755,1745,1745,1742,1747,1773,1797,
-    1789,1793,1808,1817,1811,1800,1798,1791,1780,1766,1766,1785,1802,1832,1832,1834,
-    1850,1839,1836,1816,1808,1796,1783,1768,1754,1752,1756,1776,1776,1767,1776,1774,
-    1769,1778,1800,1824,1832,1833,1817,1794,1786,1774,1769,1783,1785,1788,1786,1784,
-    1765,1743,1744,1753,1773,1779,1785,1797,1805,1805,1796,1791,1786,1797,1795,1808,
-    1824,1801,1792,1790,1792,1780,1791,1802,1804,1807,1806,1800,1808,1794,1780,1782,
-    1785,1827,1807,1814,1833,1845,1852,1830,1809,1787,1781,1760,1727,1720,1729,1673,
-    1648,1662,1671,1690,1697,1712,1729,1753,1762,1775,1808,1849,1862,1856,1864,1844,
-    1832,1815,1783,1787,1801,1788,1773,1794,1808,1801,1801,1832,1862,1874,1865,1844,
-    1836,1808,1781,1761,1757,1762,1755,1763,1782,1783,1782,1771,1748,1739,1739,1731,
-    1730,1743,1763,1764,1749,1758,1776,1784,1772,1769,1767,1759,1760,1754,1759,1772,
-    1786,1807,1807,1794,1790,1776,1771,1776,1786,1779,1773,1784,1790,1789,1777,1781,
-    1787,1777,1776,1784,1785,1809,1812,1788,1786,1786,1784,1767,1771,1770,1756,1751,
-    1753,1784,1812,1805,1799,1797,1757,1715,1688,1674,1691,1739,1786,1825,1855,1912,
-    1986,2054,2125,2174,2186,2148,2061,1953,1845,1736,1648,1571,1525,1503,1496,1535,
-    1600,1653,1710,1751,1788,1821,1841,1851,1853,1849,1820,1789,1774,1775,1769,1767,
-    1754,1755,1768,1776,1775,1781,1791,1785,1782,1767,1757,1755,1748,1734,1737,1736,
-    1751,1775,1777,1780,1791,1784,1759,1733,1686,1655,1628,1585,1533,1481,1435,1397,
-    1351,1326,1375,1471,1641,1829,1994,2227,2503,2667,2747,2824,2820,2692,2498,2234,
-    1945,1723,1507,1300,1217,1232,1240,1285,1393,1499,1585,1672,1718,1754,1825,1856,
-    1872,1949,2045,2080,2110,2156,2140,2104,2038,1915,1813,1732,1607,1483,1441,1436,
-    1457,1505,1556,1619,1700,1764,1789,1831,1879,1883,1890,1921,1960,2010,2049,2059,
-    2052,2021,1950,1854,1758,1662,1563,1505,1461,1443,1468,1515,1569,1632,1709,1773,
-    1829,1865,1886,1912,1932,1902,1858,1818,1763,1715,1660,1606,1569,1546,1527,1527,
-    1529,1540,1547,1542,1507,1463,1415,1366,1350,1365,1472,1665,1861,2067,2402,2717,
-    2880,2988,3040,2936,2730,2454,2093,1783,1549,1292,1124,1134,1176,1203,1295,1426,
-    1503,1579,1631,1619,1688,1815,1871,1956,2117,2218,2255,2305,2269,2166,2063,1914,
-    1729,1610,1510,1406,1395,1443,1493,1558,1639,1673,1716,1753,1729,1742,1809,1840,
-    1863,1947,2033,2084,2134,2144,2111,2063,1971,1831,1710,1606,1517,1467,1463,1494,
-    1531,1584,1626,1670,1732,1786,1832,1887,1946,1979,1991,1994,1967,1912,1855,1758,
-    1667,1620,1555,1499,1469,1467,1483,1479,1514,1547,1530,1526,1472,1424,1384,1370,
-    1391,1483,1704,1915,2102,2401,2733,2888,2926,2905,2799,2564,2287,1963,1662,1527,
-    1396,1247,1256,1342,1374,1385,1445,1504,1529,1594,1635,1724,1947,2095,2181,2328,
-    2413,2375,2270,2119,1911,1733,1569,1392,1337,1397,1436,1482,1579,1648,1694,1713,
-    1711,1737,1814,1877,1925,2032,2132,2177,2190,2166,2107,2051,1942,1778,1655,1580,
-    1505,1457,1445,1450,1479,1508,1510,1533,1586,1626,1676,1754,1848,1917,1975,1998,
-    1990,1969,1912,1834,1757,1703,1659,1633,1599,1574,1564,1556,1548,1536,1535,1539,
-    1536,1526,1509,1497,1478,1454,1450,1487,1682,1955,2141,2339,2683,2931,2910,2832,
-    2712,2478,2185,1856,1544,1413,1390,1292,1246,1346,1394,1346,1342,1358,1389,1529,
-    1679,1808,2073,2349,2438,2446,2452,2332,2145,1960,1739,1597,1576,1525,1483,1553,
-    1617,1599,1567,1566,1565,1601,1684,1785,1940,2114,2223,2280,2289,2221,2107,1988,
-    1867,1761,1689,1628,1571,1544,1530,1496,1482,1459,1438,1460,1504,1559,1617,1693,
-    1765,1815,1850,1863,1861,1853,1854,1855,1852,1838,1800,1749,1702,1667,1625,1587,
-    1561,1553,1542,1525,1499,1484,1472,1462,1446,1447,1498,1589,1733,1973,2272,2477,
-    2616,2805,2911,2800,2609,2425,2211,1990,1784,1593,1500,1495,1461,1382,1366,1377,
-    1343,1331,1388,1499,1678,1862,1970,2064,2178,2212,2136,2061,1994,1932,1886,1836,
-    1787,1790,1783,1707,1645,1614,1582,1560,1561,1594,1676,1778,1863,1921,1993,2060,
-    2075,2064,2044,2024,1990,1927,1844,1772,1707,1624,1546,1491,1468,1458,1445,1455,
-    1476,1503,1544,1576,1612,1666,1722,1762,1801,1843,1874,1884,1869,1833,1807,1757,
-    1676,1615,1579,1552,1535,1536,1536,1544,1558,1561,1558,1562,1591,1647,1702,1791,
-    1933,2132,2359,2484,2505,2504,2466,2349,2179,2015,1890,1800,1728,1676,1642,1649,
-    1659,1622,1592,1595,1603,1614,1657,1726,1798,1868,1901,1887,1891,1902,1888,1874,
-    1886,1884,1873,1847,1820,1822,1794,1753,1733,1749,1758,1764,1779,1789,1800,1807,
-    1814,1828,1849,1887,1930,1953,1960,1956,1929,1865,1789,1724,1676,1623,1588,1572,
-    1571,1565,1554,1542,1546,1553,1551,1582,1627,1665,1700,1741,1786,1820,1852,1871,
-    1875,1867,1832,1786,1738,1707,1660,1649,1644,1648,1665,1702,1736,1713,1729,1752,
-    1772,1756,1774,1815,1864,1898,1884,1857,1860,1879,1872,1854,1840,1878,1894,1905,
-    1911,1924,1945,1943,1941,1926,1915,1912,1906,1886,1859,1836,1823,1789,1768,1785,
-    1807,1816,1829,1844,1840,1823,1806,1801,1806,1809,1817,1811,1807,1817,1791,1773,
-    1770,1765,1738,1734,1741,1752,1767,1795,1817,1827,1838,1810,1799,1789,1781,1766,
-    1758,1767,1770,1764,1732,1702,1668,1660,1643,1614,1614,1596,1597,1614,1615,1633,
-    1718,1771,1796,1858,1877,1859,1852,1802,1770,1754,1750,1718,1725,1778,1766,1755,
-    1727,1762,1779,1789,1771,1779,1842,1868,1858,1853,1853,1870,1884,1854,1801,1801,
-    1809,1772,1757,1691,1686,1721,1727,1685,1690,1770,1777,1786,1774,1772,1809,1837,
-    1786,1776,1842,1832,1849,1879,1893,1863,1905,1931,1855,1872,1907,1833,1812,1853,
-    1858,1802,1825,1865,1864,1838,1816,1826,1803,1815,1808,1793,1816,1845,1837,1796,
-    1784,1843,1762,1724,1739,1739,1717,1696,1767,1738,1742,1737,1691,1636,1658,1681,
-    1615,1646,1709,1712,1680,1775,1810,1756,1811,1825,1792,1785,1830,1798,1741,1818,
-    1836,1746,1748,1786,1787,1780,1732,1731,1752,1810,1744,1720,1816,1877,1814,1755,
-    1877,1867,1865,1803,1802,1865,1790,1741,1696,1771,1773,1709,1713,1708,1822,1779,
-    1791,1808,1759,1779,1832,1820,1699,1763,1849,1822,1796,1805,1848,1833,1845,1820,
-    1690,1812,1853,1739,1743,1853,1858,1832,1813,1812,1864,1868,1757,1773,1856,1824,
-    1759,1769,1835,1825,1800,1713,1737,1783,1839,1730,1671,1832,1898,1736,1665,1854,
-    1898,1720,1744,1828,1798,1790,1755,1722,1777,1840,1780,1707,1775,1917,1801,1702,
-    1782,1856,1811,1695,1724,1811,1819,1710,1658,1795,1807,1740,1696,1746,1860,1903,
-    1733,1770,1854,1910,1819,1718,1802,1823,1880,1724,1760,1808,1853,1752,1754,1739,
-    1829,1914,1779,1739,1814,1931,1725,1784,1804,1749,1788,1807,1729,1671,1807,1819,
-    1711,1634,1746,1781,1780,1735,1704,1808,1897,1818,1724,1834,1920,1836,1742,1749,
-    1828,1828,1736,1756,1828,1801,1809,1805,1723,1786,1805,1730,1715,1783,1763,1775,
-    1742,1775,1809,1802,1776,1769,1821,1808,1778,1824,1773,1738,1796,1763,1752,1766,
-    1847,1799,1830,1812,1786,1810,1826,1823,1765,1740,1843,1823,1760,1769,1746,1856,
-    1870,1651,1724,1810,1849,1820,1658,1790,1909,1756,1685,1792,1816,1825,1761,1792,
-    1709,1799,1829,1724,1743,1812,1798,1772,1799,1831,1770,1783,1902,1777,1757,1839,
-    1851,1825,1790,1771,1812,1744,1866,1737,1705,1898,1821,1756,1718,1826,1843,1728,
-    1744,1823,1722,1780,1755,1707,1800,1864,1701,1733,1815,1763,1790,1774,1803,1701,
-    1806,1781,1818,1754,1744,1743,1826,1781,1683,1715,1918,1903,1662,1744,1826,1900,
-    1793,1752,1782,1957,1773,1730,1735,1914,1774,1723,1755,1771,1803,1755,1837,1746,
-    1791,1877,1765,1697,1904,1788,1844,1732,1848,1743,1802,1870,1678,1774,1846,1830,
-    1723,1711,1844,1832,1771,1735,1796,1805,1882,1790,1681,1871,1754,1817,1717,1789,
-    1867,1815,1796,1806,1823,1845,1694,1843,1882,1754,1680,1764,1927,1762,1736,1798,
-    1768,1899,1755,1662,1876,1789,1831,1625,1836,1814,1826,1800,1689,1866,1804,1759,
-    1701,1806,1831,1756,1718,1755,1782,1813,1733,1752,1705,1883,1801,1653,1810,1860,
-    1791,1675,1826,1789,1816,1846,1773,1817,1899,1785,1754,1837,1853,1798,1677,1751,
-    1800,1766,1759,1741,1736,1835,1761,1719,1837,1826,1760,1760,1853,1787,1735,1820,
-    1890,1707,1723,1775,1798,1722,1777,1705,1681,1844,1791,1716,1744,1892,1776,1735,
-    1723,1918,1739,1764,1782,1871,1780,1843,1755,1837,1917,1803,1745,1752,1945,1755,
-    1758,1760,1893,1749,1785,1731,1822,1808,1823,1670,1823,1809,1792,1793,1786,1811,
-    1780,1835,1757,1773,1789,1882,1718,1762,1812,1802,1750,1776,1748,1720,1760,1857,
-    1649,1748,1829,1842,1711,1746,1841,1774,1794,1818,1754,1744,1835,1796,1811,1743,
-    1769,1786,1787,1773,1780,1818,1838,1770,1772,1812,1833,1705,1779,1807,1776,1731,
-    1802,1760,1860,1822,1741,1798,1854,1763,1813,1780,1774,1829,1770,1817,1624,1925,
-    1820,1693,1704,1794,1843,1707,1646,1884,1715,1804,1799,1768,1803,1829,1911,1669,
-    1808,1892,1804,1657,1840,1823,1833,1635,1858,1790,1692,1789,1781,1815,1705,1752,
-    1841,1724,1759,1875,1695,1797,1804,1885,1622,1868,1875,1760,1735,1797,1899,1770,
-    1745,1790,1809,1809,1848,1657,1872,1739,1802,1793,1711,1752,1881,1837,1699,1744,
-    1976,1780,1697,1802,1843,1816,1757,1800,1760,1827,1784,1747,1672,1898,1843,1668,
-    1630,1956,1831,1724,1647,1876,1848,1757,1766,1751,1767,1880,1870,1583,1795,1935,
-    1883,1572,1812,1949,1789,1633,1820,1830,1710,1759,1814,1775,1728,1792,1851,1743,
-    1735,1806,1814,1742,1786,1819,1816,1722,1907,1845,1625,1807,1857,1863,1606,1791,
-    1889,1686,1741,1869,1687,1759,1816,1853,1688,1740,1839,1863,1614,1867,1841,1712,
-    1831,1890,1759,1652,1914,1833,1748,1620,1993,1729,1703,1778,1885,1625,1817,1812,
-    1785,1636,1851,1945,1692,1814,1733,1891,1761,1790,1805,1827,1694,1872,1769,1818,
-    1650,1868,1874,1742,1696,1899,1841,1693,1880,1797,1764,1656,2008,1786,1605,1784,
-    1959,1704,1684,1779,1918,1756,1722,1828,1791,1809,1762,1868,1728,1810,1826,1845,
-    1747,1751,1865,1827,1666,1777,1766,1845,1710,1744,1836,1841,1763,1770,1883,1770,
-    1810,1748,1854,1693,1788,1756,1802,1683,1745,1819,1764,1694,1749,1827,1778,1762,
-    1738,1889,1763,1804,1774,1851,1761,1794,1860,1801,1721,1799,1889,1746,1686,1842,
-    1855,1734,1726,1785,1818,1778,1798,1696,1846,1827,1758,1761,1807,1832,1773,1725,
-    1802,1768,1785,1809,1703,1767,1814,1832,1708,1720,1851,1848,1733,1732,1805,1862,
-    1743,1705,1785,1814,1761,1773,1786,1773,1830,1796,1796,1773,1808,1827,1782,1783,
-    1826,1815,1729,1779,1826,1779,1738,1808,1789,1736,1779,1795,1770,1773,1819,1789,
-    1776,1826,1856,1791,1778,1800,1830,1757,1768,1797,1784,1777,1726,1764,1808,1753,
-    1741,1784,1784,1768,1742,1804,1755,1759,1795,1790,1746,1787,1817,1791,1757,1773,
-    1808,1773,1752,1767,1799,1765,1776,1755,1797,1770,1799,1766,1778,1785,1781,1795,
-    1774,1793,1753,1788,1777,1785,1794,1799,1793,1818,1790,1812,1833,1814,1810,1801,
-    1812,1799,1803,1777,1786,1814,1805,1792,1791,1813,1811,1809,1770,1786,1846,1812,
-    1797,1775,1825,1839,1759,1764,1825,1814,1758,1762,1779,1767,1749,1763,1763,1761,
-    1791,1785,1753,1804,1777,1763,1766,1781,1784,1771,1794,1767,1811,1790,1792,1787,
-    1813,1801,1795,1809,1786,1790,1776,1799,1778,1777,1784,1816,1796,1800,1793,1808,
-    1791,1799,1789,1796,1803,1787,1785,1785,1799,1772,1800,1799,1781,1767,1825,1758,
-    1773,1772,1785,1763,1745,1782,1758,1770,1757,1778,1770,1799,1797,1796,1794,1807,
-    1816,1813,1801,1817,1818,1803,1785,1787,1795,1773,1800,1765,1782,1802,1778,1789,
-    1799,1796,1782,1793,1793,1785,1793,1792,1790,1798,1794,1790,1773,1800,1798,1761,
-    1778,1788,1789,1759,1747,1788,1771,1767,1772,1766,1777,1786,1779,1761,1787,1804,
-    1782,1777,1796,1803,1792,1792,1788,1791,1789,1781,1780,1767,1776,1777,1785,1774,
-    1797,1797,1798,1796,1807,1830,1800,1797,1806,1809,1786,1783,1786,1815,1792,1790,
-    1791,1792,1773,1785,1795,1770,1796,1790,1789,1772,1787,1781,1771,1780,1785,1755,
-    1770,1771,1772,1768,1760,1788,1792,1787,1787,1780,1796,1781,1760,1775,1769,1773,
-    1762,1779,1759,1785,1778,1780,1767,1791,1781,1772,1779,1790,1801,1757,1786,1781,
-    1793,1778,1801,1797,1808,1799,1790,1792,1802,1805,1804,1777,1788,1823,1778,1785,
-    1788,1810,1800,1782,1791,1789,1785,1781,1778,1790,1776,1792,1776,1762,1781,1784,
-    1762,1769,1784,1778,1774,1799,1808,1785,1812,1785,1801,1805,1785,1804,1811,1799,
-    1777,1787,1794,1766,1780,1788,1778,1784,1788,1788,1781,1773,1780,1770,1781,1784,
-    1758,1788,1780,1782,1758,1789,1812,1790,1785,1805,1818,1803,1790,1794,1815,1797,
-    1794,1798,1810,1797,1778,1784,1798,1778,1775,1780,1794,1778,1768,1770,1780,1763,
-    1763,1770,1767,1788,1767,1780,1776,1794,1788,1786,1796,1786,1787,1777,1771,1780,
-    1767,1774,1783,1786,1798,1782,1796,1788,1794,1779,1768,1792,1787,1793,1786,1795,
-    1778,1780,1790,1770,1767,1766,1782,1777,1770,1773,1786,1783,1770,1770,1789,1787,
-    1791,1794,1789,1817,1809,1783,1798,1805,1796,1792,1783,1804,1791,1800,1792,1789,
-    1801,1787,1795,1785,1770,1778,1778,1759,1756,1764,1775,1778,1768,1773,1792,1785,
-    1777,1787,1804,1794,1772,1769,1786,1787,1768,1772,1791,1789,1773,1780,1774,1784,
-    1787,1776,1774,1777,1796,1782,1769,1797,1790,1776,1779,1791,1808,1772,1775,1793,
-    1796,1773,1776,1791,1792,1803,1797,1814,1821,1819,1794,1795,1796,1794,1791,1792,
-    1811,1787,1785,1796,1785,1784,1776,1801,1790,1783,1788,1785,1798,1785,1786,1787,
-    1792,1794,1781,1780,1783,1781,1779,1766,1765,1770,1771,1764,1765,1770,1779,1789,
-    1783,1794,1785,1791,1793,1785,1776,1787,1792,1778,1806,1794,1806,1779,1795,1815,
-    1778,1813,1787,1809,1803,1741,1796,1816,1772,1741,1780,1825,1794,1765,1775,1807,
-    1817,1814,1761,1791,1835,1790,1797,1768,1810,1827,1768,1771,1779,1808,1790,1774,
-    1787,1800,1803,1796,1770,1778,1799,1787,1757,1769,1804,1785,1783,1743,1788,1784,
-    1793,1768,1754,1823,1776,1775,1752,1826,1814,1718,1786,1820,1804,1776,1764,1835,
-    1795,1774,1763,1763,1830,1784,1780,1762,1785,1814,1766,1791,1776,1744,1812,1801,
-    1754,1736,1812,1760,1706,1757,1764,1774,1725,1772,1752,1758,1773,1761,1786,1750,
-    1767,1819,1755,1774,1787,1803,1811,1739,1785,1820,1812,1757,1804,1811,1823,1799,
-    1788,1849,1769,1816,1864,1802,1775,1778,1875,1791,1731,1791,1823,1860,1713,1773,
-    1844,1806,1781,1723,1829,1799,1755,1775,1812,1796,1779,1805,1786,1807,1724,1793,
-    1826,1775,1721,1780,1856,1792,1719,1768,1849,1763,1745,1790,1841,1733,1743,1842,
-    1777,1706,1767,1863,1768,1668,1794,1865,1836,1741,1709,1847,1855,1797,1723,1772,
-    1836,1843,1817,1732,1772,1836,1900,1784,1651,1835,1860,1798,1704,1738,1861,1826,
-    1784,1692,1755,1831,1871,1736,1701,1818,1844,1879,1716,1713,1881,1910,1728,1578,
-    1899,1940,1705,1629,1796,1887,1730,1792,1788,1811,1775,1787,1801,1767,1843,1843,
-    1715,1782,1826,1896,1838,1718,1802,1788,1855,1672,1720,1836,1794,1691,1641,1882,
-    1908,1737,1664,1811,1884,1815,1712,1757,1823,1797,1793,1716,1782,1713,1850,1804,
-    1732,1745,1767,1927,1739,1713,1690,1954,1848,1671,1692,1754,1948,1756,1689,1633,
-    1838,1918,1703,1686,1773,1935,1806,1737,1802,1810,1872,1821,1735,1782,1838,1829,
-    1731,1751,1839,1812,1783,1783,1835,1748,1815,1806,1780,1747,1772,1836,1728,1776,
-    1772,1789,1765,1824,1783,1702,1797,1836,1857,1740,1795,1803,1800,1801,1752,1872,
-    1783,1752,1769,1789,1855,1723,1747,1781,1776,1857,1706,1756,1839,1868,1769,1756,
-    1826,1767,1863,1832,1755,1679,1793,1858,1789,1669,1742,1829,1792,1770,1695,1824,
-    1861,1772,1753,1787,1788,1798,1828,1777,1716,1807,1823,1765,1769,1775,1792,1791,
-    1846,1758,1720,1827,1841,1783,1770,1774,1766,1841,1771,1740,1806,1819,1817,1734,
-    1771,1822,1851,1781,1741,1805,1821,1795,1735,1801,1805,1761,1757,1781,1771,1777,
-    1791,1750,1748,1770,1811,1799,1775,1776,1777,1803,1802,1790,1768,1757,1809,1780,
-    1744,1739,1806,1815,1770,1764,1765,1796,1790,1791,1757,1809,1793,1796,1778,1783,
-    1827,1821,1818,1792,1830,1831,1869,1841,1863,1872,1875,1852,1827,1823,1860,1839,
-    1783,1789,1791,1811,1773,1773,1737,1762,1739,1750,1732,1723,1774,1762,1761,1751,
-    1747,1784,1777,1790,1759,1744,1754,1746,1766,1708,1725,1715,1748,1728,1714,1722,
-    1738,1734,1703,1701,1722,1753,1724,1693,1722,1701,1680,1681,1624,1619,1572,1584,
-    1590,1578,1544,1584,1641,1740,1964,2120,2057,1977,2213,2515,2456,2268,2280,2256,
-    2161,2134,2087,1895,1809,1809,1640,1406,1391,1500,1476,1438,1439,1386,1398,1550,
-    1673,1685,1734,1862,1890,1865,1914,2014,2052,2077,2070,1959,1858,1897,1944,1877,
-    1766,1699,1678,1628,1588,1551,1579,1620,1647,1616,1621,1725,1849,1935,1929,1947,
-    1983,2028,2019,2003,1999,1998,1937,1831,1749,1707,1697,1666,1619,1568,1565,1559,
-    1603,1647,1668,1707,1759,1791,1792,1845,1889,1885,1837,1815,1790,1737,1721,1713,
-    1666,1621,1601,1562,1535,1560,1541,1496,1467,1463,1450,1422,1408,1402,1426,1505,
-    1599,1727,2126,2546,2497,2254,2572,3062,2974,2592,2520,2466,2185,2078,1956,1572,
-    1375,1507,1348,924,852,1117,1264,1369,1555,1635,1636,1919,2203,2216,2239,2397,
-    2456,2301,2143,2024,1929,1896,1863,1630,1393,1341,1383,1318,1261,1325,1418,1511,
-    1577,1634,1697,1859,2046,2148,2128,2111,2133,2124,2103,2014,1926,1845,1752,1636,
-    1511,1440,1444,1490,1504,1534,1576,1664,1775,1861,1909,1985,2078,2107,2099,2082,
-    2070,2015,1968,1906,1794,1681,1622,1593,1520,1480,1520,1571,1586,1592,1634,1661,
-    1707,1764,1812,1798,1779,1773,1749,1728,1715,1700,1680,1664,1602,1544,1482,1436,
-    1401,1418,1427,1370,1302,1357,1589,2077,2655,2716,2349,2516,3109,3151,2637,2399,
-    2371,2055,1774,1584,1246,1004,1255,1355,1031,896,1177,1463,1688,2016,2220,2291,
-    2449,2577,2444,2277,2317,2377,2140,1783,1477,1276,1177,1137,1105,1091,1186,1368,
-    1487,1518,1613,1884,2167,2278,2254,2246,2228,2121,2001,1846,1698,1622,1576,1438,
-    1280,1226,1291,1396,1546,1680,1775,1908,2029,2085,2122,2209,2297,2332,2289,2125,
-    1905,1787,1759,1688,1566,1510,1522,1555,1583,1624,1677,1803,1947,2014,2035,2045,
-    2030,1963,1885,1792,1684,1597,1519,1415,1339,1334,1371,1400,1445,1525,1602,1684,
-    1801,1888,1914,1936,1986,1986,1922,1855,1787,1700,1602,1503,1405,1375,1367,1378,
-    1393,1403,1481,1614,1989,2591,2872,2607,2531,2946,3060,2535,2065,2012,1872,1585,
-    1329,1064,919,1130,1381,1317,1285,1562,1922,2162,2305,2374,2453,2551,2488,2157,
-    1797,1616,1531,1362,1125,956,955,1049,1138,1218,1401,1734,2086,2324,2380,2355,
-    2361,2390,2318,2133,1950,1835,1697,1489,1285,1218,1271,1375,1505,1639,1754,1890,
-    2074,2199,2228,2260,2300,2257,2113,1951,1787,1608,1506,1471,1468,1481,1546,1603,
-    1665,1731,1817,1947,2067,2124,2081,2011,1915,1804,1690,1594,1549,1560,1597,1583,
-    1543,1571,1647,1717,1777,1830,1864,1862,1855,1852,1801,1714,1655,1678,1708,1687,
-    1644,1637,1642,1682,1743,1749,1739,1784,1857,1808,1701,1635,1620,1637,1671,1661,
-    1618,1649,1700,1699,1688,1755,1870,2120,2552,2773,2575,2442,2628,2626,2162,1716,
-    1568,1459,1299,1160,1067,1110,1356,1600,1650,1707,1924,2189,2297,2258,2195,2174,
-    2128,1921,1654,1439,1352,1332,1299,1250,1290,1498,1723,1858,1940,2049,2199,2324,
-    2338,2210,2084,2028,1922,1728,1544,1474,1453,1450,1471,1492,1564,1712,1861,1952,
-    2026,2097,2111,2082,2004,1895,1762,1635,1539,1476,1468,1475,1496,1568,1696,1798,
-    1895,2043,2158,2188,2176,2108,2001,1888,1796,1675,1564,1520,1495,1484,1524,1592,
-    1636,1689,1758,1811,1836,1853,1862,1845,1804,1728,1663,1666,1672,1664,1655,1675,
-    1702,1756,1791,1785,1791,1822,1837,1811,1785,1742,1724,1744,1758,1741,1750,1814,
-    1857,1837,1798,1760,1750,1747,1713,1651,1641,1665,1666,1651,1616,1657,1860,2178,
-    2350,2292,2274,2391,2377,2107,1796,1614,1524,1447,1378,1343,1403,1597,1776,1801,
-    1789,1883,2039,2113,2109,2118,2124,2072,1927,1720,1550,1471,1474,1493,1512,1570,
-    1676,1782,1849,1887,1922,2002,2090,2100,2035,1980,1911,1770,1611,1527,1497,1487,
-    1545,1621,1676,1729,1801,1846,1884,1952,2012,2034,1994,1925,1839,1779,1739,1688,
-    1658,1675,1699,1753,1823,1841,1815,1834,1876,1854,1806,1782,1780,1759,1757,1751,
-    1765,1790,1768,1723,1702,1708,1684,1676,1686,1696,1715,1728,1703,1674,1700,1728,
-    1713,1705,1732,1751,1755,1752,1718,1701,1731,1761,1740,1723,1772,1829,1855,1862,
-    1875,1883,1903,1899,1857,1796,1759,1742,1713,1662,1623,1637,1676,1708,1719,1723,
-    1711,1667,1604,1544,1555,1794,2226,2468,2380,2389,2536,2481,2177,1848,1614,1518,
-    1500,1370,1273,1460,1713,1778,1810,1884,1945,2043,2114,2057,2010,2054,1986,1792,
-    1636,1527,1464,1468,1462,1441,1545,1712,1772,1788,1848,1909,1976,2019,1992,1945,
-    1940,1890,1770,1647,1570,1540,1558,1576,1599,1691,1800,1858,1866,1906,1959,2001,
-    2005,1962,1898,1890,1872,1787,1733,1732,1707,1654,1655,1654,1661,1702,1739,1732,
-    1727,1762,1789,1818,1864,1908,1923,1905,1844,1759,1687,1626,1584,1562,1554,1539,
-    1563,1615,1646,1689,1753,1809,1838,1867,1867,1862,1874,1878,1839,1786,1756,1741,
-    1741,1735,1740,1758,1812,1867,1903,1902,1892,1881,1870,1864,1851,1839,1827,1806,
-    1771,1746,1729,1708,1670,1657,1655,1638,1613,1601,1619,1663,1725,1753,1754,1828,
-    1981,2075,2128,2188,2175,2112,2011,1868,1729,1626,1551,1503,1553,1654,1756,1883,
-    1978,2007,2026,2007,1933,1863,1828,1768,1707,1696,1673,1656,1687,1713,1723,1791,
-    1859,1872,1864,1862,1850,1826,1818,1823,1841,1844,1824,1779,1740,1737,1748,1763,
-    1791,1817,1815,1791,1766,1719,1688,1718,1728,1724,1758,1823,1856,1836,1826,1793,
-    1759,1754,1754,1741,1720,1716,1698,1651,1631,1646,1678,1720,1749,1778,1806,1811,
-    1780,1754,1761,1760,1756,1749,1737,1752,1790,1839,1851,1848,1830,1770,1712,1691,
-    1712,1742,1790,1837,1853,1852,1838,1824,1826,1839,1832,1838,1849,1837,1819,1794,
-    1772,1764,1781,1792,1800,1816,1797,1736,1706,1733,1765,1800,1838,1852,1853,1825,
-    1773,1718,1699,1734,1753,1748,1728,1726,1722,1717,1721,1722,1757,1813,1851,1873,
-    1893,1890,1880,1866,1838,1827,1840,1843,1805,1753,1721,1721,1732,1749,1781,1840,
-    1916,1941,1930,1887,1827,1805,1812,1813,1805,1810,1813,1794,1758,1722,1705,1749,
-    1819,1829,1816,1837,1842,1818,1777,1763,1760,1744,1731,1700,1699,1721,1742,1758,
-    1791,1822,1843,1855,1843,1818,1815,1808,1772,1746,1736,1738,1748,1771,1785,1779,
-    1766,1773,1783,1773,1768,1776,1785,1780,1776,1784,1788,1779,1761,1747,1733,1726,
-    1715,1732,1739,1759,1779,1774,1783,1782,1822,1825,1798,1808,1791,1768,1775,1761,
-    1776,1774,1781,1787,1771,1791,1784,1799,1811,1815,1840,1847,1847,1837,1817,1804,
-    1791,1813,1812,1789,1778,1762,1752,1769,1779,1775,1792,1805,1797,1772,1753,1748,
-    1746,1736,1744,1771,1779,1775,1801,1804,1777,1781,1785,1793,1797,1778,1773,1782,
-    1794,1781,1780,1801,1820,1824,1813,1818,1825,1807,1781,1757,1753,1798,1839,1855,
-    1868,1905,1889,1851,1831,1808,1773,1730,1696,1668,1669,1672,1705,1778,1815,1818,
-    1840,1859,1868,1848,1808,1800,1786,1766,1723,1699,1714,1742,1771,1788,1814,1832,
-    1832,1812,1802,1787,1770,1774,1781,1780,1770,1772,1772,1767,1769,1778,1770,1754,
-    1771,1749,1733,1740,1733,1745,1778,1782,1799,1791,1781,1780,1781,1798,1782,1811,
-    1782,1797,1788,1758,1751,1745,1768,1770,1776,1809,1827,1818,1798,1786,1790,1761,
-    1752,1751,1771,1774,1764,1775,1797,1783,1814,1818,1831,1829,1844,1851,1838,1812,
-    1773,1794,1780,1798,1779,1805,1808,1829,1829,1803,1793,1801,1788,1785,1763,1752,
-    1768,1767,1783,1740,1767,1765,1792,1797,1808,1793,1804,1815,1824,1838,1816,1821,
-    1802,1782,1767,1769,1763,1799,1786,1821,1780,1781,1808,1768,1764,1756,1796,1796,
-    1794,1795,1807,1797,1809,1791,1758,1797,1779,1770,1769,1785,1777,1773,1782,1749,
-    1749,1730,1745,1759,1776,1790,1796,1824,1794,1785,1826,1813,1831,1793,1818,1820,
-    1775,1796,1759,1787,1798,1805,1785,1792,1763,1775,1777,1749,1774,1773,1790,1805,
-    1815,1828,1830,1824,1819,1784,1798,1762,1745,1760,1718,1708,1743,1727,1747,1756,
-    1771,1805,1774,1808,1808,1804,1832,1780,1779,1767,1751,1765,1730,1741,1743,1748,
-    1751,1749,1778,1780,1788,1828,1790,1786,1791,1807,1784,1800,1809,1796,1823,1754,
-    1763,1782,1752,1738,1777,1786,1774,1810,1774,1813,1770,1773,1809,1771,1843,1812,
-    1823,1805,1786,1796,1796,1767,1815,1781,1821,1805,1773,1812,1782,1815,1741,1817,
-    1773,1838,1787,1778,1842,1781,1813,1796,1814,1790,1819,1766,1793,1802,1778,1790,
-    1748,1800,1799,1765,1788,1757,1786,1767,1751,1791,1761,1782,1807,1763,1809,1823,
-    1760,1822,1748,1815,1812,1751,1825,1778,1789,1793,1785,1798,1773,1784,1789,1740,
-    1809,1767,1775,1793,1768,1806,1784,1766,1822,1802,1800,1840,1797,1811,1813,1827,
-    1768,1799,1766,1742,1772,1696,1768,1768,1759,1810,1799,1847,1830,1843,1857,1810,
-    1836,1828,1795,1794,1776,1751,1777,1722,1758,1790,1738,1848,1779,1798,1829,1779,
-    1804,1782,1804,1778,1761,1831,1763,1783,1804,1720,1827,1715,1764,1777,1758,1795,
-    1760,1766,1781,1773,1814,1788,1789,1837,1785,1829,1753,1809,1760,1771,1783,1753,
-    1766,1776,1745,1742,1782,1736,1830,1774,1817,1800,1777,1822,1751,1804,1762,1792,
-    1741,1759,1773,1745,1800,1749,1778,1809,1769,1811,1820,1783,1818,1765,1817,1752,
-    1801,1780,1777,1791,1727,1797,1713,1770,1774,1756,1815,1733,1816,1772,1783,1831,
-    1729,1859,1736,1801,1796,1749,1837,1747,1789,1808,1736,1817,1775,1759,1795,1758,
-    1801,1778,1760,1780,1794,1750,1833,1751,1855,1760,1805,1805,1745,1820,1744,1790,
-    1766,1790,1773,1793,1764,1810,1768,1821,1738,1837,1784,1780,1833,1754,1842,1756,
-    1818,1791,1770,1822,1784,1792,1775,1793,1790,1758,1787,1757,1780,1764,1820,1743,
-    1821,1781,1783,1802,1778,1788,1773,1816,1781,1769,1804,1795,1753,1816,1759,1796,
-    1787,1784,1795,1796,1785,1796,1748,1847,1768,1801,1827,1745,1844,1784,1796,1827,
-    1781,1837,1808,1747,1849,1701,1785,1805,1669,1853,1744,1768,1865,1724,1862,1787,
-    1804,1821,1768,1801,1818,1748,1818,1774,1751,1828,1716,1818,1772,1760,1826,1782,
-    1788,1833,1741,1817,1782,1804,1787,1799,1770,1784,1773,1769,1794,1693,1845,1704,
-    1780,1749,1746,1792,1731,1812,1753,1803,1816,1769,1802,1805,1787,1784,1789,1781,
-    1752,1802,1758,1742,1803,1743,1769,1788,1787,1772,1782,1810,1779,1828,1796,1822,
-    1793,1815,1805,1759,1801,1759,1782,1768,1787,1758,1793,1775,1771,1831,1779,1832,
-    1824,1799,1790,1806,1821,1738,1800,1806,1743,1811,1772,1780,1787,1778,1790,1774,
-    1818,1774,1783,1808,1757,1798,1758,1769,1762,1772,1773,1760,1797,1770,1809,1783,
-    1790,1797,1796,1796,1816,1756,1800,1788,1759,1788,1763,1783,1783,1772,1757,1802,
-    1731,1802,1805,1743,1819,1815,1770,1810,1797,1786,1806,1780,1786,1787,1753,1764,
-    1768,1727,1793,1741,1765,1818,1793,1794,1818,1822,1782,1823,1811,1788,1817,1804,
-    1792,1804,1794,1784,1797,1793,1787,1794,1773,1813,1791,1791,1810,1795,1814,1812,
-    1797,1800,1807,1782,1788,1770,1765,1766,1769,1777,1767,1782,1798,1791,1802,1803,
-    1802,1815,1798,1800,1804,1795,1782,1776,1782,1763,1767,1772,1764,1774,1790,1797,
-    1800,1811,1799,1797,1795,1780,1779,1772,1776,1773,1780,1778,1778,1784,1769,1779,
-    1784,1779,1787,1790,1788,1801,1797,1796,1802,1807,1814,1791,1800,1794,1785,1792,
-    1785,1782,1782,1786,1779,1781,1778,1774,1777,1779,1783,1786,1777,1789,1777,1785,
-    1783,1784,1789,1774,1796,1772,1771,1787,1771,1781,1797,1767,1783,1770,1756,1782,
-    1769,1785,1789,1791,1797,1779,1773,1768,1768,1770,1766,1775,1784,1779,1790,1790,
-    1776,1793,1784,1794,1800,1789,1802,1793,1795,1793,1781,1774,1773,1771,1776,1779,
-    1779,1789,1779,1790,1782,1771,1790,1774,1775,1783,1769,1778,1772,1772,1767,1777,
-    1781,1776,1795,1784,1780,1787,1787,1779,1787,1777,1789,1782,1776,1785,1780,1783,
-    1791,1784,1785,1797,1783,1804,1801,1806,1812,1807,1809,1795,1800,1795,1791,1794,
-    1782,1791,1789,1789,1783,1786,1785,1783,1785,1780,1789,1778,1784,1782,1781,1777,
-    1771,1777,1774,1779,1780,1772,1788,1777,1767,1768,1756,1757,1764,1763,1774,1786,
-    1783,1793,1793,1789,1799,1797,1800,1806,1801,1806,1804,1805,1792,1797,1795,1796,
-    1808,1803,1800,1794,1792,1797,1790,1798,1794,1800,1807,1793,1803,1794,1796,1791,
-    1794,1794,1789,1796,1795,1785,1800,1794,1796,1798,1792,1794,1792,1793,1780,1780,
-    1773,1779,1771,1775,1778,1781,1784,1781,1784,1787,1784,1789,1780,1771,1773,1774,
-    1777,1769,1780,1771,1772,1775,1778,1779,1784,1787,1789,1794,1790,1789,1787,1790,
-    1789,1778,1782,1773,1769,1773,1771,1784,1783,1798,1792,1787,1798,1789,1787,1791,
-    1786,1791,1797,1794,1788,1782,1787,1776,1775,1787,1782,1793,1796,1796,1794,1785,
-    1785,1790,1794,1792,1799,1788,1787,1790,1787,1783,1789,1790,1789,1796,1791,1792,
-    1790,1778,1782,1783,1782,1785,1784,1790,1789,1787,1782,1788,1788,1793,1795,1795,
-    1791,1784,1779,1772,1784,1783,1790,1790,1785,1797,1787,1785,1795,1781,1788,1786,
-    1778,1790,1783,1782,1781,1778,1776,1772,1779,1781,1777,1792,1785,1787,1791,1786,
-    1791,1779,1785,1788,1782,1780,1777,1779,1789,1779,1782,1777,1773,1784,1774,1775,
-    1780,1776,1782,1779,1774,1776,1775,1784,1781,1783,1784,1786,1787,1795,1776,1829,
-    1883,1757,1738,1832,1821,1739,1758,1786,1742,1759,1798,1785,1793,1814,1786,1782,
-    1806,1800,1770,1804,1805,1783,1806,1794,1771,1790,1811,1785,1794,1816,1789,1791,
-    1816,1796,1791,1801,1781,1768,1769,1778,1767,1758,1764,1774,1765,1749,1796,1777,
-    1757,1811,1809,1774,1790,1819,1795,1772,1798,1803,1748,1770,1799,1740,1746,1811,
-    1757,1752,1816,1798,1747,1824,1835,1742,1820,1844,1780,1790,1835,1786,1792,1812,
-    1802,1770,1805,1797,1775,1813,1795,1773,1798,1824,1784,1792,1797,1788,1785,1805,
-    1771,1767,1798,1803,1794,1808,1789,1806,1787,1797,1785,1754,1791,1781,1787,1782,
-    1767,1796,1792,1755,1819,1780,1774,1793,1779,1812,1796,1768,1787,1790,1760,1778,
-    1789,1751,1774,1791,1777,1758,1814,1777,1734,1801,1780,1748,1798,1817,1744,1808,
-    1819,1769,1784,1802,1768,1743,1802,1793,1741,1785,1785,1766,1774,1806,1772,1775,
-    1833,1758,1779,1806,1782,1792,1799,1784,1796,1796,1792,1794,1797,1811,1814,1817,
-    1828,1828,1813,1800,1801,1773,1743,1775,1717,1693,1737,1719,1705,1736,1753,1759,
-    1765,1789,1795,1796,1835,1820,1804,1829,1828,1796,1802,1806,1791,1779,1790,1763,
-    1772,1796,1766,1766,1773,1774,1776,1779,1778,1789,1786,1793,1786,1797,1798,1785,
-    1796,1793,1790,1796,1791,1787,1793,1797,1802,1786,1781,1794,1789,1785,1790,1786,
-    1782,1785,1783,1782,1787,1783,1783,1778,1781,1777,1786,1785,1778,1789,1775,1773,
-    1772,1769,1766,1755,1765,1764,1758,1763,1749,1750,1754,1740,1733,1744,1752,1730,
-    1726,1732,1718,1709,1709,1712,1721,1734,1732,1748,1827,1917,1930,1893,1947,2035,
-    2035,2018,2024,2013,2008,1967,1889,1864,1882,1839,1749,1706,1686,1665,1632,1612,
-    1622,1658,1663,1622,1640,1696,1735,1767,1788,1808,1845,1857,1840,1856,1889,1897,
-    1872,1841,1825,1814,1809,1782,1756,1754,1739,1697,1675,1682,1697,1717,1724,1729,
-    1745,1774,1787,1794,1833,1875,1882,1878,1877,1873,1877,1874,1840,1820,1819,1788,
-    1758,1745,1743,1737,1719,1708,1699,1707,1735,1739,1746,1781,1804,1790,1793,1818,
-    1822,1829,1827,1811,1797,1799,1779,1756,1751,1736,1719,1695,1682,1686,1685,1698,
-    1694,1695,1721,1733,1733,1737,1763,1768,1772,1771,1761,1756,1747,1722,1707,1712,
-    1705,1708,1715,1717,1737,1785,1834,1876,1926,1972,2006,2028,2048,2063,2057,2044,
-    1998,1962,1927,1884,1845,1804,1765,1718,1682,1652,1626,1627,1638,1650,1676,1688,
-    1702,1733,1753,1780,1814,1841,1868,1878,1888,1882,1888,1879,1860,1845,1815,1791,
-    1774,1755,1731,1718,1707,1699,1690,1697,1715,1736,1762,1781,1803,1834,1852,1871,
-    1891,1907,1917,1917,1901,1888,1871,1841,1809,1782,1764,1745,1724,1691,1675,1682,
-    1683,1688,1712,1733,1758,1774,1786,1804,1817,1822,1813,1801,1795,1779,1758,1731,
-    1717,1705,1681,1655,1641,1635,1635,1640,1652,1677,1690,1700,1712,1722,1731,1747,
-    1736,1718,1701,1672,1628,1616,1621,1627,1607,1664,1924,2131,2053,1996,2232,2423,
-    2379,2279,2244,2240,2197,2027,1832,1829,1895,1748,1507,1434,1462,1457,1440,1451,
-    1529,1672,1696,1604,1653,1835,1957,1980,1967,1958,1980,1964,1877,1852,1907,1901,
-    1790,1672,1621,1622,1618,1585,1574,1612,1628,1605,1599,1669,1769,1843,1859,1862,
-    1908,1955,1963,1959,1976,1991,1961,1884,1811,1784,1782,1747,1700,1664,1653,1633,
-    1603,1604,1643,1693,1714,1717,1741,1792,1853,1897,1925,1965,2008,1998,1947,1919,
-    1900,1894,1861,1794,1746,1721,1676,1618,1601,1619,1636,1643,1634,1641,1690,1736,
-    1752,1781,1825,1860,1864,1844,1843,1859,1866,1841,1817,1795,1777,1755,1723,1719,
-    1725,1704,1690,1685,1692,1705,1729,1741,1743,1767,1779,1788,1809,1837,1838,1847,
-    1859,1867,1861,1841,1816,1802,1796,1780,1757,1751,1749,1731,1722,1724,1742,1762,
-    1786,1794,1791,1789,1804,1811,1821,1833,1834,1826,1821,1816,1811,1826,1834,1827,
-    1822,1822,1801,1797,1808,1812,1809,1807,1818,1820,1818,1827,1844,1861,1857,1849,
-    1842,1840,1845,1847,1836,1832,1828,1807,1791,1785,1806,1816,1803,1786,1779,1794,
-    1801,1796,1798,1806,1797,1777,1766,1761,1762,1765,1752,1734,1735,1739,1727,1722,
-    1728,1741,1740,1732,1725,1723,1726,1725,1724,1711,1707,1704,1710,1717,1713,1722,
-    1734,1740,1735,1743,1756,1764,1779,1779,1780,1780,1775,1773,1771,1770,1763,1747,
-    1744,1748,1743,1756,1763,1767,1768,1771,1770,1784,1796,1820,1908,1996,2005,2013,
-    2081,2120,2136,2110,2065,2042,1992,1890,1817,1783,1751,1712,1651,1605,1597,1582,
-    1568,1589,1629,1675,1704,1702,1730,1784,1820,1861,1883,1891,1905,1880,1845,1837,
-    1830,1828,1806,1768,1751,1738,1711,1708,1707,1716,1730,1722,1723,1742,1759,1780,
-    1784,1797,1823,1827,1818,1812,1805,1800,1783,1760,1738,1731,1759,1729,1707,1730,
-    1752,1758,1771,1771,1800,1828,1823,1815,1832,1867,1862,1847,1824,1820,1818,1798,
-    1770,1775,1779,1758,1716,1695,1699,1707,1706,1699,1708,1719,1727,1715,1721,1748,
-    1771,1767,1754,1754,1760,1761,1769,1777,1784,1778,1764,1753,1756,1785,1792,1780,
-    1777,1783,1781,1779,1785,1793,1798,1787,1764,1755,1764,1770,1768,1766,1775,1786,
-    1773,1755,1760,1778,1789,1790,1791,1794,1811,1820,1820,1835,1860,1875,1868,1861,
-    1875,1893,1897,1892,1887,1893,1878,1855,1837,1829,1834,1823,1801,1783,1783,1775,
-    1764,1767,1778,1789,1792,1787,1786,1786,1788,1779,1772,1782,1790,1789,1786,1786,
-    1794,1804,1806,1805,1801,1809,1811,1811,1815,1818,1819,1811,1806,1806,1796,1790,
-    1792,1788,1784,1772,1766,1764,1769,1758,1751,1752,1748,1747,1739,1727,1730,1730,
-    1728,1730,1727,1734,1738,1733,1737,1750,1748,1745,1751,1756,1762,1759,1747,1754,
-    1766,1768,1762,1755,1754,1751,1749,1752,1763,1776,1772,1773,1786,1792,1806,1816,
-    1812,1806,1813,1816,1800,1797,1803,1808,1810,1803,1809,1822,1816,1806,1790,1788,
-    1786,1782,1793,1793,1801,1802,1809,1813,1815,1809,1810,1818,1827,1827,1821,1821,
-    1821,1825,1816,1821,1820,1827,1836,1834,1827,1819,1815,1810,1805,1804,1809,1803,
-    1796,1789,1777,1778,1780,1778,1783,1789,1779,1774,1773,1762,1760,1767,1768,1766,
-    1754,1745,1749,1751,1751,1752,1758,1755,1751,1751,1757,1768,1777,1774,1782,1783,
-    1781,1785,1785,1795,1799,1802,1793,1785,1791,1794,1786,1778,1785,1779,1769,1777,
-    1773,1769,1770,1751,1738,1752,1743,1739,1759,1758,1755,1750,1751,1775,1776,1768,
-    1772,1789,1782,1773,1773,1766,1781,1772,1758,1761,1766,1760,1757,1778,1778,1797,
-    1788,1788,1805,1822,1832,1823,1853,1848,1840,1836,1825,1848,1827,1814,1819,1783,
-    1810,1782,1780,1783,1795,1791,1777,1790,1776,1806,1784,1790,1804,1805,1805,1798,
-    1803,1793,1797,1812,1797,1800,1783,1768,1780,1769,1783,1774,1775,1788,1763,1777,
-    1751,1802,1787,1766,1804,1762,1794,1792,1795,1774,1788,1775,1745,1784,1778,1780,
-    1803,1768,1805,1797,1809,1852,1793,1850,1831,1811,1833,1820,1804,1828,1821,1769,
-    1816,1785,1778,1805,1765,1775,1772,1780,1747,1770,1747,1751,1778,1737,1767,1782,
-    1745,1776,1795,1746,1796,1791,1778,1771,1822,1751,1795,1785,1747,1817,1737,1787,
-    1777,1770,1779,1753,1782,1777,1770,1803,1730,1839,1766,1758,1845,1739,1831,1787,
-    1770,1795,1764,1743,1765,1756,1795,1751,1783,1764,1791,1803,1754,1816,1779,1821,
-    1789,1823,1779,1839,1778,1813,1798,1769,1842,1736,1811,1753,1805,1777,1738,1790,
-    1729,1808,1741,1772,1801,1746,1836,1740,1839,1806,1757,1850,1789,1832,1781,1802,
-    1801,1752,1819,1764,1801,1816,1761,1816,1798,1788,1794,1795,1810,1754,1818,1781,
-    1814,1824,1750,1853,1779,1879,1765,1783,1842,1747,1870,1713,1803,1798,1751,1814,
-    1722,1810,1794,1727,1774,1775,1743,1801,1729,1777,1823,1736,1824,1738,1814,1782,
-    1765,1798,1715,1822,1743,1773,1763,1780,1787,1769,1760,1808,1771,1771,1795,1731,
-    1827,1729,1816,1759,1775,1830,1736,1821,1812,1766,1848,1781,1811,1856,1756,1840,
-    1808,1809,1813,1816,1787,1815,1786,1828,1777,1816,1821,1730,1878,1756,1779,1835,
-    1756,1802,1805,1753,1844,1729,1805,1777,1747,1815,1718,1824,1746,1812,1788,1754,
-    1800,1798,1739,1816,1780,1775,1791,1748,1783,1773,1813,1713,1878,1706,1843,1805,
-    1712,1872,1722,1811,1772,1787,1788,1788,1810,1774,1824,1764,1794,1781,1742,1825,
-    1732,1751,1781,1718,1735,1800,1703,1810,1782,1756,1781,1775,1753,1754,1801,1720,
-    1824,1758,1755,1811,1771,1767,1804,1776,1740,1843,1734,1792,1810,1741,1833,1766,
-    1811,1768,1819,1769,1752,1837,1744,1795,1786,1800,1794,1789,1806,1816,1764,1831,
-    1812,1704,1921,1698,1829,1771,1769,1813,1753,1863,1703,1873,1749,1781,1802,1749,
-    1767,1814,1736,1818,1770,1792,1779,1775,1842,1701,1886,1734,1837,1752,1841,1798,
-    1705,1889,1691,1829,1775,1773,1798,1777,1805,1776,1783,1794,1774,1799,1796,1772,
-    1808,1744,1826,1735,1799,1781,1738,1847,1716,1821,1770,1769,1792,1784,1806,1786,
-    1837,1760,1847,1752,1833,1776,1766,1843,1756,1806,1771,1830,1745,1844,1766,1818,
-    1810,1791,1812,1781,1823,1770,1821,1765,1832,1768,1778,1822,1756,1776,1790,1742,
-    1796,1750,1776,1796,1727,1813,1740,1798,1758,1796,1795,1751,1814,1775,1762,1792,
-    1797,1788,1724,1797,1831,1673,1893,1689,1826,1787,1756,1846,1744,1872,1712,1852,
-    1787,1739,1863,1726,1813,1841,1710,1897,1732,1808,1875,1742,1825,1818,1787,1804,
-    1784,1797,1780,1798,1783,1789,1791,1762,1850,1765,1762,1870,1726,1819,1834,1683,
-    1918,1678,1831,1770,1766,1818,1759,1836,1695,1864,1739,1769,1786,1772,1762,1825,
-    1708,1865,1767,1714,1902,1622,1883,1746,1777,1797,1762,1812,1746,1862,1701,1855,
-    1773,1760,1816,1737,1809,1771,1771,1776,1836,1701,1852,1750,1747,1884,1689,1834,
-    1759,1766,1817,1788,1735,1875,1712,1769,1854,1682,1822,1806,1716,1801,1800,1745,
-    1797,1741,1829,1733,1817,1741,1782,1804,1735,1867,1750,1789,1886,1722,1848,1830,
-    1702,1909,1721,1799,1839,1720,1850,1726,1801,1806,1713,1864,1737,1758,1867,1729,
-    1817,1809,1743,1878,1725,1835,1843,1662,1957,1683,1787,1860,1665,1912,1652,1840,
-    1795,1708,1893,1679,1822,1870,1627,1950,1696,1752,1923,1607,1967,1684,1808,1857,
-    1644,1903,1700,1810,1793,1710,1896,1652,1847,1759,1718,1911,1678,1823,1817,1695,
-    1896,1708,1750,1868,1640,1880,1740,1725,1908,1700,1823,1836,1723,1910,1707,1834,
-    1864,1644,1998,1649,1824,1891,1585,1982,1645,1801,1891,1634,1894,1771,1754,1875,
-    1677,1833,1788,1683,1933,1632,1834,1806,1681,1892,1681,1847,1792,1697,1915,1686,
-    1810,1851,1663,1866,1699,1795,1736,1738,1822,1693,1825,1753,1749,1827,1754,1759,
-    1828,1773,1770,1808,1790,1802,1803,1780,1829,1755,1799,1807,1780,1773,1813,1799,
-    1815,1748,1848,1767,1754,1885,1673,1898,1716,1796,1838,1707,1861,1774,1771,1830,
-    1735,1830,1756,1773,1844,1725,1845,1762,1797,1826,1753,1809,1831,1713,1857,1726,
-    1815,1807,1718,1913,1698,1813,1850,1697,1829,1799,1747,1860,1715,1841,1746,1772,
-    1799,1734,1820,1750,1799,1742,1826,1762,1765,1829,1761,1758,1822,1741,1786,1819,
-    1732,1825,1788,1719,1816,1799,1718,1796,1780,1776,1781,1757,1853,1746,1802,1811,
-    1739,1840,1739,1860,1722,1804,1834,1715,1881,1718,1777,1880,1713,1794,1892,1657,
-    1885,1786,1713,1931,1664,1885,1757,1722,1914,1664,1805,1841,1666,1890,1741,1765,
-    1890,1665,1887,1726,1775,1850,1699,1829,1826,1705,1900,1758,1772,1894,1678,1891,
-    1737,1744,1884,1684,1816,1798,1687,1877,1706,1809,1835,1716,1896,1709,1796,1889,
-    1649,1899,1745,1750,1868,1725,1797,1820,1722,1810,1783,1704,1889,1671,1808,1799,
-    1740,1792,1798,1732,1799,1754,1776,1789,1721,1837,1758,1781,1794,1775,1809,1747,
-    1798,1822,1695,1848,1766,1756,1797,1804,1733,1825,1731,1789,1835,1655,1925,1707,
-    1772,1859,1692,1828,1789,1746,1800,1796,1748,1828,1738,1764,1835,1723,1819,1759,
-    1780,1841,1731,1811,1800,1750,1864,1731,1795,1863,1728,1855,1801,1759,1850,1776,
-    1798,1793,1806,1778,1826,1748,1817,1783,1721,1869,1673,1874,1717,1808,1785,1755,
-    1834,1723,1852,1740,1820,1764,1803,1783,1780,1826,1733,1845,1770,1740,1843,1731,
-    1816,1770,1772,1802,1751,1820,1765,1792,1807,1791,1785,1818,1813,1758,1843,1755,
-    1791,1826,1756,1831,1772,1792,1820,1762,1787,1800,1761,1807,1753,1800,1809,1758,
-    1825,1755,1800,1808,1744,1845,1731,1795,1816,1704,1865,1746,1784,1873,1730,1843,
-    1784,1767,1863,1728,1860,1776,1796,1855,1750,1840,1788,1805,1785,1816,1759,1813,
-    1805,1731,1847,1753,1784,1828,1697,1833,1739,1771,1819,1721,1862,1721,1831,1763,
-    1778,1818,1729,1830,1780,1767,1804,1791,1778,1772,1772,1753,1749,1809,1701,1828,
-    1742,1745,1827,1717,1818,1762,1802,1762,1775,1782,1766,1799,1751,1803,1793,1746,
-    1815,1755,1775,1798,1772,1817,1771,1806,1752,1840,1741,1798,1825,1736,1850,1754,
-    1789,1817,1731,1814,1763,1772,1795,1754,1805,1764,1803,1769,1804,1752,1812,1786,
-    1785,1810,1775,1828,1743,1818,1788,1754,1829,1748,1796,1781,1753,1824,1725,1828,
-    1794,1756,1815,1763,1775,1802,1781,1754,1833,1772,1784,1822,1770,1826,1766,1799,
-    1794,1739,1847,1741,1825,1784,1784,1821,1729,1836,1759,1778,1817,1769,1778,1829,
-    1738,1844,1773,1800,1806,1764,1828,1727,1848,1732,1800,1805,1748,1820,1769,1805,
-    1786,1794,1780,1797,1789,1779,1819,1766,1830,1780,1803,1795,1789,1796,1796,1823,
-    1770,1798,1812,1770,1790,1817,1753,1832,1766,1826,1808,1782,1845,1770,1823,1771,
-    1806,1781,1779,1803,1750,1809,1766,1788,1777,1775,1799,1759,1790,1754,1766,1782,
-    1747,1776,1766,1770,1778,1771,1771,1763,1781,1763,1779,1800,1761,1785,1788,1752,
-    1792,1803,1751,1810,1785,1760,1832,1746,1794,1790,1750,1819,1744,1778,1803,1750,
-    1806,1763,1774,1800,1765,1788,1778,1781,1790,1771,1785,1794,1780,1801,1776,1786,
-    1778,1767,1798,1763,1783,1802,1766,1789,1773,1795,1786,1794,1810,1779,1814,1778,
-    1802,1778,1783,1802,1765,1807,1769,1779,1797,1760,1803,1763,1777,1794,1759,1797,
-    1776,1770,1795,1782,1781,1806,1785,1798,1806,1780,1800,1786,1786,1790,1771,1787,
-    1782,1799,1799,1775,1823,1775,1791,1802,1755,1822,1762,1795,1813,1762,1815,1776,
-    1785,1801,1785,1798,1795,1797,1783,1808,1778,1781,1807,1771,1801,1783,1782,1801,
-    1791,1794,1781,1800,1780,1792,1796,1770,1805,1775,1788,1786,1783,1801,1774,1801,
-    1782,1795,1807,1786,1807,1788,1804,1805,1777,1816,1787,1791,1795,1770,1804,1787,
-    1776,1780,1779,1764,1791,1757,1776,1783,1760,1788,1766,1788,1776,1771,1786,1773,
-    1785,1774,1776,1791,1764,1783,1771,1768,1788,1782,1775,1796,1782,1783,1800,1778,
-    1777,1792,1775,1794,1794,1773,1794,1772,1787,1777,1786,1788,1775,1792,1779,1782,
-    1801,1787,1782,1791,1788,1794,1801,1773,1792,1788,1778,1804,1766,1796,1787,1773,
-    1807,1773,1790,1795,1774,1809,1788,1791,1794,1771,1797,1783,1784,1789,1770,1793,
-    1772,1773,1787,1762,1787,1776,1774,1795,1776,1789,1790,1779,1785,1774,1775,1793,
-    1777,1791,1787,1772,1796,1782,1775,1781,1782,1771,1784,1777,1765,1802,1779,1782,
-    1799,1768,1792,1781,1773,1777,1781,1775,1771,1775,1758,1773,1764,1759,1768,1769,
-    1767,1779,1774,1763,1782,1764,1783,1795,1775,1804,1791,1788,1809,1784,1802,1795,
-    1791,1802,1793,1805,1795,1800,1801,1792,1798,1795,1788,1795,1790,1789,1786,1783,
-    1782,1792,1787,1788,1791,1798,1802,1795,1805,1788,1800,1798,1778,1793,1788,1779,
-    1796,1779,1788,1792,1785,1794,1792,1786,1791,1789,1783,1785,1777,1789,1776,1779,
-    1784,1777,1782,1769,1785,1780,1778,1795,1781,1799,1798,1782,1792,1780,1779,1785,
-    1774,1787,1781,1786,1782,1775,1791,1776,1786,1782,1770,1789,1784,1780,1792,1780,
-    1780,1783,1775,1784,1781,1782,1782,1780,1787,1782,1792,1793,1784,1797,1786,1790,
-    1801,1786,1800,1795,1794,1800,1790,1808,1793,1804,1801,1793,1804,1784,1798,1785,
-    1790,1790,1789,1800,1786,1796,1787,1790,1790,1783,1791,1778,1790,1775,1776,1777,
-    1763,1777,1757,1778,1776,1770,1781,1769,1773,1770,1776,1772,1774,1781,1775,1792,
-    1785,1789,1784,1780,1797,1785,1786,1783,1789,1794,1792,1793,1786,1797,1801,1794,
-    1793,1793,1798,1799,1799,1796,1796,1796,1785,1789,1789,1786,1796,1781,1789,1790,
-    1785,1796,1784,1792,1792,1791,1795,1791,1788,1792,1788,1780,1786,1783,1787,1787,
-    1784,1787,1779,1787,1782,1782,1786,1786,1787,1786,1786,1785,1780,1780,1788,1778,
-    1784,1779,1782,1789,1785,1785,1784,1791,1786,1782,1783,1784,1791,1787,1785,1783,
-    1786,1787,1787,1785,1784,1788,1780,1783,1776,1786,1783,1781,1785,1780,1787,1778,
-    1781,1785,1784,1792,1791,1783,1786,1788,1783,1776,1783,1774,1780,1783,1771,1785,
-    1781,1790,1793,1794,1795,1795,1800,1792,1794,1794,1792,1796,1793,1795,1797,1787,
-    1787,1780,1781,1782,1782,1781,1787,1783,1789,1789,1779,1788,1779,1776,1778,1779,
-    1783,1779,1783,1781,1782,1788,1780,1787,1785,1787,1788,1790,1790,1788,1783,1774,
-    1785,1775,1782,1783,1780,1790,1783,1787,1786,1784,1789,1786,1787,1788,1783,1790,
-    1784,1786,1789,1787,1792,1786,1789,1788,1789,1793,1786,1797,1794,1788,1794,1788,
-    1786,1793,1790,1783,1791,1788,1793,1790,1784,1790,1790,1788,1791,1795,1791,1789,
-    1782,1780,1779,1780,1775,1774,1779,1780,1781,1785,1784,1790,1787,1785,1786,1781,
-    1786,1783,1785,1782,1772,1779,1777,1774,1777,1772,1774,1782,1781,1782,1783,1785,
-    1790,1785,1789,1786,1785,1783,1779,1780,1783,1785,1784,1790,1788,1790,1783,1783,
-    1786,1783,1784,1780,1783,1784,1779,1782,1783,1781,1776,1775,1779,1785,1780,1777,
-    1780,1774,1783,1776,1778,1772,1764,1775,1768,1777,1779,1780,1789,1780,1787,1780,
-    1775,1777,1776,1782,1779,1789,1788,1782,1790,1786,1791,1798,1788,1789,1784,1784,
-    1782,1787,1792,1794,1795,1796,1793,1796,1802,1799,1802,1797,1798,1799,1801,1805,
-    1797,1793,1796,1793,1796,1793,1797,1791,1790,1789,1785,1794,1791,1791,1794,1790,
-    1792,1792,1790,1795,1789,1787,1787,1788,1791,1787,1793,1792,1790,1795,1795,1798,
-    1793,1790,1794,1797,1799,1803,1801,1799,1800,1796,1800,1788,1791,1800,1791,1792,
-    1784,1787,1790,1791,1789,1782,1784,1778,1781,1777,1779,1780,1774,1777,1776,1777,
-    1777,1773,1776,1778,1772,1772,1775,1775,1771,1772,1768,1764,1776,1775,1777,1782,
-    1776,1782,1784,1781,1781,1774,1768,1766,1768,1776,1781,1786,1792,1793,1793,1796,
-    1802,1795,1791,1789,1785,1789,1783,1771,1776,1773,1774,1772,1769,1783,1773,1773,
-    1774,1772,1775,1778,1779,1778,1784,1791,1787,1789,1789,1783,1792,1791,1789,1801,
-    1794,1793,1792,1785,1797,1793,1795,1801,1792,1796,1798,1794,1794,1786,1782,1781,
-    1779,1780,1777,1782,1782,1786,1781,1774,1782,1787,1791,1789,1795,1800,1791,1780,
-    1782,1781,1783,1787,1786,1783,1776,1786,1781,1783,1792,1785,1792,1792,1789,1796,
-    1795,1804,1800,1791,1801,1792,1802,1803,1791,1803,1807,1806,1805,1810,1805,1797,
-    1802,1806,1808,1795,1791,1786,1784,1791,1786,1783,1785,1786,1776,1769,1766,1761,
-    1770,1774,1771,1774,1780,1780,1780,1783,1776,1772,1772,1765,1772,1783,1785,1778,
-    1775,1775,1779,1785,1784,1785,1781,1780,1783,1788,1788,1788,1787,1787,1792,1803,
-    1804,1801,1795,1784,1788,1787,1792,1798,1790,1791,1790,1789,1790,1793,1791,1784,
-    1780,1780,1784,1786,1783,1778,1778,1776,1783,1800,1799,1793,1792,1792,1795,1793,
-    1787,1784,1784,1782,1784,1786,1789,1792,1786,1784,1789,1790,1792,1791,1795,1803,
-    1795,1790,1787,1791,1785,1781,1779,1772,1775,1782,1786,1784,1776,1771,1774,1783,
-    1782,1785,1785,1781,1786,1787,1793,1780,1780,1784,1791,1788,1783,1780,1778,1779,
-    1779,1770,1763,1783,1785,1789,1791,1799,1809,1808,1810,1818,1822,1811,1806,1799,
-    1791,1789,1784,1785,1783,1789,1786,1780,1783,1782,1783,1783,1787,1777,1777,1782,
-    1784,1793,1795,1785,1778,1775,1775,1775,1780,1776,1774,1781,1785,1785,1776,1774,
-    1773,1781,1785,1785,1787,1784,1784,1788,1797,1788,1785,1794,1787,1788,1794,1793,
-    1786,1786,1774,1775,1782,1786,1791,1788,1786,1783,1790,1789,1786,1783,1778,1782,
-    1784,1788,1789,1785,1783,1775,1774,1775,1782,1790,1788,1787,1791,1794,1797,1806,
-    1808,1798,1798,1802,1810,1809,1808,1799,1795,1808,1804,1805,1798,1783,1778,1780,
-    1783,1779,1776,1776,1772,1778,1782,1782,1785,1784,1772,1770,1772,1779,1781,1774,
-    1777,1770,1771,1767,1768,1775,1769,1772,1775,1782,1788,1787,1786,1776,1779,1785,
-    1781,1781,1778,1774,1772,1780,1787,1780,1783,1785,1785,1787,1795,1799,1800,1800,
-    1784,1783,1789,1793,1790,1783,1784,1783,1780,1780,1775,1773,1770,1772,1784,1782,
-    1782,1783,1782,1784,1786,1787,1780,1782,1792,1778,1772,1778,1776,1773,1770,1773,
-    1794,1796,1788,1790,1795,1791,1780,1787,1794,1793,1793,1799,1799,1800,1797,1790,
-    1792,1804,1800,1800,1802,1792,1787,1781,1784,1786,1791,1792,1776,1770,1776,1781,
-    1790,1784,1770,1768,1778,1784,1787,1782,1764,1766,1772,1777,1774,1769,1773,1780,
-    1783,1780,1785,1787,1784,1774,1779,1799,1798,1795,1793,1785,1782,1781,1788,1786,
-    1785,1781,1775,1784,1791,1794,1792,1790,1785,1779,1772,1773,1780,1777,1774,1778,
-    1787,1792,1785,1792,1788,1789,1799,1797,1800,1792,1793,1793,1792,1796,1795,1789,
-    1789,1788,1789,1786,1786,1793,1792,1789,1790,1790,1789,1793,1793,1792,1789,1788,
-    1795,1789,1787,1786,1793,1799,1789,1779,1769,1774,1781,1781,1783,1787,1782,1777,
-    1781,1780,1782,1786,1774,1770,1774,1781,1782,1785,1793,1788,1794,1795,1793,1797,
-    1791,1787,1785,1789,1795,1795,1797,1792,1791,1795,1786,1779,1786,1788,1782,1778,
-    1776,1770,1774,1775,1779,1782,1780,1773,1767,1773,1767,1767,1768,1771,1774,1773,
-    1776,1787,1786,1791,1794,1783,1779,1783,1787,1790,1788,1789,1789,1785,1794,1792,
-    1794,1795,1788,1789,1787,1794,1804,1804,1796,1792,1797,1798,1802,1805,1792,1782,
-    1786,1783,1782,1784,1784,1783,1790,1783,1779,1781,1789,1790,1785,1798,1792,1789,
-    1791,1790,1794,1795,1795,1788,1784,1791,1787,1790,1790,1785,1784,1793,1794,1790,
-    1801,1799,1795,1794,1792,1790,1787,1785,1780,1785,1797,1792,1792,1790,1788,1792,
-    1805,1801,1782,1783,1783,1787,1792,1784,1779,1778,1774,1776,1781,1785,1788,1796,
-    1795,1793,1802,1797,1790,1780,1780,1786,1783,1783,1774,1775,1781,1778,1776,1780,
-    1783,1776,1777,1786,1780,1780,1786,1779,1778,1779,1787,1794,1798,1786,1778,1777,
-    1775,1771,1765,1765,1765,1775,1784,1784,1787,1792,1793,1794,1789,1799,1799,1791,
-    1786,1788,1793,1787,1788,1787,1782,1786,1793,1794,1793,1789,1787,1791,1800,1800,
-    1791,1795,1801,1797,1797,1793,1793,1795,1798,1794,1783,1785,1787,1788,1789,1783,
-    1779,1776,1782,1783,1776,1781,1785,1787,1785,1780,1785,1795,1793,1787,1785,1786,
-    1793,1794,1792,1783,1778,1785,1787,1789,1788,1785,1794,1794,1789,1786,1787,1791,
-    1786,1784,1780,1784,1788,1781,1786,1798,1801,1795,1794,1793,1785,1786,1782,1770,
-    1774,1783,1783,1785,1790,1790,1790,1788,1775,1769,1776,1777,1771,1773,1780,1787,
-    1792,1788,1787,1786,1780,1777,1776,1780,1775,1768,1775,1783,1788,1786,1782,1786,
-    1794,1796,1787,1781,1784,1784,1781,1787,1797,1799,1792,1796,1806,1803,1790,1779,
-    1773,1783,1790,1790,1790,1786,1787,1792,1793,1797,1792,1788,1791,1789,1788,1787,
-    1785,1779,1780,1780,1782,1776,1777,1780,1779,1777,1767,1762,1765,1770,1776,1774,
-    1766,1767,1770,1778,1777,1773,1772,1775,1783,1783,1785,1784,1784,1780,1772,1773,
-    1780,1786,1784,1780,1786,1790,1790,1791,1788,1789,1788,1796,1797,1789,1788,1792,
-    1797,1792,1793,1793,1789,1793,1803,1801,1799,1796,1793,1797,1796,1795,1790,1792,
-    1797,1793,1785,1776,1782,1793,1798,1795,1784,1781,1793,1798,1796,1789,1780,1781,
-    1777,1768,1771,1774,1770,1770,1774,1778,1772,1771,1781,1785,1782,1780,1785,1792,
-    1789,1790,1791,1789,1793,1795,1797,1796,1792,1785,1780,1787,1791,1785,1784,1786,
-    1787,1785,1786,1781,1775,1779,1787,1787,1786,1786,1793,1803,1804,1799,1798,1805,
-    1803,1798,1797,1791,1788,1789,1787,1787,1778,1779,1780,1782,1780,1784,1786,1789,
-    1795,1792,1794,1793,1788,1788,1788,1788,1794,1784,1780,1778,1787,1785,1777,1777,
-    1784,1789,1786,1778,1773,1778,1785,1793,1791,1790,1779,1783,1786,1787,1790,1785,
-    1782,1777,1780,1782,1785,1783,1774,1775,1779,1783,1778,1767,1766,1768,1773,1781,
-    1784,1779,1779,1781,1781,1781,1778,1773,1776,1780,1777,1780,1791,1797,1800,1803,
-    1805,1811,1809,1804,1802,1800,1800,1796,1797,1796,1794,1799,1795,1789,1791,1789,
-    1790,1782,1780,1787,1789,1792,1789,1787,1788,1794,1794,1795,1793,1788,1789,1790,
-    1789,1782,1777,1775,1777,1777,1769,1768,1771,1774,1778,1784,1782,1785,1791,1794,
-    1794,1800,1793,1781,1780,1782,1785,1778,1768,1766,1766,1775,1785,1788,1792,1789,
-    1786,1793,1800,1793,1789,1788,1786,1792,1794,1787,1788,1791,1789,1787,1791,1790,
-    1788,1786,1782,1780,1780,1783,1783,1788,1796,1793,1786,1788,1790,1786,1779,1783,
-    1789,1793,1787,1783,1790,1791,1797,1797,1797,1787,1781,1781,1783,1785,1786,1787,
-    1785,1792,1798,1798,1794,1789,1787,1788,1787,1781,1775,1776,1771,1767,1772,1775,
-    1777,1781,1780,1781,1790,1790,1785,1773,1775,1779,1779,1786,1787,1791,1793,1797,
-    1801,1803,1798,1788,1788,1797,1795,1790,1785,1785,1789,1787,1787,1791,1792,1784,
-    1783,1785,1790,1792,1783,1779,1780,1778,1781,1773,1772,1771,1775,1776,1775,1779,
-    1781,1791,1786,1790,1797,1797,1794,1793,1792,1792,1790,1791,1794,1795,1801,1798,
-    1796,1788,1784,1789,1785,1781,1778,1784,1787,1780,1773,1765,1769,1779,1785,1785,
-    1784,1782,1779,1782,1779,1781,1786,1783,1779,1781,1790,1793,1796,1789,1784,1793,
-    1797,1789,1792,1784,1782,1790,1794,1800,1793,1789,1789,1791,1787,1787,1787,1787,
-    1786,1784,1788,1793,1788,1781,1777,1778,1779,1780,1780,1782,1783,1783,1787,1788,
-    1786,1785,1784,1778,1777,1777,1779,1777,1774,1773,1776,1777,1772,1772,1778,1774,
-    1773,1775,1783,1785,1783,1783,1780,1782,1782,1779,1778,1786,1792,1798,1801,1805,
-    1808,1809,1807,1801,1795,1792,1791,1791,1790,1792,1790,1791,1788,1791,1795,1786,
-    1779,1777,1774,1776,1778,1781,1781,1777,1778,1778,1781,1786,1792,1786,1780,1787,
-    1791,1791,1779,1771,1776,1781,1783,1786,1787,1787,1789,1792,1790,1791,1791,1788,
-    1791,1791,1792,1793,1789,1786,1785,1795,1798,1793,1787,1781,1782,1784,1783,1776,
-    1777,1786,1791,1787,1785,1782,1778,1775,1775,1774,1777,1774,1771,1772,1771,1766,
-    1755,1751,1754,1758,1761,1767,1765,1769,1774,1778,1780,1776,1777,1777,1779,1783,
-    1783,1777,1779,1781,1783,1789,1788,1784,1786,1790,1792,1798,1804,1799,1791,1796,
-    1803,1807,1805,1794,1795,1797,1795,1798,1809,1815,1811,1809,1803,1809,1807,1795,
-    1791,1789,1792,1787,1786,1793,1798,1794,1790,1787,1791,1794,1794,1789,1786,1788,
-    1795,1792,1787,1789,1786,1786,1788,1787,1781,1780,1785,1790,1789,1786,1785,1787,
-    1792,1793,1789,1786,1780,1783,1788,1783,1784,1780,1777,1776,1775,1781,1783,1788,
-    1785,1783,1787,1791,1793,1786,1781,1778,1774,1778,1778,1772,1772,1776,1784,1789,
-    1785,1785,1790,1782,1780,1787,1791,1789,1788,1787,1787,1792,1790,1783,1780,1780,
-    1780,1782,1775,1769,1764,1764,1769,1774,1784,1785,1783,1785,1784,1781,1778,1778,
-    1783,1790,1788,1789,1788,1787,1789,1786,1788,1790,1792,1791,1790,1790,1790,1786,
-    1776,1776,1782,1785,1786,1781,1782,1784,1783,1782,1775,1775,1776,1778,1787,1786,
-    1781,1780,1785,1794,1798,1802,1806,1807,1805,1802,1799,1796,1794,1791,1788,1786,
-    1789,1787,1788,1787,1780,1779,1785,1787,1783,1783,1784,1782,1782,1777,1772,1774,
-    1767,1764,1764,1762,1765,1771,1775,1777,1781,1784,1786,1782,1783,1782,1781,1788,
-    1793,1790,1784,1779,1785,1789,1784,1782,1777,1780,1782,1782,1785,1783,1783,1784,
-    1783,1784,1781,1786,1787,1783,1788,1792,1794,1793,1796,1803,1804,1805,1800,1795,
-    1793,1795,1798,1801,1797,1792,1793,1790,1792,1790,1786,1786,1789,1796,1796,1792,
-    1791,1788,1788,1787,1790,1793,1791,1792,1789,1789,1794,1799,1801,1799,1800,1801,
-    1802,1801,1796,1790,1785,1784,1786,1787,1787,1787,1786,1788,1794,1796,1793,1790,
-    1792,1799,1801,1798,1794,1792,1792,1796,1794,1791,1791,1789,1793,1799,1797,1791,
-    1789,1786,1786,1790,1794,1788,1783,1784,1787,1788,1790,1787,1786,1789,1787,1787,
-    1785,1782,1777,1780,1783,1783,1783,1787,1787,1787,1787,1786,1782,1776,1775,1775,
-    1774,1772,1771,1768,1773,1772,1768,1771,1773,1769,1766,1770,1771,1774,1780,1785,
-    1785,1784,1783,1790,1794,1795,1795,1794,1794,1791,1790,1789,1789,1792,1794,1788,
-    1787,1793,1793,1789,1784,1779,1778,1781,1783,1782,1784,1784,1783,1784,1786,1783,
-    1782,1783,1782,1784,1777,1778,1782,1785,1788,1786,1788,1789,1791,1792,1794,1789,
-    1788,1792,1793,1792,1790,1795,1801,1797,1794,1796,1790,1789,1788,1787,1791,1794,
-    1795,1796,1798,1800,1801,1798,1799,1798,1798,1796,1792,1789,1790,1791,1789,1782,
-    1784,1784,1783,1779,1772,1776,1774,1772,1772,1772,1771,1772,1772,1775,1776,1772,
-    1773,1779,1785,1786,1786,1785,1786,1792,1791,1789,1787,1793,1794,1792,1791,1789,
-    1791,1787,1784,1783,1784,1783,1784,1787,1787,1788,1790,1788,1790,1790,1791,1793,
-    1795,1797,1791,1791,1794,1793,1792,1795,1793,1788,1789,1786,1791,1793,1787,1781,
-    1779,1784,1789,1786,1783,1784,1788,1787,1784,1782,1781,1782,1778,1779,1777,1777,
-    1776,1774,1773,1772,1772,1771,1771,1775,1778,1779,1781,1781,1783,1783,1789,1792,
-    1793,1793,1789,1790,1787,1784,1783,1784,1783,1784,1786,1786,1785,1785,1788,1784,
-    1783,1785,1783,1778,1774,1777,1778,1776,1775,1772,1775,1774,1772,1774,1776,1777,
-    1779,1784,1779,1781,1783,1786,1792,1794,1794,1793,1794,1793,1789,1787,1787,1787,
-    1783,1783,1782,1779,1781,1780,1780,1782,1781,1781,1780,1781,1783,1781,1781,1777,
-    1772,1769,1772,1774,1773,1770,1779,1783,1783,1783,1785,1791,1787,1786,1785,1787,
-    1788,1787,1786,1784,1781,1786,1786,1783,1783,1782,1785,1785,1783,1785,1787,1787,
-    1788,1788,1788,1784,1784,1778,1773,1771,1768,1771,1774,1779,1786,1787,1792,1796,
-    1792,1795,1795,1794,1795,1797,1802,1799,1801,1802,1797,1799,1802,1803,1803,1805,
-    1802,1798,1797,1797,1794,1792,1793,1797,1796,1791,1789,1790,1789,1786,1787,1792,
-    1791,1791,1788,1789,1790,1785,1785,1779,1779,1781,1777,1772,1770,1772,1775,1775,
-    1776,1777,1777,1775,1777,1775,1778,1775,1772,1773,1776,1782,1785,1794,1793,1792,
-    1790,1791,1788,1792,1787,1786,1788,1784,1784,1784,1784,1778,1781,1784,1788,1792,
-    1797,1798,1794,1793,1790,1787,1787,1791,1796,1794,1795,1796,1796,1799,1801,1801,
-    1801,1802,1799,1802,1799,1793,1793,1791,1791,1791,1794,1794,1791,1788,1784,1783,
-    1782,1783,1785,1783,1788,1791,1795,1793,1792,1787,1784,1782,1776,1772,1767,1765,
-    1763,1762,1762,1761,1758,1760,1762,1761,1761,1767,1770,1774,1771,1773,1779,1783,
-    1786,1783,1782,1784,1786,1787,1786,1789,1789,1787,1784,1781,1784,1779,1780,1780,
-    1779,1780,1784,1788,1787,1784,1782,1784,1785,1783,1783,1785,1788,1788,1786,1784,
-    1782,1780,1773,1773,1775,1780,1784,1787,1792,1794,1792,1789,1785,1784,1786,1786,
-    1788,1789,1791,1793,1789,1786,1786,1788,1791,1789,1788,1792,1793,1790,1785,1782,
-    1785,1788,1788,1787,1788,1787,1788,1792,1792,1789,1786,1786,1784,1781,1783,1782,
-    1782,1785,1788,1794,1798,1800,1800,1800,1800,1798,1798,1795,1791,1789,1789,1791,
-    1790,1790,1788,1786,1789,1793,1792,1794,1795,1796,1795,1793,1794,1796,1795,1791,
-    1786,1785,1791,1788,1785,1785,1787,1789,1785,1784,1787,1790,1793,1791,1793,1798,
-    1795,1795,1793,1793,1792,1790,1793,1798,1800,1798,1800,1804,1800,1798,1800,1801,
-    1801,1793,1791,1787,1783,1785,1784,1781,1782,1786,1785,1782,1781,1775,1772,1773,
-    1772,1769,1768,1774,1776,1774,1773,1773,1774,1775,1775,1775,1774,1779,1780,1777,
-    1774,1774,1778,1779,1775,1772,1776,1781,1782,1783,1788,1789,1787,1785,1785,1787,
-    1784,1787,1784,1782,1787,1787,1787,1786,1793,1792,1792,1796,1796,1800,1797,1798,
-    1796,1794,1795,1796,1795,1791,1787,1789,1791,1791,1794,1794,1792,1792,1788,1785,
-    1784,1783,1784,1779,1780,1783,1786,1785,1780,1783,1783,1783,1784,1785,1787,1782,
-    1780,1776,1776,1771,1771,1772,1773,1775,1770,1774,1775,1778,1779,1775,1775,1779,
-    1785,1788,1787,1787,1789,1793,1799,1798,1801,1806,1813,1821,1825,1829,1831,1836,
-    1838,1842,1842,1844,1841,1832,1828,1821,1813,1806,1798,1792,1789,1781,1783,1781,
-    1776,1776,1770,1769,1769,1765,1763,1760,1765,1767,1762,1763,1761,1759,1757,1757,
-    1759,1759,1761,1767,1767,1767,1769,1767,1768,1764,1760,1756,1754,1752,1753,1753,
-    1749,1742,1742,1741,1738,1742,1734,1733,1721,1715,1720,1730,1729,1720,1726,1744,
-    1751,1755,1790,1906,2005,1908,1815,1981,2147,2022,1849,1881,1922,1837,1803,1824,
-    1782,1731,1720,1709,1729,1781,1772,1710,1712,1784,1808,1780,1774,1799,1789,1743,
-    1755,1807,1794,1744,1743,1780,1791,1796,1800,1786,1797,1826,1812,1790,1816,1833,
-    1787,1751,1777,1796,1765,1729,1728,1732,1736,1740,1750,1758,1759,1761,1761,1775,
-    1806,1814,1788,1781,1805,1814,1800,1794,1795,1777,1754,1749,1754,1751,1746,1738,
-    1735,1752,1772,1778,1776,1783,1789,1797,1807,1814,1816,1816,1806,1799,1803,1805,
-    1796,1784,1776,1773,1777,1776,1774,1772,1779,1779,1783,1801,1821,1820,1803,1802,
-    1810,1817,1814,1812,1801,1792,1794,1793,1789,1790,1791,1785,1784,1781,1782,1793,
-    1795,1779,1780,1795,1804,1802,1790,1782,1782,1792,1793,1775,1764,1771,1782,1785,
-    1781,1784,1786,1778,1775,1784,1797,1803,1797,1797,1798,1793,1791,1784,1776,1762,
-    1757,1766,1776,1783,1782,1782,1787,1792,1805,1817,1817,1817,1811,1817,1834,1835,
-    1820,1810,1810,1799,1800,1815,1811,1787,1776,1776,1771,1762,1766,1761,1748,1755,
-    1770,1771,1770,1774,1769,1752,1753,1775,1788,1779,1768,1768,1768,1769,1769,1773,
-    1770,1758,1752,1760,1772,1772,1761,1754,1758,1774,1788,1784,1773,1776,1773,1768,
-    1774,1787,1784,1776,1775,1780,1789,1782,1777,1778,1776,1778,1789,1797,1793,1790,
-    1787,1776,1781,1788,1785,1778,1781,1784,1784,1798,1805,1797,1790,1799,1807,1810,
-    1816,1815,1808,1808,1806,1797,1793,1800,1793,1780,1779,1783,1778,1780,1776,1768,
-    1766,1769,1772,1773,1773,1776,1781,1772,1774,1782,1785,1786,1788,1794,1796,1795,
-    1798,1792,1791,1799,1806,1802,1805,1816,1812,1802,1798,1802,1800,1796,1796,1799,
-    1802,1803,1800,1799,1800,1802,1796,1794,1795,1785,1779,1782,1784,1776,1769,1773,
-    1777,1777,1773,1766,1770,1777,1770,1756,1760,1766,1763,1756,1753,1764,1775,1769,
-    1765,1771,1783,1786,1778,1777,1783,1781,1777,1780,1783,1779,1763,1753,1761,1761,
-    1738,1719,1719,1733,1732,1705,1684,1729,1787,1785,1762,1791,1862,1892,1874,1887,
-    1933,1956,1946,1941,1967,1979,1957,1921,1915,1918,1899,1858,1835,1833,1816,1781,
-    1764,1773,1762,1730,1718,1741,1752,1739,1721,1727,1739,1732,1727,1742,1763,1763,
-    1753,1754,1775,1784,1770,1764,1775,1788,1779,1767,1775,1777,1763,1752,1758,1763,
-    1762,1757,1751,1754,1754,1749,1743,1746,1747,1740,1734,1740,1747,1747,1739,1734,
-    1742,1741,1732,1728,1737,1742,1735,1730,1741,1751,1744,1731,1732,1742,1733,1727,
-    1720,1709,1693,1676,1677,1676,1661,1668,1699,1753,1825,1846,1831,1888,2028,2090,
-    2015,1981,2094,2179,2104,2028,2064,2107,2041,1944,1940,1979,1937,1841,1804,1846,
-    1844,1758,1710,1748,1762,1688,1643,1685,1715,1666,1613,1631,1672,1656,1618,1636,
-    1702,1724,1691,1701,1765,1805,1780,1765,1803,1839,1818,1781,1786,1820,1811,1765,
-    1758,1794,1808,1782,1768,1803,1836,1810,1784,1801,1831,1821,1781,1774,1801,1799,
-    1765,1748,1767,1778,1756,1742,1764,1782,1764,1744,1757,1772,1760,1736,1742,1765,
-    1763,1744,1739,1757,1748,1719,1718,1743,1745,1723,1708,1721,1733,1723,1714,1725,
-    1744,1739,1732,1747,1754,1745,1741,1753,1763,1754,1752,1760,1762,1749,1737,1738,
-    1737,1732,1707,1693,1698,1704,1683,1666,1678,1714,1751,1777,1818,1880,1939,1984,
-    2024,2063,2086,2088,2116,2153,2141,2099,2075,2066,2034,1973,1928,1915,1885,1826,
-    1781,1765,1760,1725,1683,1671,1675,1669,1650,1643,1649,1644,1628,1626,1639,1648,
-    1645,1650,1676,1701,1708,1718,1739,1760,1764,1774,1791,1808,1817,1811,1816,1838,
-    1854,1850,1846,1867,1878,1865,1849,1853,1862,1850,1835,1825,1827,1823,1813,1802,
-    1800,1794,1775,1760,1756,1754,1753,1741,1726,1723,1720,1719,1711,1703,1696,1697,
-    1695,1698,1698,1695,1699,1700,1697,1695,1702,1701,1697,1695,1698,1708,1717,1723,
-    1729,1731,1740,1752,1758,1765,1770,1779,1791,1789,1790,1803,1809,1806,1800,1799,
-    1805,1803,1798,1809,1816,1811,1814,1842,1874,1889,1891,1906,1942,1965,1968,1968,
-    1983,1993,1982,1972,1968,1964,1946,1922,1903,1882,1860,1835,1815,1796,1777,1765,
-    1748,1733,1711,1693,1690,1685,1677,1674,1677,1687,1700,1694,1697,1711,1723,1733,
-    1735,1744,1756,1756,1760,1770,1779,1784,1785,1788,1793,1801,1805,1802,1803,1806,
-    1805,1807,1811,1807,1797,1789,1784,1777,1767,1760,1760,1760,1745,1733,1728,1730,
-    1727,1719,1719,1732,1746,1745,1746,1757,1769,1753,1736,1743,1758,1756,1742,1747,
-    1773,1781,1760,1748,1761,1776,1766,1749,1754,1783,1794,1775,1762,1785,1801,1787,
-    1767,1782,1805,1804,1784,1780,1813,1830,1819,1817,1849,1875,1861,1847,1864,1883,
-    1870,1841,1843,1856,1852,1830,1824,1841,1854,1847,1832,1837,1852,1852,1835,1826,
-    1831,1841,1835,1820,1820,1827,1827,1815,1799,1804,1802,1783,1764,1760,1769,1756,
-    1735,1736,1742,1734,1730,1737,1751,1745,1734,1741,1760,1768,1766,1773,1783,1788,
-    1785,1786,1802,1811,1798,1792,1801,1809,1797,1791,1801,1806,1791,1783,1787,1791,
-    1779,1758,1760,1766,1759,1739,1735,1742,1730,1708,1722,1733,1725,1700,1703,1730,
-    1732,1709,1717,1743,1761,1743,1728,1755,1771,1763,1745,1763,1784,1800,1785,1774,
-    1801,1818,1808,1806,1822,1814,1808,1820,1819,1816,1812,1802,1788,1791,1789,1788,
-    1783,1768,1758,1760,1770,1756,1741,1749,1769,1774,1763,1770,1792,1799,1802,1801,
-    1815,1829,1823,1822,1833,1825,1826,1825,1817,1823,1832,1840,1833,1822,1844,1864,
-    1859,1849,1855,1879,1865,1847,1846,1855,1851,1818,1801,1825,1825,1790,1776,1791,
-    1799,1755,1735,1755,1767,1746,1726,1740,1762,1767,1743,1748,1766,1781,1765,1761,
-    1788,1813,1800,1775,1792,1812,1820,1788,1779,1822,1813,1787,1766,1780,1769,1751,
-    1762,1761,1752,1758,1750,1722,1745,1742,1754,1713,1711,1730,1771,1736,1711,1750,
-    1761,1769,1742,1763,1799,1790,1777,1798,1785,1823,1790,1795,1773,1784,1798,1796,
-    1788,1779,1786,1780,1804,1808,1805,1777,1768,1788,1840,1759,1757,1787,1826,1753,
-    1738,1803,1808,1745,1723,1822,1804,1742,1733,1829,1821,1724,1751,1848,1811,1757,
-    1770,1842,1835,1778,1820,1864,1831,1798,1823,1848,1831,1793,1834,1852,1812,1799,
-    1835,1850,1800,1828,1826,1812,1814,1813,1789,1777,1779,1775,1778,1782,1764,1762,
-    1804,1824,1771,1729,1823,1861,1754,1702,1823,1829,1761,1754,1818,1778,1759,1789,
-    1788,1766,1778,1762,1763,1775,1767,1741,1761,1782,1747,1779,1773,1799,1739,1768,
-    1794,1753,1765,1784,1772,1761,1748,1801,1808,1782,1745,1781,1856,1790,1725,1865,
-    1874,1764,1778,1836,1863,1756,1786,1818,1789,1791,1789,1790,1806,1782,1780,1808,
-    1774,1767,1791,1743,1769,1804,1784,1716,1757,1795,1747,1751,1767,1773,1753,1745,
-    1786,1729,1759,1800,1712,1770,1788,1798,1772,1736,1777,1754,1825,1814,1629,1800,
-    1900,1735,1700,1808,1925,1741,1664,1887,1855,1761,1732,1854,1857,1764,1774,1843,
-    1847,1788,1793,1776,1846,1790,1784,1789,1815,1823,1792,1766,1848,1882,1723,1727,
-    1863,1857,1759,1656,1770,1918,1730,1700,1812,1860,1833,1744,1778,1841,1776,1776,
-    1747,1769,1865,1815,1697,1738,1859,1865,1713,1637,1888,1899,1677,1683,1831,1924,
-    1777,1586,1855,1870,1788,1694,1691,1906,1811,1689,1709,1811,1885,1716,1679,1837,
-    1815,1809,1704,1812,1754,1868,1803,1696,1826,1845,1796,1700,1812,1838,1800,1719,
-    1760,1813,1859,1725,1699,1816,1867,1791,1675,1720,1932,1738,1701,1820,1779,1790,
-    1693,1851,1769,1724,1793,1810,1762,1739,1789,1838,1792,1812,1750,1853,1846,1744,
-    1845,1782,1812,1747,1859,1764,1746,1841,1809,1779,1721,1818,1856,1684,1661,1888,
-    1837,1681,1723,1891,1791,1677,1805,1818,1785,1707,1719,1771,1805,1831,1674,1703,
-    1879,1728,1751,1765,1743,1872,1725,1762,1786,1849,1816,1709,1784,1813,1825,1787,
-    1791,1730,1859,1829,1742,1780,1818,1923,1703,1697,1894,1962,1720,1601,1861,1954,
-    1742,1642,1798,2011,1694,1608,1898,1886,1745,1633,1876,1767,1771,1845,1763,1690,
-    1795,1885,1706,1723,1826,1820,1842,1705,1818,1979,1797,1712,1813,1860,1739,1685,
-    1820,1805,1619,1768,1807,1803,1710,1723,1848,1791,1732,1782,1839,1789,1725,1790,
-    1874,1774,1792,1831,1767,1664,1876,1953,1688,1612,1827,2057,1704,1616,1863,1932,
-    1806,1592,1825,1955,1775,1695,1733,1949,1846,1713,1760,1807,1842,1827,1750,1711,
-    1856,1886,1758,1704,1839,1868,1787,1669,1789,1872,1809,1696,1778,1854,1827,1703,
-    1763,1841,1835,1749,1675,1799,1842,1923,1565,1703,1936,1843,1689,1607,1935,1875,
-    1650,1793,1787,1871,1775,1707,1811,1767,1919,1761,1651,1816,2003,1829,1556,1799,
-    2044,1824,1592,1704,1977,1870,1667,1696,1788,1879,1804,1726,1656,1856,1896,1729,
-    1633,1841,1909,1722,1710,1766,1829,1832,1767,1699,1792,1841,1845,1696,1767,1823,
-    1801,1758,1743,1770,1889,1753,1690,1741,1893,1886,1634,1812,1818,1844,1762,1825,
-    1738,1840,1802,1777,1799,1694,1946,1742,1642,1779,1905,1829,1622,1774,1966,1772,
-    1762,1785,1822,1816,1759,1750,1828,1829,1689,1888,1757,1738,1824,1889,1745,1661,
-    1806,1890,1749,1695,1801,1744,1829,1783,1718,1724,1881,1814,1710,1727,1877,1813,
-    1768,1759,1733,1869,1777,1771,1733,1783,1847,1752,1748,1702,1902,1843,1613,1714,
-    1926,1923,1592,1765,1914,1878,1761,1742,1789,1870,1907,1710,1720,1842,1864,1796,
-    1737,1759,1775,1856,1833,1603,1848,1869,1763,1705,1748,1893,1791,1792,1655,1797,
-    1936,1755,1703,1757,1909,1853,1649,1843,1811,1861,1794,1591,1855,1869,1830,1617,
-    1731,1876,1833,1780,1733,1731,1841,1918,1682,1794,1818,1804,1822,1690,1833,1950,
-    1720,1659,1815,1907,1748,1751,1715,1840,1777,1793,1757,1704,2040,1725,1600,1871,
-    1941,1751,1688,1825,1896,1714,1777,1772,1876,1724,1703,1800,1759,1842,1747,1754,
-    1773,1745,1813,1869,1662,1769,1721,1882,1729,1743,1817,1777,1807,1723,1821,1839,
-    1773,1765,1774,1769,1929,1692,1790,1690,1939,1766,1686,1769,1803,1906,1602,1769,
-    1779,1957,1714,1660,1841,1877,1781,1808,1695,1731,1892,1883,1662,1622,1982,1849,
-    1611,1679,1823,1870,1755,1652,1756,1824,1876,1696,1730,1810,1912,1680,1748,1924,
-    1878,1724,1713,1868,1738,1808,1736,1702,1808,1797,1663,1859,1766,1872,1684,1793,
-    1855,1767,1944,1636,1890,1776,1832,1771,1830,1838,1730,1810,1857,1802,1756,1799,
-    1851,1882,1655,1774,1776,1997,1663,1594,1755,1924,1951,1479,1560,1962,2117,1625,
-    1337,1946,2190,1757,1521,1641,2083,1977,1708,1528,1713,2013,1884,1520,1705,1874,
-    1917,1766,1676,1799,1922,1890,1642,1823,1800,1803,1783,1889,1680,1697,1777,1939,
-    1720,1700,1785,1702,1872,1832,1665,1726,1941,1876,1622,1649,1925,1896,1903,1537,
-    1769,1881,1893,1779,1653,1686,1880,1790,1698,1701,1885,1878,1632,1814,1823,1843,
-    1735,1838,1705,1780,1844,1829,1733,1756,1895,1819,1632,1810,1890,1842,1657,1625,
-    1959,1901,1821,1727,1693,1928,1964,1716,1642,1729,1970,1795,1522,1670,1875,1947,
-    1648,1602,1850,1880,1889,1727,1775,1785,1904,1827,1703,1752,1907,1862,1681,1687,
-    1748,1983,1774,1643,1700,1765,1906,1821,1679,1766,1805,1875,1771,1747,1744,1856,
-    1838,1641,1787,1736,1873,1836,1677,1774,1701,1969,1798,1675,1715,1841,1932,1674,
-    1835,1733,1861,1821,1770,1733,1715,1918,1876,1577,1642,1869,1998,1713,1578,1823,
-    1792,1959,1722,1725,1759,1891,1833,1694,1786,1807,1878,1743,1757,1769,1747,1900,
-    1801,1741,1737,1873,1843,1708,1909,1706,1822,1761,1815,1855,1753,1807,1701,1797,
-    1820,1796,1723,1690,1829,1844,1759,1767,1720,1811,1842,1749,1806,1673,1873,1860,
-    1789,1795,1666,1944,1735,1875,1629,1744,1903,1741,1744,1770,1889,1780,1771,1759,
-    1828,1781,1889,1711,1723,1828,1885,1760,1795,1754,1759,1838,1743,1820,1672,1728,
-    1866,1758,1876,1711,1743,1907,1800,1853,1659,1869,1777,1774,1812,1706,1770,1751,
-    1881,1796,1745,1723,1793,1848,1843,1777,1676,1791,1882,1879,1758,1679,1742,1929,
-    1739,1702,1713,1761,1894,1691,1815,1674,1886,1921,1723,1742,1781,1952,1803,1673,
-    1672,1816,1853,1691,1637,1759,1879,1867,1694,1776,1862,1870,1754,1756,1840,1748,
-    1807,1845,1796,1759,1768,1734,1841,1714,1670,1756,1833,1864,1657,1794,1856,1908,
-    1873,1681,1712,1875,1890,1700,1627,1729,1957,1802,1597,1682,1904,1964,1803,1688,
-    1765,1803,1940,1811,1712,1740,1799,1959,1649,1892,1782,1811,1839,1732,1881,1735,
-    1811,1814,1824,1848,1672,1792,1876,1880,1876,1592,1811,1838,1856,1787,1682,1683,
-    1721,1842,1773,1758,1668,1719,1939,1867,1717,1627,1812,2093,1822,1675,1669,1830,
-    1867,1779,1723,1663,1701,1768,1820,1764,1722,1772,1927,1796,1887,1759,1755,1833,
-    1804,1837,1761,1742,1719,1850,1820,1814,1791,1803,1668,1853,1873,1827,1791,1733,
-    1880,1790,1769,1788,1754,1837,1729,1771,1730,1691,1817,1870,1899,1544,1739,1820,
-    1924,1852,1638,1745,1748,1955,1826,1663,1779,1708,1902,1835,1726,1685,1694,1910,
-    1876,1789,1650,1772,1830,1897,1787,1773,1739,1681,1823,1793,1778,1739,1781,1800,
-    1808,1809,1873,1746,1731,1777,1808,1813,1775,1813,1745,1753,1800,1826,1778,1761,
-    1673,1823,1690,1855,1852,1697,1751,1754,1995,1848,1772,1732,1730,1956,1928,1715,
-    1614,1667,1987,1831,1795,1618,1643,1809,1888,1842,1599,1770,1740,1899,1779,1758,
-    1799,1727,1897,1853,1793,1738,1770,1898,1867,1809,1708,1764,1819,1817,1808,1776,
-    1795,1720,1711,1778,1837,1777,1709,1787,1825,1795,1815,1783,1855,1757,1748,1802,
-    1758,1729,1685,1778,1881,1826,1717,1663,1683,1898,1889,1781,1634,1721,1841,1834,
-    1837,1759,1722,1742,1815,1795,1839,1743,1805,1853,1823,1880,1724,1760,1828,1824,
-    1804,1694,1718,1726,1788,1824,1811,1755,1699,1790,1810,1901,1838,1758,1765,1737,
-    1804,1821,1819,1830,1753,1770,1762,1801,1883,1751,1827,1740,1780,1811,1752,1758,
-    1738,1861,1784,1758,1703,1722,1777,1852,1887,1791,1703,1812,1857,1884,1883,1767,
-    1801,1737,1795,1835,1810,1781,1739,1776,1788,1736,1742,1704,1741,1803,1762,1725,
-    1721,1763,1795,1801,1811,1831,1765,1758,1782,1871,1858,1825,1764,1754,1835,1822,
-    1837,1767,1785,1782,1744,1793,1784,1791,1770,1740,1785,1772,1772,1782,1770,1792,
-    1776,1811,1804,1789,1827,1822,1846,1811,1818,1814,1821,1833,1820,1849,1774,1789,
-    1781,1825,1843,1805,1775,1771,1827,1824,1806,1763,1780,1779,1822,1825,1811,1771,
-    1764,1795,1788,1826,1776,1737,1753,1729,1768,1743,1745,1695,1677,1719,1700,1736,
-    1715,1754,1732,1735,1730,1768,1725,1717,1736,1682,1736,1740,1716,1666,1752,1783,
-    1750,1702,1675,1725,1722,1733,1692,1681,1686,1709,1712,1721,1739,1761,1834,1898,
-    2074,2143,2155,2151,2159,2224,2319,2304,2143,2018,1955,1997,1967,1971,1825,1663,
-    1593,1569,1578,1573,1620,1543,1521,1504,1553,1605,1655,1735,1737,1747,1772,1838,
-    1902,1933,1969,2004,2008,2010,1988,1953,1922,1914,1892,1859,1769,1721,1668,1636,
-    1663,1654,1629,1587,1590,1628,1666,1700,1728,1719,1737,1730,1748,1755,1768,1784,
-    1708,1687,1685,1706,1694,1644,1637,1648,1654,1629,1638,1621,1655,1678,1678,1679,
-    1677,1674,1654,1680,1664,1649,1583,1523,1503,1509,1497,1513,1628,1836,2097,2227,
-    2287,2309,2371,2511,2601,2608,2478,2312,2194,2121,2111,2071,1988,1794,1585,1426,
-    1361,1430,1478,1498,1443,1411,1437,1517,1586,1688,1802,1866,1876,1868,1888,1935,
-    2019,2052,2059,1999,1958,1910,1881,1844,1765,1723,1679,1669,1631,1571,1528,1515,
-    1570,1615,1673,1752,1788,1813,1864,1930,2013,2074,2045,1989,1927,1863,1834,1792,
-    1724,1665,1596,1523,1507,1522,1534,1524,1524,1549,1598,1675,1725,1760,1772,1797,
-    1843,1858,1872,1861,1826,1820,1811,1796,1776,1725,1671,1610,1563,1548,1522,1497,
-    1450,1441,1415,1403,1446,1489,1528,1533,1561,1602,1699,1887,2139,2374,2540,2580,
-    2562,2579,2637,2642,2588,2476,2285,2088,1899,1807,1731,1661,1539,1351,1198,1141,
-    1210,1303,1417,1510,1545,1563,1617,1731,1880,2007,2104,2132,2090,2082,2054,2065,
-    2082,2072,2005,1895,1811,1713,1640,1557,1520,1508,1501,1491,1493,1487,1522,1583,
-    1641,1708,1792,1894,1945,1989,2038,2071,2078,2110,2110,2071,2002,1907,1809,1697,
-    1624,1574,1513,1482,1467,1449,1460,1508,1584,1665,1759,1810,1840,1867,1872,1903,
-    1900,1913,1897,1868,1840,1792,1767,1702,1689,1655,1637,1601,1555,1525,1464,1451,
-    1436,1435,1436,1446,1458,1460,1500,1518,1512,1545,1604,1745,1949,2248,2539,2681,
-    2676,2596,2579,2571,2616,2589,2390,2125,1871,1740,1671,1663,1626,1439,1236,1112,
-    1117,1242,1459,1635,1686,1696,1711,1797,1958,2153,2285,2275,2218,2125,2063,2035,
-    2038,2020,1916,1793,1654,1546,1450,1394,1339,1305,1302,1314,1366,1418,1466,1521,
-    1585,1681,1828,1956,2035,2068,2049,2046,2067,2125,2199,2218,2171,2063,1934,1815,
-    1757,1734,1702,1652,1576,1505,1493,1560,1657,1729,1792,1822,1853,1884,1904,1923,
-    1913,1884,1838,1767,1728,1712,1675,1624,1575,1563,1546,1544,1531,1520,1503,1515,
-    1527,1520,1538,1549,1569,1558,1572,1613,1630,1615,1597,1608,1663,1785,2017,2355,
-    2594,2608,2547,2537,2542,2586,2661,2594,2319,2000,1774,1621,1592,1656,1595,1369,
-    1166,1069,1077,1267,1539,1713,1742,1737,1768,1843,2019,2223,2307,2254,2142,2033,
-    1964,1974,2005,1939,1780,1608,1486,1409,1401,1396,1360,1333,1311,1353,1447,1563,
-    1644,1690,1736,1816,1918,2037,2112,2129,2117,2063,2036,2025,2061,2081,2072,2004,
-    1873,1780,1686,1650,1666,1683,1673,1634,1588,1577,1640,1753,1872,1954,1979,1940,
-    1893,1886,1894,1908,1884,1799,1704,1594,1515,1500,1518,1529,1509,1467,1435,1436,
-    1477,1541,1588,1617,1622,1632,1637,1660,1694,1692,1653,1597,1536,1509,1583,1707,
-    1924,2233,2496,2548,2525,2556,2571,2606,2664,2634,2383,2072,1844,1701,1624,1621,
-    1561,1366,1169,1055,1074,1228,1505,1707,1759,1764,1788,1869,2034,2248,2350,2315,
-    2213,2104,2030,2003,1984,1902,1736,1558,1425,1351,1332,1335,1318,1271,1257,1301,
-    1433,1561,1651,1717,1774,1848,1949,2081,2164,2193,2147,2069,2016,2012,2039,2036,
-    1980,1869,1773,1715,1682,1681,1692,1690,1703,1702,1714,1731,1743,1782,1827,1925,
-    2013,2040,2006,1924,1837,1803,1804,1788,1739,1650,1528,1443,1418,1433,1466,1489,
-    1501,1486,1488,1519,1575,1645,1693,1707,1735,1754,1753,1713,1637,1562,1489,1441,
-    1408,1438,1539,1776,2133,2410,2499,2515,2564,2594,2639,2719,2685,2442,2129,1907,
-    1769,1705,1700,1601,1355,1121,1017,1067,1262,1540,1729,1774,1770,1793,1885,2068,
-    2249,2329,2295,2189,2102,2048,2003,1909,1763,1586,1449,1384,1375,1376,1326,1239,
-    1177,1208,1339,1529,1674,1756,1776,1804,1888,2024,2175,2259,2248,2151,2058,2012,
-    2018,2046,2028,1930,1751,1588,1530,1574,1647,1711,1745,1711,1699,1735,1801,1884,
-    1950,1991,1998,1999,2012,2000,1967,1909,1837,1755,1668,1594,1525,1486,1438,1401,
-    1386,1400,1425,1450,1507,1564,1626,1690,1732,1765,1791,1799,1801,1790,1774,1712,
-    1617,1514,1423,1375,1335,1317,1365,1561,1923,2283,2461,2511,2575,2640,2699,2793,
-    2798,2576,2238,1987,1851,1771,1737,1634,1374,1090,972,1043,1215,1451,1642,1690,
-    1678,1741,1889,2062,2236,2339,2338,2269,2193,2117,2012,1870,1700,1562,1474,1443,
-    1408,1331,1208,1108,1103,1211,1402,1588,1717,1758,1791,1861,1982,2136,2268,2330,
-    2286,2221,2165,2118,2073,2010,1939,1827,1724,1637,1564,1523,1531,1570,1613,1676,
-    1718,1747,1769,1814,1891,1976,2047,2085,2077,2045,1979,1891,1810,1713,1608,1518,
-    1473,1454,1441,1419,1380,1345,1362,1442,1559,1665,1745,1766,1764,1764,1783,1810,
-    1828,1837,1782,1690,1591,1478,1388,1334,1287,1279,1380,1629,1978,2311,2479,2526,
-    2589,2688,2773,2834,2806,2561,2208,1988,1884,1799,1711,1574,1317,1054,990,1078,
-    1239,1427,1577,1628,1643,1757,1926,2082,2208,2296,2302,2252,2196,2103,1976,1851,
-    1743,1635,1563,1501,1403,1271,1153,1121,1185,1309,1453,1563,1625,1676,1760,1889,
-    2058,2192,2267,2274,2237,2211,2186,2142,2069,1992,1915,1834,1745,1647,1560,1514,
-    1519,1581,1663,1714,1705,1675,1681,1757,1895,2027,2090,2070,2005,1943,1906,1888,
-    1839,1748,1628,1520,1470,1472,1480,1452,1401,1353,1366,1452,1553,1635,1682,1703,
-    1721,1741,1771,1800,1797,1749,1689,1594,1494,1404,1315,1240,1278,1470,1761,2124,
-    2419,2491,2454,2549,2724,2828,2874,2800,2479,2101,1945,1914,1821,1716,1537,1222,
-    982,1003,1159,1295,1459,1587,1597,1620,1775,1954,2074,2199,2309,2316,2275,2244,
-    2139,1969,1860,1817,1745,1651,1558,1389,1201,1128,1179,1266,1353,1430,1445,1444,
-    1517,1694,1890,2061,2182,2216,2196,2186,2209,2216,2208,2197,2157,2071,1957,1822,
-    1689,1605,1598,1622,1630,1618,1580,1540,1554,1648,1785,1904,1996,2012,1977,1956,
-    1977,2004,1994,1948,1846,1713,1586,1513,1493,1486,1479,1444,1387,1348,1370,1438,
-    1509,1594,1644,1658,1655,1662,1665,1647,1616,1559,1477,1390,1374,1490,1713,1993,
-    2293,2475,2463,2438,2563,2712,2747,2736,2610,2275,1981,1918,1900,1758,1622,1456,
-    1194,1031,1105,1220,1292,1453,1624,1661,1672,1804,1925,2004,2150,2297,2274,2165,
-    2110,2048,2002,2032,2044,1903,1682,1520,1396,1330,1358,1420,1389,1319,1305,1326,
-    1371,1468,1611,1719,1829,1969,2076,2099,2076,2073,2118,2205,2302,2324,2214,2034,
-    1893,1822,1790,1772,1720,1605,1484,1441,1488,1565,1646,1711,1724,1753,1834,1927,
-    1977,1993,1982,1941,1901,1877,1831,1748,1665,1589,1513,1456,1424,1396,1372,1364,
-    1367,1358,1363,1372,1389,1414,1466,1518,1538,1534,1510,1510,1612,1865,2179,2464,
-    2611,2588,2534,2641,2818,2855,2741,2520,2223,1983,1955,1979,1832,1561,1319,1139,
-    1075,1168,1290,1319,1317,1383,1484,1593,1732,1904,2044,2139,2225,2252,2180,2097,
-    2097,2146,2182,2178,2085,1894,1700,1588,1542,1516,1488,1443,1368,1293,1268,1293,
-    1352,1442,1549,1635,1697,1743,1800,1905,2044,2159,2210,2209,2183,2161,2170,2177,
-    2129,2041,1925,1805,1701,1645,1602,1556,1522,1515,1533,1567,1643,1707,1738,1755,
-    1791,1820,1849,1895,1936,1925,1869,1812,1747,1686,1664,1652,1597,1520,1446,1378,
-    1318,1291,1290,1287,1270,1278,1320,1376,1431,1489,1589,1808,2098,2347,2447,2440,
-    2507,2686,2859,2847,2687,2484,2315,2251,2260,2194,1954,1654,1460,1400,1404,1398,
-    1357,1286,1242,1265,1331,1412,1486,1563,1674,1797,1865,1874,1889,1971,2079,2155,
-    2164,2107,2022,1974,1999,2038,2014,1895,1744,1638,1585,1574,1573,1570,1538,1472,
-    1420,1417,1451,1522,1612,1680,1702,1694,1704,1759,1837,1923,1978,1987,1979,1984,
-    2014,2009,2005,1964,1902,1828,1780,1754,1720,1686,1645,1622,1614,1668,1751,1812,
-    1806,1782,1763,1772,1811,1851,1859,1820,1777,1735,1710,1707,1684,1632,1586,1580,
-    1586,1591,1599,1586,1571,1594,1661,1710,1740,1752,1751,1759,1793,1834,1885,1954,
-    2003,1999,1962,1970,2005,2012,1972,1920,1900,1927,1966,1970,1940,1888,1859,1863,
-    1890,1915,1913,1901,1881,1874,1874,1891,1921,1947,1958,1945,1929,1904,1889,1888,
-    1875,1841,1797,1757,1698,1645,1615,1595,1562,1523,1497,1477,1479,1502,1520,1536,
-    1548,1569,1599,1632,1673,1714,1742,1766,1802,1842,1889,1924,1943,1947,1952,1974,
-    1987,1989,1994,1983,1949,1909,1886,1870,1838,1811,1797,1786,1770,1749,1730,1711,
-    1712,1739,1763,1757,1731,1695,1674,1686,1720,1745,1739,1702,1658,1636,1636,1650,
-    1661,1656,1648,1641,1645,1660,1672,1683,1694,1718,1730,1733,1741,1761,1789,1803,
-    1796,1779,1789,1834,1888,1926,1943,1937,1920,1918,1933,1953,1972,1984,1972,1943,
-    1924,1918,1918,1916,1929,1930,1922,1906,1889,1887,1898,1920,1928,1915,1879,1859,
-    1850,1831,1799,1763,1722,1686,1671,1648,1605,1555,1519,1504,1519,1545,1568,1575,
-    1567,1562,1573,1606,1657,1710,1742,1758,1775,1790,1805,1823,1853,1882,1902,1919,
-    1926,1926,1926,1938,1948,1938,1914,1882,1855,1847,1858,1867,1854,1828,1798,1779,
-    1769,1761,1759,1755,1751,1733,1705,1677,1664,1665,1678,1685,1676,1645,1621,1625,
-    1656,1684,1700,1715,1717,1726,1748,1779,1799,1808,1808,1805,1800,1806,1808,1798,
-    1780,1776,1777,1772,1765,1752,1747,1763,1792,1813,1832,1839,1840,1840,1854,1882,
-    1910,1931,1929,1906,1882,1882,1897,1913,1926,1923,1911,1903,1904,1910,1915,1916,
-    1903,1882,1863,1851,1841,1827,1798,1754,1714,1699,1702,1701,1693,1678,1666,1659,
-    1660,1668,1666,1663,1666,1673,1679,1683,1689,1686,1691,1707,1723,1737,1742,1748,
-    1764,1785,1800,1813,1824,1834,1840,1846,1847,1846,1855,1871,1880,1882,1875,1869,
-    1868,1870,1869,1855,1836,1807,1784,1778,1778,1757,1724,1692,1670,1662,1670,1674,
-    1668,1669,1673,1688,1704,1723,1733,1734,1736,1748,1765,1771,1757,1738,1725,1725,
-    1733,1744,1749,1750,1749,1751,1757,1763,1774,1779,1794,1804,1814,1823,1830,1833,
-    1842,1867,1887,1895,1889,1887,1895,1904,1913,1930,1940,1946,1939,1928,1912,1899,
-    1886,1881,1871,1852,1836,1823,1806,1788,1772,1751,1735,1723,1726,1726,1713,1692,
-    1674,1670,1685,1705,1716,1708,1693,1680,1683,1697,1717,1728,1731,1731,1729,1733,
-    1740,1753,1762,1781,1785,1788,1793,1796,1806,1825,1851,1862,1862,1854,1851,1853,
-    1862,1870,1874,1870,1860,1843,1828,1820,1819,1816,1802,1783,1768,1756,1747,1744,
-    1754,1763,1765,1766,1765,1768,1774,1778,1770,1756,1748,1744,1742,1743,1742,1734,
-    1719,1719,1725,1735,1742,1746,1735,1735,1742,1810,1883,1815,1712,1726,1850,1896,
-    1799,1692,1707,1811,1879,1835,1761,1758,1802,1839,1835,1812,1792,1803,1849,1890,
-    1891,1860,1834,1856,1897,1875,1813,1773,1798,1844,1834,1777,1739,1759,1788,1785,
-    1765,1776,1802,1794,1767,1776,1805,1823,1802,1790,1775,1770,1764,1746,1750,1835,
-    1875,1765,1719,1759,1834,1787,1711,1721,1763,1736,1688,1706,1777,1787,1768,1834,
-    1863,1838,1778,1835,1885,1852,1771,1765,1819,1823,1758,1743,1768,1756,1737,1708,
-    1717,1724,1735,1740,1753,1727,1756,1756,1748,1749,1750,1756,1736,1737,1727,1724,
-    1714,1714,1703,1686,1668,1639,1598,1583,1582,1558,1512,1483,1483,1503,1546,1615,
-    1771,1972,2080,2026,2033,2253,2489,2528,2416,2336,2315,2322,2308,2225,2084,1962,
-    1875,1747,1576,1460,1472,1499,1426,1303,1246,1294,1415,1549,1620,1617,1636,1739,
-    1852,1931,2001,2080,2138,2132,2082,2061,2083,2109,2084,1983,1847,1752,1719,1691,
-    1642,1578,1528,1509,1523,1552,1592,1665,1747,1791,1800,1823,1876,1930,1957,1948,
-    1892,1832,1797,1779,1756,1708,1651,1596,1553,1525,1533,1547,1566,1586,1597,1616,
-    1646,1699,1751,1780,1775,1769,1767,1754,1725,1685,1642,1557,1447,1394,1408,1410,
-    1363,1342,1358,1419,1772,2318,2400,2072,2181,2736,2999,2919,2812,2608,2414,2505,
-    2503,2123,1861,1895,1762,1426,1185,1070,1087,1270,1406,1262,1109,1244,1516,1695,
-    1808,1931,2033,2080,2106,2137,2148,2224,2344,2262,1986,1818,1801,1778,1729,1660,
-    1524,1386,1363,1401,1405,1471,1616,1730,1794,1819,1858,1983,2165,2270,2222,2127,
-    2070,2022,1952,1860,1764,1670,1585,1478,1353,1285,1320,1410,1459,1469,1494,1553,
-    1653,1759,1831,1876,1926,1975,1971,1919,1868,1840,1812,1743,1628,1490,1372,1290,
-    1221,1157,1157,1201,1227,1254,1326,1457,1629,1809,2106,2535,2797,2774,2811,3015,
-    3082,2992,2863,2610,2304,2150,1968,1626,1428,1424,1304,1115,1033,977,999,1226,
-    1499,1608,1675,1811,1915,2002,2146,2236,2264,2279,2240,2097,1930,1808,1750,1726,
-    1671,1584,1477,1410,1382,1387,1473,1599,1689,1753,1806,1855,1893,1960,2061,2118,
-    2136,2136,2080,1987,1927,1894,1838,1766,1690,1598,1508,1475,1458,1466,1533,1617,
-    1661,1668,1694,1732,1753,1786,1829,1823,1789,1759,1732,1695,1676,1677,1662,1636,
-    1612,1583,1569,1591,1610,1602,1560,1504,1473,1475,1501,1526,1525,1508,1496,1525,
-    1615,1706,1897,2318,2650,2607,2538,2715,2815,2726,2632,2443,2152,2036,1962,1669,
-    1448,1466,1449,1353,1324,1277,1283,1506,1729,1749,1800,1967,2048,2069,2082,2030,
-    2018,2096,2053,1850,1702,1673,1663,1646,1602,1547,1568,1660,1700,1688,1710,1794,
-    1888,1942,1949,1890,1857,1874,1849,1765,1721,1753,1785,1769,1721,1660,1638,1692,
-    1736,1728,1733,1744,1715,1681,1673,1675,1701,1764,1791,1754,1754,1798,1812,1808,
-    1820,1816,1784,1780,1799,1776,1735,1708,1662,1607,1597,1631,1641,1634,1639,1610,
-    1558,1526,1503,1491,1489,1486,1469,1460,1457,1445,1450,1519,1712,2050,2346,2435,
-    2476,2617,2748,2716,2585,2407,2218,2111,2005,1786,1605,1602,1629,1573,1506,1468,
-    1472,1597,1752,1821,1886,2010,2077,2033,1953,1882,1848,1866,1856,1766,1694,1676,
-    1655,1605,1571,1585,1672,1798,1882,1909,1936,1979,1979,1896,1802,1764,1768,1774,
-    1755,1702,1613,1538,1491,1457,1447,1505,1603,1659,1674,1691,1724,1786,1842,1861,
-    1886,1944,1986,1990,1969,1936,1896,1867,1827,1761,1733,1749,1757,1742,1738,1714,
-    1680,1681,1692,1684,1695,1734,1758,1789,1837,1840,1799,1779,1749,1689,1655,1645,
-    1593,1529,1501,1456,1373,1334,1346,1352,1376,1447,1519,1664,1927,2124,2175,2274,
-    2441,2498,2486,2440,2298,2203,2253,2188,1958,1878,1942,1910,1834,1773,1669,1637,
-    1706,1685,1625,1719,1854,1847,1787,1751,1726,1755,1802,1771,1750,1819,1866,1844,
-    1828,1838,1840,1852,1821,1729,1686,1708,1700,1654,1632,1625,1620,1631,1612,1563,
-    1562,1628,1674,1694,1726,1765,1791,1807,1809,1777,1763,1795,1816,1806,1823,1868,
-    1891,1874,1841,1807,1794,1818,1844,1839,1842,1870,1872,1855,1856,1872,1870,1856,
-    1841,1821,1812,1816,1796,1752,1729,1699,1642,1599,1581,1578,1570,1560,1527,1480,
-    1456,1449,1430,1449,1518,1569,1574,1569,1570,1562,1593,1698,1809,1858,1914,2016,
-    2126,2191,2198,2195,2261,2360,2355,2258,2229,2274,2258,2148,2017,1936,1934,1939,
-    1868,1807,1830,1845,1767,1676,1648,1665,1694,1694,1657,1656,1700,1699,1638,1609,
-    1617,1617,1624,1637,1638,1640,1660,1662,1641,1659,1704,1741,1773,1781,1753,1723,
-    1724,1724,1710,1707,1713,1716,1738,1766,1771,1791,1846,1879,1877,1894,1937,1973,
-    1992,1979,1938,1914,1903,1876,1850,1853,1856,1844,1829,1807,1779,1764,1751,1733,
-    1734,1742,1731,1701,1681,1670,1649,1635,1616,1592,1579,1574,1566,1553,1552,1540,
-    1516,1497,1476,1447,1444,1470,1494,1512,1571,1698,1806,1825,1850,1978,2140,2212,
-    2190,2192,2293,2410,2396,2274,2237,2281,2235,2107,2007,1978,1989,1960,1862,1788,
-    1807,1812,1734,1682,1686,1675,1639,1615,1599,1607,1638,1634,1617,1628,1637,1642,
-    1675,1722,1744,1743,1748,1761,1769,1756,1738,1743,1759,1736,1674,1640,1649,1671,
-    1673,1676,1706,1745,1780,1792,1796,1829,1876,1895,1894,1901,1910,1909,1900,1878,
-    1859,1862,1869,1857,1845,1863,1882,1873,1854,1841,1836,1843,1834,1804,1795,1806,
-    1785,1727,1691,1682,1676,1667,1656,1641,1628,1619,1594,1553,1537,1542,1532,1523,
-    1519,1505,1475,1444,1432,1452,1513,1615,1748,1820,1818,1859,1989,2108,2135,2129,
-    2172,2272,2330,2266,2202,2244,2263,2167,2063,2021,1994,1972,1925,1861,1863,1889,
-    1812,1708,1701,1709,1652,1608,1616,1611,1609,1615,1610,1636,1688,1691,1679,1716,
-    1753,1746,1734,1761,1786,1786,1769,1749,1759,1776,1738,1672,1658,1681,1676,1665,
-    1672,1693,1704,1704,1704,1706,1722,1749,1774,1801,1833,1836,1827,1839,1859,1883,
-    1905,1930,1947,1947,1930,1899,1882,1876,1871,1858,1848,1829,1795,1770,1762,1757,
-    1749,1744,1733,1710,1695,1687,1666,1649,1643,1617,1579,1542,1518,1494,1461,1433,
-    1412,1385,1368,1386,1421,1458,1529,1661,1769,1798,1842,1981,2118,2172,2175,2202,
-    2301,2388,2361,2292,2304,2341,2269,2146,2070,2026,1996,1956,1906,1889,1893,1839,
-    1746,1715,1716,1667,1630,1642,1652,1645,1640,1629,1636,1668,1680,1669,1697,1723,
-    1697,1678,1710,1747,1746,1740,1739,1751,1751,1709,1672,1693,1723,1703,1672,1678,
-    1697,1693,1681,1684,1725,1784,1810,1801,1825,1885,1910,1886,1875,1907,1938,1946,
-    1933,1926,1942,1951,1916,1874,1860,1864,1854,1835,1827,1827,1827,1818,1803,1788,
-    1775,1754,1722,1691,1664,1647,1639,1628,1611,1576,1548,1528,1515,1494,1471,1454,
-    1437,1415,1394,1406,1461,1520,1591,1695,1782,1820,1892,2011,2101,2139,2158,2223,
-    2312,2370,2326,2269,2279,2276,2173,2070,2041,2029,2002,1957,1907,1886,1882,1812,
-    1717,1702,1724,1684,1639,1635,1641,1631,1620,1602,1602,1633,1636,1614,1627,1656,
-    1656,1662,1698,1727,1739,1751,1753,1745,1741,1727,1712,1711,1711,1700,1692,1695,
-    1703,1698,1693,1710,1729,1750,1778,1814,1837,1849,1868,1887,1897,1905,1901,1901,
-    1923,1949,1938,1917,1924,1922,1891,1872,1868,1869,1886,1889,1864,1835,1820,1787,
-    1743,1719,1700,1671,1650,1632,1604,1580,1569,1557,1538,1530,1524,1513,1507,1509,
-    1501,1497,1496,1486,1471,1491,1548,1600,1674,1757,1788,1819,1935,2053,2113,2155,
-    2199,2254,2332,2352,2277,2237,2270,2222,2110,2049,2022,1990,1980,1938,1848,1817,
-    1824,1764,1693,1698,1683,1647,1652,1649,1611,1624,1655,1636,1619,1644,1648,1643,
-    1669,1671,1650,1682,1736,1726,1703,1707,1704,1689,1684,1669,1657,1677,1700,1690,
-    1687,1717,1737,1723,1726,1760,1792,1821,1845,1865,1891,1912,1911,1906,1934,1969,
-    1969,1961,1964,1958,1955,1947,1933,1926,1931,1932,1914,1898,1884,1857,1832,1819,
-    1802,1770,1742,1718,1677,1639,1604,1582,1566,1556,1540,1512,1510,1516,1510,1496,
-    1507,1527,1517,1489,1493,1498,1475,1465,1484,1519,1574,1693,1849,1931,1944,2016,
-    2130,2204,2207,2163,2159,2273,2363,2275,2182,2254,2281,2133,2002,1928,1858,1848,
-    1843,1744,1724,1828,1800,1667,1675,1715,1656,1654,1696,1675,1703,1786,1742,1671,
-    1704,1693,1622,1679,1740,1700,1716,1778,1738,1695,1719,1682,1646,1697,1706,1650,
-    1676,1695,1629,1608,1626,1610,1635,1701,1732,1770,1849,1882,1888,1945,2000,2020,
-    2057,2091,2069,2047,2018,1947,1889,1873,1844,1813,1826,1836,1813,1809,1798,1768,
-    1753,1760,1739,1724,1727,1693,1643,1612,1589,1562,1558,1555,1558,1585,1602,1582,
-    1574,1578,1559,1541,1545,1526,1502,1477,1438,1405,1422,1438,1479,1546,1701,2106,
-    2508,2511,2402,2641,2750,2517,2390,2305,1994,1865,1916,1655,1458,1679,1761,1635,
-    1764,1853,1736,1872,2057,1936,1933,2081,1934,1735,1761,1691,1592,1679,1678,1573,
-    1654,1722,1649,1688,1786,1781,1840,1917,1840,1761,1751,1669,1588,1591,1567,1549,
-    1572,1542,1503,1533,1563,1601,1702,1776,1819,1882,1888,1871,1928,1967,1957,2002,
-    2024,1972,1967,1974,1921,1921,1960,1913,1860,1854,1797,1750,1791,1831,1857,1940,
-    1988,1943,1906,1868,1789,1740,1723,1675,1631,1602,1552,1505,1492,1495,1525,1563,
-    1586,1618,1650,1667,1683,1699,1672,1664,1672,1626,1561,1552,1556,1549,1573,1574,
-    1558,1604,1673,1684,1718,1807,2016,2413,2659,2497,2367,2534,2521,2239,2066,1942,
-    1756,1696,1639,1451,1502,1772,1842,1806,1872,1895,1904,2028,2062,2003,2023,1973,
-    1775,1644,1609,1563,1600,1655,1593,1539,1575,1604,1645,1740,1805,1842,1872,1816,
-    1703,1643,1640,1655,1666,1654,1628,1606,1570,1556,1600,1669,1758,1857,1903,1915,
-    1964,1998,1990,2013,2044,2024,2009,2010,1968,1930,1924,1886,1821,1771,1730,1696,
-    1692,1705,1748,1828,1899,1926,1927,1924,1913,1871,1810,1753,1695,1616,1548,1505,
-    1467,1458,1488,1489,1506,1584,1660,1690,1720,1747,1732,1723,1689,1640,1621,1658,
-    1678,1683,1665,1632,1615,1644,1677,1697,1734,1770,1792,1804,1840,1957,2265,2490,
-    2405,2259,2316,2330,2153,1986,1857,1738,1694,1651,1557,1612,1799,1898,1922,1943,
-    1911,1895,1968,1992,1944,1920,1812,1625,1513,1469,1437,1473,1540,1568,1577,1596,
-    1621,1696,1801,1855,1868,1873,1847,1778,1727,1705,1714,1738,1724,1683,1660,1670,
-    1702,1744,1817,1872,1913,1940,1950,1968,2018,2065,2054,2032,2006,1950,1867,1826,
-    1805,1782,1763,1735,1689,1665,1690,1724,1752,1776,1796,1803,1814,1818,1800,1769,
-    1730,1673,1611,1565,1530,1525,1560,1586,1600,1642,1713,1728,1718,1749,1800,1808,
-    1776,1744,1712,1686,1652,1628,1643,1670,1668,1635,1630,1664,1689,1693,1694,1689,
-    1687,1705,1835,2187,2482,2433,2295,2376,2444,2331,2136,1919,1756,1680,1561,1433,
-    1533,1743,1840,1881,1921,1931,1993,2050,2024,2015,2006,1862,1660,1546,1472,1453,
-    1482,1470,1453,1507,1564,1620,1731,1835,1888,1918,1900,1848,1815,1793,1761,1741,
-    1706,1644,1641,1658,1665,1709,1785,1833,1892,1930,1920,1932,1983,1993,2000,2031,
-    2012,1940,1888,1848,1827,1848,1814,1756,1714,1691,1662,1665,1691,1712,1734,1732,
-    1711,1713,1737,1768,1785,1768,1703,1642,1611,1605,1627,1643,1630,1616,1622,1612,
-    1620,1672,1732,1765,1771,1771,1765,1776,1776,1754,1729,1715,1704,1657,1619,1598,
-    1616,1590,1546,1504,1537,1552,1704,2126,2441,2406,2348,2514,2623,2566,2314,2033,
-    1872,1746,1501,1383,1501,1661,1738,1729,1719,1849,2025,2063,2045,2082,2086,1961,
-    1814,1725,1690,1660,1586,1465,1394,1393,1410,1466,1579,1698,1789,1823,1841,1862,
-    1902,1902,1879,1834,1767,1703,1656,1650,1682,1745,1767,1768,1770,1809,1885,1959,
-    2003,2022,2014,1982,1954,1925,1872,1821,1765,1721,1689,1692,1696,1699,1706,1690,
-    1653,1627,1639,1663,1701,1722,1717,1719,1751,1769,1758,1760,1763,1740,1709,1680,
-    1652,1649,1676,1668,1646,1645,1672,1685,1723,1784,1821,1829,1825,1803,1774,1789,
-    1800,1790,1756,1720,1708,1735,1789,1806,1812,1853,1899,1911,1910,1926,1991,2072,
-    2078,2014,1958,1945,1939,1911,1875,1873,1878,1860,1807,1791,1812,1879,1923,1874,
-    1808,1779,1770,1759,1766,1796,1825,1826,1792,1765,1760,1761,1769,1757,1726,1676,
-    1653,1654,1682,1701,1714,1723,1732,1741,1759,1783,1798,1831,1849,1837,1804,1787,
-    1772,1768,1745,1727,1738,1776,1781,1774,1807,1836,1847,1817,1780,1757,1773,1779,
-    1773,1772,1766,1744,1705,1669,1675,1703,1703,1672,1660,1697,1751,1783,1785,1805,
-    1820,1781,1730,1735,1759,1768,1745,1696,1659,1667,1700,1714,1750,1790,1814,1837,
-    1840,1857,1877,1885,1845,1787,1756,1756,1785,1806,1820,1803,1793,1790,1775,1779,
-    1798,1840,1859,1867,1833,1848,1892,1933,1953,1938,1909,1855,1833,1807,1814,1833,
-    1834,1820,1826,1829,1850,1883,1906,1896,1866,1820,1793,1806,1835,1866,1855,1809,
-    1761,1715,1694,1705,1727,1745,1739,1708,1667,1672,1714,1762,1792,1780,1767,1765,
-    1779,1784,1795,1826,1822,1801,1767,1753,1756,1791,1797,1797,1776,1772,1774,1784,
-    1791,1796,1804,1780,1767,1757,1787,1798,1818,1798,1772,1755,1739,1725,1710,1739,
-    1739,1735,1726,1706,1744,1755,1770,1753,1749,1755,1747,1761,1761,1767,1763,1748,
-    1721,1765,1779,1788,1783,1803,1815,1812,1798,1791,1829,1822,1817,1778,1785,1808,
-    1815,1799,1789,1794,1842,1842,1814,1821,1831,1839,1780,1783,1812,1840,1839,1780,
-    1795,1770,1797,1794,1776,1804,1757,1794,1762,1772,1775,1784,1795,1768,1776,1797,
-    1811,1795,1805,1804,1838,1829,1838,1812,1786,1795,1756,1780,1747,1771,1759,1731,
-    1758,1767,1766,1777,1827,1829,1837,1791,1796,1783,1797,1790,1771,1793,1724,1765,
-    1753,1755,1811,1796,1850,1792,1810,1797,1772,1802,1781,1797,1765,1778,1785,1760,
-    1743,1763,1774,1787,1763,1753,1754,1777,1793,1810,1776,1812,1793,1791,1790,1815,
-    1855,1799,1809,1743,1787,1784,1777,1751,1780,1764,1823,1752,1811,1780,1793,1793,
-    1760,1792,1719,1837,1708,1805,1738,1764,1785,1716,1806,1760,1781,1770,1710,1767,
-    1748,1802,1785,1836,1808,1834,1813,1837,1820,1815,1847,1738,1820,1726,1779,1761,
-    1771,1779,1792,1805,1775,1768,1839,1801,1840,1823,1798,1766,1833,1730,1770,1820,
-    1747,1834,1687,1813,1716,1725,1773,1749,1837,1732,1862,1760,1797,1829,1709,1870,
-    1704,1863,1702,1820,1737,1786,1764,1748,1825,1720,1885,1735,1886,1735,1882,1750,
-    1861,1776,1817,1817,1769,1833,1752,1847,1735,1822,1758,1819,1787,1804,1815,1795,
-    1796,1839,1777,1845,1792,1794,1768,1743,1773,1746,1779,1754,1771,1774,1748,1806,
-    1752,1802,1792,1746,1788,1716,1794,1717,1784,1714,1801,1721,1788,1763,1800,1765,
-    1798,1778,1741,1829,1721,1817,1739,1819,1762,1830,1722,1786,1756,1809,1779,1781,
-    1792,1740,1801,1758,1801,1792,1772,1774,1774,1758,1808,1735,1821,1768,1781,1801,
-    1743,1797,1749,1823,1781,1782,1828,1772,1819,1803,1776,1858,1785,1786,1870,1721,
-    1937,1699,1889,1775,1808,1877,1718,1886,1736,1849,1740,1771,1789,1777,1825,1782,
-    1793,1837,1743,1882,1722,1870,1770,1837,1799,1766,1827,1747,1828,1733,1807,1750,
-    1786,1784,1804,1740,1820,1755,1820,1793,1772,1797,1791,1787,1774,1770,1821,1773,
-    1808,1782,1769,1781,1778,1788,1762,1807,1743,1843,1695,1850,1692,1822,1756,1772,
-    1778,1744,1795,1692,1841,1675,1868,1678,1827,1751,1776,1810,1743,1866,1735,1838,
-    1797,1782,1827,1795,1795,1828,1767,1826,1783,1790,1798,1756,1816,1763,1813,1787,
-    1803,1806,1766,1824,1765,1827,1765,1805,1776,1783,1799,1756,1811,1765,1803,1781,
-    1787,1791,1805,1777,1817,1779,1789,1797,1744,1811,1726,1821,1750,1776,1791,1739,
-    1799,1755,1806,1770,1827,1780,1807,1786,1802,1770,1792,1787,1765,1786,1756,1812,
-    1760,1788,1783,1765,1785,1761,1767,1790,1754,1809,1740,1810,1765,1783,1791,1772,
-    1793,1768,1803,1778,1802,1776,1802,1758,1780,1776,1786,1776,1802,1772,1784,1781,
-    1767,1794,1761,1793,1766,1775,1783,1750,1784,1765,1783,1785,1792,1803,1772,1830,
-    1782,1826,1787,1785,1814,1774,1816,1771,1778,1803,1769,1785,1788,1774,1802,1766,
-    1799,1800,1775,1823,1769,1793,1774,1776,1774,1766,1770,1768,1784,1749,1796,1754,
-    1775,1775,1759,1793,1771,1787,1799,1772,1794,1786,1799,1798,1801,1800,1791,1796,
-    1789,1789,1803,1803,1790,1804,1794,1809,1796,1825,1815,1817,1815,1806,1780,1821,
-    1779,1803,1800,1765,1808,1745,1809,1769,1793,1792,1779,1819,1765,1797,1774,1767,
-    1794,1757,1781,1768,1773,1776,1763,1789,1782,1788,1789,1772,1802,1785,1791,1790,
-    1767,1798,1753,1787,1766,1774,1785,1763,1785,1759,1780,1762,1766,1758,1754,1779,
-    1776,1788,1796,1800,1809,1801,1801,1813,1799,1805,1791,1793,1795,1781,1788,1783,
-    1804,1796,1798,1805,1800,1808,1810,1791,1802,1792,1783,1782,1772,1769,1770,1777,
-    1767,1770,1769,1777,1777,1778,1789,1786,1788,1787,1767,1788,1775,1785,1781,1788,
-    1794,1781,1802,1770,1790,1784,1775,1785,1767,1785,1774,1780,1782,1778,1795,1791,
-    1792,1790,1798,1781,1783,1781,1783,1793,1779,1790,1782,1785,1786,1784,1784,1785,
-    1784,1784,1786,1793,1805,1797,1809,1803,1794,1807,1800,1776,1796,1780,1776,1772,
-    1773,1784,1776,1790,1769,1768,1768,1770,1755,1782,1773,1771,1780,1762,1788,1767,
-    1782,1791,1772,1790,1776,1784,1790,1781,1791,1788,1804,1791,1801,1795,1795,1801,
-    1791,1792,1800,1802,1797,1799,1796,1801,1794,1808,1785,1811,1799,1810,1800,1807,
-    1802,1786,1818,1764,1802,1785,1777,1788,1782,1778,1777,1781,1767,1778,1771,1769,
-    1785,1769,1793,1791,1783,1799,1786,1784,1787,1773,1782,1782,1767,1782,1775,1785,
-    1773,1797,1788,1783,1799,1786,1790,1803,1789,1804,1800,1792,1808,1788,1792,1795,
-    1777,1804,1789,1778,1816,1773,1813,1808,1795,1832,1780,1806,1814,1777,1805,1768,
-    1766,1787,1764,1776,1773,1776,1794,1791,1776,1773,1788,1777,1786,1776,1783,1789,
-    1766,1791,1759,1778,1797,1753,1794,1781,1773,1804,1767,1796,1784,1791,1790,1774,
-    1799,1769,1791,1784,1784,1787,1791,1779,1781,1768,1766,1775,1766,1782,1778,1795,
-    1784,1773,1792,1787,1778,1800,1767,1801,1790,1768,1811,1760,1784,1822,1760,1824,
-    1781,1783,1805,1765,1817,1768,1796,1775,1785,1783,1766,1776,1774,1769,1778,1764,
-    1746,1791,1753,1782,1788,1767,1790,1771,1802,1786,1775,1816,1762,1786,1811,1753,
-    1790,1802,1770,1803,1792,1791,1826,1795,1802,1827,1779,1797,1812,1754,1805,1793,
-    1791,1779,1773,1828,1749,1798,1774,1791,1798,1785,1840,1740,1802,1807,1755,1783,
-    1783,1764,1779,1800,1715,1805,1796,1719,1817,1772,1744,1828,1753,1777,1789,1774,
-    1819,1738,1791,1774,1776,1812,1768,1765,1840,1764,1765,1821,1748,1785,1814,1746,
-    1771,1825,1762,1808,1788,1823,1789,1793,1829,1755,1848,1819,1771,1805,1823,1704,
-    1855,1826,1709,1870,1788,1781,1756,1856,1754,1791,1845,1707,1881,1779,1750,1825,
-    1775,1770,1778,1806,1754,1776,1838,1773,1785,1816,1789,1788,1805,1811,1733,1816,
-    1829,1696,1831,1766,1759,1835,1691,1865,1785,1745,1843,1798,1828,1815,1795,1814,
-    1796,1743,1745,1724,1791,1699,1788,1759,1708,1775,1816,1776,1787,1806,1780,1792,
-    1819,1828,1708,1874,1820,1845,1794,1757,1847,1803,1762,1735,1778,1884,1793,1740,
-    1863,1777,1807,1789,1713,1721,1700,1703,1728,1737,1738,1769,1806,1785,1817,1807,
-    1852,1807,1841,1839,1808,1872,1820,1790,1804,1826,1740,1800,1774,1752,1802,1770,
-    1749,1772,1792,1779,1779,1804,1789,1797,1824,1784,1790,1835,1819,1765,1793,1781,
-    1786,1803,1783,1773,1794,1780,1782,1786,1779,1806,1787,1786,1782,1781,1782,1794,
-    1797,1780,1753,1771,1784,1757,1781,1759,1775,1784,1764,1762,1785,1790,1775,1757,
-    1734,1760,1730,1726,1726,1735,1721,1697,1724,1713,1737,1730,1694,1746,1718,1704,
-    1701,1713,1726,1702,1731,1765,1866,1910,1874,1913,1986,2028,2034,2010,2006,1995,
-    2003,1951,1908,1920,1895,1805,1770,1746,1702,1739,1693,1648,1670,1666,1657,1671,
-    1700,1729,1745,1758,1747,1759,1815,1844,1837,1831,1856,1849,1826,1854,1823,1843,
-    1836,1765,1770,1748,1760,1753,1732,1714,1720,1741,1749,1758,1780,1830,1834,1824,
-    1827,1832,1880,1878,1822,1821,1819,1809,1791,1762,1755,1754,1729,1706,1686,1699,
-    1727,1718,1709,1697,1708,1740,1742,1709,1727,1752,1753,1743,1723,1748,1743,1742,
-    1703,1670,1672,1654,1600,1560,1555,1540,1535,1481,1444,1515,1755,2000,1968,1809,
-    1999,2352,2443,2386,2303,2216,2286,2356,2189,2042,2068,2004,1755,1632,1558,1518,
-    1609,1544,1330,1307,1452,1496,1537,1605,1596,1681,1814,1791,1817,1977,2066,2042,
-    2005,1970,1953,2069,2082,1926,1840,1801,1788,1780,1733,1647,1615,1616,1561,1524,
-    1569,1640,1681,1689,1653,1672,1790,1877,1895,1916,1916,1938,1984,1990,1961,1944,
-    1915,1862,1825,1777,1755,1729,1690,1651,1642,1660,1681,1694,1696,1710,1739,1751,
-    1780,1800,1782,1793,1796,1786,1788,1779,1729,1701,1706,1673,1665,1659,1602,1572,
-    1557,1548,1558,1561,1557,1576,1603,1634,1669,1726,1781,1859,1978,2053,2114,2190,
-    2200,2248,2367,2333,2234,2165,2059,2035,2050,1926,1759,1660,1605,1573,1579,1518,
-    1424,1448,1511,1532,1552,1593,1625,1715,1798,1794,1814,1892,1942,1952,1968,1956,
-    1969,2009,1991,1937,1890,1866,1850,1832,1787,1726,1685,1674,1661,1638,1626,1616,
-    1643,1661,1672,1706,1744,1780,1821,1833,1836,1867,1910,1931,1903,1875,1857,1858,
-    1845,1836,1793,1752,1750,1750,1744,1734,1721,1697,1698,1715,1727,1746,1746,1721,
-    1723,1742,1764,1765,1754,1728,1709,1703,1715,1718,1697,1683,1657,1638,1634,1633,
-    1613,1606,1602,1586,1597,1617,1628,1643,1666,1810,1972,1931,1875,1997,2148,2274,
-    2333,2145,1997,2119,2238,2265,2198,1933,1775,1886,1961,1908,1799,1619,1523,1640,
-    1701,1641,1601,1540,1531,1641,1717,1694,1692,1711,1733,1824,1868,1842,1843,1879,
-    1907,1914,1893,1845,1842,1856,1840,1776,1737,1722,1726,1733,1683,1633,1620,1647,
-    1667,1672,1650,1632,1668,1711,1746,1769,1785,1777,1798,1839,1873,1910,1884,1862,
-    1854,1843,1852,1849,1822,1792,1784,1767,1753,1772,1774,1762,1766,1755,1742,1775,
-    1801,1817,1815,1775,1757,1766,1781,1774,1768,1735,1708,1694,1685,1707,1718,1707,
-    1685,1687,1710,1743,1754,1745,1732,1753,1800,1804,1796,1799,1804,1827,1845,1834,
-    1817,1831,1838,1834,1851,1825,1804,1810,1812,1819,1827,1821,1800,1804,1810,1832,
-    1855,1852,1834,1837,1869,1897,1910,1891,1874,1871,1891,1904,1896,1872,1839,1835,
-    1832,1813,1789,1760,1735,1720,1710,1686,1667,1658,1646,1643,1648,1635,1638,1658,
-    1654,1661,1672,1689,1710,1736,1757,1774,1795,1822,1856,1877,1877,1872,1881,1896,
-    1911,1903,1888,1872,1860,1860,1862,1859,1836,1821,1812,1794,1800,1799,1789,1788,
-    1772,1753,1750,1750,1752,1766,1760,1738,1734,1737,1748,1761,1746,1709,1704,1725,
-    1735,1755,1751,1727,1732,1756,1769,1781,1780,1773,1781,1795,1813,1815,1802,1790,
-    1796,1807,1816,1810,1790,1785,1782,1792,1789,1784,1781,1778,1777,1758,1768,1773,
-    1769,1777,1774,1761,1778,1786,1799,1810,1797,1794,1792,1816,1833,1846,1842,1828,
-    1826,1812,1808,1815,1793,1769,1755,1737,1736,1745,1733,1724,1724,1718,1722,1737,
-    1741,1751,1772,1768,1781,1809,1817,1825,1837,1821,1819,1839,1838,1839,1848,1838,
-    1832,1840,1841,1840,1838,1832,1819,1820,1818,1817,1812,1794,1798,1798,1792,1780,
-    1770,1781,1784,1781,1761,1757,1769,1780,1778,1761,1750,1746,1756,1761,1748,1743,
-    1749,1747,1760,1768,1770,1778,1789,1796,1802,1820,1825,1821,1816,1810,1802,1818,
-    1821,1811,1801,1788,1790,1798,1801,1785,1774,1765,1756,1763,1767,1761,1755,1745,
-    1737,1746,1759,1753,1753,1760,1757,1772,1791,1791,1801,1802,1793,1795,1798,1798,
-    1816,1822,1816,1806,1786,1784,1794,1806,1793,1776,1764,1774,1798,1804,1789,1776,
-    1766,1766,1786,1779,1774,1773,1774,1775,1783,1788,1777,1775,1784,1785,1791,1802,
-    1789,1790,1792,1782,1780,1783,1774,1778,1790,1785,1779,1788,1789,1797,1812,1798,
-    1802,1807,1812,1824,1819,1810,1791,1795,1795,1789,1793,1787,1775,1770,1768,1766,
-    1774,1776,1769,1772,1781,1780,1785,1791,1784,1782,1784,1780,1785,1784,1779,1778,
-    1782,1775,1780,1789,1785,1789,1790,1788,1783,1781,1777,1774,1771,1769,1769,1764,
-    1763,1760,1764,1767,1774,1787,1800,1811,1813,1816,1807,1814,1814,1816,1812,1800,
-    1801,1804,1806,1793,1791,1783,1774,1773,1775,1774,1780,1787,1776,1769,1765,1767,
-    1769,1775,1778,1777,1786,1790,1797,1801,1788,1787,1792,1795,1804,1803,1793,1793,
-    1792,1797,1798,1789,1789,1791,1797,1793,1788,1786,1784,1789,1796,1795,1793,1786,
-    1789,1793,1789,1778,1782,1788,1786,1789,1780,1771,1767,1768,1769,1768,1764,1766,
-    1769,1776,1784,1784,1784,1788,1790,1790,1799,1802,1796,1800,1799,1792,1798,1795,
-    1795,1803,1795,1787,1782,1778,1775,1783,1775,1770,1773,1771,1772,1779,1787,1783,
-    1787,1784,1785,1791,1790,1790,1798,1796,1789,1784,1784,1790,1801,1791,1785,1791,
-    1792,1796,1783,1774,1772,1780,1777,1767,1770,1775,1781,1781,1764,1766,1775,1780,
-    1782,1783,1783,1790,1806,1808,1803,1807,1810,1810,1812,1807,1806,1809,1804,1796,
-    1795,1794,1788,1790,1794,1789,1799,1795,1791,1792,1798,1798,1790,1788,1782,1787,
-    1786,1785,1784,1778,1773,1773,1771,1768,1768,1766,1761,1761,1761,1766,1772,1774,
-    1777,1771,1779,1789,1793,1795,1794,1793,1799,1810,1804,1803,1801,1794,1796,1797,
-    1789,1783,1786,1787,1790,1791,1784,1781,1785,1787,1787,1782,1779,1781,1781,1778,
-    1775,1772,1769,1772,1765,1760,1775,1778,1773,1776,1771,1776,1781,1780,1778,1785,
-    1786,1781,1784,1778,1783,1791,1794,1795,1802,1802,1800,1803,1803,1798,1802,1805,
-    1806,1807,1806,1804,1802,1800,1789,1784,1784,1780,1777,1778,1773,1778,1781,1770,
-    1765,1761,1763,1768,1767,1770,1775,1781,1782,1783,1788,1789,1791,1791,1786,1779,
-    1785,1789,1787,1785,1782,1773,1776,1777,1774,1777,1764,1761,1771,1773,1773,1784,
-    1787,1786,1788,1789,1785,1791,1790,1789,1792,1801,1807,1808,1807,1800,1795,1790,
-    1789,1784,1787,1782,1781,1782,1779,1781,1776,1780,1781,1787,1789,1784,1788,1792,
-    1796,1800,1802,1796,1790,1785,1788,1786,1790,1785,1784,1786,1782,1789,1793,1793,
-    1787,1782,1779,1782,1785,1784,1787,1786,1786,1787,1785,1789,1793,1794,1796,1798,
-    1799,1804,1804,1803,1794,1794,1791,1787,1791,1785,1780,1770,1770,1770,1772,1769,
-    1771,1771,1775,1779,1782,1787,1787,1784,1783,1786,1787,1792,1799,1796,1788,1787,
-    1784,1791,1794,1790,1783,1780,1777,1780,1786,1784,1778,1777,1782,1780,1777,1775,
-    1774,1781,1787,1795,1800,1798,1801,1799,1802,1803,1807,1800,1800,1798,1791,1793,
-    1790,1793,1789,1790,1787,1790,1793,1792,1792,1791,1788,1787,1792,1797,1797,1795,
-    1790,1790,1792,1790,1793,1791,1789,1784,1777,1778,1776,1769,1764,1765,1765,1771,
-    1772,1773,1770,1768,1772,1770,1773,1775,1777,1776,1778,1777,1779,1782,1784,1784,
-    1778,1777,1779,1786,1787,1785,1784,1787,1787,1791,1799,1796,1797,1794,1792,1790,
-    1788,1790,1792,1790,1787,1781,1782,1784,1785,1787,1781,1780,1779,1779,1780,1777,
-    1771,1766,1767,1773,1776,1781,1783,1788,1792,1789,1793,1791,1783,1782,1784,1787,
-    1787,1787,1778,1774,1781,1780,1781,1783,1782,1789,1789,1790,1786,1789,1787,1786,
-    1792,1790,1788,1789,1788,1790,1788,1781,1784,1789,1793,1810,1878,1804,1699,1733,
-    1845,1873,1738,1657,1719,1854,1884,1789,1709,1740,1812,1839,1794,1772,1788,1770,
-    1765,1784,1803,1764,1716,1726,1775,1810,1808,1809,1787,1791,1819,1827,1795,1741,
-    1754,1783,1791,1772,1767,1784,1804,1811,1805,1795,1791,1794,1800,1793,1780,1787,
-    1793,1791,1789,1778,1781,1783,1777,1770,1770,1796,1788,1788,1773,1796,1813,1819,
-    1783,1778,1793,1803,1810,1787,1793,1789,1792,1784,1809,1802,1771,1767,1797,1797,
-    1781,1764,1796,1787,1761,1736,1762,1800,1772,1769,1760,1791,1815,1863,1861,1772,
-    1677,1743,1880,1849,1655,1601,1750,1874,1810,1683,1751,1825,1844,1787,1808,1817,
-    1691,1714,1827,1915,1716,1611,1740,1918,1895,1677,1695,1844,1895,1737,1732,1835,
-    1868,1720,1736,1868,1894,1746,1661,1804,1885,1808,1639,1767,1916,1792,1679,1769,
-    1923,1779,1724,1753,1854,1830,1741,1795,1790,1823,1692,1858,1773,1840,1701,1819,
-    1857,1741,1788,1757,1832,1737,1823,1617,1820,1840,1828,1743,1699,1847,1792,1808,
-    1742,1770,1912,1686,1786,1800,1786,1808,1744,1935,1620,1720,1854,1882,1800,1714,
-    1706,1769,1925,1832,1737,1734,1837,1840,1757,1738,1879,1770,1724,1721,1923,1814,
-    1627,1826,1822,1849,1776,1783,1745,1782,1812,1944,1747,1730,1790,1850,1941,1736,
-    1808,1748,1775,1920,1827,1773,1682,1737,1898,1795,1847,1666,1720,1744,1913,1905,
-    1735,1691,1752,1859,1858,1884,1662,1692,1781,1920,1716,1748,1771,1782,1783,1811,
-    1811,1787,1763,1740,1940,1771,1784,1726,1823,1845,1828,1811,1730,1725,1804,1866,
-    1753,1821,1701,1809,1752,1843,1819,1720,1796,1728,1832,1729,1803,1777,1791,1778,
-    1791,1743,1799,1801,1778,1793,1753,1798,1723,1799,1848,1826,1686,1752,1806,1862,
-    1792,1730,1710,1745,1892,1824,1775,1769,1745,1756,1862,1920,1719,1618,1824,1865,
-    1809,1702,1716,1808,1834,1864,1658,1694,1809,1894,1827,1683,1765,1753,1851,1809,
-    1749,1780,1765,1792,1758,1711,1805,1824,1877,1661,1698,1828,1844,1822,1621,1772,
-    1813,1818,1756,1767,1774,1778,1825,1826,1750,1717,1767,1853,1826,1760,1748,1827,
-    1832,1780,1832,1797,1754,1712,1908,1868,1736,1693,1808,1845,1844,1836,1764,1705,
-    1733,1924,1861,1753,1735,1831,1871,1889,1799,1803,1754,1844,1876,1856,1740,1641,
-    1791,1875,1815,1681,1683,1685,1769,1780,1795,1664,1684,1737,1812,1778,1707,1750,
-    1794,1841,1798,1757,1757,1773,1848,1851,1781,1772,1742,1763,1839,1876,1820,1763,
-    1727,1808,1855,1868,1814,1800,1786,1844,1848,1823,1791,1850,1908,1867,1764,1727,
-    1828,1861,1833,1741,1741,1739,1779,1783,1820,1819,1768,1724,1737,1814,1826,1853,
-    1757,1754,1812,1786,1793,1731,1788,1799,1760,1703,1701,1756,1783,1788,1768,1743,
-    1758,1835,1845,1793,1783,1798,1787,1752,1734,1745,1745,1763,1725,1732,1763,1785,
-    1780,1772,1779,1775,1771,1801,1749,1720,1740,1777,1815,1829,1790,1779,1772,1813,
-    1877,1827,1776,1730,1782,1800,1796,1777,1795,1780,1801,1814,1806,1788,1762,1765,
-    1790,1777,1731,1710,1735,1796,1768,1792,1740,1752,1762,1796,1842,1810,1761,1728,
-    1782,1819,1826,1760,1754,1752,1815,1866,1835,1802,1783,1820,1809,1812,1764,1745,
-    1741,1785,1795,1763,1770,1758,1825,1825,1844,1800,1770,1787,1800,1818,1779,1713,
-    1710,1780,1798,1772,1753,1783,1800,1844,1829,1807,1776,1797,1815,1814,1788,1768,
-    1768,1755,1802,1814,1797,1752,1766,1803,1795,1770,1770,1749,1785,1782,1778,1778,
-    1775,1802,1798,1820,1781,1775,1772,1817,1838,1821,1797,1779,1809,1829,1845,1818,
-    1809,1796,1789,1783,1795,1793,1777,1797,1773,1739,1735,1759,1770,1747,1730,1701,
-    1725,1741,1742,1753,1739,1769,1757,1767,1733,1751,1774,1747,1733,1724,1739,1719,
-    1730,1738,1792,1796,1791,1791,1804,1831,1885,1936,1960,1950,1916,1948,1968,2031,
-    2001,1947,1910,1885,1872,1878,1892,1853,1821,1799,1816,1786,1773,1785,1802,1773,
-    1763,1741,1730,1734,1753,1757,1739,1734,1712,1725,1724,1734,1717,1703,1669,1682,
-    1693,1724,1712,1709,1688,1676,1705,1712,1736,1692,1693,1685,1725,1726,1690,1660,
-    1654,1671,1669,1663,1639,1609,1579,1572,1552,1545,1529,1501,1494,1522,1574,1627,
-    1792,2049,2223,2308,2358,2419,2467,2492,2462,2283,2039,1872,1819,1772,1744,1693,
-    1617,1581,1610,1652,1700,1771,1817,1873,1888,1906,1850,1831,1824,1819,1788,1706,
-    1635,1574,1612,1653,1719,1710,1697,1729,1783,1848,1898,1903,1892,1895,1877,1851,
-    1789,1758,1733,1760,1750,1721,1717,1752,1778,1824,1840,1834,1851,1833,1840,1847,
-    1863,1831,1829,1799,1795,1763,1776,1766,1755,1742,1706,1692,1655,1674,1665,1705,
-    1686,1706,1698,1716,1718,1718,1719,1714,1727,1698,1694,1668,1663,1627,1616,1579,
-    1564,1549,1530,1501,1470,1422,1385,1400,1511,1684,1879,2116,2347,2475,2475,2562,
-    2636,2593,2413,2221,1996,1808,1774,1784,1719,1626,1603,1601,1636,1734,1839,1864,
-    1923,1980,1972,1882,1827,1809,1783,1776,1706,1593,1476,1488,1566,1655,1706,1732,
-    1740,1772,1870,1950,1979,1962,1942,1884,1815,1731,1667,1622,1628,1627,1606,1568,
-    1567,1610,1695,1779,1812,1821,1824,1864,1872,1909,1935,1943,1899,1884,1888,1855,
-    1820,1822,1813,1765,1740,1705,1688,1714,1812,1859,1864,1859,1843,1834,1831,1832,
-    1801,1758,1721,1693,1635,1618,1626,1639,1646,1647,1631,1618,1647,1678,1695,1678,
-    1659,1621,1604,1593,1587,1559,1535,1526,1525,1533,1530,1535,1579,1807,2232,2492,
-    2243,2000,2299,2672,2567,2250,2022,1736,1593,1812,1911,1626,1498,1716,1798,1694,
-    1741,1855,1897,2014,2115,1906,1630,1667,1840,1875,1785,1689,1571,1540,1698,1860,
-    1867,1840,1856,1862,1817,1824,1872,1897,1887,1825,1708,1562,1528,1602,1694,1686,
-    1638,1589,1571,1598,1684,1772,1784,1774,1764,1757,1756,1833,1930,1964,1929,1867,
-    1826,1827,1887,1943,1924,1860,1790,1742,1710,1736,1804,1860,1875,1855,1859,1900,
-    1960,1984,1963,1892,1812,1765,1754,1742,1716,1691,1637,1590,1576,1598,1628,1662,
-    1697,1709,1689,1668,1657,1666,1696,1719,1704,1629,1574,1575,1619,1647,1639,1630,
-    1626,1641,1674,1701,1726,1754,1793,1920,2233,2424,2180,1948,2231,2570,2365,1994,
-    1845,1706,1622,1836,1988,1762,1601,1762,1853,1774,1841,1987,1981,1924,1910,1823,
-    1701,1754,1850,1771,1590,1499,1490,1504,1609,1728,1749,1688,1680,1700,1725,1793,
-    1881,1872,1775,1719,1711,1701,1684,1709,1715,1664,1652,1701,1737,1780,1865,1950,
-    1934,1875,1856,1867,1894,1945,1973,1914,1843,1838,1862,1849,1833,1834,1837,1799,
-    1732,1706,1737,1799,1855,1862,1808,1776,1782,1826,1858,1822,1750,1680,1636,1620,
-    1627,1625,1606,1612,1636,1650,1665,1702,1736,1751,1749,1733,1691,1661,1680,1704,
-    1727,1725,1709,1669,1639,1654,1678,1679,1671,1674,1670,1685,1704,1716,1744,1822,
-    1876,1886,1944,2070,2146,2145,2133,2163,2212,2189,2037,1871,1831,1868,1913,1879,
-    1762,1673,1742,1878,1917,1871,1822,1777,1741,1759,1761,1714,1670,1651,1607,1546,
-    1543,1604,1665,1694,1704,1710,1742,1796,1871,1910,1888,1829,1796,1807,1816,1812,
-    1780,1758,1744,1729,1717,1739,1781,1817,1841,1861,1877,1881,1891,1901,1909,1912,
-    1916,1907,1865,1828,1823,1829,1822,1788,1748,1714,1696,1711,1755,1784,1783,1783,
-    1794,1785,1779,1815,1850,1836,1773,1716,1699,1710,1739,1732,1687,1662,1681,1714,
-    1721,1721,1714,1710,1718,1718,1687,1664,1671,1698,1721,1714,1682,1652,1652,1651,
-    1644,1617,1601,1607,1629,1646,1652,1708,1774,1829,1922,2082,2201,2163,2091,2186,
-    2363,2336,2102,1897,1843,1886,1945,1906,1750,1639,1695,1811,1852,1835,1797,1778,
-    1788,1813,1800,1741,1692,1676,1669,1641,1603,1593,1610,1641,1685,1712,1715,1738,
-    1785,1817,1840,1866,1875,1837,1776,1761,1785,1808,1795,1756,1726,1711,1740,1778,
-    1806,1798,1803,1826,1849,1887,1919,1925,1917,1902,1875,1861,1852,1819,1769,1753,
-    1753,1744,1716,1717,1727,1736,1765,1789,1792,1788,1807,1805,1785,1766,1755,1743,
-    1719,1692,1685,1714,1730,1718,1692,1681,1688,1704,1732,1734,1712,1685,1688,1700,
-    1695,1670,1652,1667,1708,1726,1708,1674,1664,1682,1705,1694,1666,1663,1689,1697,
-    1693,1699,1729,1901,2090,2048,1926,2085,2350,2362,2189,2023,1942,2007,2141,2074,
-    1821,1706,1811,1922,1883,1732,1646,1704,1839,1898,1795,1645,1626,1738,1813,1773,
-    1667,1596,1606,1678,1731,1704,1650,1611,1623,1701,1787,1816,1792,1774,1801,1849,
-    1872,1857,1822,1783,1776,1804,1812,1770,1723,1725,1763,1808,1826,1813,1808,1830,
-    1875,1912,1918,1897,1874,1858,1845,1833,1808,1784,1769,1751,1733,1726,1733,1756,
-    1787,1798,1779,1767,1781,1802,1792,1765,1732,1709,1703,1710,1708,1710,1718,1715,
-    1698,1685,1709,1728,1733,1729,1712,1688,1678,1693,1701,1705,1727,1746,1739,1711,
-    1714,1737,1745,1722,1696,1675,1663,1682,1677,1648,1641,1699,1795,1878,1922,1950,
-    1985,2072,2180,2196,2119,2053,2070,2118,2109,2033,1955,1927,1917,1874,1805,1763,
-    1762,1768,1745,1702,1680,1693,1702,1684,1678,1703,1707,1684,1658,1643,1650,1661,
-    1656,1636,1631,1662,1718,1762,1775,1785,1814,1842,1855,1845,1838,1842,1848,1836,
-    1809,1787,1784,1794,1812,1821,1818,1823,1836,1840,1846,1866,1882,1883,1869,1851,
-    1824,1802,1799,1804,1794,1766,1725,1716,1743,1775,1768,1740,1731,1730,1747,1758,
-    1735,1692,1679,1693,1694,1683,1675,1675,1692,1714,1726,1719,1701,1698,1710,1720,
-    1718,1683,1654,1662,1699,1726,1737,1722,1697,1711,1750,1763,1740,1721,1712,1713,
-    1703,1687,1670,1683,1735,1795,1850,1899,1940,1978,2052,2135,2162,2134,2109,2124,
-    2135,2112,2070,2038,2017,1971,1910,1860,1844,1839,1807,1750,1708,1709,1704,1680,
-    1654,1652,1669,1673,1664,1652,1644,1645,1648,1641,1639,1648,1675,1702,1719,1739,
-    1765,1790,1811,1814,1808,1818,1833,1843,1840,1826,1817,1834,1859,1873,1881,1886,
-    1906,1919,1913,1895,1873,1869,1868,1854,1816,1784,1774,1781,1781,1754,1715,1705,
-    1730,1751,1747,1720,1705,1719,1734,1729,1709,1691,1708,1722,1704,1683,1686,1701,
-    1709,1715,1716,1725,1727,1719,1711,1708,1700,1689,1691,1687,1695,1712,1729,1740,
-    1745,1740,1726,1727,1741,1752,1740,1723,1718,1725,1728,1728,1714,1707,1732,1777,
-    1817,1854,1915,1972,2035,2092,2112,2122,2134,2139,2128,2087,2044,2008,1960,1922,
-    1906,1894,1852,1804,1771,1743,1727,1711,1675,1639,1636,1656,1662,1644,1628,1629,
-    1648,1665,1670,1660,1650,1661,1691,1710,1720,1745,1775,1803,1817,1821,1817,1820,
-    1824,1814,1806,1801,1799,1805,1827,1843,1845,1841,1835,1842,1853,1861,1856,1849,
-    1837,1828,1812,1790,1779,1769,1759,1742,1735,1735,1739,1735,1719,1705,1716,1731,
-    1729,1718,1712,1721,1721,1713,1697,1703,1723,1746,1753,1759,1772,1782,1793,1794,
-    1788,1779,1775,1772,1768,1764,1758,1753,1760,1770,1783,1791,1797,1806,1818,1821,
-    1815,1815,1822,1820,1818,1811,1815,1819,1813,1805,1789,1782,1786,1787,1773,1785,
-    1807,1821,1828,1851,1882,1903,1912,1917,1932,1936,1928,1916,1901,1887,1881,1863,
-    1842,1825,1814,1797,1797,1807,1796,1772,1756,1748,1736,1725,1708,1697,1693,1708,
-    1720,1725,1720,1730,1756,1773,1779,1780,1789,1802,1825,1831,1818,1813,1832,1850,
-    1854,1849,1840,1840,1841,1839,1833,1814,1800,1799,1786,1762,1741,1728,1720,1721,
-    1715,1697,1682,1696,1712,1706,1705,1715,1719,1717,1718,1715,1721,1727,1735,1732,
-    1730,1748,1752,1757,1776,1780,1777,1787,1798,1795,1795,1790,1784,1788,1785,1785,
-    1780,1780,1783,1784,1777,1783,1787,1775,1777,1779,1782,1790,1789,1789,1793,1799,
-    1802,1801,1783,1769,1779,1779,1768,1765,1775,1788,1793,1790,1794,1809,1818,1814,
-    1812,1816,1822,1821,1814,1808,1805,1810,1816,1801,1786,1788,1783,1785,1787,1788,
-    1785,1769,1761,1771,1768,1756,1753,1756,1762,1776,1778,1770,1770,1787,1803,1802,
-    1804,1808,1810,1814,1811,1813,1817,1814,1817,1811,1809,1820,1831,1837,1830,1824,
-    1822,1820,1823,1819,1801,1790,1782,1779,1774,1762,1758,1749,1749,1759,1752,1737,
-    1734,1745,1753,1751,1749,1757,1770,1771,1774,1783,1795,1809,1819,1825,1827,1834,
-    1833,1832,1827,1817,1810,1809,1814,1814,1807,1799,1798,1802,1805,1787,1782,1787,
-    1785,1773,1766,1767,1770,1774,1772,1770,1759,1763,1766,1766,1767,1762,1746,1745,
-    1753,1760,1768,1771,1770,1764,1760,1765,1774,1779,1785,1789,1794,1797,1810,1815,
-    1809,1813,1813,1803,1801,1802,1804,1811,1815,1813,1807,1803,1805,1802,1795,1791,
-    1786,1786,1780,1770,1761,1758,1767,1776,1772,1762,1764,1776,1781,1778,1775,1781,
-    1788,1795,1796,1799,1803,1806,1810,1813,1808,1797,1803,1804,1806,1800,1789,1778,
-    1770,1766,1759,1747,1744,1748,1749,1746,1744,1751,1756,1764,1763,1754,1753,1763,
-    1765,1768,1769,1774,1772,1776,1780,1788,1800,1806,1810,1807,1810,1812,1821,1818,
-    1819,1818,1809,1806,1802,1797,1801,1801,1798,1790,1783,1786,1792,1797,1792,1790,
-    1794,1795,1793,1786,1785,1786,1795,1837,1830,1820,1803,1766,1737,1675,1638,1627,
-    1624,1673,1733,1800,1874,1896,1900,1884,1835,1803,1774,1759,1777,1800,1839,1879,
-    1890,1892,1852,1797,1759,1723,1727,1738,1765,1806,1837,1856,1856,1824,1790,1756,
-    1738,1753,1745,1765,1793,1811,1834,1815,1797,1781,1749,1751,1747,1759,1799,1825,
-    1854,1856,1836,1826,1795,1778,1764,1749,1761,1773,1787,1805,1824,1848,1867,1860,
-    1835,1803,1776,1739,1700,1672,1659,1672,1696,1730,1763,1789,1809,1804,1788,1769,
-    1746,1733,1737,1743,1772,1810,1825,1851,1861,1855,1839,1793,1759,1718,1683,1676,
-    1676,1711,1753,1791,1834,1866,1869,1872,1850,1817,1785,1740,1728,1727,1750,1783,
-    1804,1826,1829,1814,1801,1767,1748,1729,1721,1734,1746,1774,1798,1819,1831,1825,
-    1802,1775,1755,1747,1751,1754,1765,1781,1799,1821,1836,1833,1816,1796,1783,1774,
-    1749,1743,1754,1775,1794,1797,1801,1803,1803,1794,1776,1763,1761,1760,1769,1772,
-    1773,1777,1775,1770,1771,1768,1772,1778,1787,1799,1790,1788,1788,1788,1786,1779,
-    1778,1785,1789,1788,1793,1794,1797,1801,1791,1786,1778,1782,1787,1784,1790,1787,
-    1784,1783,1784,1791,1793,1796,1797,1788,1781,1778,1777,1776,1773,1772,1778,1787,
-    1796,1804,1808,1808,1804,1799,1787,1782,1788,1806,1821,1825,1825,1820,1810,1791,
-    1779,1762,1756,1764,1771,1781,1797,1811,1815,1807,1792,1776,1771,1775,1763,1766,
-    1779,1784,1788,1782,1776,1771,1769,1772,1765,1763,1771,1778,1788,1800,1799,1789,
-    1785,1785,1780,1775,1782,1789,1793,1798,1804,1813,1823,1820,1813,1804,1795,1795,
-    1791,1797,1812,1813,1818,1808,1797,1785,1763,1754,1744,1737,1735,1742,1758,1776,
-    1792,1806,1812,1812,1800,1791,1795,1793,1787,1773,1770,1780,1800,1817,1829,1834,
-    1833,1822,1805,1782,1752,1744,1745,1752,1772,1791,1810,1823,1829,1823,1801,1770,
-    1744,1728,1718,1723,1745,1770,1789,1808,1827,1835,1822,1806,1803,1797,1785,1777,
-    1772,1782,1794,1794,1792,1781,1772,1767,1768,1768,1776,1792,1816,1831,1827,1819,
-    1811,1806,1789,1776,1769,1767,1770,1778,1792,1801,1806,1792,1768,1745,1734,1732,
-    1724,1723,1743,1769,1783,1800,1810,1810,1811,1809,1805,1798,1800,1799,1798,1798,
-    1794,1801,1806,1816,1818,1817,1815,1801,1789,1777,1765,1756,1767,1778,1794,1806,
-    1804,1814,1823,1816,1802,1791,1786,1775,1768,1772,1779,1787,1793,1799,1792,1772,
-    1765,1774,1775,1762,1753,1760,1771,1770,1772,1781,1783,1776,1765,1755,1746,1748,
-    1756,1770,1777,1787,1800,1809,1812,1793,1783,1777,1768,1761,1766,1780,1792,1814,
-    1823,1830,1819,1800,1790,1782,1781,1780,1787,1798,1813,1831,1832,1820,1804,1788,
-    1774,1751,1753,1761,1772,1783,1787,1786,1794,1807,1798,1782,1761,1760,1761,1769,
-    1784,1798,1810,1822,1833,1816,1784,1760,1757,1744,1729,1736,1761,1798,1825,1838,
-    1843,1833,1803,1767,1744,1747,1758,1768,1791,1817,1842,1848,1834,1811,1771,1738,
-    1733,1739,1752,1761,1778,1799,1813,1812,1802,1788,1762,1735,1730,1749,1770,1786,
-    1801,1820,1825,1809,1787,1780,1771,1759,1756,1762,1779,1803,1823,1829,1823,1816,
-    1810,1792,1771,1762,1757,1755,1762,1773,1785,1788,1785,1777,1772,1767,1765,1778,
-    1795,1811,1813,1801,1803,1811,1805,1776,1753,1769,1779,1783,1783,1793,1818,1823,
-    1820,1803,1799,1797,1783,1774,1759,1756,1769,1779,1784,1790,1800,1800,1791,1775,
-    1764,1759,1767,1774,1777,1786,1790,1792,1795,1804,1805,1807,1793,1777,1774,1782,
-    1796,1802,1800,1794,1794,1798,1797,1788,1780,1772,1771,1768,1770,1770,1773,1789,
-    1790,1784,1780,1795,1809,1803,1791,1781,1775,1773,1770,1772,1775,1789,1803,1805,
-    1798,1787,1794,1787,1767,1763,1771,1778,1794,1800,1800,1798,1793,1775,1772,1775,
-    1768,1768,1771,1773,1772,1777,1787,1794,1777,1770,1780,1795,1800,1795,1806,1806,
-    1795,1788,1781,1790,1789,1790,1798,1811,1816,1811,1809,1802,1794,1791,1780,1773,
-    1772,1771,1777,1782,1784,1788,1795,1797,1787,1786,1785,1782,1777,1769,1774,1783,
-    1790,1792,1785,1778,1787,1787,1787,1783,1783,1785,1789,1790,1791,1805,1814,1817,
-    1810,1799,1786,1790,1801,1796,1778,1774,1778,1780,1778,1780,1778,1783,1782,1777,
-    1781,1782,1789,1796,1798,1793,1794,1797,1798,1794,1793,1788,1780,1780,1777,1779,
-    1779,1783,1786,1792,1792,1783,1781,1773,1768,1770,1777,1779,1786,1789,1787,1782,
-    1783,1786,1779,1775,1775,1772,1770,1775,1784,1800,1799,1790,1784,1780,1772,1767,
-    1763,1765,1774,1786,1795,1797,1794,1796,1795,1788,1789,1793,1801,1802,1806,1802,
-    1793,1783,1769,1763,1763,1766,1771,1781,1788,1790,1789,1793,1786,1779,1772,1766,
-    1764,1762,1766,1774,1790,1804,1818,1827,1828,1817,1803,1793,1787,1784,1787,1793,
-    1800,1809,1810,1800,1791,1780,1776,1776,1775,1779,1779,1783,1790,1794,1798,1795,
-    1786,1776,1764,1752,1742,1746,1753,1761,1775,1787,1788,1781,1773,1765,1757,1751,
-    1753,1753,1753,1757,1762,1768,1766,1761,1753,1748,1743,1739,1737,1731,1725,1712,
-    1700,1690,1683,1677,1665,1653,1646,1643,1645,1656,1684,1769,1897,1992,2081,2201,
-    2285,2338,2355,2283,2168,2094,2008,1887,1803,1742,1682,1681,1657,1567,1524,1505,
-    1458,1442,1470,1493,1578,1719,1802,1872,1952,1975,1980,1981,1940,1884,1887,1885,
-    1861,1873,1862,1827,1817,1773,1691,1648,1620,1595,1618,1660,1690,1756,1825,1847,
-    1857,1872,1860,1865,1886,1875,1882,1905,1901,1881,1845,1780,1700,1644,1591,1552,
-    1558,1577,1607,1649,1683,1696,1730,1753,1760,1782,1806,1822,1851,1873,1866,1857,
-    1825,1771,1708,1644,1580,1538,1507,1478,1467,1469,1460,1448,1445,1444,1470,1547,
-    1721,1963,2178,2350,2570,2751,2805,2760,2622,2408,2225,2062,1845,1675,1608,1547,
-    1480,1418,1291,1193,1195,1202,1223,1356,1549,1764,2002,2169,2228,2282,2294,2217,
-    2122,2038,1969,1949,1942,1868,1782,1711,1599,1475,1367,1279,1273,1353,1460,1569,
-    1704,1827,1919,1978,1979,1961,1985,2027,2052,2069,2063,2037,1989,1886,1739,1609,
-    1513,1455,1442,1460,1510,1597,1692,1743,1766,1782,1811,1861,1923,1984,2049,2121,
-    2150,2134,2066,1952,1834,1725,1625,1554,1537,1551,1577,1601,1607,1606,1611,1620,
-    1635,1666,1717,1781,1841,1874,1872,1865,1834,1791,1742,1708,1682,1678,1668,1639,
-    1596,1526,1456,1404,1374,1338,1355,1422,1541,1708,1994,2287,2449,2587,2795,2891,
-    2815,2690,2508,2280,2101,1907,1621,1460,1413,1296,1171,1128,1080,1112,1260,1387,
-    1518,1797,2077,2234,2358,2424,2399,2381,2307,2114,1964,1899,1787,1629,1495,1355,
-    1265,1238,1198,1164,1257,1423,1574,1700,1814,1915,2019,2097,2096,2088,2128,2156,
-    2125,2061,1989,1899,1787,1652,1499,1401,1387,1399,1414,1474,1560,1664,1759,1847,
-    1939,2028,2108,2160,2203,2209,2184,2134,2051,1946,1846,1743,1655,1589,1533,1495,
-    1479,1484,1512,1549,1604,1662,1721,1768,1793,1796,1795,1780,1750,1723,1692,1665,
-    1642,1624,1610,1615,1622,1645,1672,1721,1762,1796,1817,1811,1786,1745,1675,1600,
-    1543,1525,1502,1483,1485,1536,1620,1808,2136,2341,2432,2670,2946,2904,2737,2604,
-    2392,2139,1936,1618,1379,1406,1366,1167,1121,1173,1158,1245,1378,1481,1751,2096,
-    2205,2250,2371,2354,2212,2097,1903,1741,1730,1655,1472,1427,1435,1349,1306,1336,
-    1363,1496,1686,1786,1896,2071,2143,2129,2143,2134,2110,2113,2067,1978,1952,1908,
-    1764,1627,1559,1493,1456,1461,1471,1531,1639,1692,1714,1796,1880,1946,2055,2104,
-    2139,2188,2185,2070,1943,1855,1751,1664,1595,1554,1572,1605,1581,1559,1592,1635,
-    1659,1720,1790,1875,1934,1930,1889,1847,1798,1709,1639,1609,1608,1612,1607,1607,
-    1631,1659,1660,1666,1726,1796,1848,1882,1884,1880,1848,1777,1686,1612,1544,1481,
-    1447,1438,1407,1413,1437,1500,1586,1787,2176,2506,2658,2839,3112,3097,2849,2624,
-    2374,2061,1810,1519,1272,1249,1213,1004,928,1016,1032,1107,1301,1545,1866,2199,
-    2315,2376,2504,2459,2261,2142,2046,1914,1833,1713,1544,1481,1422,1251,1177,1250,
-    1317,1418,1594,1752,1924,2086,2131,2149,2234,2263,2217,2207,2190,2113,2008,1863,
-    1689,1561,1441,1310,1255,1300,1348,1404,1498,1602,1689,1794,1888,1999,2160,2252,
-    2275,2288,2295,2207,2075,1928,1805,1710,1613,1502,1468,1483,1463,1440,1474,1547,
-    1623,1697,1754,1847,1917,1916,1859,1823,1794,1746,1704,1682,1692,1701,1671,1631,
-    1625,1633,1622,1638,1687,1746,1794,1821,1831,1835,1820,1782,1737,1723,1711,1702,
-    1674,1662,1626,1603,1571,1515,1489,1512,1575,1630,1747,1919,2237,2449,2518,2639,
-    2836,2764,2532,2393,2221,1964,1729,1508,1338,1339,1250,1108,1137,1255,1223,1267,
-    1445,1632,1843,2052,2164,2302,2442,2370,2222,2181,2085,1898,1791,1712,1635,1578,
-    1474,1348,1353,1360,1314,1387,1576,1727,1856,1993,2082,2153,2176,2091,2039,2059,
-    2023,1940,1915,1901,1829,1722,1587,1488,1451,1424,1383,1449,1572,1663,1731,1829,
-    1912,1973,2025,2055,2116,2156,2143,2089,2040,1949,1827,1703,1606,1546,1511,1485,
-    1487,1523,1555,1572,1602,1644,1694,1745,1784,1838,1889,1902,1887,1870,1833,1774,
-    1715,1657,1618,1606,1599,1599,1618,1645,1650,1676,1714,1760,1797,1840,1878,1912,
-    1930,1915,1890,1857,1825,1771,1720,1678,1649,1584,1541,1521,1513,1505,1561,1630,
-    1743,1970,2167,2261,2392,2594,2593,2490,2410,2305,2137,1976,1787,1654,1624,1517,
-    1383,1372,1378,1290,1278,1342,1421,1550,1697,1809,1975,2123,2125,2120,2157,2108,
-    2027,2005,1973,1928,1888,1807,1726,1675,1593,1497,1480,1489,1498,1557,1641,1721,
-    1797,1833,1838,1885,1927,1917,1922,1967,1995,1985,1961,1923,1879,1825,1737,1677,
-    1669,1658,1637,1659,1690,1710,1712,1716,1733,1758,1774,1785,1829,1862,1870,1854,
-    1862,1859,1833,1795,1784,1789,1769,1743,1721,1707,1676,1639,1605,1603,1616,1618,
-    1635,1672,1702,1709,1726,1745,1768,1793,1815,1838,1882,1902,1885,1874,1871,1854,
-    1827,1807,1786,1782,1770,1752,1728,1732,1712,1694,1690,1702,1707,1704,1701,1695,
-    1688,1661,1635,1620,1635,1622,1636,1672,1747,1855,1980,2062,2154,2301,2364,2346,
-    2319,2289,2197,2098,2001,1912,1874,1823,1726,1657,1618,1523,1428,1393,1391,1416,
-    1485,1566,1655,1760,1809,1824,1864,1891,1872,1882,1928,1957,1985,2000,1989,1969,
-    1928,1842,1780,1742,1692,1655,1649,1643,1635,1627,1606,1605,1620,1636,1670,1742,
-    1806,1865,1914,1948,1961,1959,1943,1939,1925,1907,1880,1846,1805,1768,1717,1661,
-    1650,1633,1635,1654,1689,1704,1744,1765,1787,1812,1831,1840,1848,1869,1849,1828,
-    1797,1775,1734,1708,1691,1678,1683,1695,1700,1701,1706,1697,1691,1706,1716,1729,
-    1761,1788,1819,1839,1851,1851,1850,1840,1835,1842,1850,1853,1851,1844,1816,1790,
-    1749,1712,1673,1654,1646,1650,1658,1658,1664,1653,1647,1630,1632,1620,1640,1667,
-    1698,1744,1771,1809,1838,1909,1973,2021,2063,2157,2234,2243,2247,2244,2209,2119,
-    2025,1934,1885,1805,1717,1662,1634,1565,1488,1449,1427,1440,1446,1487,1575,1673,
-    1726,1777,1842,1877,1882,1886,1902,1930,1964,1973,1973,1980,1953,1890,1832,1789,
-    1735,1692,1670,1667,1669,1666,1658,1664,1672,1666,1680,1708,1748,1793,1837,1857,
-    1889,1905,1887,1862,1856,1831,1810,1796,1793,1781,1775,1753,1745,1755,1730,1729,
-    1748,1785,1779,1798,1807,1827,1815,1796,1785,1788,1782,1757,1763,1773,1774,1752,
-    1750,1740,1740,1720,1719,1731,1749,1755,1757,1775,1779,1770,1762,1773,1790,1791,
-    1795,1803,1814,1812,1805,1800,1795,1796,1790,1790,1796,1805,1794,1788,1789,1786,
-    1774,1754,1743,1733,1713,1687,1666,1670,1665,1651,1646,1663,1684,1692,1713,1738,
-    1755,1778,1802,1832,1886,1925,1961,2004,2050,2070,2075,2076,2066,2033,1980,1932,
-    1889,1846,1801,1763,1743,1722,1697,1672,1661,1663,1659,1669,1685,1709,1729,1743,
-    1764,1770,1764,1765,1766,1775,1783,1794,1805,1813,1823,1820,1814,1816,1818,1811,
-    1807,1806,1807,1808,1804,1793,1785,1780,1768,1757,1762,1756,1752,1752,1748,1748,
-    1747,1749,1745,1752,1760,1766,1767,1775,1786,1800,1804,1810,1813,1827,1825,1817,
-    1817,1818,1809,1793,1791,1788,1793,1787,1781,1782,1797,1794,1789,1791,1794,1793,
-    1785,1776,1772,1769,1755,1743,1740,1736,1731,1722,1719,1725,1731,1740,1752,1771,
-    1785,1796,1818,1834,1848,1858,1861,1847,1833,1818,1792,1772,1757,1733,1703,1691,
-    1672,1653,1638,1638,1632,1640,1645,1668,1686,1717,1726,1751,1769,1818,1902,1922,
-    1955,2040,2104,2078,2109,2094,2085,2073,2026,1972,2002,1971,1878,1864,1824,1750,
-    1690,1646,1593,1625,1615,1586,1612,1648,1626,1615,1629,1632,1658,1687,1709,1768,
-    1834,1845,1853,1885,1887,1868,1860,1847,1850,1860,1839,1816,1814,1789,1742,1720,
-    1710,1701,1707,1709,1720,1746,1748,1735,1749,1766,1773,1787,1810,1830,1836,1831,
-    1812,1798,1782,1759,1742,1736,1743,1746,1756,1768,1787,1808,1817,1828,1854,1872,
-    1873,1877,1875,1860,1838,1812,1786,1774,1755,1735,1725,1712,1708,1707,1704,1705,
-    1715,1725,1737,1757,1775,1790,1800,1813,1814,1818,1819,1818,1828,1829,1816,1806,
-    1800,1796,1791,1781,1782,1778,1776,1766,1759,1761,1755,1761,1761,1750,1749,1748,
-    1746,1727,1714,1692,1684,1684,1670,1673,1690,1698,1700,1722,1731,1748,1758,1779,
-    1793,1817,1818,1834,1851,1846,1830,1845,1864,1868,1886,1907,1954,1974,1978,1967,
-    1976,1960,1935,1914,1912,1897,1875,1842,1812,1780,1741,1712,1685,1686,1685,1684,
-    1688,1701,1701,1703,1709,1724,1744,1768,1794,1825,1856,1865,1863,1863,1854,1837,
-    1815,1805,1799,1788,1775,1763,1757,1748,1726,1714,1722,1741,1756,1769,1793,1829,
-    1861,1856,1851,1856,1865,1840,1816,1806,1803,1777,1734,1707,1690,1672,1643,1628,
-    1641,1663,1662,1682,1712,1739,1753,1774,1792,1812,1825,1823,1832,1836,1823,1795,
-    1771,1746,1727,1695,1675,1670,1671,1663,1663,1668,1684,1685,1687,1697,1722,1735,
-    1757,1779,1793,1799,1786,1768,1748,1748,1743,1779,1795,1925,2059,2064,2078,2195,
-    2212,2144,2107,2039,2031,1988,1864,1802,1820,1731,1623,1580,1571,1566,1545,1538,
-    1606,1695,1720,1725,1785,1870,1894,1889,1923,1968,1975,1939,1887,1872,1869,1798,
-    1729,1730,1715,1677,1637,1607,1618,1638,1612,1634,1703,1736,1740,1761,1803,1844,
-    1860,1861,1892,1924,1909,1874,1848,1834,1813,1766,1732,1740,1727,1690,1674,1672,
-    1687,1697,1704,1729,1789,1813,1825,1846,1881,1897,1915,1944,1962,1975,1947,1917,
-    1882,1847,1795,1759,1726,1701,1676,1651,1648,1651,1660,1673,1697,1724,1765,1779,
-    1792,1813,1822,1815,1814,1813,1802,1794,1777,1764,1754,1742,1729,1731,1725,1721,
-    1730,1717,1712,1718,1716,1718,1738,1749,1751,1763,1780,1796,1807,1807,1804,1814,
-    1804,1797,1795,1794,1786,1783,1791,1793,1803,1807,1803,1802,1807,1796,1807,1824,
-    1821,1825,1822,1819,1831,1840,1837,1862,1891,1903,1916,1911,1900,1878,1852,1822,
-    1805,1803,1780,1760,1747,1729,1701,1683,1690,1712,1737,1762,1787,1809,1828,1834,
-    1834,1850,1864,1868,1872,1873,1865,1846,1820,1796,1785,1766,1763,1752,1748,1756,
-    1759,1758,1773,1787,1798,1814,1805,1814,1821,1814,1802,1804,1787,1777,1751,1722,
-    1714,1707,1700,1694,1693,1689,1700,1691,1696,1708,1719,1733,1749,1766,1783,1789,
-    1786,1782,1771,1755,1738,1728,1717,1714,1700,1696,1689,1682,1681,1691,1708,1723,
-    1744,1759,1777,1782,1791,1787,1799,1791,1794,1795,1785,1787,1788,1795,1810,1840,
-    1852,1953,2050,2049,2046,2121,2141,2110,2074,2032,2034,1965,1838,1783,1772,1700,
-    1625,1572,1565,1564,1524,1521,1585,1649,1671,1686,1736,1808,1842,1850,1899,1950,
-    1947,1916,1898,1902,1896,1843,1799,1795,1771,1724,1674,1660,1675,1677,1660,1664,
-    1696,1712,1706,1721,1762,1798,1808,1806,1823,1842,1828,1817,1827,1833,1822,1791,
-    1761,1753,1735,1717,1718,1723,1735,1738,1739,1760,1770,1776,1801,1820,1841,1864,
-    1869,1883,1925,1916,1882,1855,1839,1829,1801,1756,1741,1737,1693,1662,1660,1673,
-    1672,1667,1664,1691,1700,1694,1710,1748,1776,1777,1774,1785,1805,1796,1797,1801,
-    1805,1789,1772,1766,1772,1782,1766,1758,1755,1752,1743,1735,1750,1770,1764,1758,
-    1768,1792,1793,1790,1806,1822,1829,1812,1822,1830,1833,1827,1819,1826,1832,1827,
-    1819,1823,1823,1818,1809,1806,1819,1831,1816,1816,1828,1830,1829,1832,1831,1836,
-    1832,1824,1832,1830,1816,1808,1805,1798,1794,1772,1757,1762,1761,1747,1745,1760,
-    1769,1774,1781,1795,1815,1823,1820,1826,1832,1834,1829,1829,1829,1824,1811,1797,
-    1792,1795,1795,1783,1770,1765,1763,1753,1757,1766,1777,1767,1764,1775,1780,1768,
-    1764,1770,1770,1770,1762,1761,1764,1767,1762,1768,1769,1771,1769,1766,1772,1781,
-    1783,1784,1777,1775,1782,1774,1774,1781,1773,1768,1765,1767,1769,1770,1767,1765,
-    1775,1764,1780,1788,1801,1810,1802,1803,1799,1793,1792,1796,1805,1805,1804,1824,
-    1811,1814,1809,1794,1799,1791,1778,1780,1775,1756,1761,1747,1745,1743,1736,1736,
-    1739,1739,1731,1739,1739,1748,1759,1759,1780,1806,1813,1831,1842,1849,1871,1871,
-    1870,1882,1886,1875,1874,1860,1847,1837,1816,1808,1808,1797,1777,1786,1772,1771,
-    1781,1775,1779,1786,1788,1783,1787,1777,1778,1784,1773,1777,1771,1756,1757,1758,
-    1759,1751,1759,1763,1781,1779,1784,1798,1804,1813,1816,1819,1823,1832,1821,1822,
-    1809,1802,1797,1787,1780,1778,1771,1768,1767,1754,1755,1748,1740,1743,1737,1730,
-    1742,1745,1745,1755,1767,1771,1784,1783,1782,1793,1794,1790,1794,1799,1803,1805,
-    1797,1800,1798,1792,1794,1797,1798,1814,1821,1816,1828,1826,1814,1809,1801,1797,
-    1795,1782,1772,1779,1775,1768,1770,1767,1777,1777,1784,1795,1798,1796,1797,1806,
-    1801,1799,1802,1806,1812,1810,1801,1803,1796,1786,1789,1785,1784,1794,1795,1791,
-    1787,1787,1786,1780,1783,1785,1781,1785,1783,1779,1780,1776,1774,1770,1773,1772,
-    1774,1764,1763,1768,1771,1777,1774,1783,1787,1783,1787,1786,1795,1802,1787,1792,
-    1793,1787,1788,1787,1784,1786,1793,1794,1798,1801,1798,1791,1806,1830,1784,1779,
-    1811,1807,1790,1761,1772,1758,1727,1731,1747,1743,1723,1706,1733,1759,1755,1740,
-    1752,1782,1777,1782,1798,1819,1818,1797,1788,1810,1818,1790,1775,1779,1777,1768,
-    1763,1772,1788,1780,1763,1765,1782,1793,1792,1789,1804,1816,1814,1813,1825,1830,
-    1818,1812,1806,1819,1819,1800,1787,1785,1785,1781,1783,1787,1794,1790,1786,1786,
-    1796,1794,1793,1795,1801,1810,1814,1821,1824,1816,1804,1801,1800,1796,1779,1770,
-    1765,1764,1758,1759,1766,1761,1752,1743,1753,1764,1768,1764,1768,1777,1782,1779,
-    1778,1787,1786,1782,1782,1795,1798,1790,1780,1773,1785,1791,1784,1775,1771,1771,
-    1773,1774,1767,1764,1762,1758,1760,1772,1777,1776,1780,1783,1787,1786,1784,1780,
-    1770,1759,1756,1749,1727,1710,1702,1702,1682,1662,1678,1788,1853,1768,1771,1944,
-    2052,2005,1952,1970,2037,2047,1982,1972,1997,1913,1804,1811,1851,1802,1687,1605,
-    1628,1671,1631,1572,1593,1642,1633,1649,1714,1751,1740,1724,1760,1859,1899,1851,
-    1838,1880,1902,1889,1867,1855,1851,1818,1792,1804,1819,1769,1712,1710,1736,1745,
-    1713,1693,1703,1716,1716,1723,1742,1759,1762,1769,1799,1829,1822,1850,1892,1864,
-    1842,1885,1928,1893,1826,1816,1844,1841,1788,1740,1749,1757,1732,1720,1730,1718,
-    1688,1690,1725,1745,1721,1687,1709,1762,1771,1751,1744,1745,1747,1752,1760,1759,
-    1737,1713,1718,1750,1758,1717,1690,1700,1723,1733,1720,1705,1702,1709,1705,1714,
-    1707,1677,1658,1692,1694,1796,1951,1816,1716,2010,2231,2105,1999,2034,2141,2206,
-    2113,1990,2049,2002,1832,1865,1916,1770,1607,1590,1640,1682,1606,1474,1520,1658,
-    1640,1608,1662,1670,1667,1730,1798,1842,1838,1782,1825,1952,1957,1864,1845,1874,
-    1894,1904,1851,1785,1781,1766,1759,1774,1736,1671,1664,1697,1729,1725,1671,1656,
-    1710,1760,1764,1766,1756,1773,1819,1850,1851,1841,1826,1834,1871,1876,1850,1816,
-    1801,1809,1823,1803,1765,1744,1752,1773,1782,1760,1727,1723,1752,1771,1758,1741,
-    1736,1753,1785,1792,1777,1764,1758,1770,1801,1804,1772,1763,1779,1805,1820,1799,
-    1769,1773,1798,1819,1829,1818,1793,1804,1829,1827,1813,1792,1781,1797,1804,1782,
-    1773,1776,1760,1764,1786,1789,1782,1780,1779,1797,1818,1820,1813,1809,1821,1825,
-    1836,1815,1800,1797,1796,1779,1779,1761,1786,1835,1785,1741,1785,1861,1823,1742,
-    1717,1775,1809,1755,1684,1706,1732,1722,1719,1721,1718,1710,1733,1757,1765,1734,
-    1719,1752,1804,1810,1784,1776,1810,1846,1846,1823,1819,1836,1850,1862,1855,1823,
-    1799,1803,1811,1803,1786,1774,1782,1795,1792,1785,1769,1760,1777,1791,1789,1776,
-    1771,1796,1805,1790,1776,1786,1793,1793,1787,1778,1785,1798,1806,1805,1798,1782,
-    1785,1798,1801,1784,1772,1771,1781,1796,1790,1769,1772,1791,1807,1809,1800,1788,
-    1785,1797,1809,1803,1787,1786,1797,1809,1805,1794,1790,1799,1811,1810,1804,1804,
-    1804,1808,1813,1807,1792,1789,1792,1796,1798,1794,1785,1783,1789,1784,1772,1769,
-    1772,1762,1750,1742,1751,1739,1718,1717,1732,1733,1722,1719,1727,1749,1752,1749,
-    1758,1768,1764,1773,1791,1795,1794,1793,1800,1819,1816,1791,1789,1805,1810,1805,
-    1796,1786,1812,1833,1823,1829,1854,1870,1883,1890,1881,1880,1889,1895,1895,1874,
-    1849,1838,1830,1817,1785,1758,1751,1744,1729,1721,1711,1705,1702,1706,1704,1702,
-    1712,1722,1729,1743,1759,1772,1786,1794,1808,1821,1825,1830,1843,1842,1840,1839,
-    1834,1823,1807,1780,1771,1767,1750,1744,1753,1743,1755,1759,1720,1741,1781,1780,
-    1751,1766,1790,1800,1785,1765,1785,1820,1795,1775,1796,1812,1815,1794,1796,1798,
-    1791,1777,1782,1790,1780,1764,1767,1778,1777,1756,1748,1756,1751,1747,1754,1761,
-    1755,1747,1754,1764,1762,1752,1745,1755,1771,1763,1752,1758,1759,1754,1758,1762,
-    1766,1764,1764,1771,1776,1767,1762,1768,1766,1773,1809,1860,1827,1796,1886,1985,
-    1966,1883,1895,1996,2024,1959,1903,1936,1963,1922,1882,1852,1826,1807,1798,1780,
-    1735,1699,1698,1712,1707,1666,1648,1675,1704,1693,1680,1694,1725,1743,1740,1745,
-    1764,1788,1794,1792,1799,1802,1815,1832,1822,1808,1804,1810,1816,1800,1772,1762,
-    1774,1781,1770,1760,1753,1763,1782,1781,1765,1762,1773,1775,1777,1767,1766,1763,
-    1770,1765,1756,1747,1760,1776,1786,1803,1806,1819,1840,1875,1870,1863,1865,1875,
-    1867,1843,1814,1814,1804,1791,1774,1758,1754,1748,1734,1719,1716,1708,1705,1706,
-    1703,1694,1702,1724,1741,1725,1722,1740,1764,1763,1756,1756,1774,1787,1784,1777,
-    1782,1780,1787,1790,1779,1770,1770,1773,1757,1743,1744,1753,1744,1742,1747,1752,
-    1762,1793,1832,1832,1802,1851,1935,1941,1884,1883,1954,1982,1942,1906,1921,1958,
-    1930,1870,1848,1836,1817,1789,1768,1729,1699,1703,1699,1682,1649,1644,1686,1700,
-    1680,1661,1701,1750,1762,1760,1754,1789,1829,1826,1820,1829,1842,1860,1867,1861,
-    1850,1867,1870,1856,1850,1824,1825,1824,1798,1785,1774,1770,1764,1767,1748,1737,
-    1761,1759,1739,1730,1746,1775,1787,1771,1762,1794,1811,1806,1808,1800,1820,1845,
-    1848,1830,1819,1835,1832,1813,1782,1763,1777,1773,1751,1720,1712,1729,1726,1704,
-    1687,1702,1716,1713,1706,1709,1720,1721,1723,1731,1733,1744,1757,1762,1764,1772,
-    1781,1792,1801,1784,1785,1809,1820,1804,1802,1812,1824,1820,1799,1795,1804,1814,
-    1805,1789,1785,1788,1787,1772,1757,1757,1767,1766,1761,1761,1777,1799,1789,1800,
-    1832,1849,1860,1865,1880,1895,1887,1877,1873,1880,1880,1850,1840,1824,1804,1783,
-    1768,1759,1744,1735,1722,1714,1717,1716,1716,1712,1714,1719,1732,1745,1741,1753,
-    1763,1767,1779,1791,1799,1794,1791,1803,1813,1807,1809,1811,1814,1811,1808,1802,
-    1795,1796,1793,1796,1787,1789,1799,1804,1805,1803,1807,1815,1808,1806,1813,1811,
-    1804,1790,1776,1771,1769,1761,1751,1749,1751,1748,1750,1740,1740,1742,1745,1754,
-    1753,1749,1760,1776,1776,1778,1783,1784,1793,1802,1796,1792,1795,1794,1794,1797,
-    1792,1795,1803,1815,1815,1805,1806,1822,1825,1808,1805,1814,1825,1818,1801,1803,
-    1823,1822,1803,1798,1805,1801,1792,1789,1799,1796,1779,1764,1770,1774,1754,1751,
-    1759,1772,1769,1756,1757,1775,1783,1773,1777,1791,1794,1797,1797,1796,1802,1811,
-    1808,1805,1808,1810,1809,1809,1803,1801,1798,1787,1795,1795,1790,1788,1792,1791,
-    1782,1785,1780,1777,1783,1780,1777,1779,1784,1789,1799,1798,1795,1798,1801,1798,
-    1792,1790,1789,1788,1778,1770,1771,1773,1772,1768,1766,1774,1783,1778,1771,1775,
-    1779,1779,1779,1774,1778,1780,1773,1770,1768,1766,1766,1768,1763,1760,1761,1765,
-    1764,1753,1750,1761,1766,1762,1752,1751,1760,1765,1774,1776,1769,1766,1772,1781,
-    1785,1779,1782,1791,1797,1792,1794,1803,1802,1796,1802,1815,1812,1806,1800,1794,
-    1792,1796,1799,1797,1800,1808,1807,1804,1797,1790,1792,1793,1788,1781,1774,1779,
-    1782,1766,1758,1768,1772,1761,1763,1769,1774,1773,1773,1783,1789,1783,1778,1788,
-    1792,1792,1788,1792,1804,1812,1806,1804,1812,1817,1812,1807,1807,1815,1822,1823,
-    1822,1820,1826,1822,1803,1792,1796,1799,1790,1786,1786,1792,1800,1792,1787,1790,
-    1799,1799,1785,1784,1792,1787,1777,1773,1781,1775,1759,1760,1770,1770,1761,1762,
-    1766,1763,1761,1762,1767,1779,1780,1780,1778,1783,1785,1788,1788,1790,1799,1802,
-    1800,1797,1798,1796,1794,1796,1798,1795,1789,1787,1791,1788,1782,1780,1776,1779,
-    1778,1775,1775,1777,1777,1776,1767,1765,1774,1782,1777,1771,1775,1782,1798,1798,
-    1794,1797,1798,1793,1788,1789,1789,1795,1793,1783,1782,1785,1783,1783,1786,1785,
-    1781,1787,1789,1788,1783,1777,1779,1788,1792,1782,1784,1795,1800,1792,1783,1785,
-    1788,1788,1787,1777,1781,1785,1780,1774,1772,1775,1777,1771,1765,1770,1768,1760,
-    1756,1771,1778,1772,1773,1781,1791,1792,1786,1792,1794,1791,1794,1791,1788,1787,
-    1786,1780,1786,1784,1785,1793,1794,1791,1791,1785,1779,1779,1771,1769,1771,1769,
-    1767,1766,1769,1766,1762,1763,1768,1775,1775,1778,1775,1781,1785,1786,1789,1787,
-    1787,1791,1790,1791,1799,1800,1795,1798,1803,1802,1801,1802,1806,1807,1803,1795,
-    1792,1792,1792,1792,1787,1784,1790,1785,1780,1777,1779,1781,1785,1785,1779,1778,
-    1777,1773,1782,1792,1782,1776,1782,1784,1783,1788,1787,1792,1793,1789,1793,1795,
-    1793,1800,1800,1798,1800,1801,1797,1787,1788,1789,1794,1792,1784,1782,1780,1784,
-    1785,1785,1783,1781,1779,1775,1773,1773,1778,1782,1784,1787,1790,1791,1794,1797,
-    1798,1800,1801,1801,1800,1792,1791,1795,1793,1794,1788,1783,1785,1789,1787,1785,
-    1788,1792,1793,1791,1794,1798,1798,1793,1785,1785,1783,1779,1778,1779,1781,1779,
-    1779,1783,1793,1793,1787,1785,1788,1787,1784,1786,1784,1785,1789,1790,1791,1790,
-    1783,1781,1781,1778,1774,1775,1774,1779,1780,1780,1782,1783,1788,1785,1787,1786,
-    1786,1790,1788,1783,1781,1778,1777,1781,1782,1783,1788,1793,1791,1791,1793,1793,
-    1792,1794,1795,1794,1788,1786,1789,1785,1782,1783,1783,1782,1782,1781,1782,1787,
-    1787,1784,1785,1784,1778,1773,1772,1774,1779,1776,1774,1777,1778,1782,1780,1775,
-    1781,1783,1787,1788,1786,1789,1785,1786,1793,1799,1797,1792,1791,1801,1807,1802,
-    1796,1797,1801,1800,1795,1790,1791,1793,1795,1789,1790,1792,1792,1792,1797,1794,
-    1789,1790,1791,1790,1787,1785,1783,1781,1781,1784,1783,1789,1789,1785,1789,1790,
-    1787,1779,1770,1772,1780,1780,1781,1777,1773,1775,1771,1771,1775,1772,1775,1780,
-    1781,1782,1783,1782,1786,1794,1790,1787,1789,1788,1789,1790,1787,1788,1795,1795,
-    1795,1791,1788,1794,1790,1785,1788,1789,1781,1778,1780,1786,1787,1791,1792,1794,
-    1795,1796,1798,1794,1795,1794,1787,1786,1785,1787,1787,1790,1792,1792,1791,1787,
-    1784,1788,1787,1785,1791,1786,1786,1789,1788,1784,1781,1785,1786,1786,1783,1787,
-    1793,1787,1785,1786,1785,1787,1789,1787,1783,1782,1781,1784,1791,1794,1795,1799,
-    1798,1793,1795,1796,1798,1801,1801,1795,1793,1794,1788,1780,1781,1786,1786,1785,
-    1781,1782,1781,1783,1784,1780,1783,1781,1784,1787,1784,1783,1786,1784,1779,1782,
-    1784,1782,1789,1789,1786,1787,1787,1787,1792,1797,1794,1796,1799,1795,1791,1788,
-    1789,1788,1784,1786,1788,1793,1789,1785,1785,1786,1784,1781,1782,1786,1787,1779,
-    1776,1776,1780,1777,1776,1779,1782,1787,1784,1784,1782,1784,1782,1784,1789,1789,
-    1785,1775,1777,1776,1775,1776,1772,1775,1778,1774,1773,1775,1776,1779,1780,1782,
-    1789,1792,1795,1791,1787,1788,1785,1785,1784,1782,1785,1783,1777,1773,1776,1772,
-    1770,1772,1770,1774,1777,1783,1782,1779,1779,1780,1781,1784,1788,1789,1789,1783,
-    1781,1781,1784,1782,1781,1779,1782,1787,1789,1782,1784,1787,1789,1790,1788,1790,
-    1790,1795,1791,1793,1794,1789,1788,1788,1785,1786,1787,1786,1786,1787,1787,1787,
-    1785,1780,1779,1776,1777,1774,1772,1772,1774,1777,1780,1780,1781,1781,1779,1778,
-    1773,1775,1780,1784,1783,1787,1787,1785,1785,1778,1778,1778,1781,1785,1784,1783,
-    1784,1787,1785,1785,1777,1776,1778,1778,1777,1779,1783,1780,1785,1787,1787,1788,
-    1791,1791,1790,1790,1788,1786,1787,1789,1787,1788,1789,1787,1791,1792,1793,1795,
-    1794,1794,1793,1795,1796,1793,1791,1789,1789,1791,1791,1792,1792,1790,1789,1792,
-    1793,1787,1781,1785,1788,1786,1780,1777,1781,1781,1780,1779,1780,1777,1775,1776,
-    1784,1790,1787,1783,1788,1793,1795,1799,1803,1802,1797,1793,1793,1795,1796,1797,
-    1799,1804,1801,1798,1793,1792,1790,1785,1783,1779,1777,1779,1782,1778,1778,1780,
-    1777,1775,1775,1777,1778,1779,1784,1786,1792,1790,1785,1782,1782,1784,1784,1789,
-    1787,1790,1791,1790,1795,1796,1794,1794,1797,1798,1798,1799,1795,1792,1794,1798,
-    1800,1799,1797,1793,1788,1786,1785,1781,1784,1783,1785,1785,1782,1777,1776,1776,
-    1776,1780,1784,1793,1794,1796,1790,1790,1790,1786,1785,1783,1785,1785,1780,1776,
-    1774,1775,1779,1781,1782,1786,1785,1784,1783,1781,1781,1780,1783,1780,1785,1785,
-    1782,1787,1791,1789,1788,1785,1787,1783,1785,1787,1783,1784,1783,1785,1788,1792,
-    1787,1787,1788,1786,1783,1781,1782,1780,1784,1781,1782,1782,1787,1788,1787,1791,
-    1783,1786,1787,1795,1799,1797,1792,1792,1793,1790,1787,1783,1788,1791,1794,1788,
-    1786,1786,1783,1778,1781,1785,1782,1779,1782,1783,1778,1778,1780,1781,1781,1779,
-    1774,1775,1773,1774,1769,1772,1775,1773,1772,1777,1782,1786,1786,1783,1781,1780,
-    1786,1789,1792,1794,1802,1802,1796,1800,1803,1800,1796,1791,1794,1801,1802,1801,
-    1797,1793,1788,1791,1798,1799,1801,1797,1791,1792,1790,1787,1782,1775,1775,1774,
-    1775,1770,1767,1771,1772,1776,1778,1777,1777,1773,1778,1780,1777,1780,1782,1781,
-    1782,1786,1787,1791,1795,1792,1795,1800,1797,1797,1794,1795,1796,1793,1789,1786,
-    1783,1786,1790,1787,1790,1789,1794,1799,1798,1795,1790,1784,1779,1779,1779,1782,
-    1783,1781,1778,1774,1775,1768,1769,1776,1775,1777,1777,1783,1786,1783,1782,1783,
-    1789,1790,1794,1793,1795,1799,1797,1801,1805,1808,1805,1802,1798,1795,1794,1792,
-    1787,1787,1785,1785,1789,1790,1790,1789,1788,1784,1779,1775,1776,1777,1780,1783,
-    1782,1777,1776,1777,1777,1776,1775,1772,1778,1783,1783,1783,1779,1781,1776,1773,
-    1774,1778,1776,1772,1774,1777,1782,1780,1781,1776,1782,1787,1789,1788,1788,1786,
-    1785,1784,1780,1778,1771,1774,1776,1780,1776,1776,1776,1771,1775,1775,1779,1786,
-    1792,1789,1795,1800,1799,1798,1800,1798,1792,1793,1801,1804,1803,1802,1799,1804,
-    1804,1803,1803,1803,1804,1804,1801,1798,1795,1786,1784,1787,1787,1792,1793,1794,
-    1792,1790,1793,1792,1790,1789,1787,1783,1784,1786,1784,1782,1783,1782,1776,1777,
-    1781,1785,1781,1776,1781,1784,1786,1786,1784,1786,1784,1775,1779,1781,1776,1779,
-    1778,1780,1778,1780,1780,1776,1776,1779,1781,1775,1778,1786,1795,1798,1796,1795,
-    1794,1791,1786,1787,1788,1795,1793,1794,1792,1793,1794,1791,1791,1789,1794,1794,
-    1792,1792,1792,1790,1792,1790,1789,1792,1788,1790,1795,1794,1795,1790,1787,1788,
-    1789,1786,1788,1789,1786,1790,1791,1789,1781,1777,1774,1774,1777,1774,1772,1774,
-    1776,1781,1786,1787,1785,1781,1779,1777,1777,1779,1782,1782,1785,1785,1786,1781,
-    1782,1785,1790,1793,1792,1794,1793,1791,1789,1793,1793,1792,1792,1792,1788,1788,
-    1789,1784,1788,1795,1798,1792,1785,1785,1786,1780,1775,1780,1782,1784,1784,1780,
-    1771,1768,1770,1772,1780,1781,1776,1778,1780,1775,1773,1773,1773,1773,1778,1786,
-    1791,1791,1787,1782,1783,1783,1785,1784,1783,1780,1784,1794,1790,1785,1791,1797,
-    1804,1803,1798,1798,1794,1793,1792,1798,1797,1793,1793,1795,1794,1794,1796,1792,
-    1785,1786,1786,1782,1781,1779,1776,1780,1783,1776,1774,1774,1771,1772,1772,1772,
-    1774,1771,1773,1774,1774,1774,1778,1782,1784,1786,1788,1786,1780,1778,1775,1772,
-    1773,1777,1782,1786,1791,1793,1792,1794,1796,1799,1802,1804,1799,1802,1804,1802,
-    1803,1796,1791,1795,1799,1795,1792,1791,1790,1785,1781,1784,1781,1781,1780,1780,
-    1779,1774,1770,1767,1772,1777,1779,1779,1784,1787,1786,1788,1783,1780,1786,1790,
-    1787,1782,1778,1777,1775,1772,1775,1779,1782,1785,1786,1785,1786,1782,1778,1775,
-    1781,1778,1777,1779,1781,1786,1790,1787,1785,1793,1792,1796,1796,1794,1795,1790,
-    1786,1791,1793,1791,1786,1786,1786,1785,1785,1782,1782,1788,1797,1798,1803,1802,
-    1798,1798,1800,1800,1797,1794,1794,1793,1791,1787,1782,1780,1774,1772,1771,1768,
-    1774,1777,1772,1773,1777,1777,1773,1771,1774,1773,1775,1775,1776,1778,1782,1786,
-    1786,1791,1794,1795,1798,1801,1801,1797,1795,1797,1799,1801,1800,1796,1797,1802,
-    1805,1804,1800,1800,1799,1797,1795,1790,1791,1792,1785,1781,1780,1775,1776,1776,
-    1778,1777,1781,1783,1781,1779,1779,1781,1778,1773,1770,1770,1773,1772,1771,1776,
-    1782,1784,1786,1788,1790,1793,1790,1789,1791,1793,1794,1795,1797,1788,1790,1789,
-    1786,1791,1792,1785,1781,1793,1792,1791,1794,1789,1793,1798,1794,1793,1790,1786,
-    1784,1788,1791,1791,1790,1785,1781,1784,1785,1790,1790,1788,1790,1790,1793,1789,
-    1789,1779,1773,1773,1780,1780,1778,1780,1782,1785,1782,1789,1791,1787,1788,1791,
-    1787,1784,1786,1787,1786,1788,1790,1785,1786,1786,1788,1789,1786,1788,1795,1794,
-    1786,1780,1781,1787,1787,1785,1785,1787,1785,1785,1785,1784,1787,1785,1777,1776,
-    1776,1777,1776,1780,1783,1786,1790,1790,1792,1794,1794,1797,1793,1783,1785,1788,
-    1785,1782,1780,1780,1778,1776,1779,1776,1777,1777,1775,1776,1775,1770,1765,1765,
-    1764,1768,1772,1774,1771,1775,1785,1792,1796,1788,1787,1793,1792,1788,1784,1786,
-    1788,1786,1785,1785,1784,1782,1780,1780,1782,1788,1786,1782,1789,1788,1787,1789,
-    1788,1785,1786,1783,1779,1786,1790,1788,1782,1780,1784,1792,1795,1793,1795,1795,
-    1792,1792,1790,1789,1787,1784,1786,1787,1784,1782,1779,1775,1774,1773,1774,1779,
-    1779,1777,1778,1779,1783,1787,1785,1783,1784,1791,1790,1787,1791,1796,1800,1803,
-    1801,1801,1801,1792,1788,1787,1792,1792,1783,1779,1781,1787,1788,1788,1790,1790,
-    1788,1785,1782,1780,1779,1782,1786,1788,1788,1787,1789,1793,1790,1783,1782,1784,
-    1787,1786,1787,1784,1778,1773,1775,1781,1781,1784,1789,1792,1793,1797,1799,1796,
-    1792,1793,1795,1796,1795,1793,1791,1792,1797,1797,1796,1794,1792,1794,1796,1792,
-    1787,1789,1785,1779,1777,1776,1777,1777,1777,1781,1786,1789,1784,1776,1775,1776,
-    1781,1781,1784,1785,1781,1782,1786,1786,1783,1779,1777,1776,1777,1779,1782,1779,
-    1777,1787,1796,1798,1798,1798,1795,1800,1799,1802,1800,1799,1798,1798,1803,1793,
-    1790,1787,1788,1788,1788,1786,1781,1780,1781,1780,1781,1776,1772,1777,1776,1775,
-    1776,1778,1777,1778,1777,1779,1780,1782,1783,1783,1787,1788,1788,1788,1790,1794,
-    1793,1790,1791,1789,1792,1792,1795,1795,1787,1787,1781,1781,1790,1795,1790,1789,
-    1795,1799,1802,1802,1792,1788,1792,1789,1792,1796,1795,1786,1781,1778,1775,1773,
-    1774,1771,1778,1788,1790,1791,1786,1786,1788,1791,1790,1787,1784,1781,1775,1776,
-    1778,1778,1771,1771,1779,1784,1789,1786,1786,1784,1787,1785,1785,1789,1790,1781,
-    1768,1773,1780,1776,1775,1773,1780,1789,1790,1789,1789,1792,1785,1788,1795,1789,
-    1785,1785,1788,1789,1790,1787,1783,1784,1780,1782,1785,1784,1782,1784,1792,1789,
-    1788,1793,1796,1798,1797,1797,1791,1785,1782,1785,1785,1785,1797,1797,1792,1793,
-    1796,1795,1793,1787,1784,1782,1784,1785,1782,1781,1784,1781,1780,1782,1786,1786,
-    1783,1784,1789,1795,1795,1793,1788,1789,1787,1792,1791,1782,1778,1781,1785,1786,
-    1782,1781,1779,1780,1784,1777,1775,1773,1773,1767,1768,1773,1777,1773,1765,1769,
-    1779,1785,1777,1774,1780,1786,1784,1786,1790,1786,1789,1792,1798,1803,1796,1793,
-    1798,1801,1795,1790,1792,1788,1788,1791,1796,1800,1802,1801,1801,1807,1802,1797,
-    1794,1789,1786,1791,1792,1784,1779,1782,1784,1789,1792,1785,1777,1782,1785,1781,
-    1781,1783,1781,1780,1783,1790,1795,1789,1785,1780,1784,1786,1788,1786,1782,1781,
-    1777,1775,1771,1774,1776,1770,1771,1780,1782,1778,1773,1771,1771,1773,1770,1772,
-    1779,1782,1780,1782,1783,1776,1778,1777,1774,1782,1783,1785,1786,1787,1792,1797,
-    1802,1802,1795,1787,1785,1786,1788,1787,1788,1788,1792,1793,1791,1794,1794,1789,
-    1785,1791,1798,1798,1798,1790,1785,1789,1789,1789,1786,1778,1779,1789,1788,1785,
-    1790,1799,1797,1785,1780,1777,1785,1797,1794,1788,1783,1785,1790,1795,1788,1774,
-    1770,1775,1790,1792,1789,1786,1782,1781,1785,1789,1789,1781,1787,1792,1794,1793,
-    1787,1785,1784,1790,1790,1799,1803,1794,1781,1785,1789,1790,1792,1791,1790,1791,
-    1794,1793,1792,1787,1776,1774,1779,1778,1778,1774,1782,1786,1784,1783,1790,1791,
-    1790,1794,1797,1798,1800,1804,1793,1785,1789,1796,1798,1793,1792,1791,1790,1797,
-    1789,1786,1786,1786,1782,1774,1774,1772,1781,1787,1785,1785,1777,1781,1790,1787,
-    1777,1772,1778,1784,1788,1786,1785,1790,1791,1785,1781,1783,1786,1784,1782,1777,
-    1780,1793,1793,1783,1778,1787,1792,1788,1785,1787,1790,1790,1786,1784,1785,1779,
-    1781,1783,1779,1779,1786,1795,1802,1793,1781,1786,1794,1788,1771,1773,1779,1781,
-    1780,1780,1784,1785,1780,1785,1791,1791,1787,1785,1787,1777,1772,1771,1770,1759,
-    1753,1755,1762,1758,1751,1757,1759,1770,1782,1782,1785,1788,1791,1790,1786,1793,
-    1797,1803,1801,1788,1793,1804,1800,1795,1787,1787,1789,1798,1802,1792,1783,1780,
-    1787,1791,1788,1792,1792,1781,1784,1787,1792,1797,1797,1789,1785,1797,1798,1790,
-    1790,1780,1773,1783,1795,1787,1783,1789,1797,1800,1792,1782,1776,1785,1792,1797,
-    1804,1794,1790,1797,1799,1792,1790,1790,1785,1795,1798,1793,1798,1803,1796,1793,
-    1798,1797,1793,1793,1789,1777,1784,1796,1794,1791,1784,1781,1787,1791,1787,1784,
-    1788,1792,1792,1784,1776,1774,1776,1778,1782,1784,1784,1780,1782,1786,1779,1773,
-    1778,1786,1779,1775,1782,1794,1793,1783,1776,1779,1781,1779,1774,1773,1780,1781,
-    1779,1779,1789,1799,1798,1794,1791,1779,1777,1784,1786,1789,1778,1771,1770,1780,
-    1785,1778,1779,1775,1772,1778,1783,1784,1778,1770,1773,1779,1778,1770,1767,1769,
-    1771,1770,1766,1772,1781,1780,1769,1770,1776,1783,1787,1784,1781,1787,1794,1791,
-    1793,1793,1789,1788,1796,1791,1789,1795,1793,1789,1786,1785,1784,1786,1786,1789,
-    1794,1793,1791,1793,1795,1795,1791,1790,1785,1783,1789,1797,1796,1788,1786,1792,
-    1800,1804,1796,1795,1793,1787,1791,1792,1784,1778,1781,1782,1784,1783,1770,1761,
-    1761,1765,1773,1779,1774,1771,1779,1783,1782,1786,1792,1784,1778,1778,1789,1795,
-    1790,1789,1789,1791,1792,1789,1788,1791,1794,1797,1790,1798,1801,1802,1807,1804,
-    1796,1793,1796,1800,1805,1799,1794,1798,1802,1797,1795,1793,1783,1779,1783,1791,
-    1791,1783,1774,1777,1786,1784,1784,1788,1781,1773,1769,1777,1791,1789,1786,1788,
-    1794,1797,1798,1794,1792,1785,1781,1784,1792,1798,1795,1791,1785,1775,1772,1784,
-    1790,1789,1782,1786,1791,1794,1793,1798,1801,1798,1799,1803,1809,1807,1804,1792,
-    1779,1777,1783,1786,1796,1794,1785,1777,1776,1780,1784,1783,1770,1761,1764,1772,
-    1772,1779,1784,1777,1765,1767,1775,1783,1778,1768,1766,1774,1783,1782,1790,1788,
-    1782,1788,1796,1804,1808,1806,1797,1788,1789,1788,1792,1793,1792,1795,1795,1806,
-    1811,1810,1803,1791,1786,1776,1779,1787,1791,1787,1778,1776,1778,1786,1777,1768,
-    1768,1771,1774,1776,1788,1786,1780,1780,1787,1791,1782,1778,1784,1785,1783,1784,
-    1783,1783,1783,1778,1780,1783,1785,1786,1789,1783,1773,1769,1773,1782,1787,1782,
-    1770,1774,1778,1783,1785,1786,1784,1784,1786,1783,1781,1787,1782,1778,1782,1779,
-    1778,1780,1785,1777,1771,1774,1782,1787,1781,1775,1779,1784,1783,1784,1788,1786,
-    1785,1780,1779,1790,1792,1789,1786,1789,1794,1794,1795,1790,1790,1799,1802,1802,
-    1800,1802,1800,1800,1800,1797,1792,1792,1791,1798,1800,1807,1815,1805,1796,1796,
-    1808,1809,1800,1791,1783,1775,1778,1777,1776,1770,1770,1772,1768,1766,1769,1772,
-    1778,1783,1779,1787,1788,1785,1784,1786,1787,1789,1801,1809,1805,1812,1807,1795,
-    1793,1790,1790,1778,1768,1765,1769,1782,1784,1779,1780,1775,1779,1784,1791,1791,
-    1789,1795,1793,1787,1783,1789,1792,1790,1782,1776,1775,1776,1781,1788,1784,1773,
-    1769,1768,1768,1772,1774,1776,1781,1776,1771,1775,1784,1785,1782,1779,1774,1772,
-    1774,1773,1779,1779,1780,1779,1776,1779,1776,1776,1778,1772,1765,1774,1781,1779,
-    1775,1771,1769,1770,1776,1778,1779,1776,1779,1789,1791,1790,1784,1780,1786,1794,
-    1794,1790,1795,1799,1793,1786,1783,1782,1781,1777,1774,1775,1776,1780,1787,1793,
-    1799,1791,1788,1786,1781,1787,1793,1794,1794,1794,1790,1786,1781,1782,1783,1781,
-    1780,1779,1779,1786,1792,1789,1789,1795,1796,1797,1796,1796,1796,1789,1785,1784,
-    1789,1790,1787,1783,1783,1790,1794,1794,1788,1789,1795,1798,1804,1802,1804,1805,
-    1809,1810,1803,1803,1800,1796,1788,1786,1788,1789,1785,1789,1789,1791,1796,1793,
-    1790,1788,1789,1789,1789,1787,1785,1781,1779,1779,1782,1785,1785,1785,1788,1798,
-    1806,1807,1809,1806,1801,1790,1781,1781,1779,1782,1789,1792,1790,1787,1786,1789,
-    1792,1793,1789,1788,1790,1786,1783,1787,1785,1778,1776,1774,1768,1770,1776,1786,
-    1785,1777,1778,1784,1788,1789,1793,1794,1797,1793,1787,1785,1783,1786,1788,1786,
-    1784,1783,1783,1787,1781,1776,1776,1779,1783,1782,1784,1785,1790,1798,1799,1797,
-    1793,1791,1791,1798,1799,1790,1784,1781,1779,1777,1777,1778,1776,1772,1774,1780,
-    1783,1779,1776,1772,1772,1774,1774,1778,1778,1777,1779,1779,1775,1776,1775,1774,
-    1771,1769,1777,1778,1783,1784,1778,1773,1779,1782,1782,1789,1790,1787,1785,1786,
-    1788,1791,1796,1803,1804,1804,1804,1804,1802,1801,1800,1795,1789,1789,1791,1787,
-    1786,1788,1785,1785,1785,1782,1783,1788,1789,1788,1791,1795,1795,1795,1798,1785,
-    1776,1772,1768,1774,1779,1777,1778,1785,1789,1787,1783,1785,1791,1788,1781,1779,
-    1778,1783,1783,1782,1783,1789,1792,1787,1790,1785,1783,1783,1781,1780,1781,1780,
-    1783,1785,1788,1790,1790,1788,1792,1798,1799,1798,1793,1790,1787,1787,1782,1783,
-    1789,1797,1802,1803,1807,1811,1810,1804,1803,1804,1800,1800,1798,1797,1795,1790,
-    1790,1792,1792,1793,1792,1793,1792,1788,1793,1795,1794,1791,1789,1785,1788,1794,
-    1797,1796,1794,1796,1796,1797,1796,1798,1797,1794,1789,1782,1784,1782,1771,1767,
-    1770,1777,1775,1772,1773,1778,1776,1772,1775,1781,1788,1785,1782,1781,1782,1780,
-    1777,1779,1786,1785,1785,1788,1786,1788,1788,1782,1779,1777,1782,1788,1786,1787,
-    1788,1788,1784,1786,1785,1788,1789,1791,1797,1797,1796,1795,1788,1780,1781,1774,
-    1770,1771,1774,1777,1783,1783,1781,1787,1782,1775,1776,1777,1776,1775,1772,1776,
-    1774,1772,1774,1774,1773,1773,1775,1779,1783,1784,1786,1790,1795,1800,1800,1796,
-    1795,1794,1791,1783,1774,1774,1778,1781,1780,1776,1779,1779,1779,1782,1785,1780,
-    1779,1780,1778,1785,1783,1781,1781,1782,1786,1792,1794,1794,1795,1791,1789,1790,
-    1787,1787,1786,1781,1780,1780,1780,1780,1785,1788,1788,1792,1793,1790,1793,1793,
-    1792,1791,1790,1794,1796,1797,1796,1794,1788,1784,1785,1786,1788,1795,1791,1792,
-    1798,1798,1793,1787,1787,1785,1781,1781,1785,1784,1785,1786,1788,1792,1798,1806,
-    1803,1799,1797,1796,1793,1784,1786,1789,1786,1787,1787,1790,1785,1779,1781,1779,
-    1778,1783,1782,1780,1778,1781,1782,1775,1772,1769,1769,1770,1778,1781,1785,1790,
-    1790,1792,1795,1798,1797,1798,1792,1787,1784,1777,1781,1780,1776,1779,1779,1786,
-    1783,1781,1784,1785,1795,1792,1791,1792,1792,1790,1785,1788,1786,1783,1783,1784,
-    1784,1783,1785,1785,1782,1783,1781,1778,1778,1775,1772,1773,1776,1780,1780,1781,
-    1784,1787,1788,1782,1781,1782,1780,1780,1779,1781,1781,1784,1779,1773,1776,1778,
-    1782,1779,1781,1783,1783,1783,1783,1786,1783,1781,1782,1781,1781,1780,1781,1780,
-    1777,1774,1771,1768,1774,1782,1783,1783,1783,1784,1782,1779,1778,1781,1785,1784,
-    1785,1788,1786,1784,1779,1789,1794,1792,1791,1790,1792,1793,1792,1791,1790,1791,
-    1795,1795,1796,1796,1796,1789,1781,1780,1779,1779,1782,1781,1784,1781,1779,1779,
-    1777,1781,1783,1780,1783,1787,1787,1786,1783,1780,1781,1784,1787,1785,1786,1791,
-    1790,1792,1790,1787,1782,1784,1785,1788,1788,1784,1782,1777,1779,1779,1777,1778,
-    1786,1787,1788,1788,1788,1788,1786,1784,1782,1783,1783,1781,1781,1784,1783,1783,
-    1783,1782,1783,1783,1784,1783,1785,1784,1785,1787,1789,1790,1795,1799,1798,1796,
-    1794,1797,1793,1791,1793,1794,1796,1795,1793,1791,1792,1792,1789,1789,1786,1787,
-    1782,1784,1789,1791,1792,1790,1791,1786,1779,1779,1784,1786,1786,1791,1795,1792,
-    1790,1787,1786,1788,1786,1788,1789,1789,1791,1787,1784,1784,1786,1784,1783,1788,
-    1792,1789,1785,1786,1785,1784,1783,1786,1789,1789,1787,1784,1788,1782,1779,1782,
-    1786,1788,1784,1781,1782,1785,1788,1790,1784,1785,1779,1776,1777,1781,1783,1785,
-    1786,1785,1788,1786,1790,1789,1790,1790,1793,1791,1787,1789,1791,1793,1788,1789,
-    1792,1790,1787,1784,1782,1781,1783,1782,1782,1781,1780,1781,1780,1778,1775,1775,
-    1777,1771,1770,1771,1771,1778,1783,1783,1784,1786,1784,1787,1790,1793,1797,1800,
-    1797,1798,1801,1802,1801,1798,1800,1802,1803,1800,1797,1796,1797,1797,1797,1799,
-    1800,1800,1794,1794,1799,1794,1787,1785,1785,1786,1785,1782,1781,1787,1788,1780,
-    1779,1778,1778,1776,1770,1775,1784,1781,1777,1777,1781,1784,1784,1785,1784,1784,
-    1781,1781,1781,1782,1787,1790,1790,1792,1795,1794,1793,1796,1796,1795,1798,1800,
-    1802,1802,1797,1795,1791,1792,1787,1790,1789,1786,1783,1782,1785,1782,1782,1778,
-    1780,1785,1789,1786,1786,1784,1780,1776,1774,1776,1786,1795,1793,1789,1788,1794,
-    1792,1789,1786,1785,1786,1787,1787,1784,1786,1784,1785,1790,1787,1787,1786,1782,
-    1780,1780,1784,1784,1786,1789,1789,1790,1784,1789,1792,1790,1789,1790,1794,1797,
-    1794,1788,1788,1794,1794,1787,1786,1787,1786,1785,1782,1781,1782,1781,1779,1774,
-    1778,1783,1784,1782,1780,1780,1779,1782,1778,1782,1783,1776,1773,1774,1771,1766,
-    1764,1766,1769,1773,1773,1772,1771,1769,1772,1773,1773,1772,1774,1777,1778,1777,
-    1780,1779,1781,1778,1778,1780,1776,1779,1780,1779,1777,1779,1783,1785,1785,1781,
-    1784,1784,1783,1782,1780,1780,1780,1780,1779,1782,1789,1796,1793,1789,1791,1793,
-    1795,1792,1790,1793,1794,1795,1793,1795,1796,1795,1793,1793,1791,1788,1787,1788,
-    1790,1788,1787,1785,1783,1786,1790,1792,1791,1789,1787,1788,1785,1785,1786,1785,
-    1784,1783,1782,1781,1783,1775,1774,1777,1778,1777,1777,1777,1775,1775,1770,1773,
-    1774,1768,1773,1781,1781,1783,1783,1781,1779,1778,1783,1785,1785,1787,1788,1792,
-    1789,1785,1784,1789,1795,1794,1796,1795,1794,1792,1789,1788,1795,1795,1794,1789,
-    1786,1790,1793,1793,1791,1789,1790,1793,1789,1793,1800,1805,1800,1801,1800,1796,
-    1797,1799,1803,1802,1806,1811,1806,1801,1800,1798,1797,1794,1790,1786,1785,1784,
-    1788,1792,1786,1785,1790,1789,1789,1788,1776,1771,1773,1771,1770,1775,1780,1784,
-    1785,1786,1788,1784,1786,1787,1791,1793,1798,1800,1797,1803,1806,1800,1799,1800,
-    1801,1803,1794,1790,1788,1784,1782,1778,1776,1781,1786,1784,1780,1787,1783,1778,
-    1777,1781,1781,1781,1777,1777,1779,1775,1768,1762,1764,1767,1776,1772,1771,1775,
-    1774,1768,1771,1775,1785,1789,1790,1797,1795,1792,1787,1786,1792,1795,1797,1797,
-    1797,1798,1800,1796,1791,1794,1791,1791,1794,1796,1796,1800,1804,1798,1792,1796,
-    1798,1795,1794,1787,1783,1782,1781,1776,1773,1775,1775,1776,1776,1774,1778,1782,
-    1776,1773,1771,1777,1781,1779,1779,1780,1780,1778,1774,1777,1782,1782,1778,1778,
-    1783,1780,1782,1780,1776,1774,1773,1775,1772,1777,1781,1778,1775,1776,1776,1770,
-    1771,1772,1771,1769,1772,1779,1784,1782,1781,1784,1783,1786,1785,1785,1787,1793,
-    1792,1787,1787,1785,1787,1786,1787,1788,1787,1786,1789,1785,1780,1786,1787,1785,
-    1784,1784,1786,1785,1788,1785,1780,1780,1782,1782,1781,1775,1776,1781,1778,1782,
-    1789,1791,1788,1791,1793,1795,1796,1795,1795,1794,1792,1794,1798,1797,1790,1787,
-    1787,1793,1795,1795,1797,1800,1802,1800,1798,1795,1792,1792,1794,1795,1791,1788,
-    1789,1791,1795,1798,1794,1783,1781,1784,1788,1781,1774,1774,1778,1779,1774,1776,
-    1782,1783,1780,1778,1774,1767,1767,1768,1774,1782,1781,1784,1787,1788,1789,1797,
-    1796,1794,1794,1796,1796,1802,1806,1804,1808,1813,1815,1813,1811,1809,1808,1808,
-    1802,1805,1805,1801,1800,1796,1802,1797,1796,1795,1793,1791,1792,1789,1783,1782,
-    1788,1787,1783,1780,1791,1785,1788,1812,1787,1780,1791,1795,1781,1769,1774,1767,
-    1765,1768,1769,1777,1774,1775,1780,1780,1787,1788,1790,1803,1813,1815,1827,1828,
-    1823,1817,1818,1821,1818,1816,1803,1787,1786,1788,1779,1775,1777,1776,1775,1778,
-    1776,1774,1775,1771,1767,1761,1764,1765,1766,1769,1766,1763,1760,1766,1773,1771,
-    1774,1779,1783,1787,1785,1786,1785,1789,1784,1783,1783,1790,1791,1790,1785,1781,
-    1786,1790,1791,1789,1790,1789,1787,1787,1799,1791,1792,1792,1801,1792,1801,1844,
-    1825,1796,1823,1856,1842,1815,1808,1790,1750,1724,1700,1692,1688,1698,1722,1747,
-    1761,1777,1795,1808,1818,1822,1831,1835,1841,1841,1827,1811,1796,1783,1772,1763,
-    1757,1752,1748,1740,1739,1739,1738,1733,1732,1744,1759,1777,1792,1808,1814,1807,
-    1800,1796,1789,1781,1775,1772,1777,1780,1780,1775,1775,1770,1771,1773,1781,1792,
-    1805,1818,1816,1821,1816,1806,1798,1793,1788,1786,1794,1795,1798,1804,1809,1803,
-    1795,1794,1789,1778,1773,1776,1770,1766,1774,1775,1776,1784,1788,1785,1781,1786,
-    1786,1776,1780,1790,1792,1790,1783,1782,1784,1778,1773,1769,1769,1775,1778,1783,
-    1781,1775,1774,1779,1790,1791,1793,1795,1801,1808,1813,1812,1797,1791,1795,1806,
-    1801,1793,1798,1794,1782,1776,1783,1787,1783,1785,1797,1803,1806,1799,1786,1780,
-    1782,1777,1769,1768,1770,1769,1765,1765,1762,1765,1761,1758,1759,1763,1762,1761,
-    1762,1770,1784,1792,1798,1796,1785,1766,1755,1747,1744,1741,1747,1759,1772,1781,
-    1776,1760,1748,1747,1743,1736,1731,1736,1738,1740,1742,1745,1746,1745,1753,1772,
-    1781,1784,1784,1793,1798,1803,1804,1805,1802,1797,1821,1842,1854,1854,1851,1853,
-    1856,1864,1872,1878,1892,1909,1929,1941,1945,1934,1920,1901,1890,1886,1870,1855,
-    1847,1845,1833,1822,1811,1796,1773,1755,1747,1742,1738,1735,1738,1748,1751,1755,
-    1757,1751,1742,1735,1737,1735,1735,1729,1729,1727,1717,1707,1696,1685,1683,1695,
-    1713,1719,1733,1743,1744,1738,1730,1722,1721,1722,1727,1737,1738,1737,1722,1709,
-    1686,1675,1661,1642,1623,1609,1597,1591,1586,1589,1594,1610,1636,1672,1688,1704,
-    1725,1759,1845,1995,2185,2370,2524,2626,2685,2664,2556,2349,2099,1852,1672,1556,
-    1500,1465,1457,1466,1473,1468,1450,1429,1448,1551,1708,1887,2035,2151,2215,2236,
-    2185,2073,1933,1802,1707,1668,1651,1644,1626,1601,1578,1549,1513,1482,1476,1531,
-    1640,1768,1884,1963,2021,2056,2073,2058,2016,1977,1964,1956,1934,1875,1794,1695,
-    1597,1513,1453,1417,1424,1481,1569,1664,1736,1785,1818,1844,1863,1873,1874,1875,
-    1872,1868,1843,1791,1716,1644,1582,1542,1520,1517,1543,1589,1641,1683,1712,1727,
-    1740,1753,1755,1756,1752,1736,1719,1681,1636,1578,1525,1481,1458,1459,1490,1545,
-    1629,1744,1893,2092,2354,2599,2764,2869,2933,2907,2757,2517,2218,1913,1660,1498,
-    1371,1281,1249,1274,1300,1317,1330,1352,1428,1597,1810,2001,2154,2283,2371,2383,
-    2302,2130,1925,1750,1637,1556,1496,1457,1451,1456,1466,1453,1420,1406,1451,1560,
-    1703,1849,1988,2111,2198,2232,2195,2106,2006,1935,1895,1872,1846,1818,1792,1764,
-    1716,1639,1575,1540,1540,1588,1656,1719,1780,1839,1876,1898,1895,1881,1868,1868,
-    1873,1857,1822,1775,1714,1641,1566,1496,1459,1467,1510,1566,1638,1701,1749,1781,
-    1798,1786,1768,1749,1724,1696,1658,1612,1558,1505,1460,1435,1425,1439,1483,1529,
-    1579,1645,1713,1784,1868,2004,2211,2490,2715,2828,2923,2989,2915,2693,2399,2040,
-    1717,1520,1368,1232,1196,1251,1314,1370,1412,1411,1454,1607,1786,1959,2151,2338,
-    2477,2543,2487,2296,2059,1848,1654,1501,1407,1352,1351,1377,1384,1341,1306,1298,
-    1334,1418,1543,1696,1880,2068,2200,2253,2227,2150,2054,1954,1865,1829,1826,1842,
-    1850,1848,1810,1745,1686,1626,1584,1585,1621,1680,1757,1835,1892,1923,1938,1926,
-    1918,1905,1879,1868,1857,1818,1763,1708,1640,1563,1508,1473,1471,1511,1563,1616,
-    1670,1717,1729,1717,1696,1657,1620,1592,1568,1560,1570,1579,1579,1591,1612,1637,
-    1665,1689,1705,1729,1783,1848,1895,1929,1973,2091,2272,2422,2491,2552,2631,2652,
-    2574,2412,2183,1953,1781,1634,1484,1387,1378,1411,1448,1469,1476,1515,1598,1688,
-    1776,1875,2005,2132,2217,2228,2165,2072,1965,1841,1709,1597,1530,1501,1483,1443,
-    1403,1387,1394,1413,1434,1484,1577,1702,1827,1922,1989,2031,2070,2070,2051,2039,
-    2020,2013,2003,1989,1934,1870,1802,1730,1660,1598,1556,1558,1602,1657,1717,1779,
-    1832,1878,1917,1919,1906,1894,1877,1844,1793,1734,1683,1655,1634,1613,1610,1621,
-    1621,1618,1614,1586,1563,1559,1558,1556,1563,1573,1597,1627,1667,1695,1730,1776,
-    1805,1819,1830,1848,1843,1826,1792,1763,1755,1768,1781,1790,1810,1881,1995,2114,
-    2206,2281,2365,2462,2501,2440,2326,2198,2059,1907,1759,1625,1549,1546,1555,1553,
-    1569,1585,1607,1631,1652,1674,1732,1820,1898,1950,1977,1982,1956,1894,1790,1685,
-    1606,1551,1514,1497,1499,1529,1572,1601,1602,1600,1616,1655,1700,1753,1807,1887,
-    1970,2004,2030,2034,2011,1973,1969,1956,1913,1888,1855,1818,1784,1740,1676,1652,
-    1658,1663,1700,1756,1806,1849,1881,1872,1846,1819,1773,1722,1682,1651,1659,1683,
-    1686,1682,1676,1669,1630,1595,1561,1548,1565,1596,1628,1661,1697,1723,1734,1738,
-    1725,1723,1749,1773,1786,1801,1821,1822,1803,1770,1738,1725,1726,1733,1746,1766,
-    1793,1815,1823,1793,1781,1812,1865,1942,2059,2160,2241,2337,2386,2336,2248,2169,
-    2053,1940,1865,1810,1778,1782,1765,1709,1657,1608,1560,1532,1538,1563,1632,1718,
-    1776,1805,1806,1776,1717,1654,1584,1544,1551,1584,1632,1683,1723,1756,1782,1782,
-    1770,1772,1785,1812,1848,1881,1898,1910,1910,1876,1845,1830,1829,1837,1863,1893,
-    1911,1914,1908,1889,1860,1828,1801,1798,1808,1813,1818,1828,1817,1782,1734,1688,
-    1646,1619,1608,1608,1620,1641,1660,1685,1678,1656,1649,1645,1652,1654,1678,1706,
-    1738,1757,1757,1753,1747,1741,1732,1736,1746,1763,1786,1807,1806,1798,1786,1778,
-    1785,1791,1799,1818,1847,1862,1860,1843,1813,1786,1760,1748,1739,1733,1742,1757,
-    1770,1764,1770,1790,1808,1851,1923,1982,2038,2119,2166,2148,2112,2064,1978,1904,
-    1846,1787,1770,1782,1778,1772,1771,1741,1703,1681,1655,1639,1662,1699,1711,1726,
-    1722,1708,1697,1676,1653,1646,1671,1697,1727,1761,1791,1816,1835,1835,1832,1828,
-    1829,1829,1833,1838,1845,1850,1854,1856,1849,1842,1833,1822,1818,1823,1823,1822,
-    1815,1816,1809,1795,1770,1753,1737,1722,1715,1716,1731,1744,1759,1765,1757,1751,
-    1748,1743,1736,1728,1738,1744,1748,1744,1739,1735,1731,1713,1698,1704,1717,1733,
-    1742,1742,1730,1731,1715,1703,1703,1712,1721,1734,1757,1773,1794,1808,1815,1819,
-    1822,1820,1819,1824,1833,1836,1842,1841,1832,1818,1800,1776,1756,1746,1739,1733,
-    1741,1754,1766,1775,1768,1771,1773,1774,1777,1781,1793,1819,1837,1850,1869,1881,
-    1867,1856,1859,1849,1838,1837,1841,1845,1859,1858,1856,1866,1879,1872,1867,1867,
-    1865,1870,1873,1870,1860,1859,1851,1840,1826,1800,1780,1780,1762,1739,1724,1706,
-    1700,1699,1698,1698,1713,1732,1747,1761,1763,1764,1766,1759,1746,1744,1749,1747,
-    1753,1753,1745,1739,1738,1731,1731,1736,1747,1770,1790,1813,1831,1842,1847,1846,
-    1839,1836,1834,1831,1832,1828,1822,1808,1792,1777,1765,1758,1751,1744,1745,1748,
-    1760,1762,1756,1747,1747,1737,1729,1734,1730,1731,1734,1741,1740,1744,1742,1743,
-    1745,1745,1743,1741,1741,1746,1755,1766,1775,1782,1786,1788,1792,1797,1805,1815,
-    1827,1835,1837,1835,1832,1823,1809,1797,1794,1789,1786,1784,1783,1777,1775,1769,
-    1760,1757,1756,1763,1774,1781,1781,1784,1778,1766,1761,1760,1774,1799,1808,1823,
-    1861,1884,1883,1892,1899,1898,1907,1911,1904,1916,1932,1922,1903,1895,1879,1859,
-    1839,1816,1800,1805,1807,1794,1786,1780,1770,1761,1751,1729,1732,1746,1748,1744,
-    1739,1737,1736,1733,1725,1719,1719,1721,1718,1718,1711,1714,1719,1724,1731,1740,
-    1759,1773,1783,1796,1795,1798,1808,1803,1797,1793,1792,1791,1790,1787,1785,1785,
-    1795,1797,1804,1811,1813,1817,1815,1815,1817,1813,1807,1803,1796,1787,1778,1763,
-    1751,1737,1723,1716,1720,1724,1729,1738,1746,1757,1765,1779,1790,1799,1804,1806,
-    1806,1809,1803,1806,1806,1804,1800,1790,1788,1791,1792,1788,1801,1808,1820,1820,
-    1807,1797,1793,1791,1781,1775,1775,1783,1790,1795,1789,1783,1778,1768,1758,1745,
-    1746,1747,1754,1759,1754,1755,1759,1764,1761,1764,1769,1776,1787,1808,1825,1840,
-    1849,1849,1854,1846,1843,1838,1846,1856,1858,1865,1873,1876,1867,1858,1846,1829,
-    1826,1827,1823,1811,1809,1812,1794,1781,1769,1762,1746,1753,1752,1739,1736,1736,
-    1730,1723,1713,1711,1727,1728,1731,1732,1740,1747,1752,1753,1754,1761,1763,1769,
-    1778,1787,1789,1794,1796,1803,1806,1800,1795,1796,1802,1800,1801,1810,1814,1806,
-    1808,1798,1803,1782,1788,1782,1775,1775,1766,1769,1753,1751,1745,1750,1743,1750,
-    1750,1766,1759,1755,1758,1754,1761,1753,1756,1763,1753,1763,1773,1758,1753,1753,
-    1755,1746,1751,1756,1757,1780,1779,1785,1801,1790,1793,1785,1777,1770,1771,1761,
-    1752,1770,1772,1763,1758,1764,1756,1746,1749,1757,1813,1876,1892,1887,1930,1950,
-    1922,1888,1867,1866,1868,1872,1854,1869,1912,1911,1883,1854,1840,1813,1796,1765,
-    1749,1772,1793,1797,1795,1792,1781,1773,1743,1733,1708,1788,1799,1745,1751,1788,
-    1797,1760,1733,1710,1719,1720,1728,1730,1766,1769,1777,1777,1780,1779,1779,1785,
-    1780,1791,1806,1804,1795,1800,1802,1810,1804,1791,1793,1802,1807,1828,1832,1830,
-    1840,1847,1845,1828,1820,1815,1820,1817,1800,1812,1826,1826,1820,1814,1804,1804,
-    1798,1775,1768,1769,1762,1755,1747,1735,1728,1719,1695,1688,1692,1698,1701,1693,
-    1698,1706,1715,1706,1700,1718,1731,1743,1763,1777,1775,1790,1792,1775,1756,1725,
-    1698,1683,1670,1636,1606,1591,1565,1508,1437,1368,1338,1385,1566,1878,2190,2431,
-    2725,3031,3113,2964,2718,2395,2035,1698,1378,1178,1193,1283,1316,1354,1410,1442,
-    1475,1509,1575,1773,2059,2290,2456,2554,2525,2367,2092,1734,1422,1244,1145,1123,
-    1205,1347,1497,1620,1670,1686,1741,1829,1923,2035,2168,2298,2375,2331,2184,1985,
-    1767,1559,1386,1291,1308,1423,1554,1663,1758,1836,1918,1983,2029,2092,2192,2254,
-    2248,2164,2017,1830,1612,1396,1236,1198,1265,1403,1575,1758,1918,2023,2034,1965,
-    1895,1824,1734,1652,1589,1550,1534,1514,1484,1487,1529,1585,1636,1692,1740,1766,
-    1760,1706,1635,1560,1502,1460,1449,1451,1448,1431,1412,1472,1649,1988,2422,2822,
-    3115,3402,3588,3426,2959,2373,1771,1200,751,459,432,699,1083,1407,1694,1958,
-    2146,2266,2344,2431,2566,2701,2710,2588,2361,2009,1554,1057,620,378,385,586,
-    933,1392,1885,2306,2576,2666,2628,2529,2390,2213,2041,1900,1772,1603,1380,1143,
-    958,865,878,1030,1317,1716,2137,2475,2673,2730,2652,2444,2167,1888,1679,1540,
-    1455,1393,1384,1426,1469,1497,1581,1747,1945,2126,2270,2365,2379,2283,2059,1800,
-    1571,1412,1316,1280,1328,1448,1565,1627,1656,1669,1665,1658,1646,1659,1701,1753,
-    1768,1752,1729,1700,1657,1618,1600,1606,1640,1647,1618,1560,1518,1469,1405,1341,
-    1309,1318,1436,1697,2129,2669,3089,3320,3551,3675,3346,2666,1973,1339,748,322,
-    136,282,771,1340,1765,2140,2490,2704,2746,2691,2638,2638,2573,2336,1993,1648,
-    1271,854,486,306,402,732,1179,1675,2193,2636,2892,2897,2716,2446,2151,1825,
-    1513,1276,1143,1068,1004,962,1002,1154,1384,1669,2002,2373,2711,2907,2902,2733,
-    2443,2055,1615,1216,948,862,925,1091,1328,1624,1924,2159,2338,2516,2656,2681,
-    2585,2430,2234,1965,1635,1318,1105,1010,1033,1156,1391,1665,1914,2073,2112,2056,
-    1938,1761,1568,1436,1378,1377,1412,1482,1577,1684,1759,1786,1795,1794,1760,1686,
-    1617,1571,1551,1577,1614,1687,1734,1748,1681,1563,1385,1217,1199,1474,2101,2794,
-    3237,3526,3905,3910,3217,2218,1419,760,226,0,206,833,1625,2201,2485,2681,
-    2768,2641,2364,2192,2220,2291,2169,1862,1532,1199,785,373,183,371,879,1501,
-    2097,2634,3009,3092,2841,2398,1965,1630,1377,1210,1174,1240,1311,1314,1287,1325,
-    1464,1680,1960,2300,2646,2893,2920,2691,2278,1789,1309,914,728,799,1080,1450,
-    1814,2097,2294,2372,2335,2231,2150,2115,2068,1984,1876,1770,1621,1455,1315,1285,
-    1364,1515,1693,1863,2007,2056,1996,1858,1730,1635,1573,1562,1603,1696,1766,1773,
-    1714,1629,1518,1413,1327,1325,1414,1569,1734,1875,1998,2084,2089,2023,1894,1715,
-    1532,1371,1218,1066,975,939,1049,1320,1883,2651,3306,3583,3800,4000,3683,2776,
-    1819,1102,494,86,18,371,1020,1739,2244,2561,2781,2862,2728,2458,2253,2156,
-    2008,1705,1362,1105,883,661,535,661,1052,1586,2086,2498,2797,2919,2773,2423,
-    2033,1697,1438,1226,1140,1182,1285,1353,1423,1539,1715,1912,2118,2317,2503,2619,
-    2563,2342,2019,1670,1353,1136,1081,1209,1448,1704,1928,2081,2144,2122,2036,1935,
-    1873,1849,1833,1841,1871,1894,1878,1828,1788,1783,1770,1726,1684,1667,1641,1594,
-    1563,1586,1648,1731,1821,1899,1952,1946,1858,1727,1593,1449,1310,1206,1203,1291,
-    1458,1662,1880,2056,2155,2137,2024,1854,1674,1505,1373,1319,1312,1324,1332,1359,
-    1358,1411,1620,2143,2805,3220,3340,3528,3587,3013,2053,1344,892,450,290,615,
-    1240,1850,2341,2660,2820,2759,2461,2109,1883,1740,1571,1382,1263,1219,1141,1036,
-    1079,1337,1636,1875,2121,2351,2443,2307,2035,1801,1640,1464,1318,1356,1541,1704,
-    1785,1841,1926,1998,1966,1884,1869,1915,1896,1825,1805,1828,1817,1753,1708,1742,
-    1810,1839,1836,1843,1858,1828,1749,1695,1702,1740,1759,1782,1848,1939,2007,2037,
-    2036,2005,1927,1804,1688,1582,1486,1429,1456,1547,1680,1816,1932,2018,2045,1995,
-    1878,1738,1601,1483,1397,1359,1355,1372,1401,1478,1591,1742,1869,1981,2044,2043,
-    1961,1837,1711,1600,1488,1377,1297,1231,1158,1099,1188,1444,1978,2672,3211,3411,
-    3571,3587,3055,2148,1451,1016,606,441,749,1353,1874,2238,2502,2667,2625,2387,
-    2113,1956,1851,1653,1400,1235,1172,1112,1075,1237,1587,1913,2110,2238,2289,2183,
-    1931,1651,1465,1422,1447,1506,1627,1770,1869,1912,1915,1910,1908,1890,1854,1819,
-    1778,1713,1644,1620,1650,1728,1843,1979,2101,2154,2135,2057,1950,1812,1675,1596,
-    1565,1551,1587,1661,1761,1830,1884,1938,2010,2081,2109,2078,1989,1857,1688,1502,
-    1360,1305,1345,1495,1707,1902,2028,2080,2040,1922,1763,1627,1521,1477,1458,1489,
-    1522,1543,1528,1536,1581,1675,1767,1819,1856,1893,1878,1745,1587,1461,1375,1263,
-    1201,1191,1300,1556,2077,2713,3137,3213,3276,3267,2752,1903,1302,996,698,633,
-    1012,1628,2124,2483,2702,2745,2570,2263,1976,1818,1700,1541,1359,1225,1164,1129,
-    1149,1369,1763,2091,2270,2383,2374,2122,1708,1324,1119,1078,1140,1318,1631,1951,
-    2125,2154,2150,2123,2024,1875,1767,1713,1638,1526,1462,1490,1569,1666,1822,2011,
-    2179,2285,2316,2281,2195,2053,1844,1636,1488,1397,1357,1407,1533,1691,1837,1965,
-    2067,2128,2115,2041,1948,1848,1707,1545,1459,1449,1459,1496,1612,1756,1869,1921,
-    1901,1844,1772,1677,1592,1549,1548,1552,1544,1548,1565,1581,1579,1617,1687,1741,
-    1755,1740,1709,1634,1523,1382,1286,1233,1252,1377,1727,2312,2921,3212,3217,3226,
-    3038,2371,1535,1057,797,597,704,1254,1906,2397,2778,3042,3034,2710,2264,1887,
-    1616,1392,1209,1115,1127,1178,1233,1349,1614,1950,2224,2392,2474,2414,2160,1793,
-    1434,1172,1041,1021,1148,1420,1719,1941,2114,2251,2270,2167,2013,1868,1721,1568,
-    1447,1421,1495,1607,1730,1894,2088,2220,2262,2256,2240,2152,1981,1804,1690,1605,
-    1516,1468,1488,1564,1671,1795,1895,1981,2052,2072,2021,1937,1835,1704,1574,1498,
-    1497,1532,1580,1647,1718,1745,1712,1668,1636,1621,1636,1706,1779,1827,1827,1770,
-    1662,1534,1435,1403,1439,1514,1589,1644,1667,1624,1533,1406,1300,1237,1350,1661,
-    2179,2794,3254,3342,3229,3057,2591,1825,1172,859,674,648,961,1536,2062,2455,
-    2748,2893,2795,2498,2156,1858,1605,1375,1179,1078,1113,1219,1332,1523,1815,2065,
-    2181,2225,2208,2076,1838,1581,1408,1337,1339,1379,1489,1636,1761,1832,1887,1934,
-    1961,1942,1857,1751,1666,1594,1544,1564,1679,1829,1955,2069,2172,2226,2205,2123,
-    2004,1863,1735,1647,1609,1632,1692,1770,1826,1874,1893,1886,1852,1820,1810,1812,
-    1811,1808,1788,1737,1674,1622,1593,1597,1642,1685,1705,1693,1643,1549,1485,1474,
-    1534,1631,1767,1890,1959,1923,1799,1621,1450,1334,1296,1332,1412,1498,1555,1543,
-    1463,1382,1381,1568,1978,2593,3142,3346,3209,3061,2773,2087,1302,924,823,749,
-    911,1428,2025,2412,2648,2789,2781,2555,2205,1869,1622,1430,1266,1138,1153,1328,
-    1527,1693,1915,2153,2241,2166,2056,1921,1719,1490,1328,1284,1347,1458,1588,1755,
-    1927,2039,2059,2010,1932,1826,1679,1543,1444,1395,1412,1507,1669,1864,2055,2196,
-    2267,2300,2305,2228,2050,1837,1649,1514,1425,1423,1537,1710,1878,2017,2099,2116,
-    2063,1943,1814,1725,1671,1637,1654,1685,1690,1669,1653,1654,1690,1745,1758,1714,
-    1646,1555,1439,1366,1389,1505,1643,1781,1874,1910,1859,1751,1627,1536,1465,1395,
-    1360,1356,1353,1304,1240,1244,1474,1908,2495,3127,3521,3432,3148,2907,2406,1573,
-    937,767,738,780,1120,1723,2286,2645,2840,2876,2711,2409,2051,1694,1399,1214,
-    1078,988,1080,1360,1643,1886,2158,2375,2392,2250,2060,1854,1608,1368,1228,1240,
-    1343,1441,1559,1726,1904,2018,2049,2025,1989,1914,1764,1581,1453,1395,1396,1457,
-    1616,1850,2060,2188,2271,2337,2345,2247,2036,1779,1590,1471,1386,1402,1542,1739,
-    1905,2023,2074,2086,2062,1998,1911,1830,1767,1720,1675,1612,1560,1549,1541,1550,
-    1610,1703,1763,1765,1723,1655,1584,1514,1499,1541,1609,1662,1707,1707,1693,1659,
-    1604,1517,1456,1380,1262,1170,1173,1265,1425,1743,2279,2995,3490,3434,3040,2834,
-    2626,2006,1245,918,920,900,975,1369,1963,2454,2742,2829,2755,2550,2258,1913,
-    1621,1445,1320,1152,1050,1154,1375,1599,1867,2184,2404,2432,2302,2071,1816,1557,
-    1310,1150,1172,1310,1454,1600,1779,1981,2093,2078,1987,1887,1786,1668,1565,1531,
-    1536,1552,1572,1619,1725,1869,2018,2181,2351,2460,2380,2108,1810,1605,1478,1403,
-    1437,1590,1789,1925,1970,1999,2049,2068,2023,1949,1862,1772,1683,1632,1627,1660,
-    1674,1660,1654,1646,1644,1637,1648,1648,1655,1619,1554,1502,1489,1503,1548,1628,
-    1686,1711,1678,1595,1439,1216,981,844,903,1187,1706,2482,3351,3773,3431,2944,
-    2834,2600,1825,1122,947,909,778,852,1270,1845,2414,2781,2859,2768,2635,2394,
-    2028,1727,1547,1323,1015,887,1071,1358,1601,1863,2109,2234,2269,2254,2184,2097,
-    1982,1757,1457,1222,1096,1074,1191,1450,1766,2006,2085,2059,1995,1895,1773,1670,
-    1627,1620,1586,1509,1479,1544,1669,1829,2026,2241,2423,2469,2325,2081,1853,1668,
-    1491,1361,1327,1445,1659,1862,2032,2208,2307,2263,2135,1989,1853,1707,1574,1487,
-    1473,1478,1499,1574,1698,1778,1815,1817,1769,1675,1622,1595,1556,1496,1462,1428,
-    1410,1434,1506,1578,1543,1412,1212,1132,1166,1364,1677,2376,3218,3411,2832,2600,
-    2994,2834,1961,1333,1211,993,785,872,1260,1786,2270,2425,2347,2431,2634,2586,
-    2283,2049,1900,1561,1097,896,1072,1330,1498,1586,1670,1845,2070,2252,2385,2513,
-    2468,2186,1800,1447,1193,1104,1105,1143,1270,1481,1655,1803,1996,2153,2192,2117,
-    1981,1842,1716,1570,1420,1328,1351,1442,1582,1801,2139,2445,2512,2374,2262,2187,
-    1998,1712,1473,1344,1303,1341,1478,1753,2076,2261,2273,2220,2167,2073,1900,1729,
-    1627,1556,1458,1388,1389,1469,1537,1577,1594,1637,1691,1735,1735,1718,1655,1523,
-    1381,1303,1319,1307,1222,1184,1236,1273,1326,1659,2590,3408,3154,2487,2830,3436,
-    2887,1821,1365,1229,1013,910,883,1105,1695,2052,1877,1939,2537,2958,2833,2463,
-    2143,1957,1744,1388,1122,1161,1282,1237,1125,1269,1696,2105,2274,2300,2337,2406,
-    2436,2341,2130,1876,1550,1165,927,943,1070,1228,1387,1488,1625,1876,2129,2273,
-    2350,2307,2109,1846,1645,1526,1460,1384,1338,1403,1536,1661,1897,2256,2460,2388,
-    2181,2004,1910,1861,1780,1682,1640,1643,1635,1673,1818,1999,2063,1975,1851,1796,
-    1800,1791,1727,1637,1593,1594,1561,1533,1588,1628,1553,1454,1428,1464,1526,1526,
-    1401,1261,1224,1303,1366,1308,1315,1671,2486,3062,2664,2137,2765,3639,3234,2241,
-    1821,1693,1533,1380,1063,927,1284,1405,1090,1311,2081,2481,2458,2389,2315,2422,
-    2609,2360,1839,1597,1456,1178,1004,1039,1155,1332,1453,1503,1722,2119,2404,2490,
-    2498,2458,2371,2242,2025,1710,1418,1199,1019,914,1011,1194,1304,1408,1614,1878,
-    2140,2290,2245,2181,2224,2235,2090,1898,1759,1644,1534,1480,1510,1584,1647,1654,
-    1658,1749,1910,2036,2049,2044,2091,2102,2057,2017,1976,1877,1747,1617,1554,1600,
-    1637,1537,1423,1435,1487,1535,1617,1690,1670,1633,1580,1514,1495,1491,1370,1232,
-    1235,1264,1248,1357,1843,2478,2514,2086,2402,3305,3404,2692,2252,2156,2077,2025,
-    1722,1273,1271,1367,1077,1000,1349,1533,1527,1690,1913,2280,2695,2635,2304,2276,
-    2266,2005,1827,1677,1404,1287,1284,1173,1225,1467,1532,1543,1764,1989,2146,2272,
-    2233,2122,2150,2157,2022,1864,1700,1507,1430,1449,1395,1369,1432,1453,1445,1521,
-    1630,1741,1851,1917,1988,2128,2226,2167,2053,2011,2012,1943,1794,1661,1596,1559,
-    1573,1663,1708,1674,1644,1677,1774,1926,2068,2062,1953,1878,1858,1840,1788,1687,
-    1528,1408,1391,1424,1451,1466,1383,1255,1175,1116,1106,1166,1244,1382,1727,2263,
-    2503,2339,2609,3310,3383,2820,2491,2449,2371,2235,1889,1406,1309,1333,1013,923,
-    1273,1362,1228,1329,1537,1820,2173,2155,1924,2140,2484,2388,2192,2125,1997,2000,
-    2020,1744,1545,1608,1517,1396,1547,1651,1566,1537,1527,1560,1767,1901,1815,1759,
-    1814,1899,2030,2069,1959,1880,1878,1859,1898,1965,1924,1809,1704,1595,1525,1527,
-    1502,1466,1466,1497,1582,1697,1769,1824,1917,1986,1990,2012,2058,2049,1994,1953,
-    1913,1838,1737,1625,1531,1518,1542,1526,1532,1607,1653,1630,1588,1557,1503,1452,
-    1401,1254,1138,1249,1427,1421,1475,1908,2308,2206,2188,2711,3014,2742,2517,2547,
-    2580,2550,2333,1930,1762,1808,1606,1317,1292,1246,1097,1071,1066,1157,1482,1688,
-    1646,1775,2032,2108,2160,2249,2168,2088,2113,2039,1962,1986,1919,1814,1821,1810,
-    1787,1824,1786,1691,1725,1739,1647,1640,1677,1633,1631,1666,1598,1547,1611,1685,
-    1719,1771,1827,1854,1879,1888,1876,1920,1963,1885,1766,1703,1684,1652,1574,1512,
-    1528,1577,1592,1599,1686,1814,1883,1884,1870,1880,1943,1972,1877,1808,1842,1875,
-    1824,1772,1781,1810,1813,1785,1795,1884,1925,1826,1757,1769,1739,1680,1642,1594,
-    1567,1596,1592,1560,1600,1697,1740,1724,1707,1738,1829,1888,1866,1850,1900,1970,
-    1998,1944,1897,1922,1945,1918,1887,1856,1845,1869,1890,1921,1961,1987,1986,1989,
-    2012,2052,2058,1960,1834,1792,1789,1774,1763,1773,1772,1746,1706,1696,1723,1714,
-    1665,1640,1629,1621,1642,1673,1664,1657,1678,1655,1613,1627,1684,1710,1687,1636,
-    1617,1646,1649,1623,1672,1793,1867,1900,1942,1957,1937,1929,1896,1866,1897,1902,
-    1827,1781,1797,1786,1735,1699,1687,1696,1735,1761,1780,1839,1881,1843,1815,1838,
-    1855,1818,1760,1729,1733,1749,1757,1740,1720,1714,1691,1648,1624,1631,1620,1586,
-    1556,1548,1560,1608,1654,1671,1700,1740,1794,1883,1970,1980,1983,2020,2047,2046,
-    2063,2083,2079,2063,2024,1974,1933,1898,1839,1785,1768,1769,1778,1814,1861,1918,
-    1964,1976,1953,1921,1916,1901,1857,1802,1741,1678,1658,1654,1647,1654,1646,1597,
-    1566,1588,1608,1617,1651,1694,1730,1748,1745,1729,1739,1744,1705,1673,1670,1683,
-    1697,1713,1726,1754,1789,1827,1871,1924,1958,1976,1967,1941,1914,1872,1822,1773,
-    1762,1772,1770,1748,1744,1754,1756,1771,1798,1797,1787,1799,1794,1767,1748,1720,
-    1695,1712,1726,1715,1731,1762,1763,1762,1763,1737,1700,1677,1664,1660,1662,1662,
-    1669,1695,1722,1737,1762,1802,1839,1876,1905,1909,1921,1936,1934,1933,1923,1901,
-    1912,1936,1921,1892,1879,1860,1827,1814,1805,1793,1803,1832,1844,1843,1843,1833,
-    1821,1808,1786,1764,1747,1729,1713,1687,1679,1704,1741,1785,1806,1796,1776,1764,
-    1769,1778,1788,1792,1770,1744,1729,1710,1684,1678,1701,1712,1680,1664,1693,1715,
-    1723,1728,1716,1721,1769,1779,1751,1770,1798,1792,1784,1754,1716,1733,1766,1769,
-    1794,1836,1837,1821,1820,1825,1846,1872,1859,1850,1875,1868,1823,1786,1762,1756,
-    1777,1806,1823,1852,1880,1890,1876,1834,1801,1783,1765,1730,1695,1659,1609,1572,
-    1571,1607,1660,1722,1778,1816,1852,1898,1939,1930,1888,1863,1850,1841,1843,1848,
-    1839,1840,1864,1863,1854,1865,1878,1867,1861,1879,1894,1897,1890,1854,1819,1821,
-    1829,1815,1809,1808,1790,1770,1771,1768,1760,1782,1805,1813,1817,1807,1771,1752,
-    1749,1723,1689,1681,1679,1675,1685,1731,1793,1781,1714,1726,1810,1799,1679,1609,
-    1661,1727,1713,1658,1663,1735,1798,1814,1800,1793,1806,1816,1809,1791,1774,1761,
-    1756,1775,1812,1844,1829,1773,1753,1829,1906,1860,1752,1749,1823,1876,1897,1875,
-    1818,1758,1778,1863,1894,1804,1701,1689,1789,1842,1778,1632,1604,1746,1775,1689,
-    1676,1752,1778,1747,1799,1872,1865,1846,1873,1927,1875,1789,1779,1817,1787,1751,
-    1754,1805,1834,1781,1732,1792,1875,1832,1820,1884,1923,1895,1870,1853,1826,1836,
-    1787,1753,1735,1705,1723,1755,1776,1742,1795,1858,1829,1764,1818,1818,1745,1733,
-    1721,1687,1705,1777,1759,1712,1718,1743,1751,1787,1775,1732,1734,1757,1713,1669,
-    1688,1709,1698,1718,1732,1776,1807,1832,1869,1871,1894,1878,1837,1812,1776,1763,
-    1779,1736,1727,1712,1752,1798,1819,1845,1864,1901,1889,1858,1858,1892,1868,1797,
-    1770,1771,1764,1767,1747,1743,1741,1756,1771,1774,1789,1785,1779,1775,1766,1758,
-    1748,1755,1805,1810,1835,1850,1842,1848,1850,1872,1857,1835,1795,1787,1780,1788,
-    1775,1749,1741,1730,1759,1761,1795,1795,1788,1780,1781,1794,1803,1827,1826,1780,
-    1741,1771,1773,1768,1737,1732,1720,1728,1743,1758,1786,1784,1798,1778,1787,1776,
-    1767,1755,1750,1774,1773,1753,1734,1741,1763,1751,1741,1734,1746,1778,1761,1782,
-    1807,1794,1789,1791,1817,1829,1786,1799,1815,1811,1784,1767,1788,1795,1800,1755,
-    1772,1779,1770,1780,1801,1806,1810,1835,1819,1816,1850,1893,1842,1845,1842,1819,
-    1788,1784,1774,1743,1733,1728,1730,1730,1753,1751,1787,1769,1766,1787,1797,1786,
-    1767,1775,1743,1762,1785,1777,1788,1820,1816,1787,1802,1832,1820,1786,1795,1792,
-    1762,1762,1779,1761,1744,1794,1803,1802,1822,1842,1865,1856,1856,1800,1791,1780,
-    1736,1724,1746,1743,1743,1740,1738,1778,1826,1848,1828,1847,1834,1833,1804,1792,
-    1780,1741,1740,1740,1744,1737,1746,1774,1768,1787,1803,1817,1806,1788,1774,1791,
-    1804,1792,1785,1798,1839,1826,1806,1786,1792,1785,1776,1766,1760,1774,1778,1765,
-    1771,1787,1801,1790,1803,1807,1805,1783,1770,1781,1803,1825,1847,1844,1803,1814,
-    1800,1797,1760,1736,1758,1757,1748,1760,1765,1756,1788,1826,1816,1801,1801,1827,
-    1815,1789,1798,1815,1804,1780,1748,1757,1770,1765,1790,1787,1782,1787,1798,1786,
-    1787,1778,1758,1772,1753,1744,1803,1794,1788,1788,1800,1815,1826,1857,1842,1811,
-    1779,1805,1790,1751,1740,1759,1770,1783,1789,1794,1794,1799,1843,1831,1783,1757,
-    1775,1770,1764,1744,1748,1749,1752,1741,1772,1794,1782,1785,1782,1793,1788,1815,
-    1786,1775,1767,1803,1804,1776,1760,1775,1794,1768,1749,1727,1766,1764,1773,1771,
-    1779,1772,1776,1825,1828,1836,1826,1808,1793,1787,1794,1774,1742,1753,1783,1775,
-    1764,1759,1774,1800,1784,1768,1755,1784,1780,1788,1819,1793,1782,1777,1782,1797,
-    1805,1809,1784,1774,1788,1791,1784,1774,1782,1778,1754,1794,1801,1809,1811,1833,
-    1839,1789,1792,1786,1796,1757,1763,1781,1787,1764,1772,1789,1805,1826,1833,1838,
-    1840,1836,1799,1796,1788,1766,1738,1754,1743,1749,1757,1768,1751,1756,1776,1795,
-    1800,1782,1784,1799,1795,1759,1749,1748,1751,1730,1735,1783,1795,1786,1795,1833,
-    1838,1811,1836,1810,1812,1798,1815,1790,1757,1772,1779,1784,1784,1778,1779,1811,
-    1807,1825,1809,1848,1850,1812,1812,1812,1809,1782,1759,1742,1741,1770,1756,1762,
-    1787,1773,1765,1782,1776,1781,1781,1773,1793,1779,1787,1767,1777,1798,1762,1768,
-    1774,1794,1778,1741,1755,1777,1776,1747,1756,1765,1809,1781,1783,1796,1813,1813,
-    1817,1831,1804,1799,1780,1812,1769,1758,1748,1774,1746,1750,1774,1774,1783,1793,
-    1818,1776,1778,1809,1831,1783,1770,1787,1824,1802,1767,1778,1778,1780,1790,1784,
-    1780,1806,1801,1771,1787,1817,1801,1770,1760,1796,1797,1771,1757,1788,1834,1820,
-    1784,1813,1826,1816,1790,1803,1827,1821,1825,1789,1794,1785,1784,1769,1770,1780,
-    1786,1803,1802,1799,1814,1801,1771,1785,1779,1744,1728,1768,1764,1761,1774,1755,
-    1793,1809,1807,1775,1785,1795,1794,1817,1799,1799,1792,1809,1792,1784,1777,1766,
-    1746,1751,1743,1771,1770,1754,1794,1781,1799,1777,1800,1788,1767,1815,1814,1797,
-    1775,1798,1813,1797,1774,1756,1771,1788,1761,1757,1787,1778,1774,1786,1808,1783,
-    1796,1820,1825,1803,1800,1819,1827,1806,1768,1803,1794,1780,1769,1776,1765,1764,
-    1771,1764,1791,1797,1788,1762,1802,1773,1787,1807,1795,1795,1765,1770,1743,1768,
-    1754,1758,1765,1775,1775,1810,1830,1824,1817,1803,1821,1800,1785,1745,1795,1811,
-    1757,1736,1776,1789,1770,1792,1804,1821,1800,1778,1784,1810,1790,1783,1785,1786,
-    1754,1754,1780,1758,1750,1736,1753,1737,1756,1758,1781,1785,1771,1781,1804,1822,
-    1814,1791,1779,1773,1753,1764,1793,1817,1767,1736,1780,1802,1772,1758,1776,1799,
-    1799,1819,1821,1815,1827,1843,1809,1810,1809,1810,1816,1811,1812,1807,1834,1788,
-    1771,1794,1818,1803,1808,1790,1756,1776,1803,1808,1781,1779,1795,1787,1745,1726,
-    1751,1777,1763,1756,1783,1793,1784,1780,1777,1775,1785,1775,1758,1767,1758,1764,
-    1788,1792,1778,1789,1833,1804,1817,1833,1810,1817,1801,1787,1794,1804,1772,1763,
-    1794,1811,1800,1777,1779,1790,1788,1800,1805,1795,1785,1766,1764,1761,1772,1783,
-    1779,1765,1770,1786,1779,1792,1800,1790,1788,1789,1780,1782,1806,1810,1796,1801,
-    1796,1788,1777,1802,1817,1805,1796,1801,1808,1800,1792,1803,1813,1789,1779,1788,
-    1806,1807,1816,1814,1814,1798,1795,1772,1771,1789,1777,1780,1777,1777,1760,1779,
-    1798,1786,1785,1778,1792,1796,1782,1787,1811,1820,1790,1784,1784,1781,1787,1776,
-    1760,1764,1758,1747,1750,1773,1763,1740,1720,1710,1724,1725,1720,1709,1717,1724,
-    1710,1700,1718,1708,1701,1695,1688,1685,1679,1673,1668,1671,1654,1648,1662,1662,
-    1641,1655,1649,1684,1801,1951,2056,2104,2167,2234,2280,2234,2153,2093,2053,1976,
-    1870,1804,1767,1749,1709,1649,1627,1646,1657,1662,1688,1734,1783,1809,1802,1799,
-    1823,1856,1852,1831,1829,1824,1809,1785,1773,1779,1793,1791,1788,1787,1783,1792,
-    1792,1794,1815,1824,1816,1808,1812,1804,1800,1792,1793,1798,1792,1778,1757,1750,
-    1721,1703,1701,1696,1685,1691,1694,1703,1696,1699,1704,1695,1692,1687,1670,1649,
-    1640,1631,1626,1613,1607,1589,1563,1534,1499,1453,1420,1411,1403,1458,1626,1873,
-    2111,2248,2377,2540,2660,2645,2543,2453,2375,2218,1993,1827,1749,1693,1571,1443,
-    1376,1389,1396,1398,1470,1613,1762,1841,1894,1968,2052,2106,2097,2076,2062,2028,
-    1934,1827,1758,1711,1662,1601,1571,1568,1574,1570,1583,1634,1690,1724,1769,1817,
-    1875,1938,1955,1982,2006,2034,2008,1990,1944,1886,1828,1764,1699,1630,1622,1568,
-    1540,1517,1536,1560,1608,1637,1681,1739,1769,1780,1794,1841,1833,1823,1791,1771,
-    1743,1697,1638,1599,1573,1556,1530,1505,1490,1468,1428,1378,1358,1327,1339,1368,
-    1443,1608,1889,2158,2338,2498,2676,2827,2844,2772,2671,2570,2410,2184,1978,1860,
-    1735,1565,1398,1287,1243,1221,1230,1293,1433,1580,1683,1788,1917,2031,2098,2121,
-    2152,2174,2143,2063,1982,1933,1869,1777,1681,1625,1596,1539,1477,1448,1488,1536,
-    1578,1632,1709,1798,1868,1920,1973,2036,2076,2085,2075,2078,2052,1986,1898,1831,
-    1769,1699,1626,1569,1546,1535,1510,1497,1535,1587,1626,1667,1713,1756,1798,1807,
-    1815,1848,1867,1845,1804,1761,1711,1660,1613,1581,1570,1553,1531,1503,1495,1506,
-    1512,1517,1518,1549,1568,1592,1614,1646,1718,1861,2048,2165,2246,2354,2454,2458,
-    2404,2356,2331,2297,2211,2105,2032,1953,1827,1689,1592,1541,1490,1439,1415,1453,
-    1520,1568,1594,1639,1719,1775,1806,1843,1894,1926,1914,1885,1878,1878,1862,1838,
-    1827,1837,1824,1794,1769,1776,1797,1811,1807,1815,1833,1832,1815,1810,1818,1818,
-    1807,1791,1794,1797,1792,1761,1740,1722,1700,1670,1650,1637,1628,1619,1606,1614,
-    1646,1674,1685,1712,1735,1759,1770,1773,1789,1817,1839,1834,1832,1826,1804,1782,
-    1767,1764,1768,1764,1748,1734,1725,1721,1720,1725,1737,1743,1744,1740,1727,1729,
-    1725,1712,1703,1689,1671,1667,1696,1739,1776,1822,1880,1936,1954,1949,1947,1961,
-    1980,1985,1983,1988,2005,1989,1952,1929,1921,1902,1874,1852,1844,1836,1821,1805,
-    1790,1776,1750,1729,1722,1727,1728,1723,1720,1727,1744,1760,1780,1806,1833,1853,
-    1860,1847,1827,1814,1798,1778,1771,1765,1753,1728,1690,1664,1644,1626,1622,1633,
-    1647,1660,1651,1645,1656,1674,1703,1730,1765,1792,1808,1815,1824,1826,1829,1827,
-    1815,1815,1825,1822,1814,1816,1808,1801,1783,1769,1768,1777,1782,1789,1793,1795,
-    1807,1815,1821,1822,1821,1815,1809,1798,1773,1745,1723,1701,1675,1655,1644,1644,
-    1639,1638,1643,1658,1673,1676,1686,1701,1718,1729,1757,1805,1845,1858,1878,1915,
-    1938,1940,1954,1977,1982,1986,1978,1967,1966,1961,1940,1915,1897,1882,1864,1841,
-    1831,1832,1833,1818,1807,1813,1820,1822,1812,1805,1797,1788,1763,1734,1728,1717,
-    1692,1660,1639,1635,1624,1611,1604,1625,1657,1671,1674,1703,1748,1768,1773,1779,
-    1787,1799,1798,1787,1790,1808,1817,1807,1799,1801,1812,1812,1819,1829,1845,1855,
-    1850,1851,1851,1846,1844,1850,1854,1865,1858,1842,1831,1824,1817,1792,1771,1765,
-    1757,1756,1751,1743,1746,1744,1739,1723,1713,1702,1695,1698,1703,1708,1712,1718,
-    1718,1714,1721,1735,1744,1751,1752,1760,1770,1777,1775,1778,1788,1788,1788,1790,
-    1799,1822,1845,1852,1849,1855,1864,1865,1872,1877,1879,1878,1869,1866,1864,1853,
-    1841,1828,1817,1807,1793,1785,1784,1783,1774,1769,1760,1765,1772,1773,1777,1790,
-    1805,1813,1818,1815,1813,1799,1787,1777,1767,1749,1736,1720,1714,1713,1711,1723,
-    1717,1729,1742,1754,1762,1758,1772,1779,1795,1797,1807,1800,1811,1824,1817,1817,
-    1800,1792,1788,1793,1795,1802,1821,1811,1788,1802,1778,1786,1778,1789,1788,1775,
-    1774,1760,1776,1755,1761,1756,1754,1744,1711,1682,1661,1652,1646,1637,1635,1632,
-    1640,1649,1644,1667,1759,1894,1956,1961,2036,2132,2130,2083,2082,2096,2071,2015,
-    1933,1889,1891,1845,1746,1719,1745,1714,1677,1670,1692,1720,1723,1691,1698,1757,
-    1762,1735,1747,1792,1817,1812,1788,1804,1851,1853,1821,1817,1853,1844,1815,1806,
-    1815,1823,1815,1796,1793,1800,1788,1765,1781,1809,1804,1791,1777,1798,1805,1780,
-    1745,1747,1765,1743,1704,1677,1676,1677,1661,1650,1671,1705,1725,1733,1743,1755,
-    1764,1770,1774,1789,1801,1802,1780,1773,1781,1768,1761,1757,1759,1756,1748,1728,
-    1715,1703,1677,1641,1614,1574,1536,1499,1487,1475,1470,1462,1481,1504,1583,1784,
-    2036,2189,2248,2381,2512,2559,2493,2458,2405,2319,2138,1943,1828,1767,1666,1516,
-    1445,1411,1384,1348,1374,1481,1627,1708,1739,1807,1916,1988,1991,2020,2071,2086,
-    2024,1929,1890,1892,1850,1761,1724,1719,1684,1616,1591,1623,1672,1689,1700,1738,
-    1791,1823,1835,1878,1942,1979,1967,1937,1901,1873,1817,1758,1719,1692,1644,1584,
-    1540,1530,1543,1559,1588,1635,1692,1731,1753,1776,1812,1843,1851,1852,1847,1844,
-    1828,1793,1763,1731,1686,1636,1602,1571,1558,1540,1519,1488,1468,1478,1520,1560,
-    1593,1647,1706,1765,1797,1838,1918,1946,2032,2196,2305,2304,2304,2343,2388,2368,
-    2252,2164,2084,1976,1819,1717,1686,1673,1615,1553,1536,1559,1587,1587,1614,1695,
-    1773,1789,1790,1830,1903,1951,1950,1941,1942,1924,1882,1849,1844,1851,1844,1797,
-    1768,1760,1769,1774,1778,1800,1817,1819,1809,1801,1804,1812,1798,1781,1772,1770,
-    1747,1713,1682,1660,1642,1619,1599,1580,1578,1571,1573,1589,1612,1646,1673,1693,
-    1720,1752,1777,1795,1811,1820,1830,1824,1812,1799,1792,1775,1746,1705,1676,1656,
-    1635,1617,1600,1603,1608,1622,1611,1645,1661,1665,1664,1673,1715,1717,1740,1773,
-    1852,2023,2148,2137,2136,2231,2338,2376,2283,2187,2153,2118,2051,1956,1906,1880,
-    1831,1744,1686,1672,1694,1681,1635,1624,1655,1694,1704,1718,1750,1792,1820,1824,
-    1824,1844,1855,1853,1835,1812,1824,1826,1814,1797,1778,1780,1794,1795,1786,1774,
-    1764,1764,1740,1733,1735,1738,1727,1702,1673,1653,1636,1617,1612,1621,1640,1633,
-    1621,1625,1642,1667,1687,1685,1695,1717,1742,1763,1778,1804,1830,1836,1833,1833,
-    1843,1854,1851,1838,1829,1828,1823,1812,1808,1813,1805,1789,1776,1777,1789,1793,
-    1791,1806,1813,1813,1811,1795,1786,1787,1787,1787,1805,1809,1801,1781,1765,1771,
-    1780,1789,1794,1789,1785,1776,1764,1764,1772,1786,1804,1808,1816,1828,1827,1827,
-    1831,1835,1841,1833,1818,1814,1821,1833,1832,1818,1803,1802,1809,1809,1805,1813,
-    1815,1821,1820,1818,1830,1833,1824,1810,1797,1779,1757,1733,1715,1701,1688,1680,
-    1673,1673,1673,1677,1685,1696,1713,1733,1739,1741,1752,1756,1771,1777,1786,1793,
-    1793,1800,1805,1814,1827,1826,1817,1814,1814,1819,1820,1813,1818,1831,1833,1830,
-    1828,1835,1837,1828,1821,1828,1842,1847,1829,1814,1807,1797,1791,1775,1761,1755,
-    1739,1720,1723,1728,1730,1731,1725,1733,1751,1765,1779,1778,1776,1771,1757,1757,
-    1769,1774,1783,1801,1812,1816,1811,1811,1821,1831,1831,1824,1813,1802,1796,1787,
-    1783,1785,1784,1778,1775,1775,1773,1773,1772,1773,1774,1772,1769,1774,1782,1785,
-    1783,1779,1774,1772,1772,1770,1772,1773,1769,1763,1754,1756,1763,1765,1762,1768,
-    1780,1778,1774,1771,1773,1772,1763,1748,1739,1736,1734,1730,1734,1742,1756,1766,
-    1774,1791,1812,1823,1823,1828,1834,1848,1853,1849,1849,1851,1846,1837,1829,1832,
-    1831,1826,1818,1814,1814,1806,1800,1788,1785,1785,1786,1788,1781,1774,1769,1764,
-    1772,1779,1791,1800,1790,1780,1772,1768,1769,1774,1777,1782,1786,1787,1783,1780,
-    1790,1800,1810,1814,1809,1805,1805,1806,1800,1795,1787,1782,1773,1767,1766,1767,
-    1761,1742,1741,1747,1749,1749,1759,1767,1765,1765,1766,1765,1769,1768,1771,1777,
-    1787,1806,1813,1808,1807,1814,1815,1832,1849,1849,1843,1831,1821,1815,1812,1803,
-    1800,1799,1790,1776,1772,1781,1784,1782,1775,1777,1781,1786,1791,1794,1798,1798,
-    1790,1774,1770,1776,1779,1770,1769,1765,1766,1765,1760,1762,1766,1783,1801,1808,
-    1812,1811,1810,1812,1813,1819,1810,1802,1797,1790,1787,1795,1799,1805,1803,1803,
-    1799,1788,1785,1784,1795,1796,1788,1784,1782,1778,1779,1776,1768,1760,1762,1766,
-    1757,1750,1758,1758,1762,1764,1764,1773,1776,1785,1786,1786,1786,1787,1782,1769,
-    1769,1777,1786,1781,1776,1766,1762,1771,1769,1771,1773,1776,1785,1788,1785,1795,
-    1811,1822,1827,1828,1815,1810,1817,1812,1810,1801,1795,1784,1775,1774,1774,1773,
-    1778,1787,1792,1792,1796,1812,1818,1820,1816,1810,1805,1800,1787,1772,1769,1778,
-    1774,1756,1748,1756,1766,1762,1768,1779,1783,1786,1779,1762,1764,1771,1782,1773,
-    1768,1781,1775,1770,1766,1766,1773,1780,1786,1794,1799,1806,1817,1818,1807,1797,
-    1786,1777,1783,1782,1783,1780,1768,1763,1755,1749,1750,1755,1766,1774,1766,1768,
-    1775,1781,1788,1789,1796,1805,1806,1800,1803,1808,1815,1801,1790,1793,1781,1788,
-    1794,1788,1791,1780,1782,1791,1789,1798,1802,1801,1810,1814,1804,1787,1786,1792,
-    1782,1786,1787,1788,1789,1781,1777,1773,1773,1771,1779,1791,1793,1798,1789,1784,
-    1799,1797,1798,1793,1793,1789,1781,1782,1775,1782,1771,1771,1776,1775,1782,1786,
-    1782,1783,1793,1789,1789,1788,1788,1800,1810,1816,1818,1823,1840,1841,1842,1825,
-    1885,1893,1780,1704,1701,1770,1748,1709,1665,1674,1755,1832,1856,1801,1756,1759,
-    1821,1912,1935,1823,1742,1739,1841,1863,1733,1613,1598,1696,1767,1755,1707,1679,
-    1730,1808,1857,1825,1752,1772,1809,1858,1837,1792,1761,1758,1812,1860,1813,1743,
-    1725,1776,1830,1819,1800,1768,1790,1796,1811,1800,1764,1720,1726,1751,1792,1782,
-    1785,1796,1808,1830,1824,1811,1809,1842,1830,1838,1788,1828,1840,1884,1837,1781,
-    1781,1785,1808,1781,1752,1709,1739,1791,1820,1784,1775,1770,1793,1820,1964,1956,
-    1821,1781,1850,1947,1824,1684,1611,1635,1725,1719,1684,1665,1676,1736,1805,1831,
-    1806,1750,1778,1838,1885,1873,1787,1756,1774,1836,1841,1769,1695,1717,1751,1777,
-    1752,1714,1737,1768,1793,1778,1763,1753,1768,1769,1771,1783,1775,1792,1822,1860,
-    1849,1859,1841,1875,1864,1837,1825,1793,1808,1787,1764,1781,1832,1784,1796,1764,
-    1807,1814,1771,1775,1740,1724,1740,1765,1754,1740,1729,1782,1818,1828,1804,1775,
-    1782,1805,1841,1805,1777,1760,1773,1830,1809,1747,1700,1736,1769,1764,1744,1746,
-    1777,1805,1821,1858,1813,1790,1799,1815,1835,1788,1780,1764,1763,1791,1808,1764,
-    1730,1756,1816,1805,1760,1759,1767,1773,1782,1763,1759,1755,1752,1803,1801,1788,
-    1760,1756,1791,1804,1782,1761,1797,1802,1799,1825,1814,1796,1769,1785,1797,1780,
-    1749,1728,1744,1806,1798,1732,1741,1778,1837,1830,1803,1788,1820,1870,1839,1784,
-    1766,1758,1773,1759,1759,1756,1740,1730,1707,1754,1735,1751,1774,1768,1821,1808,
-    1826,1790,1810,1833,1792,1789,1784,1828,1787,1791,1798,1760,1744,1773,1779,1765,
-    1776,1798,1794,1789,1839,1853,1858,1798,1776,1827,1805,1798,1762,1761,1785,1740,
-    1757,1809,1817,1761,1708,1736,1819,1834,1800,1767,1776,1787,1833,1850,1799,1762,
-    1730,1744,1767,1803,1766,1724,1727,1787,1856,1806,1768,1776,1824,1836,1818,1803,
-    1806,1819,1790,1783,1792,1784,1787,1768,1754,1766,1765,1770,1737,1742,1776,1784,
-    1796,1778,1798,1833,1847,1825,1811,1826,1832,1808,1723,1734,1771,1755,1703,1728,
-    1763,1780,1768,1763,1788,1795,1796,1784,1858,1857,1806,1813,1865,1872,1848,1824,
-    1799,1747,1764,1761,1757,1778,1725,1724,1756,1819,1848,1797,1778,1791,1850,1857,
-    1825,1787,1744,1780,1772,1795,1764,1728,1742,1772,1813,1809,1777,1751,1754,1801,
-    1811,1781,1774,1719,1771,1838,1839,1805,1791,1757,1747,1798,1775,1723,1716,1713,
-    1683,1743,1804,1842,1789,1764,1811,1838,1825,1773,1764,1770,1754,1785,1852,1841,
-    1823,1763,1771,1832,1855,1798,1748,1765,1761,1796,1803,1833,1831,1788,1791,1785,
-    1810,1855,1809,1763,1758,1748,1772,1802,1809,1733,1779,1774,1757,1807,1805,1789,
-    1761,1726,1732,1810,1835,1779,1791,1816,1783,1833,1829,1785,1722,1753,1726,1767,
-    1815,1775,1765,1795,1784,1790,1843,1806,1750,1750,1753,1693,1775,1778,1748,1690,
-    1745,1776,1818,1833,1773,1810,1776,1756,1748,1778,1818,1797,1781,1807,1845,1853,
-    1848,1846,1801,1758,1733,1751,1771,1741,1716,1765,1792,1796,1789,1815,1856,1856,
-    1797,1788,1814,1806,1763,1745,1735,1764,1801,1799,1838,1812,1826,1840,1866,1861,
-    1819,1780,1735,1763,1804,1805,1793,1845,1885,1894,1865,1818,1848,1832,1812,1729,
-    1720,1741,1748,1770,1752,1781,1779,1791,1810,1829,1810,1787,1772,1778,1748,1762,
-    1729,1735,1756,1736,1716,1746,1776,1740,1754,1774,1792,1784,1764,1753,1792,1783,
-    1780,1745,1729,1719,1757,1759,1725,1738,1726,1739,1765,1793,1770,1781,1806,1786,
-    1780,1782,1779,1735,1718,1727,1749,1747,1723,1758,1787,1812,1789,1771,1784,1762,
-    1723,1789,1820,1856,1818,1804,1766,1730,1782,1768,1763,1733,1772,1791,1839,1890,
-    1898,1879,1894,1871,1872,1890,1920,1949,1962,1958,1941,1929,1920,1902,1855,1871,
-    1822,1836,1868,1887,1881,1873,1866,1855,1885,1844,1812,1793,1786,1748,1730,1753,
-    1766,1772,1717,1700,1681,1696,1701,1726,1749,1732,1735,1735,1717,1680,1684,1671,
-    1652,1609,1632,1672,1725,1735,1720,1695,1713,1682,1649,1646,1633,1653,1701,1767,
-    1758,1744,1758,1779,1749,1706,1660,1669,1691,1713,1710,1748,1763,1754,1692,1673,
-    1645,1656,1686,1704,1708,1679,1675,1665,1706,1785,1841,1919,2115,2230,2238,2218,
-    2209,2160,2117,1945,1798,1760,1818,1872,1962,2038,2090,2107,2068,1979,1903,1868,
-    1761,1704,1648,1678,1696,1746,1765,1797,1815,1816,1783,1754,1723,1695,1728,1750,
-    1769,1771,1783,1792,1830,1858,1858,1828,1818,1766,1718,1683,1694,1699,1705,1702,
-    1714,1751,1774,1777,1772,1782,1745,1756,1740,1741,1733,1705,1686,1680,1689,1673,
-    1678,1676,1682,1702,1696,1702,1712,1728,1722,1751,1750,1739,1750,1723,1682,1663,
-    1665,1637,1629,1649,1693,1696,1649,1595,1611,1612,1593,1562,1559,1557,1546,1544,
-    1619,1889,2257,2553,2640,2587,2532,2462,2281,2011,1795,1636,1545,1550,1660,1881,
-    2103,2250,2256,2190,2053,1890,1753,1682,1646,1596,1526,1488,1516,1574,1675,1773,
-    1849,1874,1847,1805,1791,1791,1785,1779,1765,1755,1736,1713,1717,1743,1789,1814,
-    1793,1731,1689,1681,1671,1696,1742,1809,1836,1840,1840,1854,1872,1858,1834,1805,
-    1784,1741,1707,1697,1703,1702,1712,1719,1715,1728,1723,1729,1732,1712,1697,1685,
-    1685,1718,1751,1766,1766,1745,1724,1680,1675,1663,1680,1685,1673,1680,1683,1682,
-    1688,1702,1686,1669,1640,1586,1528,1487,1410,1382,1449,1598,1750,2036,2442,2812,
-    2899,2778,2620,2421,2159,1805,1498,1321,1311,1404,1615,1871,2107,2259,2308,2250,
-    2110,1944,1787,1688,1627,1533,1456,1447,1526,1640,1729,1807,1884,1942,1947,1893,
-    1860,1830,1790,1749,1719,1740,1775,1822,1822,1812,1799,1759,1705,1672,1663,1661,
-    1669,1672,1686,1727,1764,1792,1836,1897,1935,1938,1927,1885,1820,1764,1695,1641,
-    1613,1596,1624,1695,1798,1871,1901,1883,1834,1785,1749,1732,1739,1783,1817,1806,
-    1772,1749,1738,1721,1698,1695,1708,1725,1744,1755,1768,1757,1734,1709,1696,1706,
-    1714,1685,1622,1587,1561,1534,1519,1503,1470,1447,1424,1394,1408,1520,1766,2219,
-    2772,2942,2737,2584,2531,2252,1776,1453,1334,1267,1269,1467,1761,2027,2222,2352,
-    2371,2249,2041,1862,1789,1758,1654,1517,1431,1450,1532,1601,1717,1910,2060,2065,
-    1993,1930,1880,1797,1692,1623,1616,1623,1605,1609,1650,1713,1768,1777,1764,1751,
-    1709,1641,1585,1578,1615,1641,1673,1725,1776,1817,1854,1918,2005,2085,2106,2038,
-    1928,1807,1686,1605,1606,1647,1706,1782,1841,1899,1930,1935,1936,1933,1920,1889,
-    1848,1812,1793,1775,1753,1726,1710,1689,1666,1661,1681,1713,1721,1713,1721,1722,
-    1702,1671,1625,1597,1581,1590,1592,1615,1636,1665,1637,1564,1477,1424,1393,1354,
-    1325,1361,1539,1851,2360,2921,3146,2929,2778,2712,2324,1660,1277,1181,1081,1103,
-    1447,1895,2159,2325,2485,2549,2368,2089,1901,1768,1631,1508,1399,1341,1390,1507,
-    1586,1704,1909,2066,2061,1997,1938,1806,1613,1482,1462,1514,1572,1628,1703,1763,
-    1798,1813,1805,1775,1735,1678,1607,1545,1524,1533,1590,1701,1822,1948,2048,2123,
-    2188,2209,2165,2042,1887,1735,1607,1523,1526,1609,1722,1824,1914,1983,2011,2016,
-    1992,1956,1903,1839,1783,1766,1748,1699,1650,1612,1593,1627,1697,1748,1758,1737,
-    1685,1615,1566,1557,1585,1643,1700,1727,1721,1702,1669,1626,1597,1589,1603,1582,
-    1519,1460,1439,1407,1372,1374,1503,1745,2118,2642,3049,3004,2772,2704,2488,1897,
-    1362,1211,1118,1028,1209,1665,2015,2186,2359,2533,2486,2240,2044,1923,1759,1571,
-    1450,1360,1341,1445,1580,1682,1862,2049,2067,1980,1932,1864,1699,1536,1498,1526,
-    1535,1561,1660,1758,1801,1814,1821,1817,1809,1779,1728,1680,1635,1581,1547,1608,
-    1733,1870,1990,2104,2182,2218,2217,2143,2001,1859,1718,1586,1516,1539,1610,1712,
-    1821,1917,1976,1995,1988,1966,1937,1880,1842,1828,1801,1733,1653,1585,1539,1522,
-    1569,1663,1740,1758,1735,1691,1646,1608,1602,1626,1680,1751,1759,1696,1609,1569,
-    1543,1523,1537,1553,1556,1532,1532,1507,1452,1381,1386,1545,1807,2256,2792,3060,
-    2900,2795,2729,2307,1681,1371,1272,1104,1111,1437,1837,2034,2202,2418,2517,2380,
-    2184,2060,1925,1727,1559,1418,1304,1318,1435,1531,1661,1880,2024,1997,1969,1992,
-    1903,1719,1599,1573,1528,1474,1504,1614,1693,1727,1752,1788,1805,1820,1831,1791,
-    1722,1658,1586,1558,1613,1726,1872,2003,2113,2190,2208,2155,2070,1972,1846,1713,
-    1617,1569,1574,1636,1728,1827,1914,1959,1968,1973,1959,1900,1836,1812,1788,1724,
-    1638,1577,1550,1527,1540,1633,1754,1810,1800,1759,1697,1611,1561,1553,1583,1656,
-    1729,1737,1692,1650,1626,1616,1613,1620,1594,1515,1457,1433,1410,1359,1377,1558,
-    1848,2268,2759,3039,2943,2833,2761,2418,1839,1486,1368,1212,1186,1414,1717,1906,
-    2084,2264,2325,2234,2151,2123,2035,1868,1719,1580,1405,1310,1363,1439,1527,1712,
-    1885,1908,1899,1922,1873,1765,1683,1658,1658,1647,1629,1629,1638,1630,1614,1634,
-    1682,1759,1845,1876,1835,1756,1670,1621,1632,1709,1827,1989,2126,2184,2181,2133,
-    2070,1993,1888,1772,1691,1626,1599,1619,1663,1712,1770,1841,1896,1926,1951,1936,
-    1892,1856,1822,1765,1674,1588,1526,1472,1435,1496,1628,1733,1783,1804,1778,1693,
-    1613,1567,1555,1596,1685,1752,1752,1707,1653,1600,1542,1519,1497,1465,1447,1450,
-    1459,1461,1501,1656,1957,2321,2632,2776,2788,2760,2650,2362,1995,1738,1592,1525,
-    1550,1610,1655,1752,1873,1897,1860,1875,1949,2015,2048,2040,2002,1924,1784,1634,
-    1549,1520,1506,1549,1644,1731,1775,1783,1759,1726,1689,1676,1722,1804,1840,1824,
-    1807,1772,1692,1609,1558,1556,1628,1709,1732,1733,1766,1787,1780,1779,1824,1909,
-    1979,2016,2029,2030,2011,1953,1888,1828,1789,1766,1756,1766,1759,1741,1727,1722,
-    1739,1780,1827,1871,1890,1897,1892,1870,1810,1721,1660,1615,1577,1588,1651,1718,
-    1753,1752,1722,1661,1602,1571,1570,1601,1670,1742,1766,1741,1706,1672,1622,1576,
-    1557,1575,1609,1647,1680,1687,1664,1634,1647,1725,1809,1825,1830,1918,2045,2099,
-    2057,2045,2153,2281,2309,2231,2183,2217,2206,2111,2040,2045,2046,2003,1941,1867,
-    1818,1764,1684,1629,1641,1687,1698,1711,1732,1722,1657,1563,1480,1425,1409,1418,
-    1463,1550,1616,1633,1647,1670,1688,1695,1718,1784,1878,1943,1942,1893,1862,1831,
-    1791,1802,1867,1932,1970,1978,1960,1925,1881,1845,1841,1869,1892,1903,1898,1886,
-    1861,1809,1757,1735,1735,1735,1722,1710,1723,1746,1764,1770,1758,1745,1718,1683,
-    1651,1635,1651,1684,1711,1714,1690,1642,1596,1564,1558,1595,1662,1722,1744,1738,
-    1711,1664,1592,1519,1477,1491,1534,1578,1626,1677,1758,1852,1868,1810,1842,2022,
-    2194,2216,2153,2141,2205,2228,2149,2077,2120,2192,2185,2127,2075,2052,2037,2000,
-    1922,1841,1792,1749,1708,1689,1666,1637,1631,1658,1672,1643,1597,1571,1574,1566,
-    1526,1494,1516,1562,1589,1606,1644,1699,1737,1746,1741,1732,1744,1770,1808,1844,
-    1857,1855,1844,1840,1846,1868,1895,1933,1973,1982,1931,1861,1825,1821,1834,1865,
-    1901,1933,1947,1910,1850,1800,1783,1781,1786,1787,1784,1773,1742,1710,1675,1650,
-    1654,1669,1689,1702,1694,1675,1671,1686,1695,1685,1680,1674,1653,1634,1616,1612,
-    1630,1654,1660,1656,1648,1610,1568,1557,1566,1581,1597,1610,1664,1776,1836,1799,
-    1785,1915,2098,2167,2134,2125,2210,2290,2234,2108,2091,2174,2192,2106,2041,2039,
-    2028,1981,1901,1823,1803,1796,1743,1702,1716,1715,1676,1671,1707,1707,1676,1645,
-    1631,1636,1645,1637,1624,1642,1660,1641,1612,1626,1675,1711,1720,1730,1742,1737,
-    1711,1697,1715,1752,1783,1814,1831,1831,1829,1831,1850,1866,1870,1868,1874,1879,
-    1868,1850,1860,1896,1926,1933,1933,1915,1884,1839,1788,1754,1751,1774,1799,1812,
-    1799,1768,1724,1683,1651,1649,1664,1679,1675,1647,1631,1626,1623,1624,1640,1653,
-    1645,1620,1594,1567,1559,1562,1553,1544,1544,1555,1567,1581,1596,1607,1640,1742,
-    1866,1891,1850,1902,2062,2187,2189,2143,2165,2272,2323,2223,2101,2119,2187,2158,
-    2073,2023,2015,2013,1972,1876,1802,1799,1788,1734,1685,1665,1652,1624,1610,1609,
-    1601,1610,1625,1627,1639,1647,1644,1654,1680,1688,1671,1662,1677,1700,1716,1718,
-    1712,1724,1742,1731,1710,1718,1753,1789,1806,1813,1836,1878,1908,1901,1866,1856,
-    1869,1879,1868,1852,1845,1836,1836,1838,1828,1833,1863,1896,1902,1880,1849,1812,
-    1793,1786,1772,1746,1734,1728,1710,1696,1688,1683,1688,1703,1699,1674,1646,1636,
-    1632,1624,1618,1618,1617,1618,1611,1597,1590,1590,1592,1595,1615,1638,1647,1638,
-    1622,1649,1757,1852,1865,1878,1989,2149,2234,2207,2154,2182,2272,2287,2194,2106,
-    2107,2118,2062,1981,1927,1916,1913,1875,1799,1755,1760,1757,1730,1704,1682,1656,
-    1639,1640,1628,1607,1603,1605,1602,1600,1592,1588,1618,1659,1674,1664,1680,1709,
-    1720,1712,1698,1701,1718,1742,1752,1749,1768,1796,1799,1787,1792,1836,1886,1915,
-    1915,1909,1923,1934,1918,1893,1889,1886,1865,1838,1815,1799,1804,1821,1835,1846,
-    1849,1838,1807,1785,1768,1740,1706,1692,1698,1707,1707,1690,1670,1664,1657,1642,
-    1626,1617,1620,1626,1630,1629,1630,1632,1632,1616,1605,1595,1589,1576,1579,1592,
-    1601,1603,1604,1645,1743,1858,1906,1924,2005,2155,2259,2264,2218,2212,2269,2309,
-    2249,2161,2149,2167,2112,2010,1931,1901,1905,1908,1868,1797,1773,1769,1740,1701,
-    1681,1668,1669,1677,1664,1626,1603,1600,1600,1609,1619,1627,1641,1671,1691,1685,
-    1687,1704,1725,1726,1711,1700,1700,1710,1719,1726,1738,1778,1817,1824,1822,1833,
-    1860,1883,1894,1882,1875,1897,1914,1908,1895,1890,1878,1855,1825,1797,1788,1803,
-    1823,1836,1836,1833,1829,1811,1788,1761,1729,1701,1680,1666,1666,1666,1654,1635,
-    1624,1617,1601,1588,1591,1601,1619,1626,1627,1616,1611,1600,1588,1579,1575,1574,
-    1571,1580,1602,1622,1624,1657,1751,1865,1916,1939,2015,2142,2233,2249,2214,2202,
-    2252,2295,2239,2138,2104,2119,2083,1991,1907,1865,1866,1871,1835,1779,1760,1763,
-    1737,1693,1664,1637,1632,1655,1675,1656,1629,1612,1604,1600,1601,1603,1627,1678,
-    1714,1717,1699,1696,1704,1715,1728,1730,1730,1742,1750,1738,1733,1757,1806,1835,
-    1836,1848,1863,1905,1915,1906,1878,1872,1918,1931,1927,1910,1917,1930,1909,1868,
-    1815,1798,1821,1828,1809,1782,1777,1775,1764,1746,1714,1700,1699,1695,1676,1651,
-    1652,1652,1635,1617,1602,1600,1602,1606,1596,1570,1556,1537,1499,1467,1436,1402,
-    1382,1396,1431,1477,1568,1720,2008,2296,2342,2273,2428,2694,2681,2512,2468,2390,
-    2209,2131,2056,1883,1829,1872,1709,1529,1583,1642,1608,1674,1756,1692,1679,1763,
-    1758,1764,1860,1843,1724,1697,1702,1656,1697,1786,1760,1708,1718,1708,1718,1792,
-    1821,1791,1806,1803,1715,1672,1717,1728,1686,1646,1594,1577,1625,1670,1685,1726,
-    1765,1757,1781,1868,1944,1969,1962,1919,1868,1867,1902,1921,1918,1897,1850,1812,
-    1809,1819,1820,1822,1813,1791,1778,1781,1797,1812,1811,1783,1751,1750,1765,1768,
-    1747,1706,1661,1612,1578,1581,1581,1562,1537,1506,1501,1512,1514,1487,1483,1493,
-    1459,1413,1416,1458,1504,1584,1780,2121,2301,2173,2202,2598,2747,2479,2387,2514,
-    2365,2089,2088,2086,1919,1823,1719,1560,1616,1709,1583,1546,1732,1735,1555,1597,
-    1762,1784,1772,1787,1754,1757,1789,1732,1725,1843,1843,1715,1716,1816,1814,1765,
-    1767,1770,1742,1722,1693,1683,1738,1740,1650,1613,1670,1684,1644,1650,1685,1696,
-    1703,1713,1712,1765,1843,1852,1843,1890,1936,1923,1909,1924,1906,1857,1848,1853,
-    1837,1819,1804,1794,1793,1805,1814,1825,1843,1846,1825,1821,1839,1836,1816,1792,
-    1761,1726,1705,1677,1648,1629,1601,1574,1569,1570,1546,1538,1565,1589,1582,1602,
-    1646,1654,1640,1630,1624,1599,1599,1608,1624,1684,1759,1798,1835,1931,2042,2099,
-    2108,2133,2205,2276,2264,2196,2193,2242,2209,2104,2039,2030,2027,1996,1915,1846,
-    1835,1830,1778,1732,1737,1736,1679,1618,1610,1627,1639,1620,1596,1588,1563,1529,
-    1542,1585,1593,1578,1584,1600,1609,1624,1661,1698,1735,1745,1730,1756,1799,1816,
-    1802,1807,1824,1828,1838,1860,1891,1926,1953,1953,1936,1930,1936,1930,1911,1896,
-    1887,1858,1826,1808,1799,1800,1806,1799,1783,1777,1779,1781,1772,1774,1766,1746,
-    1727,1704,1698,1709,1698,1654,1605,1590,1590,1591,1595,1599,1603,1614,1625,1617,
-    1631,1661,1666,1646,1636,1639,1636,1634,1633,1639,1642,1661,1717,1790,1856,1914,
-    1982,2041,2080,2113,2162,2218,2238,2207,2178,2177,2167,2127,2084,2056,2029,1972,
-    1896,1860,1865,1856,1812,1761,1741,1733,1696,1658,1656,1662,1641,1612,1593,1575,
-    1570,1573,1551,1540,1577,1616,1614,1623,1657,1668,1665,1670,1681,1714,1758,1780,
-    1796,1814,1821,1821,1831,1847,1858,1878,1895,1899,1912,1914,1902,1906,1928,1924,
-    1906,1916,1930,1923,1905,1884,1867,1863,1856,1830,1809,1816,1806,1768,1749,1754,
-    1749,1726,1702,1683,1672,1664,1646,1629,1641,1646,1608,1582,1616,1641,1641,1657,
-    1678,1697,1721,1732,1714,1717,1738,1732,1716,1726,1740,1735,1726,1723,1719,1710,
-    1708,1711,1745,1801,1835,1851,1887,1932,1945,1944,1968,2008,2032,2030,2014,2019,
-    2050,2048,2018,2011,2013,1986,1953,1941,1936,1925,1903,1864,1825,1819,1816,1784,
-    1752,1737,1711,1676,1647,1624,1616,1607,1589,1570,1576,1598,1594,1587,1592,1599,
-    1604,1621,1655,1690,1720,1729,1723,1730,1761,1798,1817,1842,1869,1881,1888,1886,
-    1889,1910,1930,1936,1940,1947,1961,1964,1957,1945,1931,1924,1912,1897,1882,1865,
-    1843,1820,1792,1762,1738,1732,1718,1692,1678,1676,1675,1667,1664,1650,1642,1648,
-    1645,1632,1637,1658,1669,1669,1665,1663,1675,1695,1709,1719,1748,1779,1789,1791,
-    1799,1806,1802,1804,1817,1823,1826,1836,1844,1842,1835,1819,1811,1815,1811,1788,
-    1776,1786,1793,1800,1806,1817,1838,1854,1859,1858,1864,1877,1880,1881,1879,1878,
-    1875,1878,1883,1882,1882,1876,1868,1861,1849,1827,1807,1801,1789,1771,1750,1740,
-    1732,1713,1700,1682,1669,1664,1664,1671,1681,1682,1681,1685,1692,1705,1720,1744,
-    1771,1790,1803,1816,1829,1840,1852,1864,1875,1886,1893,1885,1875,1875,1870,1865,
-    1867,1865,1856,1845,1823,1805,1796,1788,1765,1756,1760,1756,1746,1741,1746,1748,
-    1749,1743,1730,1724,1723,1713,1711,1719,1721,1723,1735,1744,1746,1749,1757,1764,
-    1768,1773,1776,1774,1777,1773,1762,1762,1770,1777,1776,1784,1792,1788,1787,1781,
-    1770,1768,1769,1770,1772,1779,1775,1766,1767,1778,1777,1773,1777,1782,1776,1765,
-    1759,1758,1765,1770,1772,1777,1789,1798,1799,1805,1817,1819,1821,1819,1809,1802,
-    1805,1806,1804,1808,1809,1798,1782,1783,1780,1777,1786,1792,1788,1781,1779,1778,
-    1781,1785,1792,1807,1815,1819,1825,1829,1831,1826,1815,1807,1802,1802,1802,1800,
-    1804,1797,1786,1793,1801,1801,1807,1808,1795,1787,1783,1774,1769,1767,1763,1754,
-    1745,1744,1740,1742,1749,1747,1738,1736,1737,1734,1730,1733,1734,1742,1755,1761,
-    1761,1773,1786,1784,1779,1780,1787,1790,1798,1807,1803,1796,1792,1794,1800,1809,
-    1811,1805,1806,1798,1787,1781,1788,1792,1785,1780,1771,1770,1778,1779,1774,1780,
-    1785,1781,1775,1776,1788,1796,1794,1792,1794,1806,1820,1822,1829,1832,1835,1837,
-    1840,1842,1842,1839,1836,1833,1820,1816,1816,1814,1811,1809,1803,1805,1805,1804,
-    1798,1796,1792,1789,1779,1778,1773,1774,1769,1769,1760,1751,1748,1742,1739,1741,
-    1745,1744,1742,1759,1877,1774,1672,1774,1815,1761,1712,1742,1752,1743,1770,1788,
-    1789,1780,1766,1775,1791,1773,1738,1764,1795,1780,1793,1799,1779,1792,1783,1763,
-    1773,1805,1807,1782,1786,1812,1817,1808,1801,1837,1817,1828,1799,1808,1830,1794,
-    1811,1772,1795,1798,1783,1777,1791,1807,1774,1780,1786,1788,1790,1782,1761,1819,
-    1888,1787,1809,1833,1849,1804,1754,1786,1741,1742,1732,1746,1758,1779,1753,1784,
-    1825,1819,1809,1818,1818,1815,1812,1780,1806,1808,1795,1784,1788,1819,1808,1791,
-    1783,1804,1814,1818,1838,1816,1853,1856,1829,1789,1814,1792,1753,1735,1742,1757,
-    1726,1733,1746,1789,1771,1769,1779,1809,1783,1748,1741,1776,1780,1737,1729,1745,
-    1768,1726,1712,1732,1740,1725,1686,1710,1749,1739,1723,1707,1762,1773,1750,1767,
-    1782,1795,1765,1751,1786,1804,1811,1813,1808,1845,1836,1804,1813,1839,1850,1837,
-    1845,1880,1893,1879,1875,1877,1894,1901,1888,1897,1909,1893,1866,1853,1849,1833,
-    1809,1785,1780,1776,1767,1753,1746,1748,1738,1722,1734,1750,1761,1751,1750,1765,
-    1767,1761,1749,1760,1779,1770,1754,1764,1771,1772,1766,1750,1754,1752,1732,1734,
-    1742,1734,1734,1742,1741,1755,1745,1747,1744,1729,1749,1748,1737,1746,1744,1757,
-    1761,1751,1750,1762,1775,1764,1762,1754,1752,1744,1729,1723,1728,1726,1713,1693,
-    1699,1721,1715,1721,1731,1757,1760,1766,1788,1849,2031,2133,2048,2001,2102,2204,
-    2202,2071,2000,1998,1909,1820,1817,1876,1848,1686,1602,1656,1709,1709,1659,1652,
-    1689,1687,1673,1730,1828,1865,1811,1790,1847,1888,1875,1844,1859,1868,1809,1758,
-    1769,1793,1757,1678,1644,1661,1684,1660,1644,1682,1717,1706,1710,1770,1833,1846,
-    1808,1813,1845,1848,1809,1768,1757,1743,1702,1668,1674,1686,1663,1628,1637,1663,
-    1672,1674,1685,1711,1748,1768,1775,1807,1853,1848,1822,1805,1817,1802,1764,1739,
-    1712,1703,1671,1648,1667,1678,1658,1652,1655,1668,1683,1684,1686,1749,1802,1819,
-    1889,1967,2034,2081,2113,2145,2167,2158,2130,2102,2079,2032,1962,1897,1838,1808,
-    1771,1724,1702,1687,1684,1677,1686,1718,1723,1733,1745,1772,1809,1818,1818,1839,
-    1861,1864,1842,1820,1818,1820,1815,1780,1750,1733,1722,1708,1704,1719,1716,1706,
-    1718,1743,1766,1780,1774,1792,1802,1795,1789,1790,1788,1777,1756,1741,1733,1726,
-    1719,1702,1694,1685,1691,1700,1706,1709,1729,1732,1739,1760,1782,1811,1814,1803,
-    1790,1791,1798,1810,1800,1778,1755,1743,1749,1752,1740,1737,1727,1712,1711,1721,
-    1742,1728,1719,1714,1708,1719,1742,1755,1756,1755,1731,1716,1725,1759,1801,1796,
-    1799,1855,1935,1990,2008,2026,2046,2040,2026,2015,2012,2016,1982,1927,1883,1876,
-    1874,1847,1804,1772,1765,1748,1739,1734,1745,1768,1753,1752,1779,1802,1802,1798,
-    1809,1831,1839,1833,1845,1863,1846,1818,1797,1785,1784,1759,1730,1711,1719,1718,
-    1697,1687,1695,1701,1692,1683,1696,1721,1728,1714,1709,1710,1702,1693,1678,1682,
-    1692,1699,1702,1713,1738,1753,1758,1766,1781,1797,1809,1817,1813,1804,1805,1798,
-    1790,1787,1798,1804,1794,1791,1801,1815,1803,1794,1781,1771,1768,1739,1733,1731,
-    1733,1726,1719,1708,1713,1713,1691,1691,1701,1713,1713,1713,1713,1730,1729,1748,
-    1790,1824,1850,1874,1909,1942,1978,2000,2002,2008,2001,1975,1957,1942,1920,1899,
-    1855,1824,1819,1813,1806,1798,1805,1800,1812,1808,1809,1818,1827,1824,1815,1810,
-    1789,1787,1794,1796,1789,1790,1784,1777,1758,1739,1738,1737,1719,1688,1668,1676,
-    1681,1703,1717,1718,1721,1722,1736,1750,1771,1774,1760,1742,1742,1751,1761,1781,
-    1772,1760,1758,1756,1785,1787,1782,1770,1780,1780,1760,1763,1774,1787,1793,1781,
-    1786,1810,1807,1811,1809,1812,1793,1795,1804,1800,1801,1789,1780,1782,1789,1767,
-    1774,1787,1773,1770,1776,1781,1778,1781,1779,1776,1797,1797,1794,1787,1775,1774,
-    1773,1785,1783,1788,1784,1780,1790,1799,1804,1816,1821,1817,1829,1841,1837,1831,
-    1832,1830,1821,1814,1813,1824,1836,1822,1822,1819,1814,1813,1815,1804,1798,1805,
-    1794,1789,1791,1792,1799,1799,1793,1801,1801,1795,1796,1802,1795,1778,1774,1773,
-    1768,1761,1747,1737,1738,1734,1732,1743,1754,1751,1746,1758,1759,1771,1766,1766,
-    1765,1778,1784,1786,1802,1783,1792,1797,1804,1793,1806,1798,1791,1794,1786,1776,
-    1774,1771,1773,1775,1764,1763,1789,1789,1771,1807,1809,1821,1783,1797,1783,1771,
-    1780,1788,1789,1760,1769,1778,1786,1766,1758,1775,1766,1758,1778,1779,1800,1775,
-    1798,1790,1798,1812,1807,1817,1785,1796,1784,1786,1765,1770,1804,1760,1748,1778,
-    1789,1770,1755,1780,1811,1776,1748,1774,1811,1787,1756,1777,1803,1801,1780,1808,
-    1825,1817,1801,1810,1825,1821,1825,1811,1788,1827,1791,1793,1790,1819,1803,1778,
-    1795,1766,1809,1777,1769,1770,1786,1775,1773,1794,1781,1781,1792,1781,1770,1787,
-    1779,1765,1770,1765,1763,1781,1796,1777,1823,1794,1799,1811,1826,1789,1789,1828,
-    1796,1828,1794,1812,1802,1838,1782,1792,1829,1791,1783,1807,1812,1795,1788,1772,
-    1750,1754,1759,1736,1772,1771,1749,1743,1773,1758,1770,1777,1779,1760,1764,1790,
-    1820,1812,1812,1812,1797,1786,1789,1798,1794,1791,1768,1770,1776,1788,1771,1783,
-    1756,1771,1779,1758,1758,1758,1777,1773,1776,1755,1753,1776,1786,1784,1773,1772,
-    1760,1774,1807,1795,1758,1775,1795,1819,1815,1772,1770,1802,1777,1740,1794,1811,
-    1803,1797,1814,1820,1829,1815,1758,1767,1789,1792,1775,1749,1774,1805,1808,1759,
-    1765,1786,1788,1787,1759,1783,1777,1768,1758,1777,1777,1769,1761,1782,1794,1777,
-    1798,1798,1782,1787,1820,1814,1804,1791,1809,1817,1799,1776,1788,1803,1775,1773,
-    1778,1794,1763,1754,1773,1757,1786,1769,1775,1770,1788,1782,1776,1786,1780,1806,
-    1807,1809,1793,1806,1831,1831,1791,1774,1780,1823,1781,1765,1786,1811,1791,1750,
-    1791,1801,1799,1776,1800,1811,1784,1777,1788,1803,1771,1765,1792,1794,1796,1793,
-    1779,1796,1804,1795,1777,1776,1807,1787,1761,1766,1799,1788,1762,1773,1784,1782,
-    1778,1780,1789,1795,1798,1794,1791,1796,1809,1805,1784,1797,1809,1814,1809,1805,
-    1784,1792,1799,1772,1780,1774,1762,1758,1778,1793,1796,1768,1779,1796,1782,1773,
-    1806,1807,1781,1782,1759,1792,1775,1763,1750,1793,1769,1773,1780,1738,1753,1774,
-    1775,1730,1734,1750,1802,1774,1764,1777,1824,1767,1760,1787,1782,1792,1791,1791,
-    1783,1816,1792,1785,1794,1807,1782,1789,1779,1760,1773,1801,1768,1795,1778,1767,
-    1789,1804,1794,1797,1802,1770,1770,1776,1782,1777,1811,1772,1787,1796,1783,1760,
-    1781,1776,1773,1782,1763,1787,1803,1802,1783,1810,1791,1768,1761,1779,1775,1785,
-    1785,1771,1793,1783,1791,1777,1803,1778,1797,1793,1792,1791,1804,1826,1785,1787,
-    1775,1826,1786,1772,1783,1808,1804,1790,1798,1797,1811,1798,1803,1790,1809,1802,
-    1798,1795,1798,1824,1794,1784,1777,1800,1796,1787,1798,1798,1800,1788,1784,1789,
-    1799,1797,1786,1781,1790,1805,1811,1793,1794,1807,1808,1785,1790,1788,1797,1804,
-    1801,1794,1795,1787,1778,1796,1787,1750,1755,1768,1759,1771,1773,1794,1784,1776,
-    1781,1791,1802,1766,1756,1770,1782,1767,1744,1777,1797,1801,1760,1773,1795,1779,
-    1766,1773,1802,1790,1778,1763,1775,1768,1774,1778,1773,1786,1798,1796,1785,1800,
-    1803,1796,1780,1780,1776,1785,1779,1781,1772,1768,1776,1775,1800,1794,1805,1796,
-    1794,1787,1788,1782,1791,1787,1777,1792,1802,1801,1776,1795,1782,1800,1799,1801,
-    1785,1788,1816,1796,1800,1803,1798,1796,1782,1777,1766,1771,1780,1780,1769,1756,
-    1789,1787,1787,1780,1773,1780,1784,1782,1787,1799,1785,1770,1784,1780,1772,1772,
-    1774,1778,1784,1797,1798,1787,1794,1797,1811,1799,1784,1799,1801,1801,1778,1793,
-    1780,1783,1784,1795,1804,1767,1780,1776,1794,1796,1773,1773,1766,1793,1787,1776,
-    1778,1783,1781,1765,1766,1765,1765,1774,1769,1770,1781,1791,1796,1784,1786,1795,
-    1770,1764,1782,1791,1786,1778,1780,1777,1798,1799,1805,1795,1796,1788,1791,1808,
-    1785,1787,1782,1803,1794,1798,1801,1802,1809,1793,1804,1791,1794,1791,1794,1796,
-    1797,1806,1796,1782,1782,1785,1765,1762,1764,1777,1775,1764,1771,1789,1784,1762,
-    1777,1782,1789,1773,1777,1788,1794,1789,1774,1783,1775,1779,1787,1790,1770,1777,
-    1780,1782,1779,1776,1786,1791,1798,1790,1802,1812,1792,1790,1806,1817,1808,1800,
-    1790,1803,1796,1787,1783,1796,1800,1784,1801,1788,1791,1777,1781,1773,1778,1783,
-    1788,1782,1786,1791,1800,1779,1759,1786,1791,1781,1764,1766,1772,1798,1771,1774,
-    1776,1781,1779,1793,1785,1767,1782,1806,1816,1777,1797,1787,1804,1806,1795,1781,
-    1789,1782,1775,1807,1773,1769,1777,1788,1798,1787,1794,1798,1806,1796,1798,1813,
-    1793,1783,1787,1794,1797,1810,1797,1787,1799,1801,1795,1788,1785,1797,1792,1780,
-    1788,1788,1776,1783,1805,1787,1765,1770,1786,1786,1774,1785,1785,1758,1757,1784,
-    1787,1772,1774,1788,1789,1777,1787,1810,1795,1763,1771,1783,1786,1769,1776,1779,
-    1802,1787,1763,1763,1775,1776,1762,1781,1789,1807,1797,1798,1793,1802,1804,1797,
-    1776,1776,1786,1788,1794,1780,1782,1775,1770,1765,1784,1790,1775,1786,1778,1752,
-    1747,1775,1765,1756,1772,1758,1757,1763,1780,1785,1790,1776,1762,1780,1798,1805,
-    1808,1791,1769,1781,1799,1795,1786,1785,1795,1795,1805,1810,1804,1820,1800,1797,
-    1790,1799,1790,1782,1780,1763,1783,1769,1780,1767,1758,1763,1780,1788,1776,1779,
-    1769,1763,1775,1784,1791,1782,1768,1793,1778,1764,1757,1782,1796,1798,1776,1790,
-    1795,1798,1801,1801,1815,1792,1766,1778,1800,1785,1783,1765,1883,1812,1758,1792,
-    1836,1812,1755,1772,1771,1774,1748,1748,1782,1844,1804,1791,1779,1831,1827,1810,
-    1776,1788,1793,1766,1760,1773,1790,1751,1785,1778,1764,1770,1791,1794,1795,1798,
-    1784,1773,1774,1764,1777,1799,1787,1759,1748,1761,1775,1779,1773,1772,1784,1786,
-    1787,1795,1806,1820,1813,1801,1794,1807,1827,1821,1812,1809,1807,1810,1796,1802,
-    1816,1821,1797,1788,1803,1806,1801,1792,1801,1790,1791,1802,1807,1799,1790,1798,
-    1786,1781,1774,1770,1761,1766,1779,1760,1761,1762,1771,1773,1770,1766,1770,1771,
-    1754,1757,1770,1767,1764,1763,1751,1740,1747,1756,1752,1751,1743,1748,1749,1746,
-    1732,1746,1737,1726,1713,1703,1705,1704,1710,1699,1704,1715,1734,1757,1791,1854,
-    1970,2051,2057,2061,2121,2154,2127,2066,1991,1943,1884,1793,1707,1659,1657,1641,
-    1591,1568,1585,1632,1692,1738,1778,1842,1887,1897,1893,1913,1933,1935,1907,1835,
-    1786,1761,1726,1683,1670,1657,1641,1646,1637,1661,1741,1816,1870,1899,1897,1912,
-    1946,1966,1950,1916,1875,1820,1763,1726,1690,1686,1688,1648,1625,1630,1658,1688,
-    1722,1742,1758,1776,1773,1764,1778,1791,1785,1766,1729,1698,1700,1708,1707,1697,
-    1694,1685,1672,1660,1657,1667,1655,1622,1580,1547,1524,1513,1479,1455,1447,1486,
-    1582,1929,2400,2503,2289,2386,2786,2824,2555,2358,2239,2055,1868,1589,1313,1362,
-    1510,1347,1118,1186,1407,1620,1811,1952,2100,2264,2284,2148,2090,2142,2142,1997,
-    1729,1484,1401,1383,1345,1361,1453,1562,1647,1681,1726,1899,2095,2165,2126,2068,
-    1986,1911,1838,1731,1670,1661,1589,1470,1427,1482,1576,1692,1763,1801,1873,1929,
-    1935,1941,1963,1979,1955,1887,1791,1730,1698,1667,1660,1672,1675,1664,1686,1740,
-    1837,1934,2007,2023,1999,1944,1906,1885,1855,1828,1772,1697,1624,1586,1569,1584,
-    1629,1661,1676,1683,1691,1722,1769,1809,1812,1811,1818,1800,1766,1737,1727,1730,
-    1707,1653,1596,1544,1517,1535,1557,1563,1594,1652,1717,1766,1804,1836,1915,2055,
-    2251,2367,2277,2165,2228,2277,2112,1935,1857,1754,1600,1513,1533,1623,1746,1813,
-    1799,1825,1916,1978,2002,2042,2070,2008,1848,1673,1580,1570,1568,1546,1519,1519,
-    1550,1601,1669,1787,1926,1994,1979,1942,1916,1876,1832,1783,1732,1675,1596,1535,
-    1523,1566,1649,1733,1784,1809,1843,1872,1897,1931,1969,1967,1911,1842,1775,1730,
-    1729,1744,1740,1737,1762,1781,1832,1934,1987,1963,1933,1917,1880,1836,1812,1787,
-    1781,1786,1742,1691,1686,1692,1682,1696,1718,1718,1698,1682,1659,1656,1665,1673,
-    1673,1678,1700,1722,1737,1723,1717,1729,1751,1757,1750,1734,1734,1751,1772,1776,
-    1776,1781,1773,1746,1716,1690,1664,1677,1686,1671,1672,1717,1771,1828,1876,1890,
-    1900,1942,2027,2121,2172,2188,2196,2155,2074,2005,1909,1778,1680,1622,1565,1556,
-    1616,1671,1709,1770,1832,1862,1876,1883,1875,1848,1796,1727,1667,1632,1632,1629,
-    1616,1631,1686,1736,1783,1849,1902,1922,1925,1912,1873,1857,1846,1802,1772,1766,
-    1745,1725,1738,1759,1771,1793,1801,1789,1793,1820,1838,1839,1827,1797,1775,1760,
-    1758,1757,1767,1791,1800,1788,1790,1826,1883,1934,1909,1836,1816,1859,1827,1747,
-    1715,1728,1747,1751,1745,1761,1811,1824,1793,1781,1769,1743,1711,1684,1669,1664,
-    1659,1657,1687,1719,1727,1742,1778,1795,1791,1775,1757,1754,1744,1716,1693,1687,
-    1698,1713,1727,1728,1758,1796,1791,1771,1785,1802,1797,1780,1760,1745,1744,1747,
-    1734,1715,1704,1724,1732,1707,1730,1946,2196,2201,2041,2038,2198,2209,2023,1872,
-    1821,1717,1571,1536,1623,1723,1769,1777,1787,1812,1853,1874,1898,1938,1922,1800,
-    1682,1670,1698,1696,1681,1687,1700,1699,1710,1767,1868,1950,1937,1868,1827,1832,
-    1823,1794,1785,1790,1753,1673,1630,1662,1729,1765,1768,1761,1768,1779,1785,1798,
-    1837,1858,1837,1794,1766,1763,1781,1800,1819,1822,1814,1785,1776,1793,1832,1887,
-    1879,1820,1755,1773,1784,1785,1767,1750,1739,1725,1725,1742,1784,1792,1779,1759,
-    1744,1732,1727,1739,1750,1738,1715,1695,1709,1724,1717,1709,1713,1704,1696,1701,
-    1741,1784,1800,1778,1768,1779,1813,1852,1867,1860,1829,1796,1757,1740,1736,1756,
-    1735,1700,1666,1684,1727,1756,1767,1773,1764,1753,1735,1703,1682,1681,1667,1695,
-    1967,2226,2123,1910,2134,2426,2275,1981,1928,1900,1722,1614,1670,1768,1790,1759,
-    1722,1736,1781,1801,1823,1899,1938,1842,1683,1652,1730,1746,1687,1688,1717,1682,
-    1616,1653,1787,1888,1887,1821,1805,1853,1882,1871,1878,1887,1843,1737,1652,1656,
-    1721,1759,1747,1735,1739,1728,1728,1783,1864,1892,1841,1786,1786,1820,1837,1840,
-    1844,1823,1764,1714,1714,1757,1786,1783,1749,1738,1757,1791,1821,1846,1879,1892,
-    1873,1832,1810,1767,1729,1698,1670,1660,1663,1675,1696,1723,1733,1738,1759,1795,
-    1821,1816,1791,1762,1759,1746,1727,1712,1734,1778,1775,1744,1731,1768,1811,1827,
-    1832,1841,1840,1827,1804,1786,1781,1768,1732,1692,1653,1649,1672,1703,1691,1677,
-    1679,1704,1721,1703,1706,1755,1822,1819,1780,1759,1797,1847,1868,1887,1936,1966,
-    1963,1993,2026,2030,2027,2015,1952,1866,1815,1786,1764,1753,1741,1718,1706,1702,
-    1708,1728,1759,1781,1782,1792,1802,1795,1777,1775,1781,1774,1746,1722,1739,1775,
-    1798,1820,1846,1852,1826,1805,1803,1798,1793,1791,1778,1756,1734,1713,1711,1729,
-    1745,1747,1748,1754,1775,1803,1827,1837,1826,1798,1761,1742,1761,1790,1794,1783,
-    1760,1732,1708,1709,1727,1744,1753,1763,1780,1793,1802,1826,1858,1887,1895,1856,
-    1815,1810,1825,1812,1785,1754,1741,1735,1732,1743,1768,1793,1797,1791,1785,1796,
-    1810,1809,1799,1780,1757,1740,1737,1748,1761,1769,1781,1787,1790,1793,1793,1803,
-    1802,1772,1736,1735,1753,1771,1773,1754,1725,1709,1700,1690,1682,1694,1716,1714,
-    1683,1670,1703,1747,1765,1767,1780,1799,1815,1839,1890,1939,1975,1984,1969,1965,
-    1987,2010,1996,1958,1915,1860,1807,1786,1796,1805,1807,1801,1784,1774,1785,1812,
-    1831,1838,1824,1791,1764,1754,1745,1737,1744,1752,1737,1720,1724,1750,1784,1800,
-    1798,1797,1805,1808,1794,1784,1796,1799,1778,1753,1750,1769,1785,1774,1763,1770,
-    1776,1782,1781,1792,1817,1822,1817,1820,1826,1816,1798,1790,1784,1782,1771,1743,
-    1725,1719,1707,1692,1692,1705,1712,1706,1713,1728,1735,1729,1726,1733,1731,1723,
-    1718,1718,1711,1712,1713,1702,1698,1716,1736,1740,1733,1720,1705,1687,1677,1659,
-    1643,1641,1651,1676,1703,1762,1886,1998,2045,2075,2125,2183,2223,2186,2093,2012,
-    1971,1936,1876,1830,1816,1818,1795,1747,1696,1707,1747,1746,1733,1740,1744,1730,
-    1711,1695,1712,1725,1709,1693,1693,1695,1699,1720,1757,1773,1764,1772,1805,1833,
-    1832,1823,1827,1826,1793,1750,1738,1751,1761,1759,1749,1755,1763,1764,1764,1772,
-    1786,1789,1778,1769,1777,1794,1810,1819,1821,1814,1805,1799,1803,1807,1802,1788,
-    1764,1749,1752,1757,1770,1788,1794,1789,1789,1798,1806,1807,1811,1822,1824,1812,
-    1808,1809,1808,1800,1783,1765,1758,1754,1740,1728,1726,1729,1729,1732,1745,1771,
-    1790,1804,1802,1814,1823,1828,1829,1822,1830,1826,1814,1799,1799,1801,1794,1788,
-    1785,1794,1804,1801,1798,1800,1809,1818,1815,1803,1791,1792,1805,1818,1828,1824,
-    1829,1841,1838,1835,1840,1842,1830,1817,1809,1801,1795,1795,1793,1779,1759,1736,
-    1716,1706,1696,1699,1704,1704,1696,1682,1683,1697,1708,1719,1734,1738,1732,1727,
-    1737,1751,1763,1773,1781,1785,1794,1800,1813,1824,1828,1820,1799,1792,1796,1804,
-    1808,1814,1819,1805,1784,1782,1791,1799,1802,1799,1795,1804,1812,1814,1827,1841,
-    1835,1818,1815,1816,1816,1820,1823,1822,1809,1786,1775,1779,1796,1803,1799,1794,
-    1784,1777,1771,1772,1787,1792,1787,1779,1777,1780,1782,1782,1791,1801,1806,1802,
-    1802,1811,1820,1823,1819,1820,1826,1825,1823,1827,1822,1820,1814,1805,1800,1794,
-    1788,1791,1786,1776,1765,1757,1754,1738,1732,1737,1742,1741,1736,1734,1731,1726,
-    1724,1717,1705,1699,1704,1701,1693,1683,1680,1696,1703,1700,1698,1709,1724,1731,
-    1730,1735,1746,1754,1761,1762,1778,1814,1843,1857,1868,1886,1918,1937,1937,1940,
-    1952,1963,1961,1953,1946,1949,1945,1924,1899,1882,1869,1846,1827,1814,1801,1790,
-    1775,1760,1747,1737,1730,1730,1728,1728,1726,1720,1717,1709,1707,1722,1733,1744,
-    1753,1761,1777,1783,1783,1784,1787,1789,1782,1778,1788,1781,1772,1770,1768,1763,
-    1755,1748,1752,1760,1761,1760,1746,1749,1756,1756,1755,1763,1776,1779,1766,1758,
-    1755,1752,1765,1772,1775,1776,1771,1767,1766,1774,1785,1786,1792,1797,1805,1809,
-    1812,1808,1806,1806,1799,1791,1787,1795,1800,1796,1788,1783,1774,1775,1786,1790,
-    1793,1803,1821,1827,1824,1821,1821,1820,1813,1808,1802,1800,1796,1791,1781,1778,
-    1780,1784,1790,1798,1807,1810,1815,1812,1808,1807,1803,1803,1805,1800,1794,1791,
-    1792,1794,1781,1772,1775,1773,1764,1763,1769,1771,1772,1766,1764,1770,1787,1794,
-    1784,1789,1795,1792,1789,1784,1785,1784,1777,1765,1759,1758,1758,1763,1772,1777,
-    1782,1788,1793,1788,1784,1786,1781,1788,1804,1808,1793,1786,1800,1816,1809,1802,
-    1804,1816,1813,1799,1798,1803,1800,1782,1760,1753,1760,1756,1748,1745,1746,1741,
-    1732,1731,1742,1747,1752,1756,1763,1767,1769,1769,1778,1783,1776,1769,1772,1779,
-    1778,1773,1767,1770,1762,1747,1741,1752,1761,1761,1753,1747,1753,1756,1756,1767,
-    1788,1802,1810,1826,1853,1878,1894,1900,1906,1908,1898,1888,1883,1885,1877,1862,
-    1855,1843,1832,1823,1806,1798,1790,1773,1757,1755,1759,1760,1750,1745,1751,1754,
-    1752,1744,1745,1748,1742,1733,1734,1735,1739,1741,1745,1750,1754,1762,1766,1772,
-    1774,1774,1779,1779,1782,1782,1785,1793,1796,1799,1802,1800,1800,1804,1808,1816,
-    1821,1820,1819,1819,1819,1821,1819,1804,1795,1787,1786,1788,1786,1785,1782,1777,
-    1766,1769,1775,1773,1772,1770,1770,1773,1771,1763,1761,1764,1761,1757,1755,1757,
-    1762,1768,1774,1774,1774,1770,1777,1783,1784,1787,1789,1792,1791,1796,1796,1801,
-    1806,1811,1815,1815,1821,1821,1817,1811,1807,1803,1792,1785,1785,1782,1783,1779,
-    1776,1779,1782,1777,1773,1773,1772,1764,1754,1755,1757,1759,1756,1759,1762,1774,
-    1782,1786,1793,1800,1799,1798,1794,1792,1791,1785,1782,1780,1782,1786,1782,1778,
-    1779,1782,1779,1773,1772,1772,1773,1769,1779,1784,1781,1780,1784,1785,1789,1792,
-    1793,1799,1804,1807,1805,1808,1809,1806,1810,1819,1813,1811,1806,1802,1800,1798,
-    1792,1790,1790,1788,1788,1783,1787,1790,1790,1788,1792,1788,1791,1792,1793,1792,
-    1784,1780,1775,1772,1775,1776,1775,1779,1782,1784,1778,1779,1791,1800,1802,1805,
-    1807,1814,1813,1807,1809,1802,1797,1789,1788,1790,1789,1787,1785,1787,1787,1790,
-    1793,1799,1803,1805,1803,1793,1793,1791,1791,1792,1799,1801,1800,1798,1791,1787,
-    1785,1787,1788,1789,1789,1791,1786,1785,1785,1781,1773,1764,1760,1754,1750,1751,
-    1752,1753,1760,1764,1768,1772,1784,1794,1798,1799,1792,1793,1788,1780,1775,1771,
-    1771,1773,1771,1775,1785,1786,1791,1796,1805,1810,1810,1810,1808,1807,1803,1794,
-    1787,1786,1785,1785,1784,1788,1790,1788,1787,1793,1799,1798,1794,1791,1788,1784,
-    1781,1776,1774,1777,1780,1780,1774,1768,1763,1762,1771,1766,1760,1759,1765,1770,
-    1764,1761,1767,1776,1776,1776,1774,1777,1779,1779,1779,1776,1780,1780,1776,1779,
-    1786,1791,1791,1790,1790,1791,1791,1783,1785,1790,1794,1794,1796,1799,1797,1796,
-    1794,1796,1792,1791,1787,1786,1792,1786,1787,1787,1780,1781,1778,1777,1781,1782,
-    1781,1780,1779,1777,1778,1779,1778,1777,1778,1782,1781,1785,1796,1797,1795,1794,
-    1790,1792,1799,1798,1793,1793,1799,1798,1796,1799,1803,1798,1793,1793,1792,1788,
-    1785,1783,1777,1770,1773,1776,1779,1786,1786,1789,1788,1790,1793,1795,1797,1801,
-    1801,1802,1800,1793,1790,1790,1790,1787,1791,1789,1783,1781,1783,1783,1778,1771,
-    1770,1770,1765,1768,1769,1764,1769,1771,1771,1772,1775,1781,1785,1792,1796,1799,
-    1798,1792,1785,1782,1778,1776,1772,1772,1774,1778,1777,1776,1780,1790,1792,1793,
-    1796,1799,1798,1787,1778,1772,1773,1777,1781,1783,1788,1786,1790,1795,1800,1801,
-    1796,1794,1791,1784,1785,1780,1771,1776,1777,1769,1764,1766,1777,1776,1768,1774,
-    1774,1778,1790,1789,1792,1792,1796,1794,1793,1796,1798,1802,1796,1801,1802,1804,
-    1807,1801,1796,1794,1792,1796,1791,1789,1784,1788,1785,1779,1778,1785,1780,1778,
-    1776,1779,1784,1790,1790,1790,1788,1793,1793,1794,1792,1793,1804,1788,1797,1788,
-    1797,1776,1854,1814,1791,1800,1799,1804,1740,1744,1710,1724,1707,1714,1736,1746,
-    1768,1760,1774,1775,1788,1782,1797,1786,1797,1802,1780,1803,1772,1801,1771,1793,
-    1758,1784,1764,1786,1768,1779,1783,1766,1793,1764,1810,1759,1799,1761,1791,1769,
-    1787,1779,1789,1792,1779,1793,1785,1796,1794,1796,1805,1804,1799,1794,1790,1805,
-    1787,1803,1783,1793,1786,1789,1776,1803,1768,1815,1772,1807,1795,1796,1806,1779,
-    1818,1762,1831,1756,1834,1750,1817,1762,1787,1787,1760,1808,1763,1825,1754,1825,
-    1750,1820,1773,1799,1788,1798,1792,1788,1794,1788,1806,1786,1795,1780,1778,1787,
-    1780,1785,1790,1778,1798,1758,1794,1763,1807,1753,1820,1744,1831,1734,1820,1765,
-    1787,1799,1752,1823,1739,1852,1720,1864,1758,1862,1743,1833,1762,1813,1795,1775,
-    1808,1765,1830,1741,1823,1748,1823,1767,1820,1758,1820,1755,1823,1749,1808,1777,
-    1796,1812,1785,1833,1770,1826,1778,1811,1799,1784,1802,1799,1781,1821,1741,1830,
-    1756,1819,1756,1815,1765,1820,1748,1793,1781,1765,1800,1741,1830,1719,1846,1729,
-    1817,1752,1811,1766,1798,1756,1795,1789,1769,1805,1748,1823,1746,1796,1768,1794,
-    1770,1797,1772,1793,1786,1775,1817,1769,1810,1778,1807,1775,1804,1788,1785,1794,
-    1766,1817,1754,1812,1764,1817,1755,1811,1766,1793,1790,1765,1812,1753,1811,1755,
-    1818,1752,1818,1765,1795,1776,1763,1801,1750,1837,1718,1818,1747,1801,1774,1772,
-    1785,1773,1788,1760,1784,1750,1822,1721,1828,1730,1817,1768,1782,1781,1784,1796,
-    1782,1776,1784,1791,1773,1797,1767,1822,1758,1831,1726,1850,1749,1833,1768,1804,
-    1788,1761,1830,1719,1851,1699,1854,1724,1801,1788,1771,1810,1748,1823,1751,1809,
-    1789,1786,1809,1791,1805,1786,1778,1818,1754,1836,1729,1836,1750,1796,1807,1760,
-    1853,1706,1884,1738,1840,1781,1790,1821,1745,1845,1746,1843,1753,1834,1794,1787,
-    1833,1766,1822,1767,1805,1793,1781,1795,1779,1805,1747,1812,1762,1808,1759,1785,
-    1788,1762,1826,1734,1860,1713,1845,1757,1814,1785,1780,1784,1778,1809,1726,1842,
-    1722,1818,1724,1834,1750,1780,1811,1758,1816,1759,1850,1745,1831,1785,1769,1828,
-    1749,1838,1732,1844,1750,1790,1798,1746,1845,1707,1880,1681,1873,1709,1812,1783,
-    1738,1856,1674,1903,1627,1911,1729,1793,1826,1737,1875,1662,1930,1683,1855,1754,
-    1768,1870,1677,1929,1649,1927,1688,1842,1768,1757,1871,1691,1896,1672,1914,1672,
-    1856,1738,1776,1815,1705,1866,1675,1868,1709,1853,1727,1812,1792,1740,1860,1679,
-    1867,1694,1846,1733,1782,1785,1755,1803,1774,1765,1807,1759,1794,1780,1761,1840,
-    1716,1866,1686,1839,1756,1779,1797,1774,1802,1764,1814,1765,1808,1751,1808,1772,
-    1763,1822,1730,1846,1719,1844,1761,1746,1844,1687,1890,1672,1881,1722,1840,1793,
-    1765,1864,1724,1881,1727,1874,1721,1836,1764,1790,1825,1744,1862,1712,1848,1758,
-    1784,1798,1787,1762,1810,1762,1776,1802,1741,1833,1710,1870,1719,1832,1757,1791,
-    1813,1734,1886,1696,1856,1786,1765,1817,1746,1836,1721,1853,1707,1847,1741,1788,
-    1795,1710,1892,1635,1895,1663,1864,1715,1825,1781,1773,1796,1751,1780,1748,1826,
-    1678,1892,1670,1866,1741,1756,1855,1681,1858,1740,1793,1793,1777,1774,1825,1762,
-    1807,1819,1727,1885,1686,1928,1657,1915,1706,1824,1785,1766,1800,1764,1855,1691,
-    1925,1659,1923,1654,1899,1662,1871,1681,1842,1733,1772,1810,1733,1845,1671,1922,
-    1610,1944,1661,1850,1781,1767,1792,1817,1735,1850,1713,1856,1769,1750,1851,1695,
-    1875,1701,1858,1733,1819,1779,1794,1759,1816,1732,1803,1768,1773,1783,1779,1784,
-    1785,1788,1790,1757,1785,1810,1726,1838,1757,1793,1807,1772,1789,1797,1773,1797,
-    1764,1799,1765,1771,1830,1736,1859,1750,1809,1825,1727,1867,1730,1808,1791,1780,
-    1811,1779,1787,1863,1702,1905,1703,1853,1789,1765,1860,1721,1871,1771,1821,1792,
-    1854,1737,1882,1678,1884,1689,1841,1745,1779,1817,1720,1822,1723,1813,1728,1835,
-    1701,1832,1711,1845,1701,1845,1715,1843,1723,1802,1788,1750,1839,1705,1862,1672,
-    1893,1644,1914,1685,1876,1734,1814,1790,1732,1846,1687,1869,1692,1858,1745,1759,
-    1852,1726,1805,1826,1716,1838,1758,1817,1741,1859,1719,1885,1721,1837,1786,1803,
-    1803,1769,1857,1701,1885,1691,1874,1727,1855,1739,1823,1780,1779,1834,1735,1846,
-    1729,1857,1764,1791,1815,1787,1796,1798,1762,1810,1737,1802,1798,1725,1868,1656,
-    1897,1674,1861,1749,1757,1846,1713,1839,1746,1820,1751,1809,1736,1846,1716,1818,
-    1763,1824,1738,1810,1790,1752,1798,1793,1763,1786,1818,1713,1870,1680,1867,1730,
-    1765,1844,1714,1849,1725,1825,1758,1782,1787,1771,1800,1782,1803,1795,1777,1805,
-    1786,1784,1812,1733,1878,1696,1883,1712,1862,1720,1795,1825,1711,1881,1713,1854,
-    1703,1894,1671,1903,1674,1854,1789,1674,1931,1644,1885,1726,1841,1765,1798,1806,
-    1787,1784,1837,1772,1809,1803,1777,1826,1729,1895,1701,1901,1725,1816,1831,1724,
-    1866,1768,1805,1808,1742,1853,1748,1766,1857,1690,1848,1752,1778,1836,1695,1857,
-    1717,1774,1798,1724,1850,1716,1810,1752,1849,1714,1845,1755,1811,1743,1834,1720,
-    1803,1817,1723,1893,1665,1927,1663,1882,1693,1840,1749,1784,1780,1741,1847,1681,
-    1886,1673,1900,1691,1857,1742,1824,1761,1810,1787,1750,1812,1727,1836,1716,1858,
-    1725,1847,1715,1857,1694,1866,1736,1821,1764,1794,1789,1771,1836,1684,1927,1650,
-    1887,1745,1799,1807,1764,1866,1725,1853,1793,1792,1809,1818,1814,1791,1841,1758,
-    1856,1742,1919,1727,1826,1875,1649,1971,1682,1829,1817,1729,1864,1698,1841,1780,
-    1763,1791,1787,1773,1775,1802,1756,1803,1762,1799,1728,1790,1780,1740,1845,1702,
-    1856,1720,1827,1785,1767,1825,1737,1869,1686,1917,1663,1916,1701,1823,1836,1688,
-    1931,1629,1944,1629,1877,1739,1724,1873,1659,1907,1627,1922,1666,1844,1760,1775,
-    1831,1672,1936,1640,1900,1680,1874,1714,1819,1781,1779,1790,1798,1804,1759,1842,
-    1728,1857,1720,1883,1694,1897,1745,1816,1790,1781,1794,1720,1877,1656,1877,1734,
-    1784,1790,1786,1792,1766,1782,1809,1759,1720,1863,1654,1863,1659,1879,1682,1792,
-    1877,1583,2008,1559,1947,1650,1813,1825,1630,1982,1562,2001,1583,1932,1723,1721,
-    1975,1561,1999,1602,1928,1693,1824,1794,1736,1893,1638,1968,1618,1921,1749,1740,
-    1873,1697,1915,1671,1907,1691,1890,1753,1771,1908,1677,1896,1699,1883,1682,1882,
-    1720,1776,1839,1688,1873,1669,1846,1721,1821,1751,1751,1839,1700,1869,1671,1900,
-    1679,1833,1747,1811,1783,1733,1913,1601,1986,1609,1937,1657,1844,1809,1694,1891,
-    1694,1873,1738,1856,1701,1909,1686,1859,1767,1737,1922,1607,1943,1706,1825,1809,
-    1740,1842,1668,1969,1600,1915,1692,1834,1810,1720,1896,1708,1905,1680,1945,1654,
-    1952,1658,1814,1854,1677,1891,1691,1834,1757,1810,1786,1772,1881,1691,1866,1754,
-    1746,1894,1640,1905,1667,1909,1638,1889,1731,1793,1806,1701,1916,1602,1973,1635,
-    1852,1781,1720,1867,1687,1852,1705,1819,1784,1701,1880,1662,1862,1710,1797,1777,
-    1736,1850,1739,1801,1762,1855,1723,1829,1756,1783,1758,1805,1754,1775,1860,1663,
-    1921,1727,1771,1846,1687,1912,1661,1912,1714,1793,1856,1675,1954,1614,1944,1691,
-    1830,1818,1738,1870,1722,1870,1721,1854,1745,1814,1779,1728,1872,1662,1885,1681,
-    1800,1773,1727,1865,1645,1934,1629,1902,1692,1825,1795,1739,1878,1670,1943,1651,
-    1901,1754,1773,1865,1731,1861,1755,1843,1780,1791,1838,1748,1795,1805,1724,1860,
-    1679,1881,1718,1806,1788,1741,1887,1626,1974,1600,1932,1720,1789,1821,1745,1837,
-    1728,1871,1724,1893,1720,1868,1712,1845,1727,1800,1810,1714,1900,1675,1868,1756,
-    1822,1785,1756,1837,1741,1801,1809,1730,1823,1777,1775,1788,1754,1829,1742,1814,
-    1780,1784,1789,1799,1763,1806,1752,1800,1768,1760,1862,1693,1900,1710,1803,1813,
-    1707,1907,1636,1941,1676,1814,1816,1696,1913,1662,1908,1705,1844,1781,1764,1844,
-    1722,1880,1699,1842,1756,1775,1830,1686,1856,1718,1774,1797,1723,1824,1748,1804,
-    1789,1757,1845,1707,1852,1744,1785,1825,1729,1828,1767,1796,1779,1800,1743,1842,
-    1728,1828,1784,1780,1824,1778,1836,1763,1844,1774,1798,1812,1778,1812,1784,1769,
-    1833,1757,1841,1733,1830,1767,1787,1819,1712,1880,1713,1800,1797,1765,1792,1769,
-    1800,1727,1830,1775,1719,1856,1703,1827,1754,1764,1813,1741,1824,1735,1793,1783,
-    1736,1813,1734,1804,1776,1739,1838,1728,1832,1778,1756,1845,1734,1828,1779,1778,
-    1832,1736,1862,1719,1851,1782,1754,1849,1742,1853,1772,1813,1807,1764,1843,1755,
-    1808,1811,1754,1825,1757,1817,1785,1777,1805,1766,1808,1784,1772,1790,1756,1801,
-    1771,1780,1787,1792,1778,1779,1785,1792,1776,1760,1791,1773,1796,1768,1778,1779,
-    1795,1770,1786,1794,1784,1768,1798,1756,1821,1781,1784,1814,1772,1821,1774,1809,
-    1781,1793,1780,1789,1787,1781,1796,1781,1772,1782,1772,1767,1772,1776,1763,1787,
-    1765,1801,1751,1772,1775,1754,1793,1762,1784,1775,1798,1770,1804,1764,1796,1778,
-    1783,1793,1791,1790,1792,1793,1789,1807,1790,1792,1789,1817,1770,1829,1773,1776,
-    1806,1744,1821,1752,1801,1786,1779,1792,1771,1802,1754,1812,1767,1794,1787,1779,
-    1778,1786,1776,1767,1786,1777,1786,1777,1793,1782,1785,1796,1779,1786,1789,1778,
-    1794,1782,1801,1787,1801,1797,1780,1798,1773,1793,1776,1788,1790,1769,1803,1785,
-    1806,1778,1806,1786,1801,1785,1789,1807,1772,1821,1767,1807,1787,1793,1800,1768,
-    1790,1759,1779,1784,1776,1798,1770,1790,1789,1795,1808,1789,1797,1788,1809,1786,
-    1812,1801,1792,1815,1775,1799,1779,1802,1796,1795,1796,1775,1800,1773,1802,1786,
-    1787,1802,1773,1798,1785,1781,1786,1769,1775,1772,1768,1782,1763,1778,1763,1770,
-    1777,1757,1804,1748,1803,1771,1784,1798,1772,1804,1770,1799,1788,1795,1787,1801,
-    1787,1781,1791,1783,1788,1793,1781,1789,1788,1789,1770,1786,1773,1770,1797,1757,
-    1791,1756,1773,1771,1772,1785,1756,1796,1761,1784,1772,1774,1772,1764,1778,1757,
-    1775,1764,1771,1775,1776,1761,1779,1779,1789,1795,1790,1786,1774,1790,1764,1791,
-    1784,1779,1796,1773,1801,1775,1778,1790,1766,1796,1766,1792,1790,1788,1788,1786,
-    1808,1785,1808,1776,1795,1783,1784,1772,1772,1797,1765,1802,1773,1785,1790,1775,
-    1799,1778,1815,1791,1791,1806,1779,1808,1785,1797,1780,1794,1799,1778,1804,1785,
-    1797,1791,1789,1791,1788,1793,1786,1799,1781,1790,1786,1786,1788,1786,1781,1777,
-    1796,1784,1793,1790,1786,1796,1793,1804,1785,1801,1785,1796,1791,1786,1797,1780,
-    1809,1780,1803,1789,1798,1801,1793,1805,1796,1805,1805,1791,1797,1791,1799,1789,
-    1792,1804,1780,1797,1790,1792,1792,1799,1789,1795,1788,1794,1785,1789,1785,1778,
-    1800,1771,1793,1777,1783,1801,1781,1797,1769,1788,1779,1771,1783,1771,1788,1782,
-    1784,1785,1781,1775,1784,1786,1775,1783,1776,1783,1785,1773,1785,1770,1783,1773,
-    1787,1785,1785,1792,1773,1784,1784,1776,1777,1781,1761,1774,1759,1764,1759,1756,
-    1764,1765,1761,1768,1766,1777,1777,1774,1787,1767,1786,1775,1781,1787,1789,1792,
-    1794,1797,1791,1795,1800,1801,1810,1803,1805,1810,1808,1806,1806,1801,1794,1802,
-    1787,1788,1787,1788,1781,1777,1776,1783,1788,1790,1793,1793,1799,1796,1795,1792,
-    1783,1781,1778,1779,1781,1776,1775,1786,1780,1780,1780,1785,1786,1780,1789,1776,
-    1779,1775,1768,1782,1775,1783,1784,1775,1790,1782,1792,1779,1790,1781,1788,1788,
-    1777,1800,1776,1793,1780,1782,1784,1786,1779,1774,1790,1767,1794,1784,1794,1798,
-    1786,1797,1787,1806,1785,1797,1795,1791,1803,1789,1792,1785,1788,1790,1784,1788,
-    1794,1801,1792,1798,1796,1802,1800,1794,1809,1793,1804,1795,1809,1798,1805,1809,
-    1800,1815,1802,1811,1802,1799,1793,1798,1795,1785,1797,1793,1803,1802,1801,1798,
-    1800,1800,1789,1787,1781,1790,1782,1788,1782,1790,1787,1790,1798,1782,1798,1778,
-    1788,1782,1778,1788,1779,1794,1781,1795,1786,1777,1792,1779,1782,1771,1781,1770,
-    1761,1771,1755,1777,1767,1781,1782,1779,1791,1775,1783,1773,1787,1782,1784,1791,
-    1782,1787,1779,1784,1784,1782,1781,1772,1779,1784,1784,1786,1786,1783,1780,1777,
-    1778,1777,1780,1783,1776,1780,1782,1778,1784,1778,1773,1785,1771,1775,1780,1773,
-    1780,1776,1779,1774,1778,1780,1770,1778,1767,1768,1767,1764,1781,1769,1773,1770,
-    1764,1771,1768,1771,1776,1776,1776,1776,1779,1785,1787,1785,1783,1788,1786,1780,
-    1772,1775,1785,1795,1790,1787,1790,1782,1785,1789,1776,1786,1785,1788,1793,1795,
-    1800,1790,1789,1786,1792,1786,1788,1788,1806,1800,1804,1794,1800,1806,1803,1814,
-    1799,1811,1799,1805,1800,1791,1784,1786,1784,1791,1791,1785,1791,1774,1775,1786,
-    1788,1792,1793,1795,1788,1785,1780,1783,1787,1776,1780,1781,1780,1778,1773,1773,
-    1786,1790,1787,1785,1788,1792,1790,1780,1784,1783,1792,1784,1784,1782,1786,1797,
-    1789,1792,1784,1794,1793,1790,1796,1789,1789,1784,1795,1801,1799,1801,1779,1783,
-    1778,1792,1791,1791,1790,1799,1801,1788,1791,1782,1795,1788,1785,1793,1790,1790,
-    1783,1782,1783,1787,1796,1789,1800,1790,1784,1785,1785,1776,1777,1780,1780,1782,
-    1772,1783,1775,1768,1763,1765,1757,1757,1761,1766,1770,1768,1764,1772,1771,1775,
-    1794,1786,1789,1786,1776,1788,1783,1793,1795,1785,1789,1782,1795,1791,1786,1795,
-    1788,1783,1786,1787,1800,1796,1791,1789,1781,1778,1769,1776,1780,1776,1786,1778,
-    1786,1776,1774,1790,1776,1796,1789,1787,1781,1787,1800,1798,1792,1789,1786,1781,
-    1780,1779,1778,1788,1800,1789,1801,1790,1784,1774,1776,1782,1786,1779,1769,1770,
-    1763,1773,1764,1766,1775,1781,1773,1767,1778,1777,1775,1774,1784,1776,1783,1778,
-    1784,1799,1800,1804,1797,1806,1789,1805,1793,1797,1810,1799,1803,1794,1800,1796,
-    1793,1800,1798,1800,1791,1782,1791,1790,1794,1794,1792,1792,1785,1785,1782,1783,
-    1797,1800,1797,1796,1793,1796,1798,1798,1802,1801,1800,1795,1798,1785,1783,1791,
-    1784,1793,1782,1777,1776,1774,1776,1782,1775,1778,1781,1776,1789,1792,1800,1796,
-    1796,1781,1787,1789,1785,1783,1787,1796,1779,1775,1778,1793,1794,1799,1792,1796,
-    1789,1789,1789,1785,1792,1795,1802,1785,1783,1773,1779,1779,1780,1787,1774,1765,
-    1764,1776,1780,1779,1779,1778,1769,1779,1781,1781,1770,1770,1789,1785,1772,1769,
-    1781,1786,1792,1783,1775,1773,1779,1785,1795,1802,1804,1799,1792,1798,1789,1797,
-    1800,1801,1795,1781,1786,1790,1797,1793,1795,1798,1790,1782,1779,1791,1794,1800,
-    1790,1786,1789,1792,1801,1794,1797,1800,1803,1790,1784,1788,1796,1792,1788,1797,
-    1793,1792,1797,1793,1798,1805,1804,1788,1775,1780,1796,1790,1764,1773,1779,1784,
-    1778,1774,1779,1781,1785,1784,1788,1775,1781,1781,1783,1790,1786,1788,1775,1781,
-    1782,1800,1790,1772,1774,1776,1783,1771,1788,1787,1786,1789,1792,1793,1787,1788,
-    1791,1799,1789,1788,1796,1798,1801,1788,1790,1798,1800,1802,1793,1789,1786,1791,
-    1780,1775,1777,1772,1768,1769,1776,1770,1775,1772,1766,1774,1783,1794,1778,1773,
-    1785,1791,1789,1783,1785,1790,1798,1781,1786,1789,1782,1779,1780,1789,1780,1777,
-    1768,1772,1782,1779,1776,1771,1772,1779,1784,1787,1786,1779,1797,1799,1783,1783,
-    1787,1786,1779,1778,1773,1782,1778,1775,1781,1778,1783,1779,1771,1786,1782,1779,
-    1775,1775,1774,1784,1797,1793,1792,1786,1803,1804,1804,1798,1793,1801,1806,1795,
-    1787,1800,1795,1789,1789,1794,1794,1791,1793,1801,1806,1812,1803,1791,1797,1802,
-    1809,1795,1790,1797,1795,1792,1786,1784,1787,1794,1794,1785,1779,1788,1795,1798,
-    1791,1785,1787,1784,1780,1784,1789,1788,1784,1783,1785,1778,1770,1780,1785,1781,
-    1779,1778,1791,1782,1778,1775,1788,1785,1772,1784,1779,1789,1785,1775,1780,1791,
-    1779,1775,1788,1788,1790,1789,1793,1797,1791,1786,1794,1800,1799,1802,1798,1795,
-    1804,1801,1790,1786,1789,1795,1792,1781,1786,1786,1778,1793,1787,1783,1781,1786,
-    1790,1777,1781,1782,1779,1787,1784,1773,1777,1775,1786,1786,1780,1780,1777,1784,
-    1786,1785,1779,1774,1777,1769,1764,1766,1772,1783,1770,1763,1780,1784,1780,1775,
-    1776,1783,1784,1779,1772,1776,1777,1787,1784,1782,1789,1787,1789,1795,1798,1801,
-    1795,1794,1810,1799,1799,1799,1800,1792,1792,1800,1793,1788,1781,1794,1788,1786,
-    1779,1785,1790,1784,1776,1776,1791,1794,1789,1782,1791,1782,1781,1786,1778,1785,
-    1782,1771,1771,1775,1784,1780,1774,1785,1796,1778,1768,1777,1798,1795,1783,1776,
-    1777,1789,1776,1782,1786,1779,1773,1768,1777,1785,1778,1780,1777,1768,1782,1786,
-    1780,1773,1780,1785,1782,1768,1767,1776,1778,1784,1774,1779,1778,1789,1790,1777,
-    1786,1784,1782,1781,1783,1772,1767,1779,1780,1789,1797,1789,1782,1786,1792,1800,
-    1803,1790,1794,1792,1808,1806,1792,1790,1788,1800,1791,1797,1802,1801,1798,1794,
-    1793,1784,1785,1782,1793,1799,1797,1792,1788,1792,1783,1782,1770,1770,1770,1779,
-    1788,1781,1775,1777,1787,1777,1779,1773,1774,1782,1791,1801,1789,1791,1790,1796,
-    1794,1790,1799,1806,1801,1798,1804,1795,1777,1776,1786,1794,1784,1772,1792,1790,
-    1786,1781,1777,1779,1782,1774,1775,1784,1777,1771,1773,1779,1777,1771,1781,1790,
-    1780,1779,1780,1781,1775,1772,1763,1769,1774,1780,1774,1773,1786,1794,1788,1781,
-    1789,1797,1794,1787,1791,1779,1789,1790,1791,1786,1798,1796,1796,1808,1803,1806,
-    1795,1800,1803,1807,1795,1787,1787,1788,1786,1784,1776,1787,1798,1794,1787,1789,
-    1800,1789,1777,1765,1775,1787,1790,1775,1779,1775,1776,1773,1764,1775,1777,1774,
-    1753,1770,1770,1771,1762,1758,1764,1766,1777,1767,1780,1779,1771,1770,1770,1767,
-    1768,1779,1784,1781,1781,1788,1786,1782,1784,1782,1794,1804,1797,1789,1791,1797,
-    1793,1792,1789,1780,1784,1793,1779,1780,1782,1795,1799,1782,1789,1788,1784,1780,
-    1786,1797,1789,1774,1767,1782,1781,1770,1772,1782,1780,1778,1776,1776,1787,1767,
-    1768,1775,1776,1782,1781,1785,1798,1793,1779,1787,1792,1794,1793,1787,1788,1794,
-    1790,1782,1782,1786,1785,1777,1780,1785,1786,1774,1764,1768,1768,1774,1771,1765,
-    1781,1783,1778,1777,1786,1793,1782,1787,1782,1789,1790,1788,1802,1797,1786,1780,
-    1789,1792,1783,1778,1778,1777,1783,1787,1780,1776,1774,1787,1797,1789,1774,1779,
-    1792,1790,1786,1785,1794,1792,1790,1790,1794,1795,1793,1801,1802,1802,1798,1804,
-    1801,1792,1807,1809,1806,1805,1796,1785,1789,1793,1788,1785,1783,1783,1775,1776,
-    1771,1777,1778,1777,1780,1782,1788,1785,1793,1793,1794,1794,1801,1802,1798,1797,
-    1805,1805,1798,1799,1812,1815,1806,1802,1801,1812,1794,1787,1793,1805,1798,1786,
-    1784,1788,1791,1788,1799,1787,1784,1785,1780,1788,1797,1790,1778,1787,1793,1790,
-    1789,1799,1803,1800,1793,1791,1798,1786,1784,1783,1797,1795,1795,1800,1793,1797,
-    1795,1797,1795,1799,1794,1796,1788,1782,1789,1798,1791,1780,1776,1768,1773,1777,
-    1785,1780,1778,1768,1759,1761,1769,1772,1777,1780,1774,1777,1775,1768,1778,1795,
-    1792,1791,1783,1784,1792,1791,1791,1788,1788,1786,1782,1779,1778,1781,1785,1790,
-    1788,1778,1781,1787,1801,1811,1806,1802,1801,1800,1800,1801,1799,1795,1792,1787,
-    1778,1790,1791,1782,1782,1781,1780,1773,1774,1779,1783,1792,1788,1774,1775,1775,
-    1784,1793,1795,1791,1793,1804,1796,1789,1790,1807,1825,1819,1811,1802,1790,1795,
-    1810,1801,1796,1816,1806,1806,1806,1814,1825,1813,1812,1814,1814,1801,1797,1793,
-    1797,1802,1793,1785,1785,1789,1783,1784,1783,1787,1792,1786,1768,1765,1776,1781,
-    1783,1783,1779,1781,1782,1770,1779,1790,1780,1775,1789,1802,1800,1798,1800,1799,
-    1784,1777,1782,1789,1789,1785,1776,1777,1781,1783,1779,1774,1786,1791,1794,1782,
-    1775,1777,1778,1777,1778,1781,1771,1764,1772,1780,1778,1769,1770,1774,1778,1778,
-    1785,1791,1781,1780,1778,1773,1766,1779,1793,1778,1778,1787,1788,1785,1777,1767,
-    1757,1770,1775,1774,1785,1782,1781,1784,1786,1791,1788,1776,1775,1783,1781,1783,
-    1783,1784,1788,1791,1798,1789,1783,1774,1776,1776,1773,1786,1782,1777,1775,1778,
-    1781,1777,1786,1791,1784,1780,1781,1778,1771,1783,1781,1779,1776,1775,1786,1787,
-    1784,1776,1768,1761,1776,1777,1775,1778,1777,1781,1790,1803,1807,1803,1797,1799,
-    1791,1782,1794,1805,1802,1801,1796,1791,1790,1786,1779,1783,1786,1789,1794,1798,
-    1796,1800,1791,1779,1773,1775,1792,1800,1801,1790,1788,1796,1794,1794,1796,1795,
-    1793,1794,1791,1786,1792,1784,1787,1790,1794,1796,1793,1791,1794,1801,1791,1784,
-    1794,1808,1805,1795,1792,1792,1789,1790,1792,1789,1788,1784,1786,1796,1793,1790,
-    1786,1790,1795,1794,1793,1796,1809,1806,1803,1792,1786,1789,1787,1786,1790,1783,
-    1781,1784,1780,1778,1775,1771,1776,1771,1766,1774,1782,1776,1767,1777,1785,1778,
-    1776,1782,1783,1785,1780,1777,1777,1774,1768,1768,1777,1779,1783,1788,1791,1797,
-    1782,1771,1777,1790,1791,1785,1779,1779,1787,1785,1781,1773,1777,1789,1795,1782,
-    1781,1784,1785,1786,1794,1793,1787,1795,1801,1801,1791,1799,1795,1789,1796,1792,
-    1788,1788,1783,1777,1769,1774,1771,1776,1767,1765,1773,1770,1777,1765,1757,1767,
-    1768,1760,1767,1772,1777,1778,1772,1768,1773,1768,1771,1777,1778,1773,1771,1771,
-    1773,1780,1776,1773,1768,1771,1773,1771,1769,1776,1771,1773,1772,1770,1779,1784,
-    1786,1778,1774,1774,1785,1786,1789    
-};
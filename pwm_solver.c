@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "hardware/clocks.h"
+#include "pwm_solver.h"
+#include "cycle_counter.h"
+/*
+   Solves sys_hz = sample_rate * (1 << shift) * (div_16 / 16) * (wrap + 1)
+   Larger wraps give more resolution, so dividers are tried from the smallest
+ */
+
+#define PWM_SOLVER_MAX_DIV_16   ((255 << 4) + 15)   // 8.4 divider limit
+#define PWM_SOLVER_CLOCK_GAIN   4                   // Improvement needed to change the system clock
+
+const pwm_limits pwm_default_limits = {1023, 65534, 32000, 2, 200, 2000};
+const pwm_limits pwm_high_carrier_limits = {511, 1023, 160000, 4, 200, 2000};
+
+// System clocks that suit common rate families. Checked against the PLL before use
+static const uint32_t clock_candidates_khz[] = {180000, 176000, 184000, 192000, 172000, 168000, 153600, 147000};
+
+// Error of the PWM rate against the wanted carrier, in ppm
+static int32_t pwmSolverError(uint64_t clocks_16, uint div_16, uint32_t period, uint32_t carrier)
+{
+    uint64_t den = (uint64_t)div_16 * period * carrier;
+
+    return (int32_t)((int64_t)(((clocks_16 * 1000000) + (den >> 1)) / den) - 1000000);
+}
+
+bool pwmSolverSolve(uint32_t sys_hz, uint32_t sample_rate, const pwm_limits* limits, pwm_solution* sol)
+{
+    bool found = false;
+
+    if (!sample_rate)
+    {
+        return false;
+    }
+
+    // Repeat each sample until the carrier is high enough
+    uint shift = 0;
+
+    while ((shift < limits->max_shift) && ((sample_rate << shift) < limits->min_carrier))
+    {
+        ++shift;
+    }
+
+    uint32_t carrier = sample_rate << shift;
+    uint64_t clocks_16 = (uint64_t)sys_hz << 4;
+
+    for (uint div_16=16; div_16<=PWM_SOLVER_MAX_DIV_16; ++div_16)
+    {
+        // Nearest period for this divider
+        uint64_t per_period = (uint64_t)div_16 * carrier;
+        uint32_t period = (uint32_t)((clocks_16 + (per_period >> 1)) / per_period);
+
+        if (period > (limits->max_wrap + 1))
+        {
+            continue;
+        }
+
+        if (period < (limits->min_wrap + 1))
+        {
+            // Larger dividers only reduce the period
+            break;
+        }
+
+        int32_t ppm = pwmSolverError(clocks_16, div_16, period, carrier);
+
+        if (!found || (abs(ppm) < abs(sol->error_ppm)))
+        {
+            sol->sys_hz = sys_hz;
+            sol->div_16 = div_16;
+            sol->wrap = period - 1;
+            sol->shift = shift;
+            sol->carrier_hz = (uint32_t)((clocks_16 + (((uint64_t)div_16 * period) >> 1)) / ((uint64_t)div_16 * period));
+            sol->error_ppm = ppm;
+            found = true;
+        }
+
+        if ((uint32_t)abs(ppm) <= limits->good_ppm)
+        {
+            break;
+        }
+    }
+    return found && ((uint32_t)abs(sol->error_ppm) <= limits->max_ppm);
+}
+
+bool pwmSolverPickClock(uint32_t current_khz, uint32_t sample_rate, const pwm_limits* limits,
+                        uint32_t* clock_khz, pwm_solution* sol)
+{
+    bool found = pwmSolverSolve(current_khz * 1000, sample_rate, limits, sol);
+
+    *clock_khz = current_khz;
+
+    if (found && ((uint32_t)abs(sol->error_ppm) <= limits->good_ppm))
+    {
+        return true;
+    }
+
+    for (uint i=0; i<count_of(clock_candidates_khz); ++i)
+    {
+        uint vco, postdiv1, postdiv2;
+        pwm_solution candidate;
+
+        if ((clock_candidates_khz[i] == current_khz) ||
+            !check_sys_clock_khz(clock_candidates_khz[i], &vco, &postdiv1, &postdiv2))
+        {
+            continue;
+        }
+
+        if (pwmSolverSolve(clock_candidates_khz[i] * 1000, sample_rate, limits, &candidate) &&
+            (!found || ((abs(candidate.error_ppm) * PWM_SOLVER_CLOCK_GAIN) < abs(sol->error_ppm))))
+        {
+            *sol = candidate;
+            *clock_khz = clock_candidates_khz[i];
+            found = true;
+        }
+    }
+    return found;
+}
+
+// Solve every common rate, reporting the result and the cycles taken
+void pwmSolverBenchmark(uint32_t sys_hz, const pwm_limits* limits)
+{
+    static const uint32_t rates[] = {8000, 11000, 11025, 12000, 16000, 22000, 22050, 24000,
+                                     32000, 44000, 44100, 48000, 88200, 96000};
+    pwm_solution sol;
+
+    cycleCounterInit();
+
+    for (uint i=0; i<count_of(rates); ++i)
+    {
+        uint32_t start = cycleCounterRead();
+        bool ok = pwmSolverSolve(sys_hz, rates[i], limits, &sol);
+        uint32_t cycles = cycleCounterElapsed(start);
+
+        if (ok)
+        {
+            printf("pwm %u: shift %u div %u.%02u wrap %u carrier %u error %d ppm, %u cycles\n",
+                   rates[i], sol.shift, sol.div_16 >> 4, ((sol.div_16 & 0xF) * 100) >> 4, sol.wrap,
+                   sol.carrier_hz, sol.error_ppm, cycles);
+        }
+        else
+        {
+            printf("pwm %u: no solution, %u cycles\n", rates[i], cycles);
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * Calculates the PWM clock divider, wrap and sample repeat shift for any
+ * sample rate from the system clock. The divider is 8.4 fixed point, as
+ * used by the PWM hardware
+ */
+
+// Limits on the solutions that may be used
+typedef struct pwm_limits
+{
+    uint      min_wrap;                 // Lowest wrap, sets the minimum resolution
+    uint      max_wrap;                 // Highest wrap
+    uint32_t  min_carrier;              // Samples are repeated until the PWM rate reaches this
+    uint      max_shift;                // Largest repeat shift
+    uint32_t  good_ppm;                 // Largest wrap within this error is accepted
+    uint32_t  max_ppm;                  // Solutions with a larger error fail
+} pwm_limits;
+
+// A solution for one sample rate
+typedef struct pwm_solution
+{
+    uint32_t  sys_hz;                   // System clock the solution is for
+    uint      div_16;                   // Clock divider in 1/16ths
+    uint      wrap;                     // PWM wrap, period is wrap + 1 divided clocks
+    uint      shift;                    // Each sample is repeated (1 << shift) times
+    uint32_t  carrier_hz;               // Resulting PWM rate, rounded to the nearest Hz
+    int32_t   error_ppm;                // Error in sample rate, in parts per million
+} pwm_solution;
+
+// Default limits, 10 to 16 bit resolution with a carrier above 32kHz
+extern const pwm_limits pwm_default_limits;
+
+// High carrier limits, 9 to 10 bit resolution with a carrier above 160kHz
+// Samples are repeated up to 16 times, so noise shaping can recover resolution
+extern const pwm_limits pwm_high_carrier_limits;
+
+// Find the solution with the largest wrap whose error is within good_ppm, otherwise the
+// most accurate. Returns false if no solution is within max_ppm
+extern bool pwmSolverSolve(uint32_t sys_hz, uint32_t sample_rate, const pwm_limits* limits, pwm_solution* sol);
+
+// Find the achievable system clock that best fits the sample rate. current_khz is only
+// replaced when its error is above good_ppm and another clock is at least 4 times better
+extern bool pwmSolverPickClock(uint32_t current_khz, uint32_t sample_rate, const pwm_limits* limits,
+                               uint32_t* clock_khz, pwm_solution* sol);
+
+// Report the solution and solve time for common sample rates over the UART
+extern void pwmSolverBenchmark(uint32_t sys_hz, const pwm_limits* limits);
+
+// Clock divider as a float, as used by pwmChannelReconfigure
+static inline float pwmSolverDivider(const pwm_solution* sol){return (float)sol->div_16 / 16.0f;}
@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <math.h>
+#include "resampler.h"
+#include "cycle_counter.h"
+/*
+   Converts between sample rates using nearest, linear or polyphase FIR interpolation
+   Input is pushed through a short history, so conversion continues across RAM buffers
+ */
+
+#define RESAMPLER_ONE 0x10000       // One input frame in Q16
+
+static const char* quality_names[resample_qualities] = {"nearest", "linear", "fir"};
+
+// Calculate a windowed sinc filter for each phase, with the cut off below
+// the lower of the two Nyquist frequencies
+static void resamplerDesign(resampler* rs, uint32_t in_rate, uint32_t out_rate)
+{
+    const float pi = 3.14159265f;
+    const float half = RESAMPLER_TAPS / 2;
+    float cutoff = 0.45f * ((out_rate < in_rate) ? ((float)out_rate / (float)in_rate) : 1.0f);
+
+    for (int p=0; p<RESAMPLER_PHASES; ++p)
+    {
+        float frac = (float)p / RESAMPLER_PHASES;
+        float h[RESAMPLER_TAPS];
+        float sum = 0.0f;
+
+        for (int k=0; k<RESAMPLER_TAPS; ++k)
+        {
+            // Time of the tap relative to the interpolation point, which is between taps half-1 and half
+            float t = (float)(k - (half - 1)) - frac;
+            float x = 2.0f * cutoff * t;
+            float sinc = (x == 0.0f) ? 1.0f : sinf(pi * x) / (pi * x);
+            float window = 0.5f * (1.0f + cosf(pi * t / half));
+
+            h[k] = 2.0f * cutoff * sinc * window;
+            sum += h[k];
+        }
+
+        // Normalise so that each phase has unity gain at DC
+        for (int k=0; k<RESAMPLER_TAPS; ++k)
+        {
+            rs->coeffs[p][k] = (int16_t)lroundf((h[k] / sum) * 32767.0f);
+        }
+    }
+}
+
+void resamplerCreate(resampler* rs, enum resample_quality quality, uint32_t in_rate, uint32_t out_rate, uint channels)
+{
+    rs->quality = quality;
+    rs->channels = channels;
+    rs->step = (uint32_t)((((uint64_t)in_rate) << 16) / out_rate);
+    rs->phase = RESAMPLER_ONE;
+    rs->pos = 0;
+
+    for (int c=0; c<2; ++c)
+    {
+        for (int i=0; i<(2 * RESAMPLER_TAPS); ++i)
+        {
+            rs->history[c][i] = 0;
+        }
+    }
+
+    if (quality == resample_fir)
+    {
+        resamplerDesign(rs, in_rate, out_rate);
+    }
+}
+
+// Interpolate one channel at the current phase
+static inline __attribute__((always_inline)) int16_t resamplerSample(const resampler* rs, const int16_t* h, const enum resample_quality quality)
+{
+    // Newest two frames are the last entries of the history
+    int32_t a = h[RESAMPLER_TAPS - 2];
+    int32_t b = h[RESAMPLER_TAPS - 1];
+
+    if (quality == resample_nearest)
+    {
+        return (rs->phase < (RESAMPLER_ONE >> 1)) ? a : b;
+    }
+    else if (quality == resample_linear)
+    {
+        return a + (((b - a) * (int32_t)(rs->phase >> 1)) >> 15);
+    }
+    else
+    {
+        const int16_t* c = rs->coeffs[rs->phase >> (16 - RESAMPLER_PHASE_BITS)];
+        int32_t acc = 1 << 14;
+
+        for (int k=0; k<RESAMPLER_TAPS; ++k)
+        {
+            acc += c[k] * h[k];
+        }
+        acc >>= 15;
+        return (acc > INT16_MAX) ? INT16_MAX : ((acc < INT16_MIN) ? INT16_MIN : acc);
+    }
+}
+
+// Generic conversion loop. Always inlined with constant arguments, so each
+// quality and channel count has its own loop without tests on the quality
+static inline __attribute__((always_inline)) uint32_t resamplerLoop(resampler* rs, const int16_t* src, uint32_t src_frames, uint32_t* consumed,
+                                                                     int16_t* dest, uint32_t dest_frames,
+                                                                     const enum resample_quality quality, const uint channels)
+{
+    uint32_t in = 0;
+    uint32_t out = 0;
+
+    while (out < dest_frames)
+    {
+        // Move the history forward to the next output position
+        while (rs->phase >= RESAMPLER_ONE)
+        {
+            if (in == src_frames)
+            {
+                *consumed = in;
+                return out;
+            }
+
+            for (uint c=0; c<channels; ++c)
+            {
+                rs->history[c][rs->pos] = src[c];
+                rs->history[c][rs->pos + RESAMPLER_TAPS] = src[c];
+            }
+            rs->pos = (rs->pos + 1) & (RESAMPLER_TAPS - 1);
+            src += channels;
+            in++;
+            rs->phase -= RESAMPLER_ONE;
+        }
+
+        for (uint c=0; c<channels; ++c)
+        {
+            *dest++ = resamplerSample(rs, &rs->history[c][rs->pos], quality);
+        }
+        rs->phase += rs->step;
+        out++;
+    }
+    *consumed = in;
+    return out;
+}
+
+uint32_t resamplerRun(resampler* rs, const int16_t* src, uint32_t src_frames, uint32_t* consumed, int16_t* dest, uint32_t dest_frames)
+{
+    switch (rs->quality)
+    {
+        case resample_nearest:
+            return (rs->channels == 2) ? resamplerLoop(rs, src, src_frames, consumed, dest, dest_frames, resample_nearest, 2)
+                                       : resamplerLoop(rs, src, src_frames, consumed, dest, dest_frames, resample_nearest, 1);
+
+        case resample_linear:
+            return (rs->channels == 2) ? resamplerLoop(rs, src, src_frames, consumed, dest, dest_frames, resample_linear, 2)
+                                       : resamplerLoop(rs, src, src_frames, consumed, dest, dest_frames, resample_linear, 1);
+
+        default:
+            return (rs->channels == 2) ? resamplerLoop(rs, src, src_frames, consumed, dest, dest_frames, resample_fir, 2)
+                                       : resamplerLoop(rs, src, src_frames, consumed, dest, dest_frames, resample_fir, 1);
+    }
+}
+
+const char* resamplerQualityName(enum resample_quality quality)
+{
+    return (quality < resample_qualities) ? quality_names[quality] : "unknown";
+}
+
+// Time each quality converting stereo 11025Hz to 44100Hz
+// src must hold at least 2 * src_frames samples, dest 2 * dest_frames
+void resamplerBenchmark(int16_t* dest, uint32_t dest_frames, const int16_t* src, uint32_t src_frames)
+{
+    static resampler rs;
+
+    cycleCounterInit();
+
+    for (int q=0; q<resample_qualities; ++q)
+    {
+        uint32_t consumed;
+
+        resamplerCreate(&rs, q, 11025, 44100, 2);
+
+        uint32_t start = cycleCounterRead();
+        uint32_t frames = resamplerRun(&rs, src, src_frames, &consumed, dest, dest_frames);
+        uint32_t cycles = cycleCounterElapsed(start);
+
+        if (frames)
+        {
+            printf("resample %s: %.2f cycles/stereo sample\n", quality_names[q], (float)cycles / (float)frames);
+        }
+    }
+}
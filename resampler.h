@@ -0,0 +1,48 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * Fixed point sample rate converter
+ * Converts interleaved 16 bit frames at any input rate to the PWM rate.
+ * The position between input frames is held in Q16, so the ratio of the
+ * rates can be any value
+ */
+
+// Supported quality levels, in order of increasing cost
+enum resample_quality
+{
+    resample_nearest = 0,
+    resample_linear = resample_nearest + 1,
+    resample_fir = resample_linear + 1,
+    resample_qualities = resample_fir + 1
+};
+
+// Polyphase filter size
+#define RESAMPLER_TAPS 8
+#define RESAMPLER_PHASE_BITS 5
+#define RESAMPLER_PHASES (1 << RESAMPLER_PHASE_BITS)
+
+// Data for the converter
+typedef struct resampler
+{
+    enum resample_quality quality;
+    uint      channels;                         // 1 for mono, 2 for stereo
+    uint32_t  step;                             // Input frames per output frame in Q16
+    uint32_t  phase;                            // Position after the oldest interpolated frame in Q16
+    uint      pos;                              // Write position in history
+    int16_t   history[2][2 * RESAMPLER_TAPS];   // Recent input, stored twice so taps are contiguous
+    int16_t   coeffs[RESAMPLER_PHASES][RESAMPLER_TAPS];  // Q15 polyphase filter
+} resampler;
+
+// Set up the converter, and calculate the filter for the ratio of the rates
+extern void resamplerCreate(resampler* rs, enum resample_quality quality, uint32_t in_rate, uint32_t out_rate, uint channels);
+
+// Convert up to src_frames frames from src, writing up to dest_frames frames to dest
+// Returns the number of frames written, consumed is set to the number of frames read
+extern uint32_t resamplerRun(resampler* rs, const int16_t* src, uint32_t src_frames, uint32_t* consumed, int16_t* dest, uint32_t dest_frames);
+
+// Report cycles per output sample for each quality over the UART
+extern void resamplerBenchmark(int16_t* dest, uint32_t dest_frames, const int16_t* src, uint32_t src_frames);
+
+// Return a printable name for the quality
+extern const char* resamplerQualityName(enum resample_quality quality);
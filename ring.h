@@ -1,3720 +0,0 @@
-/*    File ring.wav
- *    Sample rate 11000 Hz
- */
-#define WAV_DATA_LENGTH 59400 
-
-uint16_t WAV_DATA[] = {
-    121,121,121,121,121,121,121,121,121,120,122,121,120,122,121,118,
-    121,122,119,122,124,119,120,124,118,118,125,121,118,126,122,115,
-    123,123,116,123,126,117,120,125,117,118,126,120,118,127,122,116,
-    124,123,115,124,126,117,122,126,116,119,127,119,119,128,121,116,
-    125,122,114,124,125,116,123,126,116,119,126,117,118,127,120,117,
-    126,120,114,124,123,116,124,125,115,120,125,115,118,127,119,118,
-    127,120,115,125,122,116,125,125,116,123,125,115,120,127,118,120,
-    128,120,116,126,121,116,126,124,116,124,124,115,121,126,117,121,
-    128,118,118,126,119,116,126,122,117,126,124,115,123,125,116,123,
-    128,118,120,127,118,117,127,120,117,127,122,115,124,123,114,123,
-    126,116,122,126,116,118,126,118,117,128,121,116,126,121,114,124,
-    124,115,123,126,115,119,126,115,117,127,118,116,126,120,113,125,
-    123,115,124,126,115,121,126,115,119,128,118,118,128,120,115,126,
-    122,114,125,125,115,122,125,114,119,127,117,118,128,119,116,126,
-    120,115,126,125,116,124,126,115,121,126,117,121,129,120,119,127,
-    120,117,126,124,117,126,125,116,122,124,116,121,127,119,119,126,
-    119,117,125,121,118,126,123,117,123,123,116,122,125,119,122,125,
-    118,119,124,119,119,126,122,119,124,121,117,122,123,119,123,124,
-    118,120,123,118,120,125,121,120,125,120,118,122,121,118,123,123,
-    118,122,122,117,120,123,119,121,125,120,119,123,119,118,124,122,
-    118,123,122,116,121,123,118,122,125,119,119,124,118,117,124,121,
-    118,124,122,116,122,122,116,122,125,118,120,125,117,116,125,120,
-    117,126,122,115,123,122,114,122,126,117,121,126,117,117,126,119,
-    117,128,123,116,125,123,115,124,127,117,123,128,118,119,127,119,
-    118,129,123,117,127,124,115,125,126,116,124,128,117,120,127,116,
-    117,127,120,116,127,121,114,124,122,114,123,126,115,120,125,115,
-    117,126,118,117,127,120,114,124,121,114,124,125,116,123,126,115,
-    119,126,117,119,128,120,117,126,121,115,125,124,116,125,126,115,
-    121,126,116,120,128,119,119,128,120,116,127,123,117,127,126,116,
-    124,126,115,121,128,118,121,129,118,117,127,120,116,128,123,115,
-    125,123,113,122,126,115,122,128,116,118,127,117,116,127,121,116,
-    127,123,113,124,124,114,123,128,115,120,127,115,116,128,119,116,
-    128,121,113,124,122,113,124,127,115,122,128,115,118,128,118,117,
-    130,122,116,127,123,114,126,127,116,123,128,115,119,127,117,117,
-    129,120,116,127,121,113,124,124,114,124,126,115,119,125,115,118,
-    127,119,117,127,120,114,124,122,115,124,125,116,122,125,115,119,
-    126,118,120,127,120,117,125,121,117,126,124,118,124,124,116,122,
-    125,118,122,127,119,119,125,119,117,125,121,118,125,122,116,122,
-    122,117,123,125,119,121,123,117,118,123,119,119,125,120,118,123,
-    120,117,123,123,118,123,123,117,120,123,118,120,125,120,119,124,
-    120,117,124,122,119,125,124,118,122,124,117,121,126,119,120,126,
-    119,117,124,120,117,125,124,116,122,123,115,120,125,117,120,127,
-    118,116,125,119,116,127,124,116,124,124,114,121,126,117,121,129,
-    119,118,127,119,116,128,124,117,127,125,115,123,126,116,122,129,
-    118,119,128,118,115,127,121,116,127,124,114,123,124,113,121,127,
-    116,119,127,116,116,126,119,115,127,122,114,124,123,113,122,126,
-    116,121,127,116,117,126,118,116,128,122,116,126,122,114,124,125,
-    116,124,128,117,120,128,118,119,129,121,118,128,123,116,126,124,
-    115,125,127,116,123,127,116,119,128,119,119,129,120,115,126,121,
-    114,126,125,115,124,126,114,120,126,116,119,129,118,116,127,119,
-    114,126,123,114,126,125,113,122,126,113,120,129,116,118,128,117,
-    114,127,120,114,127,124,113,124,125,112,122,128,115,120,129,116,
-    116,128,119,115,129,123,114,126,124,112,122,127,114,121,129,115,
-    117,128,117,114,128,121,114,126,123,111,122,125,113,122,128,115,
-    118,128,116,115,128,120,115,128,123,113,125,124,114,124,128,116,
-    121,128,116,118,128,119,117,129,122,115,126,123,114,125,126,116,
-    124,127,116,120,127,118,120,129,121,118,127,120,115,125,123,117,
-    125,125,116,122,125,116,121,127,119,120,126,118,117,125,120,117,
-    126,123,117,124,123,115,122,125,118,122,126,118,118,125,118,118,
-    126,122,118,125,122,115,123,123,116,123,126,117,120,125,117,118,
-    126,120,118,126,121,115,124,122,116,124,127,117,122,126,116,118,
-    126,119,118,127,121,115,125,121,114,124,125,115,123,126,114,119,
-    126,116,118,128,120,116,126,120,113,125,124,115,125,127,114,120,
-    127,115,119,130,119,117,128,120,114,127,123,114,126,127,114,122,
-    127,114,119,129,118,118,129,119,114,127,121,114,126,125,114,123,
-    125,113,120,127,116,119,129,118,116,127,119,114,127,123,115,125,
-    124,113,122,126,115,121,128,117,118,127,118,115,127,121,116,127,
-    124,114,123,124,114,122,127,116,120,127,116,116,127,119,116,128,
-    122,114,125,123,113,123,126,115,122,128,115,118,128,117,117,129,
-    121,116,128,122,113,126,125,115,125,129,115,121,128,116,119,130,
-    119,117,129,121,114,127,123,114,127,127,114,123,128,114,120,130,
-    117,119,131,119,114,128,121,113,128,126,114,125,127,112,121,129,
-    115,119,131,117,115,128,118,112,128,123,113,126,126,111,121,127,
-    113,120,130,116,117,129,117,113,128,121,113,127,125,112,123,126,
-    112,120,129,115,119,129,116,114,128,120,114,128,124,113,124,124,
-    112,122,127,115,121,129,116,117,127,118,116,129,123,116,127,123,
-    113,123,125,115,123,127,116,119,126,116,117,127,120,117,127,121,
-    115,125,122,115,125,126,117,123,126,116,120,126,118,120,128,120,
-    117,126,120,116,126,124,117,125,125,116,122,125,117,121,127,118,
-    119,125,118,116,125,121,117,126,123,115,122,123,115,122,126,117,
-    120,126,117,117,126,120,117,127,123,116,124,123,115,123,126,117,
-    122,128,117,118,127,118,117,128,122,116,126,123,113,123,125,115,
-    122,128,115,118,127,116,116,128,120,116,128,122,113,125,124,114,
-    124,128,115,121,128,115,117,129,119,117,130,122,114,127,124,113,
-    125,127,115,122,128,114,118,128,117,117,129,120,115,127,121,112,
-    124,124,113,123,126,113,119,126,114,117,128,118,116,126,119,113,
-    125,122,114,125,125,114,122,126,115,120,129,118,119,128,119,116,
-    126,121,115,127,125,115,124,125,114,121,127,117,120,129,118,117,
-    127,119,115,128,123,115,126,124,113,123,126,114,122,129,116,119,
-    128,117,116,128,121,115,128,123,112,124,124,112,123,128,115,121,
-    129,115,117,130,119,116,130,122,114,127,123,112,125,128,114,123,
-    129,114,119,130,116,117,131,120,114,129,122,111,126,125,113,125,
-    129,113,120,129,114,117,131,118,116,130,120,112,127,124,112,126,
-    128,113,122,128,113,118,130,117,117,131,119,113,128,122,112,127,
-    126,113,124,127,112,119,129,115,118,130,118,115,128,120,113,127,
-    124,114,125,126,113,121,127,114,119,129,117,117,128,118,114,127,
-    122,115,127,124,113,122,124,113,121,127,116,120,127,117,117,127,
-    119,117,127,122,116,125,123,115,124,126,117,123,127,116,119,126,
-    117,118,127,120,118,126,120,115,124,123,116,124,125,116,121,124,
-    115,119,126,118,119,126,119,116,125,121,116,125,124,116,123,124,
-    114,120,126,117,120,127,118,117,126,120,116,127,124,116,126,125,
-    115,122,126,116,121,129,118,118,128,119,116,128,122,115,127,125,
-    114,123,125,114,121,129,117,119,128,117,115,128,120,115,128,124,
-    113,124,125,113,122,128,116,121,129,116,116,128,119,116,129,123,
-    114,127,124,113,124,127,115,122,129,116,118,128,117,116,129,121,
-    115,127,122,113,124,125,114,123,127,115,120,127,115,116,128,119,
-    116,128,121,114,125,122,113,124,126,115,122,127,115,119,128,118,
-    119,129,120,116,126,121,114,126,125,115,125,126,115,121,127,116,
-    119,129,118,117,128,119,114,126,122,114,126,125,113,122,125,112,
-    119,128,116,118,128,117,114,127,120,114,128,124,113,125,125,112,
-    123,129,115,121,130,116,117,129,118,115,130,123,114,128,125,112,
-    124,127,113,122,130,115,118,130,116,115,130,120,114,129,123,112,
-    126,126,112,124,129,114,120,130,115,116,130,119,115,131,122,113,
-    127,124,111,125,128,114,122,130,114,117,130,117,115,130,120,113,
-    127,122,111,125,126,113,123,128,113,119,128,115,117,130,119,115,
-    128,121,112,126,124,114,125,127,114,121,128,115,119,129,118,118,
-    129,120,115,127,122,114,126,125,114,123,125,113,120,126,115,119,
-    128,117,116,126,118,115,126,121,115,125,123,114,122,124,115,122,
-    127,117,120,127,117,118,127,120,118,127,122,116,125,123,116,124,
-    126,117,123,127,117,120,127,119,119,128,121,117,126,122,115,125,
-    125,116,124,126,115,120,126,116,119,128,120,117,127,120,114,126,
-    124,115,125,127,115,122,127,115,119,129,118,118,129,120,114,126,
-    122,113,125,125,113,122,125,113,119,128,116,118,129,118,115,127,
-    120,113,127,124,114,125,126,113,121,127,115,120,130,118,117,128,
-    119,114,128,123,115,127,125,113,123,126,113,120,128,116,118,128,
-    117,114,127,120,115,127,123,114,124,124,113,122,127,116,120,128,
-    117,117,127,119,116,128,122,115,125,123,114,123,125,115,122,127,
-    116,119,127,117,117,128,121,117,127,122,114,125,124,115,124,127,
-    116,122,127,116,119,129,119,118,129,120,115,126,122,114,126,126,
-    114,123,127,113,119,128,116,118,130,118,115,128,120,113,127,125,
-    114,126,126,112,121,128,114,120,131,117,117,130,119,114,129,123,
-    114,128,126,112,123,127,112,120,130,115,117,130,116,114,129,120,
-    113,128,124,112,125,126,111,122,129,114,120,130,116,115,129,118,
-    113,130,123,113,127,125,111,123,128,113,121,130,115,117,129,117,
-    114,129,121,114,128,123,112,124,126,112,122,129,114,119,128,115,
-    116,128,119,115,129,122,114,126,124,113,124,128,115,122,128,116,
-    119,129,118,118,129,121,116,127,122,114,125,125,116,124,126,115,
-    121,126,116,120,128,119,118,127,119,115,126,122,115,125,124,115,
-    123,124,115,121,126,117,120,127,117,117,126,119,117,127,123,116,
-    125,123,114,122,125,116,122,127,117,119,126,118,117,128,121,117,
-    126,122,115,124,124,115,123,127,116,120,127,116,117,128,120,117,
-    128,122,114,125,123,114,124,127,115,121,127,115,117,127,118,117,
-    129,121,115,127,123,114,125,126,115,123,127,114,119,128,116,118,
-    129,120,116,128,121,113,126,124,114,124,126,114,120,127,115,119,
-    129,118,117,129,119,114,126,122,114,126,125,113,122,126,113,120,
-    127,116,118,128,118,115,126,120,114,126,123,115,124,124,113,121,
-    126,116,120,128,117,117,127,118,115,126,122,116,125,123,114,123,
-    125,115,122,128,117,120,127,118,117,127,121,117,127,123,115,124,
-    124,114,123,127,116,121,127,116,118,127,118,117,129,122,115,127,
-    123,114,125,127,115,124,129,115,120,129,117,119,131,121,117,130,
-    122,113,127,125,113,125,128,113,121,128,114,118,130,117,116,130,
-    119,112,127,122,111,126,126,112,122,127,112,119,129,115,117,130,
-    118,113,128,120,111,127,125,112,125,127,111,121,129,114,119,131,
-    118,116,130,120,113,129,124,114,127,127,112,123,128,113,120,130,
-    117,117,129,118,114,128,121,113,127,124,112,123,125,112,121,128,
-    115,119,129,117,116,128,120,115,128,123,114,125,124,113,122,127,
-    115,122,128,116,118,127,118,117,129,121,117,127,123,115,125,125,
-    116,125,128,117,122,127,117,119,128,119,119,128,120,116,125,121,
-    115,125,124,116,123,124,115,120,125,117,120,127,119,117,126,119,
-    115,125,122,116,124,123,114,121,124,115,120,126,117,118,125,117,
-    115,125,120,115,126,123,114,123,124,114,122,127,116,120,128,117,
-    116,127,120,116,128,123,115,125,124,114,123,127,116,122,129,117,
-    118,128,118,116,129,122,115,127,123,113,124,126,115,123,128,116,
-    119,128,117,117,128,120,115,128,122,113,125,124,114,124,127,115,
-    121,128,116,118,128,119,117,128,121,115,126,122,114,125,126,115,
-    123,127,115,119,127,117,118,128,120,116,126,121,114,125,124,116,
-    125,126,115,121,126,116,120,128,119,118,127,120,116,126,122,116,
-    126,125,116,123,125,116,121,127,118,120,127,118,117,126,120,116,
-    127,123,115,125,124,114,122,126,116,121,128,117,118,127,118,116,
-    128,121,115,127,123,113,123,125,113,122,128,115,119,128,115,116,
-    128,119,115,128,122,112,125,124,112,124,128,114,121,129,114,117,
-    129,117,115,130,121,113,127,123,111,125,127,113,123,129,113,118,
-    129,116,117,131,120,114,129,122,112,127,126,113,125,129,114,121,
-    129,115,118,131,119,116,130,121,113,127,123,113,126,127,113,122,
-    128,113,118,129,117,117,130,120,114,127,122,113,126,126,114,124,
-    127,113,120,128,116,119,129,118,116,127,119,114,126,123,115,125,
-    124,113,121,125,115,121,128,117,119,127,118,116,127,120,116,126,
-    122,115,123,123,114,122,126,116,121,126,117,118,126,119,118,127,
-    121,117,125,122,115,124,125,117,124,126,117,121,126,118,120,127,
-    120,118,127,120,115,125,122,116,125,125,115,122,125,115,120,127,
-    118,119,127,119,116,126,121,115,125,124,115,123,125,114,120,127,
-    117,119,128,119,117,127,120,115,126,123,115,125,125,114,122,126,
-    115,120,129,118,118,128,118,115,127,122,115,126,124,114,123,125,
-    114,121,128,117,120,128,118,116,127,120,116,128,123,115,125,124,
-    114,122,127,116,121,128,116,117,127,118,116,127,121,116,126,123,
-    114,123,125,116,123,127,117,120,127,118,118,128,121,117,126,122,
-    115,124,123,115,123,125,116,121,125,116,118,126,119,118,127,121,
-    116,125,122,116,125,125,116,123,125,116,120,126,118,119,128,119,
-    117,126,120,115,126,124,116,125,125,115,121,125,115,120,128,118,
-    118,127,118,115,127,121,115,126,124,113,123,125,113,121,128,116,
-    118,128,116,115,127,119,114,128,123,113,125,125,112,122,127,114,
-    121,129,115,117,129,118,115,129,122,114,127,124,112,124,127,114,
-    123,129,115,119,129,116,116,129,120,115,128,123,112,125,125,112,
-    123,128,115,121,129,116,117,129,119,116,130,123,114,126,124,113,
-    125,127,115,122,128,115,118,129,118,118,130,121,116,127,123,114,
-    125,125,115,124,127,115,120,127,116,118,128,119,117,128,121,115,
-    126,123,115,125,126,115,122,125,115,120,127,118,119,127,119,117,
-    126,120,116,126,123,116,124,124,115,122,125,117,121,127,117,118,
-    125,118,117,126,121,117,126,122,115,123,123,115,122,125,117,120,
-    125,116,118,125,119,117,126,120,115,123,121,114,123,124,116,122,
-    125,116,119,126,118,118,127,120,116,125,121,115,124,124,116,124,
-    126,116,120,126,117,119,128,120,117,126,120,114,125,123,115,125,
-    126,115,121,126,115,119,128,118,118,128,120,115,126,122,115,125,
-    125,115,123,125,114,120,127,117,119,128,119,116,126,120,115,126,
-    123,115,125,125,114,121,126,116,121,128,118,119,127,119,117,127,
-    122,117,126,124,116,123,125,116,122,127,118,121,127,118,118,126,
-    120,118,126,122,116,124,123,116,122,125,117,121,126,117,118,125,
-    118,118,126,121,117,124,121,115,123,124,116,122,125,116,120,125,
-    117,119,127,120,118,126,120,115,124,122,115,124,125,115,121,125,
-    115,119,127,118,118,127,119,115,126,121,114,125,124,114,123,126,
-    114,121,128,116,119,129,119,116,127,120,115,127,124,115,126,126,
-    114,122,127,115,120,130,118,118,129,119,115,128,122,115,127,125,
-    114,123,126,114,121,129,117,119,129,118,116,128,121,115,128,124,
-    114,125,125,113,122,128,116,120,129,117,116,127,119,115,128,123,
-    115,125,124,113,122,126,115,121,128,117,118,127,118,116,127,121,
-    116,127,123,114,123,124,115,123,127,117,121,127,117,118,127,120,
-    118,127,122,116,125,122,115,124,125,117,122,125,116,119,126,118,
-    119,127,119,117,125,120,115,124,122,116,124,124,116,121,124,116,
-    121,126,118,119,125,118,116,124,120,116,125,122,116,122,122,114,
-    121,124,117,120,125,117,118,125,119,117,127,122,117,126,124,116,
-    124,126,118,123,127,118,120,126,118,118,127,121,117,126,123,115,
-    123,124,115,122,126,116,120,126,117,117,126,120,117,127,122,115,
-    124,123,115,123,126,116,121,126,116,118,126,118,118,127,121,116,
-    125,122,115,124,125,116,123,126,117,120,127,118,120,128,121,118,
-    127,121,116,125,123,116,124,125,116,121,124,116,119,126,118,118,
-    125,119,116,125,121,117,125,124,117,123,124,116,121,125,118,120,
-    126,119,118,125,120,117,125,122,117,124,123,116,121,124,117,121,
-    125,118,119,124,118,117,125,121,118,125,122,116,123,123,117,123,
-    126,118,121,126,118,118,126,120,118,127,122,116,124,123,115,123,
-    125,116,122,126,116,118,126,118,118,128,121,116,126,121,114,124,
-    124,116,124,127,116,120,127,117,119,129,120,117,128,121,115,126,
-    124,115,125,126,115,122,127,116,119,128,118,118,128,119,115,126,
-    122,114,125,125,115,122,125,114,119,127,117,118,128,119,115,126,
-    120,114,126,124,115,123,125,114,120,125,115,119,127,118,117,126,
-    119,115,125,122,116,125,125,115,122,125,116,121,127,118,120,127,
-    119,117,126,121,116,126,123,116,123,123,115,121,125,117,120,126,
-    117,118,125,119,117,126,122,117,125,123,116,123,125,118,123,126,
-    118,120,125,118,119,126,121,119,126,122,117,124,123,117,124,125,
-    118,122,125,117,120,126,119,120,127,120,118,125,121,117,125,123,
-    118,124,124,116,121,125,118,121,127,119,119,126,120,117,125,122,
-    117,125,124,116,122,124,116,121,126,118,118,125,118,116,125,120,
-    116,125,123,115,122,123,115,121,125,117,120,126,118,117,125,119,
-    116,125,122,115,123,122,114,121,125,116,121,126,117,118,126,119,
-    117,126,121,117,125,122,115,123,124,117,123,126,117,120,125,117,
-    118,126,120,118,126,122,116,124,123,117,124,125,117,122,125,117,
-    119,125,119,119,126,121,117,124,121,117,124,123,118,123,124,117,
-    121,124,119,120,126,120,119,125,120,118,124,122,118,124,123,117,
-    121,123,118,121,125,119,120,125,119,117,124,121,118,124,122,117,
-    123,123,117,122,125,118,121,126,119,119,125,120,118,126,122,117,
-    124,123,116,122,125,117,122,127,118,119,125,118,117,126,121,117,
-    125,122,115,123,124,116,123,126,116,120,126,117,117,126,119,117,
-    127,121,115,124,123,114,123,125,115,121,126,115,118,126,118,117,
-    127,121,116,125,122,114,124,125,116,123,126,116,120,126,118,118,
-    127,120,117,126,121,115,124,123,116,124,126,116,121,125,117,119,
-    126,120,119,126,121,117,125,123,117,125,125,118,123,125,117,121,
-    126,119,120,127,120,118,125,121,117,125,124,117,123,124,116,121,
-    124,117,120,125,119,119,125,119,117,125,122,118,125,123,117,122,
-    123,117,122,125,118,120,124,118,118,124,119,118,125,121,117,123,
-    121,116,122,123,117,121,124,117,119,124,118,119,125,120,118,124,
-    120,116,123,123,118,123,124,117,121,124,117,120,126,120,119,126,
-    121,118,125,123,118,125,125,118,123,125,117,121,126,119,120,127,
-    120,117,125,121,117,125,124,117,123,124,116,120,125,118,120,126,
-    119,117,124,119,116,124,122,117,123,123,116,121,124,117,121,126,
-    119,119,125,119,117,125,122,118,125,123,117,123,124,117,122,126,
-    119,121,125,119,118,125,120,119,125,122,118,123,122,116,122,123,
-    118,121,124,118,119,123,118,118,124,120,118,123,120,117,122,122,
-    118,122,123,118,120,123,118,119,124,120,119,124,120,117,122,121,
-    118,123,123,119,122,123,118,121,125,120,121,126,121,120,125,122,
-    119,125,123,119,124,124,118,121,125,119,121,126,120,120,125,120,
-    118,125,123,118,124,124,117,122,123,117,121,125,118,120,125,118,
-    117,124,120,116,125,122,116,123,123,116,121,125,117,120,126,118,
-    118,125,119,117,126,122,116,124,123,115,122,124,117,121,126,117,
-    118,125,118,117,126,121,117,125,122,116,123,124,117,123,126,118,
-    121,126,119,119,126,121,118,126,122,117,123,123,117,123,125,118,
-    121,125,118,119,124,120,119,125,121,117,123,121,117,123,124,118,
-    122,124,118,120,124,119,120,125,120,119,124,121,117,123,122,118,
-    123,123,117,120,123,117,120,124,119,119,124,119,117,123,120,118,
-    124,123,118,123,123,118,122,125,119,121,125,119,119,124,120,118,
-    125,122,119,124,122,117,122,123,118,122,125,119,120,124,119,119,
-    125,121,119,125,122,118,123,122,117,123,125,118,122,125,118,120,
-    125,120,120,126,121,118,123,122,117,123,124,118,122,125,118,120,
-    124,119,119,125,121,118,124,121,116,123,123,117,122,124,117,119,
-    124,118,119,125,120,118,124,121,117,123,122,118,123,124,118,121,
-    123,117,119,124,119,119,124,120,117,123,121,118,123,123,118,122,
-    123,118,120,123,119,120,124,120,119,123,120,119,123,122,119,123,
-    122,118,121,122,119,122,124,120,121,123,120,120,123,121,120,123,
-    122,120,122,121,119,122,123,120,122,123,119,120,123,121,121,124,
-    122,120,123,121,119,122,122,120,122,123,119,121,123,119,120,123,
-    120,120,123,120,118,122,122,120,123,123,119,121,123,119,121,124,
-    120,120,124,120,118,123,121,118,123,123,118,122,123,117,120,124,
-    119,120,125,120,119,124,121,118,124,123,118,123,123,117,121,124,
-    118,121,125,119,119,124,119,117,124,122,118,124,123,117,122,124,
-    118,121,125,119,120,125,119,118,124,121,118,124,122,117,122,123,
-    117,121,124,119,120,124,119,118,123,120,118,124,122,118,122,122,
-    117,121,123,118,121,124,119,119,123,119,119,123,121,118,123,122,
-    118,122,123,119,122,124,119,120,123,119,119,124,121,120,124,121,
-    118,123,122,119,123,124,119,122,123,119,120,124,120,121,125,121,
-    119,123,121,118,123,122,118,122,122,117,120,122,118,120,124,119,
-    119,123,119,117,123,121,118,123,122,118,121,122,118,121,124,119,
-    121,124,119,118,123,120,119,124,122,118,122,122,118,122,125,119,
-    122,125,119,120,124,120,120,125,122,119,124,122,118,122,123,119,
-    122,125,119,120,124,119,119,124,121,118,123,121,117,122,122,118,
-    122,124,119,120,124,119,119,124,121,119,124,122,118,123,122,118,
-    123,124,120,122,124,119,120,124,120,120,124,122,119,123,121,119,
-    122,123,120,122,123,119,120,123,119,120,123,121,120,123,121,119,
-    122,122,120,123,123,120,121,122,119,121,123,121,121,123,120,119,
-    121,120,119,122,121,119,121,120,118,121,121,120,121,122,119,120,
-    121,119,120,122,121,120,122,121,119,121,122,119,122,123,120,121,
-    122,119,120,123,120,120,123,121,119,122,121,119,122,123,120,122,
-    123,119,120,123,120,120,124,121,119,122,120,118,122,122,119,122,
-    123,118,120,123,119,120,125,121,120,124,121,119,123,123,119,124,
-    124,119,121,123,119,121,124,120,120,124,120,118,123,121,118,123,
-    123,118,121,123,118,120,124,120,120,124,120,119,123,121,119,124,
-    123,119,122,122,118,121,123,119,120,123,120,119,122,120,118,122,
-    121,119,122,122,119,121,122,119,121,124,120,120,123,120,119,122,
-    121,120,123,122,119,121,122,119,122,124,121,122,123,120,121,123,
-    121,121,124,122,120,123,122,119,122,123,120,122,123,119,120,122,
-    119,120,124,121,120,123,120,118,122,121,119,123,123,119,121,122,
-    119,121,124,121,121,124,120,119,123,121,119,123,123,119,122,122,
-    118,120,123,119,121,124,120,119,123,120,119,123,122,119,123,123,
-    118,121,123,119,121,124,119,119,122,119,118,122,121,118,122,121,
-    117,120,121,117,120,123,119,120,122,119,118,122,120,119,123,122,
-    118,121,121,118,121,123,120,121,124,120,120,123,121,120,124,123,
-    120,123,122,119,122,123,120,122,124,120,120,123,121,120,124,123,
-    121,124,123,120,123,123,121,123,124,121,122,123,120,121,123,121,
-    121,123,121,120,121,121,119,122,122,120,121,121,119,120,121,120,
-    121,122,120,120,121,120,120,122,122,120,122,122,120,121,121,120,
-    121,123,120,121,122,120,119,122,120,120,122,121,119,121,121,119,
-    121,122,120,121,122,119,120,122,121,120,123,122,120,122,121,119,
-    122,122,120,122,123,120,121,123,121,121,124,122,121,123,121,119,
-    122,122,120,123,123,120,121,123,120,120,123,121,120,123,121,119,
-    121,120,118,121,122,119,121,122,118,119,122,120,120,123,120,119,
-    121,120,118,121,122,119,121,122,118,120,121,119,120,123,121,120,
-    122,120,119,122,122,120,123,123,120,121,122,120,121,123,122,122,
-    123,121,120,122,122,121,123,123,121,122,122,120,122,123,121,122,
-    123,121,121,122,121,121,123,122,121,122,121,120,121,122,120,122,
-    123,121,121,122,120,120,123,121,121,123,121,119,121,121,119,122,
-    122,120,121,122,119,120,122,120,120,123,121,119,121,121,119,122,
-    122,120,122,122,119,120,122,120,120,123,121,120,122,120,119,122,
-    122,120,122,123,119,121,122,120,121,123,121,120,123,121,119,122,
-    122,120,122,122,119,121,122,119,121,123,120,120,122,120,119,121,
-    120,119,122,122,120,121,121,119,120,122,120,121,122,120,119,121,
-    120,119,122,122,120,122,121,119,120,121,120,121,122,120,120,121,
-    120,120,122,121,120,122,122,120,121,122,121,122,123,122,122,123,
-    121,121,123,122,121,123,122,120,122,121,120,122,123,121,122,122,
-    120,121,121,120,121,122,121,120,122,120,119,121,122,121,122,122,
-    120,121,122,120,121,123,121,121,123,121,120,122,121,121,123,122,
-    120,121,122,120,121,122,121,121,123,120,120,121,120,119,122,121,
-    120,121,120,119,120,121,120,121,122,120,120,121,120,120,122,122,
-    121,123,122,120,122,122,121,122,123,122,122,123,121,120,122,122,
-    121,123,122,120,121,121,119,121,122,120,120,121,119,119,121,120,
-    120,122,121,119,120,120,119,121,121,120,121,122,120,120,121,120,
-    121,123,122,121,122,121,120,122,122,121,123,123,122,122,122,121,
-    122,123,123,122,123,122,121,122,122,122,123,123,122,122,122,120,
-    121,122,121,122,122,121,120,121,120,120,121,121,120,121,120,119,
-    120,120,120,121,121,120,120,120,119,119,120,120,120,121,120,120,
-    121,120,120,121,121,120,121,121,120,120,121,121,121,123,122,121,
-    122,121,120,122,122,121,122,122,120,120,121,120,121,122,121,121,
-    122,121,120,121,122,121,122,122,120,121,121,120,121,122,122,121,
-    122,121,120,121,121,121,122,122,121,122,122,120,121,122,121,121,
-    122,121,120,121,121,120,122,122,121,122,121,120,121,121,121,121,
-    122,121,121,121,121,120,122,122,121,122,121,120,121,121,120,121,
-    122,121,121,121,120,120,121,121,121,122,121,120,120,120,120,121,
-    122,121,121,122,120,120,121,121,121,122,122,121,121,121,120,121,
-    122,121,122,122,120,121,121,120,120,122,121,121,122,121,120,121,
-    121,121,122,122,121,122,122,120,121,122,121,122,122,121,120,121,
-    121,120,122,122,121,121,121,119,120,121,120,121,122,120,120,121,
-    120,119,121,121,120,122,121,120,120,121,120,121,122,121,121,122,
-    120,120,122,121,121,122,122,121,121,121,121,122,122,122,121,122,
-    121,120,121,121,121,122,122,121,121,121,121,122,122,121,122,122,
-    121,121,121,121,121,122,122,121,121,120,120,121,121,121,121,121,
-    120,120,121,120,120,121,121,121,121,120,120,121,121,121,122,122,
-    121,121,121,120,120,121,121,121,122,121,120,121,121,120,122,122,
-    121,122,121,120,121,122,121,122,123,121,121,122,121,120,122,122,
-    121,122,122,120,121,121,120,122,122,121,121,122,120,120,121,121,
-    121,122,121,120,121,121,120,121,122,121,122,122,120,120,121,120,
-    120,122,121,120,121,120,120,121,121,120,122,122,120,120,121,120,
-    120,122,121,121,122,120,120,121,121,120,122,122,121,121,121,120,
-    121,122,121,121,122,121,120,121,121,120,122,122,121,122,122,121,
-    121,122,121,122,123,121,121,122,121,121,122,122,121,122,122,120,
-    121,121,121,122,122,121,121,122,120,120,121,121,121,122,121,120,
-    121,120,119,121,121,120,121,121,120,120,121,120,120,122,121,120,
-    121,120,119,121,121,120,121,121,120,120,121,120,120,122,121,121,
-    122,120,120,121,121,121,122,122,120,121,121,120,121,122,122,122,
-    123,121,121,122,121,121,123,123,122,123,122,121,122,122,121,122,
-    122,121,121,121,120,120,122,122,121,122,121,120,121,121,120,121,
-    122,120,121,121,120,120,121,120,120,122,121,120,121,120,119,121,
-    121,120,121,121,120,120,121,120,121,122,121,120,121,120,120,121,
-    121,121,122,122,120,121,121,120,121,122,121,121,122,120,120,121,
-    121,120,122,121,120,121,121,120,121,122,120,121,122,120,120,121,
-    120,121,123,122,121,122,122,120,122,122,121,122,123,121,121,122,
-    121,121,123,122,121,123,121,120,121,121,120,122,122,120,121,121,
-    120,120,122,121,121,123,122,120,122,121,120,122,122,121,122,122,
-    120,120,122,120,121,122,121,120,121,120,119,121,121,120,121,121,
-    119,120,121,119,121,122,121,121,122,120,120,122,121,121,122,122,
-    120,121,121,120,121,123,121,122,122,120,120,122,121,120,122,121,
-    120,121,121,119,121,122,120,121,122,120,120,121,120,120,122,121,
-    120,122,121,120,122,122,120,122,122,120,121,122,120,121,122,121,
-    121,123,121,120,121,121,120,122,122,121,122,122,120,120,122,120,
-    121,123,121,120,122,121,120,122,122,121,122,122,120,120,121,119,
-    120,122,120,120,121,119,119,121,120,119,121,121,119,120,120,119,
-    121,122,121,121,122,121,121,122,121,121,123,122,121,122,122,120,
-    122,122,121,122,123,120,121,122,121,121,123,122,121,122,121,120,
-    121,121,120,122,123,121,121,122,120,121,122,121,121,122,121,120,
-    121,121,120,122,122,120,121,122,119,120,122,120,121,123,121,120,
-    121,120,119,122,122,120,121,121,119,120,122,120,121,123,121,121,
-    123,121,120,123,122,121,123,122,120,121,122,120,121,122,120,120,
-    122,120,119,121,120,119,122,122,120,121,121,119,121,122,120,121,
-    122,120,120,122,120,120,123,122,120,122,121,120,121,122,121,122,
-    123,121,121,122,121,121,123,122,121,123,122,120,122,122,120,122,
-    123,120,121,122,120,120,122,120,120,122,121,119,121,121,119,122,
-    122,120,121,122,120,120,122,120,121,123,121,120,122,120,119,122,
-    122,120,122,122,119,121,122,119,121,123,121,120,122,120,120,122,
-    121,120,123,122,120,121,122,119,121,123,121,121,123,120,120,122,
-    121,120,123,122,120,122,122,119,121,122,120,121,123,120,120,122,
-    120,119,123,121,119,122,121,119,121,122,119,121,123,120,121,123,
-    120,120,123,121,120,123,121,119,122,121,119,121,122,120,121,122,
-    119,119,122,120,120,123,121,119,122,121,119,122,122,120,122,123,
-    119,120,122,120,120,123,121,120,123,121,119,122,122,120,123,123,
-    120,121,123,120,121,124,121,121,124,121,120,123,122,120,123,123,
-    120,122,123,119,121,123,120,121,124,120,119,122,120,119,122,122,
-    119,122,122,118,121,122,119,121,123,120,120,122,120,119,123,121,
-    120,123,122,119,121,122,119,122,123,120,121,123,119,119,123,121,
-    120,123,121,119,122,122,119,122,123,120,121,123,119,120,123,120,
-    120,124,121,120,123,122,119,122,123,120,122,123,120,121,123,120,
-    121,124,121,120,123,121,119,122,122,119,122,123,120,121,123,120,
-    121,123,120,120,123,120,118,122,121,119,122,122,119,121,122,119,
-    121,123,120,121,123,120,119,122,120,119,122,122,120,122,122,119,
-    121,122,119,121,123,120,120,122,120,120,123,121,120,123,122,120,
-    122,121,119,122,122,120,121,122,120,120,122,120,120,123,121,120,
-    122,120,119,121,122,119,121,122,119,120,122,120,120,123,120,120,
-    122,120,119,122,121,119,122,122,119,121,122,119,120,123,120,120,
-    123,121,119,123,122,120,123,123,120,122,123,119,121,123,120,121,
-    124,121,120,123,121,120,123,123,120,122,123,119,121,123,120,121,
-    124,121,120,123,121,120,123,122,120,123,122,119,121,122,119,121,
-    124,120,120,123,120,119,122,121,119,123,122,119,122,122,118,121,
-    123,120,121,124,120,120,123,121,120,124,122,120,123,122,119,122,
-    123,120,122,124,120,120,123,120,120,124,121,119,123,121,118,121,
-    121,118,121,122,119,120,122,118,119,122,120,119,122,120,118,121,
-    120,118,121,121,118,120,121,117,119,122,119,120,123,120,118,122,
-    120,118,122,122,119,122,123,118,121,123,119,121,124,120,120,123,
-    120,119,124,122,120,124,124,120,123,124,120,122,125,121,122,125,
-    121,120,124,121,119,124,122,119,122,122,118,121,124,119,121,124,
-    120,120,124,120,119,124,122,119,123,122,117,121,123,118,121,124,
-    119,120,123,119,119,124,121,119,124,122,118,122,122,118,122,124,
-    119,121,123,119,119,124,120,119,124,121,118,122,121,118,122,123,
-    119,121,123,119,120,123,119,119,123,120,118,122,120,118,122,122,
-    119,122,123,119,120,123,119,120,124,120,120,123,120,119,123,122,
-    119,123,123,119,122,123,119,121,124,120,121,123,120,119,123,121,
-    120,124,122,120,123,122,119,122,123,120,122,124,120,121,123,120,
-    120,124,122,120,123,122,119,122,122,119,122,123,119,121,122,119,
-    119,123,120,119,123,121,118,122,121,118,122,123,119,121,123,119,
-    120,124,120,120,124,121,119,123,121,118,122,123,119,122,123,119,
-    120,123,119,120,124,120,119,123,120,118,122,122,119,122,123,118,
-    120,122,118,120,123,120,119,123,120,118,123,121,118,122,122,118,
-    121,122,118,121,124,120,120,124,120,119,123,121,119,124,123,119,
-    123,123,119,122,124,120,121,124,120,120,123,120,119,123,121,119,
-    123,122,118,121,122,118,121,123,119,120,123,119,119,123,120,119,
-    123,121,118,122,121,118,122,123,119,121,123,119,119,123,120,120,
-    124,121,119,123,122,119,123,123,119,123,124,120,121,124,120,120,
-    125,121,120,124,121,118,123,122,119,123,123,119,121,124,119,120,
-    124,120,120,125,121,118,123,121,118,123,123,118,122,123,118,120,
-    124,119,120,124,120,118,123,120,118,124,122,118,123,123,117,121,
-    124,118,121,125,119,119,124,120,118,124,122,118,124,123,117,122,
-    123,118,121,125,119,120,124,119,118,124,121,119,124,123,118,123,
-    123,118,122,124,119,121,124,119,119,124,120,119,124,122,118,123,
-    122,117,122,123,118,122,124,119,120,124,119,119,124,121,119,124,
-    121,117,122,123,118,122,124,118,121,123,118,119,124,120,119,124,
-    120,118,123,121,118,123,123,118,122,123,118,120,123,119,120,124,
-    120,119,123,120,118,123,122,119,123,122,118,121,123,119,121,124,
-    120,120,124,120,119,123,121,119,124,122,119,122,122,118,122,124,
-    119,121,124,119,119,124,121,119,124,122,119,123,122,118,122,123,
-    119,121,124,119,120,124,120,119,124,122,119,123,122,118,122,123,
-    119,122,124,119,121,124,119,119,124,121,119,124,121,117,122,122,
-    118,122,124,119,121,124,119,120,124,120,119,124,121,118,123,122,
-    118,123,123,119,122,124,119,121,124,120,121,125,121,120,124,121,
-    118,123,122,119,123,123,118,121,123,119,121,124,120,120,124,120,
-    118,123,121,119,123,122,118,121,122,118,121,123,119,120,123,119,
-    119,123,120,119,123,122,119,122,122,118,121,123,119,121,124,119,
-    120,123,119,119,124,121,119,124,122,118,122,122,118,122,123,118,
-    120,123,118,119,123,120,119,124,121,117,122,121,117,122,123,118,
-    121,123,117,119,124,119,119,125,120,118,123,121,117,123,123,117,
-    122,124,117,120,124,118,120,125,120,119,125,121,118,124,123,118,
-    124,124,118,121,124,118,120,125,120,119,125,120,117,124,121,117,
-    124,124,118,122,124,117,121,125,119,120,125,120,118,124,121,117,
-    124,123,118,123,123,117,122,125,119,121,125,120,119,125,120,118,
-    124,122,119,124,123,118,122,124,118,122,125,119,121,125,120,119,
-    125,121,119,125,123,118,123,123,118,122,124,119,121,125,119,119,
-    124,120,119,125,121,119,124,122,117,122,123,118,122,124,118,120,
-    123,118,119,124,120,119,124,120,117,123,122,118,123,123,118,122,
-    123,118,120,124,119,120,124,120,118,123,121,118,123,122,118,122,
-    122,117,120,123,118,120,124,119,118,124,120,118,124,122,118,123,
-    123,117,121,123,118,121,125,119,119,124,119,118,124,121,118,123,
-    122,117,121,122,117,121,124,118,120,124,119,118,124,121,119,124,
-    122,118,123,123,118,122,124,119,121,125,119,120,124,120,119,124,
-    121,118,123,122,118,123,123,118,122,124,119,121,124,119,120,125,
-    121,119,124,121,118,123,122,118,123,123,119,121,123,118,120,124,
-    120,120,124,120,119,123,121,118,123,123,119,123,123,118,121,123,
-    119,121,124,120,120,124,120,118,124,122,119,123,123,118,122,123,
-    118,121,124,119,120,124,120,119,124,121,119,124,122,118,123,123,
-    118,122,124,119,121,125,119,119,124,120,119,125,121,118,124,122,
-    117,122,123,118,122,124,118,119,124,119,118,125,120,118,124,122,
-    117,123,123,117,122,125,118,121,125,118,118,125,120,119,125,121,
-    117,124,122,117,123,124,117,121,124,117,119,125,119,119,126,121,
-    118,124,122,117,123,123,117,122,124,117,120,125,119,120,126,120,
-    119,125,121,117,123,122,117,122,123,117,120,124,117,119,124,119,
-    118,124,119,117,123,121,117,123,123,117,122,123,117,121,125,119,
-    121,126,120,119,125,121,118,125,123,118,123,123,117,121,123,118,
-    121,124,119,119,124,119,118,124,121,118,124,122,117,123,123,118,
-    122,125,119,121,124,118,119,124,120,119,124,121,118,123,122,117,
-    123,124,118,122,124,118,120,124,119,120,125,120,118,124,121,118,
-    123,123,118,123,124,118,121,125,119,120,126,120,119,125,121,118,
-    124,123,118,124,124,118,122,124,118,121,125,120,120,126,120,118,
-    124,121,117,124,123,117,122,123,117,120,124,118,119,125,119,118,
-    124,120,117,123,122,117,122,122,116,121,123,117,120,124,118,119,
-    124,119,117,124,120,117,123,122,117,122,123,118,122,124,119,121,
-    124,119,119,124,121,120,125,122,119,124,122,118,123,124,119,122,
-    124,119,120,124,120,120,124,120,119,123,121,118,123,122,118,122,
-    123,118,121,123,118,120,124,120,119,123,120,118,123,121,118,123,
-    123,118,122,123,118,121,124,119,120,125,120,119,124,121,118,124,
-    123,119,123,123,118,122,124,119,121,125,120,119,125,120,118,124,
-    122,118,124,123,117,122,123,117,121,125,118,119,124,118,117,124,
-    120,117,124,122,116,123,123,116,122,125,118,121,126,119,119,125,
-    120,118,126,123,118,124,123,117,123,125,118,122,126,118,119,125,
-    119,118,125,121,117,124,122,116,122,123,117,122,125,118,120,125,
-    118,119,125,120,118,125,122,117,123,123,117,123,125,118,121,125,
-    118,120,125,120,119,125,121,118,124,122,117,123,123,118,123,124,
-    118,121,125,118,120,125,120,118,124,121,117,124,122,118,123,123,
-    117,122,124,118,121,125,119,120,125,120,118,124,121,118,124,122,
-    117,123,123,116,121,124,117,120,125,118,118,124,119,117,124,120,
-    117,123,121,116,121,123,117,121,124,118,119,124,119,119,125,121,
-    118,125,122,117,123,123,117,123,125,118,121,125,118,120,126,121,
-    120,126,122,118,125,123,118,124,125,118,122,125,118,120,125,119,
-    119,125,120,117,124,121,116,123,123,117,122,124,117,120,124,118,
-    119,125,120,118,124,121,117,124,122,117,123,124,117,121,124,118,
-    120,125,120,120,125,120,118,124,121,118,124,123,118,122,123,118,
-    121,124,119,120,124,119,119,123,119,118,123,121,118,122,121,117,
-    121,122,118,121,123,119,120,123,119,119,124,121,120,124,121,118,
-    123,122,119,123,124,119,122,124,119,120,124,120,120,124,121,119,
-    123,121,118,123,123,119,122,124,118,121,124,119,120,125,120,119,
-    124,121,117,123,122,118,123,124,117,121,124,118,120,125,119,119,
-    125,120,117,124,122,117,124,124,117,122,124,117,121,125,119,120,
-    126,120,118,125,121,117,124,123,117,123,124,116,121,125,117,120,
-    126,119,118,125,120,117,125,122,116,123,123,116,122,124,117,120,
-    125,118,118,125,118,117,124,121,117,124,122,116,122,123,117,121,
-    125,118,120,125,119,118,125,120,118,125,122,117,123,123,117,122,
-    125,118,121,125,118,119,125,119,118,125,121,118,124,121,116,123,
-    123,117,123,125,118,121,125,119,120,126,121,120,126,122,118,125,
-    123,118,124,124,118,122,124,117,120,125,119,120,126,120,118,125,
-    121,118,124,123,118,124,124,117,122,125,118,121,126,119,119,125,
-    120,118,125,122,118,124,123,117,122,124,117,121,125,118,119,125,
-    119,118,125,120,117,124,122,116,122,122,116,121,124,117,120,125,
-    118,118,124,119,117,125,121,116,123,122,116,122,124,117,121,125,
-    117,119,124,118,118,125,121,117,124,122,116,123,124,117,122,125,
-    118,121,126,119,119,126,121,119,125,121,117,123,122,117,123,124,
-    118,121,124,118,120,124,119,119,125,120,118,124,121,118,123,123,
-    118,123,124,118,121,124,119,121,125,120,120,124,121,119,124,122,
-    119,124,123,119,122,123,119,122,124,119,121,124,120,119,124,120,
-    119,124,121,118,123,122,118,122,124,119,122,124,119,120,124,120,
-    120,125,121,119,124,122,118,123,123,118,122,124,118,120,124,118,
-    119,124,120,118,124,121,117,123,122,117,122,124,117,121,125,118,
-    120,125,119,119,125,121,117,124,122,116,123,123,116,122,124,116,
-    119,124,118,118,125,119,117,124,121,116,124,123,116,123,124,116,
-    120,125,117,119,126,119,118,126,121,117,125,123,118,125,125,117,
-    123,125,117,121,126,119,119,126,120,118,125,121,117,124,123,117,
-    123,124,117,121,125,118,120,125,119,118,124,120,117,124,122,117,
-    123,123,117,122,124,118,121,125,119,120,125,119,118,125,121,118,
-    124,122,117,122,123,117,122,124,118,120,124,118,118,124,119,118,
-    125,121,117,124,122,117,123,124,118,122,125,117,120,125,119,119,
-    126,120,118,125,121,116,124,123,117,123,124,117,121,124,117,120,
-    126,119,119,126,120,117,125,122,117,124,124,117,122,124,117,120,
-    125,118,119,126,119,117,125,121,117,124,123,117,123,123,116,121,
-    124,117,120,126,119,118,125,120,117,125,123,117,124,123,116,122,
-    124,117,120,125,118,119,125,119,117,125,121,117,124,123,117,122,
-    123,117,121,125,119,120,125,119,119,125,121,119,125,123,118,124,
-    123,117,122,124,119,122,124,119,120,124,120,119,124,121,119,123,
-    121,118,122,122,119,122,123,119,121,123,119,120,123,120,120,123,
-    120,119,122,121,119,122,122,119,122,122,119,121,123,119,121,124,
-    120,120,123,120,120,123,122,120,123,122,119,122,123,119,122,124,
-    120,121,124,120,119,124,121,119,124,122,118,122,122,118,122,124,
-    119,121,124,119,120,124,120,119,125,122,118,123,122,117,122,124,
-    118,121,124,118,119,124,119,118,125,121,118,124,122,116,123,123,
-    117,122,125,117,120,125,118,118,125,120,117,124,121,116,123,122,
-    116,122,124,117,121,125,117,119,126,120,119,126,121,117,125,123,
-    117,124,125,117,122,125,117,120,125,119,119,126,120,117,124,121,
-    117,123,123,117,123,124,117,120,125,118,120,125,120,118,125,121,
-    118,124,123,118,123,124,118,122,124,118,121,125,119,120,125,120,
-    118,125,121,118,124,123,117,123,123,117,121,124,118,120,125,119,
-    119,124,119,118,125,121,117,124,122,117,122,124,117,122,125,118,
-    120,125,119,119,125,120,118,125,122,117,124,123,117,122,124,117,
-    121,124,117,119,125,119,118,125,120,117,124,121,116,123,124,117,
-    122,125,117,120,125,118,119,126,120,118,125,121,116,124,123,117,
-    123,125,117,121,125,118,119,126,119,118,125,120,117,124,122,116,
-    123,124,117,121,124,117,119,125,119,119,125,120,117,124,121,117,
-    124,123,117,123,124,118,121,125,119,120,125,120,119,125,121,118,
-    124,122,118,124,123,118,122,123,118,121,124,119,120,124,120,119,
-    124,121,120,124,122,119,122,122,119,122,123,119,121,123,119,120,
-    122,120,120,123,120,119,122,120,119,122,122,119,122,122,119,121,
-    122,119,121,123,120,120,123,120,119,123,121,120,123,122,119,122,
-    123,119,122,124,120,121,125,121,120,124,121,119,124,123,119,123,
-    123,118,122,124,119,121,125,120,119,124,120,118,124,122,118,123,
-    123,117,122,124,118,121,125,118,119,124,119,117,124,121,117,123,
-    122,116,122,123,117,121,125,118,120,125,119,119,125,121,118,125,
-    122,117,123,123,116,122,124,117,120,125,117,118,124,118,117,124,
-    120,116,123,121,116,122,124,117,122,125,118,120,125,119,118,125,
-    121,118,124,122,117,123,123,118,123,125,118,121,125,118,119,125,
-    120,119,125,121,117,124,122,117,123,124,118,122,124,118,121,125,
-    120,120,126,121,119,125,122,118,124,123,118,123,124,118,121,124,
-    118,121,125,119,119,125,120,118,124,121,117,124,122,116,122,123,
-    116,121,124,118,120,125,119,118,125,120,118,125,122,117,124,123,
-    117,123,125,118,122,125,118,120,126,120,119,126,121,118,125,122,
-    117,123,124,117,122,125,118,120,125,118,118,125,120,117,125,121,
-    116,123,123,116,122,124,117,120,125,118,119,125,119,118,125,121,
-    117,124,122,117,123,124,118,121,125,118,120,125,119,119,125,120,
-    118,124,121,117,123,123,118,122,124,118,120,124,119,120,125,120,
-    119,124,121,118,123,122,119,123,123,118,121,123,118,121,124,120,
-    120,124,120,119,123,121,119,123,122,119,122,122,119,122,123,120,
-    122,124,120,121,123,120,120,123,121,120,123,121,118,121,121,118,
-    121,122,118,120,122,118,120,123,120,120,123,120,119,123,121,119,
-    123,123,119,122,123,118,121,124,120,120,124,121,119,124,121,119,
-    124,123,119,123,124,119,122,124,119,120,125,120,119,124,120,118,
-    124,122,117,123,123,116,121,123,117,120,124,118,119,124,119,117,
-    124,121,117,124,123,117,122,123,117,120,124,118,120,125,119,118,
-    124,120,117,124,122,117,123,123,116,121,124,118,120,125,119,119,
-    125,120,118,125,122,118,124,123,117,122,124,118,121,125,119,120,
-    125,120,118,125,121,118,124,122,117,123,123,118,122,125,118,121,
-    125,119,119,124,120,118,124,122,118,124,122,118,123,124,119,122,
-    125,119,121,125,119,119,125,121,119,124,122,118,124,123,118,123,
-    124,118,121,124,118,120,125,119,119,125,120,118,124,121,117,124,
-    123,117,122,123,117,121,125,118,120,125,119,118,124,120,117,124,
-    122,117,123,123,116,121,124,117,121,125,118,119,125,119,117,125,
-    121,117,124,123,116,122,124,117,121,125,118,120,125,119,118,125,
-    121,117,125,122,117,123,123,117,121,124,117,120,125,118,118,124,
-    120,118,124,121,117,124,123,117,122,124,118,121,125,119,120,125,
-    119,118,124,121,118,124,122,118,123,123,118,122,125,119,121,124,
-    119,120,125,121,120,124,122,119,123,122,119,123,123,120,122,124,
-    120,121,124,120,121,124,121,120,123,121,119,123,122,120,122,122,
-    119,121,122,119,121,122,119,120,122,119,119,122,120,119,122,121,
-    119,122,121,118,121,122,119,121,123,119,120,123,120,120,123,121,
-    119,123,121,118,122,122,119,122,123,119,120,123,119,120,124,121,
-    119,124,121,118,123,122,118,122,123,118,121,124,118,119,124,120,
-    119,124,121,118,123,122,118,123,124,118,122,124,118,120,125,119,
-    119,125,120,118,124,121,117,124,124,118,123,125,118,121,125,119,
-    120,126,120,119,125,121,118,124,123,118,123,124,118,121,124,118,
-    120,125,120,119,125,120,118,124,121,117,123,123,117,122,124,118,
-    121,124,119,120,125,120,118,124,120,117,123,122,118,122,123,118,
-    121,124,118,120,124,119,119,124,120,118,124,121,118,123,122,117,
-    122,123,118,121,124,119,120,125,120,119,125,121,119,124,122,118,
-    123,122,117,122,124,118,121,124,118,119,124,119,119,125,120,118,
-    124,121,117,123,123,117,123,124,117,120,124,118,119,125,120,118,
-    125,120,117,124,122,117,123,124,117,122,124,117,120,125,119,119,
-    125,120,117,124,122,117,124,124,117,123,124,117,121,125,119,120,
-    126,120,118,125,121,118,124,123,118,123,124,117,121,124,118,120,
-    125,119,118,124,119,117,124,122,118,123,123,117,122,124,118,121,
-    125,119,120,124,120,119,124,122,119,124,123,118,123,123,118,122,
-    124,119,121,124,119,119,123,120,119,124,121,119,123,122,118,122,
-    122,119,122,123,120,121,123,119,120,123,120,119,122,120,119,122,
-    121,119,122,122,119,121,122,119,121,122,120,120,123,120,120,122,
-    121,120,124,122,120,123,123,120,122,123,119,122,124,120,121,123,
-    120,120,123,121,120,123,122,118,122,122,119,121,123,119,120,123,
-    119,119,123,120,118,123,121,118,122,122,118,122,124,119,121,125,
-    119,120,124,120,119,125,122,118,123,122,117,122,124,118,122,124,
-    118,120,124,119,119,125,121,118,124,121,117,123,123,117,121,124,
-    118,120,124,118,119,124,120,118,124,121,118,123,123,118,123,124,
-    118,121,124,118,120,125,120,119,125,121,118,123,122,118,123,123,
-    118,121,123,118,120,124,119,120,124,120,119,124,121,118,123,123,
-    119,123,123,118,121,124,119,121,125,120,120,124,121,119,124,121,
-    118,123,122,118,122,123,118,121,124,119,120,124,119,119,124,120,
-    119,124,122,118,123,123,118,122,124,118,122,125,119,120,124,119,
-    118,124,121,118,124,121,117,122,122,117,122,124,118,120,124,118,
-    119,125,120,119,125,122,118,124,123,118,124,125,118,122,125,118,
-    120,125,119,119,125,121,117,124,121,116,123,123,117,122,124,117,
-    120,124,118,119,125,120,118,124,121,117,123,123,118,123,124,118,
-    121,124,119,120,125,120,119,124,121,118,123,122,118,123,123,118,
-    122,123,118,120,124,120,120,124,120,119,124,121,119,123,123,119,
-    123,123,119,121,124,119,121,124,120,120,123,120,119,123,121,119,
-    123,122,119,122,122,119,121,123,120,121,123,120,120,123,120,120,
-    123,121,119,122,121,119,122,122,119,121,122,119,120,122,119,120,
-    123,120,120,123,121,120,123,122,120,122,122,119,122,123,119,121,
-    123,120,121,124,120,119,123,121,119,123,122,119,122,122,118,120,
-    123,119,120,124,120,119,123,121,119,123,122,118,122,122,118,121,
-    123,119,120,124,119,119,124,120,118,124,122,119,123,123,118,122,
-    123,118,121,124,118,119,124,119,118,124,121,118,124,122,118,122,
-    123,118,121,124,119,120,124,119,119,124,121,119,125,122,119,124,
-    123,118,123,124,119,122,125,120,120,124,120,120,124,122,119,123,
-    122,118,123,123,119,122,124,119,120,123,119,119,124,120,119,123,
-    121,118,122,122,118,122,122,118,120,122,118,119,123,119,119,124,
-    120,118,123,121,118,123,122,118,122,123,118,121,123,119,120,124,
-    120,119,124,120,119,124,122,119,123,123,118,122,124,119,122,125,
-    120,120,125,120,119,124,121,118,124,122,117,122,123,118,122,124,
-    118,121,125,119,119,124,120,118,124,121,117,123,122,117,122,124,
-    118,121,125,119,120,124,119,118,125,121,118,124,122,117,122,123,
-    118,121,124,118,120,124,119,119,124,120,118,123,121,117,122,122,
-    117,121,124,118,121,124,119,119,124,120,119,124,121,118,123,121,
-    118,122,123,119,121,123,118,120,124,120,120,124,120,119,123,121,
-    118,123,122,119,122,123,119,121,123,119,121,124,121,121,123,121,
-    120,123,122,120,124,123,120,123,123,120,122,123,121,122,123,121,
-    121,123,121,121,123,121,120,122,121,119,122,122,120,121,122,119,
-    120,122,119,120,122,120,120,122,120,119,122,121,119,121,122,119,
-    121,122,119,121,123,120,120,123,121,120,123,121,119,123,123,119,
-    122,123,119,121,123,120,120,124,120,119,123,121,118,123,122,119,
-    122,123,118,121,123,119,120,124,119,119,123,120,118,123,121,118,
-    123,123,118,121,123,118,120,124,119,120,124,120,118,123,121,119,
-    123,122,118,122,123,118,121,123,119,121,124,120,119,124,121,119,
-    124,122,119,123,122,118,121,123,119,121,124,120,120,123,120,119,
-    123,121,119,123,122,118,122,122,119,121,123,120,121,123,120,120,
-    123,121,119,123,121,119,122,122,119,122,123,119,122,123,120,120,
-    123,120,120,124,121,119,123,121,118,122,122,119,122,123,119,121,
-    123,119,120,124,120,120,123,120,118,123,122,119,123,123,119,122,
-    123,119,121,124,120,120,125,120,119,124,121,119,124,123,119,123,
-    123,118,122,124,119,121,125,120,119,124,120,118,124,122,118,123,
-    122,117,121,123,118,120,124,119,119,124,120,118,124,121,118,123,
-    122,118,122,123,118,121,124,119,120,124,119,118,124,120,118,123,
-    122,118,122,122,117,121,123,118,120,123,119,119,123,120,119,123,
-    121,119,123,122,118,122,122,119,121,123,120,121,124,120,120,124,
-    121,120,124,122,119,123,123,120,123,124,120,122,124,120,121,124,
-    120,121,124,121,119,123,121,119,122,122,119,122,122,119,121,122,
-    119,121,123,120,120,122,120,119,122,121,119,122,121,119,121,122,
-    119,121,122,119,121,123,120,119,122,121,120,123,122,120,123,122,
-    119,122,123,120,122,123,120,120,123,120,120,124,121,119,123,122,
-    119,122,123,119,122,124,120,121,124,120,120,124,121,120,124,122,
-    119,123,122,119,122,123,119,121,123,119,120,123,120,119,123,120,
-    118,122,121,118,122,123,119,121,123,118,120,123,119,119,123,120,
-    118,122,120,118,122,122,118,122,122,118,121,123,119,121,124,121,
-    120,123,121,119,123,122,119,122,122,119,121,122,119,121,123,120,
-    120,123,121,120,123,122,120,123,123,120,122,122,119,121,123,120,
-    121,123,120,120,122,120,119,123,121,119,122,122,119,122,123,119,
-    121,123,120,121,123,121,121,124,122,120,124,122,119,122,122,119,
-    122,123,119,121,123,119,120,123,120,119,123,121,118,122,121,118,
-    122,122,119,122,123,119,121,124,120,120,124,120,119,123,121,118,
-    123,122,118,122,123,119,121,123,119,120,124,120,120,124,121,119,
-    123,122,119,123,123,119,122,123,119,121,124,120,120,124,120,119,
-    123,121,119,123,122,118,122,122,118,120,123,119,120,123,120,119,
-    123,121,119,123,122,119,122,122,119,121,123,120,121,124,120,120,
-    123,121,120,123,122,120,123,122,119,121,122,119,121,123,119,120,
-    122,119,119,122,120,119,123,121,119,122,121,119,122,123,120,121,
-    123,120,120,123,120,120,123,121,120,123,121,119,122,122,120,122,
-    122,119,121,122,119,120,122,119,119,122,120,119,121,120,118,121,
-    121,119,121,121,118,120,122,119,120,123,120,120,123,121,120,123,
-    122,120,123,123,120,122,123,120,122,124,120,120,123,121,120,123,
-    122,120,123,122,119,122,122,119,121,123,120,121,123,120,120,123,
-    121,120,123,122,119,122,122,119,122,123,120,122,124,121,121,124,
-    121,121,124,122,120,123,122,119,122,123,119,121,123,119,120,122,
-    119,119,123,120,119,122,121,119,122,122,119,122,123,120,121,123,
-    120,121,123,121,120,123,121,120,122,121,120,122,122,120,122,122,
-    120,121,123,120,121,123,120,120,122,121,119,122,121,120,121,121,
-    119,120,121,119,120,122,120,120,122,120,119,122,122,120,122,122,
-    120,122,122,120,121,123,120,120,122,120,119,122,120,119,122,121,
-    119,122,122,119,121,123,120,121,123,120,120,123,120,119,123,121,
-    119,122,121,119,122,122,119,122,123,119,120,123,119,120,123,121,
-    120,123,122,119,122,122,119,122,123,119,121,123,119,120,124,121,
-    120,124,121,119,123,122,119,123,123,120,122,123,119,120,123,120,
-    120,123,121,119,123,121,119,122,122,119,122,123,119,120,123,120,
-    120,123,121,120,123,121,119,122,122,119,122,122,119,121,122,119,
-    120,123,120,120,123,120,119,122,121,120,122,122,120,122,122,119,
-    120,122,120,121,123,120,120,122,121,120,123,122,120,122,122,119,
-    122,122,120,121,123,120,121,122,120,120,123,121,120,122,121,120,
-    122,121,119,122,122,120,121,122,120,121,122,120,120,123,121,119,
-    122,121,119,121,121,119,121,122,119,120,122,119,120,123,120,120,
-    122,120,119,122,122,120,122,122,119,121,122,119,121,123,120,120,
-    123,120,120,122,121,120,122,122,120,122,122,119,121,123,120,121,
-    123,121,120,123,121,120,123,122,120,122,122,120,122,123,120,121,
-    123,121,120,122,121,120,122,121,120,122,121,119,121,122,120,121,
-    122,120,121,122,120,120,122,121,120,122,122,120,122,121,120,122,
-    122,121,121,122,121,121,122,121,121,122,121,121,122,121,120,122,
-    122,121,122,122,120,121,122,121,121,122,121,121,122,121,120,121,
-    121,120,122,121,120,121,121,120,121,122,121,121,122,120,120,121,
-    120,119,121,121,120,121,121,119,121,121,120,121,122,120,120,122,
-    120,120,122,121,120,122,122,119,121,122,120,121,123,121,121,123,
-    120,120,122,121,120,122,122,119,121,122,119,121,123,120,121,123,
-    120,120,123,121,120,123,122,119,122,122,119,122,123,120,121,123,
-    120,120,123,121,120,123,122,120,123,122,120,122,122,120,122,123,
-    120,120,122,120,120,123,121,120,122,121,119,122,122,120,121,122,
-    120,121,122,120,120,122,121,120,122,121,120,121,121,119,121,122,
-    120,121,122,120,120,122,120,120,122,120,119,121,120,120,121,121,
-    120,121,122,120,121,122,120,121,122,121,121,123,121,121,123,122,
-    121,123,122,121,122,122,121,122,123,121,121,123,121,121,122,121,
-    120,122,121,120,121,121,119,121,122,120,121,122,120,120,122,120,
-    120,122,121,120,122,121,119,121,121,120,121,122,120,120,122,120,
-    120,122,121,120,122,121,120,122,121,120,122,122,120,121,122,120,
-    120,122,120,120,122,121,120,122,121,120,122,122,120,122,122,120,
-    121,122,121,121,123,121,121,123,122,120,122,122,121,123,123,121,
-    122,122,120,121,123,121,121,122,121,120,122,121,120,122,122,121,
-    122,122,121,121,122,121,121,122,121,120,121,121,120,122,121,120,
-    121,121,119,120,121,120,120,121,120,120,121,120,120,121,120,120,
-    121,121,120,121,121,120,122,122,121,121,121,120,121,122,121,121,
-    122,121,120,121,121,120,122,122,120,121,121,120,121,121,120,121,
-    122,121,120,122,121,120,122,122,121,122,122,121,122,122,121,121,
-    123,121,121,122,121,120,122,121,120,122,122,120,121,122,120,121,
-    122,121,121,122,120,120,121,120,120,122,121,120,121,121,119,120,
-    122,120,121,122,120,120,122,120,120,122,121,120,122,121,120,121,
-    122,120,121,122,121,121,122,120,120,122,122,121,123,122,120,122,
-    122,120,121,122,121,121,122,120,120,122,121,121,122,122,121,121,
-    121,120,121,122,121,121,122,120,120,122,121,120,122,121,120,121,
-    121,120,121,121,120,121,121,120,121,121,120,120,121,121,120,122,
-    121,120,121,121,121,122,122,121,121,122,121,121,123,121,122,123,
-    122,121,122,122,121,123,123,121,122,122,120,121,122,120,121,122,
-    120,120,121,120,120,122,121,120,122,121,120,121,121,120,121,122,
-    120,120,121,119,119,121,120,120,121,120,119,121,121,119,121,122,
-    120,121,122,120,121,122,121,121,123,122,121,122,122,121,122,122,
-    121,122,122,121,121,122,121,121,123,121,121,122,121,120,121,122,
-    120,121,122,120,121,122,120,120,122,120,120,121,120,119,120,120,
-    119,120,121,120,120,121,119,120,121,120,120,121,120,120,121,121,
-    120,121,122,121,122,122,121,121,122,121,121,123,122,121,122,121,
-    121,122,122,121,122,122,120,121,122,120,121,122,121,121,122,121,
-    120,121,121,121,122,121,120,121,121,120,121,122,121,122,122,121,
-    121,122,121,121,123,122,121,122,122,121,122,122,121,122,122,121,
-    121,122,120,121,122,121,121,121,121,120,121,121,120,122,122,120,
-    121,121,120,121,121,121,121,122,121,120,121,121,121,122,122,121,
-    122,122,121,121,121,121,121,122,121,120,121,121,120,121,121,120,
-    121,121,120,120,120,120,120,121,120,120,120,120,120,121,121,120,
-    121,121,120,121,122,121,121,122,121,121,122,121,121,122,121,121,
-    122,122,121,121,121,120,121,122,121,122,122,121,121,121,121,121,
-    121,121,121,121,120,120,120,120,120,121,121,121,121,121,120,121,
-    121,121,121,121,121,120,121,121,120,121,121,120,121,121,120,121,
-    121,121,121,122,121,121,121,121,121,122,122,121,122,122,121,121,
-    121,121,122,122,121,122,122,121,121,122,122,122,123,122,121,122,
-    122,121,121,122,121,121,121,120,120,121,121,120,121,121,120,120,
-    120,120,121,121,121,121,122,121,121,121,121,121,122,121,121,121,
-    121,121,121,122,121,121,122,121,121,121,121,121,122,122,121,122,
-    121,121,121,121,121,122,122,121,121,121,120,121,121,121,121,121,
-    121,121,121,121,120,121,121,121,121,121,120,121,121,120,121,121,
-    120,120,121,120,120,121,121,120,121,121,120,120,121,120,121,121,
-    121,121,121,121,121,121,121,121,122,121,121,121,121,121,121,122,
-    121,122,122,121,121,122,121,122,122,122,121,122,121,121,122,122,
-    121,122,122,121,121,122,121,121,122,121,121,121,121,120,121,121,
-    120,121,121,121,121,121,121,121,122,121,121,122,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,122,121,120,121,121,
-    120,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    120,121,121,120,121,121,120,120,120,120,120,121,120,120,121,120,
-    121,121,121,121,122,121,121,121,121,121,121,122,121,122,122,121,
-    121,122,121,121,122,122,121,122,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,120,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,122,121,121,121,121,121,121,121,121,
-    121,121,120,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    122,122,121,122,122,121,122,122,121,121,122,121,121,122,121,121,
-    122,121,121,121,121,120,121,121,121,121,121,120,120,120,120,120,
-    121,121,120,121,121,120,120,121,120,121,121,120,121,121,121,121,
-    122,121,121,122,121,121,121,121,121,122,122,121,121,121,121,121,
-    122,121,121,122,121,121,121,121,120,121,121,121,121,121,120,121,
-    121,121,121,122,121,121,121,121,121,121,121,121,122,121,121,121,
-    121,121,121,122,121,121,122,121,121,121,121,121,122,122,121,122,
-    121,121,121,122,121,121,122,121,121,122,121,121,122,122,121,121,
-    121,120,121,121,121,121,121,120,121,121,120,120,121,120,120,120,
-    120,119,120,120,120,121,121,120,120,120,119,120,121,120,120,121,
-    120,120,121,120,121,122,122,121,122,122,121,122,122,121,122,123,
-    122,122,122,122,122,123,122,122,123,122,121,122,122,121,122,122,
-    121,121,122,121,121,122,121,121,121,121,120,121,121,120,121,121,
-    121,121,121,120,121,121,121,121,121,121,121,121,120,120,121,121,
-    120,121,121,120,121,121,121,121,122,121,121,121,121,120,121,121,
-    121,121,122,121,121,121,120,121,122,121,121,122,121,121,121,121,
-    120,121,121,121,121,121,120,121,121,121,121,121,121,120,121,120,
-    120,121,121,121,121,121,120,121,121,120,121,122,121,121,122,121,
-    121,122,121,121,122,122,121,122,122,121,122,122,121,122,122,121,
-    121,121,121,121,122,121,121,121,121,121,121,121,121,121,121,120,
-    120,121,120,121,121,120,120,121,120,120,121,121,120,121,121,121,
-    121,121,120,121,122,121,121,122,121,120,121,121,121,122,121,121,
-    121,121,120,121,122,121,121,122,121,121,121,121,121,122,121,120,
-    121,121,120,121,121,120,121,121,120,120,121,120,120,121,121,121,
-    122,121,120,121,121,121,122,122,121,122,122,121,121,122,121,121,
-    122,121,121,122,121,121,121,122,121,122,122,121,121,122,121,121,
-    122,121,121,122,121,120,121,121,121,122,122,120,121,121,121,121,
-    122,121,121,122,121,121,122,121,121,122,122,121,122,122,121,121,
-    122,121,121,122,120,120,121,120,120,121,121,120,121,121,120,121,
-    121,120,121,121,120,120,121,120,120,121,120,120,121,121,120,121,
-    121,120,121,122,121,121,122,121,120,122,121,121,122,122,120,121,
-    121,120,121,122,121,121,122,120,121,121,120,120,122,121,120,121,
-    121,120,121,122,120,121,122,120,121,122,121,121,122,122,121,122,
-    121,121,122,122,121,122,122,121,121,122,120,120,122,121,121,122,
-    121,120,121,120,120,121,121,120,121,121,120,120,121,120,121,122,
-    121,120,122,121,120,122,121,120,122,121,120,121,122,121,122,123,
-    121,122,123,121,121,123,122,121,123,122,121,122,122,121,122,122,
-    121,121,122,120,120,122,121,121,122,122,120,122,121,120,121,122,
-    120,121,121,119,120,121,120,121,123,121,120,121,121,120,121,121,
-    120,121,122,120,121,122,120,120,122,121,121,122,121,120,121,121,
-    120,122,121,120,121,121,119,120,122,121,121,122,121,121,122,121,
-    120,122,122,120,121,121,119,120,121,120,120,122,120,120,121,120,
-    120,121,121,120,122,121,120,121,121,120,121,122,121,121,122,121,
-    120,122,121,120,122,122,120,122,122,120,121,122,121,121,122,121,
-    121,122,121,121,122,121,120,121,121,120,121,121,120,121,121,120,
-    120,121,120,120,122,121,120,121,121,120,121,121,120,121,122,120,
-    121,122,120,120,122,121,121,123,122,121,122,122,121,123,123,122,
-    123,123,122,122,123,123,123,124,123,122,123,122,122,123,123,122,
-    124,123,121,122,123,121,122,123,121,121,122,120,120,121,120,119,
-    121,121,119,120,120,119,120,121,120,120,121,120,119,121,120,120,
-    122,121,120,121,121,119,120,121,119,120,121,119,119,121,119,119,
-    121,120,119,121,120,119,121,121,119,121,122,120,120,121,120,120,
-    122,121,121,122,122,120,122,122,121,122,122,121,122,122,120,120,
-    122,120,120,121,120,119,121,120,119,121,121,119,121,121,119,120,
-    121,120,120,122,121,120,121,121,120,122,122,121,123,122,121,122,
-    122,121,122,123,122,122,123,121,121,123,122,121,122,122,120,122,
-    122,120,121,122,121,121,122,120,120,122,121,120,122,121,120,122,
-    122,120,121,122,120,121,123,121,121,122,121,120,123,122,121,123,
-    122,120,123,123,121,123,123,121,121,123,121,121,122,121,120,122,
-    121,120,122,121,120,122,122,120,122,122,120,120,122,121,120,122,
-    121,120,122,121,119,121,121,119,121,121,119,120,122,119,120,122,
-    120,120,122,121,119,122,121,119,121,121,119,121,122,119,120,122,
-    120,120,122,120,120,122,121,119,121,122,120,121,122,119,121,122,
-    120,120,122,120,120,122,120,120,122,121,120,121,122,120,121,122,
-    120,121,123,120,120,122,120,120,122,121,120,122,121,120,121,122,
-    120,121,122,120,121,122,120,120,122,121,120,122,121,120,122,121,
-    119,122,122,120,121,123,120,121,122,121,121,123,122,120,123,122,
-    120,122,122,120,122,123,119,121,122,120,120,123,121,121,123,121,
-    120,122,122,120,122,123,120,122,123,120,121,123,121,121,123,121,
-    120,122,121,120,122,121,119,122,122,120,121,122,120,121,123,121,
-    121,123,121,120,122,122,121,123,122,120,122,123,121,121,123,121,
-    121,122,120,120,122,121,120,122,121,120,122,122,120,121,122,120,
-    121,122,120,120,122,120,120,122,121,120,121,121,120,121,121,120,
-    121,122,119,120,121,119,120,121,120,120,121,120,119,121,121,120,
-    121,121,119,121,121,120,120,122,120,120,122,121,120,122,121,120,
-    121,121,120,121,122,120,121,122,120,121,122,121,120,122,121,121,
-    123,122,120,122,122,120,122,122,120,121,122,120,121,122,120,120,
-    122,121,120,122,122,119,121,122,120,121,123,120,120,122,120,120,
-    122,121,119,122,121,120,122,122,119,121,122,120,121,122,120,120,
-    122,121,120,123,122,120,123,122,120,122,123,120,122,123,120,120,
-    122,120,120,123,121,120,122,122,120,122,122,120,122,123,120,121,
-    122,120,121,123,120,120,122,121,119,122,121,119,121,122,119,121,
-    122,119,120,122,120,120,123,121,120,122,121,120,122,122,119,121,
-    122,119,121,122,119,120,122,120,120,122,120,119,122,121,119,123,
-    122,119,121,122,120,122,124,121,121,123,121,121,124,122,121,123,
-    122,120,122,122,119,122,123,120,121,123,120,120,122,120,120,123,
-    121,119,122,121,119,121,122,120,121,123,120,121,123,120,120,123,
-    121,120,123,122,120,122,122,120,122,123,120,121,123,120,120,123,
-    120,120,123,121,120,122,122,119,122,122,120,121,122,119,120,122,
-    119,119,122,120,119,122,121,119,122,122,119,121,122,119,121,122,
-    119,120,122,120,119,122,120,119,122,121,119,122,122,120,122,122,
-    120,121,123,121,121,123,120,120,122,121,120,122,122,120,122,122,
-    120,122,123,120,121,123,120,120,121,120,119,122,120,119,122,121,
-    119,121,122,120,121,122,121,122,123,120,121,123,121,121,123,121,
-    120,122,122,120,122,123,120,121,122,120,121,122,120,120,122,120,
-    119,121,121,120,122,122,120,122,123,120,121,122,120,121,123,121,
-    120,122,121,119,122,121,119,121,121,119,120,121,119,120,122,120,
-    120,123,120,120,123,122,120,122,123,121,122,123,120,121,123,120,
-    121,123,121,120,123,121,120,123,122,120,122,122,119,122,123,120,
-    121,123,120,120,122,120,119,122,121,120,123,122,119,122,123,120,
-    122,123,120,121,123,120,120,123,121,120,123,121,119,122,122,120,
-    122,122,120,121,123,120,121,123,121,120,123,121,120,122,121,118,
-    121,122,119,121,122,119,120,122,119,120,123,120,119,122,121,119,
-    122,122,120,123,124,120,122,124,121,121,123,121,121,124,121,119,
-    122,121,119,122,121,118,121,122,118,120,122,119,119,121,119,119,
-    122,120,119,123,122,119,122,122,120,122,123,119,121,124,120,120,
-    123,120,119,123,121,119,122,122,118,121,122,119,121,123,120,121,
-    124,120,120,124,121,120,123,122,119,123,122,119,122,123,120,121,
-    123,119,119,123,120,119,122,121,119,122,121,118,122,123,119,121,
-    123,120,120,123,120,120,123,122,120,123,122,120,122,122,119,122,
-    123,120,121,122,119,120,123,121,120,123,121,120,122,122,119,122,
-    123,119,121,123,120,121,123,121,121,123,120,120,123,121,120,123,
-    122,120,122,122,119,121,122,119,120,122,120,120,122,120,119,122,
-    121,119,122,122,119,121,122,120,121,123,120,121,123,121,121,123,
-    121,120,122,121,120,122,121,120,121,122,120,121,122,119,120,121,
-    120,120,122,120,120,122,120,119,121,121,119,121,122,119,121,122,
-    120,120,123,121,120,123,121,120,123,122,119,122,123,120,121,122,
-    119,120,123,120,120,123,121,120,122,121,119,122,122,119,121,122,
-    119,121,123,119,120,123,121,120,123,121,119,123,122,119,122,123,
-    119,121,123,120,121,123,120,120,123,121,120,123,121,119,122,122,
-    119,122,122,119,121,123,119,120,123,120,119,122,120,119,122,121,
-    119,122,122,119,121,123,120,121,123,120,120,123,120,120,123,122,
-    120,123,122,120,122,123,120,122,123,120,121,123,120,120,123,121,
-    120,123,122,119,122,122,119,122,123,119,121,123,119,120,123,120,
-    120,123,121,119,122,121,119,122,122,119,122,123,119,121,123,119,
-    120,123,120,119,123,121,119,123,122,119,122,123,119,121,123,119,
-    120,123,120,120,123,120,119,123,121,119,123,122,119,122,123,118,
-    120,123,119,120,123,120,119,123,120,119,123,121,118,122,122,118,
-    121,123,119,121,124,120,120,123,120,119,123,122,119,123,122,119,
-    122,123,119,121,123,120,121,124,120,120,124,121,119,123,122,119,
-    122,122,119,122,123,120,121,123,120,120,123,121,120,124,122,120,
-    123,122,119,122,122,119,121,123,119,120,122,120,120,123,120,120,
-    122,121,119,122,122,119,122,122,119,121,122,119,121,122,120,120,
-    122,120,120,122,121,119,122,122,120,122,122,120,121,122,120,121,
-    123,120,120,123,121,120,123,121,120,122,122,119,121,121,119,121,
-    122,119,120,122,120,119,122,120,119,122,121,119,122,122,119,121,
-    122,119,121,123,120,120,123,120,120,123,121,119,122,122,119,122,
-    123,119,122,123,120,121,124,121,120,124,121,120,124,122,119,123,
-    122,119,122,123,119,120,123,119,120,123,120,119,123,121,118,122,
-    121,119,122,123,119,121,123,119,121,123,120,120,123,121,119,123,
-    122,119,123,123,120,123,123,120,122,124,121,121,124,121,121,124,
-    122,120,123,123,120,123,123,119,122,123,119,121,123,120,120,122,
-    120,118,121,120,118,121,120,117,120,120,117,119,121,118,119,122,
-    118,118,122,120,119,122,121,119,122,122,119,122,123,120,122,124,
-    120,120,123,120,120,124,121,119,123,122,119,123,122,119,122,123,
-    119,121,123,120,120,124,121,120,124,122,119,124,123,119,123,124,
-    120,122,124,119,121,124,120,120,124,121,119,123,121,118,123,122,
-    119,122,123,119,120,123,119,120,123,120,119,123,121,118,123,122,
-    118,122,122,118,121,123,119,120,124,120,120,124,121,119,124,122,
-    119,123,123,119,122,123,119,121,123,120,120,124,120,119,123,121,
-    119,123,122,119,122,123,119,122,124,120,121,124,120,120,123,120,
-    119,123,121,119,122,122,118,121,122,119,121,122,119,120,122,119,
-    119,122,120,119,122,121,119,121,121,118,121,122,119,121,122,119,
-    120,123,120,120,123,121,120,123,121,119,122,122,119,122,122,119,
-    121,123,120,121,123,120,120,123,121,119,123,121,120,123,122,120,
-    122,123,120,122,124,121,121,124,121,120,123,121,119,122,122,119,
-    122,122,119,121,123,119,121,123,120,120,123,120,119,123,121,119,
-    122,122,118,121,122,118,121,123,119,120,122,119,119,122,120,119,
-    123,122,118,122,122,119,121,123,119,121,123,120,120,123,121,119,
-    123,122,119,123,123,119,122,123,120,122,124,120,121,124,120,120,
-    123,121,119,123,121,119,122,122,119,122,123,120,121,123,120,120,
-    124,121,120,123,121,119,123,122,119,122,123,120,122,123,119,121,
-    123,120,120,123,121,120,123,121,119,123,122,119,122,122,119,121,
-    123,119,120,123,120,120,123,120,119,123,121,119,122,122,118,121,
-    122,118,120,123,119,120,123,120,119,123,121,119,123,122,119,123,
-    123,119,122,124,120,121,124,120,120,123,120,119,123,121,118,122,
-    121,118,121,122,117,120,123,118,119,123,119,118,123,121,118,123,
-    121,118,122,123,118,122,124,119,121,124,119,119,124,120,119,123,
-    121,118,122,122,118,122,123,119,122,124,120,120,124,121,120,124,
-    122,119,124,122,119,123,123,119,122,123,119,121,124,120,120,124,
-    121,119,123,121,119,123,122,119,122,123,119,121,123,119,121,123,
-    120,120,123,120,118,122,121,118,122,122,119,122,122,119,121,123,
-    120,121,123,120,120,123,121,120,123,122,119,122,122,119,122,122,
-    119,121,123,119,120,123,120,120,123,121,120,123,122,119,122,122,
-    119,122,123,119,121,122,119,120,123,120,120,123,121,119,122,120,
-    118,121,121,118,120,122,118,120,122,119,120,123,120,119,123,121,
-    119,123,122,119,122,123,120,122,124,120,121,124,120,120,123,121,
-    119,123,122,119,123,122,119,121,123,119,121,123,120,120,123,120,
-    119,123,121,119,123,122,119,122,123,119,121,124,120,121,124,121,
-    120,123,121,119,123,122,119,122,122,118,121,122,119,121,123,120,
-    120,123,120,119,123,121,119,123,122,119,122,122,119,122,123,120,
-    121,123,120,120,123,121,120,123,122,120,123,122,119,122,122,119,
-    121,123,119,120,122,120,120,123,121,119,123,121,119,122,122,119,
-    122,123,119,121,123,119,120,123,120,120,123,121,119,123,122,119,
-    123,123,119,122,123,119,121,124,120,120,124,120,119,124,122,119,
-    123,122,119,122,123,119,121,123,119,121,124,119,119,124,120,119,
-    123,121,118,122,122,118,121,123,118,120,123,119,119,123,119,118,
-    123,120,118,123,121,118,122,122,118,121,123,118,120,124,119,119,
-    124,120,118,123,121,118,123,122,118,122,123,119,121,124,119,120,
-    124,120,119,124,122,119,123,122,119,122,123,119,122,124,119,120,
-    123,120,120,124,120,119,123,121,118,122,122,119,122,123,119,121,
-    123,119,120,123,120,120,123,120,119,123,121,119,122,122,119,122,
-    123,119,121,123,120,121,124,120,120,123,121,119,123,122,120,123,
-    122,119,122,123,120,122,124,120,121,124,121,120,123,121,120,123,
-    122,119,122,122,119,122,123,120,121,123,120,120,123,120,120,123,
-    121,119,122,121,119,122,122,119,121,123,119,120,123,120,120,123,
-    121,120,123,121,119,122,122,118,121,122,119,120,122,119,120,123,
-    120,119,123,120,118,122,121,118,122,122,118,121,123,119,120,123,
-    120,120,124,121,119,123,121,118,122,122,119,122,123,119,121,123,
-    119,120,124,120,119,123,121,119,123,121,119,122,122,118,121,122,
-    119,121,123,120,120,123,120,120,123,121,119,123,122,119,122,122,
-    119,122,123,120,121,124,120,121,123,121,120,123,122,120,122,122,
-    119,122,123,119,121,123,119,120,122,120,119,123,121,119,123,121,
-    119,122,122,119,122,123,120,121,123,120,121,124,121,120,124,121,
-    119,123,121,119,122,122,118,121,123,118,120,123,119,120,124,120,
-    119,123,121,119,123,122,118,122,123,119,121,124,119,120,124,120,
-    120,124,121,119,123,122,118,123,123,118,122,123,119,121,124,120,
-    120,124,120,119,124,121,119,124,123,119,123,124,119,122,124,120,
-    121,125,120,120,124,121,119,124,122,118,123,122,118,121,123,118,
-    120,123,119,119,123,119,118,122,120,118,122,121,118,121,122,118,
-    121,123,119,120,123,119,119,123,121,119,123,121,119,123,122,119,
-    122,123,119,122,124,120,121,124,121,120,124,121,120,123,122,119,
-    123,122,119,122,122,119,121,123,119,120,123,120,120,123,120,119,
-    122,121,119,122,122,119,122,123,119,121,123,120,121,124,120,120,
-    123,121,119,123,122,119,122,122,119,121,123,120,121,123,120,120,
-    123,120,119,123,121,119,122,122,118,121,122,119,121,123,119,120,
-    123,119,119,123,120,119,123,121,118,122,122,118,121,122,118,120,
-    123,119,119,123,120,119,123,121,119,123,122,118,122,123,119,121,
-    124,120,120,124,120,120,124,121,120,124,122,119,123,123,119,122,
-    123,119,121,123,120,120,124,120,119,123,121,119,123,122,119,122,
-    123,119,121,123,120,121,123,120,121,123,121,120,123,121,120,123,
-    122,120,123,123,119,121,123,120,121,123,120,120,123,120,120,123,
-    121,119,122,122,119,122,122,119,121,123,120,120,123,120,120,123,
-    121,119,123,122,119,123,122,119,122,123,119,121,123,120,120,123,
-    120,119,123,121,119,123,122,119,122,122,119,121,123,119,120,123,
-    119,119,123,120,119,123,121,118,122,122,118,122,123,119,121,123,
-    119,120,124,120,119,124,121,118,123,122,118,122,123,118,121,123,
-    118,120,124,119,120,124,120,119,124,121,118,123,122,118,122,123,
-    118,121,124,119,120,124,120,119,124,121,118,123,122,118,122,123,
-    118,121,123,119,120,124,119,120,123,120,118,123,121,118,122,122,
-    119,122,123,119,121,123,119,120,123,120,119,123,120,119,123,122,
-    119,123,123,119,122,123,120,121,124,120,120,123,120,120,123,121,
-    119,123,121,119,122,122,119,121,123,119,121,123,119,120,123,120,
-    119,123,121,119,122,122,119,122,122,119,122,123,120,121,124,120,
-    121,124,121,120,123,121,120,123,122,119,122,123,119,121,123,119,
-    121,123,120,120,123,120,119,123,122,119,123,122,119,122,123,119,
-    121,124,120,121,124,121,120,124,121,119,123,122,119,122,123,119,
-    121,123,119,121,123,120,120,123,120,119,123,121,119,122,122,118,
-    121,122,119,121,123,119,120,123,120,119,123,120,118,122,121,118,
-    122,122,119,121,122,119,120,122,119,119,123,120,119,123,121,119,
-    122,121,119,122,123,119,122,123,119,120,123,120,120,123,121,120,
-    123,121,119,122,122,119,122,122,119,121,122,119,120,123,120,120,
-    123,121,119,122,121,119,122,122,119,121,122,119,121,123,120,120,
-    123,120,119,123,121,119,122,121,119,122,122,119,122,123,120,121,
-    124,120,120,124,120,120,124,122,119,123,122,119,122,123,119,122,
-    124,119,120,123,119,119,123,121,119,123,122,119,123,123,119,123,
-    124,120,122,125,121,121,125,121,120,124,122,119,123,122,118,122,
-    123,118,121,123,119,120,123,119,119,123,120,118,123,121,118,122,
-    122,118,122,123,118,120,124,119,120,124,120,119,124,121,119,123,
-    122,118,122,123,119,121,123,119,120,124,120,120,124,121,119,123,
-    121,119,123,122,119,122,123,119,121,124,120,120,124,121,120,123,
-    121,119,123,122,119,122,122,118,121,122,118,120,122,119,120,123,
-    120,119,122,120,119,122,121,119,122,122,119,121,122,119,121,123,
-    119,120,123,120,119,123,121,119,122,121,119,122,122,119,121,122,
-    119,121,123,120,120,123,120,119,123,121,119,122,122,119,122,122,
-    119,121,123,119,120,123,120,120,124,121,120,123,122,119,122,123,
-    119,122,123,119,121,123,119,120,123,120,119,123,121,119,123,122,
-    119,122,123,119,121,123,120,121,123,120,120,123,121,119,123,122,
-    119,123,122,119,122,123,119,121,123,120,120,123,120,119,123,121,
-    119,123,122,119,122,123,119,122,123,120,121,123,120,120,123,121,
-    120,124,122,120,123,122,119,122,122,120,121,123,120,121,123,120,
-    120,123,121,119,122,121,119,122,122,119,122,122,120,121,123,120,
-    120,123,120,120,123,121,119,122,121,119,122,122,119,121,122,119,
-    120,122,119,120,123,120,119,123,120,119,122,121,119,122,122,119,
-    121,123,120,121,123,120,120,123,121,119,123,121,119,123,122,119,
-    122,123,119,121,123,119,120,123,120,119,123,121,119,123,122,118,
-    122,122,118,121,123,119,120,123,119,119,123,120,118,123,121,118,
-    123,122,118,122,123,118,121,123,119,120,123,120,119,123,121,119,
-    123,122,118,122,122,118,121,123,119,120,123,119,120,124,120,119,
-    123,122,119,123,122,118,122,123,119,121,124,120,121,124,121,120,
-    124,121,119,124,122,119,123,123,119,122,123,119,121,123,120,120,
-    124,121,120,124,122,120,123,122,119,122,123,119,122,123,119,121,
-    123,120,120,123,120,120,123,121,119,122,121,119,122,122,119,121,
-    122,119,120,122,120,120,122,120,119,123,121,119,122,122,119,122,
-    122,119,121,123,119,121,123,120,120,123,121,119,123,121,119,122,
-    122,119,122,122,119,121,123,119,120,123,120,120,123,121,119,123,
-    121,119,122,122,119,122,123,120,121,123,120,120,124,121,120,123,
-    122,119,123,122,119,122,123,119,121,123,120,121,123,120,120,123,
-    121,119,122,121,119,122,122,119,122,123,119,121,123,120,120,123,
-    120,119,122,120,119,122,121,119,121,122,119,121,122,119,120,123,
-    120,120,122,120,120,123,121,120,123,122,120,122,123,120,122,123,
-    120,121,123,120,120,122,120,120,122,121,119,121,121,119,121,122,
-    119,121,122,120,120,122,121,120,123,121,120,123,122,120,123,122,
-    120,123,123,121,122,123,121,121,123,121,120,123,121,120,122,122,
-    119,122,122,119,121,122,119,120,123,120,119,122,120,118,122,120,
-    118,121,121,118,121,122,118,120,123,119,120,124,121,120,124,122,
-    119,123,123,119,123,123,119,121,123,119,120,124,120,120,123,120,
-    119,123,122,119,123,122,119,122,123,119,121,124,120,120,124,120,
-    119,123,121,119,123,122,119,122,123,119,122,124,120,121,124,120,
-    120,123,121,119,123,121,119,122,122,119,122,123,119,121,123,120,
-    120,123,120,119,123,121,119,122,121,119,122,122,119,121,123,119,
-    121,123,120,120,123,120,119,122,121,119,122,121,119,122,122,119,
-    121,122,119,120,122,119,120,123,120,119,123,121,119,123,122,119,
-    122,123,120,122,123,119,121,123,120,120,123,121,120,123,121,120,
-    123,122,119,122,123,119,122,123,120,121,124,121,120,123,121,119,
-    123,122,119,122,122,119,121,123,120,122,124,120,121,124,121,120,
-    123,122,120,123,122,119,122,123,119,122,123,120,121,123,120,119,
-    123,120,119,122,121,119,122,122,119,121,123,119,121,123,119,120,
-    123,120,119,123,121,119,123,122,119,122,122,119,121,123,119,120,
-    123,120,120,123,121,120,123,121,119,122,122,119,121,122,119,121,
-    122,119,120,122,120,120,122,120,119,122,121,119,121,121,119,121,
-    122,119,121,122,120,121,123,120,120,122,121,120,123,122,120,122,
-    122,120,122,122,120,121,123,120,121,123,120,120,123,121,120,123,
-    122,120,122,122,120,122,123,120,121,123,120,120,123,120,120,123,
-    121,119,122,122,119,122,123,119,121,123,119,120,123,120,120,123,
-    121,119,123,122,119,122,123,120,122,123,120,121,123,120,120,123,
-    120,119,123,121,119,123,122,119,122,123,119,121,123,120,120,123,
-    120,120,123,121,119,123,122,119,122,122,119,121,123,119,120,123,
-    119,119,122,120,119,123,121,119,122,121,119,122,122,119,121,122,
-    119,120,123,120,120,123,121,119,123,122,120,123,122,119,121,122,
-    119,120,123,120,120,123,120,119,122,120,119,122,121,119,122,122,
-    119,121,123,120,121,123,120,120,123,121,120,123,121,119,122,122,
-    119,122,122,120,122,123,120,121,123,120,121,124,121,120,123,122,
-    120,123,122,119,122,122,119,121,122,119,120,123,120,120,123,120,
-    119,122,121,119,121,121,118,121,122,119,120,122,119,120,123,120,
-    120,123,121,120,123,122,120,123,123,120,122,123,120,121,123,120,
-    120,124,121,120,123,122,120,123,123,120,122,123,119,121,123,120,
-    121,123,120,120,123,121,120,122,122,119,122,122,119,121,122,119,
-    121,123,120,120,123,120,120,123,121,119,122,121,119,121,122,120,
-    121,123,120,121,123,120,120,123,121,120,123,121,120,122,121,119,
-    122,122,119,121,122,119,120,122,120,120,122,120,120,122,121,119,
-    121,121,120,122,122,120,121,122,120,121,122,121,120,122,121,120,
-    122,121,120,122,122,120,121,122,120,121,122,120,120,122,120,120,
-    122,121,120,122,121,119,121,122,119,121,122,119,120,122,119,119,
-    122,120,119,122,121,119,122,121,119,121,122,120,121,123,120,121,
-    123,121,120,123,122,120,123,122,119,122,122,119,121,123,120,121,
-    123,120,120,123,121,120,124,122,120,123,123,120,123,123,120,122,
-    124,120,121,124,121,121,124,122,120,123,122,120,122,122,120,122,
-    123,120,121,123,120,120,123,120,119,122,120,118,121,121,118,121,
-    122,119,120,122,119,119,122,119,119,122,120,118,122,121,119,122,
-    122,119,121,122,119,121,123,120,121,123,121,120,123,121,119,122,
-    122,119,122,122,119,121,122,119,121,122,120,120,123,121,120,122,
-    121,120,122,121,119,122,122,119,121,122,120,120,123,121,121,123,
-    121,120,123,122,120,123,123,121,123,124,121,123,124,121,122,123,
-    120,119,121,119,117,120,120,118,121,121,119,122,123,121,122,124,
-    122,122,124,122,121,124,122,120,123,122,119,122,122,119,120,121,
-    118,119,121,118,118,121,119,118,121,120,118,121,121,119,122,123,
-    121,122,124,121,121,124,122,121,123,122,120,123,122,119,121,121,
-    119,120,121,119,120,122,120,120,123,121,120,123,122,120,123,122,
-    120,122,123,120,122,123,121,121,123,121,121,123,122,121,123,122,
-    120,122,122,120,121,122,120,121,122,120,121,122,121,121,122,121,
-    120,122,122,121,122,122,120,122,123,121,122,123,121,121,123,121,
-    121,122,121,120,121,121,120,121,121,119,121,121,119,120,121,119,
-    120,121,120,120,121,120,119,121,121,119,121,121,119,120,121,119,
-    120,121,119,119,122,120,119,122,121,119,121,121,119,121,122,119,
-    121,122,120,121,123,121,120,123,121,120,123,122,120,122,122,119,
-    121,123,120,121,123,120,120,122,120,119,122,121,120,122,122,119,
-    121,122,119,121,123,120,120,122,120,120,123,121,120,122,122,119,
-    122,122,120,121,123,120,121,123,120,120,123,121,120,123,122,120,
-    122,122,120,122,122,120,121,123,120,121,123,121,120,123,121,120,
-    122,121,120,122,122,119,121,122,120,121,122,120,120,122,120,120,
-    122,121,120,122,122,120,122,122,120,121,123,120,121,123,121,121,
-    123,121,120,123,122,120,123,123,121,123,123,121,122,123,121,121,
-    123,121,120,123,121,120,122,121,119,122,121,119,121,122,119,121,
-    122,120,120,122,120,120,123,121,120,122,121,119,122,122,120,121,
-    122,119,120,122,120,120,122,120,119,122,120,118,121,121,118,121,
-    121,119,120,122,119,120,122,120,120,122,121,119,122,121,119,121,
-    122,119,121,122,120,121,122,120,120,122,121,120,122,121,120,122,
-    122,120,122,123,121,122,123,121,121,123,121,121,123,122,121,122,
-    121,120,122,122,120,121,121,120,121,122,120,121,122,120,120,122,
-    120,120,121,121,120,121,121,120,121,121,120,121,122,120,121,122,
-    121,121,122,121,121,122,121,120,122,121,120,121,122,121,121,122,
-    121,121,122,121,121,122,121,121,122,121,120,122,122,120,122,122,
-    120,121,122,121,121,123,121,121,123,122,120,122,122,120,121,122,
-    120,121,122,120,120,122,120,120,122,120,119,122,121,119,122,121,
-    119,121,122,120,121,122,120,120,122,121,120,123,122,120,123,122,
-    120,122,122,120,122,123,120,121,123,121,120,122,121,120,122,121,
-    120,121,121,119,121,121,119,120,122,120,120,122,120,119,121,120,
-    119,122,121,120,121,122,120,121,122,120,121,123,121,121,123,121,
-    121,123,122,120,122,122,120,122,122,120,121,122,120,120,122,120,
-    120,122,120,119,121,120,119,121,121,119,120,121,119,120,122,120,
-    120,122,121,120,122,121,120,123,122,120,122,122,120,122,123,121,
-    121,123,121,121,123,121,121,123,121,120,122,122,120,122,122,120,
-    122,123,120,121,123,121,121,123,121,120,122,122,120,122,122,120,
-    121,122,119,121,122,120,120,122,120,120,122,121,119,122,121,119,
-    121,121,119,121,122,120,121,123,121,120,122,121,120,122,121,120,
-    122,121,119,121,122,120,121,122,120,121,122,121,120,122,121,120,
-    122,121,120,122,122,120,121,122,120,120,122,120,120,122,120,120,
-    122,121,120,121,121,119,121,122,120,121,122,121,121,122,121,121,
-    122,121,120,122,121,120,122,122,120,122,122,120,121,122,121,121,
-    122,121,121,122,121,120,122,122,121,122,122,120,122,122,120,121,
-    122,120,121,122,121,120,122,121,121,122,121,120,122,121,120,121,
-    121,120,121,122,120,121,122,121,121,122,121,121,122,122,120,122,
-    122,121,122,122,121,121,122,120,121,122,121,120,122,121,120,122,
-    122,120,121,121,120,121,122,120,120,121,120,120,122,121,120,121,
-    121,119,121,121,120,121,122,120,121,122,120,120,122,121,120,122,
-    121,120,121,121,120,121,122,120,120,122,120,120,122,121,120,122,
-    121,120,122,121,120,121,121,120,121,121,120,120,122,120,120,122,
-    121,120,122,120,120,121,121,120,122,122,120,121,122,121,121,123,
-    121,121,122,121,121,122,122,121,122,122,121,122,122,121,122,122,
-    121,121,122,121,121,122,121,120,122,121,120,122,122,120,121,122,
-    120,121,122,121,121,122,121,121,122,121,120,122,121,120,121,122,
-    120,121,122,120,120,122,120,120,122,121,121,122,122,120,122,122,
-    120,122,122,120,121,122,120,121,122,121,120,122,121,120,122,121,
-    120,122,121,119,121,121,119,120,121,120,120,122,120,120,121,120,
-    120,121,121,120,121,121,120,121,122,120,120,122,120,120,122,121,
-    120,122,121,120,122,122,120,121,122,120,121,122,120,120,122,120,
-    120,122,121,120,122,121,120,121,122,120,122,122,121,121,122,121,
-    121,122,121,121,122,122,121,122,122,120,122,122,121,122,123,121,
-    121,123,121,121,122,121,121,122,122,121,122,122,120,121,121,120,
-    121,121,120,120,121,120,120,122,121,120,122,121,120,121,121,120,
-    121,122,120,121,122,120,121,122,121,120,122,121,120,121,121,120,
-    121,121,120,121,122,120,121,122,121,121,122,121,120,122,121,120,
-    122,121,120,121,122,120,121,122,121,121,122,121,121,122,121,121,
-    122,121,120,122,122,121,121,122,121,122,122,121,121,122,121,120,
-    122,121,121,122,121,120,122,122,120,121,122,120,121,122,120,120,
-    121,120,120,121,121,120,122,121,120,121,122,121,121,122,121,121,
-    122,121,121,122,121,121,122,121,121,121,121,120,121,121,120,121,
-    121,120,121,121,120,120,121,120,120,121,120,120,120,120,120,120,
-    121,120,121,121,120,121,121,121,120,121,121,121,122,121,121,122,
-    122,121,122,122,121,122,122,121,121,121,121,121,122,121,120,121,
-    121,120,121,121,121,121,122,121,121,122,121,120,122,121,121,122,
-    121,120,121,122,121,122,122,121,122,122,121,121,122,121,121,122,
-    122,121,122,122,121,122,122,121,122,122,121,121,122,121,121,122,
-    121,121,122,121,120,121,121,120,121,122,120,121,122,120,121,122,
-    121,121,122,121,120,122,121,120,122,121,120,121,121,120,121,122,
-    120,121,121,121,120,121,121,120,121,121,120,121,121,120,121,121,
-    120,120,121,121,120,121,121,120,121,121,120,121,121,120,121,121,
-    120,121,122,121,121,122,121,120,122,121,120,121,121,120,121,122,
-    120,121,122,120,121,122,121,121,122,121,120,121,121,120,121,121,
-    120,121,122,120,121,122,121,121,122,121,121,122,121,121,122,122,
-    121,122,122,121,122,122,121,121,122,121,121,122,121,121,122,121,
-    121,122,122,120,122,122,121,121,121,120,121,121,120,120,121,120,
-    120,121,121,120,121,121,120,121,121,120,120,121,120,120,121,120,
-    120,122,121,120,121,121,120,121,121,120,121,122,121,121,122,121,
-    121,122,121,121,122,121,121,122,122,121,121,122,120,121,122,121,
-    121,122,121,121,122,121,121,122,121,121,122,122,121,121,122,121,
-    121,122,121,121,122,121,121,122,121,120,122,121,120,121,121,121,
-    121,122,121,121,122,121,121,122,121,121,122,121,120,121,121,120,
-    121,121,120,121,122,121,121,122,121,121,122,121,121,122,121,121,
-    122,122,121,122,122,121,121,122,121,121,122,121,121,121,121,120,
-    121,121,120,121,121,120,121,121,120,121,121,120,121,121,120,120,
-    121,120,120,121,121,120,121,121,120,120,121,120,120,121,120,120,
-    121,120,120,121,121,121,122,121,121,122,122,121,122,122,121,122,
-    122,121,121,122,122,121,122,122,121,122,122,121,122,122,122,122,
-    122,121,121,122,121,121,121,120,120,121,121,120,121,121,120,120,
-    121,120,120,121,120,120,121,120,120,121,121,120,121,121,120,121,
-    121,120,121,122,121,121,122,121,122,122,122,122,122,122,121,122,
-    122,122,122,122,122,122,123,122,122,122,122,121,122,121,121,122,
-    121,120,121,121,120,121,121,120,120,120,120,120,121,120,120,121,
-    121,120,121,120,120,121,121,120,121,121,120,121,121,120,121,121,
-    121,121,121,121,121,122,121,121,122,122,121,121,121,121,121,121,
-    120,120,121,121,120,121,121,121,121,121,121,122,122,121,121,121,
-    121,121,122,121,121,122,121,121,122,122,121,122,122,121,121,121,
-    120,121,121,121,121,121,120,120,121,120,120,121,121,120,121,121,
-    120,121,121,120,121,122,121,121,122,121,121,122,121,121,122,121,
-    121,121,121,121,121,122,121,122,122,121,121,122,121,121,122,122,
-    121,122,122,121,122,122,121,122,122,121,121,122,121,121,122,121,
-    121,122,121,121,121,122,121,121,121,120,121,121,121,121,121,121,
-    120,121,121,120,121,121,120,121,121,120,121,121,120,121,121,121,
-    121,121,121,120,121,121,120,121,121,120,121,121,120,121,121,120,
-    121,121,121,121,122,121,121,121,121,121,121,121,121,121,121,121,
-    121,122,121,121,122,121,121,121,121,121,121,121,121,121,121,121,
-    121,122,121,121,121,120,121,121,121,121,121,121,120,121,121,120,
-    121,121,120,121,121,120,121,121,121,121,122,121,121,122,121,121,
-    121,121,121,121,121,121,121,121,121,121,122,121,121,122,121,121,
-    122,121,121,121,121,121,121,121,121,121,122,121,121,122,121,121,
-    122,121,121,121,121,121,121,121,121,121,121,121,121,122,121,121,
-    122,121,121,121,121,121,121,121,120,121,121,121,121,121,121,121,
-    121,121,121,122,121,121,122,121,121,122,121,121,121,121,121,121,
-    121,121,121,121,120,120,121,121,120,121,121,120,121,120,120,120,
-    120,120,120,121,120,120,121,120,120,121,121,120,121,121,120,121,
-    121,121,121,121,121,121,122,121,121,122,121,121,122,121,121,122,
-    121,121,122,122,121,122,122,121,121,121,121,120,121,120,120,121,
-    120,120,121,120,120,121,121,120,121,121,120,120,121,120,120,121,
-    121,121,121,121,120,121,121,121,121,121,121,121,122,121,121,122,
-    121,122,122,121,121,122,121,121,122,122,121,122,122,121,122,122,
-    121,121,122,121,121,122,122,121,122,122,122,122,122,122,122,122,
-    122,122,122,122,122,122,122,122,122,122,121,122,122,121,122,122,
-    121,121,122,121,121,122,121,121,122,121,121,122,121,121,121,121,
-    121,121,121,120,121,121,120,120,121,121,121,121,120,120,121,121,
-    120,121,121,120,121,121,121,121,121,120,121,121,120,121,121,121,
-    120,121,120,120,121,121,120,121,121,120,121,121,120,121,121,121,
-    120,121,120,120,121,121,120,121,121,120,120,121,120,121,121,120,
-    120,121,120,120,121,121,120,121,121,120,120,120,120,121,121,121,
-    121,121,121,121,121,121,120,121,121,120,121,121,120,121,121,121,
-    121,122,121,122,122,122,122,122,122,122,122,122,122,122,122,121,
-    122,122,122,122,122,121,121,122,121,121,122,121,121,122,122,121,
-    122,122,121,121,122,121,121,121,121,121,122,121,121,122,121,121,
-    122,121,121,122,122,121,121,122,121,121,122,121,121,122,121,121,
-    122,121,121,122,121,121,121,121,120,121,121,121,121,121,120,120,
-    121,120,120,121,121,120,121,121,120,120,121,120,120,120,120,120,
-    121,120,120,121,121,121,122,121,121,121,121,121,121,121,121,121,
-    121,121,120,121,121,121,121,121,120,121,121,120,121,121,121,121,
-    121,120,121,121,121,121,121,121,120,121,121,121,121,121,120,121,
-    121,120,120,121,120,121,121,121,121,121,121,121,122,121,121,121,
-    121,121,121,122,121,121,122,121,121,122,121,121,122,122,122,122,
-    122,122,122,122,121,122,122,121,121,121,121,121,122,121,121,122,
-    122,121,122,122,121,121,121,121,121,121,120,121,121,121,121,121,
-    121,121,121,121,120,121,121,120,121,121,120,121,122,121,121,122,
-    121,121,122,121,121,122,121,121,122,122,121,121,121,120,121,121,
-    121,121,122,121,121,122,121,121,122,122,121,122,122,121,121,122,
-    121,121,122,121,121,121,120,120,121,121,120,121,121,120,121,121,
-    120,120,121,120,120,120,119,119,120,119,119,120,119,119,120,120,
-    119,120,120,120,120,121,120,120,121,120,121,122,121,121,122,122,
-    121,122,122,122,122,123,122,122,123,122,122,123,122,122,123,123,
-    122,123,123,122,123,123,123,123,123,122,122,122,122,122,122,122,
-    121,122,121,121,121,121,120,121,121,120,121,121,120,121,121,120,
-    120,121,120,120,121,120,120,121,120,120,121,121,120,120,121,120,
-    120,121,120,120,121,121,120,121,121,120,121,121,121,121,122,121,
-    121,122,121,121,122,121,121,122,122,121,122,121,121,122,121,120,
-    121,122,121,121,122,121,121,122,121,121,122,122,121,122,122,121,
-    122,122,121,121,122,121,121,122,121,121,122,121,121,122,122,121,
-    121,121,120,121,121,120,121,121,120,120,121,120,120,121,120,120,
-    121,121,120,120,121,120,120,121,120,120,121,120,120,121,120,120,
-    121,121,120,120,120,119,120,120,119,120,121,120,120,121,120,120,
-    121,120,120,121,121,120,121,121,120,121,121,120,121,121,121,121,
-    122,121,121,122,121,120,121,121,120,121,121,120,121,121,120,121,
-    122,121,121,122,121,121,122,121,121,122,122,121,122,123,122,122,
-    123,122,122,123,122,122,123,122,122,123,122,122,123,123,122,123,
-    123,121,122,123,122,122,123,122,121,122,121,121,122,122,121,122,
-    122,121,121,122,121,121,122,121,121,122,121,121,122,121,120,121,
-    121,120,121,121,120,121,121,120,120,121,120,120,121,120,120,121,
-    120,119,121,120,120,121,121,120,120,121,120,121,121,120,120,121,
-    121,120,121,121,120,121,121,120,121,122,120,121,122,120,121,122,
-    121,121,122,121,120,121,121,120,122,122,121,121,122,121,121,122,
-    121,121,122,121,121,122,122,120,122,121,120,121,121,120,121,121,
-    120,120,121,120,120,121,120,120,121,121,120,121,121,120,121,122,
-    120,121,122,120,120,121,120,120,120,120,119,120,120,119,120,121,
-    120,120,121,120,120,121,120,120,122,121,121,122,122,121,122,122,
-    121,122,122,121,122,123,122,122,123,122,121,122,122,122,123,122,
-    121,122,122,121,122,122,122,122,123,121,121,122,121,121,122,121,
-    120,121,121,120,120,121,119,120,120,119,120,121,120,120,121,120,
-    120,121,120,120,121,121,120,121,121,120,121,121,120,121,122,121,
-    121,122,121,121,122,121,121,122,122,121,122,122,121,122,122,122,
-    122,122,122,121,122,122,121,122,122,122,122,122,121,122,122,121,
-    122,122,121,121,122,121,121,122,121,121,122,121,121,122,122,121,
-    122,122,121,121,122,121,121,122,120,120,121,121,120,121,121,120,
-    121,121,120,121,121,120,120,121,120,120,121,120,120,121,120,119,
-    121,121,120,121,121,120,121,121,120,120,122,120,120,121,120,120,
-    121,121,120,121,121,120,121,121,120,120,121,120,120,122,121,120,
-    121,121,120,122,121,120,121,121,120,121,122,121,121,122,121,121,
-    123,122,121,123,122,121,122,122,121,122,123,121,122,123,121,121,
-    123,121,121,122,122,121,122,122,121,121,122,120,121,122,120,121,
-    121,120,120,121,120,120,121,120,119,121,121,119,120,121,120,120,
-    121,119,120,121,120,120,122,121,120,121,121,120,121,121,120,121,
-    122,120,121,122,121,121,122,122,121,123,121,121,122,122,120,122,
-    122,121,121,122,120,121,122,121,121,122,121,120,122,121,120,122,
-    122,120,121,122,120,121,123,121,121,123,121,121,122,121,121,122,
-    122,121,122,122,121,121,122,120,121,122,121,120,122,121,120,122,
-    121,120,122,122,120,121,122,120,121,121,120,120,121,120,120,121,
-    120,119,121,121,119,121,121,120,121,121,120,121,122,121,121,122,
-    121,121,122,121,121,122,122,121,122,122,121,121,122,120,121,122,
-    121,121,123,122,121,123,122,121,122,122,121,122,122,121,121,122,
-    120,121,122,121,121,122,121,120,121,121,120,121,121,120,121,121,
-    120,121,121,120,120,121,120,120,122,121,120,121,121,119,121,121,
-    120,121,121,120,121,122,121,121,122,121,120,122,121,120,122,122,
-    120,122,122,120,121,122,120,121,122,120,121,122,121,120,122,121,
-    120,121,121,120,121,122,120,121,122,121,121,122,121,120,122,121,
-    120,121,121,120,121,121,120,121,122,121,121,122,121,121,122,121,
-    121,123,122,121,122,122,121,122,123,121,122,122,121,121,122,121,
-    121,122,121,120,122,121,120,121,121,120,121,121,119,120,121,119,
-    120,121,120,119,121,120,119,121,120,119,121,120,119,120,121,119,
-    120,121,120,120,121,120,120,122,121,120,122,122,120,122,122,120,
-    121,122,121,121,122,121,121,123,122,121,122,122,121,122,122,121,
-    122,122,121,122,123,121,122,123,121,122,123,122,121,123,122,121,
-    123,122,121,122,123,121,122,123,122,122,123,122,121,123,122,121,
-    123,122,121,122,122,121,122,123,121,121,122,120,120,121,120,120,
-    121,120,119,121,120,119,120,121,119,120,121,119,120,121,119,119,
-    121,120,119,121,121,119,121,121,119,121,121,119,120,121,120,120,
-    122,120,120,121,121,119,121,121,120,121,122,120,121,122,120,120,
-    122,120,120,122,120,120,122,121,120,122,122,121,122,122,121,122,
-    123,121,121,122,121,120,122,121,120,122,121,120,122,122,120,121,
-    122,120,121,122,120,121,122,121,120,122,121,120,122,121,120,121,
-    122,120,121,122,120,120,122,120,120,122,121,120,122,121,120,122,
-    122,120,122,122,120,121,123,121,121,122,121,121,123,122,121,123,
-    122,121,122,122,121,122,123,121,122,123,121,122,123,122,121,123,
-    122,121,123,122,120,122,122,120,121,122,120,121,122,120,120,122,
-    120,120,122,121,119,121,121,119,120,121,119,120,121,119,119,121,
-    119,119,121,120,119,120,120,119,120,121,119,120,121,120,120,121,
-    120,120,122,120,120,122,121,120,122,121,120,121,122,120,121,122,
-    120,121,122,121,120,122,121,120,122,121,121,122,122,121,122,122,
-    121,121,122,121,121,123,121,121,122,121,121,122,121,120,122,122,
-    121,122,122,121,122,123,122,122,123,121,121,123,122,121,122,122,
-    121,122,122,121,122,122,121,121,122,121,121,123,121,121,122,121,
-    120,122,121,120,121,122,120,121,122,120,121,122,120,120,122,120,
-    120,122,121,120,121,121,120,121,122,120,121,122,121,121,123,121,
-    121,123,122,121,123,122,120,122,122,120,122,122,120,121,122,120,
-    120,122,120,119,122,120,119,121,121,119,121,122,119,120,122,120,
-    120,122,121,120,122,120,119,121,121,119,121,121,119,121,122,119,
-    120,122,120,120,122,120,119,121,120,119,121,121,119,121,121,119,
-    121,121,120,120,122,120,120,122,121,120,122,122,120,122,122,120,
-    121,122,120,121,122,120,121,122,121,120,122,121,120,122,122,120,
-    122,122,120,122,122,120,121,123,121,121,123,121,121,123,122,121,
-    123,122,120,122,122,120,122,123,121,121,123,121,121,123,121,121,
-    123,122,120,122,122,120,121,122,119,121,122,120,120,122,120,120,
-    122,120,120,122,121,119,121,122,120,121,122,120,120,122,120,120,
-    122,120,120,122,121,120,122,121,120,121,122,120,121,122,120,121,
-    123,121,121,123,121,120,122,121,120,122,122,120,121,122,120,121,
-    122,120,120,122,121,120,122,121,120,122,122,120,121,122,120,121,
-    122,120,121,122,120,121,122,121,120,122,121,120,121,121,120,121,
-    121,120,121,122,121,121,122,121,121,122,121,121,122,121,120,122,
-    122,120,122,122,121,121,122,121,121,122,121,121,122,121,121,122,
-    121,120,122,122,121,122,122,120,121,122,120,121,122,121,121,122,
-    121,120,122,121,120,122,122,120,121,122,120,121,122,120,121,122,
-    121,121,122,121,121,122,122,120,122,122,120,121,122,120,121,122,
-    120,121,122,121,120,122,121,120,121,121,120,121,122,120,121,122,
-    120,120,122,120,120,122,121,120,122,121,120,121,122,120,121,122,
-    119,120,122,120,119,121,120,119,121,120,119,121,121,119,121,122,
-    120,121,122,120,121,122,121,120,123,121,120,122,122,120,121,122,
-    120,121,122,120,121,122,120,120,122,121,120,122,121,120,121,121,
-    120,121,122,120,121,122,120,121,123,121,121,123,122,121,123,122,
-    120,122,122,120,121,122,120,121,122,120,120,122,120,120,122,121,
-    119,122,121,120,122,122,120,121,122,120,121,123,120,121,123,121,
-    120,123,121,120,122,122,120,122,122,120,121,122,120,120,123,120,
-    120,122,121,120,122,121,120,122,122,120,121,122,120,121,123,120,
-    121,123,121,120,123,121,120,122,121,119,122,122,120,121,122,120,
-    121,123,121,121,123,121,120,123,122,120,122,122,120,121,122,120,
-    121,122,120,120,122,120,120,122,120,119,121,121,119,121,122,120,
-    121,122,120,121,122,120,121,122,121,120,122,121,120,122,121,120,
-    122,122,120,121,122,120,121,122,121,121,122,121,120,122,121,120,
-    122,122,120,122,122,120,122,122,121,121,122,120,120,122,120,120,
-    121,121,120,122,121,120,121,121,120,121,121,120,120,121,120,120,
-    121,120,120,121,121,120,121,121,120,121,122,120,121,122,120,120,
-    122,120,120,122,121,120,122,121,120,122,121,120,121,122,120,121,
-    122,121,121,123,121,121,122,122,120,122,122,121,122,122,121,122,
-    123,121,121,123,121,121,123,121,120,122,122,120,122,122,120,121,
-    122,120,121,122,120,120,122,120,120,122,121,119,121,121,119,121,
-    121,119,120,122,120,120,122,120,120,122,121,120,122,122,120,122,
-    122,120,122,123,121,122,123,121,121,123,122,121,123,122,121,123,
-    123,121,122,122,121,122,123,121,121,123,121,120,122,120,120,121,
-    121,119,121,121,119,121,121,119,120,121,119,120,121,120,119,121,
-    120,119,121,121,119,121,121,120,121,122,120,121,122,120,120,122,
-    120,120,122,121,120,122,121,119,121,122,119,121,122,119,120,122,
-    120,120,122,120,120,122,121,120,122,122,120,122,122,120,121,123,
-    120,121,123,121,121,123,121,120,123,122,120,123,123,120,122,123,
-    120,121,123,121,121,123,121,120,123,121,120,122,122,120,122,122,
-    119,121,122,120,121,122,120,120,123,121,120,122,122,120,122,122,
-    119,121,122,120,121,123,120,120,123,121,120,123,121,120,122,122,
-    120,122,122,120,122,123,121,121,123,121,121,123,121,120,122,121,
-    120,122,122,120,121,121,120,121,122,120,120,122,120,120,121,120,
-    120,121,121,120,122,121,120,122,122,120,121,122,120,121,122,121,
-    120,122,121,120,122,121,120,121,121,120,121,121,119,120,121,119,
-    120,121,120,120,121,120,120,122,121,120,122,122,120,122,122,120,
-    121,122,120,121,122,121,121,123,122,121,123,122,121,122,122,120,
-    121,122,120,121,122,120,120,122,121,120,122,121,120,121,121,120,
-    121,122,120,121,122,120,120,122,120,120,122,121,120,122,122,120,
-    122,122,120,121,122,120,121,122,120,120,122,121,120,122,121,119,
-    121,121,119,121,122,119,120,122,120,120,122,121,120,122,121,120,
-    122,121,120,122,122,120,122,122,120,121,123,121,121,122,121,120,
-    122,121,120,122,121,120,121,122,120,121,122,120,121,122,121,121,
-    122,121,120,122,122,120,122,122,120,122,122,120,121,122,120,121,
-    122,121,121,122,121,120,122,122,120,122,122,120,121,123,120,121,
-    123,120,120,122,120,120,122,121,119,122,121,119,121,122,119,121,
-    122,120,121,123,120,120,122,121,120,122,121,120,122,122,120,122,
-    122,120,121,122,119,120,122,120,120,122,120,120,122,121,120,122,
-    122,120,121,123,120,121,123,120,120,123,121,120,122,121,120,122,
-    122,119,121,122,119,121,122,120,120,122,120,120,122,121,120,122,
-    121,119,122,122,119,121,122,120,120,122,120,120,122,121,120,122,
-    121,120,122,122,120,121,122,120,121,122,120,121,122,121,120,122,
-    121,120,122,121,120,122,122,120,121,122,120,121,122,121,121,123,
-    121,120,122,121,120,122,121,120,122,121,120,121,122,120,121,122,
-    120,120,122,120,120,122,120,120,122,121,120,122,122,120,121,122,
-    120,121,122,121,121,123,121,121,122,121,120,122,121,120,122,122,
-    120,121,122,120,121,122,121,121,123,121,120,123,121,120,122,122,
-    120,122,122,120,121,122,120,121,123,121,120,122,121,120,122,122,
-    120,122,122,120,122,122,120,121,123,120,121,123,121,120,122,121,
-    120,122,121,119,121,122,120,121,122,120,120,122,120,120,122,120,
-    120,122,121,119,121,121,119,121,122,120,121,122,120,120,122,121,
-    120,122,121,120,122,121,120,121,121,120,121,122,120,121,122,120,
-    120,122,120,120,122,121,120,121,121,120,121,121,120,121,121,120,
-    121,122,121,121,122,121,120,122,121,120,122,122,120,122,122,120,
-    121,122,120,121,122,121,121,122,121,120,122,122,120,122,122,120,
-    122,122,120,121,122,120,121,122,121,120,122,121,120,122,122,120,
-    122,122,120,121,123,120,121,123,120,120,122,121,120,122,121,119,
-    122,122,120,121,122,120,121,123,120,121,123,121,120,123,121,120,
-    123,122,120,122,123,120,122,123,121,121,123,121,120,123,121,120,
-    123,122,120,122,122,120,121,122,120,121,122,120,120,122,120,120,
-    122,121,119,121,121,119,121,121,119,121,122,120,120,122,120,120,
-    122,120,119,122,121,119,121,121,120,121,121,119,120,122,120,120,
-    122,120,120,122,121,120,122,121,120,122,122,120,121,122,120,121,
-    122,120,121,122,121,121,122,121,120,122,121,120,122,121,120,122,
-    122,120,121,122,120,120,122,121,120,122,121,120,122,121,120,121,
-    121,120,121,122,120,121,122,120,121,122,121,120,122,121,120,122,
-    122,120,122,122,120,121,122,120,121,122,121,121,122,121,120,122,
-    121,120,122,122,120,121,122,120,121,122,120,120,122,121,120,122,
-    121,120,122,121,120,122,122,119,121,122,120,121,122,120,120,122,
-    121,120,122,121,120,122,121,120,121,122,120,121,122,120,121,123,
-    121,121,123,121,120,122,122,120,122,122,120,121,122,120,121,122,
-    120,120,122,121,120,122,121,120,122,122,120,122,122,120,121,122,
-    120,121,122,120,120,122,121,120,122,121,120,121,121,119,121,121,
-    119,120,121,120,120,122,120,120,122,121,120,122,121,120,121,121,
-    120,121,122,120,121,123,121,122,123,121,121,123,122,121,123,122,
-    121,123,123,121,122,123,121,121,123,121,121,123,121,120,122,121,
-    120,122,122,120,121,122,120,121,122,120,120,122,120,120,122,121,
-    120,122,121,119,121,121,119,120,121,119,120,122,120,120,122,120,
-    120,122,121,120,122,122,120,122,122,120,121,123,120,121,123,120,
-    120,123,121,120,123,122,120,122,122,120,122,123,120,121,123,120,
-    120,123,121,120,122,121,120,122,122,120,121,122,120,121,122,120,
-    120,122,120,120,121,120,119,121,120,118,120,120,119,120,121,119,
-    120,121,120,120,122,120,120,122,121,120,123,122,121,122,123,121,
-    122,123,121,121,122,121,121,122,121,121,122,121,120,122,121,120,
-    122,122,120,122,122,121,121,123,121,121,123,121,121,123,122,121,
-    123,122,121,122,122,120,122,122,120,121,122,120,120,122,120,120,
-    122,121,120,121,121,119,121,122,120,120,122,119,120,122,120,120,
-    122,120,119,121,120,119,121,121,119,121,121,119,120,122,120,120,
-    122,120,120,122,121,120,122,122,120,122,122,120,121,122,120,121,
-    122,121,121,123,121,120,122,122,120,122,122,120,122,123,121,122,
-    123,121,121,123,121,120,122,121,120,122,121,120,122,122,121,122,
-    122,121,122,123,121,121,123,121,121,122,122,121,122,122,120,122,
-    122,120,121,122,120,121,122,121,121,122,121,121,122,122,121,122,
-    122,121,122,122,121,122,123,121,121,123,121,121,122,121,121,122,
-    121,120,121,121,120,121,122,120,120,121,120,120,121,120,119,121,
-    120,119,120,120,119,120,120,119,120,121,120,120,122,120,120,122,
-    120,120,122,121,120,122,122,120,122,122,120,121,123,120,121,123,
-    121,120,123,121,120,122,122,120,121,122,119,121,122,120,120,122,
-    120,120,122,120,119,122,121,119,122,122,120,122,122,120,122,123,
-    121,121,123,121,121,123,122,120,122,122,120,122,123,120,122,123,
-    120,121,123,121,120,123,121,120,123,122,120,122,122,120,122,122,
-    120,121,122,120,120,122,120,120,122,121,120,122,121,120,122,122,
-    120,121,122,120,121,122,120,120,122,120,120,121,120,119,121,121,
-    120,121,121,120,121,122,120,121,122,120,121,122,120,120,122,121,
-    120,122,121,120,122,122,120,122,122,121,122,123,121,121,123,121,
-    121,123,121,121,122,122,120,122,122,120,121,122,120,120,122,120,
-    120,122,121,120,122,121,120,121,121,120,121,122,120,121,122,121,
-    121,122,121,121,122,121,120,122,121,120,122,122,120,121,122,120,
-    121,122,120,120,122,121,120,122,121,120,122,122,120,122,122,120,
-    121,122,120,120,122,120,120,122,121,119,122,121,120,121,121,120,
-    121,122,120,121,122,121,121,123,121,121,122,121,121,122,122,120,
-    121,121,120,121,122,120,120,121,120,120,121,120,120,121,120,120,
-    121,121,120,121,121,119,120,121,120,120,121,120,120,121,120,120,
-    121,121,120,121,121,120,121,121,120,121,122,121,121,122,121,121,
-    123,122,121,123,122,121,123,123,122,123,123,122,123,124,122,122,
-    123,122,122,124,123,122,123,123,121,123,123,121,122,123,121,121,
-    122,121,121,123,121,120,122,122,120,122,122,120,122,122,120,121,
-    122,120,121,122,121,120,122,121,120,122,121,119,121,121,119,120,
-    121,119,120,121,120,119,121,120,119,121,120,118,120,120,118,120,
-    121,119,120,121,119,120,121,120,119,121,120,119,121,120,119,121,
-    121,119,121,121,119,120,122,120,120,122,121,120,122,121,120,122,
-    122,120,122,122,120,121,122,121,121,123,121,120,122,121,121,122,
-    122,120,122,122,121,122,123,121,122,123,121,121,122,121,120,122,
-    121,120,122,122,120,122,122,121,122,122,121,121,123,121,121,122,
-    121,120,122,121,120,122,122,120,122,122,120,121,122,120,121,122,
-    120,120,122,120,120,122,121,120,122,121,120,121,122,120,121,122,
-    120,121,122,121,121,122,121,121,122,122,120,122,122,121,122,123,
-    121,122,123,121,121,122,121,121,122,121,120,122,121,120,121,122,
-    120,121,122,120,121,122,121,120,122,121,120,122,122,120,122,122,
-    120,121,122,120,121,122,120,121,122,120,120,122,121,120,121,121,
-    120,121,121,120,121,122,121,121,122,121,121,122,121,121,122,121,
-    120,122,121,120,121,121,120,121,122,120,121,122,121,121,122,121,
-    120,121,120,120,121,121,120,121,121,120,121,121,120,120,121,120,
-    120,122,121,120,121,121,120,121,121,120,121,122,120,121,122,120,
-    121,122,121,121,122,121,121,122,122,121,122,122,121,122,123,121,
-    121,122,121,121,122,121,121,122,121,120,122,122,120,121,122,120,
-    121,122,120,120,122,120,120,122,120,120,122,121,120,121,121,120,
-    121,122,120,121,122,120,120,122,121,120,122,121,120,122,122,120,
-    122,122,120,121,122,120,121,122,120,120,122,121,120,122,121,120,
-    121,121,119,120,121,119,120,121,120,120,122,121,120,122,121,120,
-    122,122,120,121,122,120,121,122,120,121,122,121,120,122,121,120,
-    122,121,120,121,121,120,121,122,120,121,123,121,121,123,121,121,
-    122,121,120,122,122,121,122,122,121,122,122,121,121,122,121,120,
-    122,120,120,122,121,120,121,121,120,121,121,120,121,122,121,121,
-    122,121,121,122,121,121,122,121,121,122,122,120,122,122,120,121,
-    122,120,121,122,120,120,122,120,120,122,121,120,121,121,120,121,
-    122,120,121,122,120,121,122,121,120,122,121,120,121,121,120,121,
-    121,120,121,121,120,120,122,121,120,122,121,120,122,121,121,122,
-    122,120,122,122,121,121,122,120,121,122,121,121,122,121,121,122,
-    121,120,122,122,120,121,121,120,121,122,120,120,121,120,120,121,
-    120,120,121,121,120,121,121,120,121,122,120,121,122,121,121,122,
-    122,121,122,121,121,122,121,121,122,122,121,121,122,121,121,122,
-    121,121,122,121,121,122,121,121,122,122,121,121,121,120,121,121,
-    120,120,121,120,120,121,120,120,121,121,120,121,121,120,121,121,
-    120,121,122,121,121,122,121,121,122,121,121,122,121,120,122,122,
-    121,121,122,120,121,122,120,120,121,120,120,121,121,120,122,121,
-    120,121,121,120,121,122,121,121,122,121,121,122,121,121,122,122,
-    121,122,122,120,122,122,121,121,123,121,121,122,121,120,122,121,
-    120,122,122,120,122,122,120,121,122,120,121,122,120,120,122,121,
-    120,122,121,120,121,122,120,121,122,120,121,122,121,120,122,121,
-    120,122,121,120,121,121,119,121,121,120,120,121,120,120,121,120,
-    120,122,121,120,122,121,121,122,122,121,122,122,121,121,122,121,
-    121,122,121,121,122,121,121,122,121,121,122,122,120,122,122,121,
-    121,122,121,121,122,121,120,122,121,120,122,121,120,121,121,120,
-    121,121,120,120,121,120,120,121,120,120,121,121,120,122,121,120,
-    122,122,121,121,122,121,121,122,121,121,122,121,121,122,122,121,
-    122,122,121,122,123,121,122,123,121,121,122,121,120,122,121,120,
-    122,122,120,121,122,120,121,122,120,120,121,120,120,121,121,120,
-    121,121,120,121,121,120,120,121,120,120,121,120,120,121,120,119,
-    121,120,120,121,121,120,121,122,120,121,122,121,121,122,121,121,
-    122,121,121,122,121,121,122,122,121,122,122,121,122,122,121,121,
-    122,121,121,122,121,121,122,121,121,121,121,120,121,122,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,122,122,121,121,122,121,121,122,121,121,122,121,121,121,
-    121,120,121,121,120,121,121,120,121,121,120,120,121,121,120,121,
-    121,120,121,121,120,121,122,120,121,122,120,121,122,121,120,121,
-    121,120,122,122,120,121,121,120,121,122,121,121,122,121,121,122,
-    121,121,122,122,120,122,122,121,122,122,121,121,122,121,121,122,
-    121,121,122,122,121,122,121,120,121,122,120,121,122,120,120,121,
-    120,120,121,121,120,121,121,120,121,121,120,121,121,120,121,121,
-    120,120,122,121,120,121,121,120,122,121,120,121,121,120,121,121,
-    120,120,122,121,120,122,121,121,122,121,120,121,122,121,121,122,
-    121,121,122,121,121,122,121,121,122,121,121,122,122,121,122,122,
-    121,122,122,121,121,122,121,121,122,121,121,122,121,120,121,121,
-    120,121,121,120,121,121,120,120,121,120,120,121,121,120,122,121,
-    120,122,122,121,122,122,120,121,122,121,121,122,121,121,122,121,
-    121,122,121,120,122,121,120,121,122,120,121,122,121,121,122,121,
-    120,122,121,120,122,122,120,121,121,120,121,122,120,121,122,121,
-    120,122,121,120,121,121,120,121,122,120,121,122,120,121,122,121,
-    120,121,121,120,121,121,120,121,121,120,121,121,120,121,121,120,
-    121,122,121,120,121,121,120,121,121,120,121,121,120,121,122,121,
-    121,122,121,122,122,121,121,122,121,121,122,121,121,122,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,120,121,121,120,
-    121,121,120,121,121,120,121,121,121,121,121,121,121,121,121,121,
-    122,122,121,122,122,121,122,122,121,121,122,121,121,122,121,121,
-    122,121,121,121,121,120,121,121,120,121,121,120,121,121,120,120,
-    122,121,120,121,121,120,121,122,121,121,122,120,121,122,121,121,
-    122,121,121,122,122,121,122,122,120,121,122,121,121,122,120,121,
-    121,120,120,122,121,120,121,121,120,121,121,120,121,121,120,121,
-    122,121,121,122,121,121,122,121,120,122,121,121,121,121,120,121,
-    121,120,121,121,120,120,121,121,120,121,121,121,122,122,121,122,
-    122,121,121,122,121,121,122,121,121,122,121,121,122,121,121,121,
-    122,121,121,121,120,121,121,121,121,121,121,121,122,121,121,121,
-    121,120,121,121,120,121,121,120,120,121,120,120,121,121,120,121,
-    121,120,121,121,120,121,121,120,121,122,121,121,122,121,121,122,
-    121,120,122,121,120,121,121,120,121,121,120,121,122,121,121,122,
-    121,121,122,121,121,122,122,121,122,122,121,121,122,121,121,122,
-    121,121,122,121,120,121,121,120,121,121,120,121,122,120,121,121,
-    120,120,122,121,120,122,121,120,121,121,120,121,122,120,121,122,
-    120,121,121,121,120,121,121,120,122,121,121,122,122,121,121,122,
-    121,121,122,121,121,122,121,121,122,121,121,122,121,121,122,122,
-    121,121,122,121,122,122,121,121,122,121,121,122,121,121,121,121,
-    120,121,121,120,121,121,120,121,121,121,121,122,121,121,122,122,
-    121,122,122,121,122,121,121,121,121,121,121,121,121,120,121,120,
-    120,120,120,120,121,120,119,120,120,120,120,121,120,120,121,120,
-    120,121,121,121,121,121,120,121,121,120,121,121,120,121,121,121,
-    121,122,121,121,122,121,121,122,122,121,122,122,121,122,122,121,
-    121,122,121,121,122,121,121,122,121,121,122,122,121,122,122,121,
-    122,122,121,121,122,121,121,122,121,121,122,122,121,122,122,121,
-    121,122,121,121,122,121,121,122,121,120,121,121,120,120,120,120,
-    121,121,120,120,121,120,120,121,120,120,121,120,120,121,121,120,
-    121,121,120,121,121,120,121,121,120,120,121,120,120,121,121,120,
-    121,121,120,121,121,120,121,121,120,121,121,121,121,122,121,121,
-    122,121,121,122,122,121,122,122,121,122,122,121,122,122,121,121,
-    123,122,121,122,122,121,122,122,121,122,122,121,122,122,121,121,
-    122,121,121,122,121,120,121,121,120,121,121,120,121,121,120,121,
-    122,121,121,122,121,121,122,122,121,122,122,121,122,122,121,122,
-    122,121,121,122,121,120,122,121,120,122,121,120,121,121,120,121,
-    121,120,120,121,120,120,121,121,120,121,121,120,121,121,120,121,
-    121,120,120,121,120,120,121,120,120,121,120,120,121,120,120,121,
-    121,120,121,121,120,121,121,120,121,121,121,121,121,121,121,121,
-    121,121,121,122,121,121,122,121,121,122,121,121,122,121,121,122,
-    121,120,121,121,120,121,121,121,121,121,121,121,121,121,121,122,
-    121,121,121,121,121,121,121,121,121,121,121,121,122,121,121,122,
-    121,121,122,121,121,122,121,121,122,122,121,122,122,121,122,122,
-    121,121,122,121,121,122,121,121,122,122,121,122,121,121,121,121,
-    120,121,121,120,121,121,121,120,121,121,120,121,121,120,121,121,
-    120,121,121,120,121,121,121,121,121,120,120,121,121,120,121,121,
-    120,121,121,120,121,121,120,120,121,120,120,121,120,120,121,121,
-    121,121,121,120,121,121,120,121,121,121,121,121,121,121,121,121,
-    120,121,121,121,121,121,121,121,121,121,121,122,121,122,122,122,
-    121,122,122,121,122,122,121,122,122,121,121,121,121,121,122,121,
-    121,122,121,121,122,122,121,122,121,121,122,121,121,121,122,121,
-    121,122,121,121,121,121,120,121,121,120,121,121,120,121,121,120,
-    121,121,120,121,121,121,121,121,121,121,122,121,121,122,122,121,
-    121,122,121,121,122,121,120,121,120,120,121,120,120,121,121,120,
-    121,121,120,121,122,121,121,122,121,121,122,121,121,122,122,121,
-    122,122,121,122,122,121,121,122,121,121,122,121,121,121,121,120,
-    121,121,120,121,121,120,120,121,120,120,121,121,120,121,121,120,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,122,121,121,
-    122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,122,121,121,122,121,121,121,122,121,121,122,121,121,
-    122,121,121,122,121,121,121,121,120,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,120,121,121,120,121,121,120,121,
-    121,120,121,121,120,120,121,121,121,121,121,120,121,121,120,121,
-    121,120,121,121,121,121,121,121,121,121,121,120,121,121,121,121,
-    121,120,121,121,121,121,121,121,121,121,121,121,121,121,120,121,
-    121,120,121,121,120,121,121,121,121,121,121,121,121,121,121,122,
-    122,122,122,122,121,122,123,122,122,123,122,122,122,121,122,122,
-    122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,122,121,121,122,122,121,122,122,121,122,122,
-    121,121,121,121,121,121,121,121,121,121,120,121,121,120,121,121,
-    120,121,121,120,121,121,121,121,121,121,120,121,121,120,121,121,
-    120,120,121,120,121,121,120,120,121,121,121,121,121,120,121,121,
-    120,121,121,121,121,121,121,121,121,121,120,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,122,121,
-    121,122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,122,121,121,121,121,
-    121,122,121,121,121,121,121,121,121,121,121,121,121,122,122,121,
-    121,122,121,122,122,121,121,121,121,121,122,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,122,121,121,122,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,120,120,121,121,121,121,121,121,121,121,120,120,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,120,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,122,
-    122,122,122,122,121,121,121,121,121,121,121,121,121,121,120,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,122,122,121,122,121,121,121,121,121,121,121,
-    121,121,121,122,121,121,122,121,121,122,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,120,120,121,
-    120,120,120,120,120,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,122,121,122,122,
-    121,122,122,121,121,121,121,121,121,121,120,121,121,120,120,120,
-    120,120,120,120,120,120,120,120,120,120,120,121,121,121,121,121,
-    121,121,122,121,122,122,122,122,122,121,121,122,122,121,122,121,
-    121,122,122,121,122,121,121,121,122,121,121,121,121,121,122,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    120,121,121,121,121,121,121,121,121,120,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,122,122,122,122,122,121,122,122,121,
-    121,122,121,121,121,121,121,121,121,120,121,121,120,121,121,121,
-    121,121,121,121,121,121,121,121,121,120,121,121,120,121,121,120,
-    121,121,120,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,122,121,121,122,122,121,
-    122,121,121,122,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,122,121,121,
-    122,122,121,121,121,121,121,121,121,121,121,121,121,121,120,120,
-    121,120,120,121,121,120,121,120,120,121,121,120,120,121,120,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    122,121,121,121,121,121,121,121,121,121,122,121,121,122,121,122,
-    122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,122,122,121,122,122,121,121,122,121,121,122,
-    121,121,122,122,121,122,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,120,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,120,121,121,
-    121,121,121,120,121,121,120,121,121,120,121,121,121,121,121,121,
-    120,121,121,120,121,121,121,121,121,121,121,122,121,121,122,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,122,121,
-    121,122,121,121,122,121,121,121,121,121,121,122,121,122,121,121,
-    121,121,121,121,122,121,121,122,122,121,122,122,121,122,122,121,
-    121,122,121,121,122,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,120,120,
-    121,120,120,121,121,120,121,121,120,121,121,120,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,120,121,121,120,120,
-    121,120,120,121,120,120,121,121,120,121,121,121,121,121,121,121,
-    121,121,121,122,121,121,122,121,122,122,122,121,122,122,121,122,
-    122,121,122,122,121,121,122,121,121,122,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,122,121,121,122,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,122,122,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,122,121,121,122,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,122,121,121,121,121,121,121,121,
-    121,121,121,121,120,121,121,120,121,121,120,121,121,120,121,121,
-    121,121,121,121,121,121,121,121,122,121,121,121,121,121,121,121,
-    120,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,122,121,121,122,121,121,121,121,121,121,121,121,121,121,
-    120,121,121,120,121,121,121,121,121,121,121,121,121,120,121,120,
-    120,121,120,120,121,121,120,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,122,122,121,122,122,121,
-    122,122,122,121,122,122,121,122,122,121,122,122,121,122,122,121,
-    121,121,121,121,122,121,121,121,121,121,121,121,121,121,122,121,
-    121,122,121,121,122,121,121,122,121,121,122,121,121,122,121,121,
-    121,121,121,121,122,121,121,121,121,121,121,121,120,121,121,121,
-    122,121,121,120,120,120,121,121,121,121,121,120,119,120,121,120,
-    121,121,120,120,121,121,121,120,119,122,124,122,122,123,120,119,
-    120,120,120,122,124,121,118,118,119,121,122,123,126,125,123,120,
-    121,121,120,121,123,122,119,117,117,118,119,120,122,124,122,123,
-    125,121,120,121,120,120,120,122,121,120,119,119,120,121,122,123,
-    123,124,124,122,119,118,120,118,119,121,121,119,118,119,118,121,
-    124,125,125,123,122,119,119,120,122,123,120,121,120,118,118,119,
-    124,123,123,125,121,121,120,121,120,120,122,120,122,120,121,122,
-    120,122,121,123,122,123,125,121,121,120,119,118,120,121,122,121,
-    119,121,119,120,121,124,124,121,121,121,118,120,122,122,121,119,
-    119,118,118,122,124,123,124,121,122,118,119,122,120,122,119,121,
-    117,118,121,125,127,126,128,120,123,120,120,126,119,122,118,117,
-    118,117,126,124,123,125,124,122,124,124,124,118,118,119,115,123,
-    121,122,123,120,123,126,120,125,122,118,121,115,122,116,118,121,
-    115,122,121,122,119,122,117,120,123,117,123,120,120,117,120,126,
-    118,126,125,123,122,127,121,116,127,116,122,121,122,126,118,123,
-    125,113,130,114,122,127,121,123,121,117,118,109,130,137,125,139,
-    105,114,119,128,112,124,116,118,118,102,122,113,130,120,133,124,
-    98,150,99,136,138,102,110,122,107,122,133,87,181,120,66,85,
-    104,101,209,136,104,110,65,180,110,166,149,66,122,130,116,139,
-    106,134,135,79,167,112,102,165,73,89,136,107,200,147,102,149,
-    28,143,140,117,198,82,99,101,50,147,137,109,172,95,130,175,
-    127,231,155,102,142,46,106,121,86,137,67,55,125,62,158,174,
-    99,194,87,108,183,100,192,123,49,108,21,123,156,81,193,97,
-    72,158,74,183,163,69,156,64,107,160,67,163,97,41,151,77,
-    159,187,79,176,102,97,192,97,166,148,40,143,74,109,182,65,
-    171,117,64,186,105,179,207,83,158,83,69,169,70,146,129,24,
-    131,78,117,199,78,149,126,73,203,116,169,186,66,149,90,102,
-    199,65,112,94,23,175,106,141,170,48,164,134,117,226,95,138,
-    151,47,131,82,95,163,48,109,93,54,181,109,153,190,82,164,
-    130,126,190,78,119,106,53,140,94,108,146,41,119,115,98,195,
-    134,162,177,112,174,147,126,166,63,86,90,51,148,107,107,149,
-    65,125,123,117,202,126,133,147,78,149,109,88,148,59,99,117,
-    89,171,114,110,152,67,141,138,100,185,99,105,139,65,159,121,
-    77,153,68,118,145,92,177,110,86,157,80,154,176,101,172,82,
-    79,140,87,176,138,73,163,79,121,172,86,182,106,72,157,68,
-    141,168,79,172,87,86,164,66,164,145,70,167,87,117,173,85,
-    163,108,59,151,75,142,158,46,171,97,91,175,101,179,152,73,
-    172,104,109,168,56,129,90,77,170,80,163,139,67,194,120,109,
-    182,103,140,94,77,219,92,143,166,10,75,79,86,209,128,179,
-    183,21,122,77,109,212,141,173,121,44,144,64,94,183,64,147,
-    127,74,166,85,140,176,89,180,122,111,181,63,114,117,56,172,
-    103,112,172,38,112,102,72,180,107,141,144,50,142,103,83,190,
-    94,132,162,87,179,109,107,167,70,150,148,92,175,93,88,142,
-    68,160,135,90,169,63,100,143,89,189,135,111,169,70,126,135,
-    84,184,107,102,148,58,143,108,77,155,72,107,144,86,170,126,
-    96,168,83,146,147,91,158,85,89,137,76,160,141,86,157,76,
-    117,148,104,189,143,113,167,86,130,143,75,163,96,94,149,70,
-    133,112,77,151,109,132,162,91,155,132,98,170,101,160,126,84,
-    137,81,122,143,64,123,97,92,213,85,123,107,56,179,134,157,
-    164,43,121,148,97,194,91,128,153,61,165,104,83,157,70,112,
-    144,80,201,108,108,158,35,159,139,115,190,87,93,121,41,150,
-    134,89,175,61,131,166,123,240,147,103,137,33,104,134,84,177,
-    81,73,133,49,157,142,112,204,99,140,172,82,185,103,51,121,
-    38,140,162,89,180,86,80,157,74,188,167,90,164,65,108,148,
-    68,172,106,61,151,65,149,169,80,180,104,98,183,81,155,137,
-    47,154,83,116,173,58,155,119,82,188,115,179,190,80,140,76,
-    68,156,82,143,134,37,125,76,123,186,84,153,120,91,179,107,
-    154,167,74,158,92,80,166,64,124,119,48,159,121,118,146,74,
-    139,165,150,175,91,120,144,78,133,100,80,119,79,119,114,80,
-    167,131,144,192,118,138,133,108,132,93,103,133,97,125,101,84,
-    133,85,116,148,111,155,131,121,143,93,121,130,116,168,133,136,
-    155,98,111,103,92,141,109,130,153,109,143,105,107,142,118,144,
-    139,101,130,105,97,138,102,116,103,91,134,107,117,143,107,126,
-    113,100,146,118,119,125,91,135,119,108,153,110,111,112,95,139,
-    125,125,150,105,128,135,108,160,128,120,129,91,134,120,106,141,
-    114,122,137,110,147,135,115,138,105,130,131,109,147,116,107,118,
-    86,115,121,110,135,108,120,134,105,147,133,118,137,92,115,121,
-    93,133,113,106,123,94,124,128,108,146,124,129,141,99,132,116,
-    101,131,104,130,133,101,125,106,110,138,117,154,152,115,135,98,
-    104,132,110,133,130,105,121,95,124,135,106,156,134,119,147,114,
-    125,128,100,135,117,118,131,93,113,105,110,142,130,144,150,112,
-    126,120,103,133,117,127,108,99,128,92,98,140,112,107,124,139,
-    138,141,148,121,88,96,104,76,138,142,141,146,99,116,77,89,
-    118,123,166,159,156,144,94,71,105,95,155,172,149,153,87,74,
-    69,95,153,148,182,168,82,94,91,94,159,165,154,141,96,96,
-    76,92,138,129,144,138,104,116,93,88,132,109,135,150,129,134,
-    105,100,103,90,138,134,117,145,106,102,127,100,136,136,127,141,
-    115,129,123,113,141,120,116,144,112,131,125,107,130,117,123,137,
-    125,141,124,105,125,92,117,131,110,129,116,95,106,107,122,139,
-    130,147,118,115,133,111,134,145,114,121,106,90,110,97,126,119,
-    119,143,112,129,136,111,140,139,125,147,122,121,116,96,116,98,
-    114,125,107,122,118,91,126,108,125,146,126,158,122,130,145,105,
-    126,154,108,133,110,107,96,104,120,123,172,115,85,120,74,112,
-    221,105,144,109,77,162,97,163,140,60,149,122,104,152,71,131,
-    116,93,162,109,122,137,54,115,128,96,240,95,135,127,5,157,
-    86,137,175,91,122,91,64,159,107,121,181,75,167,164,130,229,
-    101,101,111,26,144,108,117,166,51,97,108,71,195,154,142,194,
-    71,131,143,100,197,92,80,87,14,158,132,119,203,81,121,137,
-    84,195,125,115,148,60,141,120,81,168,66,70,133,75,187,158,
-    101,170,77,123,151,99,194,114,78,146,46,126,146,75,179,94,
-    110,172,93,201,149,83,156,46,111,152,71,167,95,48,137,68,
-    162,174,84,172,76,111,186,99,204,150,57,144,55,101,164,72,
-    170,83,54,158,52,167,173,85,188,104,103,198,105,153,113,49,
-    140,65,154,146,39,139,79,99,189,116,180,157,79,162,91,123,
-    182,76,150,83,39,139,61,132,148,62,151,99,115,189,112,175,
-    137,78,163,98,138,177,64,119,85,63,164,111,159,172,85,163,
-    104,121,200,88,149,124,55,157,104,116,164,67,132,111,83,184,
-    100,144,153,60,153,103,102,170,63,106,105,65,168,117,138,161,
-    59,133,110,95,194,104,123,136,56,139,117,116,167,73,120,122,
-    77,186,120,122,165,67,136,127,106,169,93,112,121,73,159,128,
-    116,173,79,122,137,94,171,115,110,124,70,134,124,122,169,90,
-    101,125,79,155,140,120,166,100,124,125,104,161,109,111,137,79,
-    134,129,90,142,94,105,135,114,163,130,113,136,90,132,144,117,
-    164,115,87,121,85,124,135,115,146,104,117,129,104,159,131,107,
-    147,104,121,144,106,129,102,98,124,102,154,132,94,137,95,111,
-    151,123,150,131,93,119,98,128,144,103,143,103,95,135,94,135,
-    140,90,133,114,116,150,108,142,111,93,143,103,137,146,79,125,
-    109,86,156,122,143,136,84,140,94,123,171,102,139,120,76,133,
-    95,119,163,98,110,109,109,144,148,150,124,68,137,76,89,215,
-    135,162,134,74,73,40,123,162,127,190,159,92,134,49,74,145,
-    116,213,165,121,128,34,69,78,112,207,141,165,152,30,98,128,
-    113,204,148,127,132,52,120,89,103,183,108,141,149,76,127,95,
-    88,142,109,158,154,111,132,60,76,120,98,188,155,119,158,77,
-    98,135,110,165,130,117,131,74,122,122,90,155,111,106,144,103,
-    146,133,114,147,101,139,142,95,159,96,70,136,80,144,148,109,
-    147,75,97,127,99,180,143,98,157,78,112,135,105,149,123,107,
-    121,72,150,107,86,204,77,113,184,93,118,155,80,165,163,113,
-    112,103,121,146,142,68,70,101,173,139,134,133,43,95,158,150,
-    135,120,134,112,83,157,143,85,161,89,58,144,107,150,160,88,
-    122,80,115,151,91,145,95,64,140,102,147,169,82,121,110,119,
-    199,180,200,183,70,108,76,103,176,94,131,102,26,114,124,124,
-    181,121,145,111,80,181,109,125,142,32,97,79,100,175,91,116,
-    126,72,157,143,150,194,52,105,103,75,188,118,117,121,29,96,
-    120,132,199,106,126,128,63,174,140,126,189,77,107,139,97,166,
-    89,93,130,63,179,167,135,206,88,85,131,85,167,143,112,132,
-    41,95,118,103,191,102,73,153,69,140,175,132,182,101,109,138,
-    114,173,81,81,133,45,164,153,88,159,82,112,160,115,205,132,
-    113,170,30,106,136,86,176,90,57,105,57,145,139,131,217,79,
-    137,159,71,190,105,82,144,63,122,132,82,136,57,95,139,85,
-    202,154,110,190,96,121,165,103,164,97,71,110,54,143,132,83,
-    168,84,89,160,104,180,149,112,160,91,146,138,74,152,74,71,
-    155,89,159,148,82,137,81,118,160,117,189,115,72,141,65,135,
-    168,88,153,96,80,136,87,158,138,93,167,90,118,168,77,146,
-    118,70,151,105,148,157,77,151,96,101,177,92,156,135,52,136,
-    93,112,185,95,147,117,63,159,87,147,173,70,162,111,78,170,
-    84,125,144,62,155,105,111,167,53,138,131,83,201,115,134,175,
-    57,136,122,99,189,90,124,120,28,151,99,112,197,75,137,137,
-    68,177,116,134,175,66,155,110,77,178,57,107,155,65,167,121,
-    97,166,64,132,147,100,209,101,100,157,32,141,145,89,189,83,
-    97,133,52,171,126,114,198,66,134,155,62,182,108,88,166,74,
-    142,127,84,169,60,100,163,68,185,134,80,171,65,114,157,96,
-    186,109,82,167,47,124,152,76,173,125,111,146,83,127,105,73,
-    175,124,171,196,68,141,56,30,143,95,187,179,110,147,49,66,
-    136,79,214,185,97,189,59,60,116,61,156,128,145,171,59,153,
-    105,42,194,136,140,215,91,108,99,41,141,113,171,174,63,141,
-    68,59,184,102,157,174,59,127,88,96,160,85,168,127,77,189,
-    93,133,191,64,144,143,79,186,94,118,119,34,147,83,122,196,
-    73,133,136,53,165,123,142,188,75,130,96,75,177,83,136,172,
-    61,154,121,96,174,84,147,113,91,203,68,92,163,59,146,151,
-    71,203,96,34,91,75,133,199,160,106,48,82,163,111,202,166,
-    72,165,116,110,144,82,149,122,86,152,82,101,133,56,108,119,
-    99,203,151,123,150,21,136,132,119,213,105,143,85,34,147,98,
-    135,197,84,132,160,110,187,141,117,131,57,143,106,101,169,71,
-    98,140,88,159,153,96,141,69,99,147,121,198,114,62,95,11,
-    135,175,130,200,109,79,107,73,150,135,103,159,53,111,146,69,
-    157,99,69,146,103,173,168,102,155,73,107,172,118,184,130,50,
-    110,63,109,173,116,176,108,80,145,88,184,189,109,175,92,89,
-    151,85,151,120,76,135,89,145,170,79,144,98,88,192,134,181,
-    173,73,123,85,105,173,94,148,102,31,119,74,135,194,86,139,
-    108,92,190,139,171,141,59,144,97,117,169,56,105,93,60,155,
-    129,154,175,74,113,96,106,198,99,130,114,23,125,107,123,169,
-    86,109,100,86,172,129,155,174,67,139,125,104,190,103,121,138,
-    85,161,119,127,139,42,106,112,95,204,132,103,136,49,121,135,
-    148,192,96,119,111,62,164,123,105,159,57,98,130,107,178,116,
-    113,130,75,159,135,105,160,59,81,137,92,168,131,90,119,57,
-    126,143,135,203,101,94,139,71,148,161,106,148,75,88,120,93,
-    173,113,105,152,75,136,168,108,164,107,82,143,105,166,133,88,
-    132,49,105,162,116,183,130,71,136,93,140,178,128,159,78,91,
-    133,81,169,140,76,142,91,104,166,126,156,120,99,151,105,166,
-    159,83,142,80,80,163,121,146,133,76,115,88,135,168,110,164,
-    95,63,141,89,132,157,90,125,101,100,144,105,149,118,85,161,
-    100,129,164,73,113,102,94,156,128,148,120,69,122,92,121,191,
-    117,141,123,55,123,107,131,158,105,131,96,92,146,101,133,150,
-    67,145,140,116,163,91,112,107,94,166,143,146,146,49,97,104,
-    101,192,144,141,127,58,108,125,145,158,101,141,105,85,172,104,
-    112,148,55,88,145,166,199,144,114,75,0,112,125,141,221,120,
-    122,90,35,111,126,153,208,137,152,114,65,125,54,111,180,115,
-    186,142,51,107,70,118,167,159,199,107,81,107,39,128,172,122,
-    181,110,70,103,77,146,134,115,165,85,114,136,77,157,114,78,
-    162,111,137,162,116,150,86,103,151,94,167,131,59,133,71,95,
-    167,124,152,109,87,132,85,166,180,101,164,98,75,146,98,132,
-    144,93,136,100,127,149,92,157,115,77,149,108,134,154,83,131,
-    98,104,162,109,147,116,63,132,99,116,181,120,139,106,81,141,
-    102,157,158,98,174,112,73,144,62,136,197,81,106,88,118,160,
-    116,153,88,36,151,130,142,172,57,126,112,110,193,121,136,127,
-    44,101,123,138,215,104,118,79,13,146,121,137,163,86,98,99,
-    83,176,114,125,151,58,173,166,168,226,103,85,91,63,160,146,
-    115,135,19,86,115,102,216,136,115,127,54,138,161,135,193,77,
-    67,71,44,183,140,116,166,62,107,154,116,195,130,95,113,72,
-    166,146,97,152,31,51,136,103,206,166,97,121,61,140,174,144,
-    209,100,68,121,60,151,161,89,132,79,102,160,140,210,143,94,
-    131,52,131,174,98,158,78,34,112,94,171,153,92,127,67,122,
-    197,137,198,143,58,125,92,137,169,90,131,58,53,141,96,184,
-    164,75,134,125,138,162,120,150,85,111,130,50,144,112,74,126,
-    78,103,151,126,195,144,92,127,96,175,151,105,135,44,58,113,
-    72,163,135,99,139,64,143,131,134,203,105,112,136,69,159,146,
-    76,123,67,117,139,135,219,131,102,139,60,144,172,104,161,91,
-    83,134,98,176,137,89,142,61,123,161,94,191,114,59,127,65,
-    126,140,100,152,88,121,165,87,177,129,58,143,79,119,162,104,
-    141,85,75,129,81,177,161,81,159,87,96,169,106,153,144,78,
-    135,86,131,160,84,164,93,81,180,107,154,165,73,129,101,103,
-    153,96,149,103,68,163,94,143,185,73,127,104,83,157,117,166,
-    147,80,147,87,112,180,87,138,126,64,146,108,129,147,76,130,
-    108,109,182,101,139,142,51,145,130,126,168,90,106,90,90,160,
-    109,168,163,60,126,113,97,176,115,134,137,74,131,91,115,140,
-    81,137,142,106,165,122,113,142,78,141,139,111,170,81,137,135,
-    57,153,112,81,127,87,148,177,137,176,82,55,82,67,147,185,
-    162,183,81,46,88,60,151,184,171,162,91,86,88,72,163,156,
-    121,167,113,94,120,101,128,109,135,154,108,165,110,60,109,88,
-    128,185,156,150,89,50,90,85,145,171,139,157,87,81,129,89,
-    157,155,102,133,112,118,134,119,142,90,79,148,94,137,151,74,
-    120,101,109,163,147,164,124,88,120,96,146,177,108,141,87,60,
-    124,101,149,149,111,133,94,121,153,103,161,126,78,151,109,127,
-    154,86,118,95,107,160,120,162,125,65,127,97,112,185,106,132,
-    118,72,128,109,150,161,111,154,110,95,145,100,130,140,78,131,
-    113,107,133,81,117,96,98,156,129,128,174,98,113,122,117,157,
-    125,135,104,106,124,80,120,119,60,170,116,88,106,94,185,138,
-    161,165,62,113,142,111,156,109,97,139,99,139,119,96,138,74,
-    140,165,103,212,131,93,146,63,143,141,111,143,69,82,101,70,
-    162,132,90,153,81,108,178,147,206,171,108,125,50,110,116,72,
-    145,82,77,138,71,132,147,82,167,126,141,182,115,164,99,49,
-    113,48,137,185,85,145,103,63,146,112,181,178,105,160,70,107,
-    173,84,156,127,46,134,91,124,160,90,148,107,109,193,110,156,
-    154,45,154,115,110,191,80,115,94,75,174,126,178,195,73,143,
-    86,52,170,95,130,139,49,109,78,100,177,69,158,139,74,187,
-    117,136,179,91,137,133,93,142,66,117,119,61,131,90,126,179,
-    110,134,123,83,165,148,168,151,73,120,75,92,158,88,103,121,
-    70,139,138,158,173,126,150,108,115,154,117,116,124,59,100,109,
-    100,150,92,106,109,103,169,158,186,179,99,114,104,86,152,123,
-    111,113,63,101,92,125,155,116,145,127,98,153,136,125,147,100,
-    106,110,116,135,107,109,109,90,139,135,129,152,96,99,115,116,
-    152,145,130,112,80,107,115,123,160,121,108,125,89,119,140,123,
-    131,113,120,117,123,144,113,99,115,104,134,163,141,143,116,89,
-    99,113,142,139,127,120,78,92,129,121,148,143,107,111,103,112,
-    134,140,142,110,116,125,99,128,125,89,104,108,110,135,138,129,
-    112,116,131,128,168,167,122,123,97,80,123,134,132,127,103,97,
-    86,119,147,135,164,141,111,137,118,121,137,116,111,110,117,120,
-    100,115,96,86,136,127,141,169,124,112,110,108,130,142,159,131,
-    91,101,75,86,148,126,136,143,108,112,117,128,140,129,146,127,
-    119,145,99,103,112,79,122,133,127,143,113,105,89,106,148,141,
-    159,159,81,100,110,91,149,139,129,118,96,105,101,132,146,109,
-    129,130,94,146,133,119,131,94,117,114,152,167,129,99,78,65,
-    101,119,142,212,151,116,110,69,74,94,140,154,140,178,134,83,
-    85,50,65,141,179,200,179,118,76,25,79,130,158,217,161,108,
-    80,37,81,150,161,184,148,101,93,78,127,122,136,169,126,117,
-    130,79,100,124,97,132,125,143,122,97,112,70,93,142,139,162,
-    164,103,112,112,108,146,155,156,127,100,100,83,115,141,120,134,
-    116,91,109,121,117,131,136,129,121,134,141,108,135,120,92,143,
-    136,135,140,117,95,101,100,135,127,138,130,87,117,95,113,165,
-    132,117,144,95,96,97,129,108,107,119,114,147,105,92,118,101,
-    168,208,116,155,101,120,180,88,168,130,50,156,114,74,120,76,
-    140,110,102,183,60,135,138,37,176,143,127,226,97,127,107,59,
-    171,81,159,167,31,126,93,40,158,97,113,161,88,183,132,145,
-    214,66,137,128,58,168,96,85,147,46,111,123,89,183,95,136,
-    144,59,188,139,120,212,64,80,108,56,173,130,146,173,68,142,
-    98,73,195,83,115,165,69,155,105,96,153,57,137,127,92,198,
-    92,104,158,59,160,152,100,177,78,93,125,67,177,114,107,182,
-    52,140,146,83,202,120,106,138,62,145,112,93,169,58,105,144,
-    69,192,124,80,178,83,147,161,105,194,90,101,150,48,169,131,
-    67,169,54,84,147,80,180,135,114,182,85,162,172,80,195,84,
-    78,170,52,136,124,57,131,68,120,169,97,198,108,93,178,107,
-    171,146,70,118,88,94,135,84,136,99,87,160,78,142,182,98,
-    162,126,94,152,99,153,109,82,136,59,133,143,81,133,123,82,
-    143,121,134,148,92,138,91,130,177,99,168,150,83,156,112,114,
-    146,94,121,94,95,144,88,140,139,67,157,110,107,185,111,132,
-    123,91,135,89,137,130,58,137,97,90,171,112,122,145,96,124,
-    117,133,150,95,136,108,77,164,102,110,153,87,121,123,124,156,
-    129,143,131,99,153,113,109,160,74,102,127,86,144,126,122,130,
-    109,138,112,129,169,99,118,140,82,135,137,110,136,106,117,108,
-    117,157,104,132,145,87,146,145,102,150,109,83,104,113,128,117,
-    125,126,75,122,119,103,179,145,112,133,122,112,113,121,141,104,
-    127,117,77,131,119,94,157,150,109,129,152,122,140,140,89,100,
-    139,93,82,164,136,132,158,105,76,75,102,117,129,192,153,127,
-    123,56,34,127,132,170,211,128,96,68,60,72,133,189,148,138,
-    141,50,86,154,115,150,179,123,106,118,106,93,112,145,110,138,
-    173,88,100,107,65,113,146,142,155,125,106,66,92,131,108,161,
-    160,106,124,126,89,140,126,126,139,123,134,100,134,131,85,135,
-    117,99,150,121,102,125,100,115,129,144,159,114,131,113,80,140,
-    123,115,147,98,101,102,99,132,112,138,144,110,159,129,115,154,
-    106,109,136,104,126,118,89,100,85,129,127,139,180,115,112,135,
-    102,141,164,139,145,120,103,89,90,137,99,116,142,87,113,123,
-    97,126,129,118,133,132,148,120,122,145,93,120,142,98,133,128,
-    84,112,126,110,128,135,137,98,113,116,88,149,135,122,151,112,
-    80,116,109,174,155,132,128,67,160,132,106,157,89,86,138,117,
-    127,116,112,113,88,169,150,118,172,89,58,140,106,155,176,121,
-    123,36,102,104,100,193,124,102,124,64,105,151,109,149,122,120,
-    145,129,195,144,93,144,56,99,157,85,138,105,64,99,91,142,
-    146,128,165,78,95,168,103,176,156,65,103,62,103,150,132,163,
-    109,91,138,78,160,169,80,146,92,97,145,113,132,97,74,115,
-    90,161,178,98,158,104,77,162,138,156,166,101,106,80,105,147,
-    105,168,119,72,154,107,136,189,122,123,109,91,123,104,136,117,
-    64,128,94,113,187,102,112,131,87,144,150,159,161,96,124,78,
-    81,170,103,122,142,51,102,120,112,171,135,142,127,100,167,117,
-    134,169,62,124,130,76,147,107,75,114,85,148,171,141,146,85,
-    97,140,153,163,135,88,101,93,91,113,132,124,112,129,109,86,
-    135,164,123,153,142,96,118,134,111,104,114,92,123,129,129,120,
-    108,129,86,126,151,124,142,133,92,97,113,111,144,149,155,139,
-    126,126,96,116,125,103,118,113,105,126,116,102,120,113,126,138,
-    139,148,110,124,120,99,135,123,108,116,86,96,115,115,146,128,
-    131,124,99,129,121,125,155,122,116,132,110,119,103,108,116,100,
-    136,129,128,149,112,104,136,123,141,146,117,114,83,96,104,113,
-    155,130,126,133,87,112,136,127,146,137,127,109,109,128,98,118,
-    147,98,116,139,103,126,125,120,133,134,152,132,120,127,90,101,
-    123,103,140,129,105,119,109,103,122,139,156,132,139,136,89,115,
-    111,108,139,133,107,123,113,103,104,131,146,122,151,138,100,119,
-    112,99,137,138,119,128,108,113,106,108,128,137,131,128,139,96,
-    107,109,118,95,134,168,139,129,113,111,65,95,133,121,148,165,
-    109,95,82,80,114,136,166,160,129,120,89,80,118,128,178,162,
-    130,117,79,84,116,136,147,155,128,114,90,116,117,116,170,147,
-    120,135,105,78,98,110,115,108,130,129,84,110,128,107,142,152,
-    142,140,121,119,105,111,123,108,132,120,99,111,96,88,123,126,
-    137,153,140,132,111,124,107,114,150,129,113,136,97,83,112,108,
-    122,141,161,133,112,125,101,104,152,139,139,147,101,97,107,110,
-    126,141,149,123,118,128,93,102,137,112,127,139,107,112,108,112,
-    112,126,149,126,139,156,111,118,124,96,121,135,116,115,106,110,
-    91,99,133,115,135,145,109,131,116,115,151,122,156,135,112,120,
-    99,108,128,106,143,170,92,73,104,86,121,176,120,110,111,134,
-    135,121,140,112,115,149,138,128,114,97,112,96,122,150,114,116,
-    117,72,106,124,134,183,127,159,111,84,145,108,123,141,118,108,
-    113,97,114,92,122,125,103,156,147,146,171,112,108,118,90,126,
-    125,119,101,73,89,93,109,165,140,139,154,93,125,144,127,156,
-    122,107,92,80,127,101,118,158,95,122,142,107,144,123,117,125,
-    108,143,119,93,124,69,92,140,98,152,142,111,130,105,126,136,
-    136,161,114,109,127,80,120,130,96,146,127,118,144,119,147,128,
-    121,138,89,134,136,84,123,95,69,124,121,141,140,114,128,95,
-    130,161,125,172,143,94,129,95,111,126,100,130,103,102,129,89,
-    145,147,99,153,135,117,173,144,107,114,82,117,118,126,137,78,
-    109,105,97,169,141,143,169,106,119,123,109,137,110,107,116,81,
-    125,121,97,149,92,117,154,113,164,138,110,121,94,130,128,113,
-    155,97,99,142,96,148,150,108,129,92,95,116,117,160,127,112,
-    133,80,120,144,104,150,123,104,132,105,131,112,94,120,80,120,
-    149,105,151,125,87,133,111,137,148,114,131,89,105,134,101,152,
-    130,82,131,102,112,160,126,146,127,114,139,102,146,136,86,133,
-    97,90,146,112,124,133,100,131,116,144,152,102,144,106,89,149,
-    110,126,141,83,105,98,106,139,114,147,125,92,147,112,121,165,
-    101,120,125,94,131,109,124,120,88,133,109,121,164,100,119,135,
-    92,142,143,137,142,97,116,98,102,156,113,130,143,83,126,129,
-    113,153,124,118,125,111,144,112,122,141,77,127,136,112,158,124,
-    107,121,99,132,134,129,154,95,110,117,88,153,127,110,140,101,
-    112,126,118,145,112,116,128,88,139,122,99,141,93,105,131,116,
-    144,124,110,127,94,127,135,109,159,100,99,138,98,128,142,124,
-    134,108,118,131,106,152,117,110,145,90,115,128,98,136,119,117,
-    140,114,150,119,93,149,94,138,176,98,114,116,81,90,109,167,
-    157,130,149,72,71,97,92,147,165,136,168,105,73,92,71,138,
-    146,187,176,99,114,86,37,120,149,139,188,142,107,75,80,113,
-    121,182,178,111,132,94,53,124,135,144,156,135,121,87,112,131,
-    96,145,125,98,133,110,105,122,90,101,132,134,164,146,152,126,
-    86,121,108,130,170,128,103,101,71,83,111,138,148,126,135,103,
-    97,138,117,132,158,120,127,131,105,108,110,117,123,124,154,122,
-    108,125,79,91,126,126,147,145,118,108,97,141,117,149,186,102,
-    102,130,66,109,137,96,175,127,72,98,112,107,163,161,111,122,
-    143,159,105,124,120,80,118,159,124,108,112,80,90,104,163,147,
-    134,156,68,61,128,122,177,195,125,128,79,80,125,105,137,112,
-    81,98,85,104,109,88,116,121,112,184,174,185,164,120,132,100,
-    132,147,109,117,98,24,80,109,124,168,135,139,106,109,148,134,
-    173,161,91,99,86,96,138,107,125,131,106,134,131,134,131,96,
-    120,114,122,185,132,97,95,56,89,137,161,164,124,119,92,74,
-    152,141,143,170,103,96,115,107,125,123,135,129,110,157,129,131,
-    164,99,110,130,98,140,132,104,102,65,104,116,142,197,101,101,
-    125,66,138,172,145,179,125,78,88,104,131,112,149,105,86,120,
-    110,104,124,135,123,133,139,158,120,149,120,73,118,118,120,130,
-    110,60,56,74,110,141,196,162,107,128,91,118,156,160,149,117,
-    83,79,84,101,107,106,137,120,139,157,142,150,149,123,136,140,
-    134,128,106,96,51,77,111,111,138,140,103,100,113,115,153,163,
-    167,121,102,101,84,130,126,115,131,123,108,126,125,130,116,112,
-    132,117,160,141,97,117,79,78,135,141,146,138,107,100,83,130,
-    145,128,172,124,87,130,101,114,151,123,125,115,127,128,111,151,
-    122,98,148,112,117,155,100,106,112,105,138,146,161,124,87,116,
-    89,111,175,135,144,137,76,99,103,130,141,126,136,92,94,135,
-    105,127,153,102,132,133,121,147,127,126,105,106,140,115,132,138,
-    70,93,107,95,154,150,141,127,94,106,97,135,166,123,138,115,
-    71,114,113,108,134,115,117,110,112,133,107,133,136,106,151,139,
-    122,142,102,94,111,117,141,125,121,111,71,108,115,129,168,140,
-    129,126,98,119,140,138,139,118,126,105,92,122,102,102,127,113,
-    133,145,124,129,109,104,117,133,167,137,119,103,78,106,122,122,
-    152,136,110,89,88,140,147,154,145,102,97,107,106,143,131,107,
-    124,99,98,117,136,147,130,126,114,97,140,156,129,138,108,92,
-    106,112,123,121,123,115,92,118,132,130,161,135,107,120,121,131,
-    135,127,117,95,106,114,112,135,118,95,118,112,120,143,128,116,
-    107,122,123,136,168,139,107,113,98,107,154,137,139,126,94,102,
-    99,138,135,136,143,105,98,128,112,124,158,107,120,124,126,134,
-    119,140,102,110,143,126,132,147,86,93,104,94,153,135,146,110,
-    90,102,107,140,178,122,112,105,57,116,99,120,154,115,97,118,
-    91,144,133,93,118,111,155,202,149,103,107,75,152,143,146,153,
-    74,106,94,97,116,102,152,138,88,114,100,75,138,147,121,141,
-    107,144,133,117,158,74,140,134,107,158,114,93,103,86,98,137,
-    144,167,116,137,143,120,191,175,131,160,104,78,100,86,126,109,
-    107,114,83,115,111,109,163,133,120,164,126,124,131,79,94,75,
-    114,143,107,156,103,64,111,82,125,174,128,142,118,92,111,98,
-    137,125,94,139,87,90,143,91,136,138,112,149,124,138,133,95,
-    132,116,123,176,110,130,128,69,125,127,145,182,143,141,103,77,
-    124,99,141,166,99,125,107,89,136,109,137,147,119,146,112,120,
-    145,100,133,125,106,160,107,107,114,71,109,113,139,179,123,124,
-    101,79,129,152,166,152,105,87,91,88,121,113,122,122,109,128,
-    116,118,146,132,127,145,129,135,114,97,82,82,101,118,148,140,
-    121,88,107,97,119,176,160,157,127,104,93,105,136,135,138,145,
-    122,109,118,104,111,122,109,118,132,132,118,110,112,98,122,146,
-    143,151,138,102,102,110,114,140,151,124,95,89,88,94,130,153,
-    127,133,122,90,112,126,123,130,136,122,114,124,110,98,111,119,
-    110,140,155,122,123,114,96,112,139,142,139,135,103,82,102,121,
-    125,154,148,115,119,111,105,130,144,131,122,128,114,104,124,113,
-    100,119,120,117,138,133,109,115,117,119,135,159,140,114,115,96,
-    91,125,138,132,136,117,95,104,125,127,137,150,127,115,125,118,
-    114,127,115,111,125,124,120,122,119,98,109,129,130,147,149,116,
-    96,100,100,116,147,146,123,114,104,88,118,146,139,147,137,106,
-    103,117,113,124,137,124,114,121,119,104,120,120,112,134,141,133,
-    130,122,99,98,117,126,131,145,120,89,104,96,111,145,148,131,
-    125,115,93,109,133,129,127,143,118,105,124,107,108,124,121,124,
-    139,136,109,118,115,99,111,148,138,127,124,94,96,108,123,125,
-    143,135,114,110,116,116,124,132,122,120,138,128,116,120,93,91,
-    108,113,158,188,166,122,90,71,47,101,142,152,155,153,120,80,
-    83,97,108,153,192,160,153,120,73,72,90,115,137,171,160,125,
-    104,92,86,128,168,165,171,128,90,75,82,103,148,167,147,116,
-    97,93,89,133,145,138,138,119,93,88,103,111,115,128,121,119,
-    140,129,133,143,122,114,129,131,128,133,117,95,96,111,110,120,
-    139,118,110,118,116,130,152,139,115,114,101,104,122,139,117,123,
-    122,102,113,130,118,121,124,98,112,128,139,129,129,138,106,127,
-    158,118,118,134,101,82,122,114,133,148,91,76,109,116,142,180,
-    132,109,133,155,139,140,142,85,86,121,113,109,126,116,88,95,
-    109,121,122,144,126,84,117,116,144,180,148,135,110,87,101,130,
-    138,127,102,92,57,82,130,102,124,136,111,142,166,177,190,164,
-    155,119,112,124,112,131,126,71,80,97,77,132,136,136,132,111,
-    145,130,156,159,106,107,87,71,127,125,125,145,99,106,103,118,
-    147,127,143,123,88,124,118,107,134,93,89,103,110,146,129,134,
-    125,101,123,128,127,158,118,101,120,99,130,134,127,127,103,122,
-    127,128,171,143,129,131,91,101,118,113,125,109,93,94,101,133,
-    133,119,147,120,129,148,126,150,140,121,116,121,130,117,107,105,
-    67,111,126,104,133,113,124,141,131,148,123,138,161,123,134,110,
-    91,127,112,89,116,91,107,119,114,150,120,155,149,110,164,120,
-    98,129,90,103,118,94,115,89,94,112,88,142,132,124,190,144,
-    143,163,107,134,113,106,124,90,120,102,79,131,96,96,155,100,
-    144,154,105,153,118,143,138,97,144,91,98,145,86,128,155,98,
-    145,121,109,136,93,148,123,113,161,85,119,138,75,140,124,97,
-    146,107,128,129,104,145,95,119,155,84,145,132,87,151,104,113,
-    135,106,145,122,126,149,84,128,127,85,154,112,102,140,91,117,
-    124,112,144,109,130,132,77,140,113,107,176,116,127,130,89,116,
-    104,120,135,107,139,113,97,147,107,126,164,120,141,135,109,122,
-    104,122,115,106,141,98,108,136,88,119,135,114,148,144,136,129,
-    109,123,96,114,153,103,123,126,77,115,116,110,139,136,139,126,
-    122,140,102,132,144,111,145,127,87,121,105,95,129,122,133,113,
-    131,134,100,137,143,107,153,129,106,125,105,112,114,121,130,100,
-    125,125,95,145,124,112,163,93,116,147,99,158,129,119,101,90,
-    117,95,106,182,155,140,153,71,52,70,87,140,152,179,168,94,
-    107,46,74,154,151,202,188,111,97,62,57,100,115,173,160,132,
-    137,56,89,128,105,181,170,134,130,75,94,83,104,164,130,148,
-    149,75,100,108,94,152,134,151,133,98,111,67,91,127,108,161,
-    162,121,153,106,104,133,115,147,137,136,125,87,109,98,84,148,
-    130,122,149,109,109,112,116,135,135,150,141,109,130,101,92,141,
-    121,138,159,132,115,101,97,92,113,151,135,126,141,84,90,130,
-    121,141,163,133,111,99,98,100,112,155,131,120,140,79,85,144,
-    98,134,150,139,116,132,121,109,141,112,94,119,113,101,174,95,
-    78,73,90,150,123,175,133,46,116,142,123,186,158,140,120,90,
-    116,103,130,139,81,121,113,68,180,99,111,152,76,150,127,147,
-    149,91,123,110,79,175,133,108,152,63,123,156,150,231,151,119,
-    98,23,111,94,125,186,95,102,117,58,125,137,118,180,103,156,
-    140,88,168,48,73,113,57,174,165,110,161,74,89,130,112,222,
-    129,116,128,12,114,120,93,182,109,86,121,67,150,138,130,198,
-    100,158,148,69,169,100,70,152,91,143,152,88,139,62,109,164,
-    105,228,168,82,141,44,81,152,112,174,118,75,103,49,150,154,
-    102,197,108,100,171,90,146,154,98,148,100,129,145,60,146,79,
-    54,170,91,146,177,77,126,115,101,169,137,179,119,54,125,63,
-    136,164,71,135,101,109,150,103,160,142,115,185,93,115,159,39,
-    122,101,57,143,110,132,124,66,119,77,128,195,98,184,134,54,
-    151,84,126,167,101,150,94,88,146,71,155,168,94,193,119,114,
-    172,84,148,135,101,169,93,133,139,42,144,108,99,201,106,137,
-    144,53,130,93,124,176,81,151,95,48,154,66,118,172,78,151,
-    110,88,153,77,137,130,85,179,91,108,158,50,131,135,94,184,
-    114,121,134,64,144,104,122,192,84,133,136,52,152,120,109,177,
-    96,140,114,93,171,84,137,166,75,164,127,85,165,85,108,143,
-    108,171,112,118,147,58,147,141,100,203,121,102,138,69,121,120,
-    116,164,84,132,118,59,168,112,109,186,106,129,135,91,144,101,
-    125,140,86,160,98,68,153,73,112,167,111,164,129,101,125,85,
-    152,132,114,185,89,85,128,59,127,141,105,159,111,119,111,88,
-    153,113,122,174,91,138,133,64,122,98,101,144,109,142,123,88,
-    127,70,138,169,110,166,143,85,113,84,108,132,122,171,110,116,
-    141,52,131,165,119,144,140,118,134,94,113,116,104,154,78,125,
-    141,110,164,134,81,115,55,100,132,131,172,134,141,96,32,100,
-    145,131,226,133,110,109,30,97,109,159,168,148,156,94,64,148,
-    115,129,198,90,125,119,90,123,109,120,125,106,155,118,109,168,
-    67,114,129,85,147,139,124,125,81,107,92,104,195,116,153,176,
-    78,136,124,97,164,113,118,120,75,138,77,104,154,81,141,154,
-    97,175,135,108,148,92,141,114,113,166,68,103,132,56,164,143,
-    107,169,97,112,107,97,158,109,137,146,76,139,127,89,163,120,
-    116,145,104,138,106,99,132,76,149,131,87,170,98,101,134,95,
-    149,159,114,179,87,104,127,86,138,110,121,131,118,89,90,94,
-    99,113,206,112,107,144,70,162,145,158,163,80,109,121,96,127,
-    97,117,137,74,154,115,95,164,68,118,159,121,232,138,114,176,
-    38,159,114,91,196,60,80,111,35,106,121,93,166,91,175,174,
-    99,243,116,96,167,50,115,122,66,129,70,80,124,63,162,116,
-    86,197,84,132,200,97,176,123,59,105,40,144,133,115,207,72,
-    98,160,62,173,169,91,166,100,131,143,95,164,72,78,150,68,
-    169,169,63,154,108,99,168,138,178,136,90,138,62,130,180,71,
-    171,112,63,151,94,144,168,114,151,86,101,141,57,152,133,47,
-    155,95,101,168,81,134,106,113,180,115,189,164,61,154,77,83,
-    184,78,122,120,40,117,73,131,192,84,170,120,85,193,135,142,
-    150,59,113,115,100,147,54,95,88,71,182,122,152,204,85,121,
-    141,96,176,114,109,103,45,113,86,121,171,77,112,150,74,170,
-    159,133,166,95,132,109,112,165,77,108,142,76,161,148,107,149,
-    86,95,120,117,181,124,123,137,51,131,134,110,187,121,93,137,
-    92,130,135,114,143,70,117,132,87,176,121,78,154,101,122,170,
-    111,137,88,91,137,94,177,138,74,134,71,78,165,125,155,150,
-    92,131,86,140,153,99,173,95,82,154,92,127,149,82,131,123,
-    126,167,108,151,104,70,169,103,144,179,70,105,84,75,142,129,
-    163,137,82,130,86,113,188,103,143,139,68,138,111,122,136,84,
-    125,97,108,170,100,130,135,65,146,132,129,177,104,115,103,83,
-    148,119,143,154,69,126,115,91,182,119,122,138,82,130,113,124,
-    149,85,123,121,86,166,119,106,148,81,121,133,114,163,108,107,
-    120,82,150,124,114,158,78,110,134,101,161,128,107,129,79,125,
-    118,116,164,87,117,143,80,142,143,104,132,98,134,141,110,157,
-    87,80,134,96,156,173,111,137,100,70,135,138,155,156,124,95,
-    72,115,115,105,174,153,88,151,120,109,109,87,121,71,151,181,
-    131,170,103,26,90,94,154,224,151,147,70,30,74,91,179,178,
-    149,159,70,70,129,116,161,171,118,127,91,103,116,91,142,109,
-    112,157,118,129,130,73,104,111,131,175,124,140,93,51,114,106,
-    164,191,127,131,116,76,133,125,145,157,96,129,86,98,146,91,
-    138,132,89,153,130,126,149,110,117,113,117,160,105,125,131,50,
-    122,128,124,179,127,116,96,86,129,108,143,159,83,121,105,71,
-    152,123,120,143,112,113,114,111,142,87,120,121,94,143,112,121,
-    121,129,121,126,143,119,102,186,119,91,137,74,157,141,134,125,
-    51,93,111,126,157,111,108,138,88,144,159,121,150,105,105,130,
-    111,199,139,101,158,30,136,151,100,166,91,69,97,100,134,145,
-    108,137,55,120,192,131,253,178,91,114,46,84,135,120,148,91,
-    70,104,47,150,156,97,186,113,102,172,116,149,118,73,108,49,
-    148,155,91,173,86,64,166,112,164,185,90,114,67,109,157,105,
-    171,99,36,128,66,127,202,102,150,125,89,152,118,160,145,75,
-    150,90,103,192,68,117,129,53,164,149,161,184,96,133,68,72,
-    187,100,151,160,27,96,100,100,188,121,134,108,84,168,99,153,
-    199,66,148,126,65,187,102,78,104,60,141,147,137,163,48,119,
-    162,94,229,155,95,147,70,89,100,103,176,86,92,113,20,159,
-    142,106,208,123,114,154,117,150,104,80,125,48,136,150,74,164,
-    61,52,156,109,177,184,119,154,97,134,172,111,194,110,49,114,
-    38,109,161,101,145,107,91,130,99,178,150,98,174,100,129,176,
-    83,126,97,53,134,117,156,166,86,127,66,76,175,115,173,162,
-    61,116,81,107,175,113,151,113,73,134,84,143,165,77,138,109,
-    95,171,110,129,127,72,140,123,149,176,80,126,111,74,177,137,
-    133,147,52,94,91,111,187,123,153,115,52,141,107,125,192,103,
-    117,118,84,150,112,131,133,70,143,120,111,174,77,93,136,83,
-    167,164,144,160,76,113,107,101,202,120,116,134,32,96,129,113,
-    163,117,116,117,85,162,123,123,180,75,120,147,85,142,98,77,
-    112,90,155,141,122,164,63,103,144,95,193,169,110,128,64,94,
-    118,122,183,107,117,133,47,134,152,100,167,126,111,145,109,149,
-    107,99,138,85,154,159,78,144,74,55,148,116,171,162,111,123,
-    65,111,157,131,182,115,77,121,104,131,136,102,122,66,72,152,
-    160,199,157,83,89,28,83,167,129,187,142,100,98,65,112,129,
-    121,188,148,119,161,86,102,90,84,147,119,172,156,82,99,73,
-    83,155,155,169,167,92,88,73,93,151,151,167,137,85,98,72,
-    109,151,108,140,123,94,126,112,127,120,95,130,117,148,186,126,
-    136,117,70,118,127,138,162,115,103,91,83,144,126,146,155,89,
-    124,114,111,165,128,124,133,100,125,118,111,135,86,117,141,109,
-    175,124,99,118,59,113,134,136,173,109,107,108,82,153,142,130,
-    158,86,94,115,93,131,120,108,133,83,120,132,94,162,105,123,
-    152,122,158,142,85,143,99,102,142,109,150,83,81,99,106,141,
-    116,106,135,72,176,151,93,178,93,179,162,108,167,58,80,151,
-    89,130,109,82,146,74,115,147,75,177,123,101,204,85,186,163,
-    73,195,66,122,156,53,159,85,57,168,46,117,144,55,167,100,
-    127,219,122,219,180,57,163,48,80,156,37,154,105,40,150,49,
-    104,166,73,214,140,103,212,62,154,146,32,155,57,91,178,47,
-    157,115,57,193,80,158,204,56,171,104,76,196,73,155,147,29,
-    149,63,106,192,74,188,150,81,203,94,133,187,59,171,112,79,
-    184,38,123,139,47,196,112,125,202,62,139,116,63,186,89,131,
-    170,28,130,89,64,204,89,147,171,73,181,106,116,193,76,156,
-    141,46,181,67,70,157,36,140,124,95,190,95,133,141,76,200,
-    137,155,192,29,100,99,69,177,87,108,124,41,158,118,116,208,
-    99,154,159,76,175,91,86,136,35,142,109,96,191,61,106,136,
-    68,186,155,141,191,64,110,113,77,187,101,109,151,52,150,127,
-    95,186,86,115,141,73,166,118,106,169,65,144,145,82,183,96,
-    95,157,85,158,146,102,153,61,90,128,83,185,130,92,153,67,
-    117,147,108,169,113,104,134,83,148,125,91,152,81,111,149,105,
-    154,117,94,136,106,146,152,110,152,86,86,135,98,155,141,96,
-    122,97,116,142,130,165,117,100,131,84,140,148,98,133,104,97,
-    123,112,145,120,104,140,102,139,159,104,144,115,86,139,121,144,
-    138,90,115,76,103,152,110,162,135,74,134,105,123,168,116,140,
-    110,91,138,94,143,146,73,145,113,90,163,102,124,131,88,150,
-    108,136,154,67,130,114,88,180,122,126,153,60,117,112,114,177,
-    106,144,122,60,153,98,116,183,85,130,137,80,151,102,117,140,
-    73,161,117,100,168,66,109,142,82,169,147,112,141,60,129,121,
-    98,191,91,105,151,59,138,149,114,155,81,143,124,114,192,91,
-    89,135,56,98,168,156,201,119,81,87,21,127,141,140,220,109,
-    127,111,17,122,113,115,210,146,140,117,41,106,57,104,195,117,
-    219,138,43,132,67,113,188,153,185,121,65,101,33,126,168,120,
-    196,110,66,127,57,135,155,105,185,106,115,136,63,144,101,78,
-    181,102,153,172,76,142,95,94,160,115,161,136,69,130,68,104,
-    179,91,156,133,78,144,104,144,157,98,147,96,88,151,85,132,
-    145,70,142,113,124,167,95,145,114,85,160,96,144,162,66,143,
-    108,98,161,105,140,142,72,137,76,116,165,71,153,118,70,159,
-    116,122,200,96,151,126,95,147,84,117,138,114,117,85,101,85,
-    104,172,66,136,108,116,213,110,145,127,63,140,160,136,137,85,
-    99,84,102,167,96,125,142,29,148,138,110,248,91,155,105,58,
-    177,76,159,154,38,127,105,62,170,92,114,129,68,191,165,179,
-    244,90,131,109,31,174,101,97,142,25,83,94,76,193,101,137,
-    179,43,186,141,105,215,50,92,102,29,175,96,112,172,43,158,
-    137,102,245,103,109,155,52,176,133,107,175,26,96,114,54,215,
-    115,101,174,41,151,170,114,218,101,95,139,55,178,117,75,178,
-    43,128,184,92,218,129,82,146,37,143,137,82,184,41,64,139,
-    41,184,154,72,174,66,135,179,116,211,121,93,159,52,149,175,
-    62,144,53,67,148,128,180,118,83,139,90,164,190,103,160,79,
-    73,133,80,143,140,68,97,59,108,161,120,197,126,99,143,104,
-    164,161,118,111,81,85,131,111,147,105,53,123,76,128,191,134,
-    158,136,120,154,140,166,140,86,106,63,80,162,108,130,118,65,
-    119,110,151,172,136,146,99,112,152,106,135,121,48,81,100,106,
-    153,141,122,97,90,129,128,164,161,93,113,99,89,159,135,113,
-    108,76,93,104,146,165,115,128,105,87,160,154,139,146,92,82,
-    104,128,161,135,130,114,80,125,133,133,165,118,89,115,107,143,
-    157,144,122,81,114,117,129,177,127,97,115,86,123,152,144,140,
-    96,100,98,114,161,125,108,127,81,106,152,132,157,129,97,102,
-    112,152,139,128,126,63,85,123,115,158,137,94,99,99,123,149,
-    156,165,106,100,116,93,153,141,99,119,93,98,129,133,141,111,
-    110,117,98,168,161,119,139,84,80,132,129,157,132,102,96,68,
-    123,139,128,177,122,80,140,101,144,145,116,127,92,112,125,118,
-    150,100,78,135,86,134,169,105,119,117,100,109,155,179,95,136,
-    125,70,106,144,107,96,139,121,128,158,162,127,65,80,69,109,
-    194,161,188,121,31,63,84,104,211,188,160,112,61,99,68,149,
-    162,104,158,107,79,143,114,128,137,115,121,122,152,140,95,105,
-    95,83,160,167,145,145,70,69,90,120,174,156,146,103,43,89,
-    84,117,188,128,124,142,110,132,140,142,140,104,144,125,106,148,
-    81,76,103,88,131,158,132,114,90,92,110,141,208,146,126,133,
-    54,96,133,124,152,139,111,103,102,143,127,121,147,70,114,147,
-    110,146,129,78,117,134,124,148,149,128,55,97,101,114,191,106,
-    74,110,86,176,165,118,167,79,159,152,89,188,81,80,166,75,
-    88,115,91,138,86,132,131,43,198,119,66,197,83,148,197,84,
-    175,103,95,146,55,175,123,72,193,71,84,174,53,124,155,116,
-    216,125,173,153,38,166,67,81,196,72,148,158,39,142,87,96,
-    173,97,197,123,65,174,58,129,181,39,146,97,71,161,76,158,
-    147,74,167,67,102,176,37,145,133,68,190,94,114,149,39,147,
-    99,112,210,82,170,147,47,161,89,101,199,87,137,122,50,159,
-    83,138,181,76,187,121,86,194,75,122,154,66,161,101,98,158,
-    50,133,125,86,217,106,126,178,51,150,132,105,198,97,117,120,
-    38,156,87,94,190,48,128,132,59,183,121,131,183,95,176,122,
-    86,180,54,109,153,47,167,115,64,153,68,130,139,105,209,110,
-    116,165,42,152,144,66,184,83,85,127,58,158,108,113,184,69,
-    157,155,67,193,116,89,170,80,146,129,74,144,62,115,148,67,
-    191,131,70,169,76,125,170,96,167,110,98,153,60,154,136,84,
-    192,88,103,167,85,139,114,96,142,105,172,114,55,137,83,123,
-    178,103,147,118,87,137,96,136,148,114,155,93,97,149,73,139,
-    139,99,155,98,137,127,89,145,94,117,159,92,144,132,62,132,
-    101,116,169,117,152,127,106,157,93,145,153,66,141,97,74,158,
-    99,129,146,94,144,93,124,159,76,163,133,84,176,94,105,143,
-    64,121,113,121,169,93,144,122,64,165,113,114,189,96,123,130,
-    89,148,106,128,142,78,144,100,91,174,81,119,154,87,151,129,
-    115,146,78,131,125,108,192,97,100,143,56,129,148,114,171,111,
-    102,108,81,163,118,126,194,68,124,127,62,173,113,71,169,104,
-    120,166,84,132,66,105,124,72,227,165,113,167,66,59,94,87,
-    148,140,147,169,83,131,91,44,162,125,163,208,128,137,81,45,
-    108,96,154,164,135,144,48,64,127,93,185,194,116,153,85,80,
-    121,101,175,144,115,157,57,99,124,68,155,132,119,150,93,118,
-    106,72,131,89,134,175,95,161,139,78,158,121,142,164,104,137,
-    85,86,135,83,148,148,85,149,100,95,151,103,135,136,113,145,
-    101,136,138,75,160,126,101,178,115,121,129,93,118,107,137,139,
-    91,127,104,67,155,115,120,166,89,119,102,106,137,107,137,121,
-    94,138,103,106,161,88,120,137,111,163,133,147,138,107,144,102,
-    116,166,96,105,130,66,115,120,108,139,102,128,101,124,166,104,
-    148,173,89,148,146,92,176,114,66,101,97,147,148,100,108,53,
-    114,169,104,175,111,52,137,120,139,140,121,159,89,95,141,75,
-    143,156,65,136,113,104,174,110,141,110,88,160,95,158,158,74,
-    143,93,87,171,113,123,120,81,141,126,171,201,104,144,94,46,
-    138,99,132,157,80,108,99,90,142,107,160,148,81,159,111,117,
-    168,70,97,107,75,165,131,135,139,59,118,108,126,211,118,120,
-    123,45,128,124,120,167,88,101,99,79,166,116,127,161,70,135,
-    141,103,167,116,99,124,86,155,128,107,155,66,120,147,106,197,
-    145,99,131,71,115,135,124,163,89,88,113,71,165,152,104,165,
-    95,102,145,119,168,132,111,132,78,144,137,85,160,86,72,150,
-    101,148,147,110,133,89,130,158,128,164,87,63,115,85,161,140,
-    91,112,82,124,133,129,185,116,108,154,83,131,149,99,133,89,
-    93,111,95,159,99,96,140,66,148,162,114,172,115,97,124,104,
-    165,139,107,138,60,100,140,94,174,149,107,155,105,139,145,104,
-    152,92,108,150,96,150,127,67,134,96,111,167,115,159,115,91,
-    140,88,155,150,79,134,86,84,149,109,145,134,84,122,80,125,
-    153,94,151,108,85,147,105,136,146,88,131,105,115,163,109,146,
-    122,69,140,103,132,166,90,120,95,81,146,120,148,152,90,136,
-    103,111,165,99,134,123,76,136,108,122,151,88,124,112,101,166,
-    117,136,145,89,149,136,129,171,101,108,104,74,142,120,131,147,
-    79,114,104,100,174,133,142,148,93,127,116,116,151,98,118,118,
-    86,145,107,108,138,91,130,138,131,167,120,114,115,79,141,131,
-    122,155,88,100,106,87,147,129,132,147,98,128,122,109,154,109,
-    115,135,96,136,119,97,122,89,113,128,114,158,121,102,125,88,
-    128,149,128,152,109,100,107,93,143,124,122,142,94,107,128,108,
-    149,132,110,142,108,135,126,105,136,97,109,142,114,141,120,78,
-    118,95,129,169,130,140,113,76,140,138,116,154,108,124,95,86,
-    174,130,163,130,50,101,98,135,189,132,124,101,53,99,98,155,
-    185,135,146,78,58,132,105,154,166,111,136,102,107,114,101,137,
-    142,132,159,109,120,129,64,123,119,111,180,131,114,121,64,120,
-    129,136,186,104,115,109,60,124,98,122,153,101,130,117,114,155,
-    116,147,148,103,155,129,110,150,89,97,119,91,144,113,112,130,
-    79,127,115,114,176,108,118,117,91,140,121,124,149,97,125,123,
-    101,165,127,106,142,68,130,147,79,151,101,113,105,117,162,140,
-    129,102,82,112,96,179,170,85,124,36,121,147,116,197,115,85,
-    149,104,138,158,128,152,89,128,133,69,150,110,44,146,72,140,
-    210,76,170,59,72,153,79,211,156,81,146,40,77,170,99,171,
-    124,84,147,87,169,189,113,170,69,55,134,73,141,143,70,132,
-    96,110,181,108,173,130,81,178,96,156,179,58,104,51,66,160,
-    115,184,137,67,147,70,131,208,110,173,110,60,146,74,135,145,
-    63,137,68,113,183,92,167,133,74,165,119,143,187,82,121,85,
-    73,164,95,152,144,43,146,101,118,220,116,157,117,55,145,88,
-    138,174,53,124,91,59,195,102,130,157,60,156,126,141,203,94,
-    131,112,50,170,106,112,177,31,93,108,70,193,122,129,157,51,
-    155,132,126,215,68,105,120,66,182,86,96,137,46,180,116,103,
-    216,75,142,156,52,181,118,101,173,41,102,93,70,194,82,115,
-    152,34,168,124,103,227,82,148,137,56,192,88,114,173,38,142,
-    125,67,205,96,116,163,58,183,135,120,213,64,132,140,45,195,
-    103,72,175,46,131,149,76,203,86,106,160,40,188,127,74,194,
-    54,108,150,47,171,100,79,162,42,156,141,74,205,73,104,168,
-    54,183,145,84,176,64,126,154,77,193,100,85,164,48,152,159,
-    76,183,94,101,160,73,174,128,86,173,56,132,161,69,179,109,
-    78,151,75,148,145,91,161,84,122,163,82,163,128,80,152,88,
-    128,161,102,154,101,99,142,77,156,140,78,155,96,107,155,96,
-    146,125,103,149,97,148,147,83,145,97,91,158,99,131,125,76,
-    120,92,133,161,108,155,115,86,148,99,134,164,93,127,100,85,
-    140,99,135,132,98,146,103,119,172,96,135,134,89,156,110,118,
-    131,84,135,99,95,183,93,113,140,79,151,119,116,167,79,125,
-    127,91,176,108,125,160,49,142,134,80,221,108,72,130,78,131,
-    108,148,214,86,150,130,26,137,87,91,167,112,167,144,75,133,
-    31,86,161,135,252,145,82,127,2,62,148,126,216,164,112,101,
-    10,138,133,125,255,108,105,129,29,116,124,106,183,102,137,112,
-    40,172,72,98,179,74,165,153,73,147,72,94,153,104,210,137,
-    102,170,44,122,163,84,198,137,87,133,54,120,110,98,185,96,
-    143,165,59,152,137,72,178,126,135,159,70,124,65,89,162,87,
-    178,167,62,142,86,77,171,109,155,141,87,135,59,127,159,80,
-    185,123,84,162,76,113,136,94,145,121,128,154,81,125,115,84,
-    190,125,145,170,73,96,85,93,151,110,157,120,69,148,74,90,
-    178,108,135,150,77,160,118,74,115,104,148,207,135,99,67,51,
-    186,154,169,169,55,98,115,96,114,111,150,124,97,167,87,93,
-    158,70,130,186,117,177,144,78,122,41,131,141,126,187,59,89,
-    98,40,147,164,130,166,98,127,143,144,230,138,139,138,49,118,
-    108,86,137,95,84,125,107,131,111,122,145,74,170,173,116,175,
-    93,35,65,60,140,167,158,163,67,88,99,82,202,165,120,163,
-    81,94,121,94,143,96,104,124,82,167,129,88,161,99,128,180,
-    132,173,132,80,99,85,146,155,115,155,72,58,140,100,175,198,
-    120,130,76,90,116,103,165,116,82,124,68,118,153,87,137,124,
-    109,161,142,160,138,86,131,84,125,182,91,131,96,26,106,105,
-    150,192,122,143,101,89,172,110,176,163,62,145,77,71,155,81,
-    111,127,78,183,139,122,162,75,132,184,137,167,89,65,125,65,
-    121,130,105,149,102,114,116,54,176,159,114,207,90,82,126,81,
-    129,121,114,144,108,119,120,61,152,116,94,189,107,140,139,79,
-    118,92,119,149,121,182,150,105,165,87,104,163,95,135,123,84,
-    111,96,131,133,107,158,108,108,161,91,127,156,94,129,117,94,
-    106,73,121,118,113,172,107,117,148,82,125,135,111,159,124,120,
-    119,95,131,101,124,161,97,132,145,91,143,130,116,144,121,134,
-    107,106,129,75,122,148,94,152,130,94,137,116,127,141,124,138,
-    118,109,116,94,133,121,114,143,83,127,114,112,165,105,116,129,
-    90,108,122,139,184,137,115,103,41,65,93,106,164,153,177,141,
-    71,107,73,106,194,182,181,150,78,73,33,75,147,131,206,162,
-    82,102,78,122,167,166,195,145,110,111,59,113,116,103,167,131,
-    127,123,75,106,112,99,146,124,129,133,76,111,81,84,146,107,
-    149,161,107,137,105,98,134,111,153,135,106,139,80,105,139,98,
-    155,143,121,153,92,111,129,99,161,125,124,156,81,116,120,93,
-    157,122,136,158,87,126,102,86,152,98,128,143,77,135,95,98,
-    156,100,149,144,98,145,90,103,146,97,155,138,103,154,79,108,
-    135,97,170,136,130,163,90,121,124,92,164,119,114,145,63,110,
-    104,76,156,107,134,150,88,140,109,108,171,127,158,158,93,140,
-    92,83,138,92,150,134,91,141,67,95,128,88,162,132,109,154,
-    89,112,124,91,165,125,130,161,80,124,113,87,154,127,124,154,
-    83,122,112,87,159,112,139,157,92,146,114,83,150,92,156,135,
-    98,149,84,109,123,93,147,154,108,164,96,86,142,77,163,129,
-    115,152,74,96,109,104,141,147,134,122,76,87,78,147,158,164,
-    169,92,133,114,122,147,110,117,139,112,134,119,104,127,99,128,
-    134,132,155,103,85,126,75,162,151,106,174,47,109,102,79,183,
-    124,118,134,71,112,128,87,152,97,125,165,124,201,160,109,143,
-    69,89,153,104,158,110,54,107,50,118,159,110,189,108,86,155,
-    79,173,164,91,136,63,96,142,97,162,124,76,153,81,139,172,
-    83,153,96,101,162,93,157,131,57,132,76,120,185,109,159,116,
-    74,142,99,151,178,86,135,81,67,151,83,155,156,75,159,100,
-    129,183,105,154,99,89,158,89,136,136,45,112,84,105,196,123,
-    159,131,79,152,117,163,192,106,142,97,68,147,93,126,145,57,
-    129,100,102,173,118,154,143,103,165,144,137,133,65,97,82,130,
-    156,80,105,88,85,139,130,160,170,120,142,107,97,146,122,138,
-    124,80,97,80,105,128,87,130,111,111,161,118,147,140,106,133,
-    113,137,165,106,112,94,70,119,115,143,164,123,133,115,106,159,
-    118,137,135,77,122,106,107,147,105,117,126,91,141,118,125,153,
-    99,133,118,104,153,99,91,117,84,135,133,125,154,90,107,106,
-    92,160,132,123,139,78,104,125,112,163,126,119,129,86,141,126,
-    116,166,98,115,132,98,148,114,100,126,95,137,140,122,160,99,
-    104,134,95,153,143,110,137,77,108,125,103,170,126,118,136,84,
-    130,134,103,155,119,113,145,105,147,121,94,129,88,132,155,103,
-    150,104,76,131,106,153,159,126,138,85,102,138,104,166,147,89,
-    125,76,98,134,107,144,121,110,127,99,141,145,98,143,107,113,
-    153,108,134,120,84,115,102,128,152,112,148,95,90,148,107,136,
-    161,103,122,105,104,149,107,132,122,95,151,91,111,157,78,97,
-    140,108,159,165,110,129,85,125,81,117,197,142,142,144,78,81,
-    88,83,129,122,168,149,158,140,68,91,115,114,186,171,133,138,
-    48,42,66,112,156,157,181,114,51,94,99,115,210,171,143,136,
-    71,87,76,116,147,117,144,120,74,130,97,93,139,103,134,134,
-    135,139,100,100,96,95,152,138,134,168,93,105,133,109,160,154,
-    127,119,91,115,110,115,160,105,115,130,86,130,132,114,134,136,
-    135,133,122,145,103,104,139,93,145,150,104,141,110,99,115,118,
-    132,111,118,126,91,115,140,106,157,144,102,121,109,113,122,123,
-    140,100,148,142,70,113,137,94,132,156,121,195,134,72,85,110,
-    121,164,150,84,83,115,128,89,133,126,86,133,144,94,106,124,
-    132,133,147,148,102,106,112,76,87,130,108,172,159,100,114,74,
-    105,125,164,169,141,130,105,81,111,144,123,162,141,123,157,130,
-    137,138,135,134,109,129,104,88,116,86,69,139,130,124,149,131,
-    120,91,114,129,121,158,130,81,96,63,92,147,130,155,142,100,
-    103,97,142,131,118,143,92,94,122,89,98,115,74,120,134,139,
-    145,111,132,104,114,160,131,153,146,85,103,104,109,137,130,136,
-    120,101,133,110,139,167,130,150,117,89,127,113,116,122,102,110,
-    109,130,143,106,126,120,95,153,147,139,165,116,106,112,112,141,
-    113,147,116,60,111,106,102,159,141,124,158,116,101,135,144,140,
-    155,124,95,81,112,122,87,126,108,88,146,151,142,135,118,121,
-    120,145,140,122,120,85,57,101,111,102,176,123,91,112,83,133,
-    150,154,155,106,110,106,88,141,113,106,142,100,131,154,121,130,
-    104,102,119,114,159,138,107,136,87,96,156,123,147,146,99,116,
-    98,130,152,122,150,89,76,119,86,139,162,118,147,120,110,132,
-    102,145,117,97,137,91,130,146,89,122,100,95,149,132,152,134,
-    107,127,90,128,162,115,144,115,62,113,99,122,152,116,131,108,
-    115,144,109,146,140,89,137,112,110,148,105,111,105,99,134,121,
-    139,139,81,122,106,111,185,135,141,127,78,102,107,140,153,111,
-    124,94,73,138,109,129,161,106,124,123,117,143,127,134,122,103,
-    144,107,107,144,78,105,126,113,157,135,127,116,86,117,118,132,
-    171,114,112,110,72,121,128,121,148,117,118,112,103,143,114,121,
-    144,108,139,133,107,134,95,106,127,119,152,129,106,124,77,110,
-    129,122,162,125,115,124,93,123,141,134,154,106,123,125,89,132,
-    116,99,134,108,135,156,110,118,119,100,173,122,144,149,99,100,
-    42,135,164,148,154,119,57,68,98,137,164,134,158,103,64,109,
-    90,146,169,136,135,91,93,132,110,116,134,107,125,122,135,134,
-    90,142,125,97,151,133,139,134,85,90,90,128,166,128,155,106,
-    62,112,118,134,169,148,119,97,76,99,97,131,139,102,134,110,
-    115,151,126,149,136,122,147,128,143,133,92,110,90,96,135,110,
-    125,128,86,108,120,133,158,137,140,125,97,138,102,122,149,116,
-    127,113,120,125,115,124,121,105,142,110,106,143,82,107,137,119,
-    142,148,120,103,109,112,114,131,150,97,118,91,77,155,114,95,
-    147,117,146,201,95,126,91,107,190,112,160,100,46,131,90,82,
-    135,103,152,126,94,145,49,124,150,77,188,143,107,194,73,100,
-    130,74,189,110,132,166,41,119,100,78,188,113,128,158,79,174,
-    158,155,221,98,126,113,43,150,94,99,167,71,120,124,73,148,
-    101,129,166,96,181,138,99,163,42,77,116,78,184,138,113,145,
-    52,109,110,96,200,101,111,141,51,133,117,96,169,78,107,134,
-    83,180,114,111,173,81,147,140,91,169,100,91,148,95,170,148,
-    90,157,64,116,163,106,206,139,77,127,53,115,142,97,180,102,
-    89,140,70,163,147,89,178,99,117,168,86,159,118,78,158,77,
-    146,153,59,145,72,72,165,95,171,164,78,159,91,120,186,97,
-    174,115,53,140,54,118,158,62,152,105,87,172,91,166,167,84,
-    179,100,112,173,50,125,101,45,159,91,130,158,51,144,105,101,
-    211,110,168,160,49,149,91,109,184,78,131,99,56,150,87,145,
-    172,70,158,122,103,187,85,129,132,70,171,113,125,166,56,125,
-    118,83,190,115,129,144,44,129,110,119,192,89,126,119,61,159,
-    117,128,177,73,128,126,87,173,99,117,149,78,159,131,109,167,
-    65,102,138,84,181,134,108,152,55,123,133,104,194,103,109,138,
-    56,141,132,105,175,80,105,133,75,166,113,104,161,73,138,145,
-    90,166,90,90,146,90,163,143,99,153,67,112,153,101,192,125,
-    88,140,61,121,147,107,175,94,95,139,72,159,136,98,168,89,
-    116,146,83,158,106,80,155,87,145,146,79,150,77,96,163,97,
-    166,142,77,141,86,123,170,106,169,111,77,145,82,142,154,85,
-    146,97,96,151,95,149,138,80,154,105,129,167,79,138,106,84,
-    154,108,143,147,74,123,103,112,171,111,147,128,69,133,107,124,
-    162,90,131,109,86,148,107,131,154,78,131,127,117,167,88,130,
-    125,81,135,134,142,130,92,104,77,117,166,127,184,143,39,108,
-    121,109,132,149,179,132,86,131,79,59,135,89,142,143,152,188,
-    83,67,94,76,158,201,185,167,50,72,53,50,189,161,169,186,
-    53,69,78,102,188,150,174,145,79,134,93,80,161,101,142,155,
-    105,146,79,89,121,89,150,151,113,153,71,73,118,76,178,149,
-    117,158,73,116,134,104,185,143,114,156,78,110,125,89,155,110,
-    107,137,90,142,118,84,147,92,138,177,97,181,104,63,142,87,
-    151,153,111,159,81,76,137,72,164,147,87,142,77,105,157,89,
-    182,146,96,159,79,124,122,86,140,136,116,110,73,104,60,160,
-    162,112,192,111,169,145,111,163,82,110,169,113,118,99,50,110,
-    80,122,159,94,153,97,60,168,100,182,204,79,203,49,109,157,
-    51,176,94,73,132,82,100,130,42,129,105,103,233,139,211,176,
-    62,148,71,102,188,99,139,106,23,117,61,122,187,80,183,121,
-    69,186,107,156,170,68,146,69,99,168,63,164,126,81,179,99,
-    137,156,44,137,95,109,204,91,159,98,18,134,78,147,211,93,
-    160,111,70,166,94,167,173,68,163,95,85,182,53,140,148,76,
-    205,111,148,185,62,140,103,79,199,84,124,139,4,126,97,117,
-    224,90,135,122,49,197,115,149,210,69,137,111,48,179,96,98,
-    124,40,138,112,141,162,51,125,144,112,218,145,104,129,46,125,
-    113,103,181,77,77,91,47,153,137,135,190,84,118,121,120,182,
-    116,116,111,63,128,127,101,155,67,88,131,97,181,150,125,148,
-    91,162,160,136,192,88,70,103,49,136,158,111,144,71,95,115,
-    95,190,135,122,148,83,136,146,101,137,81,71,121,103,169,138,
-    113,133,60,113,156,132,175,123,67,100,78,137,167,126,139,75,
-    81,122,103,179,167,110,138,90,109,152,121,151,109,87,128,100,
-    151,153,94,129,99,109,171,140,156,125,72,99,87,143,181,128,
-    143,90,59,125,109,154,170,109,119,93,107,147,125,155,118,78,
-    129,108,129,161,97,107,108,101,152,143,162,138,80,111,99,130,
-    182,124,123,98,50,106,122,145,159,106,113,94,99,160,139,154,
-    148,81,113,118,111,146,107,99,96,92,139,122,137,143,75,111,
-    129,125,179,144,119,106,74,112,125,152,162,91,92,92,67,144,
-    153,142,153,101,108,108,124,158,119,124,122,89,134,126,101,132,
-    90,88,124,129,169,129,126,115,74,126,140,145,172,108,77,110,
-    89,125,145,134,132,94,115,122,123,165,106,102,131,120,150,160,
-    114,102,59,64,106,151,237,185,126,97,5,38,118,142,207,168,
-    133,114,69,73,90,114,171,152,161,167,91,100,58,56,111,138,
-    192,193,142,102,53,62,127,145,221,190,103,95,31,47,118,159,
-    201,162,104,95,59,107,149,135,174,129,92,121,80,99,115,94,
-    123,116,154,171,125,155,114,82,144,127,163,171,109,96,60,79,
-    116,131,162,133,83,103,88,106,179,146,150,133,85,114,116,133,
-    145,110,121,107,121,165,121,124,119,70,102,120,132,150,109,102,
-    91,100,161,154,157,155,72,120,102,84,158,137,111,99,89,98,
-    145,139,111,108,124,139,215,154,97,117,73,137,119,135,145,56,
-    86,117,71,100,121,148,146,103,157,83,76,175,113,130,173,83,
-    174,114,66,156,66,150,136,98,168,78,77,140,59,143,166,107,
-    172,105,134,174,120,213,148,98,156,44,92,118,61,168,126,90,
-    160,66,108,131,93,197,132,140,191,77,142,96,21,132,72,136,
-    183,95,160,85,58,133,72,167,177,81,160,74,60,149,66,158,
-    143,80,156,72,121,151,80,181,137,102,185,88,127,151,60,153,
-    116,123,188,85,150,112,50,177,110,154,215,80,135,88,50,152,
-    87,157,162,71,153,85,92,182,81,154,165,81,173,103,114,160,
-    67,152,109,81,181,67,108,136,37,152,128,124,195,95,144,124,
-    76,183,107,133,179,47,120,97,53,164,87,121,150,79,158,102,
-    124,197,90,161,150,73,169,87,82,130,52,127,113,101,175,72,
-    116,136,62,187,142,127,195,76,112,117,76,167,106,120,141,52,
-    129,106,80,189,109,129,164,80,150,113,105,156,88,146,146,97,
-    155,81,94,145,96,157,139,104,141,94,105,124,102,161,126,112,
-    149,82,110,140,103,156,139,109,133,95,122,112,102,142,113,130,
-    143,101,117,126,92,130,128,128,139,105,121,99,102,137,113,145,
-    158,108,130,120,97,133,120,129,131,110,122,91,111,133,106,142,
-    132,115,142,117,115,132,120,130,122,123,130,89,121,114,95,154,
-    127,131,152,111,115,106,116,137,114,145,125,85,129,91,93,149,
-    109,131,136,115,131,101,129,132,111,158,119,106,144,81,95,126,
-    98,138,126,129,135,97,135,105,106,172,117,135,162,89,118,109,
-    93,137,112,137,124,103,149,87,106,158,95,154,158,100,149,100,
-    89,110,97,145,113,117,153,74,110,130,79,167,149,123,154,109,
-    112,110,99,148,98,134,157,76,134,117,86,141,124,127,138,123,
-    137,98,127,134,66,145,134,82,130,121,139,162,141,123,93,63,
-    109,66,157,182,123,194,90,47,86,89,142,206,170,159,99,74,
-    74,51,160,145,132,196,100,75,110,76,128,147,152,158,116,139,
-    97,66,136,114,137,193,121,122,109,62,98,95,131,149,130,155,
-    92,78,119,69,129,182,130,166,138,94,113,86,114,125,131,164,
-    115,134,141,70,128,134,105,160,133,113,119,85,105,97,123,162,
-    108,145,137,75,136,120,114,167,136,141,114,99,105,66,120,137,
-    103,159,126,86,130,93,111,152,132,156,114,114,120,78,122,116,
-    117,168,125,113,133,85,102,121,140,161,158,169,116,74,121,83,
-    120,170,120,157,124,46,62,69,105,188,147,126,80,82,181,128,
-    161,173,73,128,148,116,125,87,101,92,81,167,119,113,142,36,
-    87,136,113,216,187,135,118,27,102,112,129,205,112,109,105,25,
-    114,127,108,179,117,145,171,146,210,129,107,129,60,147,153,84,
-    140,66,53,120,85,166,152,113,134,51,124,162,121,214,132,54,
-    93,32,117,165,127,174,96,92,126,70,163,140,86,163,94,118,
-    173,97,134,81,52,126,98,191,171,86,137,57,86,188,139,201,
-    176,67,97,67,117,165,121,178,100,73,153,83,156,190,94,137,
-    99,101,149,101,140,92,56,133,91,154,196,79,121,104,77,183,
-    170,188,165,72,106,58,106,189,104,150,114,21,101,94,133,185,
-    124,143,109,110,168,106,153,143,38,126,107,100,169,79,75,87,
-    83,161,144,185,175,65,117,102,94,203,135,112,112,35,90,88,
-    130,173,97,126,113,68,185,154,119,168,90,101,156,143,136,101,
-    79,94,88,150,154,126,151,84,73,130,115,169,184,116,110,73,
-    87,123,130,167,129,86,134,103,109,177,110,130,132,97,147,133,
-    140,111,72,115,105,134,193,123,132,129,57,120,142,143,158,104,
-    91,67,78,152,129,150,156,70,108,115,102,164,142,122,122,99,
-    129,103,115,129,59,112,132,115,182,144,99,113,80,117,143,159,
-    168,90,90,85,66,162,160,129,156,86,82,112,121,165,141,146,
-    129,86,143,125,109,157,96,92,133,112,148,130,108,103,80,132,
-    135,134,176,102,80,123,91,146,166,134,129,76,87,97,114,174,
-    126,114,135,75,109,145,124,149,123,109,115,114,148,119,108,129,
-    77,122,150,120,151,124,85,107,121,152,150,129,148,74,94,115,
-    113,169,142,90,119,102,92,134,122,127,116,125,145,127,137,113,
-    75,94,97,133,201,187,158,87,20,51,56,164,195,182,177,91,
-    48,67,93,139,205,185,170,119,80,74,67,116,122,129,174,145,
-    115,89,60,81,129,154,187,180,146,103,53,80,84,145,197,163,
-    141,90,41,62,112,145,176,137,123,93,73,116,111,141,156,118,
-    128,125,100,128,114,109,115,125,161,135,136,133,72,108,135,130,
-    173,142,116,97,61,88,114,147,168,123,131,114,78,140,141,141,
-    159,111,119,100,107,125,94,122,119,94,135,128,103,144,86,110,
-    144,131,172,131,114,99,59,115,135,141,179,126,94,104,67,122,
-    155,139,170,118,123,96,107,161,129,127,131,80,102,101,114,158,
-    91,106,64,94,175,135,164,135,56,115,152,170,206,138,106,69,
-    61,129,117,156,148,54,80,63,78,181,142,164,128,76,127,96,
-    160,163,107,138,97,79,157,127,119,127,64,131,145,186,236,136,
-    122,58,21,132,140,169,186,76,69,72,71,162,142,171,152,61,
-    133,98,114,184,92,102,97,67,153,143,138,132,60,117,119,126,
-    212,111,94,91,23,130,156,159,180,81,77,66,78,196,164,165,
-    171,55,102,118,100,183,128,104,111,77,145,132,128,155,63,115,
-    149,118,211,152,99,103,48,116,142,148,175,72,62,86,64,185,
-    187,135,159,68,81,126,130,197,155,121,121,59,123,134,100,168,
-    88,72,125,93,159,151,111,122,80,134,164,137,186,100,44,100,
-    66,149,177,115,116,56,75,110,127,211,172,111,132,65,117,175,
-    98,144,101,63,128,100,133,125,79,131,94,120,195,119,158,146,
-    53,115,102,144,186,119,126,54,46,127,98,168,197,80,130,106,
-    80,177,131,160,142,82,131,89,125,161,70,126,122,83,180,131,
-    136,168,90,132,123,130,186,96,116,96,37,151,136,132,186,85,
-    82,92,78,167,134,155,161,62,123,98,83,170,101,111,143,93,
-    149,126,111,141,66,123,134,104,189,108,85,123,61,142,158,134,
-    175,90,92,99,77,174,144,124,158,70,103,133,99,165,120,101,
-    131,88,150,134,110,155,79,111,151,106,165,131,86,111,73,127,
-    159,129,168,95,69,106,78,167,168,131,164,91,89,123,107,165,
-    138,110,125,73,118,128,90,144,105,95,141,115,150,137,100,129,
-    96,128,158,127,162,101,61,108,79,141,173,128,144,109,90,104,
-    129,173,158,113,145,91,88,130,92,138,116,102,115,104,128,130,
-    103,129,124,118,163,115,150,134,73,130,106,120,134,122,118,98,
-    117,163,104,133,140,57,108,105,135,171,158,158,113,58,96,85,
-    130,189,134,160,99,52,98,90,122,167,145,154,132,115,146,78,
-    114,135,95,161,137,109,127,67,79,108,133,198,145,142,127,47,
-    116,120,126,192,123,106,99,58,111,109,123,166,104,133,131,99,
-    170,118,110,144,97,134,137,121,140,72,84,98,80,159,138,121,
-    159,81,101,139,113,172,141,114,128,76,120,111,99,157,96,110,
-    139,95,146,125,100,140,107,144,153,130,155,88,86,120,85,158,
-    158,104,132,81,84,120,116,171,138,114,144,77,129,140,114,175,
-    131,105,130,95,121,127,97,133,97,120,140,104,154,106,89,140,
-    91,161,172,89,135,109,65,129,106,160,184,75,77,78,95,158,
-    171,143,93,99,138,112,131,138,93,118,125,124,153,103,121,130,
-    76,122,139,133,145,125,85,68,106,145,165,169,164,89,86,109,
-    105,159,154,138,100,87,101,93,112,135,126,125,149,143,158,171,
-    136,128,101,95,96,115,131,101,90,79,95,117,144,159,158,132,
-    110,118,135,150,143,128,99,66,79,100,109,135,142,121,108,133,
-    140,145,145,120,108,107,113,111,126,110,82,88,99,141,158,159,
-    146,118,113,104,129,158,151,128,102,84,81,109,116,131,133,115,
-    112,119,145,145,145,139,109,101,127,121,130,124,89,84,91,123,
-    135,142,139,99,103,121,111,145,176,131,116,111,86,123,133,112,
-    110,103,89,137,136,116,120,101,153,127,131,176,106,118,139,88,
-    108,119,139,139,90,108,88,74,152,132,133,185,92,132,146,96,
-    158,103,126,123,80,150,99,90,137,74,114,145,96,160,139,130,
-    162,109,154,138,113,164,78,86,121,61,136,141,102,156,107,100,
-    131,108,169,134,126,169,90,133,129,64,133,97,97,146,100,141,
-    126,94,133,83,133,166,104,164,112,72,136,89,133,150,101,144,
-    96,101,131,90,156,141,96,159,104,108,155,92,136,127,109,150,
-    97,137,133,87,156,114,114,171,96,128,127,72,127,103,136,157,
-    103,148,101,85,151,93,133,164,90,134,112,94,134,91,131,123,
-    97,156,89,108,145,70,129,135,105,166,124,124,135,88,141,110,
-    126,176,85,125,120,62,140,120,122,162,106,135,117,110,167,104,
-    141,154,79,145,115,87,155,94,110,126,97,145,106,127,147,79,
-    145,129,94,174,113,102,138,88,131,122,117,152,85,122,117,78,
-    171,127,113,164,94,120,131,104,151,110,122,129,82,146,108,93,
-    154,90,117,142,93,148,124,101,134,94,139,129,104,163,100,106,
-    143,76,141,146,101,145,108,119,120,89,153,116,111,166,95,146,
-    152,71,136,106,109,176,115,130,113,73,116,65,136,207,132,174,
-    116,61,90,75,131,155,134,164,120,83,94,50,134,148,142,208,
-    132,111,121,56,83,117,134,163,136,148,96,53,113,110,130,202,
-    153,142,128,62,83,84,141,163,140,160,82,54,111,90,123,177,
-    141,134,113,99,103,87,128,126,121,162,116,125,145,93,120,132,
-    121,155,144,137,104,88,108,73,121,165,122,137,133,81,97,119,
-    123,154,153,157,103,99,128,75,130,141,112,150,137,98,107,108,
-    112,107,140,156,105,137,124,65,111,127,128,156,143,137,86,76,
-    105,82,143,157,94,166,125,44,112,126,115,224,207,105,105,89,
-    138,132,156,154,66,121,125,76,119,89,87,150,113,152,134,92,
-    121,63,95,147,129,222,185,72,128,29,77,169,125,202,130,75,
-    80,35,124,132,110,187,94,107,196,108,186,178,87,137,96,131,
-    146,83,139,65,51,157,80,156,180,75,131,95,99,184,161,193,
-    141,38,87,18,106,205,104,186,129,38,115,79,124,170,107,158,
-    100,107,175,62,133,118,35,156,129,140,186,84,101,83,90,190,
-    136,184,170,33,103,87,88,210,145,137,133,57,117,101,151,204,
-    106,149,99,52,160,93,102,150,71,119,127,129,172,86,109,114,
-    78,197,163,139,182,48,65,113,91,189,149,121,110,26,97,98,
-    125,226,127,121,144,65,145,150,122,161,90,115,118,87,158,74,
-    64,133,72,160,187,120,176,84,93,141,107,203,151,101,119,17,
-    65,150,112,158,129,67,128,137,125,141,126,161,140,124,148,100,
-    111,118,71,120,110,103,170,110,115,112,75,123,143,160,167,107,
-    95,120,75,144,154,124,169,80,90,110,87,137,123,139,138,83,
-    127,119,92,181,141,130,174,118,122,101,83,99,84,134,151,123,
-    153,102,62,119,105,138,187,145,146,110,87,94,72,136,119,98,
-    157,97,97,142,91,122,149,125,152,136,141,123,77,137,95,114,
-    179,103,122,118,63,102,122,145,169,142,159,103,85,142,97,139,
-    174,101,130,110,76,115,114,141,144,122,156,102,106,139,71,124,
-    130,115,156,125,118,109,76,109,123,122,143,125,124,137,99,115,
-    108,109,135,84,111,156,138,149,108,93,75,47,134,131,153,202,
-    154,116,97,68,101,127,177,204,127,135,83,52,110,100,133,164,
-    152,155,111,94,123,92,125,152,129,165,120,95,106,66,105,143,
-    140,175,131,95,101,72,123,125,117,161,95,99,113,77,118,114,
-    116,140,119,148,150,126,155,98,96,134,103,148,142,108,128,92,
-    91,121,113,153,136,119,135,86,126,135,108,160,141,117,140,106,
-    119,118,105,142,116,141,139,91,126,100,75,125,114,137,149,116,
-    129,96,105,125,108,152,137,101,127,96,95,135,113,137,129,109,
-    122,95,130,138,117,164,139,126,156,102,112,125,94,133,119,133,
-    133,78,109,83,86,139,127,151,153,111,123,112,116,149,133,161,
-    135,105,126,80,101,125,97,128,126,97,127,96,102,123,97,152,
-    132,139,153,95,127,125,97,148,133,127,144,96,111,97,100,146,
-    107,137,144,106,131,119,92,146,122,143,146,115,136,87,126,123,
-    99,138,145,97,162,108,81,139,104,124,135,136,134,120,93,75,
-    102,115,134,178,111,85,55,80,144,137,196,170,86,126,114,94,
-    137,121,145,122,118,146,92,126,135,67,129,138,124,225,114,106,
-    104,42,143,103,153,159,74,102,73,48,145,132,130,156,91,138,
-    128,139,192,128,144,137,72,138,104,91,156,78,111,135,103,147,
-    110,108,124,70,145,155,131,185,78,74,83,65,163,151,152,166,
-    88,102,106,94,183,133,132,153,71,126,120,108,146,98,113,120,
-    103,157,112,98,136,79,134,163,131,177,124,79,108,85,136,144,
-    121,149,69,85,120,99,184,173,119,136,85,93,129,110,151,111,
-    97,125,79,137,128,77,137,106,112,179,140,162,141,86,118,89,
-    141,170,108,148,73,40,118,91,157,179,117,142,102,107,154,120,
-    178,141,81,153,80,106,143,63,122,97,102,154,116,166,139,70,
-    153,100,123,195,97,137,101,43,115,106,157,152,86,147,76,113,
-    175,92,165,152,95,142,96,120,134,81,153,93,97,166,95,151,
-    137,64,132,103,120,168,101,143,87,86,148,81,166,155,84,135,
-    95,83,140,108,146,134,89,139,89,132,160,107,176,135,99,160,
-    92,116,130,81,126,106,129,152,95,134,112,77,152,122,144,172,
-    99,120,98,94,135,102,140,121,85,133,92,123,160,114,140,122,
-    105,134,113,130,131,102,127,102,112,142,87,117,111,88,140,128,
-    144,157,119,118,101,115,151,124,139,138,80,109,103,103,158,133,
-    134,128,102,125,102,130,149,105,140,126,94,142,109,96,128,104,
-    128,131,135,152,107,119,122,95,161,135,110,150,87,92,111,103,
-    147,123,134,127,83,134,113,103,175,118,121,151,94,129,120,94,
-    123,117,141,133,91,163,97,85,140,105,165,156,92,124,82,73,
-    159,121,169,127,88,122,29,131,186,139,187,147,68,65,71,111,
-    153,133,198,119,100,116,48,119,121,143,196,146,140,116,52,84,
-    80,113,176,157,173,114,36,99,76,123,203,154,173,129,82,103,
-    62,123,166,119,176,124,72,108,57,104,138,117,159,122,119,127,
-    63,119,115,110,180,124,134,142,76,103,93,107,174,136,164,143,
-    82,126,86,113,177,116,146,139,80,109,89,108,134,114,161,121,
-    109,157,82,115,145,98,152,139,120,129,72,95,91,98,177,129,
-    138,155,66,106,122,113,177,145,140,114,78,109,78,121,169,109,
-    150,135,73,132,103,102,154,144,163,133,128,141,66,122,112,111,
-    184,127,88,117,65,57,107,100,201,152,99,106,73,120,185,148,
-    144,124,113,178,94,109,105,45,114,138,140,130,69,108,92,65,
-    181,147,148,192,100,94,108,100,167,155,174,161,45,125,79,67,
-    169,106,131,140,92,134,107,100,151,114,177,191,163,215,108,79,
-    113,48,132,137,110,144,63,57,79,82,157,154,147,185,72,106,
-    151,73,168,131,90,115,54,117,102,88,156,102,126,166,106,167,
-    139,65,135,91,131,166,116,148,58,47,99,74,180,192,116,159,
-    90,67,141,126,177,167,120,136,64,104,119,66,163,123,101,168,
-    116,134,141,100,125,104,142,165,101,154,84,30,120,92,151,196,
-    121,126,88,84,134,126,199,169,111,149,65,78,143,85,145,126,
-    95,130,80,129,124,93,165,132,131,222,125,103,109,46,107,164,
-    180,134,71,81,63,81,156,138,155,172,119,114,108,95,143,145,
-    138,122,102,110,76,95,106,88,117,152,133,133,141,90,112,123,
-    139,156,167,156,79,79,83,71,124,162,142,162,145,101,118,126,
-    124,132,138,136,103,128,122,80,126,118,109,137,144,123,126,121,
-    97,111,133,150,128,139,92,47,108,111,124,173,147,106,103,85,
-    83,115,147,144,123,145,111,89,135,103,102,148,128,120,140,127,
-    103,103,121,108,127,175,132,110,132,84,91,147,141,142,140,124,
-    90,100,133,110,136,152,101,101,125,99,118,144,118,111,133,138,
-    111,134,134,84,112,139,113,148,164,108,100,102,95,110,150,161,
-    113,113,100,62,117,149,132,158,146,101,106,123,117,121,147,132,
-    97,137,116,78,129,119,83,127,163,129,132,133,101,88,125,134,
-    141,170,130,68,80,87,85,154,161,152,127,106,82,95,167,150,
-    113,158,126,90,169,106,89,127,87,67,89,179,174,168,156,70,
-    32,70,102,137,208,163,147,118,66,39,84,150,159,190,187,121,
-    78,82,40,88,171,166,188,178,77,51,65,104,136,194,193,106,
-    109,86,44,104,158,142,167,152,107,82,106,121,88,150,143,100,
-    146,114,78,111,98,88,127,148,144,132,162,139,94,146,128,124,
-    175,129,82,95,84,76,114,150,136,107,129,89,81,166,131,130,
-    175,118,106,129,127,108,112,134,104,111,167,128,115,153,85,80,
-    128,123,127,143,133,84,101,139,114,143,176,100,92,128,83,108,
-    157,119,114,132,119,86,128,161,110,133,148,101,115,170,114,112,
-    136,110,91,138,133,89,135,113,52,100,128,87,165,132,83,83,
-    117,156,131,191,152,83,132,124,101,160,138,100,116,101,95,96,
-    125,105,75,120,106,99,203,147,111,154,94,124,146,170,142,118,
-    119,61,78,157,134,119,164,86,98,165,148,170,175,131,85,81,
-    115,94,119,174,94,94,145,77,117,156,108,117,116,125,116,136,
-    170,73,82,115,43,140,188,111,138,120,69,84,124,162,118,135,
-    129,35,111,139,89,170,149,86,124,131,135,128,140,137,78,140,
-    146,81,167,138,54,132,112,109,165,144,129,87,120,125,100,201,
-    164,80,140,80,53,139,130,127,130,117,96,83,159,141,100,172,
-    117,86,167,132,129,169,115,95,102,128,125,104,150,84,57,135,
-    97,125,180,109,103,121,104,138,144,177,126,79,141,62,100,171,
-    99,105,116,76,116,169,151,115,128,119,117,169,139,104,97,108,
-    90,100,148,114,112,130,96,94,126,149,157,159,133,103,91,116,
-    124,117,150,92,94,139,86,132,142,102,127,105,122,125,122,144,
-    102,112,137,102,154,170,111,157,125,92,133,120,136,122,110,117,
-    78,124,148,98,151,140,82,138,130,117,148,127,115,90,107,121,
-    76,136,125,68,148,125,107,169,131,115,116,116,127,104,159,127,
-    62,136,96,80,164,123,112,145,109,109,121,158,144,106,164,105,
-    77,163,97,91,152,89,101,133,131,131,120,157,108,100,177,106,
-    110,170,81,92,137,108,122,137,132,94,92,141,98,123,195,102,
-    114,152,83,119,139,117,116,111,125,93,113,155,83,119,152,79,
-    141,159,108,135,121,106,108,126,161,104,123,139,53,112,138,104,
-    172,155,113,121,101,126,109,137,160,99,129,120,69,139,111,83,
-    144,118,118,137,127,117,99,124,126,90,167,135,84,130,96,91,
-    133,113,130,123,114,122,100,146,142,104,162,112,113,150,93,131,
-    137,105,114,106,134,137,114,193,79,64,141,84,118,149,148,169,
-    140,133,102,58,86,92,101,165,147,172,180,53,75,73,83,158,
-    219,205,147,115,76,21,75,173,129,189,201,60,62,74,90,139,
-    186,189,125,131,112,42,112,149,92,177,162,91,112,92,74,83,
-    129,145,119,172,149,64,107,98,68,161,161,131,152,126,95,89,
-    129,122,104,163,121,82,145,107,88,148,127,99,140,148,120,119,
-    137,100,94,156,115,116,171,112,78,119,117,103,157,169,123,112,
-    123,70,81,145,107,115,150,105,95,131,129,118,154,152,109,124,
-    141,86,100,133,87,115,140,112,105,125,103,85,138,162,137,169,
-    156,89,112,122,93,137,152,122,100,118,87,69,152,134,76,148,
-    145,69,154,122,125,173,131,103,135,143,132,142,100,68,92,198,
-    147,109,149,71,33,114,157,126,148,160,106,71,125,125,94,174,
-    140,73,121,112,100,157,144,101,109,121,106,119,148,106,73,119,
-    99,107,173,112,92,120,110,123,182,201,166,145,139,79,79,140,
-    106,123,164,81,61,113,101,97,141,164,112,126,163,110,107,146,
-    88,81,132,108,132,148,114,94,107,129,123,175,193,115,100,107,
-    57,114,168,121,121,112,71,71,127,146,116,153,157,94,135,162,
-    110,136,136,90,111,135,118,97,111,100,73,126,161,134,176,150,
-    84,106,110,114,158,168,123,87,74,70,80,155,149,111,146,111,
-    89,144,136,139,157,136,114,110,124,113,95,114,101,85,141,128,
-    100,123,142,108,135,153,134,172,147,106,94,93,89,122,154,116,
-    89,102,89,93,160,157,141,148,128,117,120,128,125,119,123,112,
-    84,138,106,83,139,99,89,143,146,131,135,113,84,92,155,148,
-    156,187,112,80,103,89,105,148,131,109,115,115,96,115,156,121,
-    124,167,110,115,162,110,106,124,101,95,127,140,96,101,126,78,
-    117,177,125,147,150,87,96,121,138,130,149,143,73,96,116,80,
-    137,159,101,126,129,108,121,141,135,108,135,139,101,143,137,74,
-    119,120,96,146,156,130,117,114,103,93,152,157,116,154,114,68,
-    122,120,109,144,133,105,96,125,120,104,160,121,96,156,127,112,
-    143,108,92,119,124,127,135,148,103,82,134,105,123,189,131,107,
-    124,84,90,130,141,122,122,128,76,91,149,108,131,170,105,111,
-    134,108,109,122,123,94,120,149,96,118,137,68,106,144,124,155,
-    156,115,89,106,116,106,159,171,88,121,118,66,123,150,124,142,
-    137,114,110,127,130,91,133,127,100,156,138,100,123,99,80,145,
-    166,122,140,140,76,87,153,108,130,178,110,83,104,118,124,155,
-    130,94,108,137,114,137,158,87,88,112,69,112,183,167,142,120,
-    87,57,100,167,147,161,165,92,101,88,74,129,144,146,145,121,
-    115,105,111,133,122,144,153,128,132,103,70,103,122,128,152,143,
-    116,90,93,98,97,149,156,115,129,105,84,123,136,137,138,130,
-    115,94,127,130,98,133,118,80,126,121,112,134,127,111,101,137,
-    131,124,152,122,98,134,119,108,151,127,98,125,118,115,133,153,
-    124,89,130,90,107,161,126,121,134,109,98,132,147,139,144,136,
-    88,97,126,118,126,145,98,99,109,118,126,126,152,96,91,136,
-    107,146,208,108,112,113,93,153,135,149,108,66,115,98,115,151,
-    85,112,111,79,164,150,136,158,97,111,111,129,195,104,137,115,
-    34,140,116,119,151,102,81,91,93,149,132,141,160,77,159,146,
-    138,214,138,95,107,63,104,122,111,134,54,89,104,83,181,139,
-    121,152,78,128,159,132,176,104,83,80,52,162,136,120,167,67,
-    82,135,103,172,148,111,124,73,143,132,118,170,71,76,127,83,
-    166,161,99,137,89,118,147,133,187,113,91,136,73,151,177,94,
-    152,88,74,136,124,193,153,117,125,54,116,154,96,164,107,55,
-    116,97,150,153,109,126,74,109,153,110,182,146,72,134,86,104,
-    159,106,130,81,83,125,99,177,154,81,155,107,91,184,138,140,
-    125,72,91,104,159,116,76,131,63,126,168,103,158,143,123,133,
-    108,154,116,91,162,72,80,136,89,146,135,88,113,91,130,132,
-    121,186,95,125,159,73,160,138,98,136,93,106,123,105,152,120,
-    105,137,74,141,159,110,192,131,104,145,94,143,123,92,127,83,
-    130,145,90,157,115,67,148,104,134,163,106,144,94,104,135,83,
-    156,129,79,148,88,111,161,91,141,124,97,138,93,149,141,83,
-    149,101,104,169,99,135,144,80,134,105,127,145,96,150,104,92,
-    162,94,130,162,78,132,116,107,155,110,147,126,92,153,97,120,
-    162,69,126,131,89,162,114,118,131,83,134,106,128,178,89,139,
-    140,70,155,121,112,148,82,115,102,105,165,99,134,143,66,148,
-    123,108,180,108,119,125,89,143,99,119,143,63,133,118,88,178,
-    113,115,149,96,141,125,124,154,82,129,117,71,165,104,97,150,
-    82,120,131,115,167,118,131,134,89,160,117,102,158,77,104,129,
-    89,143,121,110,123,83,139,120,106,187,108,118,146,79,137,131,
-    103,146,110,123,122,87,151,106,105,156,97,148,131,98,152,118,
-    116,132,101,140,116,119,167,67,121,125,56,119,133,143,179,142,
-    125,90,35,98,88,147,186,148,177,102,38,78,80,134,205,182,
-    183,108,66,76,50,141,172,154,197,115,63,90,59,119,158,148,
-    167,121,117,103,60,122,120,135,194,132,122,107,53,87,102,134,
-    165,132,142,98,62,113,89,140,190,123,150,136,98,132,110,138,
-    139,107,150,96,95,131,66,114,138,107,149,129,117,129,93,124,
-    116,140,184,120,143,126,67,112,117,122,167,140,143,117,88,122,
-    83,118,155,96,139,119,79,138,105,118,142,118,154,112,108,130,
-    62,123,132,82,179,116,95,135,78,110,131,128,185,140,130,164,
-    65,135,107,100,157,118,116,123,119,84,74,117,95,113,218,92,
-    94,114,90,176,142,184,175,76,121,113,83,150,89,127,163,79,
-    132,91,84,120,70,162,143,117,233,90,110,132,39,170,126,133,
-    177,60,80,73,51,148,111,147,169,69,154,142,124,227,137,139,
-    140,53,124,75,84,146,59,129,134,62,169,97,84,174,80,174,
-    163,122,203,52,80,91,31,191,142,127,198,52,97,119,67,210,
-    133,138,173,45,156,96,71,201,68,122,165,64,172,105,78,159,
-    78,169,169,107,206,83,69,165,52,175,168,80,183,60,95,141,
-    75,211,142,100,170,26,101,139,55,186,115,78,148,56,146,130,
-    76,182,88,145,194,84,181,131,54,159,81,124,175,76,155,63,
-    49,144,56,183,182,79,186,93,87,187,96,185,138,79,161,34,
-    107,140,46,155,105,86,197,127,143,132,88,140,145,189,151,62,
-    107,71,61,150,104,126,133,93,118,92,112,156,143,175,146,96,
-    135,79,102,129,97,121,119,132,113,107,111,105,109,152,139,140,
-    151,90,103,107,109,143,155,148,139,125,126,108,118,142,112,135,
-    124,91,115,106,105,128,119,132,123,130,144,101,125,114,97,133,
-    122,114,114,86,88,94,114,143,138,159,137,107,122,107,120,147,
-    133,130,115,106,107,101,115,114,121,133,126,136,143,126,131,131,
-    115,140,138,132,125,101,94,82,113,135,128,147,134,103,109,117,
-    125,141,152,132,114,107,112,101,121,133,115,124,117,106,120,124,
-    119,127,130,137,128,139,126,98,101,94,109,140,117,121,132,88,
-    98,116,96,148,147,147,167,101,95,102,100,106,108,163,174,147,
-    146,82,72,53,89,156,179,184,180,127,53,53,61,141,195,226,
-    181,108,66,33,51,113,169,160,172,135,61,46,83,112,145,189,
-    170,135,134,106,72,105,111,126,172,155,130,94,75,63,86,141,
-    153,150,145,102,70,96,100,128,161,151,135,113,113,109,115,144,
-    127,137,152,111,120,123,100,112,126,132,126,135,132,98,93,110,
-    102,125,149,127,129,121,107,114,128,149,139,143,142,100,110,115,
-    95,114,122,101,105,107,104,109,121,134,131,149,155,124,131,124,
-    83,106,122,113,129,124,106,85,89,111,117,161,175,151,153,127,
-    106,126,133,127,136,125,103,96,100,106,93,126,120,111,144,127,
-    118,133,125,121,146,152,141,128,128,94,84,114,112,119,139,112,
-    87,95,87,105,133,154,143,126,131,91,113,141,121,139,150,126,
-    115,127,98,126,130,120,120,134,121,101,115,104,130,126,118,131,
-    122,111,160,90,95,119,123,199,131,119,105,47,80,134,143,152,
-    114,121,111,72,153,119,120,166,101,114,142,99,154,116,116,135,
-    57,168,126,105,162,83,79,127,102,148,149,109,133,67,133,150,
-    153,234,136,99,129,41,100,147,108,166,103,88,107,72,144,113,
-    99,172,89,128,169,82,143,98,69,115,88,169,141,102,157,67,
-    92,163,104,195,167,83,134,70,111,148,123,169,92,85,128,67,
-    157,159,95,178,115,110,157,107,149,118,94,143,81,135,142,57,
-    135,91,82,173,132,171,164,87,116,73,108,167,109,164,102,40,
-    117,74,124,176,103,143,114,91,152,108,163,152,91,154,94,98,
-    155,74,113,114,69,147,126,145,156,82,139,113,116,207,132,145,
-    140,48,107,106,118,165,98,121,97,77,152,110,151,192,92,138,
-    129,84,165,112,96,112,83,125,141,127,127,65,93,131,106,189,
-    157,114,127,82,97,121,135,174,119,98,111,53,123,137,112,158,
-    119,95,130,119,136,137,111,134,96,139,151,100,140,88,78,129,
-    115,150,159,116,126,97,112,151,129,173,129,79,110,75,115,161,
-    124,141,113,91,111,100,152,144,116,151,104,109,147,94,113,108,
-    79,130,123,145,150,94,117,88,93,165,131,149,152,64,98,96,
-    114,168,128,138,110,76,119,99,131,174,102,135,127,91,150,113,
-    116,126,95,136,126,139,163,87,109,117,84,171,154,136,154,78,
-    82,98,118,170,136,138,123,60,117,117,112,181,127,120,131,98,
-    136,117,125,137,89,135,136,107,153,97,85,127,93,143,160,131,
-    137,83,97,112,110,185,144,114,137,72,88,132,117,156,128,112,
-    113,85,133,123,114,157,97,110,143,99,132,121,92,116,103,137,
-    140,112,149,81,95,136,109,166,170,92,116,99,90,131,129,168,
-    118,99,123,87,142,155,101,141,120,70,143,142,134,166,113,96,
-    80,143,134,114,164,143,83,134,113,78,140,106,115,119,142,132,
-    117,135,82,55,142,140,166,189,93,77,54,64,122,170,195,149,
-    102,88,36,83,173,143,187,160,86,95,97,105,122,130,146,128,
-    116,149,88,108,134,97,132,136,127,135,110,107,89,89,130,122,
-    149,150,92,127,109,107,167,142,146,136,110,122,107,129,151,104,
-    128,125,94,131,124,108,124,105,116,119,131,152,110,131,112,72,
-    133,132,119,160,108,113,118,97,141,123,131,130,84,110,93,105,
-    155,114,139,138,94,128,118,117,142,96,141,147,84,135,104,77,
-    183,154,94,130,108,167,161,122,147,63,95,152,121,141,90,69,
-    116,62,128,168,87,134,105,56,126,121,177,190,107,148,70,87,
-    176,97,153,155,57,111,100,113,153,85,128,95,96,213,153,192,
-    199,48,97,95,86,182,135,137,114,45,115,93,122,194,95,139,
-    127,62,181,142,131,172,75,97,87,107,186,85,133,147,41,154,
-    121,87,170,64,84,118,98,188,122,125,129,12,127,129,107,219,
-    106,94,128,62,143,135,142,177,65,123,125,72,200,109,88,164,
-    68,147,168,134,188,90,98,111,70,194,131,93,157,31,74,144,
-    108,200,133,96,133,62,162,160,129,210,84,86,144,63,154,139,
-    76,132,67,102,139,110,184,111,87,164,98,173,196,95,139,70,
-    61,126,111,165,112,58,119,64,117,177,121,193,134,80,140,121,
-    151,123,87,121,55,123,143,74,158,93,74,150,110,164,162,116,
-    151,85,98,135,112,190,127,65,122,56,97,150,107,167,112,99,
-    129,74,172,129,98,162,82,121,159,102,150,120,80,138,107,157,
-    156,106,174,88,102,166,85,158,143,59,115,92,119,163,115,166,
-    106,71,150,75,153,182,78,153,103,83,146,86,136,120,71,153,
-    90,132,179,64,143,117,77,172,109,142,148,68,128,87,116,190,
-    96,145,127,42,143,101,124,183,84,136,107,81,165,91,144,164,
-    59,150,112,100,185,88,126,140,81,161,113,130,170,60,133,122,
-    90,194,107,115,148,55,137,125,116,192,88,125,130,63,170,109,
-    115,173,55,123,123,79,177,93,104,146,68,158,130,111,184,72,
-    113,145,80,184,131,94,151,51,121,133,96,193,92,103,140,62,
-    158,142,107,182,78,98,136,74,169,117,96,149,67,131,137,88,
-    179,91,93,163,81,150,152,93,151,72,114,159,90,179,111,89,
-    153,62,123,152,86,178,105,101,179,73,140,146,89,196,114,92,
-    158,53,122,107,63,202,138,155,141,39,108,63,106,199,132,185,
-    157,40,95,37,102,185,132,212,130,51,126,53,103,177,111,178,
-    130,99,124,58,135,153,93,180,113,115,174,53,120,115,87,183,
-    134,153,140,37,118,83,96,199,106,147,128,42,114,78,112,175,
-    106,160,134,99,169,100,125,166,82,162,146,112,161,62,102,101,
-    80,169,121,121,147,48,104,122,107,211,147,136,126,45,117,117,
-    120,190,107,119,121,67,149,113,130,165,79,125,102,95,176,105,
-    111,144,78,150,122,115,194,70,75,134,80,140,153,101,155,97,
-    75,101,138,178,161,182,92,78,144,122,145,157,114,108,77,94,
-    133,76,116,126,85,130,124,128,109,102,129,78,137,188,130,174,
-    122,72,127,94,159,177,117,136,65,60,122,102,135,148,99,127,
-    104,130,180,137,175,140,121,156,98,112,126,76,106,87,89,159,
-    112,119,132,78,119,126,163,197,130,139,87,43,110,108,143,160,
-    102,122,78,71,134,116,145,129,97,134,96,114,150,90,115,106,
-    88,153,129,129,119,71,119,109,138,190,124,124,110,64,130,139,
-    147,177,116,121,94,88,165,131,161,169,90,127,100,103,153,114,
-    127,114,94,149,114,127,138,77,146,124,122,190,134,112,118,71,
-    137,151,113,141,81,73,108,101,110,119,111,153,131,119,141,103,
-    137,149,140,124,92,113,125,79,109,101,68,124,103,124,141,122,
-    137,136,123,154,124,125,145,72,120,98,92,134,101,123,114,100,
-    126,120,135,178,148,173,150,99,136,89,105,131,95,129,111,94,
-    114,82,106,128,113,174,146,127,157,96,126,136,102,148,110,108,
-    139,78,129,126,106,154,95,120,141,82,140,122,98,156,95,123,
-    130,86,145,98,110,154,97,151,138,92,144,99,114,152,104,147,
-    125,100,144,78,117,138,103,168,126,112,152,93,117,121,101,152,
-    103,114,133,84,133,115,99,158,123,130,140,101,137,114,118,150,
-    106,141,129,84,133,96,93,139,106,135,132,110,140,112,133,147,
-    120,161,131,103,137,94,104,126,87,122,113,108,122,99,135,129,
-    111,167,130,124,156,90,113,122,98,119,115,111,132,99,114,99,
-    106,150,134,164,138,108,112,117,124,135,121,127,112,101,127,84,
-    107,137,108,133,137,123,130,111,122,116,120,145,126,150,138,96,
-    100,103,102,130,129,123,118,94,106,96,124,153,133,150,144,121,
-    133,115,117,128,107,116,109,115,126,102,122,111,101,143,126,135,
-    148,112,116,109,114,137,120,129,113,87,107,96,123,153,132,142,
-    124,104,117,115,134,137,122,125,109,109,127,107,116,123,105,129,
-    128,127,140,121,119,115,120,140,123,127,127,93,105,111,115,147,
-    136,128,121,109,123,117,132,144,117,124,119,103,130,124,112,124,
-    109,117,119,123,139,118,121,123,112,139,133,113,128,103,96,113,
-    116,133,129,124,117,96,121,125,117,153,133,112,126,108,119,129,
-    120,124,111,123,120,107,142,124,109,137,119,129,145,125,125,113,
-    111,113,112,143,127,106,123,96,104,135,122,136,135,115,110,108,
-    127,126,120,135,109,104,126,104,119,133,109,120,120,127,131,120,
-    128,108,106,130,115,132,146,109,113,113,107,132,132,142,133,115,
-    119,101,117,141,115,132,126,101,125,115,118,126,120,122,118,127,
-    139,113,123,119,99,128,126,128,133,117,101,103,112,126,127,139,
-    131,105,121,110,113,144,133,122,127,111,109,114,121,123,115,129,
-    119,120,136,118,109,122,112,115,135,131,128,117,109,100,110,140,
-    135,135,142,110,101,116,113,126,134,124,113,112,117,109,121,137,
-    121,125,133,118,124,131,115,114,120,121,119,128,131,106,108,118,
-    110,133,147,127,125,120,103,110,128,134,128,129,123,103,115,126,
-    114,132,136,116,120,125,117,116,124,118,110,126,128,113,126,121,
-    99,118,128,127,140,139,121,108,115,112,116,138,134,113,118,110,
-    99,122,126,123,128,125,115,113,129,123,120,133,126,120,131,121,
-    111,117,110,110,120,129,128,123,122,107,107,123,125,133,140,123,
-    111,113,109,118,130,132,125,119,116,108,116,124,121,127,130,121,
-    122,123,116,116,120,120,123,131,131,118,118,114,106,120,131,128,
-    129,125,107,105,116,121,125,136,130,112,114,114,111,127,133,124,
-    127,129,116,114,123,116,114,127,125,117,127,121,105,116,121,117,
-    131,139,126,118,119,110,113,135,130,124,133,117,101,117,120,117,
-    132,133,117,116,123,111,112,133,120,115,133,120,113,125,118,109,
-    124,133,122,127,135,111,106,125,112,119,142,128,117,123,111,104,
-    123,136,125,129,136,107,110,126,112,120,135,120,114,124,118,109,
-    121,128,115,128,139,116,119,126,104,111,128,124,126,132,124,106,
-    114,121,113,132,141,120,123,123,105,116,126,125,126,130,124,110,
-    120,122,111,129,131,117,129,122,109,113,113,113,120,130,129,119,
-    124,113,104,124,123,124,137,123,113,115,111,115,123,133,128,119,
-    124,109,109,126,119,126,135,125,123,123,119,116,118,127,123,127,
-    134,115,115,118,107,119,129,127,128,124,116,107,116,128,122,134,
-    135,114,117,115,109,123,130,128,126,126,120,107,118,121,114,132,
-    133,120,127,122,109,113,123,122,124,135,124,108,117,110,107,130,
-    132,123,130,123,107,110,121,117,123,138,124,114,124,110,105,126,
-    125,120,131,127,111,114,121,110,120,139,127,123,133,113,104,121,
-    118,118,137,136,116,117,119,102,115,135,125,128,138,114,107,122,
-    116,116,134,133,118,122,121,104,112,127,116,125,138,119,115,122,
-    111,110,127,130,125,132,129,106,112,122,112,128,139,123,121,122,
-    109,110,124,128,122,132,129,107,116,118,108,125,133,123,129,126,
-    112,109,118,120,119,136,132,115,123,113,101,123,128,124,134,129,
-    114,110,115,115,119,138,131,119,130,113,104,122,120,121,134,131,
-    119,116,118,107,111,132,124,125,137,114,107,118,111,116,133,134,
-    124,121,121,103,110,130,120,129,141,118,112,118,108,112,129,133,
-    125,128,127,104,112,126,113,129,143,124,123,123,109,107,122,130,
-    123,136,135,106,114,118,103,126,139,126,128,127,110,102,119,124,
-    118,139,136,109,120,115,100,121,131,124,128,131,116,103,118,115,
-    111,138,133,117,129,116,99,115,123,121,130,137,120,108,118,107,
-    107,136,130,123,135,118,105,115,120,118,132,143,125,118,125,106,
-    106,130,124,128,141,125,113,115,113,109,126,139,127,129,129,104,
-    106,121,115,127,141,128,117,116,108,102,120,132,125,134,131,107,
-    111,117,109,124,137,130,126,126,113,103,118,123,120,138,136,114,
-    119,114,101,118,132,128,131,136,117,103,118,116,114,140,136,118,
-    125,116,99,113,125,120,128,138,119,107,121,108,106,136,131,122,
-    136,122,102,112,119,113,128,143,122,115,125,101,101,131,125,125,
-    142,127,107,115,118,107,126,144,122,124,133,103,104,127,118,123,
-    143,131,112,119,116,98,120,137,119,131,138,105,107,121,109,118,
-    141,134,118,126,117,95,115,129,116,137,141,110,111,118,104,112,
-    136,134,123,134,122,98,118,124,114,137,142,120,121,120,104,108,
-    128,127,124,142,127,105,119,114,106,132,137,126,129,122,103,103,
-    121,120,125,144,128,113,120,107,104,126,129,127,134,127,111,108,
-    114,110,122,139,127,125,127,106,104,119,121,129,139,134,119,115,
-    112,103,119,134,128,134,130,111,110,113,112,125,138,134,125,123,
-    114,102,115,123,122,137,134,117,115,112,105,114,130,131,129,131,
-    117,101,113,115,115,137,138,124,121,115,103,109,126,126,128,140,
-    124,107,117,113,109,133,137,127,130,123,104,104,122,118,124,144,
-    128,114,123,109,102,126,131,124,134,131,107,105,118,108,120,144,
-    127,121,129,108,100,121,125,121,137,137,111,112,118,100,115,140,
-    125,128,137,113,104,119,119,116,139,141,118,122,121,97,112,132,
-    121,132,141,118,108,116,111,109,135,139,122,131,124,98,111,122,
-    114,130,141,124,114,119,108,103,128,132,123,140,128,103,113,115,
-    108,127,139,128,123,125,108,101,124,123,123,143,131,112,118,111,
-    103,122,134,126,130,132,109,103,119,111,117,143,131,121,128,111,
-    99,116,126,121,135,139,113,110,118,101,113,139,129,128,136,115,
-    101,116,118,114,137,141,118,121,122,98,111,133,122,130,142,122,
-    108,118,112,106,134,140,122,133,127,98,108,123,114,129,145,126,
-    113,122,108,99,129,134,121,139,131,102,111,119,107,124,144,128,
-    120,129,109,96,123,124,119,142,137,111,117,117,99,117,139,128,
-    128,137,112,99,119,115,114,142,138,117,123,118,98,112,131,122,
-    131,142,117,107,121,110,111,138,135,125,132,122,101,110,122,114,
-    129,142,121,116,120,103,106,129,129,128,138,126,107,113,116,109,
-    129,138,123,125,121,102,105,119,119,126,137,128,114,117,112,105,
-    126,132,126,135,128,110,110,114,112,123,135,129,122,122,108,102,
-    120,124,125,140,132,117,117,113,107,120,134,127,127,130,111,104,
-    118,115,120,140,133,122,123,116,103,114,129,124,132,139,116,109,
-    118,107,112,137,133,124,130,120,100,112,124,114,132,144,119,116,
-    122,103,105,130,127,123,138,126,102,114,118,105,130,144,123,126,
-    129,103,103,127,122,122,144,131,106,119,115,98,126,139,122,133,
-    137,108,105,124,114,117,144,134,115,128,116,94,119,131,120,137,
-    143,114,109,121,104,110,141,132,120,136,118,96,117,122,114,136,
-    142,118,117,123,101,105,132,125,124,142,123,104,118,114,105,131,
-    140,123,127,127,100,103,124,116,125,145,125,111,121,109,102,128,
-    134,123,135,131,104,109,120,107,122,141,126,122,129,109,101,122,
-    122,120,141,136,113,118,117,101,121,139,126,132,135,111,104,119,
-    114,116,141,134,117,126,117,99,119,129,119,134,139,116,112,120,
-    106,109,135,128,120,134,119,99,115,120,113,133,141,119,118,123,
-    102,107,133,125,122,139,123,104,119,117,107,131,139,119,124,130,
-    103,105,127,115,120,143,126,110,124,114,100,125,136,120,131,135,
-    105,108,125,110,119,143,127,114,127,114,99,123,129,115,133,136,
-    109,115,125,106,116,139,125,123,136,118,103,123,122,113,137,138,
-    115,121,122,100,113,133,121,126,139,118,106,123,116,111,137,135,
-    118,129,124,102,114,126,115,125,138,120,113,124,108,105,131,128,
-    121,137,127,106,116,119,110,128,141,123,122,127,107,106,127,122,
-    121,138,127,110,120,117,105,124,135,122,129,134,110,109,124,112,
-    118,141,129,117,127,115,99,119,127,116,133,137,110,112,123,106,
-    115,139,127,121,135,118,101,122,122,109,134,139,114,121,126,101,
-    111,134,120,122,142,120,102,123,115,103,135,138,115,129,129,99,
-    110,130,112,121,144,120,107,128,112,99,132,133,114,136,134,103,
-    114,127,105,119,144,121,115,135,111,98,129,126,113,139,136,106,
-    118,126,101,118,141,119,119,138,113,101,127,118,109,137,133,109,
-    125,126,99,116,135,116,124,142,116,109,128,113,107,136,132,115,
-    132,126,102,118,129,110,125,141,117,115,130,111,107,133,125,117,
-    137,127,106,122,123,106,126,136,117,123,130,106,108,128,116,118,
-    139,126,112,126,118,106,128,132,117,130,131,108,114,125,111,119,
-    137,122,117,130,116,106,126,124,115,133,131,111,119,123,106,119,
-    135,121,122,133,114,106,125,119,114,135,131,112,123,122,103,118,
-    132,116,123,137,115,110,127,114,110,136,130,115,131,125,103,117,
-    129,112,126,141,117,114,129,110,107,133,126,115,134,126,102,119,
-    125,107,126,141,118,121,134,109,106,131,120,113,138,128,105,123,
-    121,100,123,137,116,126,137,109,107,129,114,113,141,128,110,129,
-    120,99,123,131,112,128,138,110,113,128,108,111,138,125,117,136,
-    122,103,124,125,111,132,139,114,119,127,104,110,133,120,118,138,
-    121,107,125,119,108,131,134,115,126,129,106,113,129,114,120,139,
-    122,114,129,116,105,128,128,115,132,131,107,117,126,108,120,139,
-    120,118,133,114,105,129,122,112,135,131,108,123,126,103,119,135,
-    114,121,138,113,108,132,117,110,138,130,110,130,126,100,121,132,
-    109,124,140,112,113,135,112,108,139,125,109,136,126,100,125,130,
-    104,126,140,109,117,137,108,107,137,118,107,138,124,101,129,127,
-    101,127,138,108,121,139,107,110,138,114,108,140,123,104,132,126,
-    100,128,134,106,123,139,108,114,138,112,111,140,121,107,134,124,
-    102,128,130,105,125,136,108,117,136,110,113,138,119,111,136,123,
-    106,130,127,106,127,131,107,120,131,108,115,134,115,115,135,119,
-    110,131,123,109,130,128,111,126,129,110,120,131,114,120,133,117,
-    116,130,118,113,130,123,115,129,124,112,124,125,112,124,129,115,
-    121,128,114,116,129,118,117,131,122,114,126,121,111,125,126,114,
-    124,127,112,118,127,114,119,132,120,116,129,119,110,126,124,113,
-    127,129,112,120,127,110,117,132,118,117,134,120,110,128,123,110,
-    130,131,112,124,130,107,115,132,114,117,137,118,109,130,119,104,
-    130,129,109,128,133,107,119,133,110,117,139,118,112,135,118,104,
-    131,125,108,133,134,107,123,133,105,116,138,115,115,139,117,105,
-    132,121,105,134,133,108,126,132,103,117,134,110,116,139,116,109,
-    133,117,105,132,128,109,131,131,104,119,131,107,117,138,115,113,
-    135,115,106,131,123,109,132,131,107,124,130,106,120,135,114,118,
-    137,115,111,133,119,110,134,128,110,130,129,105,123,132,110,121,
-    136,112,113,133,113,109,134,122,110,133,125,104,126,127,105,124,
-    134,109,119,135,110,112,136,117,112,139,123,106,132,125,104,129,
-    134,108,126,137,108,117,138,113,113,140,119,108,135,121,102,131,
-    129,104,127,134,104,118,136,107,115,140,115,110,138,118,103,133,
-    126,105,132,135,104,123,136,105,117,141,115,113,141,118,105,134,
-    123,105,134,133,104,125,133,103,117,137,111,115,140,115,107,134,
-    119,105,134,130,106,128,131,103,119,134,109,119,140,116,112,134,
-    116,106,132,125,109,132,129,105,122,128,107,121,137,115,117,133,
-    113,108,130,119,112,134,126,109,125,122,106,122,131,115,124,133,
-    113,115,127,114,115,133,124,116,129,118,107,122,123,114,128,132,
-    115,121,125,110,117,130,121,122,132,119,112,123,118,113,129,129,
-    118,127,125,109,118,126,116,123,135,121,117,127,114,110,129,127,
-    117,132,128,108,119,124,110,122,137,119,119,132,113,107,128,121,
-    112,134,129,108,123,125,104,119,136,116,122,138,113,107,129,115,
-    107,136,129,109,129,126,100,120,134,111,124,142,113,111,133,113,
-    105,137,127,109,135,128,101,122,131,105,123,142,113,115,136,109,
-    104,135,122,110,140,130,103,126,129,102,124,141,112,120,138,108,
-    107,134,117,109,140,128,106,129,126,101,124,136,110,124,139,109,
-    110,132,112,109,139,125,109,133,124,101,124,131,109,127,138,109,
-    115,131,109,111,138,121,113,136,121,103,126,124,106,129,134,109,
-    121,131,105,113,135,116,117,140,119,106,129,118,104,132,132,111,
-    129,129,103,117,132,111,121,141,116,112,132,113,105,134,127,111,
-    135,130,103,121,128,105,123,141,115,118,136,109,104,132,120,112,
-    141,130,106,126,124,100,124,139,112,124,138,107,106,132,114,110,
-    142,129,109,132,124,97,122,133,109,128,142,109,111,131,108,107,
-    141,127,113,139,124,97,122,128,105,130,144,111,117,132,103,106,
-    137,121,115,143,125,102,125,122,101,129,140,113,126,135,104,107,
-    132,114,116,145,126,109,129,116,99,127,134,114,133,137,106,112,
-    127,107,115,142,123,116,134,115,100,125,123,111,135,135,110,120,
-    124,102,115,136,120,124,139,115,106,124,115,111,136,133,116,129,
-    123,102,117,129,114,127,139,117,113,125,110,108,133,127,118,134,
-    124,105,119,123,109,127,138,118,121,129,108,108,131,121,118,140,
-    126,107,123,120,104,127,137,116,126,134,107,109,130,114,115,143,
-    126,109,129,118,99,125,132,111,130,138,106,112,130,108,113,144,
-    124,112,136,118,97,126,128,107,133,140,106,117,132,103,112,143,
-    120,116,143,119,99,129,123,103,136,140,107,123,132,98,110,139,
-    115,118,146,118,102,130,118,100,136,138,110,131,134,99,113,135,
-    110,119,147,119,108,132,113,97,132,131,110,135,134,100,114,129,
-    103,118,145,119,114,135,110,98,130,124,111,140,135,106,120,125,
-    99,118,140,117,123,139,111,103,128,115,110,141,133,112,129,123,
-    98,119,134,114,130,143,113,111,128,108,109,141,129,118,138,122,
-    99,120,124,108,133,142,115,120,129,102,108,135,120,120,144,122,
-    104,123,116,101,131,137,115,129,131,100,109,130,112,121,147,123,
-    112,129,112,98,129,131,114,137,135,103,114,126,104,118,145,123,
-    118,136,112,98,126,123,110,139,137,107,120,125,98,115,141,119,
-    123,143,114,101,127,117,106,140,137,111,128,127,96,114,136,114,
-    125,147,117,107,129,110,102,137,132,113,135,128,97,115,128,106,
-    125,146,117,115,132,107,101,133,125,114,140,129,102,120,123,101,
-    125,142,117,123,135,107,105,130,117,115,143,129,109,126,119,100,
-    124,135,116,130,137,108,110,127,110,116,142,127,117,131,116,101,
-    123,126,113,134,136,111,116,124,104,114,137,122,121,135,116,103,
-    122,118,109,135,135,114,124,124,101,113,132,117,124,141,117,107,
-    125,113,106,136,134,115,132,128,100,115,130,111,126,146,119,114,
-    131,110,102,136,129,115,140,130,100,117,125,101,124,146,117,119,
-    136,106,99,132,120,112,145,132,103,123,122,95,122,143,114,126,
-    142,106,102,131,113,109,147,133,108,132,123,92,121,136,110,131,
-    148,109,107,131,105,105,145,130,113,140,123,92,120,128,104,132,
-    148,111,115,131,100,102,138,123,115,145,126,98,122,121,99,130,
-    144,114,125,135,100,103,132,115,116,148,128,106,127,117,97,128,
-    138,116,134,138,104,109,128,107,117,146,126,116,134,114,97,126,
-    127,113,139,139,109,118,124,101,116,141,122,124,140,114,102,124,
-    116,110,139,135,113,127,122,98,116,132,115,128,142,114,109,125,
-    108,106,136,128,116,134,122,98,116,123,108,129,141,115,117,128,
-    104,106,134,123,119,141,125,103,121,120,103,128,140,116,125,133,
-    104,107,131,116,117,145,127,108,127,118,99,127,136,114,131,136,
-    104,108,129,109,115,144,126,113,133,117,97,126,130,111,134,139,
-    107,115,128,103,113,142,123,117,139,117,99,126,123,108,137,140,
-    111,122,129,101,113,139,119,122,143,118,103,127,116,104,137,136,
-    113,129,129,99,113,131,112,124,144,118,110,128,109,102,133,130,
-    116,136,129,101,115,124,106,125,143,120,119,131,108,103,129,123,
-    117,140,130,107,120,119,102,123,139,120,127,136,109,106,126,114,
-    115,141,130,112,127,117,98,121,132,116,132,140,110,111,126,107,
-    111,141,127,117,135,119,97,121,125,109,135,143,112,119,129,101,
-    108,138,122,120,145,121,100,125,118,101,135,141,112,127,132,97,
-    108,134,112,120,149,121,105,131,113,96,134,135,111,136,137,98,
-    112,131,103,117,149,121,112,138,112,95,132,128,109,141,140,102,
-    118,129,97,116,146,118,118,143,112,97,131,120,105,142,139,106,
-    126,129,94,114,139,113,121,146,113,102,130,113,102,139,135,110,
-    133,129,96,116,133,109,124,146,116,110,132,109,102,136,128,113,
-    138,129,100,119,126,104,125,143,117,120,134,107,105,133,121,115,
-    142,129,106,124,121,102,126,137,116,128,135,107,110,129,113,117,
-    142,125,113,129,116,101,125,128,114,133,134,108,115,124,106,117,
-    138,122,120,134,114,103,125,121,113,136,134,112,122,123,102,117,
-    134,118,124,138,115,107,126,115,110,137,133,115,130,125,100,117,
-    130,113,127,142,116,111,128,109,106,135,129,116,136,127,100,118,
-    125,106,126,142,116,117,132,107,104,133,123,115,141,129,103,122,
-    122,100,124,140,116,124,136,106,105,130,115,113,143,129,108,128,
-    120,96,123,134,113,130,141,108,110,130,109,112,143,128,115,135,
-    120,98,123,127,109,133,142,112,117,128,103,110,137,122,119,140,
-    120,101,123,120,106,133,139,115,126,130,103,111,132,117,120,142,
-    122,108,126,115,103,130,133,116,131,132,105,113,127,110,120,141,
-    122,115,131,113,103,128,126,115,136,133,107,119,125,104,120,139,
-    119,121,136,112,104,128,118,111,138,132,109,126,124,99,119,134,
-    113,125,140,110,108,129,111,107,139,127,110,133,124,98,122,130,
-    107,128,142,111,114,133,107,107,139,123,112,140,125,99,125,126,
-    102,129,141,110,120,136,104,107,138,118,113,144,125,102,129,123,
-    99,130,139,110,126,137,103,110,135,113,113,145,124,107,132,120,
-    98,128,134,110,130,138,105,113,133,108,113,142,123,111,135,119,
-    99,127,128,109,132,138,108,117,130,106,114,139,121,117,138,118,
-    103,126,121,108,133,135,112,124,128,104,114,133,117,121,138,118,
-    109,126,115,108,131,130,116,129,126,106,117,125,113,125,136,119,
-    118,126,111,110,128,123,120,134,125,110,120,119,110,125,132,119,
-    125,127,110,113,125,117,121,135,124,116,125,116,108,125,126,118,
-    129,129,112,116,123,111,119,135,123,120,130,116,107,124,122,114,
-    132,131,113,121,124,106,117,133,119,121,135,117,107,125,118,110,
-    133,132,113,126,127,104,116,131,114,121,139,117,110,129,115,106,
-    133,130,113,131,130,103,118,130,109,121,140,118,114,133,113,104,
-    132,125,111,135,131,105,122,129,105,121,139,116,118,137,112,105,
-    131,120,109,136,130,107,126,127,103,121,136,113,122,138,113,109,
-    131,116,109,136,128,110,130,126,103,121,131,111,124,137,113,113,
-    131,112,110,134,124,113,133,125,105,123,127,109,126,136,114,118,
-    131,111,111,133,120,114,135,123,107,126,123,106,127,133,112,123,
-    132,108,114,132,115,116,138,121,110,130,120,105,129,129,111,129,
-    132,107,118,131,109,118,138,117,114,135,116,105,131,124,109,134,
-    131,106,123,130,104,119,137,113,117,138,114,107,133,119,107,136,
-    130,108,129,130,103,121,135,110,120,139,112,109,134,114,105,135,
-    125,107,131,128,102,123,132,107,122,140,113,114,136,113,107,136,
-    123,109,135,128,104,125,130,105,123,137,112,118,135,112,109,134,
-    119,110,135,126,107,127,126,105,123,133,112,121,135,112,113,132,
-    116,112,134,123,111,129,124,107,125,129,112,125,133,113,118,131,
-    114,116,133,121,115,131,121,110,126,124,112,127,129,114,122,128,
-    113,119,129,117,120,131,119,115,126,119,114,128,125,116,126,124,
-    113,121,125,114,121,129,117,118,126,116,114,127,120,116,128,123,
-    113,123,123,112,123,128,115,121,128,114,115,128,117,116,130,123,
-    114,127,123,110,124,128,113,123,131,113,116,130,115,114,133,122,
-    113,131,124,108,126,128,110,125,133,112,119,133,112,114,134,119,
-    112,134,123,107,129,126,107,126,133,109,121,135,111,115,136,116,
-    112,136,121,108,132,125,105,128,131,107,124,135,109,117,135,112,
-    112,136,119,109,134,123,106,130,129,107,126,133,108,119,134,111,
-    114,135,116,111,134,121,108,131,126,107,127,131,108,122,133,111,
-    118,135,115,114,134,119,110,131,123,109,129,128,109,124,130,110,
-    120,133,113,116,133,116,112,132,120,110,131,124,109,127,127,108,
-    123,130,110,119,132,112,115,132,116,112,133,121,110,131,124,108,
-    127,128,109,124,131,110,119,133,112,115,134,116,112,134,121,109,
-    131,125,108,128,130,108,123,132,110,118,134,113,114,135,118,110,
-    133,123,108,130,128,108,127,132,109,122,134,111,116,136,116,112,
-    135,121,109,132,125,107,128,131,108,123,134,109,117,134,113,112,
-    135,119,110,133,123,107,129,128,108,126,133,109,120,133,111,114,
-    134,117,112,134,121,109,130,125,108,127,130,110,123,132,110,117,
-    131,114,114,133,119,112,130,121,109,127,126,111,126,130,112,121,
-    129,112,118,131,117,117,131,119,113,127,121,113,128,126,114,125,
-    126,112,121,127,116,121,130,118,117,127,118,115,127,123,117,127,
-    123,114,122,123,115,123,128,118,121,127,116,117,127,120,118,129,
-    122,115,124,121,113,123,126,116,123,128,115,117,127,117,117,131,
-    122,115,127,122,111,125,127,114,125,131,114,119,129,113,115,132,
-    120,115,132,122,109,127,125,110,127,131,111,120,130,109,114,133,
-    116,113,134,120,108,129,122,106,128,130,109,124,133,108,117,134,
-    113,115,138,119,110,133,121,105,130,128,108,127,133,107,118,134,
-    111,116,138,118,112,135,120,106,131,126,108,129,132,107,121,132,
-    109,117,136,116,114,135,118,107,131,124,109,131,130,109,123,130,
-    107,118,134,114,117,135,117,110,131,120,109,131,128,111,127,128,
-    108,121,132,113,121,135,116,114,131,116,110,131,124,113,130,125,
-    108,123,127,111,124,134,114,119,130,112,112,131,119,114,133,122,
-    109,126,122,108,126,130,113,123,130,109,115,129,115,117,135,121,
-    113,129,119,107,127,127,112,128,130,109,118,128,110,118,135,119,
-    116,132,117,107,127,123,111,131,131,111,123,128,108,118,134,118,
-    120,136,117,109,128,119,109,132,130,112,126,128,106,118,131,114,
-    121,138,118,113,130,117,108,132,128,113,131,129,107,120,129,110,
-    121,137,118,117,132,114,108,130,123,114,134,129,109,123,126,107,
-    122,134,116,121,133,112,109,128,117,112,134,126,111,126,122,105,
-    121,130,114,124,134,113,114,127,113,113,133,124,115,130,121,107,
-    122,124,112,126,132,114,118,126,110,114,130,120,118,132,121,110,
-    124,121,112,127,130,117,124,127,111,116,128,117,120,134,121,114,
-    126,118,110,127,127,116,127,127,110,117,126,113,120,134,120,116,
-    129,116,109,128,125,115,132,129,110,121,126,109,120,134,117,119,
-    133,114,109,129,120,112,134,128,109,125,125,104,120,133,114,122,
-    137,113,111,131,116,110,136,128,111,130,126,103,122,132,111,125,
-    138,113,114,132,112,109,137,125,112,134,125,103,123,128,108,126,
-    139,113,118,132,109,108,134,121,113,137,125,105,124,124,105,126,
-    137,114,122,133,109,110,131,117,114,138,126,110,127,122,104,125,
-    133,114,127,135,110,113,128,112,115,137,124,114,130,119,104,123,
-    126,112,129,134,112,117,126,108,115,134,121,119,134,119,107,123,
-    120,111,131,132,115,124,125,106,115,129,117,123,136,120,113,125,
-    115,111,131,128,118,130,126,108,118,124,113,125,135,120,119,127,
-    112,110,128,122,119,134,126,111,121,120,109,124,132,118,124,129,
-    111,111,125,116,117,135,126,114,125,119,106,123,129,117,127,133,
-    112,114,125,112,115,135,125,117,130,120,105,123,125,114,129,134,
-    114,119,127,109,114,134,122,118,134,121,107,124,122,110,130,134,
-    115,123,128,107,113,131,118,119,136,120,109,125,118,107,128,130,
-    115,127,129,107,115,128,113,120,137,121,114,128,116,107,128,127,
-    115,130,130,109,118,126,111,121,136,121,119,130,115,109,127,122,
-    116,133,129,113,121,123,108,120,131,119,123,131,115,111,124,118,
-    115,132,128,116,125,122,108,120,128,118,126,133,117,115,124,114,
-    114,132,126,119,130,122,108,120,124,114,127,134,117,118,125,109,
-    112,129,122,120,134,122,108,121,119,109,127,132,117,124,128,108,
-    112,128,116,120,137,123,112,125,116,105,127,129,116,130,131,108,
-    114,126,110,118,138,122,117,131,116,104,126,125,114,134,134,111,
-    120,126,107,118,137,121,121,136,116,105,125,120,111,134,134,113,
-    124,125,104,115,132,116,122,138,117,108,125,114,107,131,130,115,
-    128,127,104,115,127,113,122,138,120,114,127,114,107,129,127,117,
-    133,129,109,118,124,110,122,137,121,120,130,114,108,126,122,117,
-    133,129,113,121,121,107,120,131,120,124,131,115,111,123,117,117,
-    133,128,119,126,120,109,120,126,119,129,132,118,118,123,114,117,
-    131,126,123,129,120,111,120,120,117,129,130,120,122,121,111,116,
-    126,121,124,130,119,114,120,115,114,127,127,120,126,122,111,116,
-    122,117,124,131,120,118,122,113,112,126,125,121,130,124,111,118,
-    120,113,124,132,120,121,126,113,111,125,121,119,133,126,113,121,
-    120,109,122,132,119,124,130,113,111,125,117,117,135,127,115,125,
-    120,107,122,129,117,127,134,114,113,125,113,114,134,127,118,130,
-    121,105,120,125,114,128,135,116,117,125,109,112,131,123,119,134,
-    122,107,120,120,110,128,135,118,123,127,109,111,128,120,121,136,
-    125,112,122,118,108,125,132,120,128,130,111,113,124,116,120,136,
-    126,117,126,117,107,122,126,119,130,131,114,116,121,111,117,133,
-    124,122,129,117,109,121,121,116,131,131,117,121,122,109,117,129,
-    121,125,133,119,112,122,116,113,130,129,119,127,123,107,117,125,
-    116,126,135,119,116,124,112,111,129,125,120,132,125,109,119,121,
-    111,125,133,119,121,127,110,110,126,119,119,135,125,112,122,119,
-    108,124,131,118,126,131,112,113,126,116,118,135,126,115,126,119,
-    106,122,127,116,127,132,113,115,124,112,115,133,124,118,130,120,
-    107,122,124,114,128,132,115,119,125,110,114,131,122,120,132,121,
-    110,122,121,113,128,132,118,123,126,110,115,128,120,122,134,122,
-    114,123,118,112,127,129,119,127,126,111,116,123,116,122,132,122,
-    118,123,115,111,124,124,120,129,125,114,117,119,113,122,130,122,
-    123,125,114,113,121,120,121,130,126,118,121,117,112,121,126,123,
-    127,127,117,116,119,116,121,130,127,123,125,118,112,120,123,121,
-    129,129,119,119,120,113,117,128,125,124,129,120,112,119,119,116,
-    128,130,120,123,122,111,115,126,121,124,133,122,114,122,116,111,
-    127,130,120,128,126,110,115,124,115,121,135,122,116,125,114,107,
-    124,125,117,130,129,111,116,123,110,119,134,122,120,130,115,108,
-    124,121,115,132,131,114,121,123,107,117,131,120,122,134,117,110,
-    124,117,112,131,130,116,125,124,107,116,127,117,123,135,120,114,
-    125,115,110,128,127,118,128,126,109,117,124,114,122,134,121,118,
-    126,115,110,126,124,119,130,127,113,120,122,112,122,132,121,122,
-    127,115,112,124,120,118,131,126,116,123,120,111,121,128,120,125,
-    129,116,115,123,116,118,130,125,119,126,119,111,122,124,118,128,
-    129,117,119,122,113,118,129,122,121,128,118,113,122,120,117,128,
-    128,118,123,122,111,118,127,120,124,131,120,115,123,117,115,129,
-    128,120,127,124,112,119,124,117,124,132,120,118,124,115,112,126,
-    124,119,129,124,111,118,121,113,123,131,120,120,126,113,111,125,
-    121,118,131,126,113,121,120,110,121,130,119,123,129,114,112,123,
-    116,116,131,126,116,124,120,108,120,127,118,126,132,116,115,124,
-    114,115,130,125,119,129,122,110,120,123,116,127,132,119,120,125,
-    113,115,128,123,122,131,123,113,121,119,113,125,129,119,123,124,
-    112,114,123,119,121,131,124,117,122,118,113,124,127,121,127,127,
-    116,118,122,117,121,130,124,121,125,118,113,122,123,120,128,127,
-    117,119,120,113,118,127,121,122,127,117,113,121,118,117,127,126,
-    118,123,121,112,119,125,119,124,129,119,116,123,117,115,128,125,
-    119,127,123,112,120,124,116,124,130,119,119,125,115,115,127,122,
-    119,129,123,113,122,122,114,124,129,117,122,127,113,114,126,119,
-    118,130,122,113,123,120,111,123,127,116,123,127,113,115,125,116,
-    117,130,123,116,125,120,111,123,126,117,125,129,115,117,125,116,
-    118,131,123,118,127,120,111,123,124,116,126,129,117,120,125,115,
-    118,129,123,121,129,121,114,123,122,116,127,129,119,123,125,114,
-    117,127,120,122,130,121,116,122,119,115,125,126,120,125,124,114,
-    118,123,118,122,129,122,119,124,117,115,124,123,121,127,124,116,
-    119,120,115,121,126,121,122,123,116,115,121,120,120,127,124,119,
-    122,119,115,121,124,121,125,125,118,117,120,117,119,126,124,121,
-    125,119,114,120,121,118,125,126,119,120,121,114,117,125,121,121,
-    126,119,114,120,119,115,124,126,119,122,123,114,117,125,119,121,
-    129,121,116,124,118,114,125,125,118,126,126,114,119,125,117,121,
-    131,121,118,127,119,113,125,124,117,127,127,115,120,125,114,120,
-    130,120,119,128,118,114,125,122,116,127,127,116,123,125,114,119,
-    128,118,120,129,118,115,125,120,115,126,125,116,124,124,114,119,
-    126,118,121,129,119,117,125,119,115,125,124,117,124,124,115,120,
-    124,117,121,127,119,118,124,118,116,124,122,118,125,123,116,121,
-    123,117,121,126,120,121,125,119,118,124,121,119,126,123,118,123,
-    122,118,122,125,120,123,125,119,119,123,119,120,125,122,119,123,
-    120,117,122,122,119,124,123,118,120,122,118,121,125,121,121,124,
-    119,118,123,121,119,125,123,119,122,121,117,121,124,120,122,125,
-    119,119,124,119,119,126,123,119,124,122,116,121,123,118,122,126,
-    118,119,124,118,118,125,122,119,125,122,115,122,123,116,122,127,
-    118,120,125,117,117,125,121,118,126,123,115,123,122,115,122,126,
-    118,121,126,117,117,125,119,117,127,123,116,124,122,114,122,125,
-    117,122,127,118,119,125,118,117,126,122,117,125,121,114,122,123,
-    116,122,126,118,120,124,117,117,125,120,118,125,122,116,123,122,
-    116,123,125,118,122,125,118,119,125,120,119,125,121,118,123,121,
-    117,123,124,118,122,124,118,120,124,119,120,125,121,119,124,120,
-    118,123,122,118,123,123,118,121,123,118,121,124,119,119,124,119,
-    118,124,121,118,124,122,117,122,123,118,122,125,119,121,124,118,
-    119,124,120,119,126,122,118,124,122,118,124,125,119,123,125,118,
-    120,125,119,120,126,121,118,124,121,116,124,124,118,124,125,117,
-    120,124,117,119,126,120,117,124,119,115,123,122,116,123,124,116,
-    120,124,116,119,126,120,118,126,120,115,123,121,116,123,125,117,
-    122,125,116,119,126,119,120,127,121,117,125,121,116,125,125,118,
-    124,125,116,120,125,118,120,126,120,118,125,120,116,123,122,117,
-    123,124,117,120,123,117,120,125,120,120,125,120,118,124,121,118,
-    124,123,118,121,122,117,120,123,119,120,124,119,119,123,120,119,
-    124,122,119,122,121,118,121,123,120,122,124,120,121,123,120,120,
-    124,122,121,123,121,119,122,122,120,122,123,119,121,122,119,120,
-    123,121,121,123,120,119,122,121,120,123,123,120,122,122,118,121,
-    123,120,121,124,120,119,123,120,119,125,123,120,123,123,117,122,
-    124,120,122,126,120,120,124,119,118,125,123,119,125,122,116,122,
-    123,118,122,126,119,120,124,118,117,124,121,118,125,122,116,121,
-    122,115,121,126,119,120,125,117,116,123,119,118,126,122,116,122,
-    121,114,121,125,118,122,127,118,117,125,120,118,127,124,118,124,
-    122,115,121,124,118,122,127,119,118,123,118,116,125,123,119,125,
-    123,115,121,122,117,122,127,119,120,124,117,116,124,121,119,126,
-    122,116,121,121,115,122,125,120,122,124,118,118,124,120,121,127,
-    124,120,124,122,118,123,125,121,125,125,119,119,122,119,121,125,
-    122,121,123,120,117,121,121,120,123,123,119,120,120,116,119,122,
-    120,121,122,119,117,120,119,119,123,123,120,122,121,118,121,123,
-    121,123,125,121,120,122,119,119,124,122,121,124,121,117,121,122,
-    119,123,126,121,121,123,118,119,124,121,121,125,122,117,121,121,
-    117,123,125,119,122,124,117,118,124,120,121,127,122,118,123,120,
-    116,123,125,119,123,125,116,118,123,118,119,127,122,118,123,119,
-    114,122,123,118,124,125,117,119,123,116,119,127,122,119,125,120,
-    114,122,122,118,125,126,118,120,123,116,118,126,122,121,127,121,
-    116,122,121,117,125,127,120,123,124,116,118,125,121,121,128,122,
-    117,122,119,116,123,125,120,124,124,116,118,122,118,121,127,123,
-    119,123,118,115,122,123,120,125,124,118,119,120,117,121,126,123,
-    122,124,119,117,120,120,120,126,124,120,121,120,116,120,123,121,
-    124,125,119,118,120,118,119,125,124,122,123,120,116,119,121,120,
-    124,125,120,120,121,117,118,123,122,123,125,121,117,120,119,118,
-    124,125,121,123,122,116,118,122,120,122,127,122,118,121,119,116,
-    123,125,121,125,124,117,118,122,118,121,128,123,120,123,118,115,
-    122,123,120,125,125,117,119,122,116,120,127,122,121,126,119,115,
-    122,122,119,126,126,118,121,122,114,119,126,121,122,127,119,115,
-    122,119,117,126,126,118,123,122,114,118,125,119,122,128,120,116,
-    122,118,115,125,125,119,124,123,114,118,123,117,122,128,121,118,
-    123,117,115,124,124,120,126,125,116,119,122,117,122,128,122,121,
-    125,118,115,122,122,120,127,125,118,120,120,115,121,126,122,124,
-    126,118,116,121,119,120,127,125,121,123,120,115,120,123,121,125,
-    126,120,119,120,116,119,125,124,123,125,119,115,119,119,119,125,
-    125,121,121,120,115,118,123,122,124,126,121,118,120,117,118,124,
-    124,122,124,121,115,118,121,119,124,127,122,120,121,117,116,123,
-    123,123,126,123,117,119,119,116,122,126,122,122,123,116,115,121,
-    121,120,127,125,118,120,120,114,120,126,121,123,126,118,115,121,
-    118,118,127,125,119,123,121,113,120,125,120,124,129,119,117,123,
-    117,117,127,125,120,126,122,113,119,122,117,124,129,120,119,124,
-    115,115,125,123,120,128,123,115,120,121,115,123,129,121,122,125,
-    116,115,124,121,120,129,125,117,122,121,114,122,127,121,124,126,
-    117,116,122,119,120,128,125,120,123,120,114,121,124,121,125,127,
-    118,117,120,116,118,125,123,121,124,119,114,119,120,118,125,126,
-    119,120,120,115,118,124,122,123,126,121,117,120,118,118,125,125,
-    122,123,121,115,118,121,120,124,127,122,120,121,117,117,124,124,
-    123,126,122,117,119,119,118,124,126,122,122,121,115,116,122,121,
-    123,127,123,118,120,118,116,122,125,122,124,123,117,117,120,118,
-    121,128,124,120,122,118,114,121,124,121,126,126,118,118,121,116,
-    119,127,124,122,126,120,114,120,122,119,126,128,119,119,121,114,
-    117,126,123,122,128,121,114,121,120,116,126,129,121,123,124,114,
-    116,125,120,122,130,123,116,122,118,114,124,127,120,125,125,114,
-    116,122,117,120,129,122,118,122,116,111,121,122,118,125,125,115,
-    117,120,114,119,128,123,121,125,118,113,121,121,118,127,127,118,
-    121,121,114,118,126,122,124,128,120,116,122,119,118,127,128,121,
-    124,122,114,118,123,120,124,129,121,119,122,117,116,125,125,122,
-    127,123,115,119,121,117,124,128,121,121,123,116,116,124,122,122,
-    129,124,116,121,119,114,123,126,120,123,124,114,115,122,117,120,
-    128,123,118,123,118,113,122,124,119,126,126,115,117,121,115,119,
-    128,122,120,125,118,112,121,122,118,127,128,118,120,123,114,119,
-    128,122,122,128,120,114,122,121,117,127,129,119,123,124,113,117,
-    126,120,123,130,122,116,123,119,114,126,127,119,125,125,113,117,
-    124,118,122,130,122,118,123,117,113,124,124,119,126,125,114,117,
-    122,115,120,129,122,120,125,117,113,122,122,119,128,126,117,120,
-    121,114,120,127,122,123,127,118,115,121,119,118,127,126,119,123,
-    120,114,119,124,121,125,128,120,118,121,117,118,126,124,122,126,
-    121,115,119,120,119,125,127,121,121,121,115,117,123,122,123,127,
-    121,116,119,118,116,124,126,121,124,122,115,117,121,119,123,128,
-    122,119,122,117,115,123,124,121,127,125,116,118,121,116,122,129,
-    122,121,125,117,114,123,122,120,129,126,117,121,121,113,120,128,
-    121,123,128,117,114,123,119,117,129,126,117,123,122,111,119,126,
-    118,123,130,118,115,123,116,114,128,126,118,127,124,112,119,125,
-    116,123,131,119,118,125,115,113,126,123,118,128,124,112,119,122,
-    113,122,130,119,120,126,115,113,124,121,117,129,125,114,121,121,
-    112,121,128,119,122,128,116,114,123,119,117,129,125,117,123,121,
-    113,121,126,119,124,129,118,117,123,117,118,128,125,120,126,121,
-    114,121,123,119,126,128,120,120,122,115,118,126,122,122,127,121,
-    116,121,119,117,125,126,120,123,121,114,117,122,119,123,127,121,
-    118,121,117,117,125,124,122,126,122,115,119,120,117,124,127,122,
-    122,123,117,117,124,122,122,128,123,118,121,119,115,123,126,121,
-    124,125,116,117,122,119,120,129,124,119,123,119,113,121,124,120,
-    125,127,117,117,121,115,117,128,123,119,125,119,112,121,123,117,
-    125,128,117,119,123,114,116,127,122,120,128,121,113,121,121,115,
-    126,129,119,122,125,114,116,126,119,120,130,122,115,123,120,113,
-    125,128,119,125,127,114,117,125,118,120,131,123,118,126,119,112,
-    124,125,118,126,127,115,118,123,114,118,129,121,119,126,118,112,
-    122,122,117,127,127,117,120,123,113,118,127,120,121,128,120,115,
-    123,120,116,127,126,118,124,123,113,119,125,118,122,129,119,117,
-    124,117,115,126,124,119,127,123,114,121,123,116,123,129,119,120,
-    125,115,115,126,121,119,128,123,114,122,121,113,124,127,118,123,
-    127,115,117,125,118,119,130,122,116,125,120,112,124,125,116,124,
-    127,114,117,124,115,118,129,121,117,127,119,112,123,123,115,126,
-    128,116,120,125,114,118,129,120,119,129,120,113,124,122,115,127,
-    128,117,123,127,115,119,129,120,120,131,121,115,126,121,114,127,
-    127,117,124,126,114,119,126,117,120,129,120,116,125,119,114,125,
-    124,117,125,125,114,119,124,116,120,128,120,119,126,118,115,125,
-    122,118,127,125,116,121,123,115,121,127,120,121,126,117,116,123,
-    119,118,127,123,118,123,121,114,121,124,119,123,126,118,118,122,
-    117,118,125,122,120,124,120,115,121,121,117,124,125,118,121,122,
-    116,119,125,121,122,127,120,117,122,120,117,126,126,120,124,123,
-    116,119,124,118,122,128,121,118,124,118,115,125,123,118,126,124,
-    114,119,123,115,120,128,119,119,126,117,113,124,121,116,127,125,
-    115,122,124,113,120,128,118,120,128,117,114,126,120,115,128,125,
-    115,125,124,112,120,127,116,121,130,117,116,127,118,114,129,124,
-    116,127,125,112,122,127,115,122,130,117,118,128,117,114,129,123,
-    116,128,125,113,123,126,114,123,130,117,120,128,117,116,128,121,
-    116,129,124,114,124,124,114,123,129,117,121,128,116,117,128,119,
-    117,129,122,115,125,122,113,124,126,116,123,127,115,118,126,116,
-    118,128,120,116,126,120,113,124,123,116,125,125,115,120,124,114,
-    119,128,119,119,127,118,115,125,120,116,127,125,116,123,123,114,
-    120,126,117,121,128,118,117,125,118,116,127,123,118,126,123,113,
-    121,124,116,123,128,118,119,125,116,116,126,121,118,128,123,114,
-    123,123,114,123,128,117,121,127,116,116,127,119,117,129,124,115,
-    125,122,113,123,127,116,123,128,115,116,126,117,116,129,122,115,
-    126,121,111,122,125,114,123,128,115,118,126,114,116,128,120,116,
-    128,121,113,124,123,114,125,128,116,122,127,115,118,128,119,118,
-    130,121,115,126,122,114,126,126,116,124,127,115,120,127,117,119,
-    129,120,117,127,120,114,126,124,116,125,125,114,121,126,116,120,
-    128,118,118,127,118,115,126,121,115,126,124,115,122,124,114,121,
-    127,117,119,127,117,116,126,120,116,127,122,115,124,123,114,123,
-    127,116,122,128,116,118,128,119,117,129,122,115,127,122,113,125,
-    126,115,124,128,115,119,127,116,117,130,120,116,129,121,113,126,
-    124,113,126,128,113,121,128,113,118,130,118,117,131,120,113,127,
-    122,112,127,127,113,124,128,111,118,129,115,117,131,118,113,128,
-    119,110,127,125,112,125,127,111,119,128,113,118,131,118,115,129,
-    118,110,127,124,112,127,127,111,121,127,112,118,131,117,117,130,
-    118,112,127,122,113,128,127,114,124,127,113,120,129,117,120,130,
-    119,115,127,120,114,127,124,115,125,125,114,122,127,116,122,129,
-    118,118,127,118,116,127,122,117,126,123,115,123,123,115,123,126,
-    117,121,125,116,118,125,119,119,126,120,117,123,120,116,124,123,
-    118,124,124,117,121,125,119,122,127,120,120,125,120,118,125,122,
-    118,125,123,117,122,123,117,122,126,119,121,125,119,118,125,121,
-    119,127,124,117,124,124,117,123,127,118,121,127,118,117,126,119,
-    117,127,122,115,124,122,113,122,126,115,121,127,115,117,126,118,
-    116,128,122,115,127,123,113,124,127,115,123,129,115,118,128,116,
-    116,129,120,115,128,121,111,124,124,112,123,128,114,120,127,114,
-    115,128,118,116,129,121,112,125,122,112,125,128,115,122,128,114,
-    117,128,117,117,130,121,114,126,121,112,125,126,115,125,128,114,
-    119,127,116,118,130,120,117,128,120,113,125,124,115,126,127,114,
-    121,126,114,119,129,119,119,129,119,114,126,121,114,127,125,115,
-    124,125,112,120,127,116,120,130,117,116,127,118,114,128,123,115,
-    127,124,112,123,126,114,122,130,116,119,129,116,115,129,121,116,
-    130,124,113,126,125,113,125,130,115,122,130,115,117,130,118,116,
-    131,122,113,127,123,111,124,127,113,122,129,113,117,129,116,116,
-    131,120,114,128,122,111,126,126,113,124,129,112,118,128,114,116,
-    130,119,114,129,120,111,126,124,112,125,128,112,120,127,113,117,
-    130,118,116,129,120,112,126,123,113,126,127,114,122,126,114,119,
-    128,118,119,127,120,117,124,121,118,124,123,119,122,122,119,121,
-    122,121,121,122,121,121,121,121,121    
-};
@@ -1,2392 +0,0 @@
-/*    File robin-sample.wav
- *    Sample rate 11000 Hz
- */
-#define WAV_DATA_LENGTH 38151 
-
-uint16_t WAV_DATA[] = {
-    151,151,150,144,152,164,162,146,141,155,157,137,113,118,150,182,
-    193,184,164,149,148,153,159,159,152,142,133,128,129,135,141,138,
-    128,114,103,100,106,119,138,163,189,211,225,230,224,208,187,162,
-    136,113,93,80,74,78,89,106,126,147,166,182,192,195,193,184,
-    170,152,133,114,98,87,82,83,90,100,114,130,146,160,172,180,
-    184,183,178,169,159,148,137,127,118,112,109,109,111,116,124,133,
-    142,151,158,164,167,167,164,158,149,138,126,115,104,96,91,90,
-    92,98,106,116,127,139,149,157,163,166,166,163,158,152,145,138,
-    131,125,121,119,119,121,124,130,136,144,151,157,162,166,166,165,
-    160,153,144,133,122,111,101,94,90,90,93,99,108,118,129,140,
-    149,157,162,165,165,162,158,152,145,138,132,126,122,121,120,122,
-    126,131,137,144,150,156,161,164,164,162,157,150,141,131,120,110,
-    101,94,91,91,94,101,109,119,130,140,150,157,162,165,164,162,
-    157,151,144,138,132,127,123,122,122,124,128,133,138,145,151,156,
-    160,162,162,160,155,148,139,129,119,109,100,94,91,91,95,101,
-    110,120,131,141,150,157,162,164,164,161,156,150,144,138,132,128,
-    124,123,123,125,129,134,139,145,151,156,159,161,161,158,153,147,
-    138,128,118,108,100,94,92,92,96,102,111,121,131,141,150,156,
-    161,163,163,160,155,150,144,138,132,128,125,124,125,127,130,135,
-    140,146,151,155,158,160,159,157,152,145,137,127,117,108,100,95,
-    92,93,97,103,112,121,131,141,149,156,160,162,162,159,155,149,
-    144,138,133,129,126,126,126,128,132,136,141,146,151,155,158,159,
-    158,155,150,144,135,126,117,108,100,95,93,94,98,104,112,122,
-    131,141,149,155,159,161,161,158,154,149,143,138,133,130,128,127,
-    128,130,133,137,142,146,151,154,157,158,157,154,149,143,135,126,
-    116,108,101,96,94,95,98,105,113,122,131,140,148,154,158,160,
-    160,157,153,148,143,138,134,131,129,128,129,131,134,138,142,146,
-    150,154,156,157,156,153,148,142,134,125,116,108,101,96,95,96,
-    99,105,113,122,131,140,148,153,157,159,159,156,153,148,143,139,
-    135,132,130,129,130,132,135,139,143,147,150,153,155,156,155,152,
-    147,141,134,125,117,109,102,97,95,96,100,106,114,122,131,140,
-    147,153,156,158,158,155,152,148,143,139,135,133,131,131,132,133,
-    136,140,143,147,150,153,155,155,154,151,147,141,133,125,117,109,
-    102,98,96,97,101,106,114,122,131,139,146,152,155,157,157,155,
-    151,147,143,139,136,133,132,132,133,135,137,140,144,147,150,153,
-    154,154,153,151,146,140,133,125,117,110,103,99,97,98,101,107,
-    114,122,131,139,146,151,154,156,156,154,151,147,143,140,137,134,
-    133,133,134,136,138,141,144,147,150,152,154,154,153,150,146,140,
-    133,125,118,110,104,100,98,99,102,107,114,122,131,138,145,150,
-    153,155,155,153,151,147,144,140,137,135,134,134,135,137,139,142,
-    145,147,150,152,153,153,152,150,145,140,133,126,118,111,105,100,
-    99,99,102,108,114,122,130,138,144,149,153,154,154,153,150,147,
-    144,141,138,136,135,135,136,138,140,142,145,147,150,152,153,153,
-    152,149,145,140,134,126,119,112,106,101,99,100,103,108,114,122,
-    130,137,143,148,152,153,154,152,150,147,144,141,139,137,136,136,
-    137,138,140,143,145,148,150,151,152,152,151,149,145,140,134,127,
-    119,112,106,102,100,101,103,108,115,122,129,137,143,147,151,153,
-    153,152,150,147,144,142,139,138,137,137,138,139,141,143,145,148,
-    150,151,152,152,151,149,145,140,134,127,120,113,107,103,101,101,
-    104,108,115,122,129,136,142,147,150,152,152,151,149,147,145,142,
-    140,139,138,138,139,140,142,144,146,148,149,151,152,152,151,149,
-    145,140,134,128,121,114,108,104,102,102,104,109,115,121,129,135,
-    141,146,149,151,152,151,149,147,145,143,141,139,139,139,140,141,
-    142,144,146,148,149,151,151,151,151,148,145,141,135,128,121,115,
-    109,105,102,103,105,109,115,121,128,135,141,145,148,150,151,150,
-    149,147,145,143,141,140,140,140,141,142,143,145,146,148,149,151,
-    151,151,150,148,145,141,135,129,122,116,110,106,103,103,105,109,
-    115,121,128,134,140,144,148,150,150,150,149,147,145,144,142,141,
-    141,141,141,142,144,145,147,148,149,150,151,151,150,148,145,141,
-    136,130,123,117,111,106,104,104,106,109,115,121,127,134,139,144,
-    147,149,150,150,148,147,145,144,143,142,141,141,142,143,144,145,
-    147,148,149,150,151,151,150,148,146,141,136,130,124,117,112,107,
-    105,104,106,109,114,121,127,133,138,143,146,148,149,149,148,147,
-    146,144,143,142,142,142,143,144,145,146,147,148,149,150,151,151,
-    150,149,146,142,137,131,125,118,113,108,105,105,106,110,114,120,
-    126,132,138,142,145,147,149,149,148,147,146,145,144,143,143,143,
-    143,144,145,146,147,148,149,150,151,151,150,149,146,142,138,132,
-    126,119,114,109,106,105,107,110,114,120,126,132,137,141,144,147,
-    148,148,148,147,146,145,144,144,143,144,144,145,146,147,147,148,
-    149,150,151,151,150,149,146,143,138,133,127,120,115,110,107,106,
-    107,110,114,119,125,131,136,140,144,146,147,148,148,147,146,146,
-    145,144,144,144,145,145,146,147,148,149,149,150,150,151,150,149,
-    147,143,139,133,128,121,116,111,108,107,107,110,114,119,125,130,
-    136,140,143,145,147,147,147,147,146,146,145,145,145,145,145,146,
-    147,147,148,149,149,150,150,150,150,149,147,144,139,134,128,122,
-    117,112,109,107,108,110,114,119,124,130,135,139,142,145,146,147,
-    147,147,147,146,146,145,145,145,146,146,147,148,148,149,149,150,
-    150,150,150,149,147,144,140,135,129,123,118,113,109,108,108,110,
-    114,119,124,129,134,138,142,144,146,147,147,147,147,146,146,146,
-    146,146,146,147,147,148,148,149,150,150,150,150,150,149,147,144,
-    140,135,130,124,118,114,110,108,109,111,114,119,124,129,134,138,
-    141,143,145,146,147,147,147,147,147,146,146,147,147,147,148,148,
-    149,149,150,150,150,150,150,149,147,144,140,137,131,125,119,114,
-    111,109,107,108,113,120,126,131,135,138,140,143,145,146,147,147,
-    146,145,145,146,146,146,146,146,145,145,146,147,148,150,152,154,
-    155,155,153,150,145,138,131,124,117,111,106,104,105,107,112,117,
-    124,130,135,140,143,145,146,147,146,145,144,143,143,143,143,144,
-    145,146,148,149,151,152,152,153,153,153,152,150,148,144,140,135,
-    129,124,118,114,110,109,109,111,115,120,125,130,134,138,140,142,
-    143,144,144,144,144,144,144,144,145,146,147,148,149,150,151,151,
-    152,152,152,152,151,150,148,145,141,136,131,125,120,116,112,111,
-    111,113,116,120,125,130,134,137,140,142,143,144,144,144,144,144,
-    145,145,145,146,147,148,149,150,151,152,152,152,152,152,151,150,
-    148,145,141,137,132,126,121,116,113,111,111,113,116,120,125,129,
-    134,137,140,141,143,144,144,144,144,145,145,145,146,147,148,149,
-    150,151,151,152,152,153,153,152,152,150,148,145,142,137,132,127,
-    122,117,114,112,112,113,116,120,125,129,133,137,139,141,143,143,
-    144,144,145,145,145,146,146,147,148,149,150,151,151,152,153,153,
-    153,152,152,151,149,146,142,138,132,127,122,118,114,113,112,114,
-    117,121,125,129,133,136,139,141,142,143,144,144,145,145,146,146,
-    147,147,148,149,150,151,152,152,153,153,153,153,152,151,149,146,
-    142,138,133,128,123,118,115,113,113,114,117,121,125,129,133,136,
-    139,141,142,143,144,145,145,146,146,147,147,148,148,149,150,151,
-    152,152,153,153,153,153,152,151,149,146,142,138,133,128,123,119,
-    115,114,113,115,117,121,125,129,133,136,139,141,142,143,144,145,
-    145,146,146,147,147,148,149,150,150,151,152,152,153,153,153,153,
-    152,151,149,146,142,138,133,128,123,119,116,114,114,115,118,121,
-    125,129,133,136,138,140,142,143,144,145,146,146,147,147,148,148,
-    149,150,150,151,152,152,153,153,153,153,152,151,149,146,142,138,
-    133,128,123,119,116,115,114,116,118,122,126,129,132,136,139,141,
-    142,143,145,147,147,146,146,146,147,148,149,150,150,151,151,152,
-    153,154,154,154,153,151,149,147,144,140,135,130,125,120,116,113,
-    112,112,115,118,123,128,133,137,140,143,146,147,148,149,149,148,
-    148,147,147,147,147,148,149,150,152,153,154,155,156,156,155,153,
-    151,147,143,138,132,127,122,118,115,114,114,116,119,123,127,131,
-    135,138,140,142,144,145,146,146,147,147,147,147,148,148,149,150,
-    151,152,153,154,155,155,155,155,154,152,150,146,142,137,132,127,
-    122,118,116,115,115,117,120,124,128,131,135,137,140,141,143,144,
-    145,146,147,147,148,148,148,148,149,150,151,152,153,154,155,155,
-    155,155,154,152,149,146,141,136,131,126,122,118,116,115,116,118,
-    121,124,128,132,135,137,140,142,143,145,146,147,147,148,148,148,
-    148,149,149,150,151,152,153,154,154,155,155,154,153,151,149,145,
-    141,136,131,126,121,118,116,115,116,118,121,125,128,132,135,138,
-    140,142,144,145,146,147,148,149,149,149,149,149,149,150,151,152,
-    153,153,154,154,154,154,153,151,148,144,140,135,130,125,121,118,
-    116,116,117,119,122,126,129,132,135,138,140,142,144,146,147,148,
-    149,149,149,149,149,149,150,150,151,152,152,153,154,154,154,153,
-    152,150,147,144,139,134,129,125,121,118,116,116,118,120,123,126,
-    130,133,136,138,140,143,145,146,148,149,150,150,150,150,150,150,
-    150,150,151,152,152,153,153,154,154,153,152,150,147,143,139,134,
-    129,124,121,118,117,117,118,121,124,127,130,133,136,138,141,143,
-    145,147,148,150,150,151,151,150,150,150,150,150,151,151,152,153,
-    153,153,153,153,151,149,146,142,138,133,128,124,121,118,117,118,
-    119,121,124,128,131,134,136,139,141,143,145,147,149,150,151,151,
-    151,151,151,150,150,151,151,151,152,152,153,153,153,152,151,149,
-    146,142,137,133,128,124,121,119,118,118,120,122,125,128,131,134,
-    136,139,141,144,146,148,150,151,151,152,152,151,151,150,151,151,
-    151,151,152,153,153,153,151,150,149,148,145,141,137,132,128,124,
-    121,120,119,120,121,123,126,129,133,136,138,141,143,144,146,147,
-    148,149,149,149,150,150,151,152,152,153,153,154,154,154,154,153,
-    152,151,149,146,143,139,135,131,127,124,122,121,121,122,123,126,
-    128,130,133,134,136,138,140,143,145,147,149,151,152,153,153,153,
-    153,153,153,152,152,152,152,152,151,151,151,150,148,146,143,140,
-    136,132,128,125,123,122,121,122,123,125,128,130,132,134,136,139,
-    141,143,146,148,150,152,153,153,153,153,153,153,152,152,152,151,
-    151,151,151,150,150,149,148,146,143,140,136,132,128,125,123,122,
-    122,122,124,126,128,130,132,134,136,139,141,144,146,148,150,152,
-    153,153,154,154,153,153,153,152,152,151,151,151,150,150,150,149,
-    147,145,143,139,136,132,129,126,123,122,122,123,124,126,128,130,
-    132,134,136,139,141,144,146,148,151,152,153,154,154,154,154,153,
-    153,152,152,151,151,150,150,150,149,148,147,145,142,139,136,132,
-    129,126,124,123,123,123,125,127,129,131,133,134,136,139,141,144,
-    146,149,151,152,153,154,154,154,154,154,153,153,152,151,151,150,
-    150,149,149,148,147,145,142,139,136,132,129,126,124,123,123,124,
-    125,127,129,131,133,134,136,139,141,144,146,149,151,152,153,154,
-    154,154,154,154,153,153,152,151,151,150,150,149,149,148,147,145,
-    142,139,136,133,129,127,125,124,124,124,125,127,129,131,133,134,
-    136,138,141,144,146,149,151,152,154,154,155,155,155,154,154,153,
-    152,152,151,150,150,149,149,148,147,145,142,140,136,133,130,127,
-    125,124,124,125,126,127,129,131,132,134,136,138,141,143,146,148,
-    151,152,154,154,155,155,155,155,154,153,153,152,151,150,150,149,
-    148,148,147,145,143,140,137,134,130,128,126,125,124,125,126,127,
-    129,131,132,134,136,138,140,143,146,148,150,152,154,154,155,155,
-    155,155,154,154,153,152,151,150,150,149,149,148,146,145,143,141,
-    137,134,131,129,127,125,124,124,125,127,129,131,132,134,135,138,
-    140,143,146,148,150,152,154,155,155,156,158,158,157,154,151,150,
-    149,148,148,147,146,146,146,146,145,143,141,138,135,131,129,128,
-    127,127,128,128,129,129,130,130,131,133,136,139,143,148,151,155,
-    157,159,160,160,159,158,156,154,152,150,149,147,147,147,147,147,
-    148,148,147,145,143,140,137,133,130,128,126,125,124,125,126,127,
-    129,132,134,137,140,143,147,150,152,154,156,156,157,156,156,155,
-    154,153,152,151,150,149,149,149,149,149,149,149,148,146,143,140,
-    136,134,130,127,120,123,120,112,124,130,123,125,136,144,150,158,
-    166,164,153,144,144,152,167,182,194,198,194,183,170,157,149,145,
-    142,141,140,137,133,125,116,105,94,85,78,75,75,77,80,85,
-    90,94,97,99,100,102,102,104,107,113,119,125,132,141,150,157,
-    162,168,173,180,185,190,192,194,195,195,196,198,200,202,204,206,
-    208,210,211,212,211,209,206,203,198,194,189,184,180,176,173,170,
-    168,166,164,163,163,162,161,159,157,153,149,144,138,132,125,119,
-    113,106,101,96,92,89,86,85,85,84,84,84,83,81,80,78,
-    77,76,76,76,78,80,82,85,89,94,99,105,111,118,125,133,
-    141,149,157,164,170,176,181,186,190,193,196,198,200,202,204,206,
-    208,211,213,216,217,218,217,216,213,209,205,200,195,191,186,182,
-    178,174,171,168,165,162,160,157,155,154,153,151,149,147,144,141,
-    136,131,126,120,115,109,104,99,94,91,88,86,85,85,85,85,
-    85,84,83,82,81,80,79,79,79,80,82,84,88,92,96,102,
-    107,114,121,128,136,144,152,160,167,174,179,184,188,191,194,197,
-    199,201,203,205,207,210,212,214,216,217,218,217,214,211,207,202,
-    197,191,186,181,176,172,168,165,162,159,157,154,152,151,149,148,
-    147,145,143,140,136,131,126,121,116,110,105,101,97,93,91,89,
-    88,87,88,88,88,88,88,87,86,84,83,83,82,82,83,85,
-    87,91,95,100,106,112,118,124,132,140,148,156,164,171,176,181,
-    186,190,193,196,199,201,202,205,208,210,211,213,215,218,219,219,
-    216,212,208,203,198,193,187,182,177,172,168,164,161,159,156,152,
-    149,147,144,143,142,141,141,140,137,134,130,125,120,114,109,103,
-    98,94,91,88,87,87,87,89,90,91,92,92,92,91,90,88,
-    86,85,85,85,86,89,92,97,103,109,115,123,130,138,146,154,
-    162,169,175,180,185,188,191,194,196,198,201,203,205,208,210,212,
-    215,216,218,218,217,215,211,207,201,195,189,183,176,171,166,162,
-    158,155,153,151,149,147,145,144,143,141,140,138,135,132,128,123,
-    118,113,108,104,100,98,95,93,92,92,92,92,93,94,94,94,
-    94,93,92,90,89,87,87,87,88,90,94,98,103,109,115,121,
-    128,135,143,151,158,165,172,178,183,186,189,193,195,197,199,202,
-    205,209,212,213,215,215,216,217,216,215,212,207,202,196,190,183,
-    177,172,166,161,157,153,150,148,147,146,145,144,144,143,141,139,
-    136,132,128,122,117,112,107,103,100,98,96,95,95,95,95,96,
-    96,97,97,97,96,95,93,91,89,88,87,87,89,91,94,99,
-    104,109,115,122,128,135,141,148,155,162,169,174,179,183,187,190,
-    193,196,199,202,205,208,210,212,214,215,216,216,215,213,210,206,
-    202,196,190,184,178,172,167,162,159,155,153,150,148,146,144,142,
-    140,139,137,135,133,131,127,123,119,115,111,107,104,102,100,99,
-    98,97,96,96,96,97,97,97,97,96,95,94,93,92,91,91,
-    91,93,96,99,104,109,115,120,127,133,140,146,153,160,167,173,
-    178,183,186,189,192,195,198,201,204,207,209,211,213,214,214,214,
-    214,212,210,206,202,197,191,185,179,173,168,163,159,156,153,150,
-    148,146,144,142,140,138,137,135,134,131,128,124,120,116,112,109,
-    106,104,102,100,99,98,98,98,98,98,98,98,98,98,97,96,
-    95,94,93,93,93,95,97,100,105,109,115,120,126,132,139,145,
-    152,159,166,172,178,182,185,188,191,194,197,200,203,206,208,210,
-    211,212,213,213,213,211,209,205,202,197,191,185,179,174,169,164,
-    160,156,152,149,146,145,144,142,140,139,139,138,136,132,128,124,
-    120,117,113,109,106,104,103,102,103,103,103,102,101,101,101,101,
-    101,101,99,98,96,94,92,91,90,92,94,98,103,109,115,122,
-    129,135,141,148,154,160,165,170,175,179,182,185,188,192,195,199,
-    203,206,209,211,213,214,214,214,212,210,207,203,199,193,188,182,
-    177,172,167,163,160,157,155,152,150,148,146,143,141,140,138,136,
-    134,132,129,126,122,119,116,113,110,108,107,106,105,104,103,102,
-    102,101,101,100,100,99,98,97,96,95,94,94,95,97,99,103,
-    107,111,116,121,126,132,138,144,150,157,163,169,174,178,182,186,
-    190,193,196,199,203,205,207,209,211,211,211,211,210,208,204,201,
-    197,193,188,183,178,172,167,164,160,157,154,152,149,147,145,143,
-    141,140,138,137,135,132,130,127,124,121,118,116,114,112,110,109,
-    107,105,103,102,101,100,99,99,98,98,97,96,96,95,95,96,
-    97,98,100,103,107,111,115,120,125,130,136,143,149,156,163,169,
-    174,179,183,187,190,193,196,198,201,203,204,206,207,207,208,207,
-    207,205,203,200,196,191,186,181,177,172,168,164,160,157,154,152,
-    149,147,145,144,143,142,141,140,139,137,134,131,128,124,121,118,
-    115,112,110,107,105,104,103,102,101,101,101,100,100,99,98,97,
-    96,95,95,95,96,98,100,103,107,111,115,120,126,132,138,145,
-    151,158,164,170,175,179,183,186,189,192,195,197,199,201,202,203,
-    204,205,205,205,204,203,200,197,193,189,184,180,175,171,167,164,
-    161,158,155,153,151,149,148,147,146,145,144,143,142,140,137,134,
-    131,127,124,120,117,113,110,108,106,104,103,102,101,101,100,99,
-    98,97,96,95,95,95,95,95,97,99,101,104,108,112,117,122,
-    128,134,140,147,153,160,165,171,175,179,183,186,189,191,193,195,
-    196,198,199,200,201,202,202,202,201,199,197,194,190,186,182,178,
-    174,171,167,164,162,159,157,155,153,152,151,150,149,149,149,148,
-    145,142,139,136,133,129,125,121,118,114,110,106,104,104,104,103,
-    101,99,98,97,96,94,93,93,93,95,96,97,99,101,103,106,
-    109,113,117,123,129,136,143,151,159,166,171,176,179,181,183,184,
-    184,184,185,186,188,190,193,196,198,200,202,202,201,199,196,192,
-    187,183,178,174,170,167,165,163,162,161,160,160,160,160,159,159,
-    157,156,154,151,148,144,141,137,133,129,124,120,116,112,110,107,
-    105,104,103,101,100,98,97,95,94,93,92,91,92,92,94,96,
-    98,102,105,110,114,120,125,131,137,143,148,153,158,162,167,170,
-    174,177,180,182,184,185,187,188,190,191,193,194,195,195,195,194,
-    192,190,188,185,182,179,178,176,174,172,169,167,166,164,163,163,
-    163,164,165,164,163,160,157,153,150,146,142,138,134,129,125,119,
-    113,111,111,107,99,95,96,95,88,82,84,94,102,105,101,95,
-    92,92,95,98,100,101,102,104,108,115,123,130,135,138,140,143,
-    148,155,165,175,186,197,205,210,211,208,203,197,190,183,177,173,
-    171,171,173,177,182,187,192,196,198,197,195,190,183,176,167,159,
-    152,147,144,143,144,147,150,154,157,160,162,162,161,157,152,144,
-    136,127,118,110,103,97,92,89,88,88,88,89,91,93,95,97,
-    98,98,98,97,96,94,92,91,90,91,93,97,103,111,119,129,
-    138,147,156,164,170,176,180,182,184,184,183,182,180,180,179,180,
-    181,183,186,188,191,193,195,197,198,198,197,194,191,187,182,176,
-    170,164,159,155,152,151,152,153,155,158,161,163,164,165,164,162,
-    159,154,148,141,133,126,118,111,106,103,100,97,94,93,94,95,
-    96,98,98,99,99,99,99,98,97,96,94,93,93,94,97,103,
-    109,117,125,133,142,149,157,163,169,174,178,181,183,183,183,183,
-    182,182,182,182,183,184,186,187,189,191,192,194,195,195,194,193,
-    191,187,183,178,173,168,162,158,155,154,154,155,157,159,161,163,
-    165,166,165,163,160,156,150,143,135,128,121,114,108,104,101,98,
-    97,95,95,95,97,98,98,99,100,101,100,99,99,98,98,97,
-    97,97,98,101,108,116,125,134,143,151,159,166,173,178,181,182,
-    182,181,180,178,178,178,178,179,181,183,185,187,190,192,193,195,
-    195,195,194,191,188,185,180,175,170,165,161,157,155,154,155,156,
-    158,161,163,164,165,165,164,162,159,154,147,141,133,126,120,114,
-    109,105,102,100,98,97,97,97,98,98,99,99,100,100,100,99,
-    99,98,97,97,97,98,101,105,111,118,126,134,142,150,158,164,
-    170,175,178,180,181,181,180,179,179,179,179,180,181,183,184,186,
-    188,190,191,192,192,192,191,190,187,184,180,176,171,167,162,159,
-    157,156,155,156,158,160,161,163,164,164,162,160,158,153,148,141,
-    134,127,120,114,110,106,103,101,100,99,99,99,99,100,100,100,
-    101,102,102,102,101,101,102,102,101,102,105,109,115,122,130,137,
-    145,152,159,165,170,174,177,179,180,180,180,180,180,180,181,181,
-    182,182,183,183,184,184,185,186,186,186,186,185,184,182,178,174,
-    170,165,160,156,153,151,151,152,153,155,157,159,161,162,162,161,
-    158,154,149,143,137,130,124,119,114,110,107,105,103,103,102,102,
-    103,104,104,105,106,106,106,106,106,105,104,104,103,104,106,110,
-    115,121,128,136,144,151,159,165,171,176,179,181,182,182,181,181,
-    180,179,179,180,180,181,183,184,185,186,187,187,187,187,186,184,
-    182,179,175,171,166,162,157,154,151,150,149,150,152,154,156,158,
-    160,161,161,160,157,153,149,143,137,131,125,120,115,112,109,107,
-    106,105,105,105,105,105,106,107,107,107,106,107,107,107,106,105,
-    105,105,107,110,115,121,128,135,143,150,158,165,171,175,179,181,
-    182,182,182,182,181,182,182,183,184,185,186,186,187,187,186,186,
-    186,185,183,182,180,177,174,170,166,161,157,153,150,148,147,147,
-    148,149,151,153,155,156,156,156,154,152,148,143,138,133,127,122,
-    118,114,111,109,108,107,106,106,106,106,107,108,109,109,110,110,
-    109,109,108,107,106,107,107,110,114,119,125,132,140,148,156,163,
-    170,175,178,181,183,185,186,186,185,184,184,184,185,185,185,186,
-    186,185,184,184,185,186,186,185,182,178,174,170,166,161,156,151,
-    147,143,141,141,141,143,145,147,148,150,151,151,151,150,148,145,
-    142,137,133,127,122,117,113,110,107,106,105,104,105,106,108,110,
-    112,114,115,115,115,114,112,110,108,107,107,107,110,114,120,127,
-    135,144,152,160,168,174,179,183,186,187,188,188,187,186,185,185,
-    184,184,185,185,186,187,187,188,188,188,187,185,183,180,175,170,
-    165,159,153,148,143,139,137,136,136,137,140,143,145,148,150,150,
-    150,149,146,143,140,136,131,126,122,118,115,113,111,111,111,111,
-    111,112,113,114,115,116,117,117,117,116,115,113,110,109,108,109,
-    111,115,120,127,133,141,150,158,165,171,176,181,185,188,190,191,
-    192,191,190,190,189,188,186,187,188,189,190,190,190,189,188,187,
-    184,181,176,170,163,156,150,144,139,135,132,130,129,130,132,135,
-    138,141,144,146,147,146,144,141,137,133,129,126,122,119,116,114,
-    113,113,114,115,116,118,119,121,122,122,123,122,121,119,117,115,
-    113,112,111,112,114,117,122,127,134,141,148,156,163,169,174,179,
-    182,185,187,188,189,190,191,191,191,191,191,191,191,191,191,191,
-    190,189,188,185,182,179,174,169,164,158,152,146,140,136,133,130,
-    129,129,130,131,133,135,137,138,138,138,137,136,134,132,130,128,
-    126,124,122,121,120,119,119,119,119,120,121,122,123,123,124,124,
-    123,122,121,119,118,116,115,115,117,119,122,127,133,139,146,152,
-    158,164,169,175,179,182,185,187,188,190,191,192,193,193,193,193,
-    192,192,191,191,190,189,188,186,184,180,176,171,166,159,153,147,
-    141,136,132,130,128,128,128,129,131,132,133,134,135,135,135,134,
-    132,130,128,127,125,124,123,122,122,121,121,122,122,122,123,124,
-    125,125,126,125,125,124,123,122,120,119,118,118,119,120,124,128,
-    133,138,143,149,155,160,166,170,175,178,181,184,186,188,190,192,
-    193,194,194,193,193,193,193,192,191,190,188,185,182,179,176,171,
-    165,160,154,149,143,138,134,131,130,129,130,131,131,130,130,131,
-    132,133,133,132,130,129,127,127,126,126,126,125,125,124,124,123,
-    123,124,124,124,125,125,125,126,125,125,124,124,123,122,121,121,
-    122,123,125,129,133,138,143,148,153,158,163,168,172,176,179,182,
-    184,187,189,190,192,193,194,194,194,194,193,192,191,189,187,184,
-    182,179,175,171,166,162,156,151,146,142,138,135,132,131,130,130,
-    130,130,130,131,131,131,131,130,130,129,129,128,127,127,127,126,
-    126,126,126,125,125,126,125,125,126,126,126,126,127,127,126,125,
-    124,123,122,122,122,123,125,129,133,137,142,146,152,156,160,164,
-    168,172,176,180,183,186,189,191,192,192,192,192,193,193,193,192,
-    192,190,189,186,183,180,178,174,168,162,157,153,149,145,141,138,
-    135,134,133,131,131,130,130,130,130,131,131,131,131,131,131,130,
-    128,126,125,124,122,121,120,121,122,124,125,126,127,128,128,129,
-    128,127,124,122,120,118,117,117,118,119,122,125,130,134,141,145,
-    154,152,163,169,162,164,192,179,155,169,179,211,200,169,163,163,
-    161,171,199,227,228,207,182,153,126,108,110,128,150,167,182,189,
-    182,162,136,109,88,73,69,75,90,109,127,140,146,145,139,128,
-    118,109,105,104,106,110,114,117,119,119,119,119,119,120,121,123,
-    124,125,126,125,124,123,121,119,117,115,113,112,112,113,116,121,
-    126,132,138,144,149,152,156,161,165,169,173,177,181,184,186,187,
-    188,189,191,194,197,200,202,204,204,203,202,200,197,194,190,187,
-    183,178,174,169,164,159,155,151,149,148,149,151,152,152,151,149,
-    148,146,144,143,143,142,141,139,137,134,131,130,129,129,130,131,
-    132,133,132,131,129,127,125,123,121,120,120,119,119,118,116,115,
-    115,116,118,122,127,133,138,143,147,151,155,158,162,167,172,177,
-    181,185,188,190,191,193,194,196,198,200,202,203,204,203,202,200,
-    197,194,191,188,185,182,178,174,168,163,158,154,152,151,152,153,
-    153,152,152,151,150,148,146,145,145,146,145,144,142,140,138,135,
-    133,131,131,131,130,129,128,127,126,125,124,123,121,120,120,119,
-    118,116,114,113,112,113,116,121,127,133,139,144,147,150,153,156,
-    159,162,166,171,176,181,185,188,191,193,195,197,199,201,201,202,
-    202,200,198,196,194,191,189,186,183,181,178,175,171,167,163,159,
-    157,156,155,156,156,155,154,153,152,152,151,151,151,151,151,149,
-    147,144,141,137,134,132,131,130,130,130,129,128,127,125,123,122,
-    120,119,119,118,117,116,115,113,113,114,116,119,124,129,135,139,
-    144,148,152,156,160,164,168,173,177,181,185,187,188,189,191,192,
-    194,195,197,199,199,198,196,195,193,191,189,187,185,183,180,176,
-    171,167,163,160,158,158,159,159,159,159,158,157,157,157,156,156,
-    154,153,151,150,148,146,143,139,136,133,132,131,130,130,128,127,
-    124,122,119,117,116,115,115,115,114,113,113,113,113,115,118,121,
-    126,132,137,143,147,152,156,159,163,167,171,175,179,182,184,185,
-    186,186,187,188,189,191,193,195,195,196,195,193,191,189,186,184,
-    181,179,176,173,169,166,163,161,160,161,161,163,164,165,165,165,
-    163,162,160,159,158,156,155,153,151,147,143,140,137,134,132,131,
-    130,129,127,125,123,121,118,116,114,113,112,112,112,112,112,113,
-    114,116,119,123,128,134,140,145,150,153,157,160,163,166,170,173,
-    176,179,181,182,183,183,184,185,186,187,188,190,191,191,191,189,
-    187,184,181,179,177,175,173,171,169,166,164,163,163,164,165,166,
-    167,169,169,168,167,165,163,162,160,159,157,154,151,147,143,139,
-    136,133,131,129,128,127,125,124,122,120,118,115,113,112,111,110,
-    110,111,111,113,115,118,122,128,134,140,146,151,155,159,161,164,
-    166,168,170,172,174,176,177,178,178,179,180,181,182,184,186,187,
-    187,187,185,183,181,179,176,174,173,171,170,169,167,166,165,165,
-    166,167,169,170,172,172,172,172,170,168,166,163,161,158,156,153,
-    150,146,142,139,136,133,131,129,128,127,125,123,121,119,116,114,
-    112,111,110,110,111,112,114,116,119,122,125,130,136,142,148,152,
-    155,157,159,162,164,167,169,171,172,173,174,175,176,176,177,178,
-    179,180,181,182,183,183,182,181,179,177,175,173,171,170,169,168,
-    167,166,166,166,167,168,170,173,175,176,175,174,172,170,167,164,
-    161,158,155,151,148,144,140,137,134,131,129,128,127,126,124,123,
-    121,119,117,114,112,111,110,110,111,112,113,115,118,122,126,131,
-    137,143,148,153,157,160,163,164,166,167,167,168,169,170,170,171,
-    171,171,172,173,175,177,179,180,182,182,181,180,178,175,173,171,
-    170,169,169,168,168,167,168,169,171,173,174,176,178,178,177,175,
-    173,170,167,164,160,157,154,151,146,142,137,134,131,130,129,128,
-    127,126,125,123,121,118,115,113,111,111,111,111,113,116,119,121,
-    123,126,130,134,140,145,150,155,158,161,163,165,166,168,169,169,
-    170,171,173,174,174,174,174,175,175,175,176,177,177,177,176,176,
-    174,173,171,170,169,169,169,169,168,168,168,169,169,170,171,172,
-    173,174,174,174,172,171,168,166,162,159,155,152,148,144,140,136,
-    133,130,128,126,126,125,124,124,122,121,119,117,115,114,114,114,
-    115,116,118,121,124,128,132,137,142,147,152,157,161,164,167,169,
-    171,171,172,172,172,172,172,171,171,170,170,170,171,172,174,175,
-    177,177,178,177,176,174,172,170,168,166,166,165,165,166,166,167,
-    168,169,170,171,173,174,174,174,173,171,169,165,162,158,154,150,
-    146,142,138,134,130,127,125,124,124,124,124,123,122,120,119,118,
-    116,114,113,114,115,117,119,122,125,129,133,138,143,147,152,157,
-    161,165,168,171,172,173,174,174,174,174,174,173,173,173,173,173,
-    174,175,176,177,177,177,177,176,174,172,170,168,167,165,165,164,
-    164,164,164,165,165,166,167,168,169,170,170,170,169,168,166,164,
-    161,157,154,150,146,141,137,133,130,127,124,123,122,121,121,121,
-    121,120,119,118,117,116,115,115,116,118,120,122,125,129,133,138,
-    143,148,153,157,162,166,171,174,175,176,177,177,177,177,176,174,
-    172,171,171,171,171,171,172,173,175,177,178,177,176,175,173,171,
-    170,168,166,164,163,161,160,160,161,162,163,164,166,168,169,170,
-    169,168,167,164,161,157,153,149,145,140,135,131,127,124,122,120,
-    120,120,121,121,122,122,122,121,120,119,118,117,117,118,120,122,
-    125,129,133,138,144,149,154,160,165,169,173,175,177,178,179,179,
-    178,178,177,176,175,174,173,172,173,173,174,175,176,177,178,178,
-    177,175,173,170,167,165,163,161,160,159,158,158,159,160,161,162,
-    164,165,167,167,167,166,164,162,159,155,151,147,143,139,135,130,
-    127,124,122,121,120,120,120,121,122,123,123,123,122,122,121,120,
-    119,119,119,121,123,127,132,137,142,147,153,159,164,169,173,176,
-    180,182,183,183,182,181,180,178,177,176,174,173,173,173,174,176,
-    178,179,180,180,179,177,174,171,168,166,163,161,160,159,158,157,
-    157,157,159,160,161,163,163,164,164,163,161,159,157,153,149,145,
-    141,137,133,129,125,122,119,118,117,117,118,119,121,122,123,123,
-    123,124,123,121,122,123,125,125,125,127,131,134,139,145,153,160,
-    164,169,172,174,177,180,183,185,186,186,185,184,180,177,173,171,
-    169,169,169,173,175,179,180,182,181,180,177,174,169,167,166,162,
-    153,149,147,145,157,154,164,154,160,146,153,152,163,160,140,143,
-    115,173,185,161,136,145,172,155,139,146,153,124,78,67,107,154,
-    158,111,67,65,105,134,123,75,33,21,44,87,127,149,149,135,
-    125,126,141,162,177,181,175,164,157,164,184,210,226,224,204,181,
-    168,171,184,198,203,198,184,170,161,158,162,168,173,170,157,140,
-    135,150,177,201,210,204,190,176,166,159,156,156,160,167,174,178,
-    179,178,176,176,174,168,155,136,118,106,105,109,114,115,109,96,
-    82,70,66,68,73,78,77,69,59,54,65,88,113,129,136,135,
-    130,126,122,119,119,123,132,147,163,178,189,196,202,207,209,208,
-    201,193,185,182,184,188,191,191,186,180,174,171,171,173,174,170,
-    161,148,135,128,133,148,165,178,184,186,182,176,166,156,145,138,
-    137,141,150,160,166,169,169,167,162,155,144,132,122,116,115,113,
-    107,99,90,84,82,84,87,89,86,79,69,59,51,47,52,66,
-    85,102,116,126,131,133,130,124,118,116,120,130,143,158,172,183,
-    192,199,202,202,198,192,188,187,189,191,188,182,175,170,170,173,
-    178,180,178,170,159,148,139,132,133,142,156,169,177,182,182,177,
-    168,155,142,133,128,131,137,145,152,156,158,160,158,154,145,134,
-    124,119,117,115,109,99,89,83,81,83,88,92,92,86,78,70,
-    63,58,62,74,90,106,119,129,135,136,134,128,122,118,120,129,
-    141,154,166,176,184,192,197,198,195,189,185,184,187,189,188,182,
-    175,171,170,173,178,181,181,174,163,152,141,134,134,141,154,166,
-    175,181,182,178,170,159,147,138,133,134,139,146,151,154,156,157,
-    156,152,144,132,123,117,116,115,111,104,96,91,90,93,98,101,
-    101,95,85,75,67,61,62,73,89,106,119,130,138,141,139,135,
-    129,124,123,128,138,149,159,169,176,182,187,190,190,188,184,184,
-    187,189,188,182,175,170,170,174,181,186,185,177,165,152,141,133,
-    132,140,154,168,177,183,185,182,174,164,151,140,134,133,137,142,
-    146,148,150,151,152,149,144,135,127,122,121,120,116,108,99,93,
-    90,92,97,101,101,96,88,80,73,67,67,76,91,107,120,130,
-    137,140,139,135,129,123,122,127,136,147,156,164,171,179,185,188,
-    189,185,182,181,183,186,185,181,175,171,170,173,178,182,182,177,
-    168,157,148,139,136,141,152,164,173,178,180,179,173,164,153,142,
-    135,133,135,140,144,145,146,147,148,147,143,136,128,123,121,120,
-    116,108,100,93,90,92,97,102,103,100,93,85,78,73,73,81,
-    95,110,121,130,136,140,139,137,132,127,126,130,138,148,156,164,
-    170,176,182,186,187,184,180,179,180,183,183,180,174,170,169,173,
-    178,183,184,180,171,161,152,143,139,141,151,162,170,175,177,176,
-    172,165,156,146,139,137,140,143,146,147,147,148,149,147,142,134,
-    127,121,119,119,116,110,102,95,93,95,100,104,107,104,98,90,
-    84,78,76,81,93,106,117,125,132,136,137,136,132,129,128,133,
-    141,150,158,165,170,175,179,182,182,179,174,172,173,177,178,176,
-    171,168,168,173,180,186,188,185,176,165,155,145,139,140,148,158,
-    166,171,174,175,173,169,162,153,147,145,145,147,149,148,147,146,
-    147,146,142,135,128,122,120,120,119,114,107,101,98,100,105,109,
-    111,108,101,92,84,77,74,77,88,102,114,123,130,136,139,139,
-    136,132,131,134,139,147,154,159,163,168,173,177,178,176,173,171,
-    173,177,179,178,174,170,170,173,179,184,186,183,175,164,154,145,
-    139,139,147,157,164,169,172,173,171,167,161,153,148,146,147,149,
-    150,150,148,146,146,146,143,137,129,123,121,122,123,119,112,106,
-    103,104,109,113,116,113,106,97,88,82,77,79,89,102,114,123,
-    130,135,138,139,138,135,134,136,141,149,155,160,163,167,172,176,
-    177,175,172,171,172,176,178,177,173,169,167,170,177,182,185,182,
-    175,166,157,148,140,138,142,150,157,163,168,171,171,170,165,158,
-    152,149,149,151,152,152,151,150,150,150,147,141,133,127,123,124,
-    124,121,115,109,106,108,112,116,119,116,109,99,90,83,77,77,
-    85,96,107,116,124,130,135,137,137,136,135,137,141,148,154,158,
-    161,163,167,171,172,171,168,166,167,172,176,177,174,170,169,170,
-    175,181,184,182,176,166,156,147,139,136,140,148,155,160,164,167,
-    168,167,163,158,153,151,152,154,156,156,154,151,150,148,146,141,
-    135,128,125,125,125,123,118,112,108,108,112,117,119,118,112,103,
-    93,85,78,77,82,92,102,111,118,125,131,135,137,137,138,141,
-    147,153,159,162,164,165,167,170,172,171,168,166,166,169,174,176,
-    174,171,169,171,175,180,183,181,175,164,153,143,135,130,133,141,
-    149,155,160,164,166,166,165,162,158,156,157,159,160,160,157,154,
-    152,151,149,145,139,132,129,129,130,128,124,118,113,112,114,118,
-    120,119,114,104,93,84,76,73,76,86,98,108,115,122,128,134,
-    138,140,142,144,148,154,159,162,164,165,166,169,170,170,168,166,
-    166,169,174,176,174,170,166,166,169,173,176,176,171,162,152,142,
-    134,130,131,139,147,154,159,162,164,165,164,162,160,158,159,162,
-    165,166,164,161,158,157,156,152,146,138,132,130,130,129,125,119,
-    113,111,113,117,121,121,116,107,97,88,81,77,79,87,97,106,
-    114,120,127,132,136,138,141,144,150,157,163,167,168,168,169,170,
-    172,172,169,165,162,163,166,169,168,164,161,161,165,170,176,177,
-    173,164,152,142,133,127,126,132,140,147,151,156,160,163,164,164,
-    163,163,165,168,170,170,168,164,160,158,155,152,146,139,133,131,
-    131,130,127,122,116,114,115,119,124,125,121,113,102,92,83,78,
-    79,86,97,106,113,120,126,132,137,141,144,148,152,158,163,168,
-    170,169,168,168,169,169,167,162,159,158,160,163,163,160,157,155,
-    158,163,169,172,170,162,151,140,131,124,124,129,138,145,150,154,
-    157,160,162,163,163,165,167,171,174,176,174,170,166,163,160,158,
-    153,146,139,133,131,130,125,119,115,112,113,118,123,127,126,118,
-    108,97,86,78,76,82,92,103,112,121,127,132,136,140,143,147,
-    153,160,168,173,175,174,172,170,169,168,165,160,154,153,155,158,
-    159,157,154,153,156,160,167,170,170,161,151,142,131,124,123,127,
-    134,143,151,156,157,158,160,163,165,168,171,175,177,178,176,172,
-    166,160,154,150,145,140,136,132,129,128,127,124,119,116,117,120,
-    123,124,122,117,109,95,80,75,80,89,98,104,111,118,123,126,
-    131,139,144,149,154,158,161,161,160,160,159,161,164,168,168,164,
-    160,158,159,163,164,163,159,155,154,157,161,164,163,156,144,133,
-    124,119,120,127,139,150,157,161,163,163,163,162,162,162,162,164,
-    167,168,168,166,163,161,161,161,159,153,147,140,136,136,132,124,
-    115,108,106,110,115,121,124,120,111,100,92,88,88,94,104,114,
-    120,123,125,127,130,133,137,142,148,155,162,167,170,171,170,170,
-    170,171,170,167,164,162,161,161,161,157,151,146,145,148,155,162,
-    165,163,155,146,138,133,131,135,143,150,154,156,156,156,157,158,
-    159,160,162,165,169,172,172,170,167,164,161,159,157,152,146,139,
-    134,132,129,123,116,108,105,107,113,119,122,120,112,103,96,91,
-    91,97,106,115,121,124,126,128,130,133,136,139,144,151,158,165,
-    170,172,172,172,173,174,175,172,168,164,161,160,158,154,149,144,
-    142,145,152,159,164,163,156,148,140,134,133,136,143,151,155,156,
-    156,155,154,154,156,157,159,163,167,170,171,170,167,164,162,161,
-    159,154,148,142,137,133,129,123,115,108,104,105,110,117,121,120,
-    113,104,96,92,93,99,109,119,126,130,131,131,132,134,138,141,
-    146,153,160,166,170,172,172,172,172,173,174,173,170,167,164,163,
-    162,158,153,147,144,145,151,157,161,159,153,144,136,131,131,136,
-    145,153,157,158,156,154,152,151,151,153,156,160,164,167,169,167,
-    164,162,161,160,159,156,151,145,140,137,134,128,119,111,106,106,
-    110,116,120,118,112,104,97,94,95,102,112,123,130,132,134,134,
-    135,136,137,141,146,152,158,164,168,168,167,166,167,168,170,170,
-    170,169,169,169,168,163,155,147,143,143,147,153,156,155,148,139,
-    132,129,131,138,147,157,161,163,162,159,157,154,154,154,157,159,
-    162,164,163,160,157,157,156,156,156,155,151,149,147,145,140,131,
-    121,114,112,112,114,116,117,115,110,103,97,93,96,104,116,128,
-    135,139,140,139,138,137,139,143,148,153,158,162,164,163,163,163,
-    166,170,174,175,174,172,172,172,171,167,159,151,145,144,147,152,
-    154,150,141,131,124,121,126,136,149,161,167,168,165,161,157,154,
-    153,153,154,156,158,159,158,157,155,154,156,158,159,158,154,151,
-    149,147,143,136,126,116,110,111,115,119,121,117,108,98,91,89,
-    96,108,121,134,141,144,142,139,138,139,140,143,148,153,157,160,
-    162,161,160,162,165,170,173,175,176,176,176,175,171,165,157,150,
-    147,149,155,161,162,155,144,133,124,121,125,135,147,158,163,163,
-    159,155,153,152,153,154,156,158,160,160,158,155,151,149,149,150,
-    149,148,146,145,145,145,142,135,127,120,118,120,125,129,128,121,
-    109,98,90,89,97,111,126,137,143,144,143,143,143,146,149,152,
-    156,160,163,164,163,161,159,160,164,168,172,174,175,176,178,178,
-    175,169,161,155,154,157,161,164,162,153,140,128,120,119,126,138,
-    150,159,161,159,155,152,151,151,153,155,157,158,157,155,150,145,
-    141,140,142,145,147,148,148,148,149,147,142,134,126,121,121,125,
-    130,132,128,119,106,96,90,93,103,119,133,143,146,145,143,142,
-    144,147,151,156,160,162,163,162,159,156,156,158,163,168,172,175,
-    177,179,180,178,174,167,160,157,158,162,166,166,160,148,135,124,
-    118,120,128,141,153,159,159,155,151,148,147,148,150,152,154,155,
-    153,149,144,140,138,139,143,147,149,150,150,150,150,147,141,133,
-    127,125,127,133,138,138,133,121,109,100,96,100,111,125,137,144,
-    145,143,140,139,141,145,151,157,161,163,163,159,155,151,150,153,
-    158,163,167,172,175,179,179,177,173,166,162,160,163,168,172,169,
-    162,150,136,125,120,125,137,149,158,162,159,152,145,142,142,145,
-    150,156,159,160,155,148,139,132,129,130,135,138,142,146,149,151,
-    151,147,140,132,127,127,132,137,141,140,132,121,110,103,100,105,
-    117,132,144,149,147,142,139,139,143,148,153,159,163,165,162,157,
-    152,148,148,151,156,161,165,170,174,178,180,177,172,165,162,162,
-    167,173,176,172,161,147,134,126,125,131,141,151,157,158,154,149,
-    144,141,141,143,146,150,152,151,147,140,132,127,125,126,131,135,
-    139,142,145,146,146,142,137,131,129,131,136,143,146,143,135,123,
-    112,106,106,115,127,139,148,150,149,144,141,140,142,147,153,159,
-    163,164,161,155,149,146,145,149,156,162,168,172,175,177,177,173,
-    168,164,162,164,169,174,175,170,160,148,136,129,129,136,146,156,
-    160,159,154,147,140,137,138,141,146,151,153,152,147,139,130,124,
-    122,123,127,132,137,140,144,146,145,142,137,133,131,133,138,144,
-    147,144,135,124,114,108,110,118,131,143,150,151,148,144,141,140,
-    143,148,155,161,165,166,162,155,149,144,144,147,153,159,165,170,
-    174,176,177,174,170,165,163,164,169,174,176,172,162,149,138,130,
-    130,137,148,158,162,161,156,148,141,137,137,141,145,150,152,151,
-    146,137,129,123,121,123,128,133,138,142,145,147,147,144,139,134,
-    132,134,139,144,147,144,136,125,116,111,113,122,135,147,154,155,
-    151,145,139,137,137,141,148,155,160,162,160,154,148,144,144,147,
-    154,160,165,170,174,176,175,172,167,162,160,162,167,173,176,173,
-    164,152,141,134,134,140,150,160,165,164,158,149,141,135,133,136,
-    142,147,151,152,148,140,131,125,124,127,132,136,139,141,142,143,
-    143,140,136,132,131,133,139,145,148,147,140,129,120,114,115,122,
-    133,145,153,155,151,144,137,133,132,136,143,150,155,158,156,151,
-    145,141,141,145,151,158,164,168,170,172,172,170,166,162,160,162,
-    167,172,175,173,167,156,146,139,137,143,152,162,168,168,161,151,
-    142,135,132,134,139,144,149,151,149,144,135,127,124,126,130,134,
-    137,140,142,143,142,138,134,129,128,130,136,143,148,149,144,135,
-    125,116,114,118,128,140,150,154,152,146,138,133,131,134,139,146,
-    152,158,160,156,150,145,144,146,151,157,163,167,170,172,173,171,
-    166,163,161,162,166,172,174,172,168,163,155,146,140,141,148,158,
-    166,168,164,155,143,132,126,127,133,141,148,151,149,143,135,128,
-    125,125,129,134,138,140,141,142,142,141,139,135,132,131,134,140,
-    146,149,147,141,132,124,120,121,129,140,149,154,153,147,139,133,
-    129,132,137,145,152,157,158,157,151,147,143,142,149,159,163,170,
-    167,163,154,156,177,165,182,180,162,163,153,149,148,153,159,153,
-    133,105,93,114,154,191,203,190,154,112,91,104,145,194,224,222,
-    188,134,78,42,41,75,125,167,182,167,132,95,72,69,80,99,
-    118,134,146,154,162,171,180,188,192,189,181,169,161,154,148,139,
-    127,113,101,92,86,83,81,83,87,95,105,115,123,130,136,142,
-    151,161,169,172,169,163,154,145,137,135,141,153,166,179,191,198,
-    200,198,193,187,177,167,158,154,151,148,142,134,127,120,116,114,
-    114,116,121,128,136,143,146,145,141,137,136,139,144,149,148,142,
-    132,121,114,114,122,134,149,164,176,185,188,185,176,162,146,131,
-    118,109,105,104,105,105,103,99,95,92,92,96,104,116,129,141,
-    150,153,152,149,147,148,153,157,157,152,142,133,128,130,138,150,
-    165,179,191,201,207,209,206,197,185,171,156,142,133,129,130,131,
-    131,128,121,114,109,107,110,118,130,142,152,156,156,153,148,145,
-    146,148,148,144,136,127,121,121,127,137,149,159,168,174,178,177,
-    173,166,155,142,127,112,101,96,96,100,104,106,104,100,94,91,
-    93,100,111,125,140,150,155,154,150,148,148,150,152,152,147,141,
-    135,135,141,152,166,179,189,197,202,204,202,198,189,178,163,145,
-    129,119,116,120,126,131,132,127,119,111,106,107,116,129,144,156,
-    164,165,161,155,149,146,144,141,137,130,123,122,128,139,151,162,
-    171,176,176,175,173,168,160,148,134,117,99,86,82,87,97,107,
-    113,112,105,96,89,87,93,105,122,138,152,161,163,160,155,149,
-    145,143,141,140,138,139,144,155,167,179,189,194,196,195,192,189,
-    186,180,169,152,134,119,111,111,118,126,133,136,132,124,115,109,
-    108,115,127,142,158,170,175,172,164,156,149,142,136,131,127,127,
-    133,142,153,163,170,173,173,170,167,162,158,151,142,129,113,98,
-    87,84,89,100,110,116,115,108,99,93,92,97,110,126,143,158,
-    167,170,166,159,151,144,138,135,134,137,145,156,169,181,188,192,
-    191,188,184,181,178,175,170,160,146,129,115,108,110,118,129,137,
-    138,133,123,114,108,109,117,131,147,163,175,180,177,168,157,145,
-    134,127,124,127,134,145,157,167,173,173,170,164,159,155,152,149,
-    145,136,123,107,93,84,84,92,103,114,118,116,107,98,91,91,
-    98,112,131,151,167,176,178,172,161,148,136,129,127,131,141,154,
-    169,181,189,192,191,185,178,172,169,168,167,161,150,136,121,110,
-    108,114,124,133,139,138,132,122,114,111,115,125,139,156,173,184,
-    188,182,169,152,136,124,119,122,131,144,158,170,177,178,174,166,
-    157,150,145,142,141,136,128,116,103,90,84,86,94,105,114,118,
-    114,107,98,93,94,103,118,137,156,170,178,176,167,153,139,127,
-    122,124,133,148,164,180,191,195,193,186,177,169,164,163,163,161,
-    156,146,133,121,113,114,121,132,141,145,142,133,124,116,113,118,
-    130,146,164,179,187,186,177,161,143,128,119,119,125,138,154,169,
-    180,183,179,169,156,145,138,136,136,135,130,121,108,96,87,85,
-    92,103,114,120,120,113,104,95,92,95,107,124,144,163,176,179,
-    174,161,144,129,119,118,126,141,160,179,194,200,198,189,176,165,
-    158,156,157,158,156,149,139,128,120,117,122,131,141,148,148,142,
-    133,123,117,117,125,139,157,174,186,190,184,170,153,136,124,120,
-    125,137,154,170,182,187,183,172,156,141,131,126,128,130,129,123,
-    114,104,95,91,94,102,112,117,118,114,105,96,89,90,99,114,
-    134,155,171,179,178,167,151,134,122,118,124,137,157,177,194,202,
-    201,192,179,165,155,150,151,154,156,154,149,141,133,128,129,136,
-    143,150,148,140,130,119,113,113,120,133,150,167,182,189,187,176,
-    158,138,123,118,123,135,150,167,183,193,193,181,162,144,131,126,
-    125,127,128,124,117,109,101,98,100,106,114,120,121,116,107,97,
-    92,94,102,116,133,152,168,177,177,168,154,138,127,122,127,141,
-    161,181,198,206,205,194,179,163,150,144,143,146,148,147,143,136,
-    130,128,132,138,146,151,149,143,132,122,114,112,117,129,146,163,
-    178,187,187,179,165,149,136,128,129,139,154,170,184,192,190,181,
-    165,148,134,125,123,124,124,122,118,112,107,107,111,116,122,125,
-    122,115,104,94,87,87,95,109,128,148,164,173,175,168,157,143,
-    131,125,127,137,153,172,189,200,202,194,181,166,153,146,145,146,
-    146,144,139,135,133,135,140,145,150,150,146,137,126,115,108,109,
-    118,133,151,168,180,186,184,176,163,149,138,130,130,139,153,170,
-    184,192,191,183,169,154,141,132,128,126,123,118,112,107,105,109,
-    116,124,130,130,123,112,99,89,84,86,97,113,131,149,162,169,
-    168,162,152,140,131,126,129,140,155,173,188,197,198,192,182,170,
-    160,153,149,146,142,136,131,127,129,136,146,156,161,159,150,137,
-    124,113,108,110,120,134,151,167,177,181,179,171,161,149,139,133,
-    134,142,155,170,183,190,190,182,171,159,148,140,133,126,118,110,
-    103,100,105,115,126,136,139,134,123,108,94,84,82,86,98,114,
-    132,147,158,163,163,158,151,143,137,134,137,145,159,174,187,195,
-    196,192,185,177,170,162,154,145,136,128,123,124,132,144,157,166,
-    167,159,146,130,115,106,103,107,118,132,148,161,169,172,170,165,
-    157,148,140,135,136,143,153,165,174,179,180,177,172,165,157,149,
-    138,126,113,103,99,103,114,128,140,146,145,135,121,105,93,86,
-    87,94,107,122,136,148,156,160,161,159,155,148,142,139,141,148,
-    157,169,179,187,191,193,194,192,186,174,160,145,130,120,118,126,
-    139,154,165,171,166,153,137,122,111,106,108,115,126,135,144,150,
-    155,158,158,159,154,149,142,139,139,142,147,153,161,168,176,181,
-    183,182,173,157,139,122,109,102,103,111,124,138,148,150,143,132,
-    118,106,98,95,98,104,112,120,128,136,143,149,153,156,158,157,
-    153,149,148,150,154,159,166,177,189,200,206,204,194,178,159,141,
-    127,123,127,138,151,161,164,161,154,143,132,122,116,113,114,117,
-    121,125,129,134,140,146,152,155,155,153,148,142,137,134,134,139,
-    149,165,181,193,199,196,183,162,138,118,107,106,113,124,136,143,
-    146,143,137,129,120,113,107,104,102,103,104,107,113,122,132,144,
-    153,160,163,163,160,154,148,141,140,146,158,176,196,211,218,212,
-    197,174,152,136,130,132,140,147,151,153,154,154,152,147,142,136,
-    127,121,113,109,103,107,107,118,126,140,147,149,153,146,162,155,
-    141,128,130,144,154,170,195,212,208,189,172,163,156,139,114,98,
-    101,118,131,129,115,102,97,105,117,126,126,117,102,91,87,92,
-    103,118,132,143,151,159,167,173,174,168,156,142,135,140,159,187,
-    213,229,230,218,197,175,158,147,142,142,143,141,138,139,147,157,
-    166,169,165,155,143,131,118,108,101,100,106,116,130,144,157,167,
-    172,170,160,143,124,111,108,118,138,162,182,193,193,182,165,148,
-    134,124,118,113,108,103,102,106,117,128,138,142,142,137,128,116,
-    102,89,82,83,91,106,124,144,161,175,182,182,173,159,144,134,
-    136,147,167,188,206,218,220,214,203,190,178,168,158,148,139,131,
-    128,131,138,149,159,165,167,163,153,137,119,101,88,84,89,101,
-    119,137,153,165,171,167,155,138,121,111,111,122,139,157,171,181,
-    184,183,177,167,156,143,131,120,111,104,100,102,110,123,138,149,
-    154,152,141,124,105,89,78,75,83,99,119,140,159,175,182,181,
-    171,156,144,137,138,149,165,183,197,208,212,211,206,200,191,179,
-    166,153,140,130,124,126,135,148,162,171,175,171,158,140,118,100,
-    85,80,84,96,114,133,150,163,170,167,156,141,127,118,119,129,
-    144,158,169,178,182,181,178,174,167,157,144,131,118,109,104,106,
-    116,130,142,151,155,152,141,125,108,91,79,75,80,93,113,133,
-    152,165,173,173,166,155,144,137,139,148,162,177,191,203,209,209,
-    208,206,200,190,177,162,147,135,129,129,137,151,164,174,179,176,
-    165,146,125,105,91,85,86,96,110,128,144,158,165,164,155,141,
-    126,117,115,123,136,150,163,172,178,180,180,178,172,163,150,135,
-    120,108,101,102,111,126,140,151,157,155,145,129,110,93,80,75,
-    79,90,106,126,145,160,170,172,166,154,143,137,139,148,162,177,
-    190,200,206,209,210,209,203,194,181,167,152,141,136,137,144,156,
-    169,178,181,178,169,153,132,111,93,83,82,90,106,125,141,153,
-    158,155,147,134,123,117,117,124,135,146,157,165,170,175,177,177,
-    173,166,154,139,123,111,104,105,113,127,141,152,157,155,148,133,
-    115,96,81,74,78,90,108,128,147,161,171,173,169,159,148,138,
-    136,142,154,169,185,196,202,205,206,204,200,193,184,173,160,148,
-    140,139,144,154,165,173,178,177,169,154,135,115,98,88,86,92,
-    105,120,135,146,153,154,147,136,123,114,111,115,126,141,155,166,
-    172,174,173,169,164,157,149,140,130,122,117,116,121,130,141,150,
-    155,156,151,139,122,105,90,82,83,92,107,124,141,154,163,166,
-    162,154,144,136,134,139,151,167,184,196,204,207,205,200,193,185,
-    177,168,161,155,151,150,153,159,166,172,175,174,167,155,139,120,
-    103,93,91,96,107,121,135,145,151,151,145,137,125,116,112,116,
-    126,141,157,168,175,175,171,164,156,147,139,132,128,126,126,129,
-    133,138,143,147,150,150,146,137,123,108,95,87,88,96,110,125,
-    140,152,160,163,160,154,146,140,138,142,152,167,183,195,203,206,
-    202,195,185,176,168,161,158,157,158,161,165,168,170,169,168,165,
-    159,150,138,123,110,100,98,102,111,123,134,144,149,149,144,137,
-    128,120,116,119,128,140,152,163,170,173,170,161,149,137,127,120,
-    118,122,129,136,142,147,150,149,145,140,135,128,119,110,102,97,
-    97,103,115,128,141,151,159,162,160,155,148,142,139,143,153,167,
-    180,190,198,203,202,196,185,171,158,149,145,147,155,167,176,181,
-    181,175,166,157,148,141,133,124,115,107,105,108,117,128,140,147,
-    152,152,148,140,133,128,125,126,131,140,151,160,167,172,171,165,
-    152,137,121,111,109,113,122,135,147,157,161,158,150,139,129,120,
-    112,106,103,103,106,112,121,131,142,151,158,161,161,157,151,147,
-    145,149,157,168,179,188,193,197,197,192,184,172,159,147,140,141,
-    148,160,174,186,192,189,180,164,148,134,122,116,113,115,119,124,
-    131,138,144,148,152,153,150,145,138,132,129,130,136,144,152,157,
-    161,163,163,159,152,142,129,117,107,106,112,124,139,154,163,163,
-    158,147,133,118,106,100,98,103,111,123,133,140,145,149,154,158,
-    159,157,153,149,147,150,158,168,177,183,187,190,191,188,182,174,
-    165,156,149,144,142,147,157,171,184,191,188,176,159,139,121,110,
-    106,110,118,129,140,148,154,155,153,151,149,147,142,136,134,134,
-    138,144,151,157,159,159,155,150,145,139,132,124,118,114,113,116,
-    124,135,147,156,158,153,141,126,109,96,90,93,102,117,134,148,
-    156,160,159,156,154,153,151,149,149,151,157,164,172,179,183,186,
-    186,183,177,170,163,156,151,149,149,150,154,162,171,178,181,179,
-    169,155,139,124,114,111,116,126,140,153,162,164,161,156,150,144,
-    140,137,136,138,143,148,153,156,157,157,155,151,144,137,129,122,
-    117,114,114,115,119,125,133,141,147,148,143,132,119,106,97,94,
-    98,110,124,140,153,161,162,159,155,151,147,147,149,154,162,169,
-    175,179,180,181,180,178,174,169,164,159,155,153,153,153,154,158,
-    164,170,174,175,172,163,150,137,125,117,115,119,130,144,157,165,
-    166,163,157,151,144,140,138,139,144,150,155,157,156,154,150,145,
-    140,133,128,122,119,117,117,117,119,122,127,133,137,139,138,134,
-    125,115,106,100,99,103,115,130,144,156,162,165,163,158,153,148,
-    148,151,157,166,174,180,181,181,180,177,172,165,161,157,156,156,
-    157,158,157,158,161,166,170,171,169,164,156,146,137,129,124,122,
-    128,139,152,162,168,168,164,158,151,144,139,137,139,144,150,154,
-    155,154,150,144,138,132,125,120,117,115,115,115,117,118,122,127,
-    132,135,135,133,129,121,113,106,103,104,110,122,136,149,159,164,
-    165,162,157,151,147,147,152,160,169,176,180,181,179,176,171,166,
-    162,158,156,156,157,159,161,163,165,168,171,173,172,169,164,155,
-    145,136,129,125,127,134,144,154,161,165,165,160,153,145,137,134,
-    134,138,144,149,151,150,146,141,136,130,123,117,114,113,113,116,
-    118,121,124,127,131,136,139,140,136,129,120,111,106,106,110,121,
-    135,148,158,164,167,166,163,159,154,150,150,156,163,171,176,180,
-    180,176,169,162,158,154,154,154,157,159,161,161,163,165,169,173,
-    176,176,173,167,158,148,137,130,127,131,139,149,155,161,161,159,
-    151,145,137,134,131,137,141,149,148,150,145,146,137,131,112,116,
-    136,98,124,113,129,114,96,139,129,116,147,172,141,124,132,137,
-    113,103,112,129,144,161,173,172,162,150,140,138,144,155,166,170,
-    168,157,142,130,126,129,136,144,154,160,165,170,175,177,177,175,
-    170,163,158,158,163,172,182,191,194,188,176,160,145,134,129,130,
-    136,143,148,151,151,148,142,136,130,127,126,125,125,124,124,124,
-    126,127,128,128,125,121,117,114,112,111,113,117,125,135,146,158,
-    168,173,172,162,148,131,117,109,107,112,121,130,137,141,142,142,
-    141,138,137,137,136,133,127,120,115,116,122,132,143,153,159,162,
-    163,164,165,168,172,175,178,180,179,176,173,169,164,160,155,151,
-    149,150,154,158,160,157,150,140,130,122,116,116,120,128,139,147,
-    152,151,146,138,127,116,106,99,95,95,97,104,113,122,131,140,
-    151,158,162,163,161,156,147,135,125,120,120,125,134,143,149,152,
-    150,144,136,127,120,115,114,118,126,134,141,147,151,154,159,166,
-    174,182,185,182,173,162,149,138,133,136,147,161,178,193,206,212,
-    210,202,189,174,159,148,140,136,132,129,126,126,128,131,135,139,
-    143,146,148,147,144,138,130,121,113,108,108,112,116,118,119,118,
-    117,117,119,126,135,146,156,166,172,172,168,161,153,144,137,133,
-    132,133,134,133,131,129,128,128,128,130,133,138,141,141,140,139,
-    139,138,140,147,158,169,175,175,169,159,148,138,135,140,152,166,
-    181,193,199,200,197,192,184,176,170,165,160,155,148,140,132,127,
-    125,126,129,133,139,144,148,149,147,141,133,124,116,111,110,112,
-    113,114,114,113,112,112,117,126,137,148,157,162,164,163,159,155,
-    152,152,153,154,153,149,142,135,127,123,121,122,124,128,133,138,
-    143,145,144,141,139,139,143,153,165,176,182,181,174,163,150,139,
-    136,138,144,155,168,181,191,197,199,198,195,191,185,178,169,158,
-    146,134,123,118,118,123,131,139,145,148,149,147,142,136,127,121,
-    118,119,120,121,120,117,112,108,108,112,120,129,139,147,151,152,
-    151,150,151,155,162,169,172,170,163,154,142,130,121,116,116,120,
-    126,134,141,147,150,149,142,135,130,132,140,153,167,178,181,176,
-    166,154,145,140,140,145,151,156,160,165,170,176,184,192,199,203,
-    202,195,183,167,149,132,121,116,118,125,134,142,149,151,150,144,
-    137,129,124,121,122,125,126,124,119,113,110,110,114,122,132,140,
-    144,143,140,137,137,140,148,158,169,178,182,180,172,160,146,133,
-    122,117,118,124,130,137,140,143,143,141,137,134,135,141,149,158,
-    167,173,175,173,168,161,156,153,150,147,144,143,144,148,154,164,
-    175,187,197,204,205,200,188,171,152,135,124,120,122,127,133,139,
-    143,143,141,137,132,129,127,127,128,128,127,123,120,117,117,119,
-    125,131,136,138,135,129,123,121,125,133,145,158,171,181,187,185,
-    177,165,151,139,130,125,124,126,129,131,133,136,139,140,140,140,
-    142,147,153,159,166,171,175,176,173,169,164,158,153,148,141,135,
-    133,136,144,156,170,183,194,201,202,197,187,172,157,144,135,130,
-    128,127,128,130,132,135,137,137,136,133,129,127,125,123,121,120,
-    119,120,123,128,132,135,137,137,134,129,124,121,123,129,139,151,
-    162,171,176,177,175,169,160,151,141,131,124,121,121,124,129,135,
-    141,145,145,144,145,147,151,157,164,172,178,183,184,181,174,165,
-    155,145,137,132,131,134,142,151,161,171,183,193,197,195,188,177,
-    165,154,143,134,128,125,125,128,134,139,143,142,138,133,129,125,
-    122,122,123,125,127,130,132,134,136,136,135,133,129,126,122,121,
-    122,126,133,141,151,162,172,177,177,172,164,154,142,132,125,120,
-    118,120,126,135,144,150,150,147,145,144,148,156,165,175,183,189,
-    189,184,177,167,158,148,140,135,133,135,139,146,154,163,173,181,
-    188,190,189,183,172,161,148,135,127,122,123,127,133,140,145,145,
-    140,132,125,120,120,124,129,134,135,134,132,131,131,134,136,137,
-    137,135,130,125,123,124,130,139,151,162,171,177,178,175,168,156,
-    142,129,118,113,113,117,124,132,139,145,147,146,145,146,152,160,
-    168,176,186,193,194,189,180,169,158,149,141,136,135,136,139,144,
-    150,158,168,177,183,187,186,180,169,157,145,134,126,121,120,123,
-    130,137,142,144,142,137,132,127,125,126,127,130,134,136,138,138,
-    139,139,138,137,135,132,130,128,128,130,134,139,147,155,163,169,
-    170,167,161,152,141,130,120,114,114,118,125,134,142,148,151,150,
-    148,149,152,159,166,174,183,190,191,189,182,174,164,153,144,137,
-    135,136,140,146,152,159,167,175,180,182,179,173,164,154,144,136,
-    131,128,128,130,135,139,141,142,139,137,134,131,129,127,128,129,
-    132,135,137,139,140,141,141,140,138,135,132,130,131,134,137,142,
-    146,152,158,162,164,162,158,151,141,132,123,118,117,120,125,133,
-    141,148,153,154,153,154,157,162,167,172,179,185,187,185,180,174,
-    166,157,147,139,135,137,141,148,156,164,170,174,175,173,169,163,
-    156,148,141,135,130,127,126,128,134,140,145,147,145,142,138,133,
-    129,126,125,124,126,127,130,133,137,140,142,142,140,137,133,132,
-    133,136,142,146,151,154,157,157,157,156,152,145,139,134,128,123,
-    119,119,125,134,144,154,161,163,160,158,158,161,165,169,175,180,
-    184,186,184,179,171,161,152,143,139,139,142,149,156,163,168,170,
-    170,166,161,156,150,143,138,134,130,128,128,130,135,141,147,150,
-    151,150,145,137,129,124,120,118,118,120,124,130,136,141,144,144,
-    141,137,134,132,133,137,142,148,152,155,156,156,154,150,147,143,
-    138,133,127,123,121,124,130,138,148,158,166,170,168,165,161,159,
-    158,159,162,168,174,179,181,181,178,170,160,150,141,138,139,144,
-    152,160,165,168,167,162,156,149,142,138,133,130,128,128,130,134,
-    139,146,151,155,156,155,152,146,138,128,118,112,108,108,112,122,
-    133,143,149,150,147,142,140,139,139,142,145,151,155,159,160,158,
-    154,149,144,139,136,131,126,122,121,125,133,143,153,162,170,173,
-    172,168,164,159,154,152,152,157,164,173,179,183,183,178,169,158,
-    147,139,136,138,144,152,161,166,166,162,154,145,138,132,129,126,
-    128,132,138,144,150,158,164,166,166,163,155,146,135,126,115,105,
-    102,105,110,119,133,146,155,159,159,155,148,140,135,134,136,141,
-    148,154,158,159,157,151,144,136,128,125,124,125,130,134,140,144,
-    155,166,169,176,174,165,158,147,143,142,145,157,160,165,169,173,
-    176,177,180,173,155,136,126,130,142,157,173,186,192,183,160,129,
-    108,105,116,133,147,151,148,143,140,143,150,157,162,161,155,147,
-    138,129,122,119,118,119,123,128,137,148,157,162,160,153,141,128,
-    118,115,117,124,133,142,149,151,152,151,150,146,139,131,126,125,
-    128,133,140,147,155,162,169,170,167,160,153,149,147,147,149,155,
-    165,175,184,191,193,190,181,168,155,142,134,132,134,141,150,159,
-    167,171,170,164,156,144,132,125,122,125,132,142,153,163,170,174,
-    174,170,160,148,136,124,115,108,105,107,114,123,132,141,148,152,
-    153,149,142,133,125,120,120,124,131,139,148,158,164,166,162,154,
-    144,134,128,123,123,125,130,138,146,155,164,170,170,166,161,156,
-    152,149,153,162,172,181,185,187,186,181,173,165,157,148,140,137,
-    137,139,142,147,154,161,165,165,159,151,141,134,130,132,138,145,
-    153,160,166,171,174,172,165,155,140,125,113,106,106,111,119,128,
-    136,142,144,143,143,142,140,137,132,128,125,124,127,133,142,151,
-    157,159,158,155,150,143,137,133,131,131,132,136,142,150,158,166,
-    170,169,164,157,151,148,150,158,169,180,186,187,181,172,163,154,
-    146,141,139,138,139,141,144,149,153,157,160,161,160,158,153,147,
-    141,139,142,148,155,162,168,173,174,171,166,157,146,133,122,113,
-    110,113,120,130,140,146,147,142,135,130,128,128,129,130,130,131,
-    132,134,140,146,153,158,159,157,152,143,135,130,129,132,135,138,
-    142,147,153,160,165,165,164,159,155,153,154,160,170,180,188,189,
-    180,166,151,141,136,135,138,141,144,146,148,150,152,154,156,157,
-    157,155,152,147,144,142,145,152,159,166,171,173,173,169,163,156,
-    146,136,125,117,114,115,120,128,140,146,147,143,136,128,123,123,
-    124,126,129,133,136,137,140,145,150,153,155,154,152,148,142,137,
-    134,134,135,137,141,146,152,159,162,161,159,157,155,153,153,157,
-    164,173,181,184,180,171,158,145,134,128,127,131,137,143,149,153,
-    156,157,155,153,151,150,149,148,147,148,152,156,161,167,171,173,
-    173,169,164,156,146,137,128,122,119,120,125,132,141,147,149,145,
-    138,129,122,118,117,120,125,131,137,143,147,151,154,155,155,153,
-    151,148,144,140,137,136,136,137,140,143,148,153,157,157,158,157,
-    157,157,159,161,166,172,178,180,176,167,155,141,129,124,126,132,
-    140,147,152,154,154,153,152,150,149,148,147,146,147,150,154,158,
-    163,168,171,172,171,167,162,156,149,143,137,133,131,130,132,137,
-    142,145,145,141,133,124,117,112,113,118,124,132,139,144,148,151,
-    153,153,152,150,148,146,144,141,139,138,139,140,142,144,147,149,
-    150,152,155,159,162,165,167,169,171,174,175,174,168,160,148,136,
-    126,120,120,126,136,146,153,158,160,159,156,152,148,146,145,145,
-    147,152,157,164,170,174,175,174,171,167,161,155,150,146,143,140,
-    138,135,134,135,139,142,143,140,133,124,117,112,113,117,122,130,
-    138,145,150,153,154,153,152,150,147,143,139,136,135,135,137,139,
-    141,143,144,146,148,154,161,167,171,174,173,172,171,170,170,169,
-    165,157,146,135,126,120,120,126,136,146,155,160,162,160,156,151,
-    147,143,142,143,147,152,159,165,170,172,173,170,166,161,156,153,
-    151,149,147,145,142,139,137,138,140,143,143,140,133,126,118,113,
-    112,115,122,130,138,146,152,155,155,153,150,148,145,143,141,140,
-    141,141,140,139,138,137,139,142,146,153,161,168,174,176,176,174,
-    173,171,169,165,160,151,141,132,125,123,125,130,137,144,150,156,
-    159,159,153,146,140,138,140,144,151,158,165,170,172,172,171,168,
-    163,158,155,153,153,153,152,151,150,148,145,145,145,144,141,136,
-    129,122,116,111,112,116,124,132,141,147,152,154,155,155,152,150,
-    148,144,141,140,139,138,137,137,134,132,132,136,140,148,157,166,
-    174,178,181,182,178,173,168,163,157,150,141,132,125,122,124,130,
-    139,148,155,159,158,153,148,143,140,140,143,147,152,158,162,166,
-    168,169,167,163,158,154,151,150,150,152,154,156,156,155,152,150,
-    149,148,145,140,132,125,119,116,116,121,129,137,143,147,149,148,
-    146,144,143,144,145,146,144,142,140,138,135,133,133,134,135,137,
-    142,149,157,166,174,179,183,184,182,178,172,165,158,149,140,131,
-    126,126,130,136,143,149,151,151,148,143,138,136,138,142,146,151,
-    156,160,164,166,167,167,165,163,159,153,147,142,141,144,149,154,
-    157,158,157,155,153,151,147,142,136,130,125,122,123,129,136,143,
-    147,149,148,147,145,144,143,144,146,146,144,141,138,135,132,130,
-    130,132,134,136,140,145,153,162,169,175,180,183,184,181,175,168,
-    161,152,143,135,129,129,133,140,146,151,152,151,147,142,138,135,
-    135,137,140,144,150,154,158,160,162,163,162,160,157,154,150,148,
-    144,144,144,147,151,155,158,159,159,156,153,148,141,135,130,128,
-    130,134,140,145,146,144,140,139,139,142,145,148,148,147,144,140,
-    138,136,134,133,133,134,136,139,143,149,155,160,165,169,174,178,
-    181,181,179,173,166,158,148,141,137,138,142,148,151,153,151,147,
-    141,137,135,134,133,134,136,139,142,145,150,153,155,159,161,160,
-    158,154,152,149,146,144,144,148,152,155,158,159,161,161,159,155,
-    150,145,141,139,139,140,140,140,140,139,138,138,140,142,144,146,
-    147,146,143,138,135,133,133,133,134,136,137,139,141,145,151,157,
-    162,168,174,180,183,184,181,176,168,160,152,146,144,144,146,148,
-    148,146,143,141,137,136,134,133,133,134,134,135,137,140,146,153,
-    157,160,161,159,156,154,153,151,149,146,144,145,147,153,158,163,
-    165,164,161,157,151,146,143,141,141,142,144,142,138,134,132,134,
-    138,143,147,149,148,143,137,131,129,130,131,132,134,137,139,141,
-    141,143,147,153,160,166,173,181,185,185,181,175,169,163,157,155,
-    153,151,150,148,149,147,145,144,141,140,139,138,136,133,132,131,
-    131,135,140,145,150,156,160,162,161,157,152,147,142,140,140,145,
-    152,158,162,163,161,159,158,157,158,158,156,153,148,143,138,135,
-    134,134,136,138,142,145,145,145,144,142,139,135,132,130,131,132,
-    135,138,140,140,140,142,147,155,163,172,179,184,185,183,178,172,
-    168,166,165,164,161,157,149,145,147,142,132,139,150,147,133,129,
-    138,139,138,123,120,121,129,140,145,147,153,170,170,165,157,153,
-    147,141,141,147,153,156,158,163,172,177,173,161,150,143,140,136,
-    127,119,115,118,129,145,159,170,174,172,166,157,146,134,122,110,
-    101,97,101,113,131,149,163,171,175,176,180,184,188,189,184,172,
-    160,148,142,142,146,156,166,175,178,179,179,179,176,172,167,158,
-    148,140,133,125,118,113,111,110,112,116,124,134,145,156,166,172,
-    174,172,168,164,161,159,156,151,144,135,127,121,120,125,135,147,
-    157,164,167,170,169,167,163,156,149,142,137,134,132,129,126,126,
-    128,130,131,132,133,136,142,149,155,157,157,156,157,160,163,166,
-    170,172,171,168,164,160,158,159,161,165,168,171,173,173,173,173,
-    171,168,164,159,152,143,135,125,117,109,105,105,108,115,124,135,
-    146,156,164,170,171,170,169,167,165,162,160,155,150,143,136,130,
-    129,131,135,141,149,156,160,164,168,169,167,161,155,148,141,135,
-    129,123,118,115,115,119,123,127,130,135,141,147,153,156,158,159,
-    162,166,170,172,172,171,168,163,156,151,149,151,156,163,169,174,
-    178,181,182,181,178,173,165,157,149,139,130,122,115,111,110,112,
-    116,120,125,131,138,146,153,158,162,165,170,173,174,172,170,165,
-    157,147,137,129,124,122,125,131,140,148,157,164,171,177,178,174,
-    165,156,145,136,126,118,113,112,113,116,121,128,134,141,149,155,
-    158,159,160,162,166,170,171,169,167,163,159,157,155,153,151,150,
-    152,157,161,166,171,177,183,187,188,184,176,165,153,139,127,118,
-    111,108,106,109,113,118,124,131,138,145,153,157,162,165,169,173,
-    175,176,175,170,163,153,143,135,129,125,124,126,131,137,145,154,
-    164,174,182,184,180,170,156,141,128,118,111,108,109,113,118,126,
-    133,141,148,154,159,163,164,165,165,165,167,167,166,163,159,156,
-    153,152,151,151,152,154,159,165,171,177,183,189,193,192,184,172,
-    157,143,129,117,109,105,106,108,113,119,126,133,139,146,151,156,
-    160,162,165,168,170,170,170,166,162,156,149,141,132,125,121,120,
-    123,130,139,149,160,171,180,184,182,175,165,151,136,122,111,104,
-    103,105,111,119,128,137,145,153,161,166,170,172,174,175,174,171,
-    166,162,158,153,148,145,143,144,147,153,159,166,172,178,184,188,
-    191,190,185,174,160,147,135,125,117,112,109,108,111,116,121,130,
-    139,148,155,160,164,165,166,168,170,171,170,167,161,154,145,137,
-    129,123,120,120,122,128,137,147,157,167,176,182,182,176,165,153,
-    140,130,119,112,106,105,107,114,123,135,148,161,171,175,176,174,
-    171,170,168,167,165,162,158,153,147,141,138,137,140,145,152,161,
-    170,177,183,189,192,192,187,179,167,154,141,130,121,113,107,105,
-    106,112,120,132,143,153,160,165,166,166,166,166,168,170,170,167,
-    162,155,145,135,126,119,116,117,121,128,136,146,156,167,176,182,
-    183,179,171,160,148,137,125,114,106,101,102,108,118,131,146,160,
-    172,179,181,179,175,170,166,163,162,161,156,150,142,135,132,132,
-    135,141,150,161,171,179,185,189,191,190,187,180,171,159,148,136,
-    125,115,107,103,104,110,119,131,143,155,164,169,171,170,168,165,
-    163,164,164,163,159,154,146,137,127,118,114,113,117,125,135,147,
-    158,169,177,183,183,180,173,164,154,141,128,115,107,103,106,113,
-    123,135,147,159,169,174,177,176,172,168,165,163,163,161,159,153,
-    146,139,133,131,132,137,145,155,166,177,186,194,200,202,198,189,
-    176,162,147,134,122,113,107,105,106,110,119,130,142,154,163,171,
-    173,172,168,163,160,158,159,160,159,157,152,143,135,126,117,113,
-    115,120,130,143,157,169,179,187,188,182,174,163,149,138,126,117,
-    109,104,105,108,117,130,144,157,169,176,177,175,171,167,163,161,
-    161,160,158,153,148,143,139,137,136,136,139,147,159,173,186,196,
-    202,203,198,189,175,160,145,132,121,112,107,105,107,114,124,136,
-    148,159,166,170,170,167,164,163,163,164,165,165,162,157,150,143,
-    136,129,123,118,115,116,123,136,151,166,179,187,189,186,178,167,
-    154,140,125,113,104,100,101,107,117,130,142,154,163,168,170,169,
-    167,163,162,162,163,164,162,157,151,145,140,138,138,139,142,148,
-    156,168,179,188,195,199,199,193,183,169,152,135,120,110,106,106,
-    110,117,126,137,148,158,165,169,169,169,167,165,164,166,167,167,
-    165,160,152,143,134,126,120,115,115,116,121,131,144,158,171,182,
-    188,188,183,172,158,143,128,114,105,100,101,108,118,130,142,152,
-    160,165,167,167,166,165,165,167,168,168,166,160,153,145,140,138,
-    138,140,143,147,153,161,170,178,185,188,188,185,180,171,159,145,
-    131,119,111,109,111,117,126,136,145,154,160,163,164,165,166,168,
-    171,174,175,174,170,162,152,142,132,123,117,112,111,114,121,131,
-    143,156,168,178,184,185,182,175,163,148,133,119,108,102,102,107,
-    116,127,137,147,154,159,162,162,163,165,168,171,173,172,168,160,
-    151,143,139,138,138,139,142,147,154,160,166,172,177,181,183,182,
-    179,173,164,153,140,128,117,111,110,114,123,132,141,147,152,157,
-    161,164,167,171,174,177,179,178,173,165,155,144,134,124,118,113,
-    112,115,121,130,141,152,163,172,179,181,180,175,166,154,140,127,
-    116,109,107,110,116,125,134,142,148,152,156,158,161,164,169,173,
-    177,177,173,166,158,151,147,143,141,140,140,142,145,150,158,165,
-    170,173,175,176,175,171,165,157,147,136,127,120,116,116,119,125,
-    133,142,149,155,159,162,166,171,177,180,181,178,172,163,153,143,
-    133,124,117,113,112,115,123,132,143,153,163,171,177,181,182,178,
-    172,163,150,136,122,113,108,108,113,120,127,133,139,145,149,153,
-    158,162,168,174,178,181,179,175,168,160,153,148,143,139,139,139,
-    141,145,149,154,158,163,168,171,173,172,170,165,156,145,134,125,
-    119,117,118,122,128,134,141,147,154,161,169,176,182,186,187,185,
-    178,169,159,147,136,126,118,113,112,114,119,129,138,148,156,164,
-    170,174,177,176,173,166,156,143,131,120,113,110,111,115,121,125,
-    130,136,142,149,155,163,169,173,176,178,181,179,175,169,161,152,
-    144,138,134,134,135,138,142,147,152,158,163,169,173,177,178,175,
-    168,157,143,131,120,114,112,116,122,129,136,144,154,164,173,180,
-    185,186,186,182,176,169,160,152,149,129,120,104,105,114,165,128,
-    116,166,118,166,188,138,142,187,169,120,130,163,174,168,142,114,
-    107,109,123,148,170,178,170,151,136,125,124,130,139,147,147,136,
-    119,99,84,78,84,100,122,144,166,186,204,219,232,243,250,255,
-    254,247,232,212,187,158,128,100,75,58,48,47,53,63,77,93,
-    109,124,137,145,149,150,149,148,146,144,141,140,140,143,149,159,
-    171,184,196,206,212,215,217,217,214,206,194,177,158,137,114,90,
-    66,45,30,22,22,30,43,61,81,103,124,143,158,170,178,183,
-    185,185,180,173,165,157,149,143,140,141,147,154,163,172,180,187,
-    194,199,203,203,196,183,165,146,127,106,86,70,59,55,57,65,
-    78,93,108,123,137,151,162,169,173,176,176,173,167,159,149,139,
-    130,123,119,119,124,134,147,160,172,181,189,196,200,202,198,188,
-    171,149,126,102,80,63,52,46,44,50,59,71,84,100,116,130,
-    142,153,161,166,171,173,173,169,164,157,149,143,140,140,145,152,
-    160,167,172,176,180,184,189,193,193,188,178,162,142,120,98,79,
-    64,55,53,57,66,78,92,108,126,144,159,169,174,175,172,167,
-    160,151,142,133,126,123,122,125,130,137,147,158,167,175,180,186,
-    190,189,186,179,170,155,136,114,93,75,61,51,48,52,60,70,
-    81,95,109,123,137,151,163,170,174,175,172,164,155,146,139,133,
-    132,135,140,145,153,161,166,171,176,182,187,190,190,185,174,158,
-    137,115,96,79,68,62,62,66,74,83,95,108,123,137,150,161,
-    171,176,176,170,161,151,140,128,120,114,113,117,125,136,147,157,
-    165,171,176,180,184,186,184,178,167,152,133,112,93,78,68,62,
-    60,62,66,72,80,91,104,119,134,149,162,172,177,177,173,165,
-    154,143,132,126,125,129,137,146,154,161,164,166,169,173,178,182,
-    183,180,170,157,139,119,100,85,77,71,71,73,78,85,94,106,
-    120,134,147,159,169,174,174,169,160,149,137,125,116,109,107,112,
-    121,132,144,155,163,169,175,181,185,188,187,181,168,152,133,112,
-    93,79,71,67,67,70,74,80,88,96,107,121,137,152,166,178,
-    183,181,172,158,143,129,121,118,121,127,137,145,152,158,163,167,
-    172,176,179,181,180,176,166,152,136,119,103,90,81,77,76,78,
-    82,89,98,108,120,134,148,163,174,180,180,173,160,143,126,112,
-    103,100,104,112,124,136,147,158,167,176,182,186,188,186,180,171,
-    158,144,129,115,100,88,79,74,73,74,79,84,91,99,110,124,
-    140,156,169,178,181,178,168,154,139,127,120,118,120,126,134,144,
-    152,161,167,172,175,177,178,176,172,166,158,146,133,120,106,93,
-    84,79,78,82,87,94,103,113,126,140,154,167,176,179,175,166,
-    152,136,121,109,101,98,100,106,115,126,139,153,168,180,188,192,
-    191,185,175,165,154,142,129,116,104,94,85,81,80,82,86,91,
-    99,108,120,132,146,158,166,171,173,169,161,150,138,126,118,115,
-    116,122,131,142,154,164,173,178,180,180,179,175,169,161,152,141,
-    129,117,106,95,87,82,82,85,90,97,107,120,133,148,159,168,
-    173,175,172,164,152,137,122,108,98,92,92,98,108,122,138,154,
-    170,181,189,192,190,185,176,167,157,146,134,120,106,94,86,81,
-    79,81,86,93,103,115,128,140,151,159,166,170,170,167,160,149,
-    136,123,114,109,109,114,125,140,155,171,182,186,186,183,177,168,
-    161,154,147,138,128,117,107,96,89,85,83,85,91,101,113,126,
-    140,153,161,168,173,175,173,167,157,142,124,106,92,84,84,90,
-    101,117,135,154,170,182,190,191,188,182,175,168,160,149,136,123,
-    110,99,90,84,82,84,90,98,107,118,130,142,153,161,167,171,
-    170,166,157,144,129,115,105,101,103,112,125,141,157,172,183,191,
-    192,190,183,176,169,160,150,140,130,118,107,97,90,86,85,88,
-    95,106,118,131,143,154,163,170,175,175,173,165,154,138,120,103,
-    88,80,78,84,96,113,132,150,167,178,185,189,188,185,179,171,
-    160,149,137,124,111,100,91,85,84,87,95,105,115,125,135,143,
-    151,158,164,168,169,163,153,138,122,109,101,98,102,111,124,141,
-    157,172,184,192,196,197,194,187,177,166,154,142,129,117,105,95,
-    87,83,82,86,95,106,117,130,143,154,163,170,177,179,177,169,
-    157,142,125,109,95,86,83,86,95,108,123,140,156,170,179,185,
-    187,186,181,174,166,156,144,130,116,104,95,90,87,88,94,103,
-    114,126,138,148,156,163,168,170,168,162,153,141,126,111,101,96,
-    98,104,115,130,147,164,179,190,196,198,196,191,183,174,164,151,
-    136,121,107,95,86,81,80,83,90,101,115,130,143,156,167,176,
-    181,183,179,171,157,140,123,108,95,87,82,83,89,99,113,129,
-    147,163,176,186,190,191,187,181,173,162,149,134,119,106,95,88,
-    86,89,96,105,116,127,137,146,156,166,173,175,170,161,149,136,
-    123,111,102,96,94,98,106,120,137,155,171,186,196,202,202,198,
-    192,183,171,158,144,127,111,96,85,79,78,81,88,98,111,125,
-    140,154,167,178,186,188,184,175,160,143,126,110,97,89,85,84,
-    89,97,109,123,139,155,169,181,189,193,192,188,179,166,152,136,
-    121,108,97,90,87,89,94,103,114,126,139,152,163,171,177,178,
-    175,166,155,140,125,111,100,94,91,92,100,111,127,144,161,178,
-    191,202,208,208,203,193,179,163,146,130,116,103,92,83,77,75,
-    77,86,102,120,139,158,172,183,189,190,186,177,163,146,127,110,
-    96,85,81,81,86,94,105,119,135,151,166,179,189,195,197,192,
-    182,167,150,134,119,106,98,93,90,91,95,103,114,126,141,156,
-    170,182,187,186,179,168,155,140,125,111,102,94,91,90,94,103,
-    117,135,155,174,191,204,212,214,209,198,184,167,150,133,117,104,
-    93,85,80,78,82,90,103,120,139,160,178,190,195,194,187,174,
-    158,140,123,108,96,86,79,77,80,87,98,112,130,149,166,180,
-    191,196,196,189,178,165,149,134,120,110,102,97,94,93,97,105,
-    117,131,146,161,174,183,187,185,177,166,153,140,127,115,106,97,
-    91,89,92,100,113,132,152,172,190,204,213,216,212,201,187,170,
-    153,137,122,111,99,89,82,79,81,89,103,122,143,162,178,188,
-    193,191,184,173,159,141,125,109,96,85,81,77,75,83,91,107,
-    129,146,164,182,193,196,194,191,181,168,153,136,123,110,101,95,
-    95,96,101,108,118,130,143,158,171,180,184,183,177,168,153,135,
-    123,112,102,95,89,89,93,102,118,134,154,175,194,209,219,224,
-    219,204,183,162,145,129,115,103,95,89,83,78,76,84,102,126,
-    151,170,182,185,183,176,169,159,148,136,124,112,102,95,93,93,
-    97,102,110,121,135,151,167,181,190,192,189,180,169,156,142,126,
-    111,98,90,87,89,94,103,115,127,140,152,163,171,178,181,181,
-    177,168,157,144,131,118,107,100,96,95,97,103,114,132,153,174,
-    194,209,218,219,213,201,185,167,148,129,111,96,86,81,81,86,
-    96,108,121,135,148,161,172,181,184,184,179,170,158,143,126,111,
-    97,86,81,81,86,94,105,120,135,151,166,179,188,192,191,185,
-    173,157,140,122,106,94,86,85,89,97,109,121,132,144,155,166,
-    175,181,183,180,172,162,152,140,127,114,103,96,94,95,101,111,
-    126,144,163,181,196,207,211,210,204,194,179,161,141,121,104,91,
-    85,85,90,98,108,119,131,143,154,164,174,181,184,182,176,165,
-    152,139,126,113,100,89,80,76,80,90,105,122,141,158,173,183,
-    188,189,187,182,172,158,141,122,103,89,81,80,88,99,112,127,
-    140,151,162,171,177,179,180,176,169,160,150,139,127,115,104,95,
-    91,90,97,108,125,146,168,189,204,212,213,208,198,184,167,151,
-    135,119,105,94,86,85,90,98,110,124,139,152,163,172,179,183,
-    184,181,174,163,150,136,121,107,96,86,79,77,80,91,108,129,
-    150,170,186,194,195,191,182,171,159,146,133,118,104,93,87,85,
-    88,97,112,129,146,161,172,179,183,182,178,172,164,154,142,130,
-    118,106,95,88,85,87,95,110,130,155,181,203,216,220,215,205,
-    191,176,161,145,130,116,103,93,88,88,93,102,116,132,149,163,
-    173,179,182,181,178,172,165,157,146,133,119,107,96,87,81,79,
-    82,92,109,133,156,177,193,200,199,191,180,167,155,143,129,112,
-    101,90,83,86,91,104,123,140,156,171,181,184,181,175,167,158,
-    150,140,130,122,113,104,96,90,89,93,103,120,141,166,190,209,
-    221,224,220,208,191,173,154,138,123,110,99,91,87,87,93,103,
-    117,134,151,167,178,185,186,183,176,168,159,148,138,126,115,104,
-    94,87,82,82,88,101,120,142,165,186,200,205,202,192,178,160,
-    143,128,114,102,92,85,83,85,92,105,122,142,162,178,188,191,
-    189,182,172,162,151,139,128,118,110,103,97,93,94,101,113,129,
-    149,171,192,208,218,218,209,195,177,159,143,130,120,111,104,97,
-    93,94,99,110,126,145,162,177,186,191,190,185,177,165,152,138,
-    126,114,103,93,86,82,82,86,96,110,129,151,172,190,203,206,
-    201,190,174,155,137,121,109,100,94,91,91,94,101,114,130,147,
-    164,177,185,188,184,176,164,151,138,127,117,110,103,98,96,97,
-    102,111,124,140,157,176,194,207,213,212,204,190,174,156,138,124,
-    112,105,100,99,100,105,114,125,138,153,168,181,189,193,191,183,
-    170,154,139,124,111,101,93,89,88,89,93,100,110,125,142,159,
-    176,190,199,200,193,181,166,150,133,119,108,101,97,97,100,107,
-    116,129,142,156,168,177,183,183,177,167,154,139,123,111,104,99,
-    97,99,102,106,114,125,137,151,166,181,194,203,207,204,195,181,
-    165,147,132,119,110,105,102,103,108,116,125,136,148,162,175,184,
-    188,187,180,170,155,139,125,111,101,95,90,89,90,96,104,115,
-    129,143,158,171,182,190,194,192,185,173,158,142,127,114,105,100,
-    99,102,109,119,130,142,155,166,174,177,176,171,163,151,138,124,
-    111,101,96,95,97,101,109,119,130,141,151,162,173,182,189,194,
-    194,190,182,170,157,144,132,121,113,108,108,112,118,126,137,149,
-    161,170,176,178,177,173,165,155,143,127,112,99,90,86,87,92,
-    100,110,122,135,146,156,165,174,180,184,184,179,171,160,148,138,
-    128,120,115,112,112,115,122,132,143,154,163,170,173,172,167,159,
-    149,137,125,112,101,96,90,92,96,103,117,131,142,153,165,172,
-    178,181,184,184,183,180,172,162,150,140,131,124,119,117,117,120,
-    126,136,147,159,170,177,180,179,173,164,154,141,129,116,105,95,
-    88,86,87,93,104,117,131,145,156,165,172,177,179,179,177,172,
-    165,156,146,138,131,125,122,122,125,130,138,146,155,163,169,172,
-    171,167,160,149,136,123,111,100,92,86,86,89,96,106,119,135,
-    151,165,176,184,187,188,186,182,177,171,164,155,145,138,133,130,
-    129,128,130,134,140,147,154,162,169,174,175,172,166,156,145,133,
-    120,109,99,92,88,88,92,101,113,127,142,156,167,175,180,181,
-    179,174,169,162,156,148,141,134,128,125,125,128,132,138,145,152,
-    158,164,168,169,167,163,155,144,132,118,105,93,85,81,82,88,
-    99,111,126,142,157,169,179,186,189,188,184,177,170,162,154,146,
-    139,135,134,134,136,138,142,146,149,154,160,165,170,172,170,166,
-    159,150,138,127,116,107,98,92,89,89,95,104,117,130,143,156,
-    166,173,177,179,177,172,166,159,152,144,138,134,132,132,135,138,
-    143,147,153,158,164,168,170,170,167,161,151,139,126,113,101,91,
-    84,81,82,88,98,112,128,144,157,168,177,183,186,187,183,176,
-    168,161,153,146,140,136,134,135,138,142,147,153,157,160,162,165,
-    166,166,166,163,156,147,135,123,112,101,92,86,84,86,92,102,
-    115,128,142,155,165,174,178,179,177,173,168,161,154,147,141,137,
-    136,138,140,144,148,151,155,160,164,168,171,172,168,162,151,138,
-    124,111,99,89,82,78,77,82,91,104,121,138,154,167,177,184,
-    188,189,186,181,173,164,155,147,142,139,138,140,144,148,152,154,
-    156,158,161,164,166,167,165,159,151,141,132,122,112,102,93,86,
-    83,85,91,100,111,123,136,150,163,174,181,185,185,181,173,163,
-    153,145,140,137,138,141,145,149,153,157,160,164,167,170,172,172,
-    169,161,150,138,124,111,100,91,84,79,79,82,89,99,114,129,
-    145,161,175,185,191,192,188,181,171,166,158,151,148,144,144,146,
-    151,155,157,160,161,161,159,159,160,161,159,155,148,138,128,117,
-    107,103,94,89,86,84,89,97,106,117,131,146,158,168,176,181,
-    184,181,175,166,158,149,143,141,141,143,147,151,155,157,160,164,
-    167,170,172,174,172,166,156,142,128,114,102,92,83,77,73,73,
-    79,88,101,117,133,151,168,183,193,199,198,194,185,175,165,157,
-    151,148,147,149,152,158,160,160,164,171,168,161,172,164,161,156,
-    140,135,122,110,105,97,85,78,83,82,84,91,101,109,121,134,
-    152,168,181,187,192,193,190,181,166,149,144,148,125,146,130,148,
-    130,166,167,146,210,142,159,207,180,143,161,169,134,107,110,110,
-    89,74,69,77,88,96,103,109,117,132,147,162,165,163,162,174,
-    183,194,200,199,193,182,163,147,136,133,140,153,169,182,189,189,
-    183,174,165,157,151,145,142,133,120,103,78,58,43,34,37,51,
-    71,91,107,121,136,148,161,173,185,194,197,196,187,173,156,140,
-    130,130,141,160,184,205,221,228,224,207,184,159,136,121,114,116,
-    124,131,134,130,118,98,75,52,35,30,37,53,76,108,143,177,
-    206,225,235,235,224,204,179,155,133,121,121,132,153,177,201,219,
-    226,222,207,184,162,142,129,125,127,132,136,135,125,109,90,68,
-    49,39,37,46,62,82,102,122,139,155,167,179,188,193,193,187,
-    178,165,152,142,139,145,159,179,200,215,223,218,203,182,158,138,
-    126,124,130,142,153,160,156,142,120,91,62,39,26,24,36,56,
-    82,114,146,175,200,216,223,220,209,192,173,155,141,134,137,150,
-    170,193,214,227,230,220,200,175,151,134,126,128,138,149,157,157,
-    146,125,98,69,45,29,25,34,51,72,94,117,137,154,169,181,
-    188,190,187,178,167,155,146,142,146,159,178,201,222,234,234,223,
-    201,173,146,126,115,117,128,145,161,170,169,155,131,99,67,41,
-    25,21,30,49,73,102,133,162,187,205,214,215,207,192,174,156,
-    144,139,145,160,181,205,224,235,235,223,201,175,149,131,123,126,
-    139,155,167,171,162,140,112,81,54,34,24,26,39,57,77,99,
-    122,143,162,180,192,194,189,179,163,150,140,136,143,161,183,207,
-    229,242,241,227,202,171,141,119,107,109,123,143,163,178,182,172,
-    149,116,80,49,29,21,27,43,65,93,123,154,181,202,213,216,
-    210,195,177,159,147,142,148,166,190,216,235,243,239,224,199,169,
-    142,121,111,115,128,147,164,173,172,158,133,102,69,42,26,22,
-    31,48,70,95,121,144,164,180,189,191,186,174,158,142,131,128,
-    136,155,181,209,233,245,244,229,202,170,138,114,102,104,118,139,
-    162,180,188,183,164,134,97,63,38,27,29,42,63,90,119,147,
-    172,192,204,207,200,186,169,153,143,141,149,167,191,216,237,247,
-    244,228,202,171,141,118,108,110,124,143,163,177,180,171,148,116,
-    80,48,27,19,25,41,62,88,115,141,161,175,185,185,180,169,
-    153,137,129,128,137,157,186,216,240,252,249,233,204,171,138,113,
-    100,100,114,136,161,182,192,188,170,139,102,67,40,27,28,41,
-    62,88,117,143,167,185,197,201,197,188,173,159,150,148,157,175,
-    198,220,238,245,241,223,195,162,132,110,101,104,120,142,165,181,
-    186,177,154,120,83,50,28,21,28,45,67,92,117,138,156,171,
-    181,183,179,168,155,142,134,134,144,162,187,212,232,242,239,224,
-    197,164,132,107,95,98,114,139,166,188,198,193,173,141,105,71,
-    46,34,36,49,69,94,121,145,165,180,189,192,189,181,171,162,
-    157,158,166,182,202,222,237,242,234,216,187,154,126,107,101,109,
-    128,150,172,186,187,174,149,117,81,51,32,27,35,52,74,97,
-    120,139,153,165,171,173,172,165,156,147,142,143,151,166,186,207,
-    225,235,233,218,192,160,129,105,93,96,113,137,164,186,195,191,
-    171,140,103,69,44,34,39,55,77,101,127,149,167,181,189,191,
-    188,181,171,163,159,162,172,188,207,224,236,238,228,208,180,150,
-    123,104,99,107,127,151,172,184,184,170,144,110,75,49,34,35,
-    48,68,90,112,129,142,152,161,168,171,170,167,159,151,147,147,
-    155,169,188,206,221,228,224,207,182,151,120,99,89,93,111,135,
-    161,182,191,185,164,134,99,68,45,39,50,67,93,117,138,158,
-    172,179,185,189,188,180,171,163,160,164,174,188,205,220,231,233,
-    223,204,178,147,120,103,99,108,127,150,172,186,187,174,147,112,
-    77,50,35,36,50,72,96,116,133,143,150,156,162,167,169,167,
-    163,156,152,151,158,170,188,207,222,228,223,205,178,147,118,97,
-    88,93,109,134,158,177,184,177,156,126,92,64,47,45,57,80,
-    106,129,147,159,167,174,180,186,188,187,183,178,175,175,181,193,
-    207,221,231,231,221,199,170,139,112,95,91,100,119,141,162,174,
-    173,159,135,105,75,52,43,49,67,92,117,135,146,151,153,157,
-    162,167,172,173,170,164,160,157,159,167,180,195,207,214,210,193,
-    170,141,111,90,81,84,101,126,150,169,178,174,156,128,96,70,
-    54,52,66,90,117,141,158,169,175,179,183,185,188,187,185,179,
-    174,172,175,183,194,206,216,219,212,195,171,144,119,101,94,100,
-    115,136,155,166,166,153,130,102,76,57,51,58,77,103,128,147,
-    157,161,160,160,162,166,170,173,172,168,163,159,159,164,173,184,
-    195,201,199,187,167,142,115,94,83,84,97,119,143,162,170,166,
-    149,122,95,71,59,60,77,106,135,160,178,186,187,187,188,190,
-    192,191,188,182,174,170,169,174,183,194,203,207,202,188,168,144,
-    120,101,91,92,105,124,144,158,160,151,131,106,81,65,62,72,
-    93,121,145,163,171,171,168,164,165,169,173,176,175,170,164,157,
-    152,152,156,164,175,182,184,179,165,143,119,97,83,80,90,110,
-    134,155,166,165,150,126,100,78,67,70,87,114,145,170,188,197,
-    199,197,194,192,190,188,185,179,172,166,163,164,169,177,186,193,
-    194,186,171,148,124,103,90,88,98,117,138,155,161,155,139,117,
-    94,77,71,79,99,128,156,175,185,186,179,172,169,170,173,176,
-    176,171,162,153,144,138,139,146,157,168,175,173,162,142,117,94,
-    79,75,83,103,127,149,164,165,153,132,108,87,77,81,97,125,
-    157,184,202,210,209,203,198,194,189,186,181,173,163,156,147,147,
-    152,160,173,183,185,178,167,145,120,101,88,88,100,117,137,154,
-    162,158,143,123,102,87,83,90,110,136,163,183,193,193,186,178,
-    173,172,174,176,175,168,156,143,132,126,127,134,146,159,167,168,
-    158,140,116,93,77,72,78,95,117,139,154,160,155,140,121,104,
-    97,102,118,143,171,196,211,217,212,204,197,193,190,188,182,172,
-    161,149,141,137,138,144,154,163,168,166,156,139,121,105,95,95,
-    103,119,137,152,161,160,150,134,117,105,103,111,131,155,180,196,
-    201,194,183,171,161,165,162,166,168,163,154,152,126,113,118,108,
-    134,149,143,148,156,137,104,90,89,89,95,106,121,139,154,164,
-    168,162,149,130,114,110,118,138,164,188,202,206,197,183,171,164,
-    162,165,168,168,165,159,154,152,154,160,169,174,178,175,162,147,
-    128,110,98,95,98,107,121,136,144,146,140,130,117,108,106,114,
-    131,152,173,186,191,186,176,165,161,163,170,176,178,174,164,151,
-    138,129,126,130,138,148,155,155,147,131,110,89,72,65,70,83,
-    103,124,141,152,154,149,138,128,124,129,143,164,186,204,212,211,
-    201,189,178,173,171,170,170,166,159,151,144,140,141,147,153,159,
-    163,160,150,134,117,102,92,90,98,112,129,144,155,159,154,144,
-    132,122,119,126,140,160,179,193,196,189,177,164,156,156,160,165,
-    166,162,153,141,130,123,121,125,134,145,154,155,149,135,115,96,
-    82,76,80,94,113,132,149,160,160,152,141,131,126,129,142,163,
-    186,204,212,209,198,183,173,168,168,170,170,167,159,150,141,133,
-    134,138,143,152,156,156,152,142,127,114,107,105,109,120,134,145,
-    153,153,146,136,126,120,122,133,151,171,189,197,194,181,165,152,
-    146,149,158,166,170,167,157,143,129,119,114,118,127,139,149,152,
-    148,136,119,101,88,83,88,103,123,143,160,169,167,158,145,134,
-    129,133,146,167,188,203,207,201,189,174,165,163,164,167,167,164,
-    156,146,137,130,129,132,139,148,153,155,150,140,126,113,105,105,
-    113,128,143,156,165,163,155,143,130,124,126,136,154,173,189,196,
-    189,173,155,141,135,141,154,167,173,170,159,143,128,116,113,118,
-    128,140,151,156,151,139,120,102,89,85,92,109,130,151,166,173,
-    170,159,147,136,132,137,151,172,191,204,205,196,180,163,153,151,
-    155,161,165,165,159,149,139,132,130,133,139,147,152,153,148,137,
-    124,112,105,108,118,134,150,163,170,169,159,146,134,128,130,142,
-    159,177,190,191,181,163,144,131,129,136,150,165,172,170,160,145,
-    130,121,119,123,133,144,153,153,149,135,117,103,92,92,104,122,
-    140,158,170,172,165,155,143,136,137,144,159,177,192,199,194,180,
-    162,148,143,147,158,168,174,172,163,151,139,133,132,135,140,146,
-    149,147,139,128,117,107,105,111,124,141,158,170,174,171,160,146,
-    137,131,136,148,163,179,189,186,173,154,134,122,122,133,150,165,
-    174,173,164,150,137,129,127,131,140,148,150,146,136,121,106,98,
-    98,107,123,143,159,171,175,172,163,151,141,136,138,148,162,177,
-    188,190,180,164,147,137,137,146,160,173,180,179,172,161,151,143,
-    139,139,142,143,142,137,128,118,109,106,111,122,137,153,165,172,
-    172,165,154,144,135,133,138,149,163,175,180,174,159,140,125,119,
-    126,141,158,171,176,172,162,151,143,139,140,143,146,147,143,133,
-    120,107,99,97,104,117,134,151,164,172,173,167,158,149,143,141,
-    145,154,166,177,181,177,164,149,138,135,142,155,170,179,182,179,
-    171,163,155,151,148,147,145,140,134,124,113,104,100,104,114,129,
-    147,162,173,176,171,161,151,142,137,140,147,158,169,176,173,161,
-    146,130,121,121,131,146,161,170,172,168,162,155,151,151,151,152,
-    151,145,135,122,109,99,94,97,109,127,146,163,174,178,175,168,
-    159,152,148,148,152,160,168,174,173,163,149,137,131,134,144,157,
-    169,175,176,171,166,162,160,161,161,158,153,143,130,117,106,100,
-    101,107,119,136,152,165,172,173,167,158,149,144,143,146,155,165,
-    171,171,164,149,133,121,118,123,136,151,160,164,161,156,153,151,
-    153,158,162,164,159,148,134,120,107,99,99,106,119,137,154,164,
-    173,174,170,165,157,152,151,154,158,163,168,169,162,148,134,124,
-    122,130,144,159,170,173,170,166,164,164,167,170,172,170,162,149,
-    133,118,105,98,97,105,119,136,151,163,168,167,162,154,149,146,
-    148,153,160,167,170,166,155,140,127,119,120,128,140,151,157,157,
-    153,149,147,149,155,162,167,168,162,152,138,124,113,106,106,113,
-    126,141,154,163,167,167,165,160,157,155,157,159,162,166,165,163,
-    153,138,127,122,125,133,146,157,161,161,158,156,157,161,168,175,
-    178,177,170,159,145,130,119,113,112,118,127,137,146,151,154,151,
-    147,145,144,146,150,156,162,166,168,164,154,141,129,124,127,136,
-    145,151,151,146,140,136,136,142,151,161,168,170,166,158,147,136,
-    128,124,126,131,136,144,150,152,155,153,151,152,154,155,157,161,
-    166,169,170,165,154,142,131,128,132,141,148,152,150,145,139,138,
-    143,153,164,174,179,178,172,162,151,140,132,128,130,135,141,147,
-    150,150,148,144,141,139,139,141,146,153,160,165,167,164,154,143,
-    134,130,134,140,145,146,141,133,125,121,124,132,143,155,165,169,
-    168,164,157,150,144,142,143,147,152,156,158,157,153,148,144,143,
-    144,146,151,155,161,166,166,162,153,141,133,131,136,143,149,150,
-    144,136,129,127,132,144,157,169,178,181,180,173,165,155,148,144,
-    144,147,150,153,152,148,141,133,128,127,128,132,138,146,154,161,
-    164,162,155,146,140,138,142,148,152,148,140,130,120,115,116,122,
-    134,147,158,165,168,168,165,161,156,153,154,157,161,163,162,158,
-    151,143,137,135,135,138,143,151,159,166,168,163,154,144,136,135,
-    139,147,152,151,144,134,125,121,125,135,148,162,175,182,184,181,
-    174,166,158,154,153,154,155,154,151,145,137,129,121,117,117,121,
-    129,140,151,161,167,167,160,150,143,144,149,154,157,153,143,129,
-    118,113,112,118,130,143,154,164,170,172,170,166,161,159,158,161,
-    164,165,164,158,150,141,133,129,129,132,139,148,156,164,167,166,
-    159,150,143,142,147,153,157,153,144,132,120,114,117,126,140,152,
-    165,176,182,183,180,174,166,159,155,156,158,160,158,151,141,129,
-    119,114,113,117,126,138,150,160,166,166,160,152,147,147,151,156,
-    158,152,140,125,111,105,105,111,122,136,149,161,170,175,176,174,
-    170,166,165,165,166,167,166,161,154,145,136,131,129,131,136,143,
-    152,161,166,165,160,151,144,142,146,152,156,154,144,130,117,110,
-    110,120,133,149,166,178,185,189,187,181,175,168,163,160,160,159,
-    156,149,140,128,119,112,110,114,119,132,143,156,165,165,161,154,
-    148,143,146,154,159,156,147,134,120,109,105,109,119,134,149,164,
-    175,181,183,180,176,170,165,162,160,160,158,154,149,141,135,130,
-    127,128,133,140,149,158,165,165,164,159,152,147,145,150,157,159,
-    151,137,125,115,113,119,126,141,157,172,180,187,188,185,175,165,
-    157,154,152,154,150,148,147,129,129,115,112,106,118,137,135,159,
-    167,157,161,152,145,144,143,151,162,166,154,142,131,122,111,107,
-    111,122,136,149,158,161,161,158,156,153,152,153,156,161,165,166,
-    164,159,153,147,142,140,140,142,148,158,167,172,172,165,154,145,
-    140,140,144,147,147,142,134,126,122,125,135,150,167,183,196,204,
-    204,200,192,182,173,167,162,159,155,149,140,128,116,103,98,94,
-    98,110,121,136,151,160,161,156,147,135,128,128,134,142,147,145,
-    136,124,113,108,109,115,126,138,148,155,158,159,158,155,152,151,
-    150,151,153,152,151,150,148,146,145,148,154,161,169,177,184,186,
-    184,176,163,150,142,140,144,155,163,165,160,149,140,138,141,149,
-    161,174,185,190,191,188,182,175,168,163,158,153,149,142,135,126,
-    116,106,100,99,104,113,124,135,145,151,151,145,135,120,108,105,
-    111,124,138,146,146,138,127,119,116,120,127,136,144,150,152,154,
-    154,153,151,149,146,143,143,143,144,146,147,149,151,156,163,170,
-    177,182,184,183,180,172,160,148,137,133,137,149,164,175,178,174,
-    165,156,154,158,167,177,182,183,180,174,167,162,157,154,152,147,
-    141,138,132,125,120,115,111,113,119,124,133,141,144,147,145,137,
-    127,116,106,99,100,109,125,140,150,150,144,134,127,126,130,138,
-    143,145,144,142,140,138,137,137,136,134,134,134,137,141,146,152,
-    161,170,178,185,190,192,189,182,171,158,148,141,133,130,132,139,
-    155,172,184,190,191,186,179,176,177,180,181,178,170,161,152,147,
-    143,142,141,139,136,133,131,128,128,129,131,135,140,145,149,150,
-    147,140,129,119,110,103,97,93,95,102,116,132,150,160,162,160,
-    151,147,146,144,143,142,138,131,125,123,123,125,126,126,127,126,
-    129,136,146,157,170,183,193,199,200,198,190,178,163,148,137,129,
-    127,126,129,135,146,162,181,197,206,208,204,196,187,181,175,168,
-    159,149,140,135,131,132,133,135,135,132,132,134,137,142,149,155,
-    159,161,160,154,146,133,118,103,92,86,85,89,95,104,116,133,
-    152,168,178,180,174,165,155,147,141,135,128,120,113,108,106,107,
-    110,115,119,124,130,138,149,162,177,192,203,210,211,204,191,173,
-    153,134,121,115,116,123,132,143,155,170,187,205,218,222,218,207,
-    193,180,169,160,150,140,131,122,118,118,122,129,134,138,141,144,
-    149,155,162,169,173,175,172,163,148,129,109,90,77,74,78,88,
-    101,114,127,140,156,168,180,186,183,172,160,147,136,126,118,111,
-    102,95,93,96,103,112,122,132,140,149,160,172,185,197,205,210,
-    207,198,181,161,141,122,110,106,110,121,136,152,167,180,194,207,
-    216,220,216,205,191,178,167,156,146,134,123,114,110,112,120,131,
-    142,150,155,159,163,168,172,177,178,176,169,157,140,120,99,81,
-    71,71,80,97,116,133,147,158,167,176,182,184,179,169,156,143,
-    131,121,113,105,96,89,86,89,98,110,124,137,148,159,169,178,
-    189,197,203,203,197,186,171,153,134,118,108,107,115,130,148,166,
-    179,188,194,201,206,208,207,199,187,174,162,150,139,128,118,110,
-    108,112,122,135,148,159,166,170,173,177,180,181,180,175,165,151,
-    133,113,96,82,73,75,86,102,122,140,153,162,166,171,173,173,
-    170,161,150,139,128,120,112,104,98,92,89,93,104,117,131,145,
-    157,168,175,182,186,190,191,188,180,169,155,141,127,116,111,112,
-    121,137,156,174,186,192,194,195,196,196,195,190,181,171,163,154,
-    146,138,128,121,117,119,126,138,150,160,167,172,175,176,176,175,
-    170,163,152,139,124,109,96,88,85,88,100,116,135,152,162,166,
-    168,169,170,169,165,157,146,136,127,121,117,110,104,98,95,98,
-    107,120,134,148,157,164,171,175,177,178,177,173,166,158,148,139,
-    130,123,123,124,136,149,161,175,185,187,186,187,188,188,185,181,
-    173,164,157,151,145,140,133,128,125,127,135,147,158,167,171,172,
-    172,172,172,169,164,156,147,136,124,113,105,99,98,101,110,123,
-    137,147,154,158,161,162,163,163,159,154,145,135,129,122,117,112,
-    107,103,105,112,121,132,142,150,157,163,167,171,172,172,169,163,
-    156,149,141,134,127,124,126,132,142,154,167,176,182,184,183,184,
-    185,185,180,172,163,155,149,146,143,140,137,133,133,137,146,157,
-    167,175,178,179,178,177,174,168,160,149,137,125,115,107,102,100,
-    103,111,122,134,145,151,153,153,153,156,159,159,155,146,136,128,
-    123,122,120,118,115,113,115,119,129,139,147,156,162,166,170,174,
-    174,172,167,160,151,142,134,127,123,123,127,134,144,156,166,172,
-    175,175,176,179,182,182,177,167,157,150,145,144,142,140,138,139,
-    143,151,160,169,176,180,181,181,179,177,172,165,156,144,133,123,
-    113,106,102,102,107,115,125,134,141,145,145,146,151,157,161,160,
-    155,145,136,129,124,123,122,120,119,121,126,134,142,150,155,160,
-    163,166,169,171,171,167,161,152,143,134,127,122,119,119,123,131,
-    142,153,162,169,173,177,182,186,187,182,174,163,154,148,144,142,
-    141,141,143,147,154,162,170,175,180,181,182,181,178,174,167,157,
-    147,136,126,117,109,105,103,105,109,117,125,132,136,139,143,149,
-    156,164,167,164,156,147,139,133,127,123,121,120,121,126,131,139,
-    145,149,155,159,164,169,170,167,164,159,151,145,139,132,127,122,
-    120,123,128,136,142,149,155,163,171,180,188,189,184,175,164,155,
-    148,142,138,136,135,138,144,153,163,171,178,182,185,187,188,188,
-    185,179,170,159,146,134,123,114,107,102,101,104,108,111,115,119,
-    125,133,144,155,163,166,164,159,154,148,141,133,127,123,122,125,
-    131,139,146,152,157,160,164,168,172,174,173,170,164,156,147,138,
-    128,120,114,112,113,118,124,129,135,140,150,162,175,184,190,188,
-    182,174,166,158,151,145,138,139,141,145,157,166,171,174,181,182,
-    183,187,188,188,185,177,167,155,142,129,116,107,102,100,102,105,
-    109,112,114,119,127,138,150,158,161,161,159,156,151,145,138,131,
-    126,125,127,133,140,144,148,151,156,161,166,171,176,178,176,173,
-    166,157,147,134,124,116,111,111,114,118,123,126,131,139,151,162,
-    172,178,179,178,176,172,167,160,152,147,145,148,153,159,162,164,
-    165,166,171,174,182,190,196,196,190,177,172,159,137,128,108,99,
-    106,108,105,111,120,121,117,119,125,134,140,143,144,145,145,145,
-    144,144,144,144,143,143,142,146,148,145,152,151,161,162,179,180,
-    179,194,171,172,174,152,130,123,115,100,95,100,105,108,112,121,
-    136,149,160,167,170,170,170,172,173,168,162,157,157,160,167,173,
-    178,179,178,170,165,162,161,167,174,179,183,185,181,172,158,144,
-    129,116,107,104,105,108,111,111,111,114,119,124,131,136,140,143,
-    146,149,151,152,152,151,151,150,150,150,148,144,141,140,142,147,
-    155,165,174,183,186,186,180,168,155,142,129,119,117,118,122,126,
-    128,128,129,131,131,131,133,136,140,146,154,162,168,172,174,174,
-    173,172,170,167,165,161,159,159,163,170,178,186,193,196,195,188,
-    177,163,148,134,123,117,114,114,117,117,116,115,114,115,117,121,
-    123,126,128,133,138,143,146,148,148,149,152,155,158,158,157,154,
-    151,150,150,154,159,166,173,177,178,174,166,155,145,136,130,129,
-    130,132,135,136,136,133,131,129,126,125,124,125,131,140,149,157,
-    162,165,169,172,174,175,177,174,172,170,167,169,172,173,180,186,
-    189,192,189,181,168,152,136,125,120,120,123,127,130,129,128,125,
-    122,120,117,114,112,112,115,122,128,135,140,144,147,149,152,155,
-    158,158,157,156,156,157,160,165,170,176,180,181,178,171,161,149,
-    135,127,123,126,133,140,146,149,147,143,136,130,123,118,116,119,
-    124,132,141,150,156,161,165,169,171,172,172,172,172,172,173,175,
-    179,182,187,192,193,193,188,178,163,146,129,118,114,113,119,129,
-    134,137,136,131,125,117,112,108,105,107,114,123,132,138,143,146,
-    147,148,148,149,149,149,151,153,156,159,164,170,175,180,182,183,
-    180,172,160,146,133,123,119,121,129,140,150,155,155,151,144,136,
-    127,120,115,117,123,131,141,149,154,156,160,161,162,164,167,169,
-    174,177,178,181,184,187,193,196,198,197,191,178,162,144,126,113,
-    106,106,114,124,134,140,141,139,134,125,117,111,108,110,116,124,
-    132,138,141,141,139,138,138,139,142,145,149,153,157,162,168,174,
-    181,186,190,189,182,174,160,144,131,120,115,118,126,137,149,156,
-    158,154,147,138,129,122,119,121,128,136,145,151,153,153,152,151,
-    151,154,158,163,170,177,182,187,191,197,202,206,208,204,194,179,
-    160,140,121,108,101,103,110,121,133,139,142,140,133,127,121,115,
-    112,115,121,128,134,138,138,136,133,130,130,132,137,144,151,158,
-    163,168,173,179,185,190,192,191,185,174,159,143,126,116,111,113,
-    121,133,146,154,156,154,147,141,134,129,128,131,136,143,148,152,
-    152,149,145,142,142,148,155,163,172,180,186,190,193,196,200,203,
-    204,201,192,178,160,140,122,109,103,104,112,123,135,141,142,137,
-    130,124,120,118,119,123,129,134,139,141,138,133,128,124,123,126,
-    132,140,148,155,161,167,172,178,185,191,193,193,187,177,164,148,
-    132,120,113,114,121,132,145,154,157,154,147,140,134,131,132,135,
-    140,145,149,150,147,142,138,134,135,141,148,159,170,179,188,194,
-    198,203,207,209,209,205,196,182,164,144,125,113,106,104,112,121,
-    128,137,138,130,122,115,112,114,120,127,134,140,142,142,139,132,
-    126,121,119,121,128,137,146,155,163,170,177,185,191,196,197,194,
-    186,174,159,143,129,119,114,117,125,136,146,152,153,149,141,133,
-    128,128,132,138,146,152,156,157,154,149,143,138,135,137,144,152,
-    162,173,184,194,204,211,216,216,211,202,188,172,155,140,127,118,
-    115,116,119,124,129,130,129,124,118,111,108,111,119,129,138,144,
-    147,146,140,133,126,119,117,119,125,133,142,153,163,172,181,190,
-    196,198,196,189,178,164,151,137,129,123,122,129,135,142,149,155,
-    154,149,142,135,129,126,128,135,144,151,155,155,152,148,142,138,
-    137,139,143,151,160,171,182,192,204,213,217,217,211,199,183,166,
-    149,136,128,123,124,126,130,133,133,132,126,120,114,108,105,107,
-    111,120,129,136,141,143,140,136,132,129,126,126,128,132,139,147,
-    157,168,180,192,201,205,203,194,181,165,149,136,128,125,127,133,
-    140,146,149,148,145,139,133,128,124,122,123,129,137,145,152,155,
-    154,153,152,151,152,154,156,158,161,165,174,185,199,212,222,225,
-    219,206,188,167,147,131,121,116,117,124,130,135,137,134,127,117,
-    108,101,98,101,108,118,129,138,144,146,146,144,143,143,143,144,
-    142,140,139,140,144,153,167,181,194,201,201,195,180,165,147,130,
-    122,119,120,129,140,149,155,157,154,146,136,127,121,118,120,126,
-    134,143,151,158,161,162,161,160,161,162,162,162,162,161,165,173,
-    183,195,207,214,216,210,198,180,157,137,122,114,114,120,129,137,
-    141,140,134,124,113,103,97,96,101,111,122,131,139,145,149,149,
-    149,149,151,153,152,150,145,141,139,143,152,165,180,193,200,200,
-    193,180,162,143,127,116,113,117,127,139,149,156,156,151,142,131,
-    121,116,116,122,131,141,150,156,161,165,168,170,172,172,172,169,
-    165,161,161,165,174,185,196,205,208,205,196,182,164,146,130,119,
-    113,113,118,125,132,135,134,128,118,109,101,99,103,112,123,133,
-    142,146,148,149,149,151,154,154,154,152,148,145,143,144,151,161,
-    173,184,190,193,188,179,166,147,132,118,110,112,120,130,142,153,
-    157,153,145,135,125,120,119,124,134,145,154,160,163,168,172,175,
-    177,177,175,172,168,166,166,168,173,181,189,195,198,195,189,178,
-    162,146,130,118,110,109,112,120,128,132,134,130,124,118,110,107,
-    109,117,126,138,147,152,154,154,155,156,155,154,153,150,147,144,
-    144,146,150,158,166,175,181,182,180,171,158,143,129,118,109,110,
-    116,126,139,150,157,159,157,151,143,137,134,136,142,150,159,164,
-    166,169,170,172,172,170,169,164,160,160,161,162,167,175,182,188,
-    190,190,185,175,162,149,135,122,114,110,111,115,123,130,135,136,
-    134,129,123,120,119,122,129,136,143,148,148,149,148,149,150,150,
-    150,151,149,147,146,148,151,156,163,169,175,176,173,167,157,145,
-    133,122,115,113,115,122,132,143,152,157,157,153,148,144,141,143,
-    148,155,161,166,168,168,167,167,167,166,165,164,164,163,163,165,
-    168,172,178,183,186,185,180,171,159,147,136,126,118,114,114,117,
-    122,128,132,135,134,132,129,127,127,129,135,141,145,147,146,144,
-    141,143,145,146,150,151,152,154,158,150,152,158,158,170,174,169,
-    167,167,153,138,131,127,123,121,120,120,128,137,148,156,161,160,
-    155,147,148,138,130,166,170,146,134,172,209,156,102,117,158,191,
-    203,182,152,145,156,155,134,125,147,184,213,217,202,179,150,111,
-    65,23,0,2,27,65,106,146,179,200,202,185,156,123,90,61,
-    41,33,36,50,74,105,137,166,186,198,200,191,174,153,132,117,
-    109,106,108,113,117,118,117,114,111,108,107,109,114,121,128,133,
-    135,136,134,131,128,125,125,126,130,136,142,147,151,154,157,162,
-    168,173,176,178,177,174,170,165,159,155,154,154,154,151,144,136,
-    127,119,115,113,115,118,124,129,133,134,133,129,124,119,114,112,
-    113,116,120,125,129,132,133,134,136,140,147,154,160,164,164,161,
-    158,152,145,142,141,143,145,146,143,136,130,122,114,112,113,117,
-    124,132,140,146,148,148,145,140,137,135,133,135,141,146,152,157,
-    158,162,166,171,175,180,184,183,180,176,171,164,158,154,153,153,
-    154,152,147,140,131,123,116,112,112,116,122,128,132,134,133,129,
-    124,118,114,113,115,120,127,133,137,138,138,138,140,146,154,160,
-    164,165,163,159,154,146,141,138,137,140,143,143,141,137,128,117,
-    109,105,106,113,124,135,146,154,157,156,151,144,138,135,134,137,
-    144,152,158,162,166,167,169,172,175,178,178,176,172,166,160,155,
-    153,151,152,154,153,152,148,140,129,121,112,109,111,118,126,136,
-    143,143,143,136,127,119,115,112,115,123,130,135,138,138,138,138,
-    140,145,151,157,162,163,161,155,149,143,140,138,139,142,144,145,
-    142,136,127,117,109,105,108,117,129,143,153,159,160,153,146,139,
-    133,129,131,138,144,154,160,163,166,169,170,170,173,176,177,176,
-    173,167,160,153,149,148,149,151,153,152,146,138,128,118,112,110,
-    113,122,133,142,149,150,146,139,129,122,117,115,117,121,127,131,
-    134,135,135,137,141,146,153,159,163,163,159,153,147,142,139,140,
-    143,146,148,147,140,131,121,112,105,105,112,124,139,152,162,165,
-    162,154,144,135,127,126,130,136,144,151,157,160,162,162,163,165,
-    169,173,175,174,171,167,161,157,156,156,157,158,155,150,141,131,
-    122,114,111,113,120,131,142,151,155,152,144,134,123,115,111,111,
-    116,122,128,132,135,137,138,139,141,146,153,159,164,164,162,158,
-    153,149,148,148,148,147,142,135,127,117,111,108,109,115,126,139,
-    149,157,158,154,149,142,134,130,130,133,140,148,153,157,160,159,
-    158,156,156,160,166,171,174,175,174,172,169,165,162,159,154,148,
-    141,134,125,119,116,117,121,128,137,146,151,153,150,143,134,126,
-    120,117,118,122,127,132,136,137,135,131,129,128,132,139,148,157,
-    164,167,168,166,163,160,156,150,144,136,128,120,114,111,111,116,
-    124,133,142,149,153,154,150,145,139,135,133,134,138,142,148,154,
-    156,155,152,148,146,146,149,156,166,175,180,182,181,178,173,166,
-    161,153,146,137,128,121,118,118,120,126,132,138,145,149,149,146,
-    143,138,134,132,131,131,133,135,137,137,135,130,124,118,116,117,
-    124,135,148,160,169,173,173,170,166,160,153,146,139,131,124,119,
-    116,117,121,125,131,137,141,146,147,148,147,146,145,145,145,147,
-    149,152,153,153,150,144,138,133,132,135,142,154,166,177,185,187,
-    185,181,175,168,160,152,144,134,127,123,121,122,125,129,133,135,
-    138,140,141,141,143,141,140,141,141,140,140,140,139,136,131,124,
-    118,114,113,118,127,141,154,164,173,176,173,168,161,154,147,139,
-    135,130,124,121,121,122,125,129,132,136,139,143,146,149,151,152,
-    152,151,150,150,151,152,152,150,146,140,134,130,130,135,144,155,
-    166,176,181,182,181,175,169,162,157,152,147,141,134,129,124,123,
-    124,126,126,129,133,134,137,141,145,148,149,148,145,144,142,139,
-    136,132,129,124,120,118,119,124,133,143,154,164,169,170,168,162,
-    156,150,145,141,138,134,130,127,125,124,126,129,133,137,140,143,
-    146,150,153,155,157,155,153,151,149,148,147,145,142,138,134,131,
-    132,137,145,155,165,173,177,178,176,172,167,161,156,153,149,145,
-    141,137,132,128,126,123,122,123,124,127,132,139,146,150,151,151,
-    148,145,143,140,140,137,134,130,127,125,126,132,139,148,155,161,
-    162,162,158,153,149,143,140,139,138,136,136,135,134,133,132,132,
-    132,133,134,138,143,148,154,158,160,159,158,157,155,153,150,147,
-    143,137,132,130,132,139,146,154,161,166,168,167,165,162,159,156,
-    153,151,149,149,147,145,142,138,133,129,126,124,123,125,131,139,
-    145,150,152,151,147,143,140,138,137,137,136,133,131,130,131,135,
-    142,150,155,157,157,155,152,148,146,144,142,141,141,141,140,139,
-    138,137,135,134,132,133,134,137,142,148,153,157,159,158,156,155,
-    153,151,151,150,148,144,138,135,135,139,145,152,158,161,162,159,
-    158,155,152,150,149,148,148,148,147,146,144,142,138,133,128,124,
-    123,125,131,136,144,149,151,152,149,147,144,143,142,141,139,135,
-    132,131,131,135,139,146,151,153,154,151,148,146,144,142,142,142,
-    141,141,143,144,143,140,138,136,133,133,133,136,141,147,153,157,
-    159,159,157,156,154,153,152,151,149,145,139,134,133,135,140,146,
-    151,155,155,155,154,153,153,153,153,153,152,151,150,150,150,146,
-    142,136,129,124,122,122,126,133,140,145,149,150,150,150,149,147,
-    146,144,140,136,132,129,130,134,138,144,147,149,148,147,146,146,
-    146,146,147,146,145,145,145,147,148,147,145,140,135,133,131,131,
-    135,141,146,152,157,158,159,159,158,157,155,155,150,145,140,137,
-    135,136,139,142,144,146,147,148,151,154,157,159,159,157,154,153,
-    152,151,151,148,144,138,132,126,122,120,121,125,131,137,143,148,
-    150,151,151,149,149,148,146,143,139,134,132,133,136,138,140,141,
-    139,140,142,145,151,153,153,152,151,150,149,150,151,151,149,145,
-    140,134,130,128,130,134,139,146,152,157,159,160,160,160,160,158,
-    155,151,144,138,135,134,135,137,138,139,140,141,144,150,156,162,
-    165,167,165,162,159,155,151,146,141,134,130,126,121,118,119,121,
-    126,132,138,143,147,150,152,153,153,153,151,148,142,136,133,132,
-    132,133,134,134,134,135,138,144,151,159,164,168,168,165,160,155,
-    151,147,143,140,137,134,131,130,130,131,135,138,143,148,153,158,
-    159,161,162,162,157,152,147,145,142,135,132,133,136,137,137,136,
-    138,142,152,159,167,171,175,173,169,160,152,141,133,126,121,117,
-    116,115,114,124,132,126,131,139,136,153,129,157,185,163,135,153,
-    178,135,116,136,152,125,105,104,119,118,106,97,104,123,145,166,
-    188,205,213,211,202,189,170,151,137,128,120,117,114,113,112,112,
-    112,115,119,126,136,145,152,157,158,154,146,136,126,118,114,115,
-    119,126,135,146,159,175,190,204,213,215,207,192,172,150,131,116,
-    106,104,107,115,127,140,152,160,163,159,151,139,126,113,102,92,
-    84,78,75,75,77,83,95,111,130,151,169,183,189,189,185,180,
-    176,173,171,165,156,144,131,119,112,109,114,125,140,159,177,191,
-    201,204,198,182,163,141,118,99,85,78,76,81,88,96,107,117,
-    128,140,155,170,184,194,199,196,191,183,177,172,168,163,155,145,
-    137,130,127,126,131,139,148,160,172,183,189,188,179,161,138,112,
-    87,68,55,50,54,64,78,93,106,117,127,135,144,156,168,179,
-    184,184,180,173,165,159,155,150,145,140,136,133,134,135,139,146,
-    155,167,180,192,201,204,199,185,164,139,114,91,76,67,68,77,
-    90,108,125,138,146,154,159,164,173,181,189,192,192,187,181,174,
-    165,158,151,144,140,137,138,139,145,154,162,170,179,187,191,190,
-    182,166,143,116,91,68,52,45,46,57,73,92,111,127,136,141,
-    144,147,154,162,171,176,179,177,172,166,157,150,144,140,138,139,
-    143,148,155,162,169,176,181,187,190,191,186,175,158,137,115,95,
-    78,68,67,73,87,104,122,138,150,156,159,161,165,171,180,187,
-    192,192,189,183,175,166,157,151,147,146,148,152,157,164,170,175,
-    179,181,181,179,171,158,139,119,96,76,61,50,48,54,66,82,
-    102,122,137,148,152,153,154,156,161,168,173,176,176,173,167,159,
-    153,147,143,143,144,149,157,163,171,177,181,184,184,182,174,162,
-    148,130,113,96,83,75,72,76,86,101,118,136,152,162,168,169,
-    169,170,174,180,186,192,194,189,183,175,165,157,148,146,150,154,
-    158,164,172,179,183,184,182,176,168,156,140,121,101,82,68,58,
-    54,59,70,86,104,122,137,148,153,153,151,150,151,155,161,169,
-    175,177,175,170,163,155,149,145,144,148,155,164,172,180,184,186,
-    184,178,170,159,146,131,116,103,92,83,79,82,88,98,111,125,
-    140,153,163,167,168,168,168,172,178,185,193,197,195,188,179,168,
-    159,153,151,152,157,165,174,181,186,186,183,175,164,150,133,116,
-    100,84,70,63,59,62,69,81,95,110,125,139,149,154,153,151,
-    149,151,157,166,176,182,183,179,170,161,152,147,145,147,152,160,
-    169,177,182,183,181,173,164,151,138,125,112,100,90,84,82,84,
-    90,99,111,123,136,150,160,166,168,167,166,166,171,180,189,196,
-    197,194,185,174,163,157,155,155,160,168,178,186,191,193,187,177,
-    162,146,130,115,100,87,76,68,65,66,72,81,93,107,121,135,
-    145,151,153,151,149,149,155,163,174,182,186,184,176,165,154,148,
-    145,147,153,163,174,184,190,190,185,175,161,147,131,117,106,95,
-    87,82,82,84,91,100,110,121,135,147,157,164,167,166,166,167,
-    171,180,190,198,201,198,191,179,167,159,155,155,161,170,180,189,
-    195,195,189,178,162,145,128,113,98,87,78,70,68,69,72,81,
-    93,105,119,134,144,150,152,150,147,148,153,161,171,180,184,183,
-    177,169,159,152,148,148,153,162,174,184,192,192,186,175,161,146,
-    131,117,104,93,85,80,79,80,86,95,106,118,133,146,157,165,
-    167,165,166,167,171,179,188,194,198,196,188,179,170,162,158,159,
-    165,175,187,197,202,200,191,177,161,143,127,112,99,86,76,69,
-    66,67,72,79,89,102,116,130,141,147,150,149,149,151,157,167,
-    177,185,187,184,177,169,160,153,150,151,157,167,178,189,196,194,
-    186,173,157,140,124,110,98,87,79,74,74,77,83,94,106,121,
-    135,149,159,164,166,165,165,167,173,182,190,196,197,193,186,178,
-    172,168,166,168,173,181,190,198,201,198,190,175,158,141,125,111,
-    96,84,76,69,66,66,69,77,89,105,119,132,144,153,155,154,
-    154,155,161,170,178,184,186,183,177,169,162,157,154,154,158,166,
-    177,186,192,191,184,171,155,139,123,109,96,85,76,71,72,75,
-    82,93,106,122,137,151,162,168,169,170,171,173,178,184,192,194,
-    193,189,183,177,171,167,166,168,174,182,190,197,200,197,188,175,
-    159,141,124,109,95,83,73,66,63,64,69,79,92,107,122,136,
-    147,153,155,156,157,161,167,174,180,184,183,179,173,166,160,156,
-    153,154,158,165,175,183,188,187,182,171,155,138,121,104,90,79,
-    71,68,70,76,85,96,109,123,136,148,158,166,169,171,172,176,
-    181,187,191,192,191,187,181,175,169,166,165,166,171,178,187,195,
-    198,197,190,179,162,144,126,109,92,81,72,67,66,69,76,86,
-    95,108,120,131,141,148,154,157,160,164,169,175,180,183,183,181,
-    176,171,164,158,154,154,158,165,173,182,187,188,182,171,156,139,
-    120,102,87,77,71,68,71,78,86,97,109,121,133,144,154,161,
-    167,172,176,180,184,189,192,193,192,191,187,181,174,168,164,163,
-    166,172,182,191,196,195,189,177,160,142,123,106,91,80,73,69,
-    69,74,80,88,98,109,119,130,139,146,152,156,160,165,171,176,
-    182,186,188,189,186,179,169,160,153,151,152,159,169,178,184,184,
-    182,171,154,137,120,102,87,78,73,71,72,78,86,95,107,119,
-    131,142,152,158,163,168,172,178,183,189,194,196,198,198,195,187,
-    179,170,164,164,167,173,180,187,191,189,182,171,156,139,121,105,
-    92,81,76,70,70,75,80,88,99,111,123,133,140,145,149,153,
-    158,166,172,179,186,192,195,195,190,181,170,160,153,150,152,157,
-    164,171,175,176,172,162,150,135,118,105,94,85,79,76,74,77,
-    84,94,108,122,133,143,150,153,157,163,169,177,184,191,199,205,
-    207,205,200,192,182,173,166,164,165,169,174,178,181,180,175,166,
-    154,140,126,112,101,92,83,76,72,72,75,85,98,111,123,132,
-    136,140,143,149,154,162,172,183,192,198,200,197,193,186,176,167,
-    160,156,156,158,160,162,163,164,159,152,145,136,124,110,101,93,
-    83,75,70,71,80,94,110,123,136,146,153,156,159,161,166,173,
-    182,192,202,211,215,216,210,201,190,180,172,166,164,164,166,168,
-    170,170,169,165,156,145,129,120,109,93,81,70,68,71,78,88,
-    103,117,127,131,135,139,143,146,151,158,168,179,189,199,205,207,
-    206,197,185,175,166,153,145,151,156,155,148,156,156,154,152,129,
-    117,105,90,74,67,62,62,71,89,105,117,130,141,147,149,148,
-    147,150,158,170,186,201,213,220,222,220,213,204,192,179,167,157,
-    151,149,151,155,161,164,165,161,154,142,127,110,92,76,64,58,
-    58,64,75,89,104,117,130,139,146,150,154,157,160,166,174,182,
-    189,195,199,199,198,192,182,172,161,153,147,147,150,153,157,161,
-    161,155,144,132,120,103,85,71,64,64,72,83,96,111,127,140,
-    149,153,155,156,158,162,167,177,189,201,211,217,219,217,211,202,
-    191,178,168,160,156,156,159,163,166,169,167,161,150,135,119,101,
-    85,73,66,65,70,79,91,103,116,127,136,143,148,151,153,156,
-    161,167,174,182,188,194,198,199,197,191,182,172,162,153,147,145,
-    146,150,154,156,155,150,140,127,111,95,83,73,71,76,83,95,
-    108,121,131,140,146,148,152,155,157,163,170,178,186,194,202,207,
-    209,210,209,203,193,183,172,162,155,153,153,155,157,158,157,152,
-    142,130,116,100,86,77,73,73,81,89,99,110,121,129,136,141,
-    144,147,151,156,161,169,175,181,187,190,192,194,194,190,183,174,
-    163,155,149,145,145,147,149,150,149,143,133,120,105,90,78,72,
-    73,79,89,102,115,126,135,142,148,150,153,156,160,166,173,183,
-    191,198,204,207,207,206,202,196,188,180,171,163,158,155,153,153,
-    153,151,147,141,131,118,105,90,80,76,77,83,93,104,114,123,
-    131,136,141,145,147,149,152,158,165,173,180,186,190,191,190,188,
-    185,180,174,167,158,151,147,145,144,144,145,145,142,135,126,113,
-    100,89,80,78,82,92,105,119,131,140,147,150,152,153,151,152,
-    156,164,173,179,187,196,202,204,203,198,192,187,182,176,169,164,
-    161,161,160,158,155,150,142,132,122,110,99,89,82,80,84,92,
-    103,115,127,135,140,142,143,142,139,140,146,154,160,170,181,189,
-    191,193,192,187,182,175,169,163,158,154,150,146,144,142,139,134,
-    129,121,113,105,97,91,87,86,90,99,110,123,136,147,154,159,
-    160,158,156,155,158,162,171,181,190,199,205,206,203,197,189,181,
-    173,167,164,161,159,157,154,151,147,141,134,126,119,111,104,97,
-    92,91,93,98,107,118,129,140,147,150,152,151,149,149,152,157,
-    165,174,182,189,192,190,186,179,171,163,156,151,147,146,145,146,
-    145,144,141,135,128,119,112,103,98,94,92,93,98,106,116,130,
-    142,154,162,165,162,158,158,156,156,159,170,181,192,200,202,200,
-    197,190,180,171,165,162,161,161,162,160,158,154,148,139,129,120,
-    111,105,99,96,96,98,102,109,117,126,135,143,147,149,148,145,
-    143,143,146,153,165,177,186,195,198,195,189,178,167,157,151,145,
-    143,143,144,145,144,142,139,132,124,116,107,99,94,90,90,93,
-    100,111,124,138,150,158,163,165,163,160,157,157,159,165,174,186,
-    196,204,208,205,197,187,177,167,161,156,154,154,155,155,154,151,
-    145,139,130,120,110,102,95,91,92,95,104,115,128,141,151,157,
-    158,156,153,151,149,148,152,158,167,177,186,192,193,189,181,170,
-    159,150,144,141,141,142,143,143,142,139,136,130,122,114,104,96,
-    91,89,92,98,110,124,138,153,165,170,171,167,162,156,153,155,
-    159,167,176,186,195,201,203,198,190,180,170,161,155,152,152,152,
-    153,153,152,148,144,138,131,122,113,104,98,94,95,100,109,121,
-    135,149,160,166,165,160,152,145,142,145,151,161,171,181,187,191,
-    192,186,179,168,157,147,140,136,136,137,137,137,135,133,130,125,
-    121,114,107,100,96,95,98,106,117,129,144,159,171,176,176,170,
-    161,152,148,150,158,171,183,193,200,202,200,195,187,176,166,156,
-    148,145,146,146,147,150,150,147,142,137,130,123,115,106,100,98,
-    100,105,115,128,141,153,163,171,171,164,153,142,136,138,146,159,
-    173,185,195,198,195,188,177,166,152,139,131,128,128,132,136,138,
-    137,135,132,127,120,112,106,103,102,106,112,119,129,141,151,158,
-    165,167,166,163,157,151,149,152,161,175,189,201,208,209,205,196,
-    185,173,161,150,142,139,138,140,142,144,144,143,141,136,130,121,
-    113,106,103,103,108,116,126,137,147,154,159,162,161,157,153,150,
-    148,150,156,166,176,186,192,193,189,182,172,161,149,139,131,126,
-    125,126,128,131,133,133,132,128,123,116,110,106,105,107,113,123,
-    133,144,152,159,163,164,163,160,156,153,154,158,164,174,184,193,
-    199,202,200,193,183,171,160,149,141,136,134,136,137,137,139,140,
-    139,136,130,124,118,112,110,112,116,122,131,141,149,154,156,156,
-    154,151,148,148,151,156,164,173,182,189,194,195,191,183,172,160,
-    147,136,127,121,119,119,121,124,127,130,131,131,127,123,117,113,
-    111,112,117,124,136,146,154,160,162,162,160,158,157,156,160,164,
-    170,179,187,194,198,198,194,188,178,168,157,147,139,133,129,129,
-    130,132,134,136,137,137,135,131,127,123,121,119,122,127,133,142,
-    149,153,154,155,154,152,151,152,155,161,169,177,183,188,190,187,
-    182,177,169,158,148,137,129,123,120,119,120,123,125,128,131,133,
-    132,130,126,122,120,120,122,128,135,143,150,155,158,158,157,156,
-    157,158,161,167,176,184,192,197,198,196,190,184,176,167,157,148,
-    138,131,127,125,125,127,130,131,133,134,133,132,131,128,125,125,
-    126,130,135,140,146,151,153,155,155,155,155,157,160,165,172,179,
-    186,189,188,185,179,172,164,156,147,138,130,123,118,117,118,119,
-    120,122,125,128,131,133,133,133,132,130,130,133,137,143,149,155,
-    158,159,160,161,160,161,163,167,174,181,188,193,195,193,188,182,
-    175,167,157,146,137,130,125,123,122,123,125,126,129,131,134,136,
-    137,136,135,133,131,132,135,140,144,149,155,158,159,159,158,158,
-    160,161,165,170,177,183,185,183,177,174,169,159,150,139,130,125,
-    121,117,113,115,120,123,124,128,132,137,142,144,142,139,139,138,
-    138,138,140,144,150,156,161,165,168,170,171,173,174,176,180,182,
-    181,181,180,175,169,164,157,148,141,136,132,130,128,126,124,126,
-    127,128,131,133,134,135,135,135,135,136,138,141,145,150,155,158,
-    160,161,161,159,158,157,161,166,171,177,182,183,181,177,170,161,
-    150,141,132,127,126,125,120,120,120,117,121,124,125,131,137,139,
-    139,143,147,150,150,149,149,150,153,157,160,162,161,159,156,158,
-    157,161,177,184,182,181,194,195,175,150,140,145,149,141,128,123,
-    121,120,118,115,115,125,138,149,156,159,158,152,141,127,114,108,
-    108,113,124,138,154,166,174,176,173,166,161,155,153,152,155,159,
-    162,166,169,169,164,158,151,146,138,129,123,119,115,113,113,114,
-    117,121,125,129,131,133,136,139,142,144,147,150,153,157,158,160,
-    159,158,158,155,156,161,167,172,179,186,186,184,182,179,173,166,
-    160,155,149,144,138,131,125,119,116,116,116,118,122,126,130,134,
-    140,145,151,156,159,161,162,161,161,159,157,153,148,145,145,148,
-    153,162,170,178,182,183,182,179,174,166,158,149,140,133,126,120,
-    117,114,113,114,116,121,126,131,134,138,142,145,150,154,158,160,
-    161,161,159,158,157,154,152,151,152,155,161,170,179,186,190,191,
-    190,187,182,175,166,156,146,137,130,124,121,120,120,121,124,126,
-    128,130,131,133,135,139,144,151,156,159,159,158,156,154,152,149,
-    147,146,147,150,155,161,169,174,175,175,175,173,168,165,162,155,
-    146,136,128,123,119,117,116,116,118,122,126,128,129,130,133,138,
-    145,152,160,167,169,168,165,161,157,152,149,147,147,151,157,164,
-    172,178,181,183,183,182,180,177,170,161,151,141,133,128,125,125,
-    124,124,123,123,124,126,127,130,134,140,147,154,161,164,165,164,
-    160,155,151,147,144,144,145,148,153,157,161,163,163,164,167,170,
-    172,172,168,161,152,143,135,127,124,122,123,121,120,121,122,125,
-    124,124,131,138,145,153,160,165,164,161,160,159,156,152,150,149,
-    149,151,153,155,158,160,163,168,173,177,180,179,175,168,159,149,
-    143,136,132,129,128,126,123,121,119,119,119,122,127,134,143,151,
-    158,162,165,164,160,156,151,147,145,146,148,150,153,153,154,154,
-    155,156,160,164,168,170,169,165,158,152,145,138,132,127,124,121,
-    118,115,114,114,117,123,131,140,151,160,167,171,172,170,165,160,
-    156,152,150,150,151,152,153,153,153,154,155,158,162,168,173,176,
-    175,171,164,157,150,143,138,134,131,128,124,120,118,117,120,125,
-    133,143,152,160,166,168,168,165,161,156,152,148,146,145,145,147,
-    148,148,148,148,149,151,154,160,167,172,171,169,163,156,150,143,
-    137,133,129,125,122,120,116,116,118,125,133,141,151,161,166,169,
-    168,165,163,161,159,156,154,151,150,149,148,147,145,144,145,148,
-    155,163,171,178,181,176,170,163,155,146,140,135,131,127,123,119,
-    117,117,119,125,134,145,155,162,166,168,166,164,161,158,156,153,
-    150,147,144,142,142,140,139,139,140,143,149,157,164,169,171,171,
-    168,164,159,152,146,139,133,127,123,120,118,118,122,130,139,150,
-    159,164,167,167,166,164,163,162,160,157,153,149,144,141,138,136,
-    135,136,140,146,154,162,170,174,175,174,171,166,160,154,149,142,
-    136,131,125,120,117,117,120,126,135,145,154,159,162,163,162,161,
-    160,158,157,154,151,147,142,138,133,130,128,130,135,142,151,159,
-    166,171,173,174,172,169,165,159,152,145,138,130,124,120,117,117,
-    123,130,137,148,156,162,166,167,166,166,165,164,162,159,155,150,
-    145,139,133,127,125,126,130,138,148,159,167,174,178,179,177,174,
-    169,162,154,145,137,129,122,117,115,115,119,127,136,146,154,160,
-    162,164,165,163,161,158,154,151,148,144,139,134,129,124,121,123,
-    130,139,150,160,168,173,176,177,175,172,168,162,157,149,142,135,
-    128,122,118,119,122,128,137,146,154,160,164,167,168,170,169,167,
-    163,160,155,151,144,135,127,121,118,119,127,139,151,162,172,178,
-    181,181,178,174,169,163,156,147,138,128,121,117,112,111,115,123,
-    135,146,152,157,162,164,165,164,163,161,158,155,150,143,137,128,
-    118,112,111,113,121,136,151,164,173,180,183,182,179,174,169,164,
-    156,147,138,129,122,117,114,115,119,127,138,148,158,165,169,171,
-    171,170,168,164,160,155,150,144,138,132,125,122,121,125,134,144,
-    155,167,174,178,179,178,175,172,168,164,157,149,140,131,122,116,
-    112,113,117,126,137,148,156,162,165,165,164,162,160,158,155,152,
-    148,144,139,134,128,123,122,125,131,141,151,161,168,171,171,169,
-    168,166,165,164,160,154,146,137,129,123,119,119,123,131,139,148,
-    156,162,165,167,168,167,166,164,161,157,152,146,139,132,126,122,
-    121,124,133,143,153,163,170,173,175,175,171,170,170,167,162,157,
-    148,137,125,117,115,115,120,128,137,146,153,159,162,162,161,160,
-    160,158,156,153,149,144,137,130,123,119,119,124,132,142,152,161,
-    168,171,169,167,165,161,158,157,155,151,145,138,131,126,123,123,
-    128,135,143,152,158,162,165,167,167,166,165,161,157,153,148,143,
-    138,132,126,124,124,129,137,146,155,162,167,169,168,167,166,166,
-    167,166,164,159,152,143,134,126,121,121,124,131,139,147,154,159,
-    161,162,162,160,157,154,150,146,143,140,135,129,125,122,121,126,
-    134,144,153,161,167,169,169,167,165,164,162,161,157,153,147,140,
-    134,128,125,125,129,136,144,152,159,163,165,167,167,166,163,158,
-    152,147,141,136,133,130,128,125,127,134,143,154,163,169,172,172,
-    170,167,164,162,161,160,157,151,145,138,132,127,124,125,130,136,
-    144,151,156,160,162,162,161,158,155,151,146,141,136,134,131,129,
-    127,128,130,136,144,152,160,167,170,169,167,164,162,159,156,153,
-    148,144,140,136,133,131,132,135,140,146,152,158,162,164,165,164,
-    161,158,155,151,146,142,136,133,130,129,129,132,136,143,151,159,
-    165,171,173,172,168,165,162,159,156,151,146,141,137,132,129,129,
-    131,134,140,147,154,159,162,162,159,156,152,147,144,143,140,135,
-    133,133,132,130,132,135,139,144,152,161,167,171,172,170,166,162,
-    157,152,148,144,143,138,135,134,133,135,139,144,150,157,163,166,
-    167,166,163,158,153,147,144,143,141,139,136,134,132,132,135,138,
-    144,150,157,164,169,171,171,169,165,161,157,153,150,147,143,139,
-    136,133,133,135,140,146,153,160,165,168,168,163,156,147,140,134,
-    131,130,130,131,132,133,135,137,141,144,150,156,162,167,170,171,
-    170,166,161,154,147,142,138,135,134,134,134,137,141,146,153,160,
-    168,173,173,171,167,159,150,141,133,129,128,128,130,133,135,139,
-    143,147,151,154,158,161,163,166,167,165,162,158,152,147,142,139,
-    136,136,136,138,139,141,145,152,156,161,166,170,171,169,163,153,
-    143,136,124,119,118,117,128,127,143,151,148,145,157,168,156,154,
-    165,171,161,153,148,147,140,130,123,121,124,133,144,154,164,173,
-    177,178,178,176,172,168,164,157,150,142,133,126,121,118,118,120,
-    125,130,136,141,147,151,155,158,160,162,163,162,162,160,157,155,
-    152,150,148,147,147,148,151,154,156,158,158,159,159,160,162,163,
-    163,159,154,148,141,135,130,126,124,122,122,122,122,124,125,128,
-    133,139,146,154,162,168,173,173,171,166,159,149,142,135,131,131,
-    134,140,146,153,158,163,168,172,176,178,178,175,170,163,155,146,
-    137,129,122,117,115,115,118,122,129,137,145,153,160,166,171,174,
-    176,175,172,167,160,152,144,138,135,135,140,145,151,158,165,169,
-    173,176,177,175,172,166,158,149,141,134,125,118,112,107,105,105,
-    110,118,128,137,146,154,161,166,169,170,169,166,163,157,148,138,
-    133,130,128,131,140,149,158,166,173,178,181,181,180,177,173,167,
-    160,153,146,139,132,125,119,114,111,111,115,123,134,146,157,165,
-    169,170,171,170,169,167,163,159,153,147,141,139,139,141,146,154,
-    162,170,176,180,182,182,179,175,167,158,150,143,136,130,123,118,
-    114,110,109,110,114,121,130,141,151,159,163,164,163,161,160,156,
-    153,151,147,143,138,136,138,141,147,154,162,170,177,180,180,178,
-    177,173,165,156,149,145,141,136,132,128,125,124,124,123,125,129,
-    137,145,152,157,160,163,163,162,161,161,161,161,159,155,151,148,
-    146,146,150,157,164,170,176,181,182,181,178,173,167,159,150,141,
-    135,129,122,118,116,114,113,114,119,125,133,140,149,156,161,164,
-    163,159,155,152,148,144,142,139,138,139,142,149,158,167,175,181,
-    183,182,179,175,170,164,158,152,146,141,138,134,130,128,126,124,
-    123,124,127,131,136,142,149,156,163,166,166,164,161,157,152,148,
-    146,145,146,149,153,159,166,173,178,181,181,179,177,173,169,164,
-    158,152,146,139,133,129,125,122,121,119,119,121,124,127,132,138,
-    145,152,157,160,160,158,153,148,143,139,139,141,143,147,151,157,
-    163,170,175,176,176,176,173,170,167,163,159,153,147,143,138,134,
-    130,129,128,127,128,130,131,134,137,142,148,154,160,164,166,164,
-    159,153,146,142,140,142,146,151,158,165,172,177,180,182,181,179,
-    176,173,170,167,162,156,151,144,137,133,129,126,124,124,123,124,
-    125,127,131,135,139,144,149,152,154,152,149,144,139,136,135,138,
-    145,152,159,166,171,174,176,176,175,172,171,169,167,164,160,155,
-    150,144,138,134,129,127,126,126,125,126,126,128,132,136,141,147,
-    153,156,161,161,159,157,152,147,144,145,149,155,162,168,173,176,
-    178,179,178,176,174,171,169,166,163,158,152,145,138,133,130,128,
-    125,123,123,123,124,126,129,133,138,143,147,152,155,156,155,151,
-    146,140,138,139,145,150,156,162,167,169,170,170,169,169,170,171,
-    169,168,167,163,155,146,139,132,127,124,122,122,123,124,127,129,
-    134,138,143,147,151,155,158,159,158,155,150,147,144,145,149,155,
-    162,168,172,174,175,174,174,172,171,171,171,171,170,167,161,154,
-    146,138,131,126,122,120,119,119,121,125,129,135,140,145,149,153,
-    156,156,154,150,146,143,141,143,147,153,157,161,164,167,168,168,
-    168,166,165,165,165,166,166,164,158,152,144,137,129,124,120,118,
-    119,120,122,126,132,137,141,146,151,153,154,156,157,155,151,149,
-    148,148,150,155,160,165,168,170,171,170,169,169,170,169,171,173,
-    175,172,165,158,148,138,128,120,115,112,112,115,119,125,131,137,
-    142,147,150,152,154,153,151,149,146,142,143,147,151,155,158,161,
-    163,164,163,163,162,161,161,162,163,165,168,167,164,159,150,141,
-    131,124,118,114,113,114,118,123,129,135,141,146,150,154,157,158,
-    157,154,153,152,152,154,158,162,165,167,167,166,164,162,161,161,
-    161,163,166,170,173,175,175,171,163,153,143,133,123,117,112,110,
-    112,115,121,127,135,142,150,157,160,161,160,157,155,153,153,154,
-    157,159,160,160,159,158,156,156,155,156,157,159,162,164,167,169,
-    169,165,160,152,142,134,125,119,115,112,112,114,117,123,132,142,
-    150,158,164,165,163,159,157,157,157,158,160,163,165,165,164,163,
-    160,158,157,157,158,159,163,168,173,176,177,175,171,164,155,145,
-    134,124,115,109,105,106,110,117,128,139,150,158,163,164,162,158,
-    155,153,153,154,157,160,162,164,162,161,159,155,152,150,150,151,
-    155,160,165,169,172,172,170,164,156,145,133,121,112,104,100,101,
-    107,115,127,140,151,160,165,166,164,160,157,154,154,156,160,164,
-    167,168,166,164,160,156,153,151,152,154,158,163,169,174,176,176,
-    172,166,157,146,135,123,112,104,100,100,105,114,127,139,151,160,
-    165,166,164,161,157,154,154,156,158,162,165,166,166,163,159,154,
-    149,146,144,145,149,154,160,166,170,172,170,165,159,149,139,127,
-    117,108,104,105,109,116,127,138,147,154,161,163,159,157,156,156,
-    157,159,162,165,168,169,168,164,159,154,149,147,147,150,155,161,
-    167,171,174,174,172,167,160,151,140,130,120,111,106,104,105,110,
-    117,128,139,147,154,159,160,160,160,160,161,163,165,167,169,170,
-    169,166,161,155,148,144,142,143,147,154,160,165,169,170,168,164,
-    158,149,139,129,120,113,108,106,106,110,117,127,138,147,156,161,
-    164,165,165,165,166,168,169,169,170,170,168,163,158,152,146,142,
-    142,146,152,159,165,169,172,172,168,163,157,149,139,131,124,117,
-    110,108,108,111,117,126,136,145,153,159,162,164,165,165,166,168,
-    168,169,169,168,166,163,158,152,147,143,142,145,149,154,160,165,
-    167,167,165,163,159,153,146,137,128,121,115,111,109,111,116,125,
-    134,142,148,154,157,160,163,165,168,170,172,173,171,168,165,160,
-    155,150,146,145,146,148,153,159,163,166,168,167,165,163,158,153,
-    146,138,130,121,113,109,108,109,114,121,130,137,144,151,156,160,
-    165,168,170,173,175,175,175,172,168,162,156,151,147,144,144,146,
-    149,153,156,159,161,162,162,161,158,155,149,141,133,124,117,112,
-    111,111,114,120,127,133,140,147,155,161,166,170,174,177,179,178,
-    175,170,165,159,153,151,149,148,148,151,156,157,158,161,163,160,
-    160,159,156,152,148,140,131,125,116,111,111,112,114,120,126,133,
-    139,146,154,160,165,168,171,173,174,175,175,174,171,166,162,157,
-    148,145,146,146,142,139,151,160,162,157,156,157,156,160,156,145,
-    135,131,124,113,105,103,104,110,118,128,141,156,169,178,183,184,
-    182,179,175,170,165,162,160,160,160,160,160,159,158,157,156,155,
-    154,154,154,154,153,153,151,148,145,139,132,124,117,114,111,111,
-    114,118,125,133,141,150,157,163,168,171,173,175,176,176,175,174,
-    171,167,162,156,151,145,141,140,141,143,147,151,154,156,158,158,
-    155,152,146,139,130,123,117,113,112,115,118,123,130,137,143,148,
-    154,159,164,169,172,175,177,178,177,175,171,166,162,156,151,145,
-    144,147,148,149,152,153,156,158,156,153,151,149,143,136,128,120,
-    114,111,110,112,117,124,132,140,146,153,157,160,163,165,168,170,
-    172,175,177,177,176,173,169,162,155,148,144,141,141,142,144,147,
-    149,152,152,153,151,147,142,135,129,124,120,118,118,121,126,131,
-    138,144,149,153,156,159,162,165,169,173,176,177,177,175,172,168,
-    163,159,154,151,149,149,149,148,149,150,149,149,148,148,145,142,
-    137,132,126,121,119,119,120,124,128,132,140,147,152,155,156,156,
-    158,162,164,166,171,174,175,175,173,170,164,156,151,148,146,146,
-    146,148,149,150,150,149,147,146,144,140,135,130,126,123,122,123,
-    125,128,134,140,146,151,154,155,156,157,158,160,163,167,171,174,
-    173,172,169,166,161,157,154,152,152,153,153,154,154,152,148,146,
-    145,142,139,135,130,126,122,120,119,121,125,130,136,142,148,153,
-    156,156,154,153,153,153,157,162,168,173,175,175,172,169,163,158,
-    153,150,149,150,151,152,152,151,149,147,145,141,137,132,127,123,
-    119,119,121,125,130,137,144,150,156,160,161,160,158,156,156,157,
-    161,165,170,173,174,172,168,163,159,155,152,152,154,157,160,162,
-    162,159,155,150,144,138,133,127,122,118,116,117,119,124,131,137,
-    144,151,156,160,162,161,159,156,154,156,160,163,166,171,173,170,
-    164,158,154,151,149,148,149,153,158,160,160,159,156,151,146,140,
-    133,126,120,116,114,115,118,125,134,143,152,160,166,169,169,166,
-    161,156,152,152,154,157,160,163,165,165,163,159,155,152,153,155,
-    158,162,167,169,168,163,156,148,141,134,127,121,117,115,115,118,
-    122,129,136,143,150,155,159,162,162,160,157,154,152,152,155,159,
-    163,167,168,165,162,157,152,148,148,150,155,161,166,169,168,163,
-    154,145,135,127,119,115,112,113,116,120,128,137,145,153,159,163,
-    165,165,164,162,158,155,153,154,156,159,163,165,166,164,160,155,
-    151,148,148,151,157,165,171,173,171,165,156,145,135,126,119,114,
-    113,115,118,122,129,138,145,151,155,160,162,161,161,159,155,151,
-    150,150,153,157,161,163,165,164,161,156,152,150,150,152,157,162,
-    166,167,165,159,152,142,133,126,120,118,119,122,125,131,137,142,
-    148,152,156,159,162,164,164,162,160,157,155,154,155,158,161,163,
-    163,162,159,155,152,150,151,155,161,166,170,171,167,160,150,139,
-    128,120,116,114,116,119,125,131,137,142,147,152,156,159,161,161,
-    159,157,155,152,151,152,154,156,158,160,161,160,157,153,151,150,
-    152,154,158,162,165,166,161,154,145,135,126,122,119,117,120,125,
-    131,136,140,143,150,156,160,161,163,165,166,164,160,155,152,151,
-    152,154,157,161,163,164,163,160,157,154,152,152,154,158,161,161,
-    159,152,144,135,128,123,119,120,123,126,131,135,138,142,147,150,
-    153,156,159,160,160,159,157,156,154,153,153,155,157,159,160,159,
-    157,156,154,152,153,156,159,163,164,163,157,149,140,131,123,119,
-    118,120,124,130,135,140,144,148,151,155,159,162,163,162,162,161,
-    161,160,158,158,158,159,161,161,161,161,160,158,157,156,156,158,
-    160,161,161,158,154,148,140,132,125,121,119,120,124,128,134,138,
-    143,146,150,153,156,158,159,159,158,156,155,155,154,155,156,157,
-    158,159,161,160,158,157,157,157,157,158,158,157,157,156,151,146,
-    139,133,128,124,125,126,128,131,135,139,142,145,151,156,160,163,
-    165,166,166,165,163,161,160,159,158,158,158,159,160,161,162,163,
-    163,164,163,162,160,157,154,150,146,142,137,132,128,124,123,124,
-    126,130,134,138,144,149,153,156,159,160,161,161,159,158,156,155,
-    154,155,155,156,158,159,161,162,162,162,161,160,158,155,152,149,
-    147,146,143,142,139,136,133,130,128,128,130,132,135,140,144,148,
-    152,156,159,161,162,162,162,161,161,160,159,158,157,158,158,159,
-    161,163,163,162,162,160,159,157,154,151,148,144,141,137,135,133,
-    132,131,130,129,130,132,134,138,142,146,150,154,157,159,159,159,
-    158,158,157,156,154,153,153,151,153,156,158,160,163,164,164,164,
-    162,161,158,153,148,143,140,138,136,134,133,133,132,133,134,134,
-    135,138,143,146,150,154,158,161,163,164,164,164,164,162,160,157,
-    156,156,158,160,164,167,169,169,167,165,162,158,153,148,143,139,
-    135,133,133,134,135,135,135,135,134,134,134,136,140,144,149,153,
-    157,159,160,160,161,160,159,157,155,153,151,151,153,156,160,163,
-    166,168,169,168,165,162,158,152,146,141,137,133,131,130,131,133,
-    134,134,134,135,136,137,139,142,147,152,156,159,162,162,163,162,
-    160,158,155,155,156,157,160,163,167,171,174,175,173,169,165,159,
-    153,145,138,135,132,129,128,129,132,135,137,138,137,137,137,137,
-    138,140,143,148,152,157,160,163,165,166,166,164,161,159,156,154,
-    154,155,159,164,168,170,171,171,168,162,155,148,141,135,130,128,
-    128,130,133,136,139,141,139,137,137,138,139,142,145,149,153,156,
-    159,161,161,162,163,163,162,163,164,164,164,164,166,168,169,169,
-    167,164,161,157,151,144,138,133,130,128,128,130,134,137,138,138,
-    137,135,135,135,136,139,143,147,152,155,157,158,158,158,158,158,
-    159,160,162,163,163,164,165,166,168,168,166,163,159,154,148,142,
-    136,131,129,128,129,133,137,141,142,142,140,139,138,138,138,140,
-    144,148,150,153,156,156,156,157,159,161,164,168,169,169,169,171,
-    169,166,166,165,163,160,156,152,146,141,137,133,131,131,133,136,
-    139,142,143,142,141,139,137,137,137,139,141,143,146,149,151,151,
-    153,154,156,160,163,166,168,168,167,166,165,165,163,161,161,159,
-    156,154,150,144,140,136,133,134,134,134,136,139,139,138,139,138,
-    138,139,140,142,144,146,149,151,153,152,152,152,155,157,160,167,
-    170,168,168,174,174,168,157,154,162,168,161,152,149,145,139,133,
-    131,132,135,139,144,149,152,151,146,140,131,124,121,122,127,132,
-    140,147,153,158,160,159,158,158,158,158,160,163,165,168,170,171,
-    172,171,168,165,161,156,152,146,141,137,135,133,132,132,133,132,
-    132,131,131,133,133,136,141,146,151,155,155,155,154,151,148,147,
-    148,151,157,163,169,174,177,180,181,180,179,177,174,170,164,158,
-    152,146,140,136,133,132,132,132,132,132,133,134,135,137,140,144,
-    149,152,154,155,153,150,147,143,141,139,140,143,147,153,160,168,
-    174,178,181,182,181,178,174,169,162,155,148,141,136,132,129,128,
-    128,129,130,132,133,135,137,139,142,145,149,153,155,156,155,152,
-    147,143,140,138,139,141,146,151,161,171,178,183,187,189,187,184,
-    177,169,160,152,144,137,131,127,127,127,128,132,135,139,141,144,
-    147,147,147,148,149,149,149,146,143,140,140,140,141,142,142,143,
-    144,149,155,162,170,178,184,187,187,185,178,170,160,150,140,132,
-    128,125,126,127,129,132,135,137,138,138,138,140,142,145,148,151,
-    152,152,151,149,146,144,143,141,142,143,147,153,159,165,171,177,
-    182,186,186,183,178,171,163,153,144,136,130,128,128,128,128,130,
-    134,137,140,142,144,147,150,152,153,153,152,150,147,145,143,142,
-    141,142,142,143,146,149,152,156,162,168,173,179,183,184,182,176,
-    167,156,146,136,130,126,125,125,127,129,131,135,138,141,144,147,
-    150,153,154,155,154,152,149,147,144,141,140,140,141,144,148,153,
-    158,164,170,175,180,184,186,186,182,174,164,153,143,135,130,127,
-    126,126,128,131,134,137,141,146,150,154,156,158,159,158,155,150,
-    146,141,138,135,136,138,141,144,148,152,155,158,163,168,173,179,
-    184,186,183,176,166,155,144,135,129,126,125,126,127,129,132,135,
-    138,142,145,149,153,155,157,158,158,156,152,148,144,141,141,142,
-    144,146,150,153,157,161,166,170,173,176,179,180,179,174,166,156,
-    147,139,132,128,126,126,128,130,132,135,139,144,149,153,158,161,
-    163,163,161,157,152,146,141,137,135,136,138,140,143,146,149,152,
-    157,162,167,172,176,179,180,176,171,162,153,143,135,129,126,124,
-    124,125,127,130,135,139,145,152,158,163,166,167,165,161,155,148,
-    141,138,136,136,137,139,143,147,152,159,164,169,174,178,181,181,
-    179,175,168,160,152,144,137,130,127,125,124,124,127,131,137,144,
-    149,155,162,167,168,167,162,157,152,147,140,135,134,134,135,137,
-    139,142,147,152,156,162,167,173,178,180,180,176,170,162,152,143,
-    134,127,122,120,121,123,128,134,140,147,154,159,163,166,167,165,
-    160,155,150,145,140,138,137,136,137,139,142,146,150,155,161,166,
-    171,175,179,181,180,176,170,163,155,147,138,130,124,122,121,123,
-    127,133,141,148,154,160,164,167,167,165,160,154,149,144,138,134,
-    131,130,132,135,139,143,148,151,155,160,165,172,176,177,178,177,
-    173,166,156,147,139,130,124,119,117,120,128,136,143,149,156,162,
-    166,166,165,162,159,155,150,145,141,138,137,137,138,139,141,144,
-    148,152,155,162,169,176,181,183,183,179,172,165,155,145,136,129,
-    123,121,121,124,130,136,143,150,156,160,162,163,162,161,158,154,
-    149,144,139,136,134,133,134,136,139,143,146,150,155,159,164,169,
-    173,175,175,172,168,163,156,148,140,134,130,127,126,127,131,137,
-    142,147,153,157,160,161,161,160,158,155,151,148,143,139,136,135,
-    135,137,141,144,148,153,158,164,170,175,179,181,180,176,171,164,
-    156,148,140,134,130,129,128,130,133,136,141,145,148,151,154,157,
-    159,159,158,156,152,148,143,139,136,133,133,133,136,141,145,149,
-    153,159,166,171,174,175,175,173,169,163,154,148,142,136,132,128,
-    128,131,135,138,141,144,149,154,158,161,162,163,162,159,154,149,
-    144,139,136,136,136,137,141,146,150,155,160,163,168,173,176,176,
-    174,173,168,163,157,150,144,139,135,133,132,133,134,137,139,141,
-    144,148,152,157,159,160,159,156,153,147,142,138,135,133,132,134,
-    136,139,143,149,155,160,166,172,176,178,177,173,168,162,156,149,
-    143,138,135,134,134,135,136,138,140,141,143,145,148,152,156,158,
-    159,158,155,152,148,144,140,138,137,137,139,142,145,151,158,165,
-    172,177,181,181,179,174,168,161,154,148,143,138,135,133,133,133,
-    133,134,135,137,139,143,147,151,155,158,159,159,156,152,147,142,
-    138,137,135,135,137,139,142,148,154,161,167,173,177,178,177,175,
-    168,161,154,146,140,136,134,134,134,136,138,139,141,143,144,146,
-    148,151,154,156,158,157,155,152,147,143,140,139,139,141,143,146,
-    149,154,160,167,172,176,179,178,176,172,166,161,154,148,143,141,
-    139,137,137,137,136,136,136,137,137,139,142,146,151,155,158,158,
-    157,153,147,142,138,137,137,139,141,143,147,151,157,163,168,172,
-    173,173,172,168,163,158,153,147,142,139,138,137,137,138,139,139,
-    137,137,140,142,144,148,152,153,155,158,156,153,147,142,140,140,
-    142,144,147,150,152,154,158,162,166,169,172,174,173,172,168,164,
-    159,154,148,143,141,140,138,137,136,134,133,133,134,137,139,144,
-    148,151,154,156,155,152,148,143,139,139,139,140,143,146,149,151,
-    156,161,166,171,174,175,174,172,168,162,156,151,146,142,139,137,
-    136,137,139,139,138,138,140,142,144,147,151,152,154,154,152,150,
-    147,144,141,141,143,146,149,152,155,159,162,167,171,174,177,177,
-    174,171,165,159,153,147,143,141,140,140,140,140,139,138,138,137,
-    137,138,140,142,145,147,148,147,146,145,144,143,143,143,145,148,
-    150,152,155,156,158,162,166,169,171,171,169,166,162,156,150,146,
-    143,142,141,143,144,144,144,143,141,139,137,138,139,140,142,144,
-    146,147,147,146,146,145,145,147,150,152,156,160,163,163,163,164,
-    166,168,169,168,166,164,161,157,152,148,146,144,143,142,141,140,
-    138,136,135,133,132,132,135,137,139,141,143,145,145,146,146,145,
-    145,147,148,150,151,153,156,158,160,162,165,168,168,168,166,163,
-    158,153,148,144,143,142,142,142,143,145,146,146,145,143,141,140,
-    140,141,141,141,141,142,143,144,145,147,149,151,155,158,161,163,
-    165,165,165,166,167,167,168,168,167,164,161,157,153,149,146,143,
-    141,141,142,143,143,142,141,139,138,136,135,134,134,135,136,136,
-    139,142,144,148,147,154,159,159,158,164,168,162,161,165,166,162,
-    160,160,160,156,150,144,143,143,143,144,148,152,155,157,156,154,
-    150,145,142,139,136,134,133,133,135,138,140,143,146,149,153,156,
-    160,163,165,166,166,166,164,163,163,163,164,164,164,162,160,158,
-    155,154,153,152,151,150,149,148,145,142,138,135,133,132,131,132,
-    133,135,138,141,144,146,147,147,148,148,148,148,148,150,152,153,
-    155,158,160,164,167,168,166,164,160,155,152,149,148,148,148,148,
-    147,147,146,144,142,140,139,139,138,139,141,144,147,150,151,151,
-    152,151,151,152,154,153,153,155,158,161,162,164,166,169,171,171,
-    170,166,162,157,153,151,149,149,149,149,147,145,144,141,138,137,
-    136,135,135,137,139,140,141,143,145,145,144,143,142,143,145,147,
-    149,152,154,157,159,161,162,163,164,164,162,159,157,154,151,149,
-    150,150,152,153,152,151,149,146,142,140,138,137,138,140,144,148,
-    151,153,155,155,154,152,151,150,150,151,153,154,157,160,162,164,
-    165,167,169,169,167,164,161,158,155,153,151,150,149,149,148,146,
-    143,141,139,137,136,135,135,137,139,141,143,144,145,144,144,143,
-    142,143,145,147,149,152,155,157,159,160,161,162,161,160,159,156,
-    154,151,149,147,147,147,150,151,151,151,151,149,146,143,140,138,
-    137,137,138,142,146,150,154,156,156,155,155,153,153,154,155,156,
-    159,161,163,165,166,167,167,165,163,160,158,156,153,152,152,151,
-    150,150,152,150,148,144,141,138,135,133,134,135,137,140,143,146,
-    148,149,149,148,147,147,148,149,149,151,153,154,156,157,159,158,
-    157,157,155,154,152,152,152,151,151,151,151,151,150,149,148,146,
-    144,143,141,139,138,140,144,147,151,155,158,160,160,158,156,154,
-    153,153,153,154,156,158,160,162,163,164,164,163,162,161,160,159,
-    158,156,155,154,153,152,151,150,149,146,144,141,138,134,132,133,
-    135,137,141,145,148,150,151,151,150,149,147,147,147,148,149,151,
-    151,152,152,152,152,152,153,154,156,156,156,157,157,156,154,152,
-    150,147,144,143,141,139,137,137,137,140,143,148,153,157,159,161,
-    160,158,156,154,152,151,151,153,155,157,159,159,160,159,158,158,
-    157,158,160,162,163,162,161,159,156,152,148,145,142,140,139,138,
-    137,136,135,136,139,143,146,149,151,152,152,151,149,147,144,143,
-    143,144,146,148,150,151,151,151,151,152,154,156,159,161,162,162,
-    161,159,155,151,146,143,140,138,137,138,140,142,145,148,151,153,
-    156,158,158,157,155,153,152,151,149,148,149,152,154,155,157,157,
-    158,158,158,159,162,163,164,165,165,163,160,156,152,150,146,142,
-    139,138,138,139,139,141,143,146,148,150,152,151,149,147,145,143,
-    140,140,140,141,143,146,149,149,151,152,151,151,151,152,154,155,
-    157,160,160,159,158,156,153,150,147,144,142,140,141,143,144,146,
-    149,151,152,153,153,153,153,153,153,153,153,153,153,153,153,153,
-    154,153,153,153,153,153,153,155,158,162,164,165,167,167,165,162,
-    158,153,150,146,142,139,139,140,141,143,144,146,148,148,149,149,
-    149,149,149,148,146,144,142,140,139,139,139,140,141,143,145,147,
-    150,153,156,158,161,163,163,162,160,156,153,149,146,144,142,141,
-    141,141,144,147,149,151,153,154,154,154,154,153,152,151,150,149,
-    148,148,149,149,149,149,150,150,151,153,155,157,160,163,165,168,
-    168,166,164,160,155,151,147,144,142,142,142,143,145,148,150,152,
-    153,153,154,153,151,148,146,144,142,138,136,135,136,139,139,140,
-    142,145,147,149,150,150,154,157,160,161,163,163,162,159,155,152,
-    149,147,145,144,143,144,146,149,153,157,159,160,159,158,155,151,
-    148,146,143,141,141,142,144,145,147,149,151,153,154,156,158,159,
-    160,162,165,166,165,164,161,158,155,152,149,148,148,148,149,150,
-    151,152,154,155,155,154,152,150,147,144,141,139,138,137,138,139,
-    140,140,141,142,142,143,144,144,146,149,152,156,160,163,164,164,
-    162,158,155,152,149,147,146,147,148,149,151,154,157,158,159,158,
-    156,154,151,149,147,145,144,143,144,145,145,145,145,146,146,147,
-    149,152,153,155,158,162,163,165,166,166,164,161,159,156,153,150,
-    148,147,148,148,150,153,155,157,158,156,153,149,146,142,139,136,
-    135,134,135,136,136,136,137,138,138,139,140,142,145,149,152,156,
-    160,164,166,167,165,162,158,154,149,146,143,142,144,147,152,156,
-    160,163,165,164,161,156,151,147,143,141,139,139,140,141,141,142,
-    142,142,144,146,148,151,154,158,161,164,166,167,168,167,165,163,
-    159,155,152,148,147,146,147,150,153,157,160,161,162,160,157,152,
-    147,142,139,136,133,131,130,131,131,132,134,135,137,139,142,145,
-    148,151,154,157,159,161,162,162,160,159,158,155,152,150,149,149,
-    150,152,155,159,161,163,162,160,158,155,151,148,145,142,139,136,
-    135,136,136,137,139,141,144,147,150,154,157,160,162,164,164,165,
-    165,164,163,161,159,157,154,151,149,148,149,151,155,158,161,161,
-    161,160,156,151,148,145,142,139,135,133,131,128,127,126,128,130,
-    134,139,143,147,151,154,157,159,161,162,162,162,162,160,158,155,
-    151,149,147,146,148,152,156,161,164,166,166,165,162,158,154,151,
-    148,144,141,138,133,131,130,131,132,136,141,145,150,155,159,162,
-    165,166,168,168,168,167,165,162,159,155,152,150,149,148,149,152,
-    156,159,161,163,163,161,157,154,151,147,143,140,136,130,125,123,
-    121,121,124,128,133,138,144,149,153,155,157,159,160,162,162,161,
-    161,161,158,155,152,150,150,150,150,152,155,158,160,161,162,161,
-    159,157,154,152,149,145,140,135,130,127,125,126,130,136,142,148,
-    153,157,161,162,164,165,167,167,166,166,165,162,159,156,154,152,
-    151,151,152,153,156,159,161,162,162,161,157,153,150,146,141,137,
-    133,129,125,122,121,122,126,130,135,141,146,150,153,156,157,158,
-    160,161,161,161,160,158,156,154,154,153,153,154,154,156,157,159,
-    160,161,161,161,159,157,154,152,149,145,140,135,132,128,127,128,
-    132,136,141,147,152,156,159,161,163,163,164,165,166,165,165,163,
-    161,159,158,156,155,155,154,153,154,156,158,159,160,159,157,156,
-    151,147,142,137,132,126,123,121,121,121,125,130,135,141,146,150,
-    153,155,156,156,156,157,159,160,160,160,160,161,161,158,157,156,
-    153,150,148,152,157,160,160,160,159,157,157,154,147,141,138,134,
-    129,125,125,126,129,135,142,150,157,164,167,167,166,163,161,159,
-    159,159,161,163,166,169,170,168,165,160,154,150,147,145,146,147,
-    149,152,153,152,150,147,143,139,134,130,126,124,123,124,126,129,
-    133,138,143,148,151,154,156,158,158,159,160,162,163,164,164,164,
-    163,160,156,151,147,144,144,146,149,153,156,159,159,158,154,149,
-    144,140,137,135,134,134,134,135,137,140,142,145,150,154,157,160,
-    161,163,164,164,166,167,168,169,171,171,168,164,158,153,148,144,
-    141,142,145,149,151,153,154,153,150,147,142,138,133,130,128,126,
-    126,127,130,134,137,142,147,151,153,155,157,157,157,157,158,159,
-    162,164,165,167,167,163,158,153,149,145,143,143,146,149,152,154,
-    155,155,153,150,147,143,140,138,136,136,136,137,139,142,145,148,
-    151,154,157,159,160,161,161,163,164,166,168,170,171,171,169,166,
-    160,154,149,145,142,142,143,146,148,150,150,148,145,142,139,137,
-    134,133,132,132,134,134,135,137,140,143,146,149,151,154,155,156,
-    157,159,160,161,162,165,167,167,166,163,159,154,150,146,143,142,
-    143,145,148,149,150,150,149,146,144,142,140,140,139,140,141,142,
-    144,147,149,150,153,155,158,160,161,162,164,165,166,166,167,168,
-    169,168,165,162,158,153,149,145,144,144,145,147,148,148,148,145,
-    141,138,135,133,132,132,133,135,137,140,143,145,148,150,152,153,
-    154,155,156,157,157,159,160,162,163,164,163,162,161,157,154,151,
-    149,147,145,145,146,147,148,148,147,145,143,142,140,138,137,138,
-    139,141,143,146,149,152,155,157,158,159,161,161,162,162,162,163,
-    164,166,166,167,166,164,162,158,155,151,148,146,145,144,144,145,
-    145,144,141,139,136,133,131,131,133,134,138,141,144,147,149,151,
-    152,154,154,155,155,156,156,156,156,157,159,160,161,162,161,159,
-    157,155,152,149,146,146,146,146,146,146,147,146,144,142,139,138,
-    137,137,138,140,142,146,149,152,155,158,160,160,161,162,162,160,
-    160,160,160,161,163,163,164,164,163,160,157,154,151,148,147,147,
-    147,148,148,147,146,143,140,136,133,130,129,129,131,134,138,143,
-    148,153,156,159,160,161,161,160,160,159,158,156,156,156,155,155,
-    156,155,154,153,152,152,151,150,149,149,150,151,150,148,146,143,
-    139,136,135,135,135,137,140,143,146,150,154,157,159,161,162,163,
-    163,163,164,163,162,161,161,160,160,159,158,156,154,153,152,150,
-    149,149,149,150,150,150,150,149,145,141,137,133,129,128,128,130,
-    132,136,139,144,150,156,158,160,162,164,166,165,163,161,159,157,
-    154,153,153,153,153,153,153,151,149,147,147,146,146,147,148,149,
-    150,149,148,145,140,137,134,133,133,134,137,140,144,149,155,160,
-    164,168,171,172,172,171,169,165,161,158,156,154,152,152,151,151,
-    151,150,149,149,150,151,152,153,153,152,150,147,142,137,133,129,
-    127,127,128,132,136,140,144,149,153,158,161,164,167,169,170,169,
-    167,164,160,156,152,150,149,148,148,147,147,147,146,146,147,149,
-    150,152,153,153,151,148,144,140,135,132,131,132,135,138,142,147,
-    151,155,158,162,166,169,172,173,173,172,170,166,161,156,152,150,
-    149,149,149,148,148,148,148,148,149,150,151,152,152,151,148,143,
-    139,134,130,128,126,128,132,137,142,146,149,153,156,160,163,166,
-    168,170,170,169,166,162,157,152,148,146,144,144,145,146,147,147,
-    147,148,149,150,150,150,150,148,145,141,138,135,132,133,134,136,
-    141,146,150,154,157,159,161,164,167,169,170,171,172,171,168,163,
-    159,156,153,150,149,148,148,149,149,148,147,147,147,148,149,150,
-    149,147,144,140,136,132,130,130,132,135,140,145,150,153,156,157,
-    158,159,161,163,166,167,167,167,165,162,158,153,149,147,146,145,
-    145,146,146,146,145,143,144,145,145,147,148,148,146,145,142,140,
-    139,138,138,140,144,148,152,155,157,160,162,163,165,167,170,172,
-    173,171,168,164,160,155,152,148,147,146,146,146,146,146,145,144,
-    144,145,146,146,146,146,145,143,141,138,136,136,138,140,142,145,
-    148,151,154,155,157,159,161,164,167,169,169,167,164,160,154,149,
-    146,144,143,144,145,147,148,148,148,147,146,145,144,143,143,142,
-    142,141,141,142,143,144,145,147,150,153,155,157,159,160,161,162,
-    162,163,164,166,167,168,167,164,161,158,155,153,151,149,148,147,
-    147,145,144,142,142,141,141,141,141,142,142,142,143,143,143,144,
-    144,146,148,150,151,152,154,155,155,156,157,159,161,163,165,166,
-    166,163,159,156,152,149,145,144,144,142,141,141,141,140,139,138,
-    139,142,143,144,146,148,150,151,150,149,149,150,151,151,153,155,
-    157,159,161,163,164,165,166,167,167,166,165,164,161,157,154,151,
-    149,148,148,146,144,142,140,138,137,137,138,140,143,145,146,148,
-    149,149,148,146,145,145,146,148,149,151,152,153,155,157,159,161,
-    163,165,165,165,163,161,157,153,149,146,144,143,144,144,144,144,
-    142,140,139,137,137,138,141,143,146,149,151,152,151,151,151,152,
-    152,154,155,157,158,158,159,161,164,166,168,169,170,169,166,162,
-    158,154,150,146,145,145,145,146,145,144,141,138,136,135,135,137,
-    139,142,145,148,149,149,149,149,149,149,151,152,154,155,155,154,
-    154,153,154,156,158,160,161,162,161,159,156,152,149,147,145,146,
-    146,146,145,143,140,137,134,132,133,135,138,143,148,151,154,156,
-    156,156,156,157,158,159,160,160,159,158,157,156,156,158,161,163,
-    164,164,163,161,158,155,152,151,150,149,148,148,147,144,140,137,
-    135,133,132,135,138,142,146,150,152,152,152,152,152,152,153,154,
-    156,156,156,154,152,151,151,152,153,155,157,158,158,157,155,153,
-    151,148,147,146,146,146,146,144,142,139,137,135,135,137,140,144,
-    148,151,154,155,156,155,155,156,156,158,160,162,162,162,161,159,
-    158,157,157,157,158,158,159,159,157,155,154,152,151,150,150,150,
-    148,146,143,140,138,135,133,133,135,139,143,147,150,152,154,154,
-    154,155,156,157,158,158,157,156,153,150,148,147,148,149,151,154,
-    157,158,158,158,156,152,149,147,146,145,144,142,140,139,137,135,
-    134,136,139,143,148,152,155,158,160,159,159,159,159,160,161,162,
-    162,161,160,158,156,154,153,153,153,154,155,156,158,157,154,152,
-    153,151,147,142,141,143,144,140,136,135,135,136,138,142,146,151,
-    155,159,161,161,159,157,154,151,148,147,147,149,150,150,150,150,
-    151,152,152,153,153,154,153,152,151,149,148,148,147,147,146,145,
-    145,143,141,141,140,141,142,144,148,150,153,155,156,157,156,157,
-    159,159,161,163,164,165,164,161,157,154,151,149,147,148,150,152,
-    154,156,156,157,157,156,156,154,152,150,148,146,143,140,138,137,
-    138,140,142,145,149,152,155,157,158,158,158,158,159,159,160,159,
-    158,154,149,145,141,139,139,140,143,146,149,152,154,155,155,154,
-    154,153,149,147,144,142,140,138,138,138,139,142,145,149,153,157,
-    160,162,163,163,162,161,161,161,161,160,158,156,152,149,146,144,
-    143,144,146,148,150,153,155,157,158,157,156,154,153,150,147,144,
-    142,140,138,138,139,140,142,145,149,153,157,159,160,160,160,158,
-    157,157,156,154,152,149,146,143,140,138,137,139,141,144,147,150,
-    153,155,155,155,154,152,149,147,144,141,140,139,140,142,144,146,
-    149,152,155,158,160,162,163,162,161,160,160,160,159,158,156,154,
-    151,148,146,145,145,146,148,149,151,153,155,156,155,155,154,153,
-    151,148,146,143,141,140,141,142,144,146,149,151,153,156,157,159,
-    160,159,159,157,157,156,155,154,151,148,145,142,141,140,140,142,
-    144,147,149,150,151,151,151,150,149,149,149,148,146,145,145,145,
-    145,145,146,147,149,150,153,155,158,160,162,163,164,163,163,162,
-    160,158,155,151,148,146,144,144,145,146,149,151,153,154,154,153,
-    152,151,149,149,148,148,148,147,148,148,148,148,148,149,149,150,
-    151,153,155,158,160,161,162,162,161,159,155,151,147,144,140,138,
-    137,138,140,142,145,147,148,149,148,147,147,147,147,147,147,149,
-    150,150,150,150,150,150,151,151,151,151,152,154,155,157,160,162,
-    163,164,163,161,158,155,150,147,144,143,143,144,145,147,149,151,
-    152,152,151,149,148,148,147,147,149,150,151,153,155,155,155,155,
-    154,153,152,151,151,151,153,154,155,156,158,158,158,157,154,150,
-    146,143,140,139,140,141,143,145,146,147,147,146,144,143,142,143,
-    145,147,150,153,155,156,157,157,156,155,153,152,151,150,150,151,
-    152,154,156,158,160,161,161,160,157,154,150,147,144,143,142,144,
-    145,147,148,149,150,150,148,147,145,145,147,149,152,154,156,157,
-    159,159,158,156,155,154,152,151,150,151,153,155,156,157,158,157,
-    156,153,150,146,143,140,139,139,140,142,144,146,148,149,148,146,
-    144,142,140,140,142,145,148,152,156,159,161,161,161,160,158,155,
-    152,150,149,150,152,154,156,158,159,158,156,153,150,148,146,144,
-    144,145,146,148,149,150,150,150,148,147,144,143,142,143,145,148,
-    151,155,158,161,163,165,164,163,161,158,155,152,151,150,150,152,
-    153,153,153,152,150,147,145,143,142,142,143,144,145,146,147,147,
-    147,145,144,142,141,140,140,141,144,148,153,157,160,163,165,166,
-    165,164,160,157,153,150,147,147,148,150,153,154,155,155,153,151,
-    149,147,146,146,146,147,147,146,146,145,144,144,143,142,142,143,
-    145,148,151,155,158,161,163,164,165,165,164,163,161,158,154,151,
-    149,149,149,149,149,150,150,149,148,146,144,143,142,143,143,144,
-    144,144,143,143,142,142,142,142,142,143,145,147,150,153,156,158,
-    160,162,164,166,166,164,162,159,155,151,148,146,146,148,150,152,
-    153,152,152,151,149,146,145,145,145,146,145,145,145,144,144,144,
-    144,145,146,147,150,152,155,158,160,162,163,165,165,166,166,165,
-    162,159,155,153,150,149,148,148,149,149,149,148,146,144,142,140,
-    140,140,142,143,143,145,145,144,143,143,142,142,143,145,147,150,
-    153,156,159,161,162,164,165,166,165,164,161,158,154,150,148,147,
-    147,147,147,149,150,149,148,146,144,143,142,142,142,143,144,145,
-    145,146,146,147,147,147,148,149,151,154,157,160,161,162,162,162,
-    163,163,163,163,162,159,156,153,151,149,148,147,147,147,147,145,
-    144,142,140,138,137,138,139,140,142,145,146,148,148,148,148,147,
-    147,148,149,151,153,155,157,158,159,160,161,162,163,163,162,160,
-    156,153,152,150,148,147,148,148,147,145,143,142,142,141,141,142,
-    143,144,146,147,147,148,148,148,147,147,148,149,151,154,157,159,
-    160,161,162,163,164,165,165,166,165,163,159,155,151,148,145,144,
-    144,144,144,143,141,140,139,139,139,139,140,141,144,144,144,145,
-    146,146,146,147,148,150,153,156,158,160,161,162,162,162,162,163,
-    163,164,163,162,159,156,152,151    
-};
\ No newline at end of file
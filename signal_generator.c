@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <math.h>
+#include "signal_generator.h"
+#include "cycle_counter.h"
+/*
+   Test signal generator. The sweep factor is calculated in float when a sweep
+   is set up, everything per sample is integer
+ */
+
+#define SIGNAL_DEFAULT_LEVEL 0x4000     // -6dBFS
+
+static const char* signal_names[signal_types] = {"tone", "sweep", "two tone", "square"};
+
+// One cycle of sine in Q15, with the first entry repeated so interpolation needs no wrap
+static const int16_t sine_table[SIGNAL_TABLE_SIZE + 1] = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+    30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+    23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+    12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179, 6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+    0, -804, -1608, -2410, -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+    0
+};
+
+// Phase step for a frequency
+static uint32_t signalGeneratorStep(signal_generator* sg, uint32_t freq_hz)
+{
+    return (uint32_t)((((uint64_t)freq_hz) << 32) / sg->sample_rate);
+}
+
+void signalGeneratorCreate(signal_generator* sg, uint32_t sample_rate)
+{
+    sg->sample_rate = sample_rate;
+    signalGeneratorSelect(sg, signal_tone);
+}
+
+void signalGeneratorSelect(signal_generator* sg, enum signal_type type)
+{
+    switch (type)
+    {
+        case signal_sweep:
+            signalGeneratorSweep(sg, 20, 20000, 10, SIGNAL_DEFAULT_LEVEL);
+        break;
+
+        case signal_two_tone:
+            signalGeneratorTwoTone(sg, 60, (SIGNAL_DEFAULT_LEVEL * 4) / 5, 7000, SIGNAL_DEFAULT_LEVEL / 5);
+        break;
+
+        case signal_square:
+            signalGeneratorSquare(sg, 1000, SIGNAL_DEFAULT_LEVEL >> 1);
+        break;
+
+        default:
+            signalGeneratorTone(sg, 1000, SIGNAL_DEFAULT_LEVEL);
+        break;
+    }
+}
+
+void signalGeneratorTone(signal_generator* sg, uint32_t freq_hz, int32_t level)
+{
+    signalGeneratorTwoTone(sg, freq_hz, level, 0, 0);
+    sg->type = signal_tone;
+}
+
+void signalGeneratorSweep(signal_generator* sg, uint32_t start_hz, uint32_t end_hz, uint32_t seconds, int32_t level)
+{
+    signalGeneratorTone(sg, start_hz, level);
+    sg->type = signal_sweep;
+    sg->sweep_start = sg->step[0];
+    sg->sweep_end = signalGeneratorStep(sg, end_hz);
+    sg->sweep_count = SIGNAL_SWEEP_FRAMES;
+
+    // Equal ratio for every update, so the sweep is linear in octaves
+    float updates = ((float)seconds * (float)sg->sample_rate) / SIGNAL_SWEEP_FRAMES;
+    sg->sweep_factor = (uint32_t)(powf((float)end_hz / (float)start_hz, 1.0f / updates) * (float)(1 << 30));
+}
+
+void signalGeneratorTwoTone(signal_generator* sg, uint32_t freq1_hz, int32_t level1, uint32_t freq2_hz, int32_t level2)
+{
+    sg->type = signal_two_tone;
+    sg->phase[0] = 0;
+    sg->phase[1] = 0;
+    sg->step[0] = signalGeneratorStep(sg, freq1_hz);
+    sg->step[1] = signalGeneratorStep(sg, freq2_hz);
+    sg->level[0] = level1;
+    sg->level[1] = level2;
+}
+
+void signalGeneratorSquare(signal_generator* sg, uint32_t freq_hz, int32_t level)
+{
+    signalGeneratorTone(sg, freq_hz, level);
+    sg->type = signal_square;
+}
+
+// Sine at the phase, interpolated between table entries
+static inline __attribute__((always_inline)) int32_t signalGeneratorSine(uint32_t phase)
+{
+    uint32_t index = phase >> (32 - SIGNAL_TABLE_BITS);
+    int32_t frac = (phase >> (16 - SIGNAL_TABLE_BITS)) & 0xFFFF;
+    int32_t a = sine_table[index];
+
+    return a + (((sine_table[index + 1] - a) * frac) >> 16);
+}
+
+// Generic block loop. Always inlined with constant arguments, so each signal
+// and channel count has its own loop
+static inline __attribute__((always_inline)) void signalGeneratorLoop(signal_generator* sg, int16_t* dest, uint32_t frames,
+                                                                      const uint channels, const enum signal_type type)
+{
+    uint32_t phase0 = sg->phase[0];
+    uint32_t phase1 = sg->phase[1];
+    uint32_t step0 = sg->step[0];
+    const uint32_t step1 = sg->step[1];
+    const int32_t level0 = sg->level[0];
+    const int32_t level1 = sg->level[1];
+
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        int32_t sample;
+
+        if (type == signal_square)
+        {
+            sample = ((int32_t)phase0 < 0) ? -level0 : level0;
+        }
+        else if (type == signal_two_tone)
+        {
+            sample = ((signalGeneratorSine(phase0) * level0) + (signalGeneratorSine(phase1) * level1)) >> 15;
+            phase1 += step1;
+        }
+        else
+        {
+            sample = (signalGeneratorSine(phase0) * level0) >> 15;
+        }
+        phase0 += step0;
+
+        if ((type == signal_sweep) && !--sg->sweep_count)
+        {
+            // Move the rate on, and start again at the end
+            step0 = (uint32_t)(((uint64_t)step0 * sg->sweep_factor) >> 30);
+            step0 = (step0 > sg->sweep_end) ? sg->sweep_start : step0;
+            sg->sweep_count = SIGNAL_SWEEP_FRAMES;
+        }
+
+        for (uint c=0; c<channels; ++c)
+        {
+            *dest++ = (int16_t)sample;
+        }
+    }
+    sg->phase[0] = phase0;
+    sg->phase[1] = phase1;
+    sg->step[0] = step0;
+}
+
+void signalGeneratorBlock(signal_generator* sg, int16_t* dest, uint32_t frames, uint channels)
+{
+    switch (sg->type)
+    {
+        case signal_sweep:
+            (channels == 2) ? signalGeneratorLoop(sg, dest, frames, 2, signal_sweep) : signalGeneratorLoop(sg, dest, frames, 1, signal_sweep);
+        break;
+
+        case signal_two_tone:
+            (channels == 2) ? signalGeneratorLoop(sg, dest, frames, 2, signal_two_tone) : signalGeneratorLoop(sg, dest, frames, 1, signal_two_tone);
+        break;
+
+        case signal_square:
+            (channels == 2) ? signalGeneratorLoop(sg, dest, frames, 2, signal_square) : signalGeneratorLoop(sg, dest, frames, 1, signal_square);
+        break;
+
+        default:
+            (channels == 2) ? signalGeneratorLoop(sg, dest, frames, 2, signal_tone) : signalGeneratorLoop(sg, dest, frames, 1, signal_tone);
+        break;
+    }
+}
+
+const char* signalGeneratorName(enum signal_type type)
+{
+    return (type < signal_types) ? signal_names[type] : "unknown";
+}
+
+// Time each signal generating stereo frames at 44.1kHz
+void signalGeneratorBenchmark(int16_t* dest, uint32_t frames)
+{
+    signal_generator sg;
+
+    signalGeneratorCreate(&sg, 44100);
+    cycleCounterInit();
+
+    for (int t=0; t<signal_types; ++t)
+    {
+        signalGeneratorSelect(&sg, t);
+
+        uint32_t start = cycleCounterRead();
+        signalGeneratorBlock(&sg, dest, frames, 2);
+        uint32_t cycles = cycleCounterElapsed(start);
+
+        printf("signal %s: %.2f cycles/sample\n", signal_names[t], (float)cycles / (float)(frames << 1));
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "pico/stdlib.h"
+
+/*
+ * Direct digital synthesis of test signals
+ * Each oscillator is a 32 bit phase accumulator, which indexes a sine table
+ * in flash with linear interpolation between entries. Signals are generated
+ * in integer arithmetic, and are the same on every channel
+ */
+
+// Signals that can be generated
+enum signal_type
+{
+    signal_tone = 0,
+    signal_sweep = signal_tone + 1,
+    signal_two_tone = signal_sweep + 1,
+    signal_square = signal_two_tone + 1,
+    signal_types = signal_square + 1
+};
+
+// Sine table size, a power of 2
+#define SIGNAL_TABLE_BITS 8
+#define SIGNAL_TABLE_SIZE (1 << SIGNAL_TABLE_BITS)
+
+// Frames between updates of the sweep rate
+#define SIGNAL_SWEEP_FRAMES 16
+
+// Data for the generator
+typedef struct signal_generator
+{
+    enum signal_type type;
+    uint32_t  sample_rate;
+    uint32_t  phase[2];                 // Phase of each oscillator, a full cycle is 2^32
+    uint32_t  step[2];                  // Phase added for each frame
+    int32_t   level[2];                 // Q15 amplitude of each oscillator
+    uint32_t  sweep_start;              // Step at the start and end of a sweep
+    uint32_t  sweep_end;
+    uint32_t  sweep_factor;             // Q30 multiplier of the step, every SIGNAL_SWEEP_FRAMES
+    uint32_t  sweep_count;              // Frames until the next step update
+} signal_generator;
+
+// Set up the generator for the sample rate, playing a 1kHz tone
+extern void signalGeneratorCreate(signal_generator* sg, uint32_t sample_rate);
+
+// Select a signal with its default settings
+//   tone      1kHz at -6dBFS
+//   sweep     logarithmic 20Hz to 20kHz over 10s at -6dBFS, then repeats
+//   two tone  SMPTE IMD, 60Hz and 7kHz at 4:1, peaking at -6dBFS
+//   square    1kHz at -12dBFS
+extern void signalGeneratorSelect(signal_generator* sg, enum signal_type type);
+
+// Set up each signal. Frequencies are in Hz, levels are Q15
+extern void signalGeneratorTone(signal_generator* sg, uint32_t freq_hz, int32_t level);
+extern void signalGeneratorSweep(signal_generator* sg, uint32_t start_hz, uint32_t end_hz, uint32_t seconds, int32_t level);
+extern void signalGeneratorTwoTone(signal_generator* sg, uint32_t freq1_hz, int32_t level1, uint32_t freq2_hz, int32_t level2);
+extern void signalGeneratorSquare(signal_generator* sg, uint32_t freq_hz, int32_t level);
+
+// Fill dest with frames of interleaved samples, the same on each of channels
+extern void signalGeneratorBlock(signal_generator* sg, int16_t* dest, uint32_t frames, uint channels);
+
+// Return a printable name for the signal
+extern const char* signalGeneratorName(enum signal_type type);
+
+// Report cycles per sample for each signal over the UART
+// dest must hold at least 2 * frames samples
+extern void signalGeneratorBenchmark(int16_t* dest, uint32_t frames);
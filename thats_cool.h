@@ -1,970 +0,0 @@
-/*    File ThatsCool.wav
- *    Sample rate 11000 Hz
- */
-#define WAV_DATA_LENGTH 15400 
-
-uint16_t WAV_DATA[] = {
-    124,124,124,124,123,124,123,125,125,118,122,127,128,126,124,121,
-    121,121,123,124,126,127,128,128,127,125,124,122,120,119,118,118,
-    118,118,119,120,121,122,123,123,125,126,127,127,128,128,128,128,
-    128,128,128,128,127,128,127,127,126,125,124,124,123,122,122,121,
-    121,120,121,120,120,119,119,119,119,119,118,118,118,118,119,119,
-    119,119,119,119,120,120,120,120,120,121,121,121,121,122,122,123,
-    123,123,123,124,124,125,125,125,125,125,126,126,127,127,126,127,
-    127,127,127,128,127,127,128,128,128,128,129,129,129,128,128,129,
-    128,129,129,129,129,129,129,128,128,128,128,128,128,128,128,128,
-    128,128,128,127,127,128,127,127,127,127,127,127,127,127,127,127,
-    127,126,126,126,126,126,126,126,125,125,125,125,125,125,125,124,
-    124,124,124,124,124,123,123,123,123,123,123,123,122,122,122,122,
-    122,122,122,122,122,121,121,121,121,121,121,121,121,121,121,120,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
-    121,122,122,122,122,122,121,121,122,122,122,122,122,122,122,122,
-    122,123,123,123,122,122,122,122,122,123,123,122,123,123,123,123,
-    122,122,122,123,123,123,123,123,123,123,124,124,123,123,123,124,
-    124,124,124,124,124,124,124,124,123,124,124,124,124,124,124,124,
-    124,124,124,123,124,124,123,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,125,124,124,124,124,124,124,124,124,125,125,125,
-    125,124,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
-    125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
-    124,124,125,125,125,124,124,125,125,125,125,125,125,125,125,125,
-    125,125,125,124,124,124,124,124,124,124,125,124,125,124,124,125,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,125,
-    124,125,124,124,124,124,125,124,125,124,124,124,124,124,123,124,
-    124,124,124,124,124,123,123,123,124,124,124,124,123,124,124,123,
-    124,124,124,124,124,124,124,124,124,124,123,124,124,124,124,124,
-    124,125,124,123,124,124,124,124,124,123,123,124,123,124,124,123,
-    123,124,124,124,124,124,124,124,124,125,125,124,124,124,124,124,
-    124,124,123,123,123,123,123,123,123,123,123,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,123,123,123,123,124,123,
-    123,123,123,124,124,124,124,124,124,123,123,124,124,124,123,123,
-    123,123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,123,124,124,123,123,124,124,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,124,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,124,124,124,124,123,123,123,123,
-    124,123,124,123,124,123,123,123,123,124,124,124,124,124,124,124,
-    124,124,124,124,123,123,123,123,123,123,124,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,123,124,123,124,123,123,
-    123,123,123,123,124,124,124,123,123,123,123,123,123,123,123,124,
-    124,124,124,123,123,124,124,124,123,124,124,124,124,124,124,124,
-    123,124,124,124,124,124,124,123,123,124,124,124,123,124,124,124,
-    125,124,124,124,124,124,124,124,124,124,124,124,123,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,124,124,123,123,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,123,124,124,124,123,124,123,123,124,123,
-    123,124,124,124,124,123,124,124,124,124,123,123,123,123,124,123,
-    123,124,124,123,123,123,123,123,123,123,123,124,124,124,123,124,
-    124,124,124,124,124,123,123,124,124,123,123,124,123,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,124,123,123,124,124,123,
-    123,124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,125,124,125,125,125,125,125,125,125,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    124,124,124,124,123,124,123,123,123,123,123,123,124,124,124,124,
-    124,124,124,124,123,123,123,123,123,123,123,124,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,124,123,123,123,123,
-    123,123,123,124,124,124,124,123,123,124,123,124,123,123,123,123,
-    124,123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,123,124,124,123,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,123,124,124,123,123,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,123,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,123,123,124,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,123,123,124,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,124,123,123,123,123,123,124,
-    123,123,123,124,124,124,123,123,123,123,123,124,124,124,124,124,
-    124,124,124,124,123,123,123,123,123,123,123,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,124,124,123,123,123,123,123,123,123,123,123,124,
-    124,124,124,123,123,124,124,123,123,123,124,124,123,123,124,124,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,124,124,
-    124,124,124,123,124,124,123,124,124,123,123,124,124,124,123,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,124,124,124,123,
-    123,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,124,123,123,123,123,123,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,124,124,123,123,124,124,124,124,123,123,123,123,123,123,
-    123,123,123,124,124,124,124,124,124,123,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,124,123,124,124,124,123,123,123,123,124,123,124,124,124,
-    124,123,124,123,123,123,123,123,123,123,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,123,124,123,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,123,123,123,124,123,123,123,123,123,123,123,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    123,124,124,124,124,124,123,123,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,123,
-    124,124,123,124,124,124,124,124,123,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,123,123,124,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,124,124,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,124,
-    124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,125,
-    124,123,123,123,124,124,124,123,123,124,123,124,124,124,124,123,
-    124,124,124,124,123,123,123,123,123,123,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,
-    125,124,124,124,124,124,124,124,123,123,123,122,123,123,123,123,
-    123,123,124,124,124,124,125,125,125,125,125,124,124,124,124,124,
-    123,123,123,123,124,123,123,123,123,124,124,124,125,125,124,126,
-    126,126,126,125,125,124,123,124,124,123,124,124,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,125,125,125,124,125,125,124,
-    124,124,123,123,123,123,123,123,123,123,123,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,123,123,123,123,123,123,123,123,
-    123,123,123,124,124,124,123,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,123,124,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,
-    123,123,123,122,122,122,122,123,123,123,123,123,123,123,124,124,
-    124,124,124,124,124,125,125,125,125,126,125,126,126,126,126,126,
-    126,126,125,124,125,124,123,121,121,120,118,118,118,118,118,119,
-    119,120,123,121,121,123,125,125,119,126,131,128,130,130,123,117,
-    120,125,125,128,136,139,140,148,145,139,129,124,115,107,102,99,
-    93,96,99,105,108,116,122,134,130,109,142,144,141,148,140,117,
-    98,111,126,121,126,139,136,143,170,168,160,144,137,127,104,106,
-    92,77,76,82,91,100,109,121,120,129,139,147,149,139,107,126,
-    133,124,134,124,108,87,100,118,119,130,147,150,157,180,184,174,
-    155,137,125,99,98,82,65,62,70,81,96,114,131,135,143,157,
-    154,152,149,140,124,114,107,105,96,105,95,95,112,118,126,130,
-    134,133,130,140,149,147,154,161,162,162,161,150,134,116,109,96,
-    86,82,80,81,88,100,114,124,135,144,143,143,142,135,128,122,
-    113,107,103,105,104,110,118,123,127,133,136,133,132,138,140,138,
-    147,148,148,147,148,136,125,115,108,97,94,94,95,95,103,110,
-    117,124,132,134,119,139,131,133,130,145,95,98,146,130,138,143,
-    133,97,101,132,127,125,140,142,134,154,173,147,138,120,116,99,
-    98,97,91,81,94,112,120,130,137,139,123,129,137,122,122,126,
-    121,119,129,109,95,137,143,148,146,138,103,87,95,111,113,126,
-    140,153,167,188,194,168,149,125,110,88,83,82,68,62,89,100,
-    118,139,154,146,151,152,141,126,123,112,100,96,105,108,82,127,
-    135,135,142,138,115,97,110,119,121,136,155,164,171,188,190,166,
-    145,119,98,76,71,71,62,68,90,104,129,145,157,156,148,152,
-    135,129,117,112,105,111,101,68,126,137,140,152,136,115,84,103,
-    122,117,134,156,161,169,196,193,163,138,116,98,74,74,69,65,
-    67,95,111,133,151,159,156,143,146,135,118,112,111,119,96,64,
-    112,129,138,161,152,118,83,101,113,109,127,144,148,170,202,209,
-    185,153,132,99,81,73,61,60,62,84,105,131,150,158,154,145,
-    146,135,117,110,103,103,102,121,97,77,135,145,149,162,148,98,
-    67,95,110,105,135,154,163,184,210,208,172,142,116,86,68,64,
-    62,62,71,108,124,146,159,163,149,134,125,113,101,105,112,107,
-    70,97,142,138,166,162,134,87,87,108,106,116,140,141,166,199,
-    207,187,162,135,106,87,75,64,56,60,78,107,136,163,166,161,
-    147,139,121,111,103,98,93,105,109,122,128,158,114,99,146,126,
-    138,132,121,85,68,105,122,132,171,175,182,200,208,191,158,126,
-    99,66,63,59,63,75,98,127,142,165,161,154,131,122,112,98,
-    93,95,94,102,117,131,93,117,156,146,151,144,109,64,62,93,
-    104,123,167,173,191,212,216,195,157,121,93,72,63,54,65,65,
-    85,112,137,154,155,160,145,137,131,119,109,110,111,116,121,100,
-    87,135,143,150,147,128,93,65,91,107,115,146,170,180,201,218,
-    213,180,146,119,86,59,57,54,54,66,95,118,143,158,166,153,
-    141,137,117,108,107,105,106,116,115,85,105,142,141,153,139,116,
-    73,71,101,108,129,156,174,188,218,229,205,165,125,98,65,53,
-    55,53,60,81,113,138,157,166,162,140,134,120,107,105,105,106,
-    115,113,87,106,135,140,152,147,116,81,74,97,102,118,145,159,
-    183,212,226,211,175,137,107,81,63,56,54,58,72,100,130,144,
-    160,161,147,139,128,115,107,105,107,117,118,97,110,140,141,152,
-    144,113,79,69,90,97,119,146,162,187,212,218,206,174,137,109,
-    86,66,58,58,59,71,97,122,143,154,158,148,137,130,122,113,
-    109,109,117,102,89,121,129,143,154,140,107,75,82,88,104,133,
-    146,166,191,214,210,199,169,132,107,85,69,56,60,63,77,100,
-    127,140,153,156,149,137,128,120,114,110,115,107,91,99,123,142,
-    150,152,126,97,84,92,100,117,134,146,168,196,204,202,183,151,
-    121,98,82,61,59,64,70,87,112,131,142,150,151,144,136,126,
-    117,113,112,111,110,92,104,128,138,150,144,126,96,87,95,101,
-    122,140,150,171,194,202,196,184,147,119,98,81,70,66,67,67,
-    80,106,128,141,151,150,144,138,132,125,119,115,115,95,93,109,
-    123,138,144,135,110,97,100,105,119,133,143,157,176,192,191,182,
-    159,131,110,93,78,72,68,70,79,95,114,131,143,146,147,143,
-    138,131,127,123,120,110,98,103,117,130,138,137,121,102,95,102,
-    112,128,144,153,170,185,191,188,172,150,123,101,87,72,69,71,
-    72,83,98,115,130,141,147,145,142,136,133,128,127,122,107,100,
-    108,116,127,131,125,110,99,100,107,119,135,144,157,174,185,188,
-    183,166,143,120,101,87,75,70,68,72,83,97,114,127,136,141,
-    145,144,143,141,139,128,114,112,108,114,120,120,114,104,102,100,
-    109,122,131,142,155,170,178,184,179,165,148,128,109,91,83,72,
-    67,69,78,89,103,120,129,137,144,146,145,143,143,128,122,122,
-    118,122,123,122,113,109,110,109,116,122,128,134,141,149,158,165,
-    165,163,153,141,124,112,101,91,84,82,82,87,100,110,117,124,
-    128,130,133,136,138,131,130,126,125,127,128,126,121,116,116,116,
-    119,123,123,124,126,130,134,139,143,144,143,142,138,132,126,120,
-    114,109,107,106,108,111,115,116,116,116,116,117,118,121,122,123,
-    125,127,129,131,131,130,127,126,125,124,123,122,119,119,119,121,
-    124,128,131,133,135,136,135,135,134,132,130,127,124,121,119,118,
-    116,112,109,106,107,109,112,114,115,118,121,125,128,131,132,132,
-    130,129,127,125,123,120,119,119,119,121,123,125,128,132,135,135,
-    135,135,136,135,135,133,130,128,125,122,117,112,109,107,108,108,
-    110,112,115,118,122,127,129,130,130,129,128,126,126,123,120,118,
-    117,118,119,121,123,125,128,130,131,132,132,132,132,133,132,132,
-    130,130,127,125,122,118,116,116,116,116,117,118,120,122,124,125,
-    125,125,124,123,123,122,122,120,119,118,118,119,120,122,124,125,
-    127,128,129,130,130,130,130,130,130,131,131,130,128,125,123,121,
-    121,120,119,119,119,121,122,124,125,124,124,124,123,123,122,121,
-    120,119,118,117,118,119,120,121,122,123,125,125,126,126,127,127,
-    129,130,131,131,130,129,127,125,124,122,121,120,121,122,124,126,
-    126,126,127,127,126,125,123,122,121,120,119,117,117,118,119,120,
-    120,120,121,123,125,126,126,126,126,128,129,130,130,128,126,124,
-    123,122,121,121,121,122,123,124,126,126,126,126,126,124,123,122,
-    120,120,119,118,117,117,120,121,121,121,121,122,124,125,125,124,
-    124,124,125,127,128,127,126,125,124,125,124,123,122,122,123,125,
-    126,127,127,127,127,126,125,123,121,120,119,118,118,119,120,122,
-    123,124,124,124,124,125,125,124,123,122,122,123,123,124,124,125,
-    125,125,125,125,125,125,125,125,126,126,126,126,126,126,126,124,
-    122,121,120,120,120,120,120,122,124,126,127,126,125,125,125,124,
-    123,122,120,120,121,122,122,123,123,123,123,124,125,124,124,124,
-    125,126,126,127,127,127,126,126,124,122,120,119,119,119,120,122,
-    123,125,127,128,128,128,127,126,124,123,122,121,121,121,121,121,
-    122,122,123,123,124,124,124,125,126,127,127,128,128,127,127,127,
-    126,124,122,120,119,120,120,121,122,123,125,127,128,128,127,127,
-    126,125,124,123,122,121,121,120,120,120,120,120,121,122,123,123,
-    124,125,126,127,128,128,127,127,126,125,123,121,119,118,119,119,
-    120,122,124,126,127,128,128,127,127,126,125,124,123,123,123,123,
-    122,122,122,121,122,122,122,122,122,122,123,125,126,127,128,128,
-    128,127,126,124,122,120,119,119,120,121,123,124,125,126,127,127,
-    127,127,125,125,124,123,123,123,123,123,122,123,123,123,122,123,
-    122,122,122,122,123,125,126,127,127,127,126,125,123,121,120,119,
-    119,120,122,122,124,125,125,126,126,126,125,124,124,123,122,122,
-    122,122,122,123,123,123,123,123,122,122,122,122,122,123,123,124,
-    125,125,125,125,124,123,122,121,121,122,122,123,124,125,126,126,
-    126,126,125,125,124,123,123,122,123,123,123,124,124,125,125,125,
-    124,123,124,122,123,123,123,124,124,124,125,125,123,123,123,122,
-    122,123,123,125,125,126,125,126,127,124,125,124,124,124,122,122,
-    121,122,123,123,124,122,125,124,125,126,123,125,123,123,126,124,
-    124,124,124,124,124,123,122,122,121,122,124,124,125,127,126,126,
-    128,126,126,125,124,124,123,124,121,123,124,122,126,122,125,124,
-    124,126,124,126,122,125,123,124,124,124,123,125,123,123,123,122,
-    122,122,121,123,123,124,125,127,124,126,128,124,126,122,124,122,
-    124,122,123,125,122,122,123,125,123,125,124,123,124,123,124,124,
-    124,125,124,125,124,124,123,124,121,121,122,122,122,123,124,124,
-    125,127,126,126,126,125,123,124,122,123,123,123,124,123,124,122,
-    126,121,126,123,124,126,123,125,123,124,124,123,125,122,124,121,
-    122,123,122,124,122,126,121,125,125,125,125,125,124,125,123,126,
-    124,124,123,125,122,124,124,125,124,121,125,123,125,123,125,123,
-    126,122,126,123,126,124,122,123,119,123,122,122,125,120,125,124,
-    125,127,123,127,121,127,122,125,124,123,125,121,125,122,124,124,
-    122,123,122,124,121,125,125,122,125,123,126,124,126,124,125,123,
-    123,123,121,123,123,123,124,126,122,126,124,124,125,124,125,122,
-    123,124,123,123,123,124,124,125,123,126,124,121,126,119,125,121,
-    125,121,125,125,121,127,120,127,121,121,125,122,123,124,123,125,
-    123,123,126,125,123,127,126,123,124,120,125,120,123,123,125,124,
-    125,125,124,126,123,126,123,123,124,123,121,126,121,125,124,121,
-    126,121,127,123,125,123,124,123,123,125,122,127,123,124,125,125,
-    123,125,121,122,121,123,122,123,123,125,123,124,125,122,126,120,
-    126,120,123,124,122,123,125,120,124,124,122,125,123,124,126,123,
-    124,125,123,123,123,122,123,125,120,128,121,125,122,125,121,124,
-    124,120,125,122,123,125,120,127,120,123,122,125,124,120,126,119,
-    127,119,127,121,124,121,128,119,130,124,121,124,124,123,125,123,
-    124,123,122,125,122,130,116,130,117,128,122,126,123,124,123,123,
-    127,121,122,128,120,128,121,124,125,118,130,119,128,120,128,124,
-    126,124,126,125,122,127,125,123,124,124,128,119,127,123,124,122,
-    124,124,121,123,122,125,124,125,122,124,123,128,119,130,123,122,
-    125,123,122,123,122,128,121,124,126,125,124,119,132,122,123,124,
-    122,131,121,124,129,122,121,127,125,120,123,123,121,125,124,124,
-    127,122,126,124,127,121,127,119,126,121,124,121,123,127,121,124,
-    127,121,123,128,120,129,120,125,123,125,125,125,124,124,121,133,
-    120,127,121,118,129,118,125,126,118,125,118,129,127,119,128,120,
-    125,123,127,124,123,122,121,125,123,121,126,117,127,119,128,119,
-    128,123,122,128,120,128,126,124,127,122,123,117,129,121,125,127,
-    115,133,112,130,118,134,119,124,124,120,125,119,131,126,113,129,
-    114,135,121,125,130,117,127,114,135,112,139,112,127,122,120,132,
-    115,135,118,124,123,116,131,114,134,120,120,126,118,129,123,124,
-    126,124,117,127,120,125,127,120,127,120,126,125,122,128,125,128,
-    115,127,119,128,123,121,128,115,126,123,126,126,125,121,125,123,
-    122,126,124,126,123,129,119,119,122,125,124,127,118,126,117,125,
-    122,129,126,123,128,117,128,116,130,118,133,118,124,117,125,125,
-    125,128,121,124,124,123,126,125,126,128,121,128,118,129,119,129,
-    122,126,119,121,122,123,126,124,126,121,124,124,127,124,125,122,
-    124,122,125,124,125,121,122,121,123,122,123,123,124,124,124,124,
-    125,124,126,123,124,122,123,124,123,124,122,124,121,124,122,123,
-    122,123,122,125,124,125,126,127,126,125,125,123,124,123,123,124,
-    125,126,125,124,125,124,125,124,124,123,121,122,122,123,123,125,
-    127,126,126,124,124,122,122,120,121,120,119,119,119,120,119,121,
-    121,122,122,121,120,120,122,124,125,123,122,121,123,123,126,126,
-    127,126,126,126,129,129,130,128,126,125,123,123,122,123,121,121,
-    121,121,122,123,125,127,127,127,125,126,125,125,125,126,127,127,
-    127,124,121,119,120,121,124,125,127,126,127,126,127,128,128,128,
-    127,126,123,123,122,123,123,123,122,122,121,122,123,124,125,125,
-    125,125,125,125,125,125,126,124,125,123,123,122,121,122,123,123,
-    124,124,124,124,124,126,125,126,124,125,123,123,123,123,123,123,
-    123,123,123,123,124,123,124,123,123,123,124,123,124,123,124,124,
-    123,123,123,122,123,123,122,123,122,123,123,123,124,124,124,123,
-    123,123,123,124,124,124,124,124,124,124,124,124,124,123,123,122,
-    122,122,123,123,123,124,123,123,123,123,123,123,123,123,123,124,
-    124,124,123,124,123,123,124,123,123,122,123,122,123,123,123,123,
-    123,124,124,124,124,123,124,123,123,123,122,124,123,124,123,123,
-    123,124,124,124,123,123,123,123,123,123,123,123,124,124,123,123,
-    124,124,124,124,123,123,124,124,124,124,124,124,124,124,124,124,
-    123,123,123,123,124,123,124,124,124,124,124,124,124,123,123,123,
-    123,123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,124,123,124,124,124,123,123,123,123,124,124,124,124,124,124,
-    124,124,124,124,124,123,124,123,124,123,124,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,124,124,123,123,123,123,123,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,124,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,123,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,124,123,123,123,123,123,123,124,
-    123,124,123,124,124,124,124,123,123,123,123,123,123,123,123,123,
-    123,123,124,123,124,124,124,124,123,124,124,124,124,124,124,123,
-    124,123,124,123,123,123,123,124,123,124,123,124,124,124,124,124,
-    124,124,124,123,124,124,124,124,123,124,124,124,124,125,126,125,
-    124,122,121,121,123,127,128,128,126,121,117,113,111,112,116,121,
-    127,130,133,134,134,134,135,135,135,133,130,125,121,118,117,117,
-    117,118,118,117,115,114,114,115,118,121,126,129,129,128,127,125,
-    126,127,127,126,124,120,117,116,116,119,122,126,128,129,128,127,
-    126,126,127,128,129,129,129,127,126,124,124,124,124,124,124,124,
-    124,124,124,124,125,125,125,124,124,124,124,124,124,124,124,124,
-    124,124,125,125,125,124,123,122,122,122,122,122,121,121,122,123,
-    124,124,123,121,119,119,121,124,125,126,125,122,119,116,114,113,
-    114,117,120,122,124,126,126,127,127,128,128,128,128,127,127,126,
-    125,124,124,123,122,122,122,121,121,121,120,121,121,121,123,126,
-    131,136,142,143,133,128,123,124,130,135,138,132,123,111,108,110,
-    117,128,135,134,125,109,94,81,78,84,97,112,126,133,136,136,
-    132,134,136,143,147,147,143,133,124,115,110,110,113,118,123,125,
-    129,127,125,124,124,125,130,135,140,140,138,136,128,123,119,116,
-    116,117,116,116,114,112,115,118,124,130,133,134,131,126,122,119,
-    119,118,118,117,115,114,114,116,119,122,124,128,129,130,129,129,
-    129,128,129,128,127,126,124,123,123,123,123,125,125,126,125,126,
-    126,126,126,127,126,126,124,123,122,121,122,123,124,124,126,125,
-    125,124,123,123,122,122,123,124,124,124,123,123,123,124,125,126,
-    126,126,126,125,124,123,122,122,121,121,122,120,119,119,119,118,
-    119,118,119,119,121,122,121,122,122,122,123,125,127,127,128,128,
-    128,126,125,125,124,124,125,126,127,127,127,126,126,125,126,126,
-    126,125,124,123,122,122,122,121,121,120,119,119,119,119,119,119,
-    119,119,119,119,119,119,120,122,124,125,126,127,128,129,129,130,
-    130,130,129,129,128,126,126,125,125,125,125,124,125,124,125,126,
-    127,128,128,129,128,125,123,121,117,114,112,110,108,107,106,106,
-    106,109,112,116,121,125,130,134,136,137,138,139,140,141,142,141,
-    139,136,131,128,126,126,130,135,141,146,150,148,143,135,126,117,
-    107,99,91,84,78,71,66,64,65,70,80,95,111,128,144,155,
-    161,164,167,170,171,173,174,169,158,144,129,118,112,114,124,135,
-    146,154,156,154,149,144,140,135,130,122,109,90,70,50,35,28,
-    28,36,51,67,84,103,120,136,149,159,171,181,187,192,192,183,
-    169,151,131,117,107,105,116,129,142,155,161,162,159,155,153,151,
-    148,145,136,118,94,68,42,24,13,14,25,40,59,79,97,114,
-    132,143,156,173,185,196,205,203,194,175,151,131,114,103,105,117,
-    131,147,160,166,165,158,152,147,142,140,138,132,119,100,78,55,
-    34,21,21,29,43,63,85,103,118,134,139,148,161,169,180,189,
-    191,184,170,149,133,116,107,113,122,138,158,170,179,180,170,161,
-    146,131,123,116,108,104,93,79,65,47,36,33,36,51,70,89,
-    113,130,141,144,147,150,150,155,161,167,163,157,146,133,119,112,
-    116,128,143,162,182,191,192,186,173,152,133,118,107,96,89,84,
-    76,64,54,49,43,46,58,76,95,116,135,152,150,153,154,146,
-    144,146,148,144,141,133,129,117,112,119,129,141,160,179,191,196,
-    193,186,164,142,122,105,86,76,71,66,60,54,54,52,53,62,
-    79,94,116,138,156,158,162,163,154,146,141,138,130,125,119,118,
-    111,110,120,131,142,162,179,189,196,195,191,174,153,134,115,90,
-    75,66,56,52,51,55,59,64,73,88,100,117,136,154,156,163,
-    167,157,150,144,137,125,117,109,110,103,105,117,130,140,161,177,
-    187,194,193,191,177,157,140,122,97,83,71,59,52,48,49,54,
-    59,69,89,100,118,136,154,160,164,171,166,159,152,147,131,119,
-    105,99,91,90,100,116,130,150,174,186,194,197,197,182,168,150,
-    134,110,93,79,66,54,48,49,48,56,64,82,96,114,132,153,
-    161,162,172,168,158,154,149,133,122,109,99,91,85,92,107,121,
-    141,168,183,193,200,202,190,176,161,145,123,102,90,73,59,50,
-    48,43,48,57,70,87,104,124,144,159,162,170,172,163,157,154,
-    143,128,118,105,95,86,85,95,106,122,148,170,183,195,199,197,
-    184,170,156,139,115,102,88,71,59,52,48,45,50,61,75,90,
-    111,131,149,162,166,171,171,160,155,151,136,123,115,100,90,84,
-    83,94,107,125,152,173,188,202,205,199,189,173,156,137,114,101,
-    84,66,56,47,39,38,43,54,69,86,112,133,150,170,177,174,
-    177,167,155,148,136,121,112,96,85,81,75,84,99,116,141,169,
-    189,206,215,214,204,187,169,148,124,106,91,70,56,45,35,31,
-    32,39,58,75,100,130,150,169,187,188,181,180,163,149,139,124,
-    110,99,84,74,72,67,79,98,119,148,181,203,222,231,229,217,
-    195,170,147,119,95,80,59,45,35,27,23,27,34,55,77,102,
-    136,162,179,196,201,188,182,166,146,134,119,104,95,81,68,68,
-    62,68,89,111,140,177,205,228,243,242,232,211,181,155,127,97,
-    79,60,42,30,20,14,16,23,40,68,95,128,161,183,197,208,
-    203,187,175,156,136,121,109,93,82,69,61,59,59,73,98,127,
-    161,200,228,246,255,249,231,204,174,144,112,87,67,46,31,20,
-    12,10,17,29,52,80,111,145,172,192,204,209,201,182,168,149,
-    126,112,100,84,73,66,58,59,65,82,110,140,174,210,234,248,
-    254,244,223,195,163,133,103,77,60,43,28,20,16,14,21,37,
-    58,85,117,148,173,191,200,204,195,175,163,144,121,112,102,86,
-    79,74,67,69,75,91,115,141,174,208,228,241,248,235,214,189,
-    157,127,101,77,61,46,33,27,23,21,29,42,60,88,117,147,
-    172,190,199,202,192,173,158,139,117,108,98,87,81,78,73,75,
-    81,93,116,140,169,201,223,236,243,232,214,188,158,128,102,79,
-    64,50,38,33,27,25,30,41,57,81,109,140,162,183,194,197,
-    192,176,159,145,124,110,104,94,84,83,77,74,81,89,107,133,
-    160,190,218,231,240,235,216,193,165,132,105,84,63,51,42,34,
-    30,29,31,43,56,79,107,135,160,183,195,197,196,180,157,144,
-    123,105,101,92,85,83,80,77,84,90,106,130,155,184,212,228,
-    236,235,218,196,166,134,108,83,63,53,40,35,34,34,37,49,
-    60,80,105,129,155,175,188,194,191,181,165,141,130,109,95,92,
-    89,82,86,87,86,97,104,123,144,168,192,215,223,230,224,204,
-    181,153,122,95,76,57,50,42,42,42,46,50,62,71,90,112,
-    133,156,174,187,190,188,178,158,134,122,100,89,89,87,85,91,
-    94,96,106,113,131,148,171,194,216,223,230,222,201,176,145,114,
-    87,66,52,46,39,43,44,47,54,67,77,97,118,140,161,175,
-    188,187,182,172,149,129,118,97,91,91,89,89,98,97,102,111,
-    118,136,154,175,197,216,220,227,214,194,170,139,110,87,64,52,
-    46,38,41,42,46,52,67,78,100,121,144,165,179,189,189,182,
-    173,154,130,123,99,90,90,87,83,92,94,96,108,116,135,152,
-    174,197,217,221,229,218,197,174,145,112,87,66,47,41,33,35,
-    35,41,47,63,74,97,121,143,168,184,197,197,193,179,164,133,
-    120,101,81,80,81,77,82,94,92,105,114,131,149,171,194,217,
-    227,232,231,209,185,154,120,85,63,39,29,20,21,26,31,44,
-    61,78,97,127,147,173,192,202,204,200,184,168,144,113,103,82,
-    67,70,74,70,85,97,100,119,133,150,171,193,211,227,230,231,
-    218,191,165,133,94,64,43,20,15,12,18,28,40,57,79,97,
-    121,149,166,190,205,209,208,200,178,160,135,100,84,65,49,55,
-    63,68,88,104,114,135,150,165,186,201,218,232,232,230,218,189,
-    160,124,82,52,26,5,3,3,12,30,46,67,91,112,136,162,
-    178,200,210,212,209,196,174,150,125,98,72,55,49,41,51,70,
-    84,104,130,146,161,179,190,201,210,218,221,216,205,190,161,129,
-    98,64,33,13,3,0,10,30,50,72,98,119,137,157,173,187,
-    197,205,204,195,180,159,132,104,81,61,39,38,45,49,75,105,
-    126,148,175,181,189,196,197,198,199,201,198,189,175,157,124,94,
-    66,36,16,10,8,21,42,67,94,117,137,152,161,168,178,179,
-    184,186,179,169,153,129,104,82,58,48,47,43,58,84,97,130,
-    160,173,189,201,194,190,185,172,168,161,157,152,144,131,120,100,
-    83,68,53,47,49,55,68,86,103,122,134,145,150,150,151,152,
-    148,150,150,143,140,131,117,104,96,83,81,82,88,97,101,127,
-    135,145,167,175,170,176,170,151,147,135,124,124,124,126,131,129,
-    132,126,115,110,101,89,91,91,91,101,107,111,117,120,120,122,
-    119,123,124,124,135,135,138,145,142,137,136,126,118,115,108,109,
-    112,102,112,121,112,133,143,138,146,151,134,135,134,123,129,133,
-    140,148,154,157,156,143,136,124,102,96,88,76,79,84,85,91,
-    102,106,109,115,121,126,130,144,148,152,161,158,149,145,132,115,
-    105,95,87,88,89,85,103,108,116,140,148,152,164,162,150,155,
-    141,137,138,138,141,148,148,151,145,132,127,106,93,90,79,78,
-    88,87,99,109,112,119,123,122,127,127,129,138,139,142,148,142,
-    137,133,119,108,103,94,91,94,101,103,106,130,127,137,157,160,
-    154,165,155,137,138,125,118,119,123,130,139,145,154,150,144,140,
-    122,106,103,87,83,88,88,91,101,103,106,112,111,117,119,127,
-    135,138,147,151,146,147,141,127,119,113,98,99,96,100,94,105,
-    116,114,133,145,148,150,162,147,144,142,133,130,135,138,146,151,
-    155,157,147,139,126,106,92,85,72,75,81,85,94,107,111,118,
-    125,127,129,133,138,141,141,149,145,140,138,130,114,110,98,90,
-    90,90,96,108,115,121,143,137,153,164,159,158,163,142,132,129,
-    109,108,112,114,126,140,147,157,154,151,144,126,115,109,91,94,
-    94,91,97,103,98,104,103,102,109,110,122,132,136,149,153,146,
-    150,142,127,124,116,103,105,100,99,109,104,109,127,117,135,152,
-    145,152,161,138,136,134,113,121,125,130,146,159,164,173,162,154,
-    140,113,100,89,70,78,78,79,93,99,100,108,109,109,117,119,
-    132,139,146,156,156,150,150,133,118,112,96,88,91,87,95,106,
-    118,123,132,149,147,157,169,166,159,162,143,126,121,105,97,103,
-    111,120,134,149,154,155,153,144,127,119,110,97,98,97,95,96,
-    100,93,93,92,90,96,103,119,131,145,160,165,162,161,149,133,
-    124,113,101,101,100,106,106,108,124,118,126,144,142,143,159,144,
-    136,142,125,120,128,127,132,144,148,152,149,144,135,117,106,102,
-    85,91,96,92,100,110,104,106,112,104,109,114,122,127,138,149,
-    149,149,153,142,130,130,117,106,110,104,101,113,113,106,128,124,
-    125,146,142,140,148,135,124,126,112,114,121,126,143,154,162,172,
-    164,156,145,123,106,100,80,82,84,79,89,93,93,100,104,105,
-    116,121,135,146,152,163,165,158,155,141,123,115,101,89,91,87,
-    90,103,101,110,130,125,142,159,153,159,164,143,139,133,114,117,
-    117,120,134,143,150,156,150,146,133,115,109,100,88,99,95,99,
-    106,106,104,107,104,103,110,114,127,134,142,151,147,145,143,128,
-    122,119,107,105,109,103,109,118,115,116,135,125,136,153,144,147,
-    151,133,123,123,107,111,120,127,144,157,166,170,161,154,137,115,
-    105,97,78,89,87,84,92,92,88,94,99,101,116,124,141,148,
-    157,163,157,151,147,130,122,116,106,99,103,96,103,97,106,116,
-    111,137,145,145,159,162,140,149,139,122,133,136,134,152,157,155,
-    154,146,128,111,96,89,76,78,91,86,102,113,112,115,125,115,
-    121,128,127,134,140,142,139,135,130,117,108,107,101,99,109,114,
-    115,132,134,128,143,144,133,153,150,140,148,137,115,116,104,93,
-    105,114,126,146,160,170,170,165,155,134,120,109,91,89,91,80,
-    89,91,85,88,94,93,105,118,131,145,157,164,161,158,149,133,
-    122,117,105,103,106,105,105,108,113,113,119,135,136,145,157,150,
-    146,151,136,131,139,132,138,150,148,148,146,134,119,108,95,88,
-    83,89,92,96,109,111,112,120,120,120,129,130,133,141,139,137,
-    134,124,115,107,102,98,100,106,113,122,135,135,141,150,143,149,
-    153,144,145,143,127,123,117,105,108,113,117,132,142,149,152,152,
-    143,132,119,111,99,95,97,93,98,101,100,103,108,106,114,122,
-    126,136,142,142,143,137,129,120,112,106,105,105,112,117,120,131,
-    134,139,147,148,148,151,144,139,138,129,126,128,125,128,132,131,
-    130,130,123,117,112,106,102,102,103,102,107,110,112,115,119,119,
-    122,127,126,129,129,125,122,118,112,108,107,107,110,116,123,126,
-    132,138,139,145,149,150,151,150,144,139,134,126,123,123,123,126,
-    130,131,129,128,122,116,110,106,104,104,106,107,109,112,112,113,
-    117,119,122,128,130,132,133,128,123,116,109,105,104,105,111,117,
-    124,130,135,138,141,143,145,146,147,147,145,142,138,135,133,131,
-    131,131,130,128,125,120,115,110,104,101,99,100,102,106,110,112,
-    115,117,119,121,124,126,129,130,130,128,124,120,117,113,113,115,
-    116,120,125,127,131,134,137,138,141,141,141,142,141,140,141,141,
-    141,142,141,138,134,127,117,109,100,93,90,88,90,94,99,105,
-    111,117,121,124,129,130,132,134,132,130,130,125,122,121,118,117,
-    120,121,124,130,133,136,141,141,142,144,143,144,146,147,146,147,
-    143,137,129,119,108,99,93,87,87,88,91,96,101,105,111,116,
-    119,124,128,129,132,133,130,128,125,121,120,119,119,122,126,131,
-    136,142,145,147,148,148,146,146,145,145,145,144,141,137,130,122,
-    113,104,96,91,88,87,88,90,94,99,104,110,116,122,126,131,
-    132,132,131,126,122,118,113,112,112,114,118,124,130,138,144,150,
-    154,157,158,157,156,154,149,145,141,134,129,123,115,110,104,98,
-    96,93,92,94,95,98,102,105,109,113,116,118,120,122,122,123,
-    123,122,122,121,121,122,122,125,128,130,136,139,140,144,144,144,
-    148,148,149,155,152,152,150,140,135,126,115,109,103,98,98,97,
-    98,99,100,101,104,106,110,112,116,118,119,120,119,117,117,114,
-    114,116,115,119,123,126,132,136,138,143,145,147,150,150,149,148,
-    146,143,139,135,130,126,124,122,122,121,122,121,121,119,117,115,
-    111,110,107,106,105,105,104,105,105,106,107,108,110,113,115,119,
-    122,125,127,128,130,130,133,134,136,138,140,141,142,142,141,140,
-    139,138,137,135,134,133,131,130,127,126,124,123,121,120,119,119,
-    118,117,116,115,113,111,110,110,110,111,113,114,116,117,119,120,
-    122,123,125,125,126,126,125,125,125,126,127,129,130,131,132,132,
-    131,131,131,131,131,131,130,130,128,127,125,123,121,119,118,118,
-    118,119,120,120,122,122,122,122,122,122,121,121,121,121,120,119,
-    119,119,119,119,120,121,122,122,122,122,123,122,123,123,124,125,
-    126,126,127,126,126,125,125,124,125,125,125,126,126,127,127,128,
-    129,129,129,130,130,130,130,129,128,127,126,125,124,123,122,121,
-    120,120,119,119,120,121,121,122,122,123,123,123,123,122,120,118,
-    116,115,114,114,114,115,117,119,121,123,125,126,128,129,131,131,
-    132,132,131,130,129,128,127,127,126,126,126,126,126,126,127,127,
-    127,127,126,126,125,124,123,122,120,119,118,117,117,116,117,117,
-    117,117,117,117,117,117,118,118,119,120,121,122,124,124,126,126,
-    127,127,127,128,128,128,129,129,129,129,128,128,128,128,128,129,
-    128,128,127,126,126,125,125,125,125,124,123,122,121,119,118,118,
-    119,119,120,121,121,121,121,121,121,122,121,122,122,122,121,122,
-    121,121,122,122,123,124,125,126,127,127,128,128,127,127,127,126,
-    127,126,125,124,124,123,123,122,123,124,124,125,126,125,125,125,
-    124,125,124,124,123,123,123,122,122,122,123,123,123,123,123,123,
-    123,123,123,124,124,124,125,125,125,125,125,125,125,124,124,123,
-    123,123,123,123,123,122,123,123,123,124,124,124,125,124,125,124,
-    124,123,123,123,122,122,121,122,121,122,123,123,124,125,125,126,
-    126,126,126,126,126,125,124,123,123,122,122,122,122,122,123,123,
-    124,124,125,125,125,125,126,126,126,125,125,125,124,123,122,121,
-    121,121,121,122,123,123,124,124,125,125,125,125,125,125,125,125,
-    125,125,124,124,123,123,123,122,122,123,123,123,123,124,124,124,
-    124,125,125,125,125,125,125,124,124,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,124,124,124,125,125,124,125,124,
-    123,123,122,122,122,122,122,123,123,123,124,124,125,125,125,125,
-    125,125,124,124,123,123,123,123,123,123,123,123,123,124,123,123,
-    124,124,125,125,125,124,124,123,123,123,123,123,123,123,124,123,
-    123,123,123,124,124,124,124,124,124,123,123,123,123,124,124,124,
-    125,125,124,124,123,123,122,122,122,122,122,122,123,122,123,123,
-    123,124,124,124,125,124,124,124,124,124,123,123,123,123,122,122,
-    122,122,123,123,124,124,125,126,126,126,125,125,125,124,124,124,
-    124,123,123,123,123,123,123,124,124,124,125,124,124,124,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,124,124,125,125,125,
-    124,124,123,123,123,124,124,124,125,125,125,125,125,125,125,125,
-    124,124,124,123,123,123,123,123,123,124,124,124,125,124,124,124,
-    123,123,123,122,122,122,123,123,123,124,124,124,124,124,125,125,
-    125,125,125,125,125,124,124,124,124,124,124,124,124,124,125,125,
-    125,125,125,125,125,125,124,124,123,123,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,124,124,124,124,124,124,124,124,123,123,123,123,
-    123,123,123,123,123,123,123,124,123,123,124,123,123,123,123,123,
-    123,123,123,123,124,124,124,124,124,124,124,124,124,124,124,123,
-    123,123,123,123,123,123,124,124,124,124,124,124,123,123,123,123,
-    123,123,123,123,124,124,124,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,124,124,125,125,125,125,125,124,124,124,
-    124,123,123,122,123,122,122,122,122,123,123,123,123,123,124,124,
-    125,124,124,124,124,124,124,124,124,124,124,124,123,123,123,124,
-    124,124,124,125,125,126,125,125,125,125,125,125,125,124,124,124,
-    124,124,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,124,124,124,123,123,123,123,123,123,124,124,124,124,124,
-    124,124,123,123,124,124,124,125,125,125,125,124,124,124,124,123,
-    123,123,123,123,123,123,124,124,124,124,124,124,124,124,123,123,
-    123,123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,123,124,124,124,124,124,124,124,
-    124,124,124,125,125,124,124,124,124,124,124,124,124,124,125,125,
-    124,124,124,124,124,123,123,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,123,123,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    123,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,123,123,123,123,124,123,123,124,124,123,123,123,123,123,
-    123,123,123,124,123,123,123,123,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,
-    123,123,123,123,123,123,123,124,124,124,123,123,123,123,124,124,
-    124,123,123,123,124,124,124,123,123,123,123,123,123,123,124,124,
-    124,124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,124,124,124,124,124,124,124,124,124,
-    123,123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,123,123,123,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,125,125,124,
-    124,124,124,124,124,124,124,124,124,123,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,123,123,123,123,124,124,124,124,124,
-    124,124,124,124,124,123,123,123,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,124,124,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,124,123,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,
-    123,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,124,124,123,123,123,123,124,124,124,124,124,124,124,124,124,
-    123,123,124,124,124,124,123,123,123,123,123,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,123,123,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,123,123,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,124,123,123,123,123,123,123,123,124,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,123,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,123,
-    123,123,124,123,123,124,124,124,124,124,124,124,123,123,123,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,123,
-    123,123,123,123,123,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,123,123,123,123,124,124,124,124,124,124,
-    124,124,124,123,123,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,123,123,123,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,123,124,124,124,124,124,124,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,124,124,124,124,124,124,123,
-    124,124,123,123,124,124,123,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,123,123,123,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,123,123,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,123,123,123,123,123,123,123,123,123,123,
-    123,124,124,123,123,123,123,123,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,123,123,123,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,124,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,124,124,124,123,123,123,123,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,123,123,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    124,124,124,124,123,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,124,123,123,123,124,124,123,123,124,124,
-    124,123,123,123,123,123,123,123,123,123,123,124,124,124,123,123,
-    123,123,123,123,123,123,123,124,124,124,123,124,124,124,124,124,
-    124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,123,124,124,124,123,124,
-    124,124,123,124,124,124,124,124,124,124,124,123,123,124,124,124,
-    124,124,124,124,124,123,124,124,124,124,124,124,125,124,123,124,
-    124,124,124,124,124,124,124,124,123,124,124,124,124,124,123,124,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    124,124,123,123,123,123,123,123,123,124,124,124,123,124,124,124,
-    124,124,124,124,123,123,123,123,123,123,123,124,124,123,124,124,
-    124,123,124,124,124,123,123,123,124,124,124,124,124,124,124,124,
-    124,124,123,123,123,123,123,123,123,124,123,123,124,124,124,124,
-    124,123,123,123,123,123,123,123,124,124,123,124,124,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,124,124,124,124,124,124,
-    123,124,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,124,124,124,124,123,123,123,123,123,123,123,123,124,
-    124,124,124,123,123,123,123,123,124,123,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,123,124,124,123,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,123,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,123,123,123,123,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,123,123,123,123,124,123,123,123,124,123,
-    124,124,124,124,124,124,123,123,123,123,123,124,124,124,124,123,
-    123,123,123,123,123,123,123,124,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,124,124,124,124,
-    124,124,124,124,123,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,124,124,123,123,123,123,124,124,124,123,123,123,123,
-    123,123,123,124,124,124,124,124,124,124,124,124,124,124,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,123,124,124,124,
-    124,124,124,124,124,124,124,123,123,123,123,123,124,124,124,124,
-    124,124,124,124,123,123,123,123,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,124,124,123,124,124,124,123,123,123,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,123,123,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,124,123,123,123,123,123,123,123,124,123,124,
-    124,123,124,124,124,124,124,124,123,124,123,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,123,123,123,124,124,123,123,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,123,124,124,124,123,123,123,123,123,124,
-    124,124,124,124,124,123,124,123,123,124,124,123,123,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,123,124,123,
-    123,123,123,123,123,124,124,124,124,124,123,123,124,124,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,123,123,123,123,123,124,124,124,123,124,123,123,124,123,123,
-    123,124,124,123,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,124,124,124,123,123,
-    124,124,123,124,124,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,123,123,123,124,124,124,124,124,124,124,
-    124,124,124,123,124,123,123,124,124,124,123,124,124,124,123,123,
-    124,124,124,123,123,123,123,123,123,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    124,124,124,123,123,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,123,123,123,124,124,124,124,124,
-    124,124,123,123,123,123,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    124,123,123,123,123,123,123,123,123,123,123,123,123,123,124,124,
-    123,123,124,124,124,124,124,124,124,123,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,124,
-    124,124,124,124,124,124,124,123,123,124,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,123,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,123,124,123,124,124,124,123,123,
-    124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,123,123,124,124,124,124,123,124,
-    124,124,124,123,123,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,123,123,124,124,124,124,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,124,123,123,124,124,124,
-    124,124,124,124,124,124,123,123,123,124,123,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,123,124,123,124,124,124,124,124,124,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,124,124,124,123,123,123,124,
-    124,123,124,124,124,124,124,124,124,124,123,123,123,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,123,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,125,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,123,123,123,123,123,123,123,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,123,123,123,
-    123,123,123,124,123,124,123,124,124,124,124,124,123,124,124,124,
-    124,124,123,124,124,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,124,124,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,124,124,124,123,124,124,124,124,
-    124,124,124,123,123,123,123,124,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,123,123,124,123,123,
-    123,123,123,123,123,123,123,123,123,123,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,123,124,124,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,123,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,123,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,123,123,123,123,123,123,123,123,123,124,124,124,124,
-    124,123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,124,123,124,124,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,124,124,124,124,124,123,123,124,124,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,124,124,124,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    125,125,123,123,122,125,126,125,124,124,124,124,123,123,124,125,
-    125,125,125,125,124,124,124,124,124,124,124,124,124,123,124,124,
-    123,123,124,124,124,124,124,124,124,124,124,124,124,125,125,125,
-    125,124,124,125,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,125,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,122,122,122,122,122,122,122,
-    122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-    122,122,122,122,122,122,122,122,122,122,122,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,124,
-    123,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,
-    125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
-    125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
-    125,125,124,124,125,125,125,125,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,124,124,124,124,124,124,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,123,124,124,
-    124,124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,124,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,124,124,123,123,123,123,123,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,124,124,123,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,124,123,123,123,123,
-    123,123,123,123,123,124,124,124,124,124,124,124,124,124,124,124,
-    124,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,125,125,125,125,125,125,124,125,
-    124,124,125,125,125,124,125,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,123,123,124,123,124,123,123,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,123,
-    124,123,124,123,123,124,123,123,124,123,124,123,124,124,124,124,
-    123,124,124,124,124,124,124,124,124,123,123,124,123,123,123,123,
-    123,123,123,123,123,123,123,123,123,123,123,123,124,124,123,123,
-    123,123,123,123,124,124,124,124,123,123,123,123,123,123,123,123,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,123,124,123,123,
-    123,123,124,124,123,123,123,124,124,123,123,123,123,123,123,123,
-    123,123,123,123,123,123,124,123,124,124,124,124,124,123,123,123,
-    123,123,124,124,124,123,123,124,124,124,123,123,123,124,123,123,
-    123,123,124,124,124,124,124,124,123,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,123,123,124,124,124,123,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
-    124,124,124,124,124,124,124,124,124    
-};
\ No newline at end of file
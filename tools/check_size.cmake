@@ -0,0 +1,11 @@
+# Fail the build when a file would reach the flash that follows it
+#   cmake -DFILE=<path> -DLIMIT=<bytes> -DNAME=<what follows> -P check_size.cmake
+# Reads the file rather than using file(SIZE), which needs CMake 3.14
+
+file(READ ${FILE} data HEX)
+string(LENGTH "${data}" length)
+math(EXPR size "${length} / 2")
+
+if(NOT size LESS LIMIT)
+    message(FATAL_ERROR "${FILE} is ${size} bytes, so it overlaps the ${NAME} at ${LIMIT} bytes")
+endif()
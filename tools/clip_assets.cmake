@@ -0,0 +1,27 @@
+# Convert WAV files into a clip bank image that is linked into a target
+#   clip_bank_assets(<target> <symbol> <tool> <tool target> <clipbank arguments>...)
+# The image is linked with .incbin as const uint8_t <symbol>[], rather than compiled from a C array,
+# and <symbol>.h declares it with the index, length and rate of each clip
+
+function(clip_bank_assets target symbol tool tool_target)
+    set(dir ${CMAKE_CURRENT_BINARY_DIR}/${symbol})
+    set(wavs)
+
+    foreach(arg ${ARGN})
+        if(arg MATCHES "\\.[wW][aA][vV]$")
+            list(APPEND wavs ${arg})
+        endif()
+    endforeach()
+
+    file(MAKE_DIRECTORY ${dir})
+
+    add_custom_command(OUTPUT ${dir}/${symbol}.bin ${dir}/${symbol}.S ${dir}/${symbol}.h
+                       COMMAND ${tool} -o ${dir}/${symbol}.bin -s ${dir}/${symbol}.S -H ${dir}/${symbol}.h
+                                       -n ${symbol} ${ARGN}
+                       DEPENDS ${tool_target} ${wavs}
+                       COMMENT "Converting clips for ${symbol}"
+                       VERBATIM)
+
+    target_sources(${target} PRIVATE ${dir}/${symbol}.S ${dir}/${symbol}.h)
+    target_include_directories(${target} PRIVATE ${dir})
+endfunction()
@@ -0,0 +1,351 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include "clip_convert.h"
+/*
+   Resampling, loudness and dithered quantisation of clips
+ */
+
+#define RESAMPLE_ZEROS 16           // Zero crossings of the sinc either side of the centre
+#define RESAMPLE_BETA 8.0           // Kaiser window shape, about 80dB of stop band rejection
+#define RESAMPLE_PASSBAND 0.92      // Cutoff as a fraction of the lower Nyquist frequency
+#define RESAMPLE_MAX_PHASES 4096    // Rates with a finer common step use the nearest of this many phases
+
+#define LOUDNESS_BLOCK 0.4          // Gating block in seconds, each a quarter block after the last
+#define LOUDNESS_ABSOLUTE_GATE -70.0
+#define LOUDNESS_RELATIVE_GATE -10.0
+#define LOUDNESS_SILENT -200.0
+
+#define DITHER_SEED 0x9E3779B9u     // Every clip starts from the same seed
+
+void mixMono(Audio& audio)
+{
+    if (audio.channels <= 1)
+    {
+        return;
+    }
+
+    uint32_t frames = audio.frames();
+
+    for (uint32_t i=0; i<frames; ++i)
+    {
+        float sum = 0.0f;
+
+        for (unsigned c=0; c<audio.channels; ++c)
+        {
+            sum += audio.samples[(i * audio.channels) + c];
+        }
+        audio.samples[i] = sum / (float)audio.channels;
+    }
+    audio.samples.resize(frames);
+    audio.channels = 1;
+}
+
+// Zeroth order modified Bessel function, for the Kaiser window
+static double besselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+
+    for (int k=1; k<50; ++k)
+    {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < (sum * 1e-17))
+        {
+            break;
+        }
+    }
+    return sum;
+}
+
+void resampleAudio(Audio& audio, uint32_t rate)
+{
+    uint32_t frames = audio.frames();
+
+    if (!rate || (rate == audio.rate) || !frames)
+    {
+        return;
+    }
+
+    // Output frame n is at input frame n * down / up
+    uint64_t common = std::gcd(audio.rate, rate);
+    uint64_t up = rate / common;
+    uint64_t down = audio.rate / common;
+    double cutoff = RESAMPLE_PASSBAND * std::min(1.0, (double)rate / (double)audio.rate);
+    int half = 2 * (int)std::ceil(RESAMPLE_ZEROS / (2.0 * cutoff));
+    int taps = 2 * half;                    // A multiple of 4, for the unrolled filter
+    uint32_t phases = (uint32_t)std::min<uint64_t>(up, RESAMPLE_MAX_PHASES);
+    std::vector<float> table((size_t)phases * taps);
+
+    // Each phase is normalised to unity gain, so a constant passes unchanged
+    for (uint32_t p=0; p<phases; ++p)
+    {
+        float* row = &table[(size_t)p * taps];
+        double frac = (double)p / (double)phases;
+        double sum = 0.0;
+
+        for (int j=0; j<taps; ++j)
+        {
+            double t = (double)(j - half + 1) - frac;
+            double r = t / half;
+            double w = (std::fabs(r) < 1.0) ? (besselI0(RESAMPLE_BETA * std::sqrt(1.0 - (r * r))) / besselI0(RESAMPLE_BETA)) : 0.0;
+            double x = M_PI * cutoff * t;
+            double h = cutoff * ((x == 0.0) ? 1.0 : (std::sin(x) / x)) * w;
+
+            row[j] = (float)h;
+            sum += h;
+        }
+        for (int j=0; j<taps; ++j)
+        {
+            row[j] = (float)(row[j] / sum);
+        }
+    }
+
+    uint32_t out_frames = (uint32_t)((((uint64_t)frames * up) + down - 1) / down);
+    std::vector<float> out((size_t)out_frames * audio.channels);
+    std::vector<float> padded((size_t)frames + (2 * taps));
+
+    // One channel at a time, padded with silence so every filter stays inside the buffer
+    for (unsigned c=0; c<audio.channels; ++c)
+    {
+        for (uint32_t i=0; i<frames; ++i)
+        {
+            padded[i + half] = audio.samples[((size_t)i * audio.channels) + c];
+        }
+
+        for (uint32_t n=0; n<out_frames; ++n)
+        {
+            uint64_t pos = (uint64_t)n * down;
+            uint64_t index = pos / up;
+            uint64_t p = pos % up;
+
+            if (phases != up)
+            {
+                p = ((p * phases) + (up / 2)) / up;
+                index += (p == phases);
+                p = (p == phases) ? 0 : p;
+            }
+
+            // First tap is at input frame index - half + 1
+            const float* x = &padded[index + 1];
+            const float* h = &table[p * taps];
+            float a0 = 0.0f;
+            float a1 = 0.0f;
+            float a2 = 0.0f;
+            float a3 = 0.0f;
+
+            for (int j=0; j<taps; j+=4)
+            {
+                a0 += x[j] * h[j];
+                a1 += x[j + 1] * h[j + 1];
+                a2 += x[j + 2] * h[j + 2];
+                a3 += x[j + 3] * h[j + 3];
+            }
+            out[((size_t)n * audio.channels) + c] = (a0 + a1) + (a2 + a3);
+        }
+    }
+    audio.samples.swap(out);
+    audio.rate = rate;
+}
+
+// Direct form biquad
+struct Biquad
+{
+    double b0, b1, b2, a1, a2;
+    double z1 = 0.0;
+    double z2 = 0.0;
+
+    double run(double x)
+    {
+        double y = (b0 * x) + z1;
+
+        z1 = (b1 * x) - (a1 * y) + z2;
+        z2 = (b2 * x) - (a2 * y);
+        return y;
+    }
+};
+
+static double blockLoudness(double power)
+{
+    return (power > 0.0) ? (-0.691 + (10.0 * std::log10(power))) : LOUDNESS_SILENT;
+}
+
+double measureLoudness(const Audio& audio)
+{
+    uint32_t frames = audio.frames();
+    double rate = audio.rate;
+
+    if (!frames || !rate)
+    {
+        return LOUDNESS_SILENT;
+    }
+
+    // K weighting, a high shelf for the head then a high pass, designed for this rate
+    double k = std::tan(M_PI * 1681.974450955533 / rate);
+    double q = 0.7071752369554196;
+    double vh = std::pow(10.0, 3.999843853973347 / 20.0);
+    double vb = std::pow(vh, 0.4996667741545416);
+    double a0 = 1.0 + (k / q) + (k * k);
+    Biquad shelf = {(vh + (vb * k / q) + (k * k)) / a0, 2.0 * ((k * k) - vh) / a0, (vh - (vb * k / q) + (k * k)) / a0,
+                    2.0 * ((k * k) - 1.0) / a0, (1.0 - (k / q) + (k * k)) / a0};
+
+    k = std::tan(M_PI * 38.13547087602444 / rate);
+    q = 0.5003270373238773;
+    a0 = 1.0 + (k / q) + (k * k);
+    Biquad high_pass = {1.0, -2.0, 1.0, 2.0 * ((k * k) - 1.0) / a0, (1.0 - (k / q) + (k * k)) / a0};
+
+    // Mean square of each quarter block, summed over the channels
+    uint32_t step = std::max<uint32_t>(1, (uint32_t)std::lround(rate * LOUDNESS_BLOCK / 4.0));
+    std::vector<double> quarters((frames + step - 1) / step, 0.0);
+
+    for (unsigned c=0; c<audio.channels; ++c)
+    {
+        Biquad s = shelf;
+        Biquad h = high_pass;
+
+        for (uint32_t i=0; i<frames; ++i)
+        {
+            double y = h.run(s.run(audio.samples[((size_t)i * audio.channels) + c]));
+
+            quarters[i / step] += y * y;
+        }
+    }
+
+    // Blocks of four quarters, or the whole clip when it is shorter than one block
+    std::vector<double> blocks;
+
+    // A partial quarter at the end is left out
+    size_t whole = frames / step;
+
+    if (whole < 4)
+    {
+        blocks.push_back(std::accumulate(quarters.begin(), quarters.end(), 0.0) / frames);
+    }
+    for (size_t i=0; (i + 4) <= whole; ++i)
+    {
+        blocks.push_back((quarters[i] + quarters[i + 1] + quarters[i + 2] + quarters[i + 3]) / (4.0 * step));
+    }
+
+    // Blocks above the absolute gate set the relative gate, and blocks above both are averaged
+    double gate = LOUDNESS_ABSOLUTE_GATE;
+
+    for (int pass=0; pass<2; ++pass)
+    {
+        double sum = 0.0;
+        size_t count = 0;
+
+        for (double power : blocks)
+        {
+            if (blockLoudness(power) > gate)
+            {
+                sum += power;
+                ++count;
+            }
+        }
+
+        if (!count)
+        {
+            return LOUDNESS_SILENT;
+        }
+        if (pass)
+        {
+            return blockLoudness(sum / count);
+        }
+        gate = blockLoudness(sum / count) + LOUDNESS_RELATIVE_GATE;
+    }
+    return LOUDNESS_SILENT;
+}
+
+float measurePeak(const Audio& audio)
+{
+    float peak = 0.0f;
+
+    for (float x : audio.samples)
+    {
+        peak = std::max(peak, std::fabs(x));
+    }
+    return peak;
+}
+
+void applyGain(Audio& audio, float gain)
+{
+    for (float& x : audio.samples)
+    {
+        x *= gain;
+    }
+}
+
+// Round a sample to an unsigned level of bits
+static uint32_t roundLevel(float x, unsigned bits)
+{
+    float half = (float)(1u << (bits - 1));
+    long level = std::lround((x * half) + half);
+    long top = (1L << bits) - 1;
+
+    return (uint32_t)((level < 0) ? 0 : ((level > top) ? top : level));
+}
+
+// True when every sample is exactly one of the levels, such as 8 bit WAV data stored in 8 bits
+static bool onLevels(const Audio& audio, unsigned bits)
+{
+    float half = (float)(1u << (bits - 1));
+
+    for (float x : audio.samples)
+    {
+        float level = (x * half) + half;
+
+        if ((level != std::floor(level)) || (level < 0.0f) || (level >= (2.0f * half)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void quantiseAudio(const Audio& audio, unsigned bits, dither_mode mode, std::vector<uint32_t>& levels)
+{
+    size_t count = audio.samples.size();
+
+    levels.resize(count);
+
+    if ((mode == dither_none) || onLevels(audio, bits))
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            levels[i] = roundLevel(audio.samples[i], bits);
+        }
+        return;
+    }
+
+    float half = (float)(1u << (bits - 1));
+    long top = (1L << bits) - 1;
+    unsigned order = (mode == dither_shape2) ? 2 : ((mode == dither_shape1) ? 1 : 0);
+    uint32_t seed = DITHER_SEED;
+    std::vector<float> error(2 * audio.channels, 0.0f);
+
+    for (size_t i=0; i<count; ++i)
+    {
+        float* e = &error[2 * (i % audio.channels)];
+        float u = (audio.samples[i] * half) + half;
+        float d = 0.0f;
+
+        u -= (order == 1) ? e[0] : ((order == 2) ? ((2.0f * e[0]) - e[1]) : 0.0f);
+
+        // Sum of two uniform values from xorshift32, giving triangular dither from -1 to 1 level
+        for (int r=0; r<2; ++r)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            d += (float)(seed >> 8) * (1.0f / 16777216.0f);
+        }
+
+        long q = std::lround(u + d - 1.0f);
+
+        // Error is taken before clipping, so the loop stays stable at full scale
+        e[1] = e[0];
+        e[0] = (float)q - u;
+        levels[i] = (uint32_t)((q < 0) ? 0 : ((q > top) ? top : q));
+    }
+}
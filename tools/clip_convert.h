@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/*
+   Signal processing for clips on their way into flash
+   Every step is deterministic, so the same WAV files always give the same bank image
+ */
+
+// Decoded audio, interleaved samples from -1 to 1
+struct Audio
+{
+    uint32_t rate = 0;
+    unsigned channels = 0;
+    std::vector<float> samples;
+
+    uint32_t frames() const {return channels ? (uint32_t)(samples.size() / channels) : 0;}
+};
+
+// Quantisation of samples to the stored resolution
+enum dither_mode
+{
+    dither_none = 0,                    // Round to the nearest level
+    dither_tpdf = dither_none + 1,      // Triangular dither of 1 level either side, so the error is noise
+    dither_shape1 = dither_tpdf + 1,    // TPDF with first order error feedback, as dmaFill shaping 1
+    dither_shape2 = dither_shape1 + 1,  // TPDF with second order error feedback, as dmaFill shaping 2
+};
+
+// Average the channels
+extern void mixMono(Audio& audio);
+
+// Change the sample rate with a windowed sinc filter, cutting off below the lower Nyquist frequency
+extern void resampleAudio(Audio& audio, uint32_t rate);
+
+// Integrated loudness in LUFS, K weighted and gated as ITU-R BS.1770. Very low for silence
+extern double measureLoudness(const Audio& audio);
+
+// Largest sample magnitude
+extern float measurePeak(const Audio& audio);
+
+extern void applyGain(Audio& audio, float gain);
+
+// Unsigned levels of bits, from 0 for -1 up to (1 << bits) - 1
+// Clips whose samples all sit on the levels already are stored exactly, without dither
+extern void quantiseAudio(const Audio& audio, unsigned bits, dither_mode mode, std::vector<uint32_t>& levels);
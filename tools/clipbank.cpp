@@ -0,0 +1,707 @@
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "adpcm.h"
+#include "clip_bank.h"
+}
+#include "clip_convert.h"
+
+/*
+   Converts WAV files to flash clips, and builds a clip bank image for the flash state of the firmware
+   The image is written to flash at CLIP_BANK_OFFSET with
+     picotool load -t bin -o 0x10100000 bank.bin
+
+   clipbank -o bank.bin [-s bank.S] [-H bank.h] [-n symbol] [-c clip.h] [options] clip.wav ...
+     -s write assembly that links the image into a program with .incbin
+     -H write a header declaring the linked image, with the index and length of each clip
+     -n symbol of the linked image, clip_assets by default
+     -c write the only clip as a header for FLASH_HEADER, in place of the converter notebook
+   Options apply to the clips that follow
+     -f u8, u12, u16 or adpcm. u12 by default
+     -b resolution of u16 clips in bits, 16 by default
+     -r resample to this rate. 0 keeps the rate of each file, which is the default
+     -d none, tpdf, shape1 or shape2 dither when quantising. tpdf by default
+     -L normalise to this loudness in LUFS, keeping peaks below -1dBFS. off by default
+     -m mix to mono. ADPCM clips are always mixed to mono
+     -l loop points in frames of the WAV file, for the next clip only. The whole clip loops by default
+ */
+
+#define PEAK_CEILING 0.891f         // -1dBFS, the most that loudness normalisation may raise a peak to
+#define READ_FRAMES 65536           // Frames read from a WAV file at a time
+
+// Options for the clips that follow
+struct ClipOptions
+{
+    circular_format format = circular_u12;
+    uint bits = 16;
+    uint32_t rate = 0;
+    dither_mode dither = dither_tpdf;
+    bool normalise = false;
+    double loudness = 0.0;
+    bool mono = false;
+    uint32_t loop_start = 0;
+    uint32_t loop_end = 0;
+};
+
+static uint32_t readLe(const uint8_t* p, uint bytes)
+{
+    uint32_t v = 0;
+
+    for (uint i=0; i<bytes; ++i)
+    {
+        v |= (uint32_t)p[i] << (8 * i);
+    }
+    return v;
+}
+
+static void writeLe(std::vector<uint8_t>& out, uint32_t v, uint bytes)
+{
+    for (uint i=0; i<bytes; ++i)
+    {
+        out.push_back((v >> (8 * i)) & 0xFF);
+    }
+}
+
+// One sample of WAV data, from -1 to 1
+static inline float wavSample(const uint8_t* p, uint bits, bool ieee)
+{
+    switch (bits)
+    {
+        case 8:
+            // 8 bit WAV data is unsigned
+            return ((float)p[0] - 128.0f) / 128.0f;
+
+        case 16:
+            return (float)(int16_t)(p[0] | (p[1] << 8)) / 32768.0f;
+
+        case 24:
+            return (float)((int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24)) >> 8) /
+                   8388608.0f;
+
+        default:
+        {
+            uint32_t v = readLe(p, 4);
+            float x;
+
+            if (ieee)
+            {
+                memcpy(&x, &v, sizeof(x));
+                return x;
+            }
+            return (float)(int32_t)v / 2147483648.0f;
+        }
+    }
+}
+
+// Read PCM or float WAV data a block at a time, mixing to mono as it is read when mono is set
+// Returns false if the file cannot be used
+static bool readWav(const char* path, Audio& audio, bool mono)
+{
+    FILE* f = fopen(path, "rb");
+    uint8_t riff[12];
+
+    if (!f)
+    {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+
+    if ((fread(riff, 1, sizeof(riff), f) != sizeof(riff)) || memcmp(riff, "RIFF", 4) || memcmp(riff + 8, "WAVE", 4))
+    {
+        fprintf(stderr, "%s: not a WAV file\n", path);
+        fclose(f);
+        return false;
+    }
+
+    uint format = 0;
+    uint bits = 0;
+    long data = -1;
+    uint32_t data_bytes = 0;
+    uint8_t chunk[48];
+
+    while (fread(chunk, 1, 8, f) == 8)
+    {
+        uint32_t size = readLe(chunk + 4, 4);
+        long next = ftell(f) + (long)size + (size & 1);
+
+        if (!memcmp(chunk, "fmt ", 4) && (size >= 16))
+        {
+            uint32_t n = (size < (sizeof(chunk) - 8)) ? size : (sizeof(chunk) - 8);
+
+            if (fread(chunk + 8, 1, n, f) != n)
+            {
+                break;
+            }
+            format = readLe(chunk + 8, 2);
+            audio.channels = readLe(chunk + 10, 2);
+            audio.rate = readLe(chunk + 12, 4);
+            bits = readLe(chunk + 22, 2);
+
+            // WAVE_FORMAT_EXTENSIBLE keeps the format in the sub format GUID
+            if ((format == 0xFFFE) && (n >= 26))
+            {
+                format = readLe(chunk + 32, 2);
+            }
+        }
+        else if (!memcmp(chunk, "data", 4))
+        {
+            data = ftell(f);
+            data_bytes = size;
+        }
+
+        if (fseek(f, next, SEEK_SET))
+        {
+            break;
+        }
+    }
+
+    bool pcm = (format == 1) && ((bits == 8) || (bits == 16) || (bits == 24) || (bits == 32));
+    bool ieee = (format == 3) && (bits == 32);
+
+    long end = (fseek(f, 0, SEEK_END) == 0) ? ftell(f) : -1;
+
+    if ((data < 0) || (end < data) || !audio.channels || !audio.rate || !(pcm || ieee) || fseek(f, data, SEEK_SET))
+    {
+        fprintf(stderr, "%s: unsupported format %u, %u bits\n", path, format, bits);
+        fclose(f);
+        return false;
+    }
+
+    // The data size of a file that was streamed may be larger than the file, so it is limited to the bytes left
+    uint channels = audio.channels;
+    uint frame_bytes = (bits / 8) * channels;
+    uint out_channels = mono ? 1 : channels;
+    std::vector<uint8_t> buffer((size_t)READ_FRAMES * frame_bytes);
+    uint64_t available = (uint64_t)(end - data);
+    uint32_t remaining = (uint32_t)(((data_bytes < available) ? data_bytes : available) / frame_bytes);
+    size_t frames;
+
+    audio.samples.clear();
+    audio.samples.reserve((size_t)remaining * out_channels);
+
+    while (remaining && ((frames = fread(buffer.data(), frame_bytes, (remaining < READ_FRAMES) ? remaining : READ_FRAMES, f)) > 0))
+    {
+        const uint8_t* p = buffer.data();
+
+        for (size_t i=0; i<frames; ++i)
+        {
+            if (mono && (channels > 1))
+            {
+                float sum = 0.0f;
+
+                for (uint c=0; c<channels; ++c, p+=bits/8)
+                {
+                    sum += wavSample(p, bits, ieee);
+                }
+                audio.samples.push_back(sum / (float)channels);
+            }
+            else
+            {
+                for (uint c=0; c<channels; ++c, p+=bits/8)
+                {
+                    audio.samples.push_back(wavSample(p, bits, ieee));
+                }
+            }
+        }
+        remaining -= (uint32_t)frames;
+    }
+    fclose(f);
+    audio.channels = out_channels;
+    return true;
+}
+
+// Store the clip in the format, returning the resolution in bits
+static uint encodeClip(const Audio& audio, const ClipOptions& options, std::vector<uint8_t>& out)
+{
+    std::vector<uint32_t> levels;
+
+    switch (options.format)
+    {
+        case circular_u8:
+            quantiseAudio(audio, 8, options.dither, levels);
+            out.insert(out.end(), levels.begin(), levels.end());
+            return 8;
+
+        case circular_u12:
+            quantiseAudio(audio, 12, options.dither, levels);
+
+            for (size_t i=0; i<levels.size(); i+=2)
+            {
+                uint32_t a = levels[i];
+                uint32_t b = ((i + 1) < levels.size()) ? levels[i + 1] : a;
+
+                out.push_back(a & 0xFF);
+                out.push_back((a >> 8) | ((b & 0xF) << 4));
+                if ((i + 1) < levels.size())
+                {
+                    out.push_back(b >> 4);
+                }
+            }
+            return 12;
+
+        case circular_adpcm:
+        {
+            std::vector<int16_t> pcm;
+            std::vector<uint8_t> blocks;
+
+            quantiseAudio(audio, 16, options.dither, levels);
+            pcm.resize(levels.size());
+            blocks.resize(ADPCM_BYTES(levels.size()));
+
+            for (size_t i=0; i<levels.size(); ++i)
+            {
+                pcm[i] = (int16_t)((int32_t)levels[i] - 0x8000);
+            }
+            blocks.resize(adpcmEncode(blocks.data(), pcm.data(), (uint)pcm.size()));
+            out.insert(out.end(), blocks.begin(), blocks.end());
+            return 4;
+        }
+
+        default:
+            quantiseAudio(audio, options.bits, options.dither, levels);
+
+            for (uint32_t level : levels)
+            {
+                writeLe(out, level, 2);
+            }
+            return options.bits;
+    }
+}
+
+// Raise or lower the clip to the loudness, as far as the peak allows
+static void normaliseClip(Audio& audio, double target, const char* name)
+{
+    double loudness = measureLoudness(audio);
+    float peak = measurePeak(audio);
+    double gain_db = target - loudness;
+    float gain;
+
+    if (loudness <= -100.0)
+    {
+        printf("%-15s silent, not normalised\n", name);
+        return;
+    }
+
+    gain = (float)pow(10.0, gain_db / 20.0);
+    if ((peak * gain) > PEAK_CEILING)
+    {
+        gain = PEAK_CEILING / peak;
+    }
+    applyGain(audio, gain);
+    printf("%-15s %6.1f LUFS, gain %+5.1f dB%s\n", name, loudness, 20.0 * log10(gain),
+           (gain < (float)pow(10.0, gain_db / 20.0)) ? ", limited by the peak" : "");
+}
+
+// Move a frame of the WAV file to the resampled clip
+static uint32_t scaleFrame(uint32_t frame, uint32_t from, uint32_t to)
+{
+    return (uint32_t)((((uint64_t)frame * to) + (from / 2)) / from);
+}
+
+static bool parseDither(const char* name, dither_mode& mode)
+{
+    static const char* names[] = {"none", "tpdf", "shape1", "shape2"};
+
+    for (uint i=0; i<count_of(names); ++i)
+    {
+        if (!strcmp(name, names[i]))
+        {
+            mode = (dither_mode)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parseFormat(const char* name, circular_format& format)
+{
+    static const char* names[] = {"u16", "u8", "u12", "adpcm"};
+
+    for (uint i=0; i<count_of(names); ++i)
+    {
+        if (!strcmp(name, names[i]))
+        {
+            format = (circular_format)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Clip name from the file name, without the directory or extension
+static std::string clipName(const char* path)
+{
+    std::string name(path);
+    size_t slash = name.find_last_of("/\\");
+    size_t dot;
+
+    name = (slash == std::string::npos) ? name : name.substr(slash + 1);
+    dot = name.find_last_of('.');
+    name = (dot == std::string::npos) ? name : name.substr(0, dot);
+    return name.substr(0, CLIP_BANK_NAME_LENGTH - 1);
+}
+
+// Upper case C identifier for a header macro
+static std::string macroName(const std::string& name)
+{
+    std::string macro;
+
+    for (char c : name)
+    {
+        macro += isalnum((unsigned char)c) ? (char)toupper((unsigned char)c) : '_';
+    }
+    return macro;
+}
+
+// Assembly that links the image file, so it is never compiled as a C array
+static bool writeAssembly(const char* path, const char* image, const std::string& symbol)
+{
+    FILE* f = fopen(path, "w");
+
+    if (!f)
+    {
+        fprintf(stderr, "%s: cannot write\n", path);
+        return false;
+    }
+    fprintf(f, "// Generated by clipbank, do not edit\n");
+    fprintf(f, "    .section .rodata.%s, \"a\"\n", symbol.c_str());
+    fprintf(f, "    .balign 4\n");
+    fprintf(f, "    .global %s\n", symbol.c_str());
+    fprintf(f, "    .type %s, %%object\n", symbol.c_str());
+    fprintf(f, "%s:\n", symbol.c_str());
+    fprintf(f, "    .incbin \"%s\"\n", image);
+    fprintf(f, "    .size %s, . - %s\n", symbol.c_str(), symbol.c_str());
+    fprintf(f, "    .global %s_end\n", symbol.c_str());
+    fprintf(f, "%s_end:\n", symbol.c_str());
+    fprintf(f, "    .section .note.GNU-stack, \"\", %%progbits\n");
+    fclose(f);
+    return true;
+}
+
+// Header declaring the linked image and the directory it holds
+static bool writeHeader(const char* path, const std::string& symbol, const std::vector<clip_bank_entry>& entries,
+                        uint32_t size)
+{
+    FILE* f = fopen(path, "w");
+    std::string prefix = macroName(symbol);
+
+    if (!f)
+    {
+        fprintf(stderr, "%s: cannot write\n", path);
+        return false;
+    }
+    fprintf(f, "#pragma once\n");
+    fprintf(f, "// Generated by clipbank, do not edit\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// Clip bank image, for clipBankOpen\n");
+    fprintf(f, "extern const uint8_t %s[];\n", symbol.c_str());
+    fprintf(f, "extern const uint8_t %s_end[];\n\n", symbol.c_str());
+    fprintf(f, "#define %s_SIZE %u\n", prefix.c_str(), size);
+    fprintf(f, "#define %s_COUNT %u\n", prefix.c_str(), (uint)entries.size());
+
+    for (size_t i=0; i<entries.size(); ++i)
+    {
+        std::string clip = prefix + "_" + macroName(entries[i].name);
+
+        fprintf(f, "#define %s %u\n", clip.c_str(), (uint)i);
+        fprintf(f, "#define %s_FRAMES %u\n", clip.c_str(), entries[i].frames);
+        fprintf(f, "#define %s_RATE %u\n", clip.c_str(), entries[i].sample_rate);
+    }
+    fclose(f);
+    return true;
+}
+
+// Header for a single clip, as written by the converter notebook, for FLASH_HEADER in the firmware
+static bool writeClipHeader(const char* path, const char* source, const clip_bank_entry& entry,
+                            const std::vector<uint8_t>& clip)
+{
+    bool words = (entry.format == circular_u16);
+
+    if ((entry.channels != 1) || (words && (entry.bits != 8) && (entry.bits != 12)))
+    {
+        fprintf(stderr, "%s: clip headers hold mono clips, and u16 clips of 8 or 12 bits\n", path);
+        return false;
+    }
+
+    FILE* f = fopen(path, "w");
+
+    if (!f)
+    {
+        fprintf(stderr, "%s: cannot write\n", path);
+        return false;
+    }
+    fprintf(f, "/*    File %s\n *    Sample rate %u Hz\n */\n", source, entry.sample_rate);
+    fprintf(f, "%s", (entry.format == circular_adpcm) ? "#define ADPCM \n" : "");
+    fprintf(f, "%s", (entry.bits == 12) ? "#define TWELVE_BIT \n" : "");
+    fprintf(f, "%s", ((entry.format == circular_u8) || (entry.format == circular_u12)) ? "#define PACKED \n" : "");
+    fprintf(f, "#define SAMPLE_RATE %u \n", entry.sample_rate);
+    fprintf(f, "#define WAV_DATA_LENGTH %u \n\n", entry.frames);
+    fprintf(f, "const %s WAV_DATA[] __attribute__((aligned(4))) = {\n", words ? "uint16_t" : "uint8_t");
+
+    uint step = words ? 2 : 1;
+
+    for (size_t i=0; i<clip.size(); i+=step)
+    {
+        bool last = (i + step) >= clip.size();
+
+        fprintf(f, "%s%u%s", ((i / step) % 16) ? "" : "    ", words ? readLe(&clip[i], 2) : clip[i],
+                last ? "\n" : ((((i / step) % 16) == 15) ? ",\n" : ","));
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+    return true;
+}
+
+static int usage(void)
+{
+    fprintf(stderr, "clipbank -o bank.bin [-s bank.S] [-H bank.h] [-n symbol] [-c clip.h] [-f u8|u12|u16|adpcm] [-b bits]\n"
+                    "         [-r rate] [-d none|tpdf|shape1|shape2] [-L lufs|off] [-m] [-l start:end] clip.wav ...\n");
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    const char* output = nullptr;
+    const char* assembly = nullptr;
+    const char* header = nullptr;
+    const char* clip_header = nullptr;
+    std::string symbol = "clip_assets";
+    ClipOptions options;
+    std::vector<clip_bank_entry> entries;
+    std::vector<std::vector<uint8_t>> data;
+
+    for (int i=1; i<argc; ++i)
+    {
+        const char* arg = argv[i];
+
+        if (!strcmp(arg, "-o") && ((i + 1) < argc))
+        {
+            output = argv[++i];
+        }
+        else if (!strcmp(arg, "-s") && ((i + 1) < argc))
+        {
+            assembly = argv[++i];
+        }
+        else if (!strcmp(arg, "-H") && ((i + 1) < argc))
+        {
+            header = argv[++i];
+        }
+        else if (!strcmp(arg, "-n") && ((i + 1) < argc))
+        {
+            symbol = argv[++i];
+        }
+        else if (!strcmp(arg, "-c") && ((i + 1) < argc))
+        {
+            clip_header = argv[++i];
+        }
+        else if (!strcmp(arg, "-b") && ((i + 1) < argc))
+        {
+            options.bits = (uint)atoi(argv[++i]);
+
+            if ((options.bits < 1) || (options.bits > 16))
+            {
+                return usage();
+            }
+        }
+        else if (!strcmp(arg, "-r") && ((i + 1) < argc))
+        {
+            options.rate = (uint32_t)atol(argv[++i]);
+        }
+        else if (!strcmp(arg, "-d") && ((i + 1) < argc))
+        {
+            if (!parseDither(argv[++i], options.dither))
+            {
+                return usage();
+            }
+        }
+        else if (!strcmp(arg, "-L") && ((i + 1) < argc))
+        {
+            const char* level = argv[++i];
+
+            options.normalise = strcmp(level, "off") != 0;
+            if (options.normalise && (sscanf(level, "%lf", &options.loudness) != 1))
+            {
+                return usage();
+            }
+        }
+        else if (!strcmp(arg, "-f") && ((i + 1) < argc))
+        {
+            if (!parseFormat(argv[++i], options.format))
+            {
+                return usage();
+            }
+        }
+        else if (!strcmp(arg, "-l") && ((i + 1) < argc))
+        {
+            unsigned long start = 0;
+            unsigned long end = 0;
+
+            if (sscanf(argv[++i], "%lu:%lu", &start, &end) < 1)
+            {
+                return usage();
+            }
+            options.loop_start = (uint32_t)start;
+            options.loop_end = (uint32_t)end;
+        }
+        else if (!strcmp(arg, "-m"))
+        {
+            options.mono = true;
+        }
+        else if (arg[0] == '-')
+        {
+            return usage();
+        }
+        else
+        {
+            Audio audio;
+            bool mono = options.mono || (options.format == circular_adpcm);
+
+            if (!readWav(arg, audio, mono))
+            {
+                return 1;
+            }
+
+            if (audio.channels > 2)
+            {
+                mixMono(audio);
+            }
+
+            clip_bank_entry entry;
+            std::vector<uint8_t> clip;
+            uint32_t source_rate = audio.rate;
+            uint32_t source_frames = audio.frames();
+
+            if (!source_frames || (options.loop_end > source_frames) ||
+                (options.loop_start >= (options.loop_end ? options.loop_end : source_frames)))
+            {
+                fprintf(stderr, "%s: loop %u:%u does not fit %u frames\n", arg, options.loop_start, options.loop_end,
+                        source_frames);
+                return 1;
+            }
+
+            memset(&entry, 0, sizeof(entry));
+            strncpy(entry.name, clipName(arg).c_str(), CLIP_BANK_NAME_LENGTH - 1);
+            resampleAudio(audio, options.rate);
+
+            if (options.normalise)
+            {
+                normaliseClip(audio, options.loudness, entry.name);
+            }
+
+            entry.frames = audio.frames();
+            entry.loop_start = scaleFrame(options.loop_start, source_rate, audio.rate);
+            entry.loop_end = scaleFrame(options.loop_end, source_rate, audio.rate);
+            entry.sample_rate = audio.rate;
+            entry.format = options.format;
+            entry.channels = audio.channels;
+            entry.bits = encodeClip(audio, options, clip);
+            entry.bytes = (uint32_t)clip.size();
+
+            if (!entry.frames || (entry.loop_end > entry.frames) ||
+                (entry.loop_start >= (entry.loop_end ? entry.loop_end : entry.frames)))
+            {
+                fprintf(stderr, "%s: loop %u:%u does not fit %u frames\n", arg, entry.loop_start, entry.loop_end, entry.frames);
+                return 1;
+            }
+
+            if (clip_header && !entries.empty())
+            {
+                fprintf(stderr, "%s: a clip header holds one clip\n", clip_header);
+                return 1;
+            }
+            if (clip_header && !writeClipHeader(clip_header, arg, entry, clip))
+            {
+                return 1;
+            }
+
+            printf("%-15s %6u Hz %u ch %8u frames %2u bit %8u bytes\n", entry.name, entry.sample_rate, entry.channels,
+                   entry.frames, entry.bits, entry.bytes);
+            entries.push_back(entry);
+            data.push_back(clip);
+
+            // Loop points only apply to one clip
+            options.loop_start = 0;
+            options.loop_end = 0;
+        }
+    }
+
+    if ((!output && !clip_header) || entries.empty())
+    {
+        return usage();
+    }
+    if (!output)
+    {
+        return 0;
+    }
+
+    // Lay out the clips after the directory, each aligned
+    uint32_t offset = (uint32_t)(sizeof(clip_bank_header) + (entries.size() * sizeof(clip_bank_entry)));
+
+    for (size_t i=0; i<entries.size(); ++i)
+    {
+        offset = (offset + CLIP_BANK_ALIGN - 1) & ~(CLIP_BANK_ALIGN - 1);
+        entries[i].offset = offset;
+        offset += entries[i].bytes;
+    }
+
+    std::vector<uint8_t> image;
+
+    writeLe(image, CLIP_BANK_MAGIC, 4);
+    writeLe(image, CLIP_BANK_VERSION, 2);
+    writeLe(image, (uint32_t)entries.size(), 2);
+    writeLe(image, offset, 4);
+    writeLe(image, 0, 4);
+
+    for (const clip_bank_entry& entry : entries)
+    {
+        image.insert(image.end(), entry.name, entry.name + CLIP_BANK_NAME_LENGTH);
+        writeLe(image, entry.offset, 4);
+        writeLe(image, entry.bytes, 4);
+        writeLe(image, entry.frames, 4);
+        writeLe(image, entry.loop_start, 4);
+        writeLe(image, entry.loop_end, 4);
+        writeLe(image, entry.sample_rate, 4);
+        image.push_back(entry.format);
+        image.push_back(entry.bits);
+        image.push_back(entry.channels);
+        image.push_back(0);
+    }
+
+    for (size_t i=0; i<entries.size(); ++i)
+    {
+        image.resize(entries[i].offset, 0);
+        image.insert(image.end(), data[i].begin(), data[i].end());
+    }
+
+    // The image must open as the firmware will see it
+    clip_bank bank;
+
+    if (!clipBankOpen(&bank, image.data()) || (bank.count != entries.size()))
+    {
+        fprintf(stderr, "Bank image does not check\n");
+        return 1;
+    }
+
+    FILE* f = fopen(output, "wb");
+
+    if (!f || (fwrite(image.data(), 1, image.size(), f) != image.size()))
+    {
+        fprintf(stderr, "%s: cannot write\n", output);
+        return 1;
+    }
+    fclose(f);
+
+    if ((assembly && !writeAssembly(assembly, output, symbol)) ||
+        (header && !writeHeader(header, symbol, entries, (uint32_t)image.size())))
+    {
+        return 1;
+    }
+    printf("%u clips, %u bytes\n", (uint)entries.size(), (uint)image.size());
+    return 0;
+}